@@ -0,0 +1,667 @@
+#define _DEFAULT_SOURCE //clock_gettime
+#include "asset-stream.h"
+#include "async-io.h"
+#include "glad.h"
+#include "profile.h"
+#include "stream-buffer.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Reads handed to AsyncIO at once. Enough to keep a disk busy, few enough
+   that what's queued behind them still goes in importance order. */
+#define STREAM_READS_IN_FLIGHT 8
+/* How often hit rate and bandwidth are recomputed */
+#define STATS_WINDOW_NS 1000000000ull
+
+/* Where an asset is on its way in. Guarded by the streamer's lock. */
+typedef enum AssetLoadState
+{
+    ASSET_UNLOADED,
+    ASSET_QUEUED,
+    ASSET_LOADING, /* Its read is in flight */
+    ASSET_LOADED,  /* Waiting for the GL thread */
+    ASSET_FAILED,  /* Couldn't be read or put on the GPU, never retried */
+} AssetLoadState;
+
+struct StreamedAsset
+{
+    AssetStreamer *streamer;
+    const PackEntry *entry;
+    AssetLoadState state;
+    /* The entry's bytes as stored in the pack, read in by AsyncIO and
+       freed once they're on the GPU */
+    u8 *stored;
+    f32 importance;
+    /* Position in the queue while ASSET_QUEUED */
+    ifast32 queueIndex;
+    StreamedAsset *nextLoaded;
+
+    /* GL thread only from here on */
+    bool resident;
+    u64 lastUsedFrame;
+    isize gpuBytes;
+    GLuint texture;
+    GpuAllocation *buffer;
+    /* Resident assets, most recently used first */
+    StreamedAsset *lruPrev;
+    StreamedAsset *lruNext;
+    /* Textures whose stored bytes are freed once their upload is done */
+    StreamedAsset *nextUploading;
+    bool uploading;
+};
+
+struct AssetStreamer
+{
+    const AssetPack *pack;
+    TextureUploader *textures;
+    GpuHeap *heap;
+    /* Where compressed buffer entries are decoded to */
+    StreamBuffer *staging;
+    AssetStreamerConfig config;
+    StreamedAsset *assets;
+
+    AsyncIO *io;
+    AsyncFile file;
+
+    pthread_mutex_t lock;
+    /* Max heap on importance */
+    StreamedAsset **queue;
+    ifast32 queueCount;
+    /* Reads in flight */
+    ifast32 reading;
+    StreamedAsset *loadedHead;
+    StreamedAsset *loadedTail;
+    u64 bytesRead;
+    bool quitting;
+
+    StreamedAsset *lruHead;
+    StreamedAsset *lruTail;
+    StreamedAsset *uploading;
+    u64 frame;
+    AssetStreamStats stats;
+
+    u64 windowStart;
+    u64 windowRequests;
+    u64 windowHits;
+    u64 windowBytesRead;
+};
+
+local u64 ReadNanoseconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+local void SwapQueued(AssetStreamer *s, ifast32 i, ifast32 j)
+{
+    StreamedAsset *tmp = s->queue[i];
+    s->queue[i] = s->queue[j];
+    s->queue[j] = tmp;
+    s->queue[i]->queueIndex = i;
+    s->queue[j]->queueIndex = j;
+}
+
+local void SiftUp(AssetStreamer *s, ifast32 i)
+{
+    while (i > 0 && s->queue[(i - 1) / 2]->importance < s->queue[i]->importance)
+    {
+        SwapQueued(s, i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+local void SiftDown(AssetStreamer *s, ifast32 i)
+{
+    for (;;)
+    {
+        ifast32 largest = i;
+        ifast32 l = i * 2 + 1;
+        ifast32 r = l + 1;
+        if (l < s->queueCount && s->queue[l]->importance > s->queue[largest]->importance)
+        {
+            largest = l;
+        }
+        if (r < s->queueCount && s->queue[r]->importance > s->queue[largest]->importance)
+        {
+            largest = r;
+        }
+        if (largest == i)
+        {
+            return;
+        }
+        SwapQueued(s, i, largest);
+        i = largest;
+    }
+}
+
+local StreamedAsset *PopQueued(AssetStreamer *s)
+{
+    StreamedAsset *top = s->queue[0];
+    s->queueCount--;
+    if (s->queueCount)
+    {
+        s->queue[0] = s->queue[s->queueCount];
+        s->queue[0]->queueIndex = 0;
+        SiftDown(s, 0);
+    }
+    top->queueIndex = -1;
+    return top;
+}
+
+/* On an AsyncIO thread. The freed slot is filled by the next
+   UpdateAssetStreamer rather than from here, SubmitAsyncRead can block
+   until a completion comes in, which could be this thread's next one. */
+local void ReadDone(void *user, isize result)
+{
+    StreamedAsset *a = user;
+    AssetStreamer *s = a->streamer;
+    pthread_mutex_lock(&s->lock);
+    s->reading--;
+    if (result != (isize)a->entry->storedSize)
+    {
+        fprintf(stderr, "STREAM: could not read %s: %s\n", a->entry->name,
+                result < 0 ? strerror((int)-result) : "file too short");
+        free(a->stored);
+        a->stored = NULL;
+        a->state = ASSET_FAILED;
+    }
+    else
+    {
+        a->state = ASSET_LOADED;
+        a->nextLoaded = NULL;
+        if (s->loadedTail)
+        {
+            s->loadedTail->nextLoaded = a;
+        }
+        else
+        {
+            s->loadedHead = a;
+        }
+        s->loadedTail = a;
+        s->bytesRead += result;
+    }
+    pthread_mutex_unlock(&s->lock);
+}
+
+/* Keeps the most important queued entries being read, up to
+   STREAM_READS_IN_FLIGHT at a time. The rest wait in the queue, where a
+   more important request can still overtake them. Main thread only. */
+local void StartReads(AssetStreamer *s)
+{
+    bool started = false;
+    pthread_mutex_lock(&s->lock);
+    while (!s->quitting && s->queueCount && s->reading < STREAM_READS_IN_FLIGHT)
+    {
+        StreamedAsset *a = PopQueued(s);
+        const PackEntry *entry = a->entry;
+        a->stored = malloc(entry->storedSize ? entry->storedSize : 1);
+        if (!a->stored)
+        {
+            fprintf(stderr, "STREAM: no memory to read %s into\n", entry->name);
+            a->state = ASSET_FAILED;
+            continue;
+        }
+        a->state = ASSET_LOADING;
+        s->reading++;
+        /* Completions take the lock */
+        pthread_mutex_unlock(&s->lock);
+        bool submitted = SubmitAsyncRead(s->io, &s->file, entry->offset, entry->storedSize,
+                                         a->stored, ReadDone, a);
+        pthread_mutex_lock(&s->lock);
+        if (!submitted)
+        {
+            s->reading--;
+            free(a->stored);
+            a->stored = NULL;
+            a->state = ASSET_FAILED;
+            continue;
+        }
+        started = true;
+    }
+    pthread_mutex_unlock(&s->lock);
+    if (started)
+    {
+        FlushAsyncIO(s->io);
+    }
+}
+
+AssetStreamer *CreateAssetStreamer(const AssetPack *pack, TextureUploader *textures,
+                                   GpuHeap *heap, const AssetStreamerConfig *config)
+{
+    AssetStreamer *s = calloc(1, sizeof(*s));
+    if (!s)
+    {
+        return NULL;
+    }
+    s->pack = pack;
+    s->textures = textures;
+    s->heap = heap;
+    s->config = *config;
+    if (s->config.ioThreads <= 0)
+    {
+        s->config.ioThreads = 2;
+    }
+    s->staging = CreateStreamBuffer(s->config.uploadBudget, 3, "asset staging");
+
+    ifast32 entryCount;
+    const PackEntry *entries = GetPackEntries(pack, &entryCount);
+    s->assets = calloc(entryCount ? entryCount : 1, sizeof(*s->assets));
+    s->queue = calloc(entryCount ? entryCount : 1, sizeof(*s->queue));
+    s->file.fd = -1;
+    s->file.directFd = -1;
+    if (!OpenAsyncFile(&s->file, GetAssetPackPath(pack), false))
+    {
+        fprintf(stderr, "STREAM: could not open %s\n", GetAssetPackPath(pack));
+    }
+    else
+    {
+        s->io = CreateAsyncIO(STREAM_READS_IN_FLIGHT, s->config.ioThreads);
+    }
+    if (!s->staging || !s->assets || !s->queue || !s->io)
+    {
+        if (s->io)
+        {
+            DestroyAsyncIO(s->io);
+        }
+        CloseAsyncFile(&s->file);
+        if (s->staging)
+        {
+            DestroyStreamBuffer(s->staging);
+        }
+        free(s->assets);
+        free(s->queue);
+        free(s);
+        return NULL;
+    }
+    for (ifast32 i = 0; i < entryCount; i++)
+    {
+        s->assets[i].streamer = s;
+        s->assets[i].entry = &entries[i];
+        s->assets[i].queueIndex = -1;
+    }
+
+    pthread_mutex_init(&s->lock, NULL);
+    s->windowStart = ReadNanoseconds();
+    return s;
+}
+
+local void UnlinkResident(AssetStreamer *s, StreamedAsset *a)
+{
+    if (a->lruPrev)
+    {
+        a->lruPrev->lruNext = a->lruNext;
+    }
+    else
+    {
+        s->lruHead = a->lruNext;
+    }
+    if (a->lruNext)
+    {
+        a->lruNext->lruPrev = a->lruPrev;
+    }
+    else
+    {
+        s->lruTail = a->lruPrev;
+    }
+    a->lruPrev = NULL;
+    a->lruNext = NULL;
+}
+
+local void LinkResident(AssetStreamer *s, StreamedAsset *a)
+{
+    a->lruPrev = NULL;
+    a->lruNext = s->lruHead;
+    if (s->lruHead)
+    {
+        s->lruHead->lruPrev = a;
+    }
+    else
+    {
+        s->lruTail = a;
+    }
+    s->lruHead = a;
+}
+
+StreamedAsset *RequestAsset(AssetStreamer *s, const char *name, f32 importance)
+{
+    const PackEntry *entry = FindPackEntry(s->pack, name);
+    if (!entry)
+    {
+        return NULL;
+    }
+    ifast32 entryCount;
+    StreamedAsset *a = &s->assets[entry - GetPackEntries(s->pack, &entryCount)];
+    a->lastUsedFrame = s->frame;
+    s->stats.requests++;
+    s->windowRequests++;
+
+    if (a->resident)
+    {
+        s->stats.hits++;
+        s->windowHits++;
+        UnlinkResident(s, a);
+        LinkResident(s, a);
+        return a;
+    }
+
+    bool queued = false;
+    pthread_mutex_lock(&s->lock);
+    if (a->state == ASSET_UNLOADED)
+    {
+        a->state = ASSET_QUEUED;
+        a->importance = importance;
+        a->queueIndex = s->queueCount++;
+        s->queue[a->queueIndex] = a;
+        SiftUp(s, a->queueIndex);
+        queued = s->reading < STREAM_READS_IN_FLIGHT;
+    }
+    else if (a->state == ASSET_QUEUED && a->importance != importance)
+    {
+        /* Whatever it looks like this frame is what counts */
+        bool raised = importance > a->importance;
+        a->importance = importance;
+        if (raised)
+        {
+            SiftUp(s, a->queueIndex);
+        }
+        else
+        {
+            SiftDown(s, a->queueIndex);
+        }
+    }
+    pthread_mutex_unlock(&s->lock);
+    if (queued)
+    {
+        StartReads(s);
+    }
+    return a;
+}
+
+f32 ScreenSpaceImportance(f32 radius, f32 distance, f32 fovY, f32 screenHeight)
+{
+    if (distance <= radius)
+    {
+        return screenHeight;
+    }
+    return radius / (distance * tanf(fovY * .5f)) * screenHeight * .5f;
+}
+
+bool IsAssetReady(const StreamedAsset *a)
+{
+    return a->resident &&
+           !(a->texture && IsTextureUploadPending(a->streamer->textures, a->texture));
+}
+
+GLuint GetAssetTexture(const StreamedAsset *a)
+{
+    return a->resident ? a->texture : 0;
+}
+
+GpuRange GetAssetBuffer(const StreamedAsset *a)
+{
+    if (a->resident && a->buffer)
+    {
+        return GetGpuRange(a->buffer);
+    }
+    return (GpuRange){0};
+}
+
+local bool UploadBufferEntry(AssetStreamer *s, StreamedAsset *a)
+{
+    const PackEntry *entry = a->entry;
+    if (entry->compression == PACK_COMPRESSION_NONE)
+    {
+        UploadGpuMemory(a->buffer, 0, a->stored, entry->size);
+        return true;
+    }
+    isize offset;
+    void *dst = AllocStreamBuffer(s->staging, entry->size, 16, &offset);
+    if (dst)
+    {
+        if (!DecodePackEntry(entry, a->stored, 0, entry->size, dst, s->config.jobs))
+        {
+            return false;
+        }
+        GpuRange range = GetGpuRange(a->buffer);
+        glCopyNamedBufferSubData(GetStreamBufferObject(s->staging), range.buffer, offset,
+                                 range.offset, entry->size);
+        return true;
+    }
+    /* Bigger than what's left of this frame's staging */
+    void *decoded = malloc(entry->size);
+    bool ok = decoded &&
+              DecodePackEntry(entry, a->stored, 0, entry->size, decoded, s->config.jobs);
+    if (ok)
+    {
+        UploadGpuMemory(a->buffer, 0, decoded, entry->size);
+    }
+    free(decoded);
+    return ok;
+}
+
+/* Returns the bytes of buffer data copied to the GPU */
+local isize MakeResident(AssetStreamer *s, StreamedAsset *a)
+{
+    const PackEntry *entry = a->entry;
+    isize uploaded = 0;
+    bool ok = true;
+    switch (entry->type)
+    {
+    case PACK_ENTRY_TEXTURE:
+    {
+        /* Uploaded from the stored bytes a piece at a time, they go once
+           it's done */
+        a->texture = QueueStoredPackTexture(s->textures, entry, a->stored);
+        a->gpuBytes = a->texture ? entry->size : 0;
+        if (a->texture)
+        {
+            a->nextUploading = s->uploading;
+            a->uploading = true;
+            s->uploading = a;
+        }
+        else
+        {
+            free(a->stored);
+            a->stored = NULL;
+            ok = false;
+        }
+        break;
+    }
+    case PACK_ENTRY_VERTICES:
+    case PACK_ENTRY_INDICES:
+    {
+        a->buffer = AllocGpuMemory(s->heap, entry->size, 16);
+        if (a->buffer && !UploadBufferEntry(s, a))
+        {
+            FreeGpuMemory(s->heap, a->buffer);
+            a->buffer = NULL;
+        }
+        if (a->buffer)
+        {
+            a->gpuBytes = entry->size;
+            uploaded = entry->size;
+        }
+        ok = a->buffer != NULL;
+        free(a->stored);
+        a->stored = NULL;
+        break;
+    }
+    default:
+    {
+        /* Blobs are read straight out of the pack, the read only warmed
+           the page cache for them */
+        free(a->stored);
+        a->stored = NULL;
+        a->gpuBytes = 0;
+        break;
+    }
+    }
+    if (!ok)
+    {
+        /* Never resident, so nothing draws from a buffer or texture that
+           isn't there */
+        fprintf(stderr, "STREAM: could not put %s on the GPU\n", entry->name);
+        pthread_mutex_lock(&s->lock);
+        a->state = ASSET_FAILED;
+        pthread_mutex_unlock(&s->lock);
+        return 0;
+    }
+    a->resident = true;
+    s->stats.residentBytes += a->gpuBytes;
+    LinkResident(s, a);
+    return uploaded;
+}
+
+local void Evict(AssetStreamer *s, StreamedAsset *a)
+{
+    UnlinkResident(s, a);
+    if (a->uploading)
+    {
+        StreamedAsset **link = &s->uploading;
+        while (*link != a)
+        {
+            link = &(*link)->nextUploading;
+        }
+        *link = a->nextUploading;
+        a->uploading = false;
+    }
+    if (a->texture)
+    {
+        /* The uploader would go on writing to the deleted name */
+        CancelTextureUpload(s->textures, a->texture);
+        glDeleteTextures(1, &a->texture);
+        a->texture = 0;
+    }
+    free(a->stored);
+    a->stored = NULL;
+    FreeGpuMemory(s->heap, a->buffer);
+    a->buffer = NULL;
+    s->stats.residentBytes -= a->gpuBytes;
+    a->gpuBytes = 0;
+    a->resident = false;
+    s->stats.evictions++;
+
+    pthread_mutex_lock(&s->lock);
+    a->state = ASSET_UNLOADED;
+    pthread_mutex_unlock(&s->lock);
+}
+
+void UpdateAssetStreamer(AssetStreamer *s)
+{
+    PROFILE_SCOPE("Asset streaming");
+    pthread_mutex_lock(&s->lock);
+    StreamedAsset *loaded = s->loadedHead;
+    s->loadedHead = NULL;
+    s->loadedTail = NULL;
+    s->stats.queued = s->queueCount;
+    u64 bytesRead = s->bytesRead;
+    pthread_mutex_unlock(&s->lock);
+
+    /* Reads that finished since the last update left room for more */
+    StartReads(s);
+
+    isize uploaded = 0;
+    while (loaded && uploaded < s->config.uploadBudget)
+    {
+        StreamedAsset *a = loaded;
+        loaded = a->nextLoaded;
+        uploaded += MakeResident(s, a);
+    }
+    if (loaded)
+    {
+        /* Over budget, the rest goes first next frame */
+        pthread_mutex_lock(&s->lock);
+        StreamedAsset *last = loaded;
+        while (last->nextLoaded)
+        {
+            last = last->nextLoaded;
+        }
+        last->nextLoaded = s->loadedHead;
+        if (!s->loadedHead)
+        {
+            s->loadedTail = last;
+        }
+        s->loadedHead = loaded;
+        pthread_mutex_unlock(&s->lock);
+    }
+    EndStreamBufferFrame(s->staging);
+
+    /* The GPU has its own copy of finished textures, so their stored
+       bytes can go */
+    for (StreamedAsset **link = &s->uploading; *link;)
+    {
+        StreamedAsset *a = *link;
+        if (IsTextureUploadPending(s->textures, a->texture))
+        {
+            link = &a->nextUploading;
+            continue;
+        }
+        free(a->stored);
+        a->stored = NULL;
+        *link = a->nextUploading;
+        a->uploading = false;
+    }
+
+    /* Least recently used first, never anything used this frame or still
+       being uploaded */
+    for (StreamedAsset *a = s->lruTail; a && s->stats.residentBytes > s->config.gpuBudget;)
+    {
+        StreamedAsset *prev = a->lruPrev;
+        if (a->lastUsedFrame < s->frame &&
+            !(a->texture && IsTextureUploadPending(s->textures, a->texture)))
+        {
+            Evict(s, a);
+        }
+        a = prev;
+    }
+
+    u64 now = ReadNanoseconds();
+    if (now - s->windowStart >= STATS_WINDOW_NS)
+    {
+        f32 seconds = (f32)(now - s->windowStart) / 1e9f;
+        s->stats.hitRate = s->windowRequests ? (f32)s->windowHits / (f32)s->windowRequests : 1;
+        s->stats.bandwidth = (f32)(bytesRead - s->windowBytesRead) / seconds;
+        s->windowStart = now;
+        s->windowRequests = 0;
+        s->windowHits = 0;
+        s->windowBytesRead = bytesRead;
+    }
+    s->frame++;
+}
+
+AssetStreamStats GetAssetStreamStats(const AssetStreamer *s)
+{
+    return s->stats;
+}
+
+void DestroyAssetStreamer(AssetStreamer *s)
+{
+    /* No new reads, then wait out the ones in flight */
+    pthread_mutex_lock(&s->lock);
+    s->quitting = true;
+    pthread_mutex_unlock(&s->lock);
+    DestroyAsyncIO(s->io);
+    CloseAsyncFile(&s->file);
+
+    while (s->lruHead)
+    {
+        Evict(s, s->lruHead);
+    }
+    /* Read but never made resident */
+    ifast32 entryCount;
+    GetPackEntries(s->pack, &entryCount);
+    for (ifast32 i = 0; i < entryCount; i++)
+    {
+        free(s->assets[i].stored);
+    }
+    DestroyStreamBuffer(s->staging);
+    pthread_mutex_destroy(&s->lock);
+    free(s->queue);
+    free(s->assets);
+    free(s);
+}
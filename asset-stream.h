@@ -0,0 +1,93 @@
+#ifndef ASSET_STREAM_H
+#define ASSET_STREAM_H
+#include "glad.h"
+#include "gpu-alloc.h"
+#include "jobs.h"
+#include "pack.h"
+#include "rutils/def.h"
+#include "texture.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Streams pack entries onto the GPU on demand. Entries are read with
+       AsyncIO into memory of the streamer's own, a few at a time and most
+       important request first; the main thread then creates the GL objects and keeps what's
+       resident under a memory budget by evicting whatever went unused the
+       longest. Compressed entries are decoded on the job threads straight
+       into mapped staging memory and copied from there on the GPU.
+
+       The unit of residency is a pack entry, so mips and LODs that should
+       come and go on their own are cooked as entries of their own
+       ("rock.lod1.vertices", "sky.mip2"...). */
+
+    typedef struct AssetStreamer AssetStreamer;
+    typedef struct StreamedAsset StreamedAsset;
+
+    typedef struct AssetStreamerConfig
+    {
+        /* AsyncIO's fallback pool, for kernels without io_uring */
+        ifast32 ioThreads;
+        /* Textures and buffers combined */
+        isize gpuBudget;
+        /* Buffer data copied to the GPU per UpdateAssetStreamer. Textures
+           go through the TextureUploader's own budget. */
+        isize uploadBudget;
+        /* Decompresses compressed buffer entries, NULL to do it on the GL
+           thread */
+        JobSystem *jobs;
+    } AssetStreamerConfig;
+
+    typedef struct AssetStreamStats
+    {
+        u64 requests;
+        /* Requests for an asset that was already resident */
+        u64 hits;
+        u64 evictions;
+        isize residentBytes;
+        ifast32 queued;
+        /* Requests resident / all requests over the last UpdateAssetStreamer
+           window of about a second */
+        f32 hitRate;
+        /* Bytes read from the pack per second over the same window */
+        f32 bandwidth;
+    } AssetStreamStats;
+
+    /* The pack, uploader and heap have to outlive the streamer */
+    AssetStreamer *CreateAssetStreamer(const AssetPack *pack, TextureUploader *textures,
+                                       GpuHeap *heap, const AssetStreamerConfig *config);
+
+    /* Marks name as used this frame and queues it if it isn't resident.
+       importance orders the queue, bigger first, see
+       ScreenSpaceImportance. Returns NULL for names not in the pack. */
+    StreamedAsset *RequestAsset(AssetStreamer *s, const char *name, f32 importance);
+
+    /* Projected radius in pixels of a bounding sphere, the usual
+       importance for meshes and textures on screen */
+    f32 ScreenSpaceImportance(f32 radius, f32 distance, f32 fovY, f32 screenHeight);
+
+    /* Resident and, for textures, fully uploaded */
+    bool IsAssetReady(const StreamedAsset *a);
+
+    /* 0 unless the asset is a resident texture */
+    GLuint GetAssetTexture(const StreamedAsset *a);
+
+    /* Range of a resident vertices or indices entry, buffer 0 otherwise.
+       Ranges can move when the heap is compacted. */
+    GpuRange GetAssetBuffer(const StreamedAsset *a);
+
+    /* Starts reads for queued entries in place of finished ones, creates GL
+       objects for the entries read since the last call, evicts down to the
+       budget and ends the frame. Call once a frame on the GL thread, after
+       the frame's requests. */
+    void UpdateAssetStreamer(AssetStreamer *s);
+
+    AssetStreamStats GetAssetStreamStats(const AssetStreamer *s);
+
+    /* Waits for the reads in flight and frees every GL object the streamer made */
+    void DestroyAssetStreamer(AssetStreamer *s);
+#ifdef __cplusplus
+}
+#endif
+#endif
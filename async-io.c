@@ -0,0 +1,617 @@
+#define _GNU_SOURCE //O_DIRECT, syscall
+#include "async-io.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if !defined(ASYNC_IO_NO_URING)
+#include <linux/io_uring.h>
+#endif
+
+/* Queued reads are handed to the kernel once this many pile up */
+#define ASYNC_BATCH_SIZE 32
+/* IORING_OP_READ lengths are 32 bit, bigger reads go in pieces */
+#define ASYNC_MAX_CHUNK (1 << 30)
+
+struct AsyncRead
+{
+    AsyncIO *io;
+    int fd;
+    u64 offset;
+    isize size;
+    u8 *dst;
+    isize done;
+    AsyncReadCallback callback;
+    void *user;
+    /* Futures only */
+    bool complete;
+    isize result;
+    AsyncRead *next;
+};
+
+#if !defined(ASYNC_IO_NO_URING)
+typedef struct Uring
+{
+    int fd;
+    u32 *sqHead;
+    u32 *sqTail;
+    u32 sqMask;
+    u32 *sqArray;
+    struct io_uring_sqe *sqes;
+    u32 *cqHead;
+    u32 *cqTail;
+    u32 cqMask;
+    struct io_uring_cqe *cqes;
+
+    void *sqRing;
+    isize sqRingSize;
+    void *cqRing;
+    isize cqRingSize;
+    isize sqesSize;
+    /* Filled in but not handed to the kernel yet */
+    u32 pending;
+} Uring;
+#endif
+
+struct AsyncIO
+{
+    bool uring;
+#if !defined(ASYNC_IO_NO_URING)
+    Uring ring;
+#endif
+    pthread_t reaper;
+
+    /* Fallback pool */
+    AsyncRead *head;
+    AsyncRead *tail;
+    pthread_t *threads;
+    ifast32 threadCount;
+
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    u32 queueDepth;
+    u32 inFlight;
+    bool quitting;
+    AsyncIOStats stats;
+};
+
+local void CompleteRead(AsyncIO *io, AsyncRead *r, isize result)
+{
+    /* Without a callback r belongs to FinishAsyncRead the moment it's
+       marked complete, so it can't be looked at after that */
+    bool callback = r->callback != NULL;
+    pthread_mutex_lock(&io->lock);
+    io->stats.completed++;
+    io->stats.bytesRead += result > 0 ? result : 0;
+    io->inFlight--;
+    if (!callback)
+    {
+        r->result = result;
+        __atomic_store_n(&r->complete, true, __ATOMIC_RELEASE);
+    }
+    pthread_cond_broadcast(&io->changed);
+    pthread_mutex_unlock(&io->lock);
+
+    if (callback)
+    {
+        r->callback(r->user, result);
+        free(r);
+    }
+}
+
+#if !defined(ASYNC_IO_NO_URING)
+local int UringSetup(u32 entries, struct io_uring_params *p)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+local int UringEnter(int fd, u32 toSubmit, u32 minComplete, u32 flags)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+local bool UringSupportsRead(int fd)
+{
+    usize size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *probe = calloc(1, size);
+    if (!probe)
+    {
+        return false;
+    }
+    bool ok = syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256) >= 0 &&
+              probe->last_op >= IORING_OP_READ &&
+              (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED);
+    free(probe);
+    return ok;
+}
+
+local void DestroyUring(Uring *ring)
+{
+    if (ring->sqes)
+    {
+        munmap(ring->sqes, ring->sqesSize);
+    }
+    if (ring->cqRing && ring->cqRing != ring->sqRing)
+    {
+        munmap(ring->cqRing, ring->cqRingSize);
+    }
+    if (ring->sqRing)
+    {
+        munmap(ring->sqRing, ring->sqRingSize);
+    }
+    close(ring->fd);
+}
+
+local bool CreateUring(Uring *ring, u32 entries, u32 *queueDepth)
+{
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    memset(ring, 0, sizeof(*ring));
+    ring->fd = UringSetup(entries, &p);
+    if (ring->fd < 0)
+    {
+        return false;
+    }
+    if (!UringSupportsRead(ring->fd))
+    {
+        close(ring->fd);
+        return false;
+    }
+
+    ring->sqRingSize = p.sq_off.array + p.sq_entries * sizeof(u32);
+    ring->cqRingSize = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (ring->cqRingSize > ring->sqRingSize)
+        {
+            ring->sqRingSize = ring->cqRingSize;
+        }
+        ring->cqRingSize = ring->sqRingSize;
+    }
+    ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sqRing == MAP_FAILED)
+    {
+        ring->sqRing = NULL;
+        DestroyUring(ring);
+        return false;
+    }
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->cqRing = ring->sqRing;
+    }
+    else
+    {
+        ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cqRing == MAP_FAILED)
+        {
+            ring->cqRing = NULL;
+            DestroyUring(ring);
+            return false;
+        }
+    }
+    ring->sqesSize = p.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+    {
+        ring->sqes = NULL;
+        DestroyUring(ring);
+        return false;
+    }
+
+    u8 *sq = ring->sqRing;
+    u8 *cq = ring->cqRing;
+    ring->sqHead = (u32 *)(sq + p.sq_off.head);
+    ring->sqTail = (u32 *)(sq + p.sq_off.tail);
+    ring->sqMask = *(u32 *)(sq + p.sq_off.ring_mask);
+    ring->sqArray = (u32 *)(sq + p.sq_off.array);
+    ring->cqHead = (u32 *)(cq + p.cq_off.head);
+    ring->cqTail = (u32 *)(cq + p.cq_off.tail);
+    ring->cqMask = *(u32 *)(cq + p.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+    /* Never more in flight than the completion ring holds, so nothing can
+       overflow it */
+    if (*queueDepth > p.cq_entries)
+    {
+        *queueDepth = p.cq_entries;
+    }
+    if (*queueDepth > p.sq_entries)
+    {
+        *queueDepth = p.sq_entries;
+    }
+    return true;
+}
+
+/* Lock held */
+local void FlushUring(AsyncIO *io)
+{
+    Uring *ring = &io->ring;
+    while (ring->pending)
+    {
+        int submitted = UringEnter(ring->fd, ring->pending, 0, 0);
+        if (submitted < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            /* EAGAIN/EBUSY: the kernel is out of room, the reaper will
+               flush again once completions come in */
+            break;
+        }
+        ring->pending -= submitted;
+        io->stats.batches++;
+    }
+}
+
+/* Lock held. user is NULL for the wake up sent at shutdown. */
+local void PushSqe(AsyncIO *io, u8 opcode, int fd, u64 offset, void *dst, u32 len, void *user)
+{
+    Uring *ring = &io->ring;
+    u32 tail = *ring->sqTail;
+    u32 index = tail & ring->sqMask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->off = offset;
+    sqe->addr = (u64)(uintptr_t)dst;
+    sqe->len = len;
+    sqe->user_data = (u64)(uintptr_t)user;
+    ring->sqArray[index] = index;
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+    ring->pending++;
+}
+
+/* Lock held */
+local void PushRead(AsyncIO *io, AsyncRead *r)
+{
+    isize left = r->size - r->done;
+    u32 len = left > ASYNC_MAX_CHUNK ? ASYNC_MAX_CHUNK : (u32)left;
+    PushSqe(io, IORING_OP_READ, r->fd, r->offset + r->done, r->dst + r->done, len, r);
+}
+
+local void *ReaperThread(void *param)
+{
+    AsyncIO *io = param;
+    Uring *ring = &io->ring;
+    for (;;)
+    {
+        if (UringEnter(ring->fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+        {
+            fprintf(stderr, "ASYNCIO: io_uring_enter failed: %s\n", strerror(errno));
+            break;
+        }
+
+        bool quit = false;
+        u32 head = *ring->cqHead;
+        u32 tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+        for (; head != tail; head++)
+        {
+            struct io_uring_cqe *cqe = &ring->cqes[head & ring->cqMask];
+            AsyncRead *r = (AsyncRead *)(uintptr_t)cqe->user_data;
+            i32 res = cqe->res;
+            if (!r)
+            {
+                quit = true;
+                continue;
+            }
+            if (res == -EAGAIN || res == -EINTR || (res > 0 && r->done + res < r->size))
+            {
+                /* Short read or try again, queue the rest */
+                r->done += res > 0 ? res : 0;
+                pthread_mutex_lock(&io->lock);
+                PushRead(io, r);
+                FlushUring(io);
+                pthread_mutex_unlock(&io->lock);
+                continue;
+            }
+            r->done += res > 0 ? res : 0;
+            CompleteRead(io, r, res < 0 ? res : r->done);
+        }
+        __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+
+        /* Anything left over from a full submission queue */
+        pthread_mutex_lock(&io->lock);
+        FlushUring(io);
+        pthread_mutex_unlock(&io->lock);
+        if (quit)
+        {
+            break;
+        }
+    }
+    return NULL;
+}
+#endif
+
+local void *WorkerThread(void *param)
+{
+    AsyncIO *io = param;
+    pthread_mutex_lock(&io->lock);
+    for (;;)
+    {
+        while (!io->quitting && !io->head)
+        {
+            pthread_cond_wait(&io->changed, &io->lock);
+        }
+        if (!io->head)
+        {
+            break;
+        }
+        AsyncRead *r = io->head;
+        io->head = r->next;
+        if (!io->head)
+        {
+            io->tail = NULL;
+        }
+        pthread_mutex_unlock(&io->lock);
+
+        isize result = 0;
+        while (r->done < r->size)
+        {
+            ssize_t n = pread(r->fd, r->dst + r->done, r->size - r->done, r->offset + r->done);
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (n <= 0)
+            {
+                result = n < 0 ? -errno : 0;
+                break;
+            }
+            r->done += n;
+        }
+        CompleteRead(io, r, result < 0 ? result : r->done);
+
+        pthread_mutex_lock(&io->lock);
+    }
+    pthread_mutex_unlock(&io->lock);
+    return NULL;
+}
+
+AsyncIO *CreateAsyncIO(u32 queueDepth, ifast32 threads)
+{
+    AsyncIO *io = calloc(1, sizeof(*io));
+    if (!io)
+    {
+        return NULL;
+    }
+    io->queueDepth = queueDepth ? queueDepth : 256;
+    pthread_mutex_init(&io->lock, NULL);
+    pthread_cond_init(&io->changed, NULL);
+
+#if !defined(ASYNC_IO_NO_URING)
+    if (CreateUring(&io->ring, io->queueDepth, &io->queueDepth))
+    {
+        io->uring = true;
+        pthread_create(&io->reaper, NULL, ReaperThread, io);
+        return io;
+    }
+#endif
+
+    io->threadCount = threads > 0 ? threads : 4;
+    io->threads = calloc(io->threadCount, sizeof(*io->threads));
+    for (ifast32 i = 0; i < io->threadCount; i++)
+    {
+        pthread_create(&io->threads[i], NULL, WorkerThread, io);
+    }
+    return io;
+}
+
+const char *GetAsyncIOBackend(const AsyncIO *io)
+{
+    return io->uring ? "io_uring" : "threads";
+}
+
+bool OpenAsyncFile(AsyncFile *f, const char *path, bool direct)
+{
+    f->fd = open(path, O_RDONLY | O_CLOEXEC);
+    f->directFd = -1;
+    f->size = 0;
+    if (f->fd < 0)
+    {
+        return false;
+    }
+    struct stat st;
+    if (fstat(f->fd, &st) != 0)
+    {
+        close(f->fd);
+        f->fd = -1;
+        return false;
+    }
+    f->size = st.st_size;
+    if (direct)
+    {
+        /* tmpfs and friends refuse O_DIRECT, buffered reads still work */
+        f->directFd = open(path, O_RDONLY | O_CLOEXEC | O_DIRECT);
+    }
+    return true;
+}
+
+void CloseAsyncFile(AsyncFile *f)
+{
+    if (f->directFd >= 0)
+    {
+        close(f->directFd);
+    }
+    if (f->fd >= 0)
+    {
+        close(f->fd);
+    }
+    f->fd = -1;
+    f->directFd = -1;
+}
+
+void *AllocAsyncBuffer(isize size)
+{
+    void *p;
+    isize rounded = (size + ASYNC_DIRECT_ALIGNMENT - 1) & ~(isize)(ASYNC_DIRECT_ALIGNMENT - 1);
+    return posix_memalign(&p, ASYNC_DIRECT_ALIGNMENT, rounded ? rounded : ASYNC_DIRECT_ALIGNMENT)
+               ? NULL
+               : p;
+}
+
+local AsyncRead *QueueRead(AsyncIO *io, const AsyncFile *f, u64 offset, isize size, void *dst,
+                           AsyncReadCallback callback, void *user)
+{
+    AsyncRead *r = calloc(1, sizeof(*r));
+    if (!r)
+    {
+        return NULL;
+    }
+    bool aligned = !(offset % ASYNC_DIRECT_ALIGNMENT) && !(size % ASYNC_DIRECT_ALIGNMENT) &&
+                   !((uintptr_t)dst % ASYNC_DIRECT_ALIGNMENT);
+    r->io = io;
+    r->fd = f->directFd >= 0 && aligned ? f->directFd : f->fd;
+    r->offset = offset;
+    r->size = size;
+    r->dst = dst;
+    r->callback = callback;
+    r->user = user;
+
+    pthread_mutex_lock(&io->lock);
+    while (io->inFlight >= io->queueDepth)
+    {
+#if !defined(ASYNC_IO_NO_URING)
+        if (io->uring)
+        {
+            FlushUring(io);
+        }
+#endif
+        pthread_cond_wait(&io->changed, &io->lock);
+    }
+    io->inFlight++;
+    io->stats.submitted++;
+#if !defined(ASYNC_IO_NO_URING)
+    if (io->uring)
+    {
+        PushRead(io, r);
+        if (io->ring.pending >= ASYNC_BATCH_SIZE)
+        {
+            FlushUring(io);
+        }
+        pthread_mutex_unlock(&io->lock);
+        return r;
+    }
+#endif
+    if (io->tail)
+    {
+        io->tail->next = r;
+    }
+    else
+    {
+        io->head = r;
+    }
+    io->tail = r;
+    pthread_cond_broadcast(&io->changed);
+    pthread_mutex_unlock(&io->lock);
+    return r;
+}
+
+bool SubmitAsyncRead(AsyncIO *io, const AsyncFile *f, u64 offset, isize size, void *dst,
+                     AsyncReadCallback callback, void *user)
+{
+    return QueueRead(io, f, offset, size, dst, callback, user) != NULL;
+}
+
+AsyncRead *BeginAsyncRead(AsyncIO *io, const AsyncFile *f, u64 offset, isize size, void *dst)
+{
+    return QueueRead(io, f, offset, size, dst, NULL, NULL);
+}
+
+bool IsAsyncReadDone(const AsyncRead *r)
+{
+    return __atomic_load_n(&r->complete, __ATOMIC_ACQUIRE);
+}
+
+void FlushAsyncIO(AsyncIO *io)
+{
+#if !defined(ASYNC_IO_NO_URING)
+    if (io->uring)
+    {
+        pthread_mutex_lock(&io->lock);
+        FlushUring(io);
+        pthread_mutex_unlock(&io->lock);
+    }
+#else
+    ignore io;
+#endif
+}
+
+isize FinishAsyncRead(AsyncRead *r)
+{
+    AsyncIO *io = r->io;
+    pthread_mutex_lock(&io->lock);
+#if !defined(ASYNC_IO_NO_URING)
+    if (io->uring)
+    {
+        FlushUring(io);
+    }
+#endif
+    while (!r->complete)
+    {
+        pthread_cond_wait(&io->changed, &io->lock);
+    }
+    pthread_mutex_unlock(&io->lock);
+    isize result = r->result;
+    free(r);
+    return result;
+}
+
+AsyncIOStats GetAsyncIOStats(AsyncIO *io)
+{
+    pthread_mutex_lock(&io->lock);
+    AsyncIOStats stats = io->stats;
+    pthread_mutex_unlock(&io->lock);
+    return stats;
+}
+
+void DestroyAsyncIO(AsyncIO *io)
+{
+    pthread_mutex_lock(&io->lock);
+    while (io->inFlight)
+    {
+#if !defined(ASYNC_IO_NO_URING)
+        if (io->uring)
+        {
+            FlushUring(io);
+        }
+#endif
+        pthread_cond_wait(&io->changed, &io->lock);
+    }
+    io->quitting = true;
+#if !defined(ASYNC_IO_NO_URING)
+    if (io->uring)
+    {
+        PushSqe(io, IORING_OP_NOP, -1, 0, NULL, 0, NULL);
+        FlushUring(io);
+    }
+#endif
+    pthread_cond_broadcast(&io->changed);
+    pthread_mutex_unlock(&io->lock);
+
+#if !defined(ASYNC_IO_NO_URING)
+    if (io->uring)
+    {
+        pthread_join(io->reaper, NULL);
+        DestroyUring(&io->ring);
+    }
+#endif
+    for (ifast32 i = 0; i < io->threadCount; i++)
+    {
+        pthread_join(io->threads[i], NULL);
+    }
+    pthread_mutex_destroy(&io->lock);
+    pthread_cond_destroy(&io->changed);
+    free(io->threads);
+    free(io);
+}
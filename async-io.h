@@ -0,0 +1,79 @@
+#ifndef ASYNC_IO_H
+#define ASYNC_IO_H
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Asynchronous file reads. Uses io_uring where the kernel has it
+       (5.6 or later, for IORING_OP_READ) and a pool of threads doing
+       pread otherwise. Reads are queued and handed to the kernel in
+       batches, so keeping hundreds in flight costs a handful of syscalls. */
+
+    typedef struct AsyncIO AsyncIO;
+    typedef struct AsyncRead AsyncRead;
+
+    typedef struct AsyncFile
+    {
+        int fd;
+        /* O_DIRECT descriptor for reads that meet its alignment, -1 if the
+           file wasn't opened direct or the filesystem refused */
+        int directFd;
+        u64 size;
+    } AsyncFile;
+
+    /* Offsets, sizes and buffers aligned to this go around the page cache
+       on files opened with direct set */
+#define ASYNC_DIRECT_ALIGNMENT 4096
+
+    /* result is the number of bytes read, less than asked for only at the
+       end of the file, or -errno */
+    typedef void (*AsyncReadCallback)(void *user, isize result);
+
+    typedef struct AsyncIOStats
+    {
+        u64 submitted;
+        u64 completed;
+        u64 bytesRead;
+        /* Syscalls that handed reads to the kernel, io_uring only */
+        u64 batches;
+    } AsyncIOStats;
+
+    /* queueDepth bounds the reads in flight, threads is the size of the
+       fallback pool */
+    AsyncIO *CreateAsyncIO(u32 queueDepth, ifast32 threads);
+
+    /* "io_uring" or "threads" */
+    const char *GetAsyncIOBackend(const AsyncIO *io);
+
+    bool OpenAsyncFile(AsyncFile *f, const char *path, bool direct);
+    void CloseAsyncFile(AsyncFile *f);
+
+    /* Buffer suitable for direct reads, free with free() */
+    void *AllocAsyncBuffer(isize size);
+
+    /* Queues a read of size bytes at offset into dst. callback runs on an
+       I/O thread once it's done, so keep it short. */
+    bool SubmitAsyncRead(AsyncIO *io, const AsyncFile *f, u64 offset, isize size, void *dst,
+                         AsyncReadCallback callback, void *user);
+
+    /* Same, but the read is waited on instead of calling back */
+    AsyncRead *BeginAsyncRead(AsyncIO *io, const AsyncFile *f, u64 offset, isize size,
+                              void *dst);
+    bool IsAsyncReadDone(const AsyncRead *r);
+    /* Waits for r, frees it, and returns its result */
+    isize FinishAsyncRead(AsyncRead *r);
+
+    /* Hands every queued read to the kernel. Reads are also flushed as
+       batches fill up and before anything waits on them. */
+    void FlushAsyncIO(AsyncIO *io);
+
+    AsyncIOStats GetAsyncIOStats(AsyncIO *io);
+
+    /* Waits for every read in flight, then frees everything */
+    void DestroyAsyncIO(AsyncIO *io);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,580 @@
+#define _DEFAULT_SOURCE //strdup
+#include "capture.h"
+#include "glad.h"
+#include "profile.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum CaptureSlotState
+{
+    CAPTURE_SLOT_FREE,
+    CAPTURE_SLOT_READING,  /* glReadPixels issued, fence not signaled yet */
+    CAPTURE_SLOT_ENCODING, /* Owned by the encoder thread */
+} CaptureSlotState;
+
+typedef struct CaptureSlot
+{
+    GLuint pbo;
+    GLsync fence;
+    /* Persistently mapped, so the encoder thread can read it without
+       touching GL */
+    const u8 *pixels;
+    u64 frame;
+    CaptureSlotState state;
+} CaptureSlot;
+
+struct FrameCapture
+{
+    CaptureFormat format;
+    char *path;
+    ifast32 width;
+    ifast32 height;
+    ifast32 fps;
+    /* Bumped by every resize, RAW and Y4M start a new file for each */
+    ifast32 segment;
+
+    CaptureSlot *slots;
+    ifast32 ringSize;
+    ifast32 nextSlot;
+    ifast32 oldestReading;
+    u64 frameCounter;
+
+    /* Encoder thread only, but for resizes, which leave it idle */
+    FILE *out;
+    u8 *scratch;
+    isize scratchSize;
+
+    pthread_t encoder;
+    pthread_mutex_t lock;
+    pthread_cond_t slotEncoding;
+    pthread_cond_t slotFreed;
+    bool quitting;
+
+    FrameCaptureStats stats;
+};
+
+local u32 crcTable[256];
+
+local void InitCRCTable(void)
+{
+    for (u32 n = 0; n < 256; n++)
+    {
+        u32 c = n;
+        for (int k = 0; k < 8; k++)
+        {
+            c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        }
+        crcTable[n] = c;
+    }
+}
+
+local u32 UpdateCRC(u32 crc, const u8 *buf, isize len)
+{
+    for (isize i = 0; i < len; i++)
+    {
+        crc = crcTable[(crc ^ buf[i]) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+local void PutU32BE(u8 *dst, u32 v)
+{
+    dst[0] = (u8)(v >> 24);
+    dst[1] = (u8)(v >> 16);
+    dst[2] = (u8)(v >> 8);
+    dst[3] = (u8)v;
+}
+
+local void WritePNGChunk(FILE *f, const char *type, const u8 *data, u32 len)
+{
+    u8 header[8];
+    PutU32BE(header, len);
+    memcpy(header + 4, type, 4);
+    fwrite(header, 1, 8, f);
+
+    u32 crc = UpdateCRC(0xffffffffu, header + 4, 4);
+    if (len)
+    {
+        fwrite(data, 1, len, f);
+        crc = UpdateCRC(crc, data, len);
+    }
+    u8 footer[4];
+    PutU32BE(footer, crc ^ 0xffffffffu);
+    fwrite(footer, 1, 4, f);
+}
+
+/* Writes an uncompressed (stored deflate blocks) PNG. Encoding time matters
+   more than file size here, and it keeps us from pulling in zlib. */
+local void EncodePNG(FrameCapture *cap, const CaptureSlot *slot)
+{
+    char filename[1024];
+    const char *dot = strrchr(cap->path, '.');
+    int stemLen = dot ? (int)(dot - cap->path) : (int)strlen(cap->path);
+    snprintf(filename, sizeof(filename), "%.*s-%06" PRIu64 ".png",
+             stemLen, cap->path, slot->frame);
+
+    FILE *f = fopen(filename, "wb");
+    if (!f)
+    {
+        fprintf(stderr, "CAPTURE: could not open %s\n", filename);
+        return;
+    }
+
+    isize stride = cap->width * 4;
+    isize rawSize = (stride + 1) * cap->height;
+
+    /* Filter byte 0 on every row, flipped since GL reads bottom up */
+    u8 *raw = cap->scratch;
+    for (ifast32 y = 0; y < cap->height; y++)
+    {
+        u8 *row = raw + y * (stride + 1);
+        row[0] = 0;
+        memcpy(row + 1, slot->pixels + (cap->height - 1 - y) * stride, stride);
+    }
+
+    u32 adlerA = 1;
+    u32 adlerB = 0;
+    for (isize i = 0; i < rawSize; i++)
+    {
+        adlerA = (adlerA + raw[i]) % 65521;
+        adlerB = (adlerB + adlerA) % 65521;
+    }
+
+    static const u8 sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    fwrite(sig, 1, sizeof(sig), f);
+
+    u8 ihdr[13];
+    PutU32BE(ihdr, cap->width);
+    PutU32BE(ihdr + 4, cap->height);
+    ihdr[8] = 8;  /* bit depth */
+    ihdr[9] = 6;  /* RGBA */
+    ihdr[10] = 0; /* deflate */
+    ihdr[11] = 0; /* adaptive filtering */
+    ihdr[12] = 0; /* no interlace */
+    WritePNGChunk(f, "IHDR", ihdr, sizeof(ihdr));
+
+    /* zlib header + stored blocks of at most 65535 bytes + adler32. Laid out
+       after the raw rows in scratch so the whole IDAT goes out in one write */
+    isize blockCount = (rawSize + 65534) / 65535;
+    u8 *idat = raw + rawSize;
+    u8 *p = idat;
+    *p++ = 0x78;
+    *p++ = 0x01;
+    for (isize b = 0; b < blockCount; b++)
+    {
+        isize offset = b * 65535;
+        u16 len = (u16)(rawSize - offset < 65535 ? rawSize - offset : 65535);
+        *p++ = (b == blockCount - 1) ? 1 : 0;
+        *p++ = (u8)len;
+        *p++ = (u8)(len >> 8);
+        *p++ = (u8)~len;
+        *p++ = (u8)(~len >> 8);
+        memcpy(p, raw + offset, len);
+        p += len;
+    }
+    PutU32BE(p, (adlerB << 16) | adlerA);
+    p += 4;
+    WritePNGChunk(f, "IDAT", idat, (u32)(p - idat));
+    WritePNGChunk(f, "IEND", NULL, 0);
+
+    fclose(f);
+}
+
+/* BT.601 studio range, full chroma resolution so there is no resampling */
+local void EncodeY4M(FrameCapture *cap, const CaptureSlot *slot)
+{
+    isize planeSize = cap->width * cap->height;
+    u8 *yPlane = cap->scratch;
+    u8 *uPlane = yPlane + planeSize;
+    u8 *vPlane = uPlane + planeSize;
+
+    for (ifast32 y = 0; y < cap->height; y++)
+    {
+        const u8 *src = slot->pixels + (cap->height - 1 - y) * cap->width * 4;
+        isize dst = y * cap->width;
+        for (ifast32 x = 0; x < cap->width; x++, src += 4, dst++)
+        {
+            int r = src[0];
+            int g = src[1];
+            int b = src[2];
+            yPlane[dst] = (u8)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+            uPlane[dst] = (u8)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+            vPlane[dst] = (u8)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+        }
+    }
+    fputs("FRAME\n", cap->out);
+    fwrite(cap->scratch, 1, planeSize * 3, cap->out);
+}
+
+local void EncodeSlot(FrameCapture *cap, const CaptureSlot *slot)
+{
+    switch (cap->format)
+    {
+    case CAPTURE_FORMAT_RAW:
+    {
+        if (cap->out)
+        {
+            fwrite(slot->pixels, 1, cap->width * cap->height * 4, cap->out);
+        }
+        break;
+    }
+    case CAPTURE_FORMAT_PNG:
+    {
+        if (cap->scratch)
+        {
+            EncodePNG(cap, slot);
+        }
+        break;
+    }
+    case CAPTURE_FORMAT_Y4M:
+    {
+        if (cap->out && cap->scratch)
+        {
+            EncodeY4M(cap, slot);
+        }
+        break;
+    }
+    }
+}
+
+local void *EncoderThread(void *param)
+{
+    FrameCapture *cap = param;
+    ifast32 index = 0;
+
+    PROFILE_THREAD_NAME("Capture encoder");
+
+    for (;;)
+    {
+        CaptureSlot *slot = &cap->slots[index];
+
+        pthread_mutex_lock(&cap->lock);
+        while (slot->state != CAPTURE_SLOT_ENCODING && !cap->quitting)
+        {
+            pthread_cond_wait(&cap->slotEncoding, &cap->lock);
+        }
+        bool haveWork = slot->state == CAPTURE_SLOT_ENCODING;
+        pthread_mutex_unlock(&cap->lock);
+
+        if (!haveWork)
+        {
+            break;
+        }
+
+        PROFILE_BEGIN("Encode frame");
+        EncodeSlot(cap, slot);
+        PROFILE_END();
+
+        pthread_mutex_lock(&cap->lock);
+        slot->state = CAPTURE_SLOT_FREE;
+        cap->stats.framesEncoded++;
+        pthread_cond_broadcast(&cap->slotFreed);
+        pthread_mutex_unlock(&cap->lock);
+
+        index = (index + 1) % cap->ringSize;
+    }
+    return NULL;
+}
+
+/* Hands every finished readback to the encoder, oldest first so frames stay
+   in order. If wait is set, blocks until at least the oldest one is done. */
+local void RetireReadbacks(FrameCapture *cap, bool wait)
+{
+    for (;;)
+    {
+        CaptureSlot *slot = &cap->slots[cap->oldestReading];
+        if (slot->state != CAPTURE_SLOT_READING)
+        {
+            break;
+        }
+
+        GLenum result;
+        if (wait)
+        {
+            do
+            {
+                result = glClientWaitSync(slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                          1000 * 1000 * 1000);
+            } while (result == GL_TIMEOUT_EXPIRED);
+            wait = false;
+        }
+        else
+        {
+            result = glClientWaitSync(slot->fence, 0, 0);
+            if (result == GL_TIMEOUT_EXPIRED)
+            {
+                break;
+            }
+        }
+
+        glDeleteSync(slot->fence);
+        slot->fence = NULL;
+
+        pthread_mutex_lock(&cap->lock);
+        slot->state = CAPTURE_SLOT_ENCODING;
+        pthread_cond_signal(&cap->slotEncoding);
+        pthread_mutex_unlock(&cap->lock);
+
+        cap->oldestReading = (cap->oldestReading + 1) % cap->ringSize;
+    }
+}
+
+CaptureFormat CaptureFormatFromPath(const char *path)
+{
+    const char *dot = strrchr(path, '.');
+    if (dot && strcmp(dot, ".png") == 0)
+    {
+        return CAPTURE_FORMAT_PNG;
+    }
+    if (dot && strcmp(dot, ".y4m") == 0)
+    {
+        return CAPTURE_FORMAT_Y4M;
+    }
+    return CAPTURE_FORMAT_RAW;
+}
+
+/* Opens the file frames of the current size go to and sizes scratch for
+   them. Segments after the first are written next to path as
+   <stem>-<segment><ext>, since neither format can change size mid file.
+   Returns false if there's no memory for scratch, frames of this size are
+   dropped then. */
+local bool OpenCaptureSegment(FrameCapture *cap)
+{
+    char filename[1024];
+    const char *dot = strrchr(cap->path, '.');
+    int stemLen = dot ? (int)(dot - cap->path) : (int)strlen(cap->path);
+    if (cap->segment == 0)
+    {
+        snprintf(filename, sizeof(filename), "%s", cap->path);
+    }
+    else
+    {
+        snprintf(filename, sizeof(filename), "%.*s-%d%s", stemLen, cap->path,
+                 (int)cap->segment, dot ? dot : "");
+    }
+
+    cap->scratchSize = 0;
+    switch (cap->format)
+    {
+    case CAPTURE_FORMAT_RAW:
+    {
+        cap->out = fopen(filename, "wb");
+        break;
+    }
+    case CAPTURE_FORMAT_PNG:
+    {
+        /* Filtered rows plus the stored deflate stream built from them */
+        isize rawSize = (cap->width * 4 + 1) * cap->height;
+        cap->scratchSize = rawSize * 2 + (rawSize / 65535 + 1) * 5 + 16;
+        break;
+    }
+    case CAPTURE_FORMAT_Y4M:
+    {
+        cap->out = fopen(filename, "wb");
+        if (cap->out)
+        {
+            fprintf(cap->out, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n",
+                    (int)cap->width, (int)cap->height, (int)cap->fps);
+        }
+        cap->scratchSize = cap->width * cap->height * 3;
+        break;
+    }
+    }
+    if (cap->format != CAPTURE_FORMAT_PNG && !cap->out)
+    {
+        fprintf(stderr, "CAPTURE: could not open %s\n", filename);
+    }
+    free(cap->scratch);
+    cap->scratch = cap->scratchSize ? malloc(cap->scratchSize) : NULL;
+    if (cap->scratchSize && !cap->scratch)
+    {
+        fprintf(stderr, "CAPTURE: out of memory for %dx%d frames\n", (int)cap->width,
+                (int)cap->height);
+        return false;
+    }
+    return true;
+}
+
+local void CreateCaptureSlots(FrameCapture *cap)
+{
+    isize frameSize = cap->width * cap->height * 4;
+    for (ifast32 i = 0; i < cap->ringSize; i++)
+    {
+        CaptureSlot *slot = &cap->slots[i];
+        GLbitfield access = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &slot->pbo);
+        glNamedBufferStorage(slot->pbo, frameSize, NULL, access);
+        slot->pixels = glMapNamedBufferRange(slot->pbo, 0, frameSize, access);
+        slot->state = CAPTURE_SLOT_FREE;
+    }
+}
+
+local void DestroyCaptureSlots(FrameCapture *cap)
+{
+    for (ifast32 i = 0; i < cap->ringSize; i++)
+    {
+        glUnmapNamedBuffer(cap->slots[i].pbo);
+        glDeleteBuffers(1, &cap->slots[i].pbo);
+    }
+}
+
+/* Waits until every frame captured so far has been encoded */
+local void DrainCapture(FrameCapture *cap)
+{
+    while (cap->slots[cap->oldestReading].state == CAPTURE_SLOT_READING)
+    {
+        RetireReadbacks(cap, true);
+    }
+    pthread_mutex_lock(&cap->lock);
+    for (ifast32 i = 0; i < cap->ringSize; i++)
+    {
+        while (cap->slots[i].state == CAPTURE_SLOT_ENCODING)
+        {
+            pthread_cond_wait(&cap->slotFreed, &cap->lock);
+        }
+    }
+    pthread_mutex_unlock(&cap->lock);
+}
+
+FrameCapture *CreateFrameCapture(const char *path, CaptureFormat format,
+                                 ifast32 width, ifast32 height,
+                                 ifast32 ringSize, ifast32 fps)
+{
+    FrameCapture *cap = calloc(1, sizeof(*cap));
+    if (!cap)
+    {
+        return NULL;
+    }
+    cap->format = format;
+    cap->path = strdup(path);
+    cap->width = width;
+    cap->height = height;
+    cap->fps = fps;
+    cap->ringSize = ringSize > 0 ? ringSize : 3;
+    cap->slots = calloc(cap->ringSize, sizeof(*cap->slots));
+    if (!cap->path || !cap->slots)
+    {
+        free(cap->slots);
+        free(cap->path);
+        free(cap);
+        return NULL;
+    }
+
+    InitCRCTable();
+    if (!OpenCaptureSegment(cap))
+    {
+        if (cap->out)
+        {
+            fclose(cap->out);
+        }
+        free(cap->slots);
+        free(cap->path);
+        free(cap);
+        return NULL;
+    }
+    CreateCaptureSlots(cap);
+
+    pthread_mutex_init(&cap->lock, NULL);
+    pthread_cond_init(&cap->slotEncoding, NULL);
+    pthread_cond_init(&cap->slotFreed, NULL);
+    pthread_create(&cap->encoder, NULL, EncoderThread, cap);
+
+    return cap;
+}
+
+void CaptureFrame(FrameCapture *cap, ifast32 x, ifast32 y)
+{
+    cap->stats.framesRequested++;
+
+    RetireReadbacks(cap, false);
+
+    CaptureSlot *slot = &cap->slots[cap->nextSlot];
+    if (slot->state == CAPTURE_SLOT_READING)
+    {
+        /* The ring is full of readbacks the GPU hasn't finished. This slot is
+           the oldest of them */
+        cap->stats.gpuStalls++;
+        RetireReadbacks(cap, true);
+    }
+
+    pthread_mutex_lock(&cap->lock);
+    if (slot->state == CAPTURE_SLOT_ENCODING)
+    {
+        cap->stats.encoderStalls++;
+        while (slot->state == CAPTURE_SLOT_ENCODING)
+        {
+            pthread_cond_wait(&cap->slotFreed, &cap->lock);
+        }
+    }
+    pthread_mutex_unlock(&cap->lock);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(x, y, cap->width, cap->height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot->frame = cap->frameCounter++;
+    slot->state = CAPTURE_SLOT_READING;
+
+    cap->nextSlot = (cap->nextSlot + 1) % cap->ringSize;
+}
+
+void ResizeFrameCapture(FrameCapture *cap, ifast32 width, ifast32 height)
+{
+    if (width == cap->width && height == cap->height)
+    {
+        return;
+    }
+    /* The encoder is left idle, so nothing it reads changes under it */
+    DrainCapture(cap);
+    DestroyCaptureSlots(cap);
+    if (cap->out)
+    {
+        fclose(cap->out);
+        cap->out = NULL;
+    }
+
+    cap->width = width;
+    cap->height = height;
+    cap->segment++;
+    OpenCaptureSegment(cap);
+    CreateCaptureSlots(cap);
+}
+
+FrameCaptureStats GetFrameCaptureStats(const FrameCapture *cap)
+{
+    FrameCaptureStats stats;
+    pthread_mutex_lock((pthread_mutex_t *)&cap->lock);
+    stats = cap->stats;
+    pthread_mutex_unlock((pthread_mutex_t *)&cap->lock);
+    return stats;
+}
+
+void DestroyFrameCapture(FrameCapture *cap)
+{
+    DrainCapture(cap);
+
+    pthread_mutex_lock(&cap->lock);
+    cap->quitting = true;
+    pthread_cond_signal(&cap->slotEncoding);
+    pthread_mutex_unlock(&cap->lock);
+    pthread_join(cap->encoder, NULL);
+
+    DestroyCaptureSlots(cap);
+
+    pthread_cond_destroy(&cap->slotFreed);
+    pthread_cond_destroy(&cap->slotEncoding);
+    pthread_mutex_destroy(&cap->lock);
+
+    if (cap->out)
+    {
+        fclose(cap->out);
+    }
+    free(cap->scratch);
+    free(cap->slots);
+    free(cap->path);
+    free(cap);
+}
@@ -0,0 +1,60 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+#include "glad.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef enum CaptureFormat
+    {
+        CAPTURE_FORMAT_RAW, /* Every frame appended to one file as RGBA8, bottom up */
+        CAPTURE_FORMAT_PNG, /* One PNG per frame, <stem>-<frame>.png with the
+                               frame number zero padded to 6 digits */
+        CAPTURE_FORMAT_Y4M  /* One 4:4:4 Y4M stream, playable by ffmpeg/mpv */
+    } CaptureFormat;
+
+    typedef struct FrameCaptureStats
+    {
+        u64 framesRequested;
+        u64 framesEncoded;
+        /* Times CaptureFrame had to wait on the GPU or the encoder because
+           every slot in the ring was still busy */
+        u64 gpuStalls;
+        u64 encoderStalls;
+    } FrameCaptureStats;
+
+    typedef struct FrameCapture FrameCapture;
+
+    /* ringSize is how many frames can be in flight between glReadPixels and
+       the encoder finishing. 3 is enough to hide readback latency on
+       anything we run on. Returns NULL if out of memory. */
+    FrameCapture *CreateFrameCapture(const char *path, CaptureFormat format,
+                                     ifast32 width, ifast32 height,
+                                     ifast32 ringSize, ifast32 fps);
+
+    /* Picks the format from the extension of path. Returns
+       CAPTURE_FORMAT_RAW if nothing matches */
+    CaptureFormat CaptureFormatFromPath(const char *path);
+
+    /* Queues a readback of the currently bound read framebuffer and hands any
+       readbacks the GPU has finished with to the encoder thread. Never waits
+       unless every slot in the ring is still busy. */
+    void CaptureFrame(FrameCapture *cap, ifast32 x, ifast32 y);
+
+    /* Captures at a new size from the next frame on, after finishing every
+       frame already captured. PNGs carry on numbering; RAW and Y4M go on
+       in a new file, <stem>-1<ext> after the first resize and so on. If
+       there's no memory for frames that size they're dropped until the
+       next resize. */
+    void ResizeFrameCapture(FrameCapture *cap, ifast32 width, ifast32 height);
+
+    FrameCaptureStats GetFrameCaptureStats(const FrameCapture *cap);
+
+    /* Waits for every outstanding frame to be encoded, then frees everything */
+    void DestroyFrameCapture(FrameCapture *cap);
+#ifdef __cplusplus
+}
+#endif
+#endif
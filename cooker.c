@@ -0,0 +1,443 @@
+#include "async-io.h"
+#include "mesh-import.h"
+#include "mesh.h"
+#include "pack.h"
+#include "rutils/def.h"
+#include "rutils/file.h"
+#include "vertex-format.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Offline asset cooker. Imports meshes and writes them into an asset pack
+   in exactly the layout the engine binds, welded, indexed and ordered for
+   the vertex cache, overdraw and vertex fetch:
+
+       cooker -o assets.pack [--force] [--no-compress] meshes...
+
+   Every mesh becomes "<name>.vertices", "<name>.dequant" and
+   "<name>.indices", named after the file without its extension, so no two
+   inputs may share one. Vertices are packed in cookedAttribs' layout; the
+   entry records its format code (info[5]) and "<name>.dequant" holds the
+   VertexDequant that maps the quantized positions back. The vertices
+   entry also records the hash of the source file (info[2], info[3]),
+   COOKER_VERSION (info[4]) and the PackCompression it was cooked with
+   (info[6]); inputs whose hash, version and compression match what's
+   already in the output pack are copied over instead of being cooked
+   again. Entries are LZ4 compressed unless --no-compress is given. */
+
+/* Bump whenever the cooked output would change for the same input */
+#define COOKER_VERSION 3
+
+/* Cache size the stats are reported for, a conservative FIFO */
+#define STATS_CACHE_SIZE 16
+/* How much vertex cache efficiency may be traded for less overdraw */
+#define OVERDRAW_THRESHOLD 1.05f
+
+/* 12 bytes a vertex instead of sizeof(Vertex)'s 24 */
+local const VertexAttrib cookedAttribs[] = {{VERTEX_POSITION, VERTEX_UNORM16X4},
+                                            {VERTEX_COLOR, VERTEX_UNORM8X4}};
+
+/* Source files being read ahead of the one being cooked */
+#define READ_AHEAD 32
+
+typedef struct SourceRead
+{
+    AsyncFile file;
+    u8 *data;
+    AsyncRead *read;
+} SourceRead;
+
+typedef struct MeshInput
+{
+    const char *path;
+    char name[PACK_NAME_SIZE - sizeof(".vertices")];
+} MeshInput;
+
+typedef enum ReuseResult
+{
+    REUSE_STALE,
+    REUSE_COPIED,
+    /* Some entries may have been written, the output can't be used */
+    REUSE_FAILED,
+} ReuseResult;
+
+typedef struct CookStats
+{
+    ifast32 cooked;
+    ifast32 reused;
+    ifast32 failed;
+} CookStats;
+
+local void MeshName(const char *path, char *name, usize size)
+{
+    const char *base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    const char *dot = strrchr(base, '.');
+    usize len = dot ? (usize)(dot - base) : strlen(base);
+    if (len >= size)
+    {
+        len = size - 1;
+    }
+    memcpy(name, base, len);
+    name[len] = 0;
+}
+
+local bool HasExtension(const char *path, const char *ext)
+{
+    usize len = strlen(path);
+    usize extLen = strlen(ext);
+    return len >= extLen && strcmp(path + len - extLen, ext) == 0;
+}
+
+local bool CookMesh(PackWriter *w, const char *path, const char *name, const u8 *data,
+                    isize size, u64 sourceHash, PackCompression compression)
+{
+    Mesh m;
+    bool imported;
+    if (HasExtension(path, ".obj"))
+    {
+        imported = ImportObjMesh(path, (const char *)data, size, &m);
+    }
+    else if (HasExtension(path, ".gltf") || HasExtension(path, ".glb"))
+    {
+        imported = ImportGltfMesh(path, data, size, &m);
+    }
+    else
+    {
+        fprintf(stderr, "%s: unknown mesh format\n", path);
+        return false;
+    }
+    if (!imported)
+    {
+        return false;
+    }
+    if (!m.indexCount)
+    {
+        fprintf(stderr, "%s: no triangles\n", path);
+        FreeMesh(&m);
+        return false;
+    }
+
+    VertexCacheStats before = AnalyzeVertexCache(m.indices, m.indexCount, m.vertexCount,
+                                                 STATS_CACHE_SIZE);
+    OptimizeVertexCache(m.indices, m.indexCount, m.vertexCount);
+    OptimizeOverdraw(m.indices, m.indexCount, m.vertices, m.vertexCount, OVERDRAW_THRESHOLD);
+    OptimizeVertexFetch(&m);
+    VertexCacheStats after = AnalyzeVertexCache(m.indices, m.indexCount, m.vertexCount,
+                                                STATS_CACHE_SIZE);
+
+    VertexFormat fmt;
+    BuildVertexFormat(&fmt, cookedAttribs, countof(cookedAttribs));
+    VertexSource src = {&m.vertices[0].pos, &m.vertices[0].c, NULL, sizeof(Vertex)};
+    u8 *packed = malloc((usize)m.vertexCount * fmt.stride);
+    if (!packed)
+    {
+        fprintf(stderr, "%s: out of memory\n", path);
+        FreeMesh(&m);
+        return false;
+    }
+    VertexDequant dequant = PackVertices(&fmt, &src, m.vertexCount, packed);
+
+    char entry[PACK_NAME_SIZE];
+    u32 info[PACK_INFO_COUNT] = {fmt.stride,
+                                 m.vertexCount,
+                                 (u32)sourceHash,
+                                 (u32)(sourceHash >> 32),
+                                 COOKER_VERSION,
+                                 GetVertexFormatCode(&fmt),
+                                 compression};
+    snprintf(entry, sizeof(entry), "%s.vertices", name);
+    bool ok = AddPackEntry(w, entry, PACK_ENTRY_VERTICES, info, packed,
+                           (u64)m.vertexCount * fmt.stride);
+    free(packed);
+
+    u32 noInfo[PACK_INFO_COUNT] = {0};
+    snprintf(entry, sizeof(entry), "%s.dequant", name);
+    ok = ok && AddPackEntry(w, entry, PACK_ENTRY_BLOB, noInfo, &dequant, sizeof(dequant));
+
+    /* 16 bit indices whenever they fit, half the index fetch bandwidth */
+    snprintf(entry, sizeof(entry), "%s.indices", name);
+    if (m.vertexCount <= 0x10000)
+    {
+        u16 *small = malloc(m.indexCount * sizeof(*small));
+        if (!small)
+        {
+            fprintf(stderr, "%s: out of memory\n", path);
+            ok = false;
+        }
+        for (u32 i = 0; ok && i < m.indexCount; i++)
+        {
+            small[i] = (u16)m.indices[i];
+        }
+        u32 indexInfo[PACK_INFO_COUNT] = {GL_UNSIGNED_SHORT, m.indexCount};
+        ok = ok && AddPackEntry(w, entry, PACK_ENTRY_INDICES, indexInfo, small,
+                                (u64)m.indexCount * sizeof(*small));
+        free(small);
+    }
+    else
+    {
+        u32 indexInfo[PACK_INFO_COUNT] = {GL_UNSIGNED_INT, m.indexCount};
+        ok = ok && AddPackEntry(w, entry, PACK_ENTRY_INDICES, indexInfo, m.indices,
+                                (u64)m.indexCount * sizeof(*m.indices));
+    }
+
+    printf("%s: %u vertices (%u bytes each), %u triangles, ACMR %.3f -> %.3f, ATVR %.3f -> "
+           "%.3f\n",
+           path, m.vertexCount, fmt.stride, m.indexCount / 3, before.acmr, after.acmr,
+           before.atvr, after.atvr);
+    FreeMesh(&m);
+    return ok;
+}
+
+local void HashDependency(void *user, const char *file)
+{
+    u64 *hash = user;
+    isize size = 0;
+    void *data = MapFileToROBuffer(file, NULL, &size);
+    /* Missing hashes unlike any contents, so the file turning up is noticed */
+    u64 fileHash = data ? HashPackBytes(data, size) : ~(u64)0;
+    if (data)
+    {
+        UnmapMappedBuffer(data, size);
+    }
+    *hash = (*hash ^ fileHash) * 0x100000001b3;
+}
+
+/* The source file's bytes and those of every file it pulls buffers from */
+local u64 HashMeshSource(const char *path, const u8 *data, isize size)
+{
+    u64 hash = HashPackBytes(data, size);
+    if (HasExtension(path, ".gltf") || HasExtension(path, ".glb"))
+    {
+        ForEachGltfDependency(path, data, size, HashDependency, &hash);
+    }
+    return hash;
+}
+
+/* Copies name's entries from the previous pack if they were cooked from the
+   same source by the same cooker */
+local ReuseResult ReuseMesh(PackWriter *w, const AssetPack *old, const char *name,
+                            u64 sourceHash, PackCompression compression)
+{
+    if (!old)
+    {
+        return REUSE_STALE;
+    }
+    char entry[PACK_NAME_SIZE];
+    snprintf(entry, sizeof(entry), "%s.vertices", name);
+    const PackEntry *vertices = FindPackEntry(old, entry);
+    snprintf(entry, sizeof(entry), "%s.dequant", name);
+    const PackEntry *dequant = FindPackEntry(old, entry);
+    snprintf(entry, sizeof(entry), "%s.indices", name);
+    const PackEntry *indices = FindPackEntry(old, entry);
+    if (!vertices || !dequant || !indices || vertices->info[2] != (u32)sourceHash ||
+        vertices->info[3] != (u32)(sourceHash >> 32) || vertices->info[4] != COOKER_VERSION ||
+        vertices->info[6] != compression || !VerifyPackEntry(old, vertices) ||
+        !VerifyPackEntry(old, dequant) || !VerifyPackEntry(old, indices))
+    {
+        return REUSE_STALE;
+    }
+    /* Cooking it again after a partial copy would add the same entries
+       twice */
+    const PackEntry *entries[] = {vertices, dequant, indices};
+    for (ifast32 i = 0; i < (ifast32)countof(entries); i++)
+    {
+        if (!CopyPackEntry(w, old, entries[i]))
+        {
+            fprintf(stderr, "%s: could not copy %s\n", name, entries[i]->name);
+            return REUSE_FAILED;
+        }
+    }
+    return REUSE_COPIED;
+}
+
+local int CompareMeshInputs(const void *a, const void *b)
+{
+    return strcmp(((const MeshInput *)a)->name, ((const MeshInput *)b)->name);
+}
+
+/* Two inputs with the same name would write the same entries */
+local bool CheckMeshNames(const MeshInput *inputs, ifast32 count)
+{
+    MeshInput *sorted = malloc((count ? count : 1) * sizeof(*sorted));
+    if (!sorted)
+    {
+        fputs("cooker: out of memory\n", stderr);
+        return false;
+    }
+    memcpy(sorted, inputs, count * sizeof(*sorted));
+    qsort(sorted, count, sizeof(*sorted), CompareMeshInputs);
+    bool ok = true;
+    for (ifast32 i = 1; i < count; i++)
+    {
+        if (strcmp(sorted[i - 1].name, sorted[i].name) == 0)
+        {
+            fprintf(stderr, "%s: same name as %s\n", sorted[i].path, sorted[i - 1].path);
+            ok = false;
+        }
+    }
+    free(sorted);
+    return ok;
+}
+
+local void BeginSourceRead(AsyncIO *io, SourceRead *src, const char *path)
+{
+    memset(src, 0, sizeof(*src));
+    if (!OpenAsyncFile(&src->file, path, false))
+    {
+        return;
+    }
+    src->data = malloc(src->file.size ? src->file.size : 1);
+    src->read = src->data ? BeginAsyncRead(io, &src->file, 0, src->file.size, src->data) : NULL;
+}
+
+/* Returns the file's contents, NULL if it couldn't be read */
+local u8 *FinishSourceRead(SourceRead *src)
+{
+    isize size = src->read ? FinishAsyncRead(src->read) : -1;
+    CloseAsyncFile(&src->file);
+    if (size != (isize)src->file.size)
+    {
+        free(src->data);
+        src->data = NULL;
+    }
+    return src->data;
+}
+
+int main(int argc, char **argv)
+{
+    const char *outPath = NULL;
+    bool force = false;
+    PackCompression compression = PACK_COMPRESSION_LZ4;
+    MeshInput *inputs = calloc(argc, sizeof(*inputs));
+    ifast32 inputCount = 0;
+    if (!inputs)
+    {
+        fputs("cooker: out of memory\n", stderr);
+        return 1;
+    }
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        {
+            outPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--force") == 0)
+        {
+            force = true;
+        }
+        else if (strcmp(argv[i], "--no-compress") == 0)
+        {
+            compression = PACK_COMPRESSION_NONE;
+        }
+        else
+        {
+            MeshInput *input = &inputs[inputCount++];
+            input->path = argv[i];
+            MeshName(input->path, input->name, sizeof(input->name));
+        }
+    }
+    if (!outPath)
+    {
+        fputs("usage: cooker -o <pack> [--force] [--no-compress] meshes...\n", stderr);
+        free(inputs);
+        return 1;
+    }
+    if (!CheckMeshNames(inputs, inputCount))
+    {
+        free(inputs);
+        return 1;
+    }
+
+    AssetPack *old = force ? NULL : OpenAssetPack(outPath);
+
+    /* Written next to the old pack so it can still be read from */
+    char tmpPath[4096];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", outPath);
+    PackWriter *w = CreatePackWriter(tmpPath);
+    if (!w)
+    {
+        CloseAssetPack(old);
+        free(inputs);
+        return 1;
+    }
+    SetPackCompression(w, compression);
+
+    /* Sources are read READ_AHEAD at a time in the background while
+       earlier ones cook */
+    AsyncIO *io = CreateAsyncIO(READ_AHEAD, 4);
+    SourceRead *reads = calloc(inputCount ? inputCount : 1, sizeof(*reads));
+    if (!io || !reads)
+    {
+        fputs("cooker: could not start reading sources\n", stderr);
+        if (io)
+        {
+            DestroyAsyncIO(io);
+        }
+        free(reads);
+        FinishPackWriter(w);
+        remove(tmpPath);
+        CloseAssetPack(old);
+        free(inputs);
+        return 1;
+    }
+    for (ifast32 i = 0; i < inputCount && i < READ_AHEAD; i++)
+    {
+        BeginSourceRead(io, &reads[i], inputs[i].path);
+    }
+    FlushAsyncIO(io);
+
+    CookStats stats = {0};
+    for (ifast32 i = 0; i < inputCount; i++)
+    {
+        const char *path = inputs[i].path;
+        const char *name = inputs[i].name;
+        u8 *data = FinishSourceRead(&reads[i]);
+        isize size = reads[i].file.size;
+        if (i + READ_AHEAD < inputCount)
+        {
+            BeginSourceRead(io, &reads[i + READ_AHEAD], inputs[i + READ_AHEAD].path);
+            FlushAsyncIO(io);
+        }
+        if (!data)
+        {
+            fprintf(stderr, "%s: could not open\n", path);
+            stats.failed++;
+            continue;
+        }
+        u64 sourceHash = HashMeshSource(path, data, size);
+
+        ReuseResult reuse = ReuseMesh(w, old, name, sourceHash, compression);
+        if (reuse == REUSE_COPIED)
+        {
+            stats.reused++;
+        }
+        else if (reuse == REUSE_STALE && CookMesh(w, path, name, data, size, sourceHash, compression))
+        {
+            stats.cooked++;
+        }
+        else
+        {
+            stats.failed++;
+        }
+        free(data);
+    }
+    DestroyAsyncIO(io);
+    free(reads);
+
+    CloseAssetPack(old);
+    bool ok = FinishPackWriter(w) && !stats.failed;
+    if (ok)
+    {
+        ok = rename(tmpPath, outPath) == 0;
+    }
+    else
+    {
+        remove(tmpPath);
+    }
+    printf("%s: %d cooked, %d up to date, %d failed\n", outPath, (int)stats.cooked,
+           (int)stats.reused, (int)stats.failed);
+    free(inputs);
+    return ok ? 0 : 1;
+}
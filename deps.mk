@@ -6,11 +6,29 @@ $(VERT_SHADERS))
 FRAG_SHADER_TARGETS = $(patsubst shaders/%.frag, shaders/%.frag.test,	\
 $(FRAG_SHADERS))
 
-LIBS += $(shell sdl2-config --libs) -lm -ldl
+LIBS += $(shell sdl2-config --libs) -lm -ldl -lpthread
 
 CFLAGS += -g $(shell sdl2-config --cflags)
 WARNINGS += -Wno-documentation
-all: engine $(VERT_SHADER_TARGETS) $(FRAG_SHADER_TARGETS)
+all: engine game.so replay cooker softrender assets.pack $(VERT_SHADER_TARGETS) $(FRAG_SHADER_TARGETS)
 
-engine: linux-platform.o glad.o rgl.o rutils/math.o rutils/file.o rutils/string.o
+engine: linux-platform.o glad.o glad-lazy.o rgl.o capture.o profile.o gpu-profile.o gl-stats.o glad-instrument.o gl-trace.o glad-trace.o pack.o lz4.o jobs.o vertex-format.o stream-buffer.o gpu-alloc.o texture.o asset-stream.o async-io.o vfs.o input-record.o input-queue.o scene-target.o dynamic-res.o rutils/math.o rutils/file.o rutils/string.o
+	$(CC) $(LDFLAGS) -rdynamic -o $@ $^
+
+# Resolves everything it calls against the engine. Built aside and renamed
+# so the engine never loads a half written library.
+game.so: game.c
+	$(CC) $(CFLAGS) -fPIC -shared -MT $@ -o $@.tmp $< && mv $@.tmp $@
+
+replay: replay.o glad.o glad-lazy.o gl-trace.o glad-trace.o rutils/file.o
+	$(CC) $(LDFLAGS) -o $@ $^
+
+cooker: cooker.o async-io.o mesh.o mesh-import.o pack.o lz4.o jobs.o profile.o vertex-format.o glad.o glad-lazy.o rutils/math.o rutils/file.o
 	$(CC) $(LDFLAGS) -o $@ $^
+
+softrender: soft-render.o soft-raster.o jobs.o profile.o rutils/math.o
+	$(CC) $(LDFLAGS) -o $@ $^
+
+MESH_SOURCES = $(wildcard assets/*.obj assets/*.gltf assets/*.glb)
+assets.pack: cooker $(MESH_SOURCES)
+	./cooker -o $@ $(MESH_SOURCES)
@@ -0,0 +1,102 @@
+#include "dynamic-res.h"
+#include <math.h>
+#include <stdlib.h>
+
+/* Where a change aims for, leaving room for frame to frame noise */
+#define DYNAMIC_RES_HEADROOM .9f
+/* Frames under this share of the budget count towards scaling up */
+#define DYNAMIC_RES_UNDER_BUDGET .75f
+#define DYNAMIC_RES_OVER_FRAMES 3
+#define DYNAMIC_RES_UNDER_FRAMES 60
+/* Timings arrive a few frames late, the ones straight after a change
+   still measure the old scale */
+#define DYNAMIC_RES_SETTLE_FRAMES 8
+/* Scales are multiples of this so small swings don't resize anything */
+#define DYNAMIC_RES_STEP .05f
+/* Most a single step up goes, going down is as far as it takes */
+#define DYNAMIC_RES_MAX_UP .1f
+
+struct DynamicRes
+{
+    f32 targetMs;
+    f32 minScale;
+    f32 scale;
+    ifast32 overFrames;
+    ifast32 underFrames;
+    ifast32 settleFrames;
+};
+
+DynamicRes *CreateDynamicRes(f32 targetMs, f32 minScale)
+{
+    DynamicRes *dr = calloc(1, sizeof(*dr));
+    if (!dr)
+    {
+        return NULL;
+    }
+    dr->targetMs = targetMs;
+    dr->minScale = minScale > 0 && minScale < 1 ? minScale : 1;
+    dr->scale = 1;
+    return dr;
+}
+
+f32 UpdateDynamicRes(DynamicRes *dr, f32 scaledMs, f32 fixedMs)
+{
+    f32 gpuMs = scaledMs + fixedMs;
+    if (scaledMs <= 0 || dr->targetMs <= 0)
+    {
+        return dr->scale;
+    }
+    if (dr->settleFrames > 0)
+    {
+        dr->settleFrames--;
+        return dr->scale;
+    }
+
+    if (gpuMs > dr->targetMs)
+    {
+        dr->overFrames++;
+        dr->underFrames = 0;
+    }
+    else if (gpuMs < dr->targetMs * DYNAMIC_RES_UNDER_BUDGET)
+    {
+        dr->underFrames++;
+        dr->overFrames = 0;
+    }
+    else
+    {
+        dr->overFrames = dr->underFrames = 0;
+    }
+    if (dr->overFrames < DYNAMIC_RES_OVER_FRAMES && dr->underFrames < DYNAMIC_RES_UNDER_FRAMES)
+    {
+        return dr->scale;
+    }
+
+    /* The scene's cost is mostly per pixel, which goes with the square of
+       the scale. Only what's left of the budget after the fixed part is
+       the scene's to use. */
+    f32 scaledBudget = dr->targetMs * DYNAMIC_RES_HEADROOM - fixedMs;
+    f32 scale = scaledBudget > 0 ? dr->scale * sqrtf(scaledBudget / scaledMs) : 0;
+    if (scale > dr->scale + DYNAMIC_RES_MAX_UP)
+    {
+        scale = dr->scale + DYNAMIC_RES_MAX_UP;
+    }
+    scale = floorf(scale / DYNAMIC_RES_STEP + 1e-3f) * DYNAMIC_RES_STEP;
+    scale = scale < dr->minScale ? dr->minScale : scale > 1 ? 1 : scale;
+    if (scale != dr->scale)
+    {
+        dr->scale = scale;
+        dr->settleFrames = DYNAMIC_RES_SETTLE_FRAMES;
+    }
+    dr->overFrames = dr->underFrames = 0;
+    return dr->scale;
+}
+
+f32 GetDynamicResScale(const DynamicRes *dr)
+{
+    return dr->scale;
+}
+
+void DestroyDynamicRes(DynamicRes *dr)
+{
+    free(dr);
+}
@@ -0,0 +1,33 @@
+#ifndef DYNAMIC_RES_H
+#define DYNAMIC_RES_H
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Picks the scale the scene renders at from how long the GPU took
+       over recent frames, to hold a frame time budget under varying load.
+       Drops quickly once frames go over budget, and only climbs back
+       after a longer run of frames well under it, so the scale doesn't
+       flip back and forth around the budget. */
+
+    typedef struct DynamicRes DynamicRes;
+
+    /* targetMs is the GPU budget per frame, the scale stays within
+       [minScale, 1] and starts at 1 */
+    DynamicRes *CreateDynamicRes(f32 targetMs, f32 minScale);
+
+    /* Feeds the GPU time of one newly resolved frame and returns the scale
+       to render at from now on. scaledMs is what was rendered at the
+       scale, fixedMs the rest of the frame, which costs the same at any
+       scale (resolves, readbacks...). */
+    f32 UpdateDynamicRes(DynamicRes *dr, f32 scaledMs, f32 fixedMs);
+
+    f32 GetDynamicResScale(const DynamicRes *dr);
+
+    void DestroyDynamicRes(DynamicRes *dr);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,268 @@
+#include "game.h"
+#include "glad.h"
+#include "mesh.h"
+#include "profile.h"
+#include "rgl.h"
+#include "rutils/math.h"
+#include "vertex-format.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define VERT_SHADER_PATH "shaders/basic-render.vert"
+#define FRAG_SHADER_PATH "shaders/basic-render.frag"
+
+/* Bump on any change to GameState that keeps its size, reordered or
+   retyped fields. Size changes are caught without it. */
+#define GAME_STATE_VERSION 1
+
+/* Everything the game keeps between frames, at the start of GameMemory */
+typedef struct GameState
+{
+    /* Zeroed memory until the first update sets it up */
+    bool initialized;
+    /* Set up failed, the game draws nothing rather than retry every frame */
+    bool initFailed;
+
+    ShaderProg shader;
+    Mat4f proj;
+    Mat4f view;
+    Mat4f model;
+    f32 clearColor[3];
+
+    /* The built in quads show until the pack's mesh has streamed in */
+    GpuAllocation *vertexMemory;
+    GpuAllocation *indexMemory;
+    GLuint vertexArray;
+    VertexFormat vertexFormat;
+    VertexDequant dequant;
+    GpuRange vertexRange;
+    GpuRange indexRange;
+    GLenum indexType;
+    GLsizei indexCount;
+
+    /* Point into the platform's pack and streamer, not into the library */
+    const PackEntry *meshVertices;
+    const PackEntry *meshDequant;
+    const PackEntry *meshIndices;
+    StreamedAsset *streamedVertices;
+    StreamedAsset *streamedIndices;
+    VertexFormat meshFormat;
+    bool meshBound;
+    /* Of the scene heap when the ranges above were taken */
+    u64 heapVersion;
+
+    GLuint dynamicVertexArray;
+    f32 axesPulse;
+} GameState;
+
+local const Vertex vertices[] = {
+    {{.5, .5, .5}, {1, 0, 0}},
+    {{-.5, .5, .5}, {0, 1, 0}},
+    {{.5, -.5, .5}, {0, 0, 1}},
+    {{-.5, -.5, .5}, {1, 1, 1}},
+    {{.5, .5, 0}, {1, 0, 0}},
+    {{-.5, .5, 0}, {0, 1, 0}},
+    {{.5, -.5, 0}, {0, 0, 1}},
+    {{-.5, -.5, 0}, {1, 1, 1}}};
+
+local const u16 indices[] = {
+    0, 1, 2, 2, 1, 3,
+    4, 5, 6, 6, 5, 7};
+
+/* Takes the current ranges of whichever mesh is drawn, which compaction
+   may have moved, and points the vertex array at them */
+local void BindGeometry(GameState *g, const GamePlatform *platform)
+{
+    if (g->meshBound)
+    {
+        g->vertexRange = GetAssetBuffer(g->streamedVertices);
+        g->indexRange = GetAssetBuffer(g->streamedIndices);
+    }
+    else
+    {
+        g->vertexRange = GetGpuRange(g->vertexMemory);
+        g->indexRange = GetGpuRange(g->indexMemory);
+    }
+    /* Every mesh in a heap block shares one buffer object; the draw picks
+       its range through the binding offset and the index offset */
+    glVertexArrayVertexBuffer(g->vertexArray, 0, g->vertexRange.buffer, g->vertexRange.offset,
+                              g->vertexFormat.stride);
+    glVertexArrayElementBuffer(g->vertexArray, g->indexRange.buffer);
+    g->heapVersion = GetGpuHeapVersion(platform->sceneHeap);
+}
+
+local bool InitGame(GameState *g, const GamePlatform *platform)
+{
+    *g = (GameState){0};
+
+    g->indexType = GL_UNSIGNED_SHORT;
+    g->indexCount = countof(indices);
+    local const VertexAttrib builtinAttribs[] = {{VERTEX_POSITION, VERTEX_FLOAT3},
+                                                 {VERTEX_COLOR, VERTEX_FLOAT3}};
+    BuildVertexFormat(&g->vertexFormat, builtinAttribs, countof(builtinAttribs));
+    g->dequant = IdentityVertexDequant();
+    g->vertexMemory = AllocGpuMemory(platform->sceneHeap, sizeof(vertices), 16);
+    g->indexMemory = AllocGpuMemory(platform->sceneHeap, sizeof(indices), 16);
+    if (!g->vertexMemory || !g->indexMemory)
+    {
+        fputs("GAME: no GPU memory for the built in quads\n", stderr);
+        FreeGpuMemory(platform->sceneHeap, g->vertexMemory);
+        FreeGpuMemory(platform->sceneHeap, g->indexMemory);
+        *g = (GameState){.initFailed = true};
+        return false;
+    }
+    UploadGpuMemory(g->vertexMemory, 0, vertices, sizeof(vertices));
+    UploadGpuMemory(g->indexMemory, 0, indices, sizeof(indices));
+
+    glCreateVertexArrays(1, &g->vertexArray);
+    BindGeometry(g, platform);
+    SetupVertexFormat(g->vertexArray, &g->vertexFormat, 0);
+
+    if (platform->pack && platform->streamer)
+    {
+        g->meshVertices = FindPackEntry(platform->pack, "demo.vertices");
+        g->meshDequant = FindPackEntry(platform->pack, "demo.dequant");
+        g->meshIndices = FindPackEntry(platform->pack, "demo.indices");
+        if (!(g->meshVertices && g->meshVertices->type == PACK_ENTRY_VERTICES &&
+              VertexFormatFromCode(&g->meshFormat, g->meshVertices->info[5]) &&
+              g->meshFormat.stride == g->meshVertices->info[0] && g->meshDequant &&
+              g->meshDequant->size == sizeof(g->dequant) && g->meshIndices &&
+              g->meshIndices->type == PACK_ENTRY_INDICES))
+        {
+            g->meshVertices = NULL;
+        }
+    }
+
+    /* The axes gizmo, rebuilt every frame */
+    glCreateVertexArrays(1, &g->dynamicVertexArray);
+    {
+        local const VertexAttrib dynamicAttribs[] = {{VERTEX_POSITION, VERTEX_FLOAT3},
+                                                     {VERTEX_COLOR, VERTEX_FLOAT3}};
+        VertexFormat dynamicFormat;
+        BuildVertexFormat(&dynamicFormat, dynamicAttribs, countof(dynamicAttribs));
+        SetupVertexFormat(g->dynamicVertexArray, &dynamicFormat, 0);
+    }
+
+    g->proj = CreatePerspectiveMat4f(DegToRad(45), 16.0 / 9.0, .1, 10);
+    g->view = CalcLookAtMat4f(vec3f(2, 2, 2), vec3f(0, 0, 0), vec3f(0, 0, 1));
+
+    char *vertSource = LoadVfsPath(platform->vfs, MakeVfsPath(VERT_SHADER_PATH), NULL);
+    char *fragSource = LoadVfsPath(platform->vfs, MakeVfsPath(FRAG_SHADER_PATH), NULL);
+    g->shader = CreateShaderProgFromSource(vertSource ? vertSource : "", fragSource ? fragSource : "");
+    free(vertSource);
+    free(fragSource);
+    UseShaderProg(g->shader);
+    SetUniformMat4fShaderProg(g->shader, "proj", &g->proj);
+    SetUniformMat4fShaderProg(g->shader, "view", &g->view);
+    g->initialized = true;
+    return true;
+}
+
+const u64 GameStateLayout = (u64)GAME_STATE_VERSION << 32 | sizeof(GameState);
+
+void GameUpdate(GameMemory *memory, const GamePlatform *platform, const GameInput *input)
+{
+    GameState *g = memory->base;
+    if (!g->initialized)
+    {
+        if (g->initFailed || !InitGame(g, platform))
+        {
+            return;
+        }
+        memory->used = sizeof(*g);
+    }
+
+    g->model = RotateMat4f(&IdMat4f, input->time * DegToRad(90), vec3f(0, 0, 1));
+
+    if (platform->streamer && g->meshVertices)
+    {
+        /* Unit sized mesh seen from the camera at (2, 2, 2) */
+        f32 importance = ScreenSpaceImportance(1, sqrtf(12), DegToRad(45), input->viewportHeight);
+        g->streamedVertices = RequestAsset(platform->streamer, g->meshVertices->name, importance);
+        g->streamedIndices = RequestAsset(platform->streamer, g->meshIndices->name, importance);
+        bool ready = IsAssetReady(g->streamedVertices) && IsAssetReady(g->streamedIndices);
+        if (ready && !g->meshBound)
+        {
+            g->vertexFormat = g->meshFormat;
+            ReadPackEntry(platform->pack, g->meshDequant, 0, sizeof(g->dequant), &g->dequant, NULL);
+            g->indexType = g->meshIndices->info[0];
+            g->indexCount = g->meshIndices->info[1];
+            g->meshBound = true;
+            BindGeometry(g, platform);
+            SetupVertexFormat(g->vertexArray, &g->vertexFormat, 0);
+        }
+    }
+
+    local const f32 clearColors[][3] = {{.1, .1, .1}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    ifast32 clear = input->mouseLeft ? 1 : input->mouseRight ? 2 : input->mouseMiddle ? 3 : 0;
+    memcpy(g->clearColor, clearColors[clear], sizeof(g->clearColor));
+    g->axesPulse = .75 + .25 * sinf(input->time * 4);
+}
+
+void GameRender(GameMemory *memory, const GamePlatform *platform)
+{
+    GameState *g = memory->base;
+    if (!g->initialized)
+    {
+        return;
+    }
+    if (g->heapVersion != GetGpuHeapVersion(platform->sceneHeap))
+    {
+        BindGeometry(g, platform);
+    }
+    glClearColor(g->clearColor[0], g->clearColor[1], g->clearColor[2], 1);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    UseShaderProg(g->shader);
+    SetUniformMat4fShaderProg(g->shader, "model", &g->model);
+    SetUniformVec3fShaderProg(g->shader, "posScale",
+                              vec3f(g->dequant.scale[0], g->dequant.scale[1], g->dequant.scale[2]));
+    SetUniformVec3fShaderProg(g->shader, "posOffset",
+                              vec3f(g->dequant.offset[0], g->dequant.offset[1], g->dequant.offset[2]));
+
+    glBindVertexArray(g->vertexArray);
+    glDrawElements(GL_TRIANGLES, g->indexCount, g->indexType, (void *)g->indexRange.offset);
+
+    isize axesOffset;
+    Vertex *axes = platform->dynamicGeometry
+                       ? AllocStreamBuffer(platform->dynamicGeometry, 6 * sizeof(Vertex),
+                                           sizeof(f32), &axesOffset)
+                       : NULL;
+    if (axes)
+    {
+        f32 pulse = g->axesPulse;
+        axes[0] = (Vertex){vec3f(0, 0, 0), vec3f(1, 0, 0)};
+        axes[1] = (Vertex){vec3f(pulse, 0, 0), vec3f(1, 0, 0)};
+        axes[2] = (Vertex){vec3f(0, 0, 0), vec3f(0, 1, 0)};
+        axes[3] = (Vertex){vec3f(0, pulse, 0), vec3f(0, 1, 0)};
+        axes[4] = (Vertex){vec3f(0, 0, 0), vec3f(0, 0, 1)};
+        axes[5] = (Vertex){vec3f(0, 0, pulse), vec3f(0, 0, 1)};
+
+        SetUniformMat4fShaderProg(g->shader, "model", &IdMat4f);
+        SetUniformVec3fShaderProg(g->shader, "posScale", vec3f(1, 1, 1));
+        SetUniformVec3fShaderProg(g->shader, "posOffset", vec3f(0, 0, 0));
+        glVertexArrayVertexBuffer(g->dynamicVertexArray, 0,
+                                  GetStreamBufferObject(platform->dynamicGeometry), axesOffset,
+                                  sizeof(Vertex));
+        glBindVertexArray(g->dynamicVertexArray);
+        glDrawArrays(GL_LINES, 0, 6);
+    }
+}
+
+void GameShutdown(GameMemory *memory, const GamePlatform *platform)
+{
+    GameState *g = memory->base;
+    if (!g->initialized)
+    {
+        return;
+    }
+    glDeleteProgram(g->shader._id);
+    glDeleteVertexArrays(1, &g->vertexArray);
+    glDeleteVertexArrays(1, &g->dynamicVertexArray);
+    FreeGpuMemory(platform->sceneHeap, g->vertexMemory);
+    FreeGpuMemory(platform->sceneHeap, g->indexMemory);
+    g->initialized = false;
+    memory->used = 0;
+}
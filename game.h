@@ -0,0 +1,91 @@
+#ifndef GAME_H
+#define GAME_H
+#include "asset-stream.h"
+#include "gpu-alloc.h"
+#include "pack.h"
+#include "rutils/def.h"
+#include "stream-buffer.h"
+#include "vfs.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* What the platform layer and the game library share. The game is
+       built as a shared library the platform loads and reloads whenever a
+       new build of it appears, so none of the game's state can live in
+       the library itself: it all goes in GameMemory, which the platform
+       allocates once and keeps across reloads. That rules out keeping
+       pointers to the library's own functions or static data in it too.
+
+       The library doesn't link the engine modules; it's resolved against
+       the platform executable (linked with -rdynamic) when it's loaded,
+       so both sides share one copy of GL's function pointers, the
+       profiler and every other module. */
+
+    typedef struct GameMemory
+    {
+        void *base;
+        isize size;
+        /* How much of base the game has put state in, set by the game.
+           Input recording snapshots this much. */
+        isize used;
+    } GameMemory;
+
+    /* Services the platform owns. They outlive every reload. */
+    typedef struct GamePlatform
+    {
+        Vfs *vfs;
+        /* NULL when there's no pack, and the streamer with it */
+        const AssetPack *pack;
+        AssetStreamer *streamer;
+        /* Compacted a bit every frame, see GetGpuHeapVersion */
+        GpuHeap *sceneHeap;
+        /* Per frame geometry, NULL if it couldn't be created */
+        StreamBuffer *dynamicGeometry;
+    } GamePlatform;
+
+    typedef struct GameInput
+    {
+        /* Seconds */
+        f32 dt;
+        f32 time;
+        /* The letterboxed viewport the game draws into */
+        ifast32 viewportWidth;
+        ifast32 viewportHeight;
+        /* Relative to the window */
+        ifast32 mouseX;
+        ifast32 mouseY;
+        bool mouseLeft;
+        bool mouseRight;
+        bool mouseMiddle;
+    } GameInput;
+
+    /* Sets up the game the first time it's called on a memory block */
+    typedef void GameUpdateFn(GameMemory *memory, const GamePlatform *platform,
+                              const GameInput *input);
+
+    /* Inside the frame's "Scene" GPU pass, with the viewport set */
+    typedef void GameRenderFn(GameMemory *memory, const GamePlatform *platform);
+
+    /* Frees what the game made on the platform's services */
+    typedef void GameShutdownFn(GameMemory *memory, const GamePlatform *platform);
+
+#define GAME_UPDATE_SYMBOL "GameUpdate"
+#define GAME_RENDER_SYMBOL "GameRender"
+#define GAME_SHUTDOWN_SYMBOL "GameShutdown"
+
+    /* Identifies the layout of the state a build keeps in GameMemory.
+       When a reload changes it, the platform has the old build shut its
+       state down, since only the old build can read it, and hands the new
+       one zeroed memory to start over in. */
+#define GAME_STATE_LAYOUT_SYMBOL "GameStateLayout"
+
+    GameUpdateFn GameUpdate;
+    GameRenderFn GameRender;
+    GameShutdownFn GameShutdown;
+    extern const u64 GameStateLayout;
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,649 @@
+#!/usr/bin/env python3
+"""Generates the optional layers that sit on top of the glad function
+pointer table.
+
+Run from the repo root whenever glad.h is regenerated:
+
+    python3 gen-glad-layers.py
+
+Outputs:
+    glad-instrument.c  Wrappers that count and time every GL call
+                       (built with -DGLAD_INSTRUMENT, see gl-stats.h)
+    glad-trace.c       Wrappers that serialize every GL call, and the
+                       dispatcher that replays them (see gl-trace.h)
+    glad-lazy.c        Trampolines that resolve each function on its first
+                       call (built with -DGLAD_LAZY, see gladLoadGLLazy)
+
+To only keep trampolines for the functions the engine calls, pass the
+sources to scan:
+
+    python3 gen-glad-layers.py --used linux-platform.c rgl.c ...
+
+Anything not referenced is left NULL, as with a context that lacks it.
+"""
+
+import re
+import sys
+
+GLAD_HEADER = "glad.h"
+
+PROTO_RE = re.compile(
+    r"^typedef (?P<ret>.+?)\s*\(APIENTRYP (?P<pfn>PFN\w+PROC)\)\((?P<params>.*)\);$")
+DECL_RE = re.compile(r"^GLAPI (?P<pfn>PFN\w+PROC) glad_(?P<name>gl\w+);$")
+VERSION_RE = re.compile(r"^#define (?P<version>GL_VERSION_\d_\d) 1$")
+
+
+class Param:
+    def __init__(self, text):
+        text = text.strip()
+        m = re.search(r"(\w+)\s*$", text)
+        self.name = m.group(1)
+        self.type = text[:m.start()].strip()
+
+    def __repr__(self):
+        return "%s %s" % (self.type, self.name)
+
+
+class Proc:
+    def __init__(self, name, pfn, ret, params, version):
+        self.name = name
+        self.pfn = pfn
+        self.ret = ret
+        self.params = params
+        self.version = version
+
+    @property
+    def returns(self):
+        return self.ret != "void"
+
+    def param_list(self):
+        if not self.params:
+            return "void"
+        return ", ".join("%s %s" % (p.type, p.name) if not p.type.endswith("*")
+                         else "%s%s" % (p.type, p.name) for p in self.params)
+
+    def arg_list(self):
+        return ", ".join(p.name for p in self.params)
+
+    def param(self, name):
+        for p in self.params:
+            if p.name == name:
+                return p
+        return None
+
+
+def parse_procs(path):
+    protos = {}
+    procs = []
+    version = None
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            m = VERSION_RE.match(line)
+            if m:
+                version = m.group("version")
+                continue
+            m = PROTO_RE.match(line)
+            if m:
+                params = m.group("params").strip()
+                params = [] if params == "void" else [
+                    Param(p) for p in params.split(",")]
+                protos[m.group("pfn")] = (m.group("ret").strip(), params)
+                continue
+            m = DECL_RE.match(line)
+            if m:
+                ret, params = protos[m.group("pfn")]
+                procs.append(Proc(m.group("name"), m.group("pfn"), ret, params,
+                                  version))
+    return procs
+
+
+HEADER = """/*
+    Generated by gen-glad-layers.py from glad.h. Do not edit.
+*/
+
+"""
+
+# Instrumentation ###########################################################
+
+STATE_PREFIXES = (
+    "glBind", "glUseProgram", "glEnable", "glDisable", "glBlend",
+    "glDepthFunc", "glDepthMask", "glDepthRange", "glCullFace", "glFrontFace",
+    "glPolygonMode", "glPolygonOffset", "glViewport", "glScissor",
+    "glColorMask", "glStencil", "glLineWidth", "glPointSize", "glClipControl",
+    "glPixelStore", "glActiveTexture", "glSampleCoverage", "glSampleMask",
+    "glLogicOp", "glPrimitiveRestartIndex", "glProvokingVertex",
+    "glMinSampleShading", "glPatchParameter",
+)
+
+# Size in bytes of the data a call uploads to a buffer object
+UPLOAD_BYTES = {
+    "glBufferData": "(u64)size",
+    "glBufferSubData": "(u64)size",
+    "glNamedBufferData": "(u64)size",
+    "glNamedBufferSubData": "(u64)size",
+    "glBufferStorage": "(data ? (u64)size : 0)",
+    "glNamedBufferStorage": "(data ? (u64)size : 0)",
+}
+
+
+def categories(proc):
+    cats = []
+    n = proc.name
+    if n.startswith("glDraw") or n.startswith("glMultiDraw"):
+        cats.append("GL_STATS_DRAW")
+    if (n.startswith("glUniform") or n.startswith("glProgramUniform")) \
+            and n != "glUniformBlockBinding":
+        cats.append("GL_STATS_UNIFORM")
+    if n.startswith(STATE_PREFIXES):
+        cats.append("GL_STATS_STATE")
+    if n in UPLOAD_BYTES:
+        cats.append("GL_STATS_UPLOAD")
+    return " | ".join(cats) if cats else "0"
+
+
+def gen_instrument(procs, out):
+    out.write(HEADER)
+    out.write("#if defined(GLAD_INSTRUMENT)\n")
+    out.write("#include \"glad.h\"\n#include \"gl-stats.h\"\n#include \"profile.h\"\n\n")
+    out.write("const unsigned gladInstrumentProcCount = %d;\n\n" % len(procs))
+
+    out.write("const char *const gladInstrumentNames[] = {\n")
+    for p in procs:
+        out.write("\t\"%s\",\n" % p.name)
+    out.write("};\n\n")
+
+    for i, p in enumerate(procs):
+        out.write("static %s glad_next_%s;\n" % (p.pfn, p.name))
+        out.write("static %s APIENTRY glad_instrument_%s(%s) {\n" %
+                  (p.ret, p.name, p.param_list()))
+        out.write("\tu64 glad_start = ReadProfileTicks();\n")
+        call = "glad_next_%s(%s);" % (p.name, p.arg_list())
+        if p.returns:
+            out.write("\t%s glad_result = %s\n" % (p.ret, call))
+        else:
+            out.write("\t%s\n" % call)
+        out.write("\tGLStatsRecordCall(%d, %s, glad_start, %s);\n" %
+                  (i, categories(p), UPLOAD_BYTES.get(p.name, "0")))
+        if p.returns:
+            out.write("\treturn glad_result;\n")
+        out.write("}\n")
+    out.write("\n")
+
+    out.write("void gladInstrumentInstall(void) {\n")
+    for p in procs:
+        out.write("\tif (glad_%s != NULL && glad_%s != glad_instrument_%s) {\n"
+                  "\t\tglad_next_%s = glad_%s;\n"
+                  "\t\tglad_%s = glad_instrument_%s;\n\t}\n"
+                  % ((p.name,) * 7))
+    out.write("}\n\n")
+
+    out.write("void gladInstrumentUninstall(void) {\n")
+    for p in procs:
+        out.write("\tif (glad_%s == glad_instrument_%s) glad_%s = glad_next_%s;\n"
+                  % ((p.name,) * 4))
+    out.write("}\n")
+    out.write("#endif\n")
+
+
+# Recording and replay #####################################################
+
+# Calls with no side effects aren't recorded at all
+def is_query(proc):
+    return proc.name.startswith(("glGet", "glIs", "glCheck"))
+
+
+# Mapped pointers can't be followed, so neither can the calls that finish
+# with them
+UNSUPPORTED = {
+    "glMapBuffer", "glMapBufferRange", "glMapNamedBuffer",
+    "glMapNamedBufferRange", "glUnmapBuffer", "glUnmapNamedBuffer",
+    "glFlushMappedBufferRange", "glFlushMappedNamedBufferRange",
+    "glDebugMessageCallback", "glObjectPtrLabel",
+}
+
+# Suffix of glGen*/glCreate*/glDelete* -> namespace
+NAME_SUFFIXES = {
+    "Buffers": "GL_TRACE_BUFFER",
+    "Textures": "GL_TRACE_TEXTURE",
+    "VertexArrays": "GL_TRACE_VERTEX_ARRAY",
+    "Framebuffers": "GL_TRACE_FRAMEBUFFER",
+    "Renderbuffers": "GL_TRACE_RENDERBUFFER",
+    "Queries": "GL_TRACE_QUERY",
+    "Samplers": "GL_TRACE_SAMPLER",
+    "ProgramPipelines": "GL_TRACE_PIPELINE",
+    "TransformFeedbacks": "GL_TRACE_TRANSFORM_FEEDBACK",
+}
+
+# Scalar GLuint parameters that name objects
+OBJECT_PARAMS = {
+    "buffer": "GL_TRACE_BUFFER",
+    "readBuffer": "GL_TRACE_BUFFER",
+    "writeBuffer": "GL_TRACE_BUFFER",
+    "texture": "GL_TRACE_TEXTURE",
+    "origtexture": "GL_TRACE_TEXTURE",
+    "srcName": "GL_TRACE_TEXTURE",
+    "dstName": "GL_TRACE_TEXTURE",
+    "vaobj": "GL_TRACE_VERTEX_ARRAY",
+    "framebuffer": "GL_TRACE_FRAMEBUFFER",
+    "readFramebuffer": "GL_TRACE_FRAMEBUFFER",
+    "drawFramebuffer": "GL_TRACE_FRAMEBUFFER",
+    "renderbuffer": "GL_TRACE_RENDERBUFFER",
+    "program": "GL_TRACE_PROGRAM",
+    "shader": "GL_TRACE_PROGRAM",
+    "pipeline": "GL_TRACE_PIPELINE",
+    "sampler": "GL_TRACE_SAMPLER",
+    "xfb": "GL_TRACE_TRANSFORM_FEEDBACK",
+}
+
+# Creation functions that return the new object
+RETURNED_OBJECTS = {
+    "glCreateProgram": "GL_TRACE_PROGRAM",
+    "glCreateShader": "GL_TRACE_PROGRAM",
+    "glCreateShaderProgramv": "GL_TRACE_PROGRAM",
+    "glFenceSync": "GL_TRACE_SYNC",
+}
+
+OFFSET_PARAMS = {"indirect"}
+OFFSET_PROCS = {
+    "glVertexAttribPointer", "glVertexAttribIPointer", "glVertexAttribLPointer",
+}
+
+# (proc, param) -> byte count of the array it points at
+BLOB_SIZES = {
+    ("glDrawBuffers", "bufs"): "n * sizeof(GLenum)",
+    ("glNamedFramebufferDrawBuffers", "bufs"): "n * sizeof(GLenum)",
+    ("glInvalidateFramebuffer", "attachments"): "numAttachments * sizeof(GLenum)",
+    ("glInvalidateSubFramebuffer", "attachments"): "numAttachments * sizeof(GLenum)",
+    ("glInvalidateNamedFramebufferData", "attachments"): "numAttachments * sizeof(GLenum)",
+    ("glInvalidateNamedFramebufferSubData", "attachments"): "numAttachments * sizeof(GLenum)",
+    ("glViewportArrayv", "v"): "count * 4 * sizeof(GLfloat)",
+    ("glViewportIndexedfv", "v"): "4 * sizeof(GLfloat)",
+    ("glScissorArrayv", "v"): "count * 4 * sizeof(GLint)",
+    ("glScissorIndexedv", "v"): "4 * sizeof(GLint)",
+    ("glDepthRangeArrayv", "v"): "count * 2 * sizeof(GLdouble)",
+    ("glMultiDrawArrays", "first"): "drawcount * sizeof(GLint)",
+    ("glMultiDrawArrays", "count"): "drawcount * sizeof(GLsizei)",
+    ("glMultiDrawElements", "count"): "drawcount * sizeof(GLsizei)",
+    ("glMultiDrawElements", "indices"): "drawcount * sizeof(void *)",
+    ("glMultiDrawElementsBaseVertex", "count"): "drawcount * sizeof(GLsizei)",
+    ("glMultiDrawElementsBaseVertex", "indices"): "drawcount * sizeof(void *)",
+    ("glMultiDrawElementsBaseVertex", "basevertex"): "drawcount * sizeof(GLint)",
+    ("glBindBuffersRange", "offsets"): "count * sizeof(GLintptr)",
+    ("glBindBuffersRange", "sizes"): "count * sizeof(GLsizeiptr)",
+    ("glBindVertexBuffers", "offsets"): "count * sizeof(GLintptr)",
+    ("glBindVertexBuffers", "strides"): "count * sizeof(GLsizei)",
+    ("glVertexArrayVertexBuffers", "offsets"): "count * sizeof(GLintptr)",
+    ("glVertexArrayVertexBuffers", "strides"): "count * sizeof(GLsizei)",
+    ("glDebugMessageControl", "ids"): "count * sizeof(GLuint)",
+    ("glUniformSubroutinesuiv", "indices"): "count * sizeof(GLuint)",
+    ("glShaderBinary", "binary"): "length",
+    ("glProgramBinary", "binary"): "length",
+    ("glPatchParameterfv", "values"):
+        "(pname == GL_PATCH_DEFAULT_OUTER_LEVEL ? 4 : 2) * sizeof(GLfloat)",
+    ("glBufferData", "data"): "size",
+    ("glBufferSubData", "data"): "size",
+    ("glNamedBufferData", "data"): "size",
+    ("glNamedBufferSubData", "data"): "size",
+    ("glBufferStorage", "data"): "size",
+    ("glNamedBufferStorage", "data"): "size",
+    ("glClearBufferData", "data"): "GLTraceImageSize(format, type, 1, 1, 1)",
+    ("glClearBufferSubData", "data"): "GLTraceImageSize(format, type, 1, 1, 1)",
+    ("glClearNamedBufferData", "data"): "GLTraceImageSize(format, type, 1, 1, 1)",
+    ("glClearNamedBufferSubData", "data"): "GLTraceImageSize(format, type, 1, 1, 1)",
+    ("glClearTexImage", "data"): "GLTraceImageSize(format, type, 1, 1, 1)",
+    ("glClearTexSubImage", "data"): "GLTraceImageSize(format, type, 1, 1, 1)",
+}
+
+# Strings with an explicit length parameter
+STRING_LENGTHS = {
+    ("glObjectLabel", "label"): "length",
+    ("glDebugMessageInsert", "buf"): "length",
+    ("glPushDebugGroup", "message"): "length",
+}
+
+# Arrays of strings: param -> (count, lengths param or None)
+STRING_ARRAYS = {
+    ("glShaderSource", "string"): ("count", "length"),
+    ("glCreateShaderProgramv", "strings"): ("count", None),
+    ("glTransformFeedbackVaryings", "varyings"): ("count", None),
+}
+
+
+def elem_type(param):
+    return param.type.replace("const", "").replace("*", "").strip()
+
+
+def image_size(proc):
+    """Byte count expression for the pixels of a texture upload/readback"""
+    n = proc.name
+    if "Compressed" in n:
+        return "imageSize"
+    if proc.param("bufSize"):
+        return "bufSize"
+    w = "width"
+    h = "height" if proc.param("height") else "1"
+    d = "depth" if proc.param("depth") else "1"
+    return "GLTraceImageSize(format, type, %s, %s, %s)" % (w, h, d)
+
+
+def object_namespace(proc, param):
+    if param.type != "GLuint":
+        return None
+    if param.name == "id":
+        if "Query" in proc.name or "ConditionalRender" in proc.name:
+            return "GL_TRACE_QUERY"
+        if "TransformFeedback" in proc.name:
+            return "GL_TRACE_TRANSFORM_FEEDBACK"
+        return None
+    if param.name == "array" and proc.name == "glBindVertexArray":
+        return "GL_TRACE_VERTEX_ARRAY"
+    return OBJECT_PARAMS.get(param.name)
+
+
+def names_namespace(proc, prefixes):
+    for prefix in prefixes:
+        if proc.name.startswith(prefix):
+            return NAME_SUFFIXES.get(proc.name[len(prefix):])
+    return None
+
+
+def param_kind(proc, param):
+    """How a parameter is serialized. None means it can't be."""
+    n = proc.name
+    key = (n, param.name)
+    if param.type == "GLsync":
+        return ("sync",)
+    if param.type == "GLDEBUGPROC":
+        return None
+    if "*" not in param.type:
+        ns = object_namespace(proc, param)
+        return ("object", ns) if ns else ("scalar",)
+
+    count = "n" if proc.param("n") else "count"
+    if "const" not in param.type:
+        ns = names_namespace(proc, ("glGen", "glCreate"))
+        if ns and param.type == "GLuint *":
+            return ("names_out", count, ns)
+        if n in ("glReadPixels", "glReadnPixels"):
+            return ("pixels_out", image_size(proc))
+        return None
+
+    if key in STRING_ARRAYS:
+        return ("strings",) + STRING_ARRAYS[key]
+    if any(key[0] == s[0] and param.name == STRING_ARRAYS[s][1]
+           for s in STRING_ARRAYS):
+        return ("ignored",)
+    if key in STRING_LENGTHS:
+        return ("string", STRING_LENGTHS[key])
+    if param.type == "const GLchar *":
+        return ("string", "-1")
+    if key in BLOB_SIZES:
+        return ("blob", BLOB_SIZES[key])
+    if param.name in OFFSET_PARAMS or n in OFFSET_PROCS:
+        return ("offset",)
+    if param.name == "indices" and n.startswith(("glDrawElements", "glDrawRangeElements")):
+        return ("offset",)
+    if n.startswith(("glTexImage", "glTexSubImage", "glTextureSubImage",
+                     "glCompressedTex")):
+        return ("pixels_in", image_size(proc))
+
+    if param.type == "const GLuint *":
+        ns = names_namespace(proc, ("glDelete",))
+        if ns is None and proc.name == "glShaderBinary":
+            ns = "GL_TRACE_PROGRAM"
+        if ns is None and n.startswith("glBind") or n == "glVertexArrayVertexBuffers":
+            ns = {"buffers": "GL_TRACE_BUFFER", "textures": "GL_TRACE_TEXTURE",
+                  "samplers": "GL_TRACE_SAMPLER"}.get(param.name)
+        if ns:
+            return ("names_in", count, ns)
+
+    elem = elem_type(param)
+    m = re.match(r"^gl(?:Program)?Uniform([1-4])(?:f|i|ui|d)v$", n)
+    if m:
+        return ("blob", "count * %s * sizeof(%s)" % (m.group(1), elem))
+    m = re.match(r"^gl(?:Program)?UniformMatrix([2-4])(?:x([2-4]))?(?:f|d)v$", n)
+    if m:
+        cols = int(m.group(1))
+        rows = int(m.group(2)) if m.group(2) else cols
+        return ("blob", "count * %d * sizeof(%s)" % (cols * rows, elem))
+    m = re.match(r"^glVertexAttrib[IL]?([1-4])N?(?:b|s|i|f|d|ub|us|ui)v$", n)
+    if m:
+        return ("blob", "%s * sizeof(%s)" % (m.group(1), elem))
+    if re.match(r"^gl(VertexAttribP|VertexP|TexCoordP|MultiTexCoordP|NormalP|ColorP|SecondaryColorP)", n):
+        return ("blob", "sizeof(GLuint)")
+    if re.match(r"^gl(Tex|Texture|Sampler)Parameter", n):
+        return ("blob", "(pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(%s)" % elem)
+    if n.startswith("glPointParameter"):
+        return ("blob", "sizeof(%s)" % elem)
+    if n.startswith(("glClearBuffer", "glClearNamedFramebuffer")) and param.name == "value":
+        return ("blob", "(buffer == GL_COLOR ? 4 : 1) * sizeof(%s)" % elem)
+    return None
+
+
+def trace_plan(proc):
+    """None if the proc is passed through untouched, 'unsupported' if it is
+    counted but not recorded, otherwise the list of parameter kinds"""
+    if is_query(proc):
+        return None
+    if proc.name in UNSUPPORTED:
+        return "unsupported"
+    if "*" in proc.ret and proc.name not in RETURNED_OBJECTS:
+        return "unsupported"
+    kinds = [param_kind(proc, p) for p in proc.params]
+    if any(k is None for k in kinds):
+        return "unsupported"
+    return kinds
+
+
+def gen_record_param(p, kind, out):
+    k = kind[0]
+    if k in ("scalar", "object"):
+        out.write("\tGLTraceWrite(&%s, sizeof(%s));\n" % (p.name, p.name))
+    elif k == "sync":
+        out.write("\t{ u64 glad_handle = (u64)(uintptr_t)%s; GLTraceWrite(&glad_handle, sizeof(glad_handle)); }\n" % p.name)
+    elif k == "offset":
+        out.write("\tGLTraceWriteOffset(%s);\n" % p.name)
+    elif k == "blob":
+        out.write("\tGLTraceWriteBlob(%s, (u64)(%s));\n" % (p.name, kind[1]))
+    elif k == "string":
+        out.write("\tGLTraceWriteString(%s, %s);\n" % (p.name, kind[1]))
+    elif k == "strings":
+        out.write("\tGLTraceWriteStrings(%s, %s, %s);\n" %
+                  (kind[1], p.name, kind[2] if kind[2] else "NULL"))
+    elif k in ("names_in", "names_out"):
+        out.write("\tGLTraceWriteBlob(%s, (u64)(%s) * sizeof(GLuint));\n" % (p.name, kind[1]))
+    elif k == "pixels_in":
+        out.write("\tGLTraceWritePixels(%s, (u64)(%s));\n" % (p.name, kind[1]))
+    elif k == "pixels_out":
+        out.write("\tGLTraceWritePixelsOut(%s, (u64)(%s));\n" % (p.name, kind[1]))
+
+
+def gen_replay_param(p, kind, out):
+    k = kind[0]
+    if k == "scalar":
+        out.write("\t\t%s %s; GLTraceRead(glad_reader, &%s, sizeof(%s));\n" % (p.type, p.name, p.name, p.name))
+    elif k == "object":
+        out.write("\t\t%s %s; GLTraceRead(glad_reader, &%s, sizeof(%s)); %s = (%s)GLTraceRemap(%s, %s);\n"
+                  % (p.type, p.name, p.name, p.name, p.name, p.type, kind[1], p.name))
+    elif k == "sync":
+        out.write("\t\tu64 glad_%s; GLTraceRead(glad_reader, &glad_%s, sizeof(glad_%s)); GLsync %s = (GLsync)(uintptr_t)GLTraceRemap(GL_TRACE_SYNC, glad_%s);\n"
+                  % ((p.name,) * 5))
+    elif k == "offset":
+        out.write("\t\t%s%s = (%s)GLTraceReadOffset(glad_reader);\n" % (p.type, p.name, p.type))
+    elif k in ("blob", "string"):
+        out.write("\t\t%s%s = (%s)GLTraceReadBlob(glad_reader);\n" % (p.type, p.name, p.type))
+    elif k == "strings":
+        out.write("\t\t%s%s = (%s)GLTraceReadStrings(glad_reader);\n" % (p.type, p.name, p.type))
+    elif k == "ignored":
+        out.write("\t\t%s%s = NULL;\n" % (p.type, p.name))
+    elif k == "names_in":
+        out.write("\t\t%s%s = GLTraceReadNames(glad_reader, %s);\n" % (p.type, p.name, kind[2]))
+    elif k == "names_out":
+        out.write("\t\tGLuint *%s = GLTraceScratch((u64)(%s) * sizeof(GLuint));\n" % (p.name, kind[1]))
+    elif k == "pixels_in":
+        out.write("\t\t%s%s = GLTraceReadPixels(glad_reader);\n" % (p.type, p.name))
+    elif k == "pixels_out":
+        out.write("\t\t%s%s = GLTraceReadPixelsOut(glad_reader);\n" % (p.type, p.name))
+
+
+def gen_trace(procs, out):
+    out.write(HEADER)
+    out.write("#include <stdint.h>\n#include \"glad.h\"\n#include \"gl-trace.h\"\n\n")
+    out.write("const unsigned gladTraceProcCount = %d;\n\n" % len(procs))
+
+    out.write("const char *const gladTraceNames[] = {\n")
+    for p in procs:
+        out.write("\t\"%s\",\n" % p.name)
+    out.write("};\n\n")
+
+    plans = [trace_plan(p) for p in procs]
+    for i, (p, plan) in enumerate(zip(procs, plans)):
+        if plan is None:
+            continue
+        out.write("static %s glad_trace_next_%s;\n" % (p.pfn, p.name))
+        out.write("static %s APIENTRY glad_trace_%s(%s) {\n" %
+                  (p.ret, p.name, p.param_list()))
+        call = "glad_trace_next_%s(%s);" % (p.name, p.arg_list())
+        if p.returns:
+            out.write("\t%s glad_result = %s\n" % (p.ret, call))
+        else:
+            out.write("\t%s\n" % call)
+        if plan == "unsupported":
+            out.write("\tGLTraceUnsupported(%d);\n" % i)
+        else:
+            out.write("\tGLTraceBeginCall(%d);\n" % i)
+            for param, kind in zip(p.params, plan):
+                gen_record_param(param, kind, out)
+            if p.name in RETURNED_OBJECTS:
+                out.write("\t{ u64 glad_handle = (u64)(uintptr_t)glad_result; GLTraceWrite(&glad_handle, sizeof(glad_handle)); }\n")
+        if p.returns:
+            out.write("\treturn glad_result;\n")
+        out.write("}\n")
+    out.write("\n")
+
+    out.write("void gladTraceInstall(void) {\n")
+    for p, plan in zip(procs, plans):
+        if plan is None:
+            continue
+        out.write("\tif (glad_%s != NULL && glad_%s != glad_trace_%s) {\n"
+                  "\t\tglad_trace_next_%s = glad_%s;\n"
+                  "\t\tglad_%s = glad_trace_%s;\n\t}\n"
+                  % ((p.name,) * 7))
+    out.write("}\n\n")
+
+    out.write("void gladTraceUninstall(void) {\n")
+    for p, plan in zip(procs, plans):
+        if plan is None:
+            continue
+        out.write("\tif (glad_%s == glad_trace_%s) glad_%s = glad_trace_next_%s;\n"
+                  % ((p.name,) * 4))
+    out.write("}\n\n")
+
+    out.write("bool gladTraceReplayCall(GLTraceReader *glad_reader, unsigned proc) {\n")
+    out.write("\tswitch (proc) {\n")
+    for i, (p, plan) in enumerate(zip(procs, plans)):
+        if plan is None or plan == "unsupported":
+            continue
+        out.write("\tcase %d: {\n" % i)
+        for param, kind in zip(p.params, plan):
+            gen_replay_param(param, kind, out)
+        call = "glad_%s(%s);" % (p.name, p.arg_list())
+        if p.name in RETURNED_OBJECTS:
+            out.write("\t\t%s glad_result = %s\n" % (p.ret, call))
+            out.write("\t\tu64 glad_recorded; GLTraceRead(glad_reader, &glad_recorded, sizeof(glad_recorded));\n")
+            out.write("\t\tGLTraceAddMapping(%s, glad_recorded, (u64)(uintptr_t)glad_result);\n"
+                      % RETURNED_OBJECTS[p.name])
+        else:
+            out.write("\t\t%s\n" % call)
+        for param, kind in zip(p.params, plan):
+            if kind[0] == "names_out":
+                out.write("\t\tGLTraceMapNames(glad_reader, %s, %s);\n" % (kind[2], param.name))
+        out.write("\t\treturn true;\n\t}\n")
+    out.write("\tdefault:\n\t\treturn false;\n\t}\n}\n")
+
+
+# Lazy loading ##############################################################
+
+# glad.c itself calls these while checking the version and extensions
+LAZY_ALWAYS = {"glGetString", "glGetStringi", "glGetIntegerv"}
+
+
+def used_procs(sources):
+    """Every gl* identifier referenced by the given sources"""
+    used = set(LAZY_ALWAYS)
+    for path in sources:
+        with open(path) as f:
+            used.update(re.findall(r"\b(gl[A-Z]\w*)\b", f.read()))
+    return used
+
+
+def gen_lazy(procs, out, used=None):
+    if used is not None:
+        procs = [p for p in procs if p.name in used]
+    out.write(HEADER)
+    out.write("#if defined(GLAD_LAZY)\n")
+    out.write("#include <stdio.h>\n#include <stdlib.h>\n#include \"glad.h\"\n\n")
+    out.write("static GLADloadproc glad_lazy_load;\n\n")
+    out.write("static void *glad_lazy_resolve(const char *name) {\n"
+              "\tvoid *proc = glad_lazy_load(name);\n"
+              "\tif (proc == NULL) {\n"
+              "\t\tfprintf(stderr, \"glad: %s is not available\\n\", name);\n"
+              "\t\tabort();\n"
+              "\t}\n"
+              "\treturn proc;\n"
+              "}\n\n")
+
+    # A layer installed on top (see glad-instrument.c) keeps calling the
+    # trampoline, so the table entry is only replaced while it still points
+    # at it
+    for p in procs:
+        out.write("static %s glad_lazy_real_%s;\n" % (p.pfn, p.name))
+        out.write("static %s APIENTRY glad_lazy_%s(%s) {\n" %
+                  (p.ret, p.name, p.param_list()))
+        out.write("\tif (glad_lazy_real_%s == NULL)\n"
+                  "\t\tglad_lazy_real_%s = (%s)glad_lazy_resolve(\"%s\");\n"
+                  "\tif (glad_%s == glad_lazy_%s) glad_%s = glad_lazy_real_%s;\n"
+                  % (p.name, p.name, p.pfn, p.name, p.name, p.name, p.name, p.name))
+        call = "glad_lazy_real_%s(%s);" % (p.name, p.arg_list())
+        if p.returns:
+            out.write("\treturn %s\n" % call)
+        else:
+            out.write("\t%s\n" % call)
+        out.write("}\n")
+    out.write("\n")
+
+    out.write("void gladLazyInstall(GLADloadproc load) {\n")
+    out.write("\tglad_lazy_load = load;\n")
+    version = None
+    for p in procs:
+        if p.version != version:
+            if version is not None:
+                out.write("\t}\n")
+            version = p.version
+            out.write("\tif (GLAD_%s) {\n" % version)
+        out.write("\t\tglad_lazy_real_%s = NULL;\n"
+                  "\t\tglad_%s = glad_lazy_%s;\n" % (p.name, p.name, p.name))
+    if version is not None:
+        out.write("\t}\n")
+    out.write("}\n")
+    out.write("#endif\n")
+
+
+def main():
+    procs = parse_procs(GLAD_HEADER)
+    if not procs:
+        sys.exit("no GL functions found in " + GLAD_HEADER)
+    with open("glad-instrument.c", "w") as out:
+        gen_instrument(procs, out)
+    with open("glad-trace.c", "w") as out:
+        gen_trace(procs, out)
+    used = None
+    if len(sys.argv) > 2 and sys.argv[1] == "--used":
+        used = used_procs(sys.argv[2:])
+    with open("glad-lazy.c", "w") as out:
+        gen_lazy(procs, out, used)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,176 @@
+#define _DEFAULT_SOURCE //clock_gettime
+#include "gl-stats.h"
+#include "profile.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(GLAD_INSTRUMENT)
+/* glad-instrument.c */
+extern const unsigned gladInstrumentProcCount;
+extern const char *const gladInstrumentNames[];
+void gladInstrumentInstall(void);
+void gladInstrumentUninstall(void);
+#endif
+
+typedef struct GLProcCounters
+{
+    u64 calls;
+    u64 ticks;
+} GLProcCounters;
+
+local GLProcCounters *currentProcs;
+local GLProcCounters *lastProcs;
+local GLFrameStats currentFrame;
+local GLFrameStats lastFrame;
+local u64 currentTicks;
+
+local u64 installTicks;
+local u64 installNanoseconds;
+
+local u64 ReadNanoseconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+bool InstallGLStats(void)
+{
+#if defined(GLAD_INSTRUMENT)
+    if (!currentProcs)
+    {
+        currentProcs = calloc(gladInstrumentProcCount, sizeof(*currentProcs));
+        lastProcs = calloc(gladInstrumentProcCount, sizeof(*lastProcs));
+        if (!currentProcs || !lastProcs)
+        {
+            free(currentProcs);
+            free(lastProcs);
+            currentProcs = lastProcs = NULL;
+            return false;
+        }
+    }
+    installTicks = ReadProfileTicks();
+    installNanoseconds = ReadNanoseconds();
+    gladInstrumentInstall();
+    return true;
+#else
+    return false;
+#endif
+}
+
+void UninstallGLStats(void)
+{
+#if defined(GLAD_INSTRUMENT)
+    gladInstrumentUninstall();
+    free(currentProcs);
+    free(lastProcs);
+    currentProcs = lastProcs = NULL;
+#endif
+}
+
+void GLStatsRecordCall(unsigned proc, unsigned categories, u64 startTicks, u64 bytes)
+{
+    u64 ticks = ReadProfileTicks() - startTicks;
+    currentProcs[proc].calls++;
+    currentProcs[proc].ticks += ticks;
+
+    currentFrame.calls++;
+    currentTicks += ticks;
+    if (categories & GL_STATS_DRAW)
+    {
+        currentFrame.drawCalls++;
+    }
+    if (categories & GL_STATS_UNIFORM)
+    {
+        currentFrame.uniformUploads++;
+    }
+    if (categories & GL_STATS_STATE)
+    {
+        currentFrame.stateChanges++;
+    }
+    if (categories & GL_STATS_UPLOAD)
+    {
+        currentFrame.bufferBytesUploaded += bytes;
+    }
+}
+
+void EndGLStatsFrame(void)
+{
+    if (!currentProcs)
+    {
+        return;
+    }
+
+    /* Recalibrated every frame so the ratio keeps getting more precise */
+    u64 elapsedNs = ReadNanoseconds() - installNanoseconds;
+    u64 elapsedTicks = ReadProfileTicks() - installTicks;
+    f64 ticksPerMs = elapsedNs ? (f64)elapsedTicks * 1e6 / (f64)elapsedNs : 1;
+
+    lastFrame = currentFrame;
+    lastFrame.glMs = (f64)currentTicks / ticksPerMs;
+
+    GLProcCounters *tmp = lastProcs;
+    lastProcs = currentProcs;
+    currentProcs = tmp;
+
+#if defined(GLAD_INSTRUMENT)
+    memset(currentProcs, 0, gladInstrumentProcCount * sizeof(*currentProcs));
+#endif
+    memset(&currentFrame, 0, sizeof(currentFrame));
+    currentTicks = 0;
+}
+
+GLFrameStats GetGLFrameStats(void)
+{
+    return lastFrame;
+}
+
+void PrintGLFrameStats(FILE *f, ifast32 topFunctions)
+{
+    fprintf(f, "GL: %" PRIu64 " calls, %" PRIu64 " draws, %" PRIu64 " uniforms, %" PRIu64 " state changes, %" PRIu64 " bytes uploaded, %.3fms in driver\n",
+            lastFrame.calls, lastFrame.drawCalls, lastFrame.uniformUploads,
+            lastFrame.stateChanges, lastFrame.bufferBytesUploaded, lastFrame.glMs);
+
+#if defined(GLAD_INSTRUMENT)
+    if (!lastProcs || !lastFrame.calls)
+    {
+        return;
+    }
+
+    u64 totalTicks = 0;
+    for (unsigned i = 0; i < gladInstrumentProcCount; i++)
+    {
+        totalTicks += lastProcs[i].ticks;
+    }
+
+    /* Repeated selection, topFunctions is small */
+    u64 prevTicks = UINT64_MAX;
+    unsigned prevIndex = 0;
+    for (ifast32 n = 0; n < topFunctions; n++)
+    {
+        ifast32 best = -1;
+        for (unsigned i = 0; i < gladInstrumentProcCount; i++)
+        {
+            u64 t = lastProcs[i].ticks;
+            bool afterPrev = t < prevTicks || (t == prevTicks && i > prevIndex);
+            if (lastProcs[i].calls && afterPrev &&
+                (best < 0 || t > lastProcs[best].ticks))
+            {
+                best = i;
+            }
+        }
+        if (best < 0)
+        {
+            break;
+        }
+        fprintf(f, "  %-32s %6" PRIu64 " calls %5.1f%%\n", gladInstrumentNames[best],
+                lastProcs[best].calls,
+                totalTicks ? 100.0 * (f64)lastProcs[best].ticks / (f64)totalTicks : 0.0);
+        prevTicks = lastProcs[best].ticks;
+        prevIndex = best;
+    }
+#else
+    ignore topFunctions;
+#endif
+}
@@ -0,0 +1,54 @@
+#ifndef GL_STATS_H
+#define GL_STATS_H
+#include "rutils/def.h"
+#include <stdio.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Per frame counters for every GL call made through glad. Only collected
+       when built with instrument=on (-DGLAD_INSTRUMENT), which wraps every
+       loaded function pointer with a counting, timing trampoline (see
+       gen-glad-layers.py). */
+    typedef struct GLFrameStats
+    {
+        u64 calls;
+        u64 drawCalls;
+        u64 uniformUploads;
+        u64 stateChanges;
+        u64 bufferBytesUploaded;
+        /* Time spent inside GL entry points, i.e. driver overhead */
+        f64 glMs;
+    } GLFrameStats;
+
+    /* Call after gladLoadGLLoader. Returns false if the wrappers weren't
+       compiled in. */
+    bool InstallGLStats(void);
+
+    void UninstallGLStats(void);
+
+    /* Closes the current frame's counters and starts a new set */
+    void EndGLStatsFrame(void);
+
+    /* Counters of the last frame passed to EndGLStatsFrame */
+    GLFrameStats GetGLFrameStats(void);
+
+    /* Writes the last frame's totals plus the topFunctions most expensive
+       entry points by time */
+    void PrintGLFrameStats(FILE *f, ifast32 topFunctions);
+
+    /* Used by the generated wrappers in glad-instrument.c */
+    enum
+    {
+        GL_STATS_DRAW = 1 << 0,
+        GL_STATS_UNIFORM = 1 << 1,
+        GL_STATS_STATE = 1 << 2,
+        GL_STATS_UPLOAD = 1 << 3,
+    };
+
+    void GLStatsRecordCall(unsigned proc, unsigned categories, u64 startTicks, u64 bytes);
+#ifdef __cplusplus
+}
+#endif
+#endif
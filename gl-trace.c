@@ -0,0 +1,649 @@
+#include "gl-trace.h"
+#include "glad.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Blobs are padded to this so the replayer can hand GL pointers straight
+   into the mapped trace */
+#define GL_TRACE_ALIGN 8
+#define GL_TRACE_NULL_BLOB 0xffffffffu
+
+typedef enum GLTracePixelSource
+{
+    GL_TRACE_PIXELS_OFFSET, /* Pointer was an offset into a bound buffer */
+    GL_TRACE_PIXELS_DATA,
+    GL_TRACE_PIXELS_NULL,
+} GLTracePixelSource;
+
+/* Recording state */
+local FILE *traceFile;
+local u8 *recordBuf;
+local u64 recordSize;
+local u64 recordCap;
+local u64 flushedBytes;
+local GLTraceHeader recordHeader;
+local ifast32 framesLeft;
+local u64 *unsupportedCalls;
+
+/* Replay state */
+typedef struct GLTraceNameMap
+{
+    u64 *keys;
+    u64 *values;
+    u64 count;
+    u64 cap;
+} GLTraceNameMap;
+
+local GLTraceNameMap nameMaps[GL_TRACE_NAMESPACE_COUNT];
+local u8 *scratch;
+local u64 scratchUsed;
+local u64 scratchCap;
+/* Blocks outgrown during the current call, pointers into them may still be
+   live until the call has been made */
+local u8 *retiredScratch[8];
+local ifast32 retiredScratchCount;
+
+local void ReserveRecord(u64 size)
+{
+    if (recordSize + size > recordCap)
+    {
+        u64 newCap = recordCap ? recordCap : 1 << 20;
+        while (recordSize + size > newCap)
+        {
+            newCap *= 2;
+        }
+        recordBuf = realloc(recordBuf, newCap);
+        recordCap = newCap;
+    }
+}
+
+local void FlushRecord(void)
+{
+    fwrite(recordBuf, 1, recordSize, traceFile);
+    flushedBytes += recordSize;
+    recordSize = 0;
+}
+
+local void PadRecord(void)
+{
+    u64 pos = flushedBytes + recordSize;
+    u64 pad = (GL_TRACE_ALIGN - pos % GL_TRACE_ALIGN) % GL_TRACE_ALIGN;
+    ReserveRecord(pad);
+    memset(recordBuf + recordSize, 0, pad);
+    recordSize += pad;
+}
+
+bool BeginGLTraceRecording(const char *path, ifast32 frames, ifast32 width, ifast32 height)
+{
+    traceFile = fopen(path, "wb");
+    if (!traceFile)
+    {
+        fprintf(stderr, "GL TRACE: could not open %s\n", path);
+        return false;
+    }
+    recordHeader = (GLTraceHeader){GL_TRACE_MAGIC, GL_TRACE_VERSION, gladTraceProcCount,
+                                   width, height, 0};
+    fwrite(&recordHeader, sizeof(recordHeader), 1, traceFile);
+    flushedBytes = sizeof(recordHeader);
+    /* Plus one for the setup section */
+    framesLeft = frames + 1;
+    unsupportedCalls = calloc(gladTraceProcCount, sizeof(*unsupportedCalls));
+    gladTraceInstall();
+    return true;
+}
+
+bool IsGLTraceRecording(void)
+{
+    return traceFile != NULL;
+}
+
+void EndGLTraceFrame(void)
+{
+    if (!traceFile)
+    {
+        return;
+    }
+    u16 op = GL_TRACE_END_FRAME;
+    GLTraceWrite(&op, sizeof(op));
+    FlushRecord();
+
+    recordHeader.frameCount++;
+    if (--framesLeft <= 0)
+    {
+        EndGLTraceRecording();
+    }
+}
+
+void EndGLTraceRecording(void)
+{
+    if (!traceFile)
+    {
+        return;
+    }
+    gladTraceUninstall();
+    FlushRecord();
+
+    /* Setup section isn't a frame */
+    if (recordHeader.frameCount)
+    {
+        recordHeader.frameCount--;
+    }
+    fseek(traceFile, 0, SEEK_SET);
+    fwrite(&recordHeader, sizeof(recordHeader), 1, traceFile);
+    fclose(traceFile);
+    traceFile = NULL;
+
+    for (unsigned i = 0; i < gladTraceProcCount; i++)
+    {
+        if (unsupportedCalls[i])
+        {
+            fprintf(stderr, "GL TRACE: %s called %" PRIu64 " times but can't be recorded\n",
+                    gladTraceNames[i], unsupportedCalls[i]);
+        }
+    }
+    free(unsupportedCalls);
+    unsupportedCalls = NULL;
+    free(recordBuf);
+    recordBuf = NULL;
+    recordSize = recordCap = 0;
+}
+
+void GLTraceBeginCall(unsigned proc)
+{
+    u16 op = (u16)proc;
+    GLTraceWrite(&op, sizeof(op));
+}
+
+void GLTraceUnsupported(unsigned proc)
+{
+    if (unsupportedCalls)
+    {
+        unsupportedCalls[proc]++;
+    }
+}
+
+void GLTraceWrite(const void *src, u64 size)
+{
+    ReserveRecord(size);
+    memcpy(recordBuf + recordSize, src, size);
+    recordSize += size;
+}
+
+void GLTraceWriteBlob(const void *src, u64 size)
+{
+    u32 len = src ? (u32)size : GL_TRACE_NULL_BLOB;
+    GLTraceWrite(&len, sizeof(len));
+    if (src)
+    {
+        PadRecord();
+        GLTraceWrite(src, size);
+    }
+}
+
+void GLTraceWriteOffset(const void *ptr)
+{
+    u64 offset = (u64)(uintptr_t)ptr;
+    GLTraceWrite(&offset, sizeof(offset));
+}
+
+void GLTraceWriteString(const GLchar *s, GLsizei len)
+{
+    if (!s)
+    {
+        GLTraceWriteBlob(NULL, 0);
+        return;
+    }
+    u64 n = len < 0 ? strlen(s) : (u64)len;
+    u32 blobLen = (u32)n + 1;
+    GLTraceWrite(&blobLen, sizeof(blobLen));
+    PadRecord();
+    GLTraceWrite(s, n);
+    u8 terminator = 0;
+    GLTraceWrite(&terminator, 1);
+}
+
+/* Always written NUL terminated so the replayer can pass no lengths */
+void GLTraceWriteStrings(GLsizei count, const GLchar *const *strings, const GLint *lengths)
+{
+    u32 n = (u32)count;
+    GLTraceWrite(&n, sizeof(n));
+    for (GLsizei i = 0; i < count; i++)
+    {
+        GLTraceWriteString(strings[i], lengths ? lengths[i] : -1);
+    }
+}
+
+local bool BufferBound(GLenum binding)
+{
+    GLint bound = 0;
+    glGetIntegerv(binding, &bound);
+    return bound != 0;
+}
+
+void GLTraceWritePixels(const void *pixels, u64 size)
+{
+    u8 source;
+    if (BufferBound(GL_PIXEL_UNPACK_BUFFER_BINDING))
+    {
+        source = GL_TRACE_PIXELS_OFFSET;
+        GLTraceWrite(&source, 1);
+        GLTraceWriteOffset(pixels);
+    }
+    else if (pixels)
+    {
+        source = GL_TRACE_PIXELS_DATA;
+        GLTraceWrite(&source, 1);
+        GLTraceWriteBlob(pixels, size);
+    }
+    else
+    {
+        source = GL_TRACE_PIXELS_NULL;
+        GLTraceWrite(&source, 1);
+    }
+}
+
+/* Readbacks into client memory are replayed into scratch memory, only the
+   size is kept */
+void GLTraceWritePixelsOut(const void *pixels, u64 size)
+{
+    u8 source = BufferBound(GL_PIXEL_PACK_BUFFER_BINDING) ? GL_TRACE_PIXELS_OFFSET : GL_TRACE_PIXELS_DATA;
+    GLTraceWrite(&source, 1);
+    if (source == GL_TRACE_PIXELS_OFFSET)
+    {
+        GLTraceWriteOffset(pixels);
+    }
+    else
+    {
+        GLTraceWrite(&size, sizeof(size));
+    }
+}
+
+/* Assumes the default pack/unpack state (alignment 4, no row length), which
+   is all the engine uses */
+u64 GLTraceImageSize(GLenum format, GLenum type, GLsizei w, GLsizei h, GLsizei d)
+{
+    u64 components;
+    switch (format)
+    {
+    case GL_RED:
+    case GL_RED_INTEGER:
+    case GL_GREEN:
+    case GL_BLUE:
+    case GL_DEPTH_COMPONENT:
+    case GL_STENCIL_INDEX:
+    {
+        components = 1;
+        break;
+    }
+    case GL_RG:
+    case GL_RG_INTEGER:
+    case GL_DEPTH_STENCIL:
+    {
+        components = 2;
+        break;
+    }
+    case GL_RGB:
+    case GL_BGR:
+    case GL_RGB_INTEGER:
+    case GL_BGR_INTEGER:
+    {
+        components = 3;
+        break;
+    }
+    default:
+    {
+        components = 4;
+        break;
+    }
+    }
+
+    u64 pixelSize;
+    switch (type)
+    {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:
+    {
+        pixelSize = components;
+        break;
+    }
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_HALF_FLOAT:
+    {
+        pixelSize = components * 2;
+        break;
+    }
+    case GL_UNSIGNED_BYTE_3_3_2:
+    case GL_UNSIGNED_BYTE_2_3_3_REV:
+    {
+        pixelSize = 1;
+        break;
+    }
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_5_6_5_REV:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+    case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+    {
+        pixelSize = 2;
+        break;
+    }
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+    {
+        pixelSize = 8;
+        break;
+    }
+    case GL_UNSIGNED_INT_8_8_8_8:
+    case GL_UNSIGNED_INT_8_8_8_8_REV:
+    case GL_UNSIGNED_INT_10_10_10_2:
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_24_8:
+    case GL_UNSIGNED_INT_10F_11F_11F_REV:
+    case GL_UNSIGNED_INT_5_9_9_9_REV:
+    {
+        pixelSize = 4;
+        break;
+    }
+    default:
+    {
+        pixelSize = components * 4;
+        break;
+    }
+    }
+
+    u64 rowSize = ((u64)w * pixelSize + 3) & ~(u64)3;
+    return rowSize * (u64)h * (u64)d;
+}
+
+bool OpenGLTrace(GLTraceReader *r, const void *data, isize size, GLTraceHeader *header)
+{
+    if (size < (isize)sizeof(*header))
+    {
+        return false;
+    }
+    memcpy(header, data, sizeof(*header));
+    if (header->magic != GL_TRACE_MAGIC || header->version != GL_TRACE_VERSION)
+    {
+        fputs("GL TRACE: not a trace file\n", stderr);
+        return false;
+    }
+    if (header->procCount != gladTraceProcCount)
+    {
+        fputs("GL TRACE: recorded with a different glad\n", stderr);
+        return false;
+    }
+    r->base = data;
+    r->at = r->base + sizeof(*header);
+    r->end = r->base + size;
+    return true;
+}
+
+local void ResetScratch(void)
+{
+    for (ifast32 i = 0; i < retiredScratchCount; i++)
+    {
+        free(retiredScratch[i]);
+    }
+    retiredScratchCount = 0;
+    scratchUsed = 0;
+}
+
+bool ReplayGLTraceFrame(GLTraceReader *r, u64 *calls)
+{
+    while (r->at + sizeof(u16) <= r->end)
+    {
+        u16 op;
+        GLTraceRead(r, &op, sizeof(op));
+        if (op == GL_TRACE_END_FRAME)
+        {
+            return true;
+        }
+        ResetScratch();
+        if (op >= gladTraceProcCount || !gladTraceReplayCall(r, op))
+        {
+            fprintf(stderr, "GL TRACE: corrupt record at offset %td\n", r->at - r->base);
+            r->at = r->end;
+            return false;
+        }
+        if (calls)
+        {
+            (*calls)++;
+        }
+    }
+    return false;
+}
+
+void GLTraceRead(GLTraceReader *r, void *dst, u64 size)
+{
+    if (r->at + size > r->end)
+    {
+        memset(dst, 0, size);
+        r->at = r->end;
+        return;
+    }
+    memcpy(dst, r->at, size);
+    r->at += size;
+}
+
+local void PadRead(GLTraceReader *r)
+{
+    u64 pos = r->at - r->base;
+    r->at += (GL_TRACE_ALIGN - pos % GL_TRACE_ALIGN) % GL_TRACE_ALIGN;
+}
+
+local const void *ReadBlobWithLength(GLTraceReader *r, u32 *len)
+{
+    GLTraceRead(r, len, sizeof(*len));
+    if (*len == GL_TRACE_NULL_BLOB)
+    {
+        *len = 0;
+        return NULL;
+    }
+    PadRead(r);
+    if (r->at + *len > r->end)
+    {
+        r->at = r->end;
+        *len = 0;
+        return NULL;
+    }
+    const u8 *blob = r->at;
+    r->at += *len;
+    return blob;
+}
+
+const void *GLTraceReadBlob(GLTraceReader *r)
+{
+    u32 len;
+    return ReadBlobWithLength(r, &len);
+}
+
+const void *GLTraceReadOffset(GLTraceReader *r)
+{
+    u64 offset;
+    GLTraceRead(r, &offset, sizeof(offset));
+    return (const void *)(uintptr_t)offset;
+}
+
+const GLchar *const *GLTraceReadStrings(GLTraceReader *r)
+{
+    u32 count;
+    GLTraceRead(r, &count, sizeof(count));
+    const GLchar **strings = GLTraceScratch((u64)count * sizeof(*strings));
+    for (u32 i = 0; i < count; i++)
+    {
+        strings[i] = GLTraceReadBlob(r);
+    }
+    return strings;
+}
+
+const void *GLTraceReadPixels(GLTraceReader *r)
+{
+    u8 source;
+    GLTraceRead(r, &source, 1);
+    switch (source)
+    {
+    case GL_TRACE_PIXELS_OFFSET:
+    {
+        return GLTraceReadOffset(r);
+    }
+    case GL_TRACE_PIXELS_DATA:
+    {
+        return GLTraceReadBlob(r);
+    }
+    default:
+    {
+        return NULL;
+    }
+    }
+}
+
+void *GLTraceReadPixelsOut(GLTraceReader *r)
+{
+    u8 source;
+    GLTraceRead(r, &source, 1);
+    if (source == GL_TRACE_PIXELS_OFFSET)
+    {
+        return (void *)GLTraceReadOffset(r);
+    }
+    u64 size;
+    GLTraceRead(r, &size, sizeof(size));
+    return GLTraceScratch(size);
+}
+
+/* Returns a remapped copy, the trace itself is read only */
+const GLuint *GLTraceReadNames(GLTraceReader *r, GLTraceNamespace ns)
+{
+    u32 len;
+    const GLuint *recorded = ReadBlobWithLength(r, &len);
+    if (!recorded)
+    {
+        return NULL;
+    }
+    GLuint *names = GLTraceScratch(len);
+    for (u32 i = 0; i < len / sizeof(GLuint); i++)
+    {
+        names[i] = (GLuint)GLTraceRemap(ns, recorded[i]);
+    }
+    return names;
+}
+
+void GLTraceMapNames(GLTraceReader *r, GLTraceNamespace ns, const GLuint *created)
+{
+    u32 len;
+    const GLuint *recorded = ReadBlobWithLength(r, &len);
+    if (!recorded || !created)
+    {
+        return;
+    }
+    for (u32 i = 0; i < len / sizeof(GLuint); i++)
+    {
+        GLTraceAddMapping(ns, recorded[i], created[i]);
+    }
+}
+
+/* Reset before every replayed call */
+void *GLTraceScratch(u64 size)
+{
+    size = (size + 15) & ~(u64)15;
+    if (scratchUsed + size > scratchCap)
+    {
+        if (retiredScratchCount == countof(retiredScratch))
+        {
+            return NULL;
+        }
+        u64 newCap = scratchCap ? scratchCap * 2 : 1 << 16;
+        while (size > newCap)
+        {
+            newCap *= 2;
+        }
+        u8 *newScratch = malloc(newCap);
+        if (!newScratch)
+        {
+            return NULL;
+        }
+        if (scratch)
+        {
+            retiredScratch[retiredScratchCount++] = scratch;
+        }
+        scratch = newScratch;
+        scratchCap = newCap;
+        scratchUsed = 0;
+    }
+    void *result = scratch + scratchUsed;
+    scratchUsed += size;
+    return result;
+}
+
+local u64 HashName(u64 key)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    return key;
+}
+
+u64 GLTraceRemap(GLTraceNamespace ns, u64 recorded)
+{
+    GLTraceNameMap *m = &nameMaps[ns];
+    if (recorded == 0 || m->cap == 0)
+    {
+        return recorded;
+    }
+    for (u64 i = HashName(recorded) & (m->cap - 1);; i = (i + 1) & (m->cap - 1))
+    {
+        if (m->keys[i] == recorded)
+        {
+            return m->values[i];
+        }
+        if (m->keys[i] == 0)
+        {
+            return recorded;
+        }
+    }
+}
+
+void GLTraceAddMapping(GLTraceNamespace ns, u64 recorded, u64 actual)
+{
+    GLTraceNameMap *m = &nameMaps[ns];
+    if (recorded == 0)
+    {
+        return;
+    }
+    if ((m->count + 1) * 2 > m->cap)
+    {
+        GLTraceNameMap grown = {0};
+        grown.cap = m->cap ? m->cap * 2 : 64;
+        grown.keys = calloc(grown.cap, sizeof(u64));
+        grown.values = calloc(grown.cap, sizeof(u64));
+        for (u64 i = 0; i < m->cap; i++)
+        {
+            if (m->keys[i])
+            {
+                u64 j = HashName(m->keys[i]) & (grown.cap - 1);
+                while (grown.keys[j])
+                {
+                    j = (j + 1) & (grown.cap - 1);
+                }
+                grown.keys[j] = m->keys[i];
+                grown.values[j] = m->values[i];
+                grown.count++;
+            }
+        }
+        free(m->keys);
+        free(m->values);
+        *m = grown;
+    }
+    u64 i = HashName(recorded) & (m->cap - 1);
+    while (m->keys[i] && m->keys[i] != recorded)
+    {
+        i = (i + 1) & (m->cap - 1);
+    }
+    if (!m->keys[i])
+    {
+        m->count++;
+    }
+    m->keys[i] = recorded;
+    m->values[i] = actual;
+}
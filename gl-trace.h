@@ -0,0 +1,109 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+#include "glad.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Records every GL call made through glad, along with the data it
+       references, into a compact binary trace that replay.c can re-execute
+       on its own. Recording should start right after gladLoadGLLoader so
+       every object the frames use is created inside the trace; everything
+       before the first EndGLTraceFrame is treated as setup by the replayer.
+
+       Not captured: writes through mapped buffer pointers and debug
+       callbacks. Calls that can't be serialized are counted and listed
+       when recording ends. */
+
+    typedef struct GLTraceHeader
+    {
+        u32 magic;
+        u32 version;
+        /* Must match the glad the replayer was built with */
+        u32 procCount;
+        u32 width;
+        u32 height;
+        u32 frameCount;
+    } GLTraceHeader;
+
+#define GL_TRACE_MAGIC 0x544c4752 /* "RGLT" */
+#define GL_TRACE_VERSION 1
+#define GL_TRACE_END_FRAME 0xffff
+
+    typedef enum GLTraceNamespace
+    {
+        GL_TRACE_BUFFER,
+        GL_TRACE_TEXTURE,
+        GL_TRACE_VERTEX_ARRAY,
+        GL_TRACE_FRAMEBUFFER,
+        GL_TRACE_RENDERBUFFER,
+        /* Shaders and programs share a namespace in GL */
+        GL_TRACE_PROGRAM,
+        GL_TRACE_PIPELINE,
+        GL_TRACE_SAMPLER,
+        GL_TRACE_QUERY,
+        GL_TRACE_TRANSFORM_FEEDBACK,
+        GL_TRACE_SYNC,
+        GL_TRACE_NAMESPACE_COUNT
+    } GLTraceNamespace;
+
+    typedef struct GLTraceReader
+    {
+        const u8 *base;
+        const u8 *at;
+        const u8 *end;
+    } GLTraceReader;
+
+    /* Recording. frames counts frames after the setup section, recording
+       stops by itself once that many have been written. */
+    bool BeginGLTraceRecording(const char *path, ifast32 frames, ifast32 width, ifast32 height);
+
+    void EndGLTraceFrame(void);
+
+    void EndGLTraceRecording(void);
+
+    bool IsGLTraceRecording(void);
+
+    /* Replay */
+    bool OpenGLTrace(GLTraceReader *r, const void *data, isize size, GLTraceHeader *header);
+
+    /* Executes calls up to the next frame boundary. Returns false at the
+       end of the trace or on a corrupt record. */
+    bool ReplayGLTraceFrame(GLTraceReader *r, u64 *calls);
+
+    /* Used by the generated code in glad-trace.c */
+    void GLTraceBeginCall(unsigned proc);
+    void GLTraceUnsupported(unsigned proc);
+    void GLTraceWrite(const void *src, u64 size);
+    void GLTraceWriteBlob(const void *src, u64 size);
+    void GLTraceWriteOffset(const void *ptr);
+    void GLTraceWriteString(const GLchar *s, GLsizei len);
+    void GLTraceWriteStrings(GLsizei count, const GLchar *const *strings, const GLint *lengths);
+    void GLTraceWritePixels(const void *pixels, u64 size);
+    void GLTraceWritePixelsOut(const void *pixels, u64 size);
+    u64 GLTraceImageSize(GLenum format, GLenum type, GLsizei w, GLsizei h, GLsizei d);
+
+    void GLTraceRead(GLTraceReader *r, void *dst, u64 size);
+    const void *GLTraceReadBlob(GLTraceReader *r);
+    const void *GLTraceReadOffset(GLTraceReader *r);
+    const GLchar *const *GLTraceReadStrings(GLTraceReader *r);
+    const void *GLTraceReadPixels(GLTraceReader *r);
+    void *GLTraceReadPixelsOut(GLTraceReader *r);
+    const GLuint *GLTraceReadNames(GLTraceReader *r, GLTraceNamespace ns);
+    void GLTraceMapNames(GLTraceReader *r, GLTraceNamespace ns, const GLuint *created);
+    void *GLTraceScratch(u64 size);
+    u64 GLTraceRemap(GLTraceNamespace ns, u64 recorded);
+    void GLTraceAddMapping(GLTraceNamespace ns, u64 recorded, u64 actual);
+
+    /* glad-trace.c */
+    extern const unsigned gladTraceProcCount;
+    extern const char *const gladTraceNames[];
+    void gladTraceInstall(void);
+    void gladTraceUninstall(void);
+    bool gladTraceReplayCall(GLTraceReader *r, unsigned proc);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,8403 @@
+/*
+    Generated by gen-glad-layers.py from glad.h. Do not edit.
+*/
+
+#if defined(GLAD_INSTRUMENT)
+#include "glad.h"
+#include "gl-stats.h"
+#include "profile.h"
+
+const unsigned gladInstrumentProcCount = 695;
+
+const char *const gladInstrumentNames[] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+	"glVertexP2ui",
+	"glVertexP2uiv",
+	"glVertexP3ui",
+	"glVertexP3uiv",
+	"glVertexP4ui",
+	"glVertexP4uiv",
+	"glTexCoordP1ui",
+	"glTexCoordP1uiv",
+	"glTexCoordP2ui",
+	"glTexCoordP2uiv",
+	"glTexCoordP3ui",
+	"glTexCoordP3uiv",
+	"glTexCoordP4ui",
+	"glTexCoordP4uiv",
+	"glMultiTexCoordP1ui",
+	"glMultiTexCoordP1uiv",
+	"glMultiTexCoordP2ui",
+	"glMultiTexCoordP2uiv",
+	"glMultiTexCoordP3ui",
+	"glMultiTexCoordP3uiv",
+	"glMultiTexCoordP4ui",
+	"glMultiTexCoordP4uiv",
+	"glNormalP3ui",
+	"glNormalP3uiv",
+	"glColorP3ui",
+	"glColorP3uiv",
+	"glColorP4ui",
+	"glColorP4uiv",
+	"glSecondaryColorP3ui",
+	"glSecondaryColorP3uiv",
+	"glMinSampleShading",
+	"glBlendEquationi",
+	"glBlendEquationSeparatei",
+	"glBlendFunci",
+	"glBlendFuncSeparatei",
+	"glDrawArraysIndirect",
+	"glDrawElementsIndirect",
+	"glUniform1d",
+	"glUniform2d",
+	"glUniform3d",
+	"glUniform4d",
+	"glUniform1dv",
+	"glUniform2dv",
+	"glUniform3dv",
+	"glUniform4dv",
+	"glUniformMatrix2dv",
+	"glUniformMatrix3dv",
+	"glUniformMatrix4dv",
+	"glUniformMatrix2x3dv",
+	"glUniformMatrix2x4dv",
+	"glUniformMatrix3x2dv",
+	"glUniformMatrix3x4dv",
+	"glUniformMatrix4x2dv",
+	"glUniformMatrix4x3dv",
+	"glGetUniformdv",
+	"glGetSubroutineUniformLocation",
+	"glGetSubroutineIndex",
+	"glGetActiveSubroutineUniformiv",
+	"glGetActiveSubroutineUniformName",
+	"glGetActiveSubroutineName",
+	"glUniformSubroutinesuiv",
+	"glGetUniformSubroutineuiv",
+	"glGetProgramStageiv",
+	"glPatchParameteri",
+	"glPatchParameterfv",
+	"glBindTransformFeedback",
+	"glDeleteTransformFeedbacks",
+	"glGenTransformFeedbacks",
+	"glIsTransformFeedback",
+	"glPauseTransformFeedback",
+	"glResumeTransformFeedback",
+	"glDrawTransformFeedback",
+	"glDrawTransformFeedbackStream",
+	"glBeginQueryIndexed",
+	"glEndQueryIndexed",
+	"glGetQueryIndexediv",
+	"glReleaseShaderCompiler",
+	"glShaderBinary",
+	"glGetShaderPrecisionFormat",
+	"glDepthRangef",
+	"glClearDepthf",
+	"glGetProgramBinary",
+	"glProgramBinary",
+	"glProgramParameteri",
+	"glUseProgramStages",
+	"glActiveShaderProgram",
+	"glCreateShaderProgramv",
+	"glBindProgramPipeline",
+	"glDeleteProgramPipelines",
+	"glGenProgramPipelines",
+	"glIsProgramPipeline",
+	"glGetProgramPipelineiv",
+	"glProgramUniform1i",
+	"glProgramUniform1iv",
+	"glProgramUniform1f",
+	"glProgramUniform1fv",
+	"glProgramUniform1d",
+	"glProgramUniform1dv",
+	"glProgramUniform1ui",
+	"glProgramUniform1uiv",
+	"glProgramUniform2i",
+	"glProgramUniform2iv",
+	"glProgramUniform2f",
+	"glProgramUniform2fv",
+	"glProgramUniform2d",
+	"glProgramUniform2dv",
+	"glProgramUniform2ui",
+	"glProgramUniform2uiv",
+	"glProgramUniform3i",
+	"glProgramUniform3iv",
+	"glProgramUniform3f",
+	"glProgramUniform3fv",
+	"glProgramUniform3d",
+	"glProgramUniform3dv",
+	"glProgramUniform3ui",
+	"glProgramUniform3uiv",
+	"glProgramUniform4i",
+	"glProgramUniform4iv",
+	"glProgramUniform4f",
+	"glProgramUniform4fv",
+	"glProgramUniform4d",
+	"glProgramUniform4dv",
+	"glProgramUniform4ui",
+	"glProgramUniform4uiv",
+	"glProgramUniformMatrix2fv",
+	"glProgramUniformMatrix3fv",
+	"glProgramUniformMatrix4fv",
+	"glProgramUniformMatrix2dv",
+	"glProgramUniformMatrix3dv",
+	"glProgramUniformMatrix4dv",
+	"glProgramUniformMatrix2x3fv",
+	"glProgramUniformMatrix3x2fv",
+	"glProgramUniformMatrix2x4fv",
+	"glProgramUniformMatrix4x2fv",
+	"glProgramUniformMatrix3x4fv",
+	"glProgramUniformMatrix4x3fv",
+	"glProgramUniformMatrix2x3dv",
+	"glProgramUniformMatrix3x2dv",
+	"glProgramUniformMatrix2x4dv",
+	"glProgramUniformMatrix4x2dv",
+	"glProgramUniformMatrix3x4dv",
+	"glProgramUniformMatrix4x3dv",
+	"glValidateProgramPipeline",
+	"glGetProgramPipelineInfoLog",
+	"glVertexAttribL1d",
+	"glVertexAttribL2d",
+	"glVertexAttribL3d",
+	"glVertexAttribL4d",
+	"glVertexAttribL1dv",
+	"glVertexAttribL2dv",
+	"glVertexAttribL3dv",
+	"glVertexAttribL4dv",
+	"glVertexAttribLPointer",
+	"glGetVertexAttribLdv",
+	"glViewportArrayv",
+	"glViewportIndexedf",
+	"glViewportIndexedfv",
+	"glScissorArrayv",
+	"glScissorIndexed",
+	"glScissorIndexedv",
+	"glDepthRangeArrayv",
+	"glDepthRangeIndexed",
+	"glGetFloati_v",
+	"glGetDoublei_v",
+	"glDrawArraysInstancedBaseInstance",
+	"glDrawElementsInstancedBaseInstance",
+	"glDrawElementsInstancedBaseVertexBaseInstance",
+	"glGetInternalformativ",
+	"glGetActiveAtomicCounterBufferiv",
+	"glBindImageTexture",
+	"glMemoryBarrier",
+	"glTexStorage1D",
+	"glTexStorage2D",
+	"glTexStorage3D",
+	"glDrawTransformFeedbackInstanced",
+	"glDrawTransformFeedbackStreamInstanced",
+	"glClearBufferData",
+	"glClearBufferSubData",
+	"glDispatchCompute",
+	"glDispatchComputeIndirect",
+	"glCopyImageSubData",
+	"glFramebufferParameteri",
+	"glGetFramebufferParameteriv",
+	"glGetInternalformati64v",
+	"glInvalidateTexSubImage",
+	"glInvalidateTexImage",
+	"glInvalidateBufferSubData",
+	"glInvalidateBufferData",
+	"glInvalidateFramebuffer",
+	"glInvalidateSubFramebuffer",
+	"glMultiDrawArraysIndirect",
+	"glMultiDrawElementsIndirect",
+	"glGetProgramInterfaceiv",
+	"glGetProgramResourceIndex",
+	"glGetProgramResourceName",
+	"glGetProgramResourceiv",
+	"glGetProgramResourceLocation",
+	"glGetProgramResourceLocationIndex",
+	"glShaderStorageBlockBinding",
+	"glTexBufferRange",
+	"glTexStorage2DMultisample",
+	"glTexStorage3DMultisample",
+	"glTextureView",
+	"glBindVertexBuffer",
+	"glVertexAttribFormat",
+	"glVertexAttribIFormat",
+	"glVertexAttribLFormat",
+	"glVertexAttribBinding",
+	"glVertexBindingDivisor",
+	"glDebugMessageControl",
+	"glDebugMessageInsert",
+	"glDebugMessageCallback",
+	"glGetDebugMessageLog",
+	"glPushDebugGroup",
+	"glPopDebugGroup",
+	"glObjectLabel",
+	"glGetObjectLabel",
+	"glObjectPtrLabel",
+	"glGetObjectPtrLabel",
+	"glGetPointerv",
+	"glBufferStorage",
+	"glClearTexImage",
+	"glClearTexSubImage",
+	"glBindBuffersBase",
+	"glBindBuffersRange",
+	"glBindTextures",
+	"glBindSamplers",
+	"glBindImageTextures",
+	"glBindVertexBuffers",
+	"glClipControl",
+	"glCreateTransformFeedbacks",
+	"glTransformFeedbackBufferBase",
+	"glTransformFeedbackBufferRange",
+	"glGetTransformFeedbackiv",
+	"glGetTransformFeedbacki_v",
+	"glGetTransformFeedbacki64_v",
+	"glCreateBuffers",
+	"glNamedBufferStorage",
+	"glNamedBufferData",
+	"glNamedBufferSubData",
+	"glCopyNamedBufferSubData",
+	"glClearNamedBufferData",
+	"glClearNamedBufferSubData",
+	"glMapNamedBuffer",
+	"glMapNamedBufferRange",
+	"glUnmapNamedBuffer",
+	"glFlushMappedNamedBufferRange",
+	"glGetNamedBufferParameteriv",
+	"glGetNamedBufferParameteri64v",
+	"glGetNamedBufferPointerv",
+	"glGetNamedBufferSubData",
+	"glCreateFramebuffers",
+	"glNamedFramebufferRenderbuffer",
+	"glNamedFramebufferParameteri",
+	"glNamedFramebufferTexture",
+	"glNamedFramebufferTextureLayer",
+	"glNamedFramebufferDrawBuffer",
+	"glNamedFramebufferDrawBuffers",
+	"glNamedFramebufferReadBuffer",
+	"glInvalidateNamedFramebufferData",
+	"glInvalidateNamedFramebufferSubData",
+	"glClearNamedFramebufferiv",
+	"glClearNamedFramebufferuiv",
+	"glClearNamedFramebufferfv",
+	"glClearNamedFramebufferfi",
+	"glBlitNamedFramebuffer",
+	"glCheckNamedFramebufferStatus",
+	"glGetNamedFramebufferParameteriv",
+	"glGetNamedFramebufferAttachmentParameteriv",
+	"glCreateRenderbuffers",
+	"glNamedRenderbufferStorage",
+	"glNamedRenderbufferStorageMultisample",
+	"glGetNamedRenderbufferParameteriv",
+	"glCreateTextures",
+	"glTextureBuffer",
+	"glTextureBufferRange",
+	"glTextureStorage1D",
+	"glTextureStorage2D",
+	"glTextureStorage3D",
+	"glTextureStorage2DMultisample",
+	"glTextureStorage3DMultisample",
+	"glTextureSubImage1D",
+	"glTextureSubImage2D",
+	"glTextureSubImage3D",
+	"glCompressedTextureSubImage1D",
+	"glCompressedTextureSubImage2D",
+	"glCompressedTextureSubImage3D",
+	"glCopyTextureSubImage1D",
+	"glCopyTextureSubImage2D",
+	"glCopyTextureSubImage3D",
+	"glTextureParameterf",
+	"glTextureParameterfv",
+	"glTextureParameteri",
+	"glTextureParameterIiv",
+	"glTextureParameterIuiv",
+	"glTextureParameteriv",
+	"glGenerateTextureMipmap",
+	"glBindTextureUnit",
+	"glGetTextureImage",
+	"glGetCompressedTextureImage",
+	"glGetTextureLevelParameterfv",
+	"glGetTextureLevelParameteriv",
+	"glGetTextureParameterfv",
+	"glGetTextureParameterIiv",
+	"glGetTextureParameterIuiv",
+	"glGetTextureParameteriv",
+	"glCreateVertexArrays",
+	"glDisableVertexArrayAttrib",
+	"glEnableVertexArrayAttrib",
+	"glVertexArrayElementBuffer",
+	"glVertexArrayVertexBuffer",
+	"glVertexArrayVertexBuffers",
+	"glVertexArrayAttribBinding",
+	"glVertexArrayAttribFormat",
+	"glVertexArrayAttribIFormat",
+	"glVertexArrayAttribLFormat",
+	"glVertexArrayBindingDivisor",
+	"glGetVertexArrayiv",
+	"glGetVertexArrayIndexediv",
+	"glGetVertexArrayIndexed64iv",
+	"glCreateSamplers",
+	"glCreateProgramPipelines",
+	"glCreateQueries",
+	"glGetQueryBufferObjecti64v",
+	"glGetQueryBufferObjectiv",
+	"glGetQueryBufferObjectui64v",
+	"glGetQueryBufferObjectuiv",
+	"glMemoryBarrierByRegion",
+	"glGetTextureSubImage",
+	"glGetCompressedTextureSubImage",
+	"glGetGraphicsResetStatus",
+	"glGetnCompressedTexImage",
+	"glGetnTexImage",
+	"glGetnUniformdv",
+	"glGetnUniformfv",
+	"glGetnUniformiv",
+	"glGetnUniformuiv",
+	"glReadnPixels",
+	"glGetnMapdv",
+	"glGetnMapfv",
+	"glGetnMapiv",
+	"glGetnPixelMapfv",
+	"glGetnPixelMapuiv",
+	"glGetnPixelMapusv",
+	"glGetnPolygonStipple",
+	"glGetnColorTable",
+	"glGetnConvolutionFilter",
+	"glGetnSeparableFilter",
+	"glGetnHistogram",
+	"glGetnMinmax",
+	"glTextureBarrier",
+};
+
+static PFNGLCULLFACEPROC glad_next_glCullFace;
+static void APIENTRY glad_instrument_glCullFace(GLenum mode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCullFace(mode);
+	GLStatsRecordCall(0, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLFRONTFACEPROC glad_next_glFrontFace;
+static void APIENTRY glad_instrument_glFrontFace(GLenum mode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFrontFace(mode);
+	GLStatsRecordCall(1, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLHINTPROC glad_next_glHint;
+static void APIENTRY glad_instrument_glHint(GLenum target, GLenum mode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glHint(target, mode);
+	GLStatsRecordCall(2, 0, glad_start, 0);
+}
+static PFNGLLINEWIDTHPROC glad_next_glLineWidth;
+static void APIENTRY glad_instrument_glLineWidth(GLfloat width) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glLineWidth(width);
+	GLStatsRecordCall(3, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLPOINTSIZEPROC glad_next_glPointSize;
+static void APIENTRY glad_instrument_glPointSize(GLfloat size) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPointSize(size);
+	GLStatsRecordCall(4, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLPOLYGONMODEPROC glad_next_glPolygonMode;
+static void APIENTRY glad_instrument_glPolygonMode(GLenum face, GLenum mode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPolygonMode(face, mode);
+	GLStatsRecordCall(5, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSCISSORPROC glad_next_glScissor;
+static void APIENTRY glad_instrument_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glScissor(x, y, width, height);
+	GLStatsRecordCall(6, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLTEXPARAMETERFPROC glad_next_glTexParameterf;
+static void APIENTRY glad_instrument_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexParameterf(target, pname, param);
+	GLStatsRecordCall(7, 0, glad_start, 0);
+}
+static PFNGLTEXPARAMETERFVPROC glad_next_glTexParameterfv;
+static void APIENTRY glad_instrument_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexParameterfv(target, pname, params);
+	GLStatsRecordCall(8, 0, glad_start, 0);
+}
+static PFNGLTEXPARAMETERIPROC glad_next_glTexParameteri;
+static void APIENTRY glad_instrument_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexParameteri(target, pname, param);
+	GLStatsRecordCall(9, 0, glad_start, 0);
+}
+static PFNGLTEXPARAMETERIVPROC glad_next_glTexParameteriv;
+static void APIENTRY glad_instrument_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexParameteriv(target, pname, params);
+	GLStatsRecordCall(10, 0, glad_start, 0);
+}
+static PFNGLTEXIMAGE1DPROC glad_next_glTexImage1D;
+static void APIENTRY glad_instrument_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	GLStatsRecordCall(11, 0, glad_start, 0);
+}
+static PFNGLTEXIMAGE2DPROC glad_next_glTexImage2D;
+static void APIENTRY glad_instrument_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	GLStatsRecordCall(12, 0, glad_start, 0);
+}
+static PFNGLDRAWBUFFERPROC glad_next_glDrawBuffer;
+static void APIENTRY glad_instrument_glDrawBuffer(GLenum buf) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawBuffer(buf);
+	GLStatsRecordCall(13, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLCLEARPROC glad_next_glClear;
+static void APIENTRY glad_instrument_glClear(GLbitfield mask) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClear(mask);
+	GLStatsRecordCall(14, 0, glad_start, 0);
+}
+static PFNGLCLEARCOLORPROC glad_next_glClearColor;
+static void APIENTRY glad_instrument_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearColor(red, green, blue, alpha);
+	GLStatsRecordCall(15, 0, glad_start, 0);
+}
+static PFNGLCLEARSTENCILPROC glad_next_glClearStencil;
+static void APIENTRY glad_instrument_glClearStencil(GLint s) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearStencil(s);
+	GLStatsRecordCall(16, 0, glad_start, 0);
+}
+static PFNGLCLEARDEPTHPROC glad_next_glClearDepth;
+static void APIENTRY glad_instrument_glClearDepth(GLdouble depth) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearDepth(depth);
+	GLStatsRecordCall(17, 0, glad_start, 0);
+}
+static PFNGLSTENCILMASKPROC glad_next_glStencilMask;
+static void APIENTRY glad_instrument_glStencilMask(GLuint mask) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glStencilMask(mask);
+	GLStatsRecordCall(18, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLCOLORMASKPROC glad_next_glColorMask;
+static void APIENTRY glad_instrument_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glColorMask(red, green, blue, alpha);
+	GLStatsRecordCall(19, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDEPTHMASKPROC glad_next_glDepthMask;
+static void APIENTRY glad_instrument_glDepthMask(GLboolean flag) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDepthMask(flag);
+	GLStatsRecordCall(20, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDISABLEPROC glad_next_glDisable;
+static void APIENTRY glad_instrument_glDisable(GLenum cap) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDisable(cap);
+	GLStatsRecordCall(21, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLENABLEPROC glad_next_glEnable;
+static void APIENTRY glad_instrument_glEnable(GLenum cap) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glEnable(cap);
+	GLStatsRecordCall(22, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLFINISHPROC glad_next_glFinish;
+static void APIENTRY glad_instrument_glFinish(void) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFinish();
+	GLStatsRecordCall(23, 0, glad_start, 0);
+}
+static PFNGLFLUSHPROC glad_next_glFlush;
+static void APIENTRY glad_instrument_glFlush(void) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFlush();
+	GLStatsRecordCall(24, 0, glad_start, 0);
+}
+static PFNGLBLENDFUNCPROC glad_next_glBlendFunc;
+static void APIENTRY glad_instrument_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlendFunc(sfactor, dfactor);
+	GLStatsRecordCall(25, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLLOGICOPPROC glad_next_glLogicOp;
+static void APIENTRY glad_instrument_glLogicOp(GLenum opcode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glLogicOp(opcode);
+	GLStatsRecordCall(26, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSTENCILFUNCPROC glad_next_glStencilFunc;
+static void APIENTRY glad_instrument_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glStencilFunc(func, ref, mask);
+	GLStatsRecordCall(27, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSTENCILOPPROC glad_next_glStencilOp;
+static void APIENTRY glad_instrument_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glStencilOp(fail, zfail, zpass);
+	GLStatsRecordCall(28, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDEPTHFUNCPROC glad_next_glDepthFunc;
+static void APIENTRY glad_instrument_glDepthFunc(GLenum func) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDepthFunc(func);
+	GLStatsRecordCall(29, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLPIXELSTOREFPROC glad_next_glPixelStoref;
+static void APIENTRY glad_instrument_glPixelStoref(GLenum pname, GLfloat param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPixelStoref(pname, param);
+	GLStatsRecordCall(30, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLPIXELSTOREIPROC glad_next_glPixelStorei;
+static void APIENTRY glad_instrument_glPixelStorei(GLenum pname, GLint param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPixelStorei(pname, param);
+	GLStatsRecordCall(31, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLREADBUFFERPROC glad_next_glReadBuffer;
+static void APIENTRY glad_instrument_glReadBuffer(GLenum src) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glReadBuffer(src);
+	GLStatsRecordCall(32, 0, glad_start, 0);
+}
+static PFNGLREADPIXELSPROC glad_next_glReadPixels;
+static void APIENTRY glad_instrument_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glReadPixels(x, y, width, height, format, type, pixels);
+	GLStatsRecordCall(33, 0, glad_start, 0);
+}
+static PFNGLGETBOOLEANVPROC glad_next_glGetBooleanv;
+static void APIENTRY glad_instrument_glGetBooleanv(GLenum pname, GLboolean *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetBooleanv(pname, data);
+	GLStatsRecordCall(34, 0, glad_start, 0);
+}
+static PFNGLGETDOUBLEVPROC glad_next_glGetDoublev;
+static void APIENTRY glad_instrument_glGetDoublev(GLenum pname, GLdouble *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetDoublev(pname, data);
+	GLStatsRecordCall(35, 0, glad_start, 0);
+}
+static PFNGLGETERRORPROC glad_next_glGetError;
+static GLenum APIENTRY glad_instrument_glGetError(void) {
+	u64 glad_start = ReadProfileTicks();
+	GLenum glad_result = glad_next_glGetError();
+	GLStatsRecordCall(36, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETFLOATVPROC glad_next_glGetFloatv;
+static void APIENTRY glad_instrument_glGetFloatv(GLenum pname, GLfloat *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetFloatv(pname, data);
+	GLStatsRecordCall(37, 0, glad_start, 0);
+}
+static PFNGLGETINTEGERVPROC glad_next_glGetIntegerv;
+static void APIENTRY glad_instrument_glGetIntegerv(GLenum pname, GLint *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetIntegerv(pname, data);
+	GLStatsRecordCall(38, 0, glad_start, 0);
+}
+static PFNGLGETSTRINGPROC glad_next_glGetString;
+static const GLubyte * APIENTRY glad_instrument_glGetString(GLenum name) {
+	u64 glad_start = ReadProfileTicks();
+	const GLubyte * glad_result = glad_next_glGetString(name);
+	GLStatsRecordCall(39, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETTEXIMAGEPROC glad_next_glGetTexImage;
+static void APIENTRY glad_instrument_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTexImage(target, level, format, type, pixels);
+	GLStatsRecordCall(40, 0, glad_start, 0);
+}
+static PFNGLGETTEXPARAMETERFVPROC glad_next_glGetTexParameterfv;
+static void APIENTRY glad_instrument_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTexParameterfv(target, pname, params);
+	GLStatsRecordCall(41, 0, glad_start, 0);
+}
+static PFNGLGETTEXPARAMETERIVPROC glad_next_glGetTexParameteriv;
+static void APIENTRY glad_instrument_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTexParameteriv(target, pname, params);
+	GLStatsRecordCall(42, 0, glad_start, 0);
+}
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_next_glGetTexLevelParameterfv;
+static void APIENTRY glad_instrument_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTexLevelParameterfv(target, level, pname, params);
+	GLStatsRecordCall(43, 0, glad_start, 0);
+}
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_next_glGetTexLevelParameteriv;
+static void APIENTRY glad_instrument_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTexLevelParameteriv(target, level, pname, params);
+	GLStatsRecordCall(44, 0, glad_start, 0);
+}
+static PFNGLISENABLEDPROC glad_next_glIsEnabled;
+static GLboolean APIENTRY glad_instrument_glIsEnabled(GLenum cap) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsEnabled(cap);
+	GLStatsRecordCall(45, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLDEPTHRANGEPROC glad_next_glDepthRange;
+static void APIENTRY glad_instrument_glDepthRange(GLdouble n, GLdouble f) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDepthRange(n, f);
+	GLStatsRecordCall(46, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLVIEWPORTPROC glad_next_glViewport;
+static void APIENTRY glad_instrument_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glViewport(x, y, width, height);
+	GLStatsRecordCall(47, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDRAWARRAYSPROC glad_next_glDrawArrays;
+static void APIENTRY glad_instrument_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawArrays(mode, first, count);
+	GLStatsRecordCall(48, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLDRAWELEMENTSPROC glad_next_glDrawElements;
+static void APIENTRY glad_instrument_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawElements(mode, count, type, indices);
+	GLStatsRecordCall(49, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLPOLYGONOFFSETPROC glad_next_glPolygonOffset;
+static void APIENTRY glad_instrument_glPolygonOffset(GLfloat factor, GLfloat units) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPolygonOffset(factor, units);
+	GLStatsRecordCall(50, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLCOPYTEXIMAGE1DPROC glad_next_glCopyTexImage1D;
+static void APIENTRY glad_instrument_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	GLStatsRecordCall(51, 0, glad_start, 0);
+}
+static PFNGLCOPYTEXIMAGE2DPROC glad_next_glCopyTexImage2D;
+static void APIENTRY glad_instrument_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	GLStatsRecordCall(52, 0, glad_start, 0);
+}
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_next_glCopyTexSubImage1D;
+static void APIENTRY glad_instrument_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	GLStatsRecordCall(53, 0, glad_start, 0);
+}
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_next_glCopyTexSubImage2D;
+static void APIENTRY glad_instrument_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	GLStatsRecordCall(54, 0, glad_start, 0);
+}
+static PFNGLTEXSUBIMAGE1DPROC glad_next_glTexSubImage1D;
+static void APIENTRY glad_instrument_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	GLStatsRecordCall(55, 0, glad_start, 0);
+}
+static PFNGLTEXSUBIMAGE2DPROC glad_next_glTexSubImage2D;
+static void APIENTRY glad_instrument_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	GLStatsRecordCall(56, 0, glad_start, 0);
+}
+static PFNGLBINDTEXTUREPROC glad_next_glBindTexture;
+static void APIENTRY glad_instrument_glBindTexture(GLenum target, GLuint texture) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindTexture(target, texture);
+	GLStatsRecordCall(57, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDELETETEXTURESPROC glad_next_glDeleteTextures;
+static void APIENTRY glad_instrument_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteTextures(n, textures);
+	GLStatsRecordCall(58, 0, glad_start, 0);
+}
+static PFNGLGENTEXTURESPROC glad_next_glGenTextures;
+static void APIENTRY glad_instrument_glGenTextures(GLsizei n, GLuint *textures) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenTextures(n, textures);
+	GLStatsRecordCall(59, 0, glad_start, 0);
+}
+static PFNGLISTEXTUREPROC glad_next_glIsTexture;
+static GLboolean APIENTRY glad_instrument_glIsTexture(GLuint texture) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsTexture(texture);
+	GLStatsRecordCall(60, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLDRAWRANGEELEMENTSPROC glad_next_glDrawRangeElements;
+static void APIENTRY glad_instrument_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawRangeElements(mode, start, end, count, type, indices);
+	GLStatsRecordCall(61, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLTEXIMAGE3DPROC glad_next_glTexImage3D;
+static void APIENTRY glad_instrument_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	GLStatsRecordCall(62, 0, glad_start, 0);
+}
+static PFNGLTEXSUBIMAGE3DPROC glad_next_glTexSubImage3D;
+static void APIENTRY glad_instrument_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	GLStatsRecordCall(63, 0, glad_start, 0);
+}
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_next_glCopyTexSubImage3D;
+static void APIENTRY glad_instrument_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	GLStatsRecordCall(64, 0, glad_start, 0);
+}
+static PFNGLACTIVETEXTUREPROC glad_next_glActiveTexture;
+static void APIENTRY glad_instrument_glActiveTexture(GLenum texture) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glActiveTexture(texture);
+	GLStatsRecordCall(65, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSAMPLECOVERAGEPROC glad_next_glSampleCoverage;
+static void APIENTRY glad_instrument_glSampleCoverage(GLfloat value, GLboolean invert) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSampleCoverage(value, invert);
+	GLStatsRecordCall(66, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_next_glCompressedTexImage3D;
+static void APIENTRY glad_instrument_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	GLStatsRecordCall(67, 0, glad_start, 0);
+}
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_next_glCompressedTexImage2D;
+static void APIENTRY glad_instrument_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	GLStatsRecordCall(68, 0, glad_start, 0);
+}
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_next_glCompressedTexImage1D;
+static void APIENTRY glad_instrument_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	GLStatsRecordCall(69, 0, glad_start, 0);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_next_glCompressedTexSubImage3D;
+static void APIENTRY glad_instrument_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	GLStatsRecordCall(70, 0, glad_start, 0);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_next_glCompressedTexSubImage2D;
+static void APIENTRY glad_instrument_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	GLStatsRecordCall(71, 0, glad_start, 0);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_next_glCompressedTexSubImage1D;
+static void APIENTRY glad_instrument_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	GLStatsRecordCall(72, 0, glad_start, 0);
+}
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_next_glGetCompressedTexImage;
+static void APIENTRY glad_instrument_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetCompressedTexImage(target, level, img);
+	GLStatsRecordCall(73, 0, glad_start, 0);
+}
+static PFNGLBLENDFUNCSEPARATEPROC glad_next_glBlendFuncSeparate;
+static void APIENTRY glad_instrument_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	GLStatsRecordCall(74, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLMULTIDRAWARRAYSPROC glad_next_glMultiDrawArrays;
+static void APIENTRY glad_instrument_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiDrawArrays(mode, first, count, drawcount);
+	GLStatsRecordCall(75, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLMULTIDRAWELEMENTSPROC glad_next_glMultiDrawElements;
+static void APIENTRY glad_instrument_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiDrawElements(mode, count, type, indices, drawcount);
+	GLStatsRecordCall(76, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLPOINTPARAMETERFPROC glad_next_glPointParameterf;
+static void APIENTRY glad_instrument_glPointParameterf(GLenum pname, GLfloat param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPointParameterf(pname, param);
+	GLStatsRecordCall(77, 0, glad_start, 0);
+}
+static PFNGLPOINTPARAMETERFVPROC glad_next_glPointParameterfv;
+static void APIENTRY glad_instrument_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPointParameterfv(pname, params);
+	GLStatsRecordCall(78, 0, glad_start, 0);
+}
+static PFNGLPOINTPARAMETERIPROC glad_next_glPointParameteri;
+static void APIENTRY glad_instrument_glPointParameteri(GLenum pname, GLint param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPointParameteri(pname, param);
+	GLStatsRecordCall(79, 0, glad_start, 0);
+}
+static PFNGLPOINTPARAMETERIVPROC glad_next_glPointParameteriv;
+static void APIENTRY glad_instrument_glPointParameteriv(GLenum pname, const GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPointParameteriv(pname, params);
+	GLStatsRecordCall(80, 0, glad_start, 0);
+}
+static PFNGLBLENDCOLORPROC glad_next_glBlendColor;
+static void APIENTRY glad_instrument_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlendColor(red, green, blue, alpha);
+	GLStatsRecordCall(81, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBLENDEQUATIONPROC glad_next_glBlendEquation;
+static void APIENTRY glad_instrument_glBlendEquation(GLenum mode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlendEquation(mode);
+	GLStatsRecordCall(82, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLGENQUERIESPROC glad_next_glGenQueries;
+static void APIENTRY glad_instrument_glGenQueries(GLsizei n, GLuint *ids) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenQueries(n, ids);
+	GLStatsRecordCall(83, 0, glad_start, 0);
+}
+static PFNGLDELETEQUERIESPROC glad_next_glDeleteQueries;
+static void APIENTRY glad_instrument_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteQueries(n, ids);
+	GLStatsRecordCall(84, 0, glad_start, 0);
+}
+static PFNGLISQUERYPROC glad_next_glIsQuery;
+static GLboolean APIENTRY glad_instrument_glIsQuery(GLuint id) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsQuery(id);
+	GLStatsRecordCall(85, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLBEGINQUERYPROC glad_next_glBeginQuery;
+static void APIENTRY glad_instrument_glBeginQuery(GLenum target, GLuint id) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBeginQuery(target, id);
+	GLStatsRecordCall(86, 0, glad_start, 0);
+}
+static PFNGLENDQUERYPROC glad_next_glEndQuery;
+static void APIENTRY glad_instrument_glEndQuery(GLenum target) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glEndQuery(target);
+	GLStatsRecordCall(87, 0, glad_start, 0);
+}
+static PFNGLGETQUERYIVPROC glad_next_glGetQueryiv;
+static void APIENTRY glad_instrument_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryiv(target, pname, params);
+	GLStatsRecordCall(88, 0, glad_start, 0);
+}
+static PFNGLGETQUERYOBJECTIVPROC glad_next_glGetQueryObjectiv;
+static void APIENTRY glad_instrument_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryObjectiv(id, pname, params);
+	GLStatsRecordCall(89, 0, glad_start, 0);
+}
+static PFNGLGETQUERYOBJECTUIVPROC glad_next_glGetQueryObjectuiv;
+static void APIENTRY glad_instrument_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryObjectuiv(id, pname, params);
+	GLStatsRecordCall(90, 0, glad_start, 0);
+}
+static PFNGLBINDBUFFERPROC glad_next_glBindBuffer;
+static void APIENTRY glad_instrument_glBindBuffer(GLenum target, GLuint buffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindBuffer(target, buffer);
+	GLStatsRecordCall(91, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDELETEBUFFERSPROC glad_next_glDeleteBuffers;
+static void APIENTRY glad_instrument_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteBuffers(n, buffers);
+	GLStatsRecordCall(92, 0, glad_start, 0);
+}
+static PFNGLGENBUFFERSPROC glad_next_glGenBuffers;
+static void APIENTRY glad_instrument_glGenBuffers(GLsizei n, GLuint *buffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenBuffers(n, buffers);
+	GLStatsRecordCall(93, 0, glad_start, 0);
+}
+static PFNGLISBUFFERPROC glad_next_glIsBuffer;
+static GLboolean APIENTRY glad_instrument_glIsBuffer(GLuint buffer) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsBuffer(buffer);
+	GLStatsRecordCall(94, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLBUFFERDATAPROC glad_next_glBufferData;
+static void APIENTRY glad_instrument_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBufferData(target, size, data, usage);
+	GLStatsRecordCall(95, GL_STATS_UPLOAD, glad_start, (u64)size);
+}
+static PFNGLBUFFERSUBDATAPROC glad_next_glBufferSubData;
+static void APIENTRY glad_instrument_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBufferSubData(target, offset, size, data);
+	GLStatsRecordCall(96, GL_STATS_UPLOAD, glad_start, (u64)size);
+}
+static PFNGLGETBUFFERSUBDATAPROC glad_next_glGetBufferSubData;
+static void APIENTRY glad_instrument_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetBufferSubData(target, offset, size, data);
+	GLStatsRecordCall(97, 0, glad_start, 0);
+}
+static PFNGLMAPBUFFERPROC glad_next_glMapBuffer;
+static void * APIENTRY glad_instrument_glMapBuffer(GLenum target, GLenum access) {
+	u64 glad_start = ReadProfileTicks();
+	void * glad_result = glad_next_glMapBuffer(target, access);
+	GLStatsRecordCall(98, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLUNMAPBUFFERPROC glad_next_glUnmapBuffer;
+static GLboolean APIENTRY glad_instrument_glUnmapBuffer(GLenum target) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glUnmapBuffer(target);
+	GLStatsRecordCall(99, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETBUFFERPARAMETERIVPROC glad_next_glGetBufferParameteriv;
+static void APIENTRY glad_instrument_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetBufferParameteriv(target, pname, params);
+	GLStatsRecordCall(100, 0, glad_start, 0);
+}
+static PFNGLGETBUFFERPOINTERVPROC glad_next_glGetBufferPointerv;
+static void APIENTRY glad_instrument_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetBufferPointerv(target, pname, params);
+	GLStatsRecordCall(101, 0, glad_start, 0);
+}
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_next_glBlendEquationSeparate;
+static void APIENTRY glad_instrument_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlendEquationSeparate(modeRGB, modeAlpha);
+	GLStatsRecordCall(102, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDRAWBUFFERSPROC glad_next_glDrawBuffers;
+static void APIENTRY glad_instrument_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawBuffers(n, bufs);
+	GLStatsRecordCall(103, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLSTENCILOPSEPARATEPROC glad_next_glStencilOpSeparate;
+static void APIENTRY glad_instrument_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glStencilOpSeparate(face, sfail, dpfail, dppass);
+	GLStatsRecordCall(104, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSTENCILFUNCSEPARATEPROC glad_next_glStencilFuncSeparate;
+static void APIENTRY glad_instrument_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glStencilFuncSeparate(face, func, ref, mask);
+	GLStatsRecordCall(105, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSTENCILMASKSEPARATEPROC glad_next_glStencilMaskSeparate;
+static void APIENTRY glad_instrument_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glStencilMaskSeparate(face, mask);
+	GLStatsRecordCall(106, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLATTACHSHADERPROC glad_next_glAttachShader;
+static void APIENTRY glad_instrument_glAttachShader(GLuint program, GLuint shader) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glAttachShader(program, shader);
+	GLStatsRecordCall(107, 0, glad_start, 0);
+}
+static PFNGLBINDATTRIBLOCATIONPROC glad_next_glBindAttribLocation;
+static void APIENTRY glad_instrument_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindAttribLocation(program, index, name);
+	GLStatsRecordCall(108, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLCOMPILESHADERPROC glad_next_glCompileShader;
+static void APIENTRY glad_instrument_glCompileShader(GLuint shader) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompileShader(shader);
+	GLStatsRecordCall(109, 0, glad_start, 0);
+}
+static PFNGLCREATEPROGRAMPROC glad_next_glCreateProgram;
+static GLuint APIENTRY glad_instrument_glCreateProgram(void) {
+	u64 glad_start = ReadProfileTicks();
+	GLuint glad_result = glad_next_glCreateProgram();
+	GLStatsRecordCall(110, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLCREATESHADERPROC glad_next_glCreateShader;
+static GLuint APIENTRY glad_instrument_glCreateShader(GLenum type) {
+	u64 glad_start = ReadProfileTicks();
+	GLuint glad_result = glad_next_glCreateShader(type);
+	GLStatsRecordCall(111, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLDELETEPROGRAMPROC glad_next_glDeleteProgram;
+static void APIENTRY glad_instrument_glDeleteProgram(GLuint program) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteProgram(program);
+	GLStatsRecordCall(112, 0, glad_start, 0);
+}
+static PFNGLDELETESHADERPROC glad_next_glDeleteShader;
+static void APIENTRY glad_instrument_glDeleteShader(GLuint shader) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteShader(shader);
+	GLStatsRecordCall(113, 0, glad_start, 0);
+}
+static PFNGLDETACHSHADERPROC glad_next_glDetachShader;
+static void APIENTRY glad_instrument_glDetachShader(GLuint program, GLuint shader) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDetachShader(program, shader);
+	GLStatsRecordCall(114, 0, glad_start, 0);
+}
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_next_glDisableVertexAttribArray;
+static void APIENTRY glad_instrument_glDisableVertexAttribArray(GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDisableVertexAttribArray(index);
+	GLStatsRecordCall(115, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_next_glEnableVertexAttribArray;
+static void APIENTRY glad_instrument_glEnableVertexAttribArray(GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glEnableVertexAttribArray(index);
+	GLStatsRecordCall(116, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLGETACTIVEATTRIBPROC glad_next_glGetActiveAttrib;
+static void APIENTRY glad_instrument_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	GLStatsRecordCall(117, 0, glad_start, 0);
+}
+static PFNGLGETACTIVEUNIFORMPROC glad_next_glGetActiveUniform;
+static void APIENTRY glad_instrument_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	GLStatsRecordCall(118, 0, glad_start, 0);
+}
+static PFNGLGETATTACHEDSHADERSPROC glad_next_glGetAttachedShaders;
+static void APIENTRY glad_instrument_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetAttachedShaders(program, maxCount, count, shaders);
+	GLStatsRecordCall(119, 0, glad_start, 0);
+}
+static PFNGLGETATTRIBLOCATIONPROC glad_next_glGetAttribLocation;
+static GLint APIENTRY glad_instrument_glGetAttribLocation(GLuint program, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	GLint glad_result = glad_next_glGetAttribLocation(program, name);
+	GLStatsRecordCall(120, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETPROGRAMIVPROC glad_next_glGetProgramiv;
+static void APIENTRY glad_instrument_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetProgramiv(program, pname, params);
+	GLStatsRecordCall(121, 0, glad_start, 0);
+}
+static PFNGLGETPROGRAMINFOLOGPROC glad_next_glGetProgramInfoLog;
+static void APIENTRY glad_instrument_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetProgramInfoLog(program, bufSize, length, infoLog);
+	GLStatsRecordCall(122, 0, glad_start, 0);
+}
+static PFNGLGETSHADERIVPROC glad_next_glGetShaderiv;
+static void APIENTRY glad_instrument_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetShaderiv(shader, pname, params);
+	GLStatsRecordCall(123, 0, glad_start, 0);
+}
+static PFNGLGETSHADERINFOLOGPROC glad_next_glGetShaderInfoLog;
+static void APIENTRY glad_instrument_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	GLStatsRecordCall(124, 0, glad_start, 0);
+}
+static PFNGLGETSHADERSOURCEPROC glad_next_glGetShaderSource;
+static void APIENTRY glad_instrument_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetShaderSource(shader, bufSize, length, source);
+	GLStatsRecordCall(125, 0, glad_start, 0);
+}
+static PFNGLGETUNIFORMLOCATIONPROC glad_next_glGetUniformLocation;
+static GLint APIENTRY glad_instrument_glGetUniformLocation(GLuint program, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	GLint glad_result = glad_next_glGetUniformLocation(program, name);
+	GLStatsRecordCall(126, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETUNIFORMFVPROC glad_next_glGetUniformfv;
+static void APIENTRY glad_instrument_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetUniformfv(program, location, params);
+	GLStatsRecordCall(127, 0, glad_start, 0);
+}
+static PFNGLGETUNIFORMIVPROC glad_next_glGetUniformiv;
+static void APIENTRY glad_instrument_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetUniformiv(program, location, params);
+	GLStatsRecordCall(128, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXATTRIBDVPROC glad_next_glGetVertexAttribdv;
+static void APIENTRY glad_instrument_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexAttribdv(index, pname, params);
+	GLStatsRecordCall(129, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXATTRIBFVPROC glad_next_glGetVertexAttribfv;
+static void APIENTRY glad_instrument_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexAttribfv(index, pname, params);
+	GLStatsRecordCall(130, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXATTRIBIVPROC glad_next_glGetVertexAttribiv;
+static void APIENTRY glad_instrument_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexAttribiv(index, pname, params);
+	GLStatsRecordCall(131, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_next_glGetVertexAttribPointerv;
+static void APIENTRY glad_instrument_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexAttribPointerv(index, pname, pointer);
+	GLStatsRecordCall(132, 0, glad_start, 0);
+}
+static PFNGLISPROGRAMPROC glad_next_glIsProgram;
+static GLboolean APIENTRY glad_instrument_glIsProgram(GLuint program) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsProgram(program);
+	GLStatsRecordCall(133, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLISSHADERPROC glad_next_glIsShader;
+static GLboolean APIENTRY glad_instrument_glIsShader(GLuint shader) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsShader(shader);
+	GLStatsRecordCall(134, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLLINKPROGRAMPROC glad_next_glLinkProgram;
+static void APIENTRY glad_instrument_glLinkProgram(GLuint program) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glLinkProgram(program);
+	GLStatsRecordCall(135, 0, glad_start, 0);
+}
+static PFNGLSHADERSOURCEPROC glad_next_glShaderSource;
+static void APIENTRY glad_instrument_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glShaderSource(shader, count, string, length);
+	GLStatsRecordCall(136, 0, glad_start, 0);
+}
+static PFNGLUSEPROGRAMPROC glad_next_glUseProgram;
+static void APIENTRY glad_instrument_glUseProgram(GLuint program) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUseProgram(program);
+	GLStatsRecordCall(137, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLUNIFORM1FPROC glad_next_glUniform1f;
+static void APIENTRY glad_instrument_glUniform1f(GLint location, GLfloat v0) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform1f(location, v0);
+	GLStatsRecordCall(138, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM2FPROC glad_next_glUniform2f;
+static void APIENTRY glad_instrument_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform2f(location, v0, v1);
+	GLStatsRecordCall(139, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM3FPROC glad_next_glUniform3f;
+static void APIENTRY glad_instrument_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform3f(location, v0, v1, v2);
+	GLStatsRecordCall(140, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM4FPROC glad_next_glUniform4f;
+static void APIENTRY glad_instrument_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform4f(location, v0, v1, v2, v3);
+	GLStatsRecordCall(141, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM1IPROC glad_next_glUniform1i;
+static void APIENTRY glad_instrument_glUniform1i(GLint location, GLint v0) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform1i(location, v0);
+	GLStatsRecordCall(142, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM2IPROC glad_next_glUniform2i;
+static void APIENTRY glad_instrument_glUniform2i(GLint location, GLint v0, GLint v1) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform2i(location, v0, v1);
+	GLStatsRecordCall(143, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM3IPROC glad_next_glUniform3i;
+static void APIENTRY glad_instrument_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform3i(location, v0, v1, v2);
+	GLStatsRecordCall(144, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM4IPROC glad_next_glUniform4i;
+static void APIENTRY glad_instrument_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform4i(location, v0, v1, v2, v3);
+	GLStatsRecordCall(145, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM1FVPROC glad_next_glUniform1fv;
+static void APIENTRY glad_instrument_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform1fv(location, count, value);
+	GLStatsRecordCall(146, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM2FVPROC glad_next_glUniform2fv;
+static void APIENTRY glad_instrument_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform2fv(location, count, value);
+	GLStatsRecordCall(147, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM3FVPROC glad_next_glUniform3fv;
+static void APIENTRY glad_instrument_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform3fv(location, count, value);
+	GLStatsRecordCall(148, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM4FVPROC glad_next_glUniform4fv;
+static void APIENTRY glad_instrument_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform4fv(location, count, value);
+	GLStatsRecordCall(149, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM1IVPROC glad_next_glUniform1iv;
+static void APIENTRY glad_instrument_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform1iv(location, count, value);
+	GLStatsRecordCall(150, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM2IVPROC glad_next_glUniform2iv;
+static void APIENTRY glad_instrument_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform2iv(location, count, value);
+	GLStatsRecordCall(151, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM3IVPROC glad_next_glUniform3iv;
+static void APIENTRY glad_instrument_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform3iv(location, count, value);
+	GLStatsRecordCall(152, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM4IVPROC glad_next_glUniform4iv;
+static void APIENTRY glad_instrument_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform4iv(location, count, value);
+	GLStatsRecordCall(153, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX2FVPROC glad_next_glUniformMatrix2fv;
+static void APIENTRY glad_instrument_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix2fv(location, count, transpose, value);
+	GLStatsRecordCall(154, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX3FVPROC glad_next_glUniformMatrix3fv;
+static void APIENTRY glad_instrument_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix3fv(location, count, transpose, value);
+	GLStatsRecordCall(155, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX4FVPROC glad_next_glUniformMatrix4fv;
+static void APIENTRY glad_instrument_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix4fv(location, count, transpose, value);
+	GLStatsRecordCall(156, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLVALIDATEPROGRAMPROC glad_next_glValidateProgram;
+static void APIENTRY glad_instrument_glValidateProgram(GLuint program) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glValidateProgram(program);
+	GLStatsRecordCall(157, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB1DPROC glad_next_glVertexAttrib1d;
+static void APIENTRY glad_instrument_glVertexAttrib1d(GLuint index, GLdouble x) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib1d(index, x);
+	GLStatsRecordCall(158, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB1DVPROC glad_next_glVertexAttrib1dv;
+static void APIENTRY glad_instrument_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib1dv(index, v);
+	GLStatsRecordCall(159, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB1FPROC glad_next_glVertexAttrib1f;
+static void APIENTRY glad_instrument_glVertexAttrib1f(GLuint index, GLfloat x) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib1f(index, x);
+	GLStatsRecordCall(160, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB1FVPROC glad_next_glVertexAttrib1fv;
+static void APIENTRY glad_instrument_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib1fv(index, v);
+	GLStatsRecordCall(161, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB1SPROC glad_next_glVertexAttrib1s;
+static void APIENTRY glad_instrument_glVertexAttrib1s(GLuint index, GLshort x) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib1s(index, x);
+	GLStatsRecordCall(162, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB1SVPROC glad_next_glVertexAttrib1sv;
+static void APIENTRY glad_instrument_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib1sv(index, v);
+	GLStatsRecordCall(163, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB2DPROC glad_next_glVertexAttrib2d;
+static void APIENTRY glad_instrument_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib2d(index, x, y);
+	GLStatsRecordCall(164, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB2DVPROC glad_next_glVertexAttrib2dv;
+static void APIENTRY glad_instrument_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib2dv(index, v);
+	GLStatsRecordCall(165, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB2FPROC glad_next_glVertexAttrib2f;
+static void APIENTRY glad_instrument_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib2f(index, x, y);
+	GLStatsRecordCall(166, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB2FVPROC glad_next_glVertexAttrib2fv;
+static void APIENTRY glad_instrument_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib2fv(index, v);
+	GLStatsRecordCall(167, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB2SPROC glad_next_glVertexAttrib2s;
+static void APIENTRY glad_instrument_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib2s(index, x, y);
+	GLStatsRecordCall(168, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB2SVPROC glad_next_glVertexAttrib2sv;
+static void APIENTRY glad_instrument_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib2sv(index, v);
+	GLStatsRecordCall(169, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB3DPROC glad_next_glVertexAttrib3d;
+static void APIENTRY glad_instrument_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib3d(index, x, y, z);
+	GLStatsRecordCall(170, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB3DVPROC glad_next_glVertexAttrib3dv;
+static void APIENTRY glad_instrument_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib3dv(index, v);
+	GLStatsRecordCall(171, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB3FPROC glad_next_glVertexAttrib3f;
+static void APIENTRY glad_instrument_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib3f(index, x, y, z);
+	GLStatsRecordCall(172, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB3FVPROC glad_next_glVertexAttrib3fv;
+static void APIENTRY glad_instrument_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib3fv(index, v);
+	GLStatsRecordCall(173, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB3SPROC glad_next_glVertexAttrib3s;
+static void APIENTRY glad_instrument_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib3s(index, x, y, z);
+	GLStatsRecordCall(174, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB3SVPROC glad_next_glVertexAttrib3sv;
+static void APIENTRY glad_instrument_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib3sv(index, v);
+	GLStatsRecordCall(175, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4NBVPROC glad_next_glVertexAttrib4Nbv;
+static void APIENTRY glad_instrument_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4Nbv(index, v);
+	GLStatsRecordCall(176, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4NIVPROC glad_next_glVertexAttrib4Niv;
+static void APIENTRY glad_instrument_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4Niv(index, v);
+	GLStatsRecordCall(177, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4NSVPROC glad_next_glVertexAttrib4Nsv;
+static void APIENTRY glad_instrument_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4Nsv(index, v);
+	GLStatsRecordCall(178, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4NUBPROC glad_next_glVertexAttrib4Nub;
+static void APIENTRY glad_instrument_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4Nub(index, x, y, z, w);
+	GLStatsRecordCall(179, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4NUBVPROC glad_next_glVertexAttrib4Nubv;
+static void APIENTRY glad_instrument_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4Nubv(index, v);
+	GLStatsRecordCall(180, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4NUIVPROC glad_next_glVertexAttrib4Nuiv;
+static void APIENTRY glad_instrument_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4Nuiv(index, v);
+	GLStatsRecordCall(181, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4NUSVPROC glad_next_glVertexAttrib4Nusv;
+static void APIENTRY glad_instrument_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4Nusv(index, v);
+	GLStatsRecordCall(182, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4BVPROC glad_next_glVertexAttrib4bv;
+static void APIENTRY glad_instrument_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4bv(index, v);
+	GLStatsRecordCall(183, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4DPROC glad_next_glVertexAttrib4d;
+static void APIENTRY glad_instrument_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4d(index, x, y, z, w);
+	GLStatsRecordCall(184, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4DVPROC glad_next_glVertexAttrib4dv;
+static void APIENTRY glad_instrument_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4dv(index, v);
+	GLStatsRecordCall(185, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4FPROC glad_next_glVertexAttrib4f;
+static void APIENTRY glad_instrument_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4f(index, x, y, z, w);
+	GLStatsRecordCall(186, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4FVPROC glad_next_glVertexAttrib4fv;
+static void APIENTRY glad_instrument_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4fv(index, v);
+	GLStatsRecordCall(187, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4IVPROC glad_next_glVertexAttrib4iv;
+static void APIENTRY glad_instrument_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4iv(index, v);
+	GLStatsRecordCall(188, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4SPROC glad_next_glVertexAttrib4s;
+static void APIENTRY glad_instrument_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4s(index, x, y, z, w);
+	GLStatsRecordCall(189, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4SVPROC glad_next_glVertexAttrib4sv;
+static void APIENTRY glad_instrument_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4sv(index, v);
+	GLStatsRecordCall(190, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4UBVPROC glad_next_glVertexAttrib4ubv;
+static void APIENTRY glad_instrument_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4ubv(index, v);
+	GLStatsRecordCall(191, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4UIVPROC glad_next_glVertexAttrib4uiv;
+static void APIENTRY glad_instrument_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4uiv(index, v);
+	GLStatsRecordCall(192, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIB4USVPROC glad_next_glVertexAttrib4usv;
+static void APIENTRY glad_instrument_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttrib4usv(index, v);
+	GLStatsRecordCall(193, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBPOINTERPROC glad_next_glVertexAttribPointer;
+static void APIENTRY glad_instrument_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	GLStatsRecordCall(194, 0, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_next_glUniformMatrix2x3fv;
+static void APIENTRY glad_instrument_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix2x3fv(location, count, transpose, value);
+	GLStatsRecordCall(195, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_next_glUniformMatrix3x2fv;
+static void APIENTRY glad_instrument_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix3x2fv(location, count, transpose, value);
+	GLStatsRecordCall(196, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_next_glUniformMatrix2x4fv;
+static void APIENTRY glad_instrument_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix2x4fv(location, count, transpose, value);
+	GLStatsRecordCall(197, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_next_glUniformMatrix4x2fv;
+static void APIENTRY glad_instrument_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix4x2fv(location, count, transpose, value);
+	GLStatsRecordCall(198, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_next_glUniformMatrix3x4fv;
+static void APIENTRY glad_instrument_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix3x4fv(location, count, transpose, value);
+	GLStatsRecordCall(199, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_next_glUniformMatrix4x3fv;
+static void APIENTRY glad_instrument_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix4x3fv(location, count, transpose, value);
+	GLStatsRecordCall(200, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLCOLORMASKIPROC glad_next_glColorMaski;
+static void APIENTRY glad_instrument_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glColorMaski(index, r, g, b, a);
+	GLStatsRecordCall(201, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLGETBOOLEANI_VPROC glad_next_glGetBooleani_v;
+static void APIENTRY glad_instrument_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetBooleani_v(target, index, data);
+	GLStatsRecordCall(202, 0, glad_start, 0);
+}
+static PFNGLGETINTEGERI_VPROC glad_next_glGetIntegeri_v;
+static void APIENTRY glad_instrument_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetIntegeri_v(target, index, data);
+	GLStatsRecordCall(203, 0, glad_start, 0);
+}
+static PFNGLENABLEIPROC glad_next_glEnablei;
+static void APIENTRY glad_instrument_glEnablei(GLenum target, GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glEnablei(target, index);
+	GLStatsRecordCall(204, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDISABLEIPROC glad_next_glDisablei;
+static void APIENTRY glad_instrument_glDisablei(GLenum target, GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDisablei(target, index);
+	GLStatsRecordCall(205, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLISENABLEDIPROC glad_next_glIsEnabledi;
+static GLboolean APIENTRY glad_instrument_glIsEnabledi(GLenum target, GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsEnabledi(target, index);
+	GLStatsRecordCall(206, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_next_glBeginTransformFeedback;
+static void APIENTRY glad_instrument_glBeginTransformFeedback(GLenum primitiveMode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBeginTransformFeedback(primitiveMode);
+	GLStatsRecordCall(207, 0, glad_start, 0);
+}
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_next_glEndTransformFeedback;
+static void APIENTRY glad_instrument_glEndTransformFeedback(void) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glEndTransformFeedback();
+	GLStatsRecordCall(208, 0, glad_start, 0);
+}
+static PFNGLBINDBUFFERRANGEPROC glad_next_glBindBufferRange;
+static void APIENTRY glad_instrument_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindBufferRange(target, index, buffer, offset, size);
+	GLStatsRecordCall(209, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBINDBUFFERBASEPROC glad_next_glBindBufferBase;
+static void APIENTRY glad_instrument_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindBufferBase(target, index, buffer);
+	GLStatsRecordCall(210, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_next_glTransformFeedbackVaryings;
+static void APIENTRY glad_instrument_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	GLStatsRecordCall(211, 0, glad_start, 0);
+}
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_next_glGetTransformFeedbackVarying;
+static void APIENTRY glad_instrument_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	GLStatsRecordCall(212, 0, glad_start, 0);
+}
+static PFNGLCLAMPCOLORPROC glad_next_glClampColor;
+static void APIENTRY glad_instrument_glClampColor(GLenum target, GLenum clamp) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClampColor(target, clamp);
+	GLStatsRecordCall(213, 0, glad_start, 0);
+}
+static PFNGLBEGINCONDITIONALRENDERPROC glad_next_glBeginConditionalRender;
+static void APIENTRY glad_instrument_glBeginConditionalRender(GLuint id, GLenum mode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBeginConditionalRender(id, mode);
+	GLStatsRecordCall(214, 0, glad_start, 0);
+}
+static PFNGLENDCONDITIONALRENDERPROC glad_next_glEndConditionalRender;
+static void APIENTRY glad_instrument_glEndConditionalRender(void) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glEndConditionalRender();
+	GLStatsRecordCall(215, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_next_glVertexAttribIPointer;
+static void APIENTRY glad_instrument_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribIPointer(index, size, type, stride, pointer);
+	GLStatsRecordCall(216, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXATTRIBIIVPROC glad_next_glGetVertexAttribIiv;
+static void APIENTRY glad_instrument_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexAttribIiv(index, pname, params);
+	GLStatsRecordCall(217, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXATTRIBIUIVPROC glad_next_glGetVertexAttribIuiv;
+static void APIENTRY glad_instrument_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexAttribIuiv(index, pname, params);
+	GLStatsRecordCall(218, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI1IPROC glad_next_glVertexAttribI1i;
+static void APIENTRY glad_instrument_glVertexAttribI1i(GLuint index, GLint x) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI1i(index, x);
+	GLStatsRecordCall(219, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI2IPROC glad_next_glVertexAttribI2i;
+static void APIENTRY glad_instrument_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI2i(index, x, y);
+	GLStatsRecordCall(220, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI3IPROC glad_next_glVertexAttribI3i;
+static void APIENTRY glad_instrument_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI3i(index, x, y, z);
+	GLStatsRecordCall(221, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI4IPROC glad_next_glVertexAttribI4i;
+static void APIENTRY glad_instrument_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI4i(index, x, y, z, w);
+	GLStatsRecordCall(222, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI1UIPROC glad_next_glVertexAttribI1ui;
+static void APIENTRY glad_instrument_glVertexAttribI1ui(GLuint index, GLuint x) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI1ui(index, x);
+	GLStatsRecordCall(223, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI2UIPROC glad_next_glVertexAttribI2ui;
+static void APIENTRY glad_instrument_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI2ui(index, x, y);
+	GLStatsRecordCall(224, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI3UIPROC glad_next_glVertexAttribI3ui;
+static void APIENTRY glad_instrument_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI3ui(index, x, y, z);
+	GLStatsRecordCall(225, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI4UIPROC glad_next_glVertexAttribI4ui;
+static void APIENTRY glad_instrument_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI4ui(index, x, y, z, w);
+	GLStatsRecordCall(226, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI1IVPROC glad_next_glVertexAttribI1iv;
+static void APIENTRY glad_instrument_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI1iv(index, v);
+	GLStatsRecordCall(227, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI2IVPROC glad_next_glVertexAttribI2iv;
+static void APIENTRY glad_instrument_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI2iv(index, v);
+	GLStatsRecordCall(228, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI3IVPROC glad_next_glVertexAttribI3iv;
+static void APIENTRY glad_instrument_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI3iv(index, v);
+	GLStatsRecordCall(229, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI4IVPROC glad_next_glVertexAttribI4iv;
+static void APIENTRY glad_instrument_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI4iv(index, v);
+	GLStatsRecordCall(230, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI1UIVPROC glad_next_glVertexAttribI1uiv;
+static void APIENTRY glad_instrument_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI1uiv(index, v);
+	GLStatsRecordCall(231, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI2UIVPROC glad_next_glVertexAttribI2uiv;
+static void APIENTRY glad_instrument_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI2uiv(index, v);
+	GLStatsRecordCall(232, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI3UIVPROC glad_next_glVertexAttribI3uiv;
+static void APIENTRY glad_instrument_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI3uiv(index, v);
+	GLStatsRecordCall(233, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI4UIVPROC glad_next_glVertexAttribI4uiv;
+static void APIENTRY glad_instrument_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI4uiv(index, v);
+	GLStatsRecordCall(234, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI4BVPROC glad_next_glVertexAttribI4bv;
+static void APIENTRY glad_instrument_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI4bv(index, v);
+	GLStatsRecordCall(235, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI4SVPROC glad_next_glVertexAttribI4sv;
+static void APIENTRY glad_instrument_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI4sv(index, v);
+	GLStatsRecordCall(236, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI4UBVPROC glad_next_glVertexAttribI4ubv;
+static void APIENTRY glad_instrument_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI4ubv(index, v);
+	GLStatsRecordCall(237, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBI4USVPROC glad_next_glVertexAttribI4usv;
+static void APIENTRY glad_instrument_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribI4usv(index, v);
+	GLStatsRecordCall(238, 0, glad_start, 0);
+}
+static PFNGLGETUNIFORMUIVPROC glad_next_glGetUniformuiv;
+static void APIENTRY glad_instrument_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetUniformuiv(program, location, params);
+	GLStatsRecordCall(239, 0, glad_start, 0);
+}
+static PFNGLBINDFRAGDATALOCATIONPROC glad_next_glBindFragDataLocation;
+static void APIENTRY glad_instrument_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindFragDataLocation(program, color, name);
+	GLStatsRecordCall(240, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLGETFRAGDATALOCATIONPROC glad_next_glGetFragDataLocation;
+static GLint APIENTRY glad_instrument_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	GLint glad_result = glad_next_glGetFragDataLocation(program, name);
+	GLStatsRecordCall(241, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLUNIFORM1UIPROC glad_next_glUniform1ui;
+static void APIENTRY glad_instrument_glUniform1ui(GLint location, GLuint v0) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform1ui(location, v0);
+	GLStatsRecordCall(242, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM2UIPROC glad_next_glUniform2ui;
+static void APIENTRY glad_instrument_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform2ui(location, v0, v1);
+	GLStatsRecordCall(243, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM3UIPROC glad_next_glUniform3ui;
+static void APIENTRY glad_instrument_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform3ui(location, v0, v1, v2);
+	GLStatsRecordCall(244, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM4UIPROC glad_next_glUniform4ui;
+static void APIENTRY glad_instrument_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform4ui(location, v0, v1, v2, v3);
+	GLStatsRecordCall(245, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM1UIVPROC glad_next_glUniform1uiv;
+static void APIENTRY glad_instrument_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform1uiv(location, count, value);
+	GLStatsRecordCall(246, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM2UIVPROC glad_next_glUniform2uiv;
+static void APIENTRY glad_instrument_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform2uiv(location, count, value);
+	GLStatsRecordCall(247, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM3UIVPROC glad_next_glUniform3uiv;
+static void APIENTRY glad_instrument_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform3uiv(location, count, value);
+	GLStatsRecordCall(248, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM4UIVPROC glad_next_glUniform4uiv;
+static void APIENTRY glad_instrument_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform4uiv(location, count, value);
+	GLStatsRecordCall(249, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLTEXPARAMETERIIVPROC glad_next_glTexParameterIiv;
+static void APIENTRY glad_instrument_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexParameterIiv(target, pname, params);
+	GLStatsRecordCall(250, 0, glad_start, 0);
+}
+static PFNGLTEXPARAMETERIUIVPROC glad_next_glTexParameterIuiv;
+static void APIENTRY glad_instrument_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexParameterIuiv(target, pname, params);
+	GLStatsRecordCall(251, 0, glad_start, 0);
+}
+static PFNGLGETTEXPARAMETERIIVPROC glad_next_glGetTexParameterIiv;
+static void APIENTRY glad_instrument_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTexParameterIiv(target, pname, params);
+	GLStatsRecordCall(252, 0, glad_start, 0);
+}
+static PFNGLGETTEXPARAMETERIUIVPROC glad_next_glGetTexParameterIuiv;
+static void APIENTRY glad_instrument_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTexParameterIuiv(target, pname, params);
+	GLStatsRecordCall(253, 0, glad_start, 0);
+}
+static PFNGLCLEARBUFFERIVPROC glad_next_glClearBufferiv;
+static void APIENTRY glad_instrument_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearBufferiv(buffer, drawbuffer, value);
+	GLStatsRecordCall(254, 0, glad_start, 0);
+}
+static PFNGLCLEARBUFFERUIVPROC glad_next_glClearBufferuiv;
+static void APIENTRY glad_instrument_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearBufferuiv(buffer, drawbuffer, value);
+	GLStatsRecordCall(255, 0, glad_start, 0);
+}
+static PFNGLCLEARBUFFERFVPROC glad_next_glClearBufferfv;
+static void APIENTRY glad_instrument_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearBufferfv(buffer, drawbuffer, value);
+	GLStatsRecordCall(256, 0, glad_start, 0);
+}
+static PFNGLCLEARBUFFERFIPROC glad_next_glClearBufferfi;
+static void APIENTRY glad_instrument_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	GLStatsRecordCall(257, 0, glad_start, 0);
+}
+static PFNGLGETSTRINGIPROC glad_next_glGetStringi;
+static const GLubyte * APIENTRY glad_instrument_glGetStringi(GLenum name, GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	const GLubyte * glad_result = glad_next_glGetStringi(name, index);
+	GLStatsRecordCall(258, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLISRENDERBUFFERPROC glad_next_glIsRenderbuffer;
+static GLboolean APIENTRY glad_instrument_glIsRenderbuffer(GLuint renderbuffer) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsRenderbuffer(renderbuffer);
+	GLStatsRecordCall(259, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLBINDRENDERBUFFERPROC glad_next_glBindRenderbuffer;
+static void APIENTRY glad_instrument_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindRenderbuffer(target, renderbuffer);
+	GLStatsRecordCall(260, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDELETERENDERBUFFERSPROC glad_next_glDeleteRenderbuffers;
+static void APIENTRY glad_instrument_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteRenderbuffers(n, renderbuffers);
+	GLStatsRecordCall(261, 0, glad_start, 0);
+}
+static PFNGLGENRENDERBUFFERSPROC glad_next_glGenRenderbuffers;
+static void APIENTRY glad_instrument_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenRenderbuffers(n, renderbuffers);
+	GLStatsRecordCall(262, 0, glad_start, 0);
+}
+static PFNGLRENDERBUFFERSTORAGEPROC glad_next_glRenderbufferStorage;
+static void APIENTRY glad_instrument_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glRenderbufferStorage(target, internalformat, width, height);
+	GLStatsRecordCall(263, 0, glad_start, 0);
+}
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_next_glGetRenderbufferParameteriv;
+static void APIENTRY glad_instrument_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetRenderbufferParameteriv(target, pname, params);
+	GLStatsRecordCall(264, 0, glad_start, 0);
+}
+static PFNGLISFRAMEBUFFERPROC glad_next_glIsFramebuffer;
+static GLboolean APIENTRY glad_instrument_glIsFramebuffer(GLuint framebuffer) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsFramebuffer(framebuffer);
+	GLStatsRecordCall(265, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLBINDFRAMEBUFFERPROC glad_next_glBindFramebuffer;
+static void APIENTRY glad_instrument_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindFramebuffer(target, framebuffer);
+	GLStatsRecordCall(266, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDELETEFRAMEBUFFERSPROC glad_next_glDeleteFramebuffers;
+static void APIENTRY glad_instrument_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteFramebuffers(n, framebuffers);
+	GLStatsRecordCall(267, 0, glad_start, 0);
+}
+static PFNGLGENFRAMEBUFFERSPROC glad_next_glGenFramebuffers;
+static void APIENTRY glad_instrument_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenFramebuffers(n, framebuffers);
+	GLStatsRecordCall(268, 0, glad_start, 0);
+}
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_next_glCheckFramebufferStatus;
+static GLenum APIENTRY glad_instrument_glCheckFramebufferStatus(GLenum target) {
+	u64 glad_start = ReadProfileTicks();
+	GLenum glad_result = glad_next_glCheckFramebufferStatus(target);
+	GLStatsRecordCall(269, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_next_glFramebufferTexture1D;
+static void APIENTRY glad_instrument_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	GLStatsRecordCall(270, 0, glad_start, 0);
+}
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_next_glFramebufferTexture2D;
+static void APIENTRY glad_instrument_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	GLStatsRecordCall(271, 0, glad_start, 0);
+}
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_next_glFramebufferTexture3D;
+static void APIENTRY glad_instrument_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	GLStatsRecordCall(272, 0, glad_start, 0);
+}
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_next_glFramebufferRenderbuffer;
+static void APIENTRY glad_instrument_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	GLStatsRecordCall(273, 0, glad_start, 0);
+}
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_next_glGetFramebufferAttachmentParameteriv;
+static void APIENTRY glad_instrument_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	GLStatsRecordCall(274, 0, glad_start, 0);
+}
+static PFNGLGENERATEMIPMAPPROC glad_next_glGenerateMipmap;
+static void APIENTRY glad_instrument_glGenerateMipmap(GLenum target) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenerateMipmap(target);
+	GLStatsRecordCall(275, 0, glad_start, 0);
+}
+static PFNGLBLITFRAMEBUFFERPROC glad_next_glBlitFramebuffer;
+static void APIENTRY glad_instrument_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	GLStatsRecordCall(276, 0, glad_start, 0);
+}
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_next_glRenderbufferStorageMultisample;
+static void APIENTRY glad_instrument_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	GLStatsRecordCall(277, 0, glad_start, 0);
+}
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_next_glFramebufferTextureLayer;
+static void APIENTRY glad_instrument_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	GLStatsRecordCall(278, 0, glad_start, 0);
+}
+static PFNGLMAPBUFFERRANGEPROC glad_next_glMapBufferRange;
+static void * APIENTRY glad_instrument_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	u64 glad_start = ReadProfileTicks();
+	void * glad_result = glad_next_glMapBufferRange(target, offset, length, access);
+	GLStatsRecordCall(279, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_next_glFlushMappedBufferRange;
+static void APIENTRY glad_instrument_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFlushMappedBufferRange(target, offset, length);
+	GLStatsRecordCall(280, 0, glad_start, 0);
+}
+static PFNGLBINDVERTEXARRAYPROC glad_next_glBindVertexArray;
+static void APIENTRY glad_instrument_glBindVertexArray(GLuint array) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindVertexArray(array);
+	GLStatsRecordCall(281, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDELETEVERTEXARRAYSPROC glad_next_glDeleteVertexArrays;
+static void APIENTRY glad_instrument_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteVertexArrays(n, arrays);
+	GLStatsRecordCall(282, 0, glad_start, 0);
+}
+static PFNGLGENVERTEXARRAYSPROC glad_next_glGenVertexArrays;
+static void APIENTRY glad_instrument_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenVertexArrays(n, arrays);
+	GLStatsRecordCall(283, 0, glad_start, 0);
+}
+static PFNGLISVERTEXARRAYPROC glad_next_glIsVertexArray;
+static GLboolean APIENTRY glad_instrument_glIsVertexArray(GLuint array) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsVertexArray(array);
+	GLStatsRecordCall(284, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_next_glDrawArraysInstanced;
+static void APIENTRY glad_instrument_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawArraysInstanced(mode, first, count, instancecount);
+	GLStatsRecordCall(285, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_next_glDrawElementsInstanced;
+static void APIENTRY glad_instrument_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	GLStatsRecordCall(286, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLTEXBUFFERPROC glad_next_glTexBuffer;
+static void APIENTRY glad_instrument_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexBuffer(target, internalformat, buffer);
+	GLStatsRecordCall(287, 0, glad_start, 0);
+}
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_next_glPrimitiveRestartIndex;
+static void APIENTRY glad_instrument_glPrimitiveRestartIndex(GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPrimitiveRestartIndex(index);
+	GLStatsRecordCall(288, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLCOPYBUFFERSUBDATAPROC glad_next_glCopyBufferSubData;
+static void APIENTRY glad_instrument_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	GLStatsRecordCall(289, 0, glad_start, 0);
+}
+static PFNGLGETUNIFORMINDICESPROC glad_next_glGetUniformIndices;
+static void APIENTRY glad_instrument_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	GLStatsRecordCall(290, 0, glad_start, 0);
+}
+static PFNGLGETACTIVEUNIFORMSIVPROC glad_next_glGetActiveUniformsiv;
+static void APIENTRY glad_instrument_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	GLStatsRecordCall(291, 0, glad_start, 0);
+}
+static PFNGLGETACTIVEUNIFORMNAMEPROC glad_next_glGetActiveUniformName;
+static void APIENTRY glad_instrument_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	GLStatsRecordCall(292, 0, glad_start, 0);
+}
+static PFNGLGETUNIFORMBLOCKINDEXPROC glad_next_glGetUniformBlockIndex;
+static GLuint APIENTRY glad_instrument_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	u64 glad_start = ReadProfileTicks();
+	GLuint glad_result = glad_next_glGetUniformBlockIndex(program, uniformBlockName);
+	GLStatsRecordCall(293, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_next_glGetActiveUniformBlockiv;
+static void APIENTRY glad_instrument_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	GLStatsRecordCall(294, 0, glad_start, 0);
+}
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_next_glGetActiveUniformBlockName;
+static void APIENTRY glad_instrument_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	GLStatsRecordCall(295, 0, glad_start, 0);
+}
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_next_glUniformBlockBinding;
+static void APIENTRY glad_instrument_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	GLStatsRecordCall(296, 0, glad_start, 0);
+}
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_next_glDrawElementsBaseVertex;
+static void APIENTRY glad_instrument_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	GLStatsRecordCall(297, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_next_glDrawRangeElementsBaseVertex;
+static void APIENTRY glad_instrument_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	GLStatsRecordCall(298, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_next_glDrawElementsInstancedBaseVertex;
+static void APIENTRY glad_instrument_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	GLStatsRecordCall(299, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_next_glMultiDrawElementsBaseVertex;
+static void APIENTRY glad_instrument_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	GLStatsRecordCall(300, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLPROVOKINGVERTEXPROC glad_next_glProvokingVertex;
+static void APIENTRY glad_instrument_glProvokingVertex(GLenum mode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProvokingVertex(mode);
+	GLStatsRecordCall(301, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLFENCESYNCPROC glad_next_glFenceSync;
+static GLsync APIENTRY glad_instrument_glFenceSync(GLenum condition, GLbitfield flags) {
+	u64 glad_start = ReadProfileTicks();
+	GLsync glad_result = glad_next_glFenceSync(condition, flags);
+	GLStatsRecordCall(302, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLISSYNCPROC glad_next_glIsSync;
+static GLboolean APIENTRY glad_instrument_glIsSync(GLsync sync) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsSync(sync);
+	GLStatsRecordCall(303, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLDELETESYNCPROC glad_next_glDeleteSync;
+static void APIENTRY glad_instrument_glDeleteSync(GLsync sync) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteSync(sync);
+	GLStatsRecordCall(304, 0, glad_start, 0);
+}
+static PFNGLCLIENTWAITSYNCPROC glad_next_glClientWaitSync;
+static GLenum APIENTRY glad_instrument_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	u64 glad_start = ReadProfileTicks();
+	GLenum glad_result = glad_next_glClientWaitSync(sync, flags, timeout);
+	GLStatsRecordCall(305, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLWAITSYNCPROC glad_next_glWaitSync;
+static void APIENTRY glad_instrument_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glWaitSync(sync, flags, timeout);
+	GLStatsRecordCall(306, 0, glad_start, 0);
+}
+static PFNGLGETINTEGER64VPROC glad_next_glGetInteger64v;
+static void APIENTRY glad_instrument_glGetInteger64v(GLenum pname, GLint64 *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetInteger64v(pname, data);
+	GLStatsRecordCall(307, 0, glad_start, 0);
+}
+static PFNGLGETSYNCIVPROC glad_next_glGetSynciv;
+static void APIENTRY glad_instrument_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetSynciv(sync, pname, bufSize, length, values);
+	GLStatsRecordCall(308, 0, glad_start, 0);
+}
+static PFNGLGETINTEGER64I_VPROC glad_next_glGetInteger64i_v;
+static void APIENTRY glad_instrument_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetInteger64i_v(target, index, data);
+	GLStatsRecordCall(309, 0, glad_start, 0);
+}
+static PFNGLGETBUFFERPARAMETERI64VPROC glad_next_glGetBufferParameteri64v;
+static void APIENTRY glad_instrument_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetBufferParameteri64v(target, pname, params);
+	GLStatsRecordCall(310, 0, glad_start, 0);
+}
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_next_glFramebufferTexture;
+static void APIENTRY glad_instrument_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFramebufferTexture(target, attachment, texture, level);
+	GLStatsRecordCall(311, 0, glad_start, 0);
+}
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_next_glTexImage2DMultisample;
+static void APIENTRY glad_instrument_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	GLStatsRecordCall(312, 0, glad_start, 0);
+}
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_next_glTexImage3DMultisample;
+static void APIENTRY glad_instrument_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	GLStatsRecordCall(313, 0, glad_start, 0);
+}
+static PFNGLGETMULTISAMPLEFVPROC glad_next_glGetMultisamplefv;
+static void APIENTRY glad_instrument_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetMultisamplefv(pname, index, val);
+	GLStatsRecordCall(314, 0, glad_start, 0);
+}
+static PFNGLSAMPLEMASKIPROC glad_next_glSampleMaski;
+static void APIENTRY glad_instrument_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSampleMaski(maskNumber, mask);
+	GLStatsRecordCall(315, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_next_glBindFragDataLocationIndexed;
+static void APIENTRY glad_instrument_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	GLStatsRecordCall(316, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLGETFRAGDATAINDEXPROC glad_next_glGetFragDataIndex;
+static GLint APIENTRY glad_instrument_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	GLint glad_result = glad_next_glGetFragDataIndex(program, name);
+	GLStatsRecordCall(317, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGENSAMPLERSPROC glad_next_glGenSamplers;
+static void APIENTRY glad_instrument_glGenSamplers(GLsizei count, GLuint *samplers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenSamplers(count, samplers);
+	GLStatsRecordCall(318, 0, glad_start, 0);
+}
+static PFNGLDELETESAMPLERSPROC glad_next_glDeleteSamplers;
+static void APIENTRY glad_instrument_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteSamplers(count, samplers);
+	GLStatsRecordCall(319, 0, glad_start, 0);
+}
+static PFNGLISSAMPLERPROC glad_next_glIsSampler;
+static GLboolean APIENTRY glad_instrument_glIsSampler(GLuint sampler) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsSampler(sampler);
+	GLStatsRecordCall(320, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLBINDSAMPLERPROC glad_next_glBindSampler;
+static void APIENTRY glad_instrument_glBindSampler(GLuint unit, GLuint sampler) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindSampler(unit, sampler);
+	GLStatsRecordCall(321, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSAMPLERPARAMETERIPROC glad_next_glSamplerParameteri;
+static void APIENTRY glad_instrument_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSamplerParameteri(sampler, pname, param);
+	GLStatsRecordCall(322, 0, glad_start, 0);
+}
+static PFNGLSAMPLERPARAMETERIVPROC glad_next_glSamplerParameteriv;
+static void APIENTRY glad_instrument_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSamplerParameteriv(sampler, pname, param);
+	GLStatsRecordCall(323, 0, glad_start, 0);
+}
+static PFNGLSAMPLERPARAMETERFPROC glad_next_glSamplerParameterf;
+static void APIENTRY glad_instrument_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSamplerParameterf(sampler, pname, param);
+	GLStatsRecordCall(324, 0, glad_start, 0);
+}
+static PFNGLSAMPLERPARAMETERFVPROC glad_next_glSamplerParameterfv;
+static void APIENTRY glad_instrument_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSamplerParameterfv(sampler, pname, param);
+	GLStatsRecordCall(325, 0, glad_start, 0);
+}
+static PFNGLSAMPLERPARAMETERIIVPROC glad_next_glSamplerParameterIiv;
+static void APIENTRY glad_instrument_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSamplerParameterIiv(sampler, pname, param);
+	GLStatsRecordCall(326, 0, glad_start, 0);
+}
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_next_glSamplerParameterIuiv;
+static void APIENTRY glad_instrument_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSamplerParameterIuiv(sampler, pname, param);
+	GLStatsRecordCall(327, 0, glad_start, 0);
+}
+static PFNGLGETSAMPLERPARAMETERIVPROC glad_next_glGetSamplerParameteriv;
+static void APIENTRY glad_instrument_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetSamplerParameteriv(sampler, pname, params);
+	GLStatsRecordCall(328, 0, glad_start, 0);
+}
+static PFNGLGETSAMPLERPARAMETERIIVPROC glad_next_glGetSamplerParameterIiv;
+static void APIENTRY glad_instrument_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetSamplerParameterIiv(sampler, pname, params);
+	GLStatsRecordCall(329, 0, glad_start, 0);
+}
+static PFNGLGETSAMPLERPARAMETERFVPROC glad_next_glGetSamplerParameterfv;
+static void APIENTRY glad_instrument_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetSamplerParameterfv(sampler, pname, params);
+	GLStatsRecordCall(330, 0, glad_start, 0);
+}
+static PFNGLGETSAMPLERPARAMETERIUIVPROC glad_next_glGetSamplerParameterIuiv;
+static void APIENTRY glad_instrument_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetSamplerParameterIuiv(sampler, pname, params);
+	GLStatsRecordCall(331, 0, glad_start, 0);
+}
+static PFNGLQUERYCOUNTERPROC glad_next_glQueryCounter;
+static void APIENTRY glad_instrument_glQueryCounter(GLuint id, GLenum target) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glQueryCounter(id, target);
+	GLStatsRecordCall(332, 0, glad_start, 0);
+}
+static PFNGLGETQUERYOBJECTI64VPROC glad_next_glGetQueryObjecti64v;
+static void APIENTRY glad_instrument_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryObjecti64v(id, pname, params);
+	GLStatsRecordCall(333, 0, glad_start, 0);
+}
+static PFNGLGETQUERYOBJECTUI64VPROC glad_next_glGetQueryObjectui64v;
+static void APIENTRY glad_instrument_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryObjectui64v(id, pname, params);
+	GLStatsRecordCall(334, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBDIVISORPROC glad_next_glVertexAttribDivisor;
+static void APIENTRY glad_instrument_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribDivisor(index, divisor);
+	GLStatsRecordCall(335, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBP1UIPROC glad_next_glVertexAttribP1ui;
+static void APIENTRY glad_instrument_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribP1ui(index, type, normalized, value);
+	GLStatsRecordCall(336, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBP1UIVPROC glad_next_glVertexAttribP1uiv;
+static void APIENTRY glad_instrument_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribP1uiv(index, type, normalized, value);
+	GLStatsRecordCall(337, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBP2UIPROC glad_next_glVertexAttribP2ui;
+static void APIENTRY glad_instrument_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribP2ui(index, type, normalized, value);
+	GLStatsRecordCall(338, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBP2UIVPROC glad_next_glVertexAttribP2uiv;
+static void APIENTRY glad_instrument_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribP2uiv(index, type, normalized, value);
+	GLStatsRecordCall(339, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBP3UIPROC glad_next_glVertexAttribP3ui;
+static void APIENTRY glad_instrument_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribP3ui(index, type, normalized, value);
+	GLStatsRecordCall(340, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBP3UIVPROC glad_next_glVertexAttribP3uiv;
+static void APIENTRY glad_instrument_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribP3uiv(index, type, normalized, value);
+	GLStatsRecordCall(341, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBP4UIPROC glad_next_glVertexAttribP4ui;
+static void APIENTRY glad_instrument_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribP4ui(index, type, normalized, value);
+	GLStatsRecordCall(342, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBP4UIVPROC glad_next_glVertexAttribP4uiv;
+static void APIENTRY glad_instrument_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribP4uiv(index, type, normalized, value);
+	GLStatsRecordCall(343, 0, glad_start, 0);
+}
+static PFNGLVERTEXP2UIPROC glad_next_glVertexP2ui;
+static void APIENTRY glad_instrument_glVertexP2ui(GLenum type, GLuint value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexP2ui(type, value);
+	GLStatsRecordCall(344, 0, glad_start, 0);
+}
+static PFNGLVERTEXP2UIVPROC glad_next_glVertexP2uiv;
+static void APIENTRY glad_instrument_glVertexP2uiv(GLenum type, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexP2uiv(type, value);
+	GLStatsRecordCall(345, 0, glad_start, 0);
+}
+static PFNGLVERTEXP3UIPROC glad_next_glVertexP3ui;
+static void APIENTRY glad_instrument_glVertexP3ui(GLenum type, GLuint value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexP3ui(type, value);
+	GLStatsRecordCall(346, 0, glad_start, 0);
+}
+static PFNGLVERTEXP3UIVPROC glad_next_glVertexP3uiv;
+static void APIENTRY glad_instrument_glVertexP3uiv(GLenum type, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexP3uiv(type, value);
+	GLStatsRecordCall(347, 0, glad_start, 0);
+}
+static PFNGLVERTEXP4UIPROC glad_next_glVertexP4ui;
+static void APIENTRY glad_instrument_glVertexP4ui(GLenum type, GLuint value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexP4ui(type, value);
+	GLStatsRecordCall(348, 0, glad_start, 0);
+}
+static PFNGLVERTEXP4UIVPROC glad_next_glVertexP4uiv;
+static void APIENTRY glad_instrument_glVertexP4uiv(GLenum type, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexP4uiv(type, value);
+	GLStatsRecordCall(349, 0, glad_start, 0);
+}
+static PFNGLTEXCOORDP1UIPROC glad_next_glTexCoordP1ui;
+static void APIENTRY glad_instrument_glTexCoordP1ui(GLenum type, GLuint coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexCoordP1ui(type, coords);
+	GLStatsRecordCall(350, 0, glad_start, 0);
+}
+static PFNGLTEXCOORDP1UIVPROC glad_next_glTexCoordP1uiv;
+static void APIENTRY glad_instrument_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexCoordP1uiv(type, coords);
+	GLStatsRecordCall(351, 0, glad_start, 0);
+}
+static PFNGLTEXCOORDP2UIPROC glad_next_glTexCoordP2ui;
+static void APIENTRY glad_instrument_glTexCoordP2ui(GLenum type, GLuint coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexCoordP2ui(type, coords);
+	GLStatsRecordCall(352, 0, glad_start, 0);
+}
+static PFNGLTEXCOORDP2UIVPROC glad_next_glTexCoordP2uiv;
+static void APIENTRY glad_instrument_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexCoordP2uiv(type, coords);
+	GLStatsRecordCall(353, 0, glad_start, 0);
+}
+static PFNGLTEXCOORDP3UIPROC glad_next_glTexCoordP3ui;
+static void APIENTRY glad_instrument_glTexCoordP3ui(GLenum type, GLuint coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexCoordP3ui(type, coords);
+	GLStatsRecordCall(354, 0, glad_start, 0);
+}
+static PFNGLTEXCOORDP3UIVPROC glad_next_glTexCoordP3uiv;
+static void APIENTRY glad_instrument_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexCoordP3uiv(type, coords);
+	GLStatsRecordCall(355, 0, glad_start, 0);
+}
+static PFNGLTEXCOORDP4UIPROC glad_next_glTexCoordP4ui;
+static void APIENTRY glad_instrument_glTexCoordP4ui(GLenum type, GLuint coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexCoordP4ui(type, coords);
+	GLStatsRecordCall(356, 0, glad_start, 0);
+}
+static PFNGLTEXCOORDP4UIVPROC glad_next_glTexCoordP4uiv;
+static void APIENTRY glad_instrument_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexCoordP4uiv(type, coords);
+	GLStatsRecordCall(357, 0, glad_start, 0);
+}
+static PFNGLMULTITEXCOORDP1UIPROC glad_next_glMultiTexCoordP1ui;
+static void APIENTRY glad_instrument_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiTexCoordP1ui(texture, type, coords);
+	GLStatsRecordCall(358, 0, glad_start, 0);
+}
+static PFNGLMULTITEXCOORDP1UIVPROC glad_next_glMultiTexCoordP1uiv;
+static void APIENTRY glad_instrument_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiTexCoordP1uiv(texture, type, coords);
+	GLStatsRecordCall(359, 0, glad_start, 0);
+}
+static PFNGLMULTITEXCOORDP2UIPROC glad_next_glMultiTexCoordP2ui;
+static void APIENTRY glad_instrument_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiTexCoordP2ui(texture, type, coords);
+	GLStatsRecordCall(360, 0, glad_start, 0);
+}
+static PFNGLMULTITEXCOORDP2UIVPROC glad_next_glMultiTexCoordP2uiv;
+static void APIENTRY glad_instrument_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiTexCoordP2uiv(texture, type, coords);
+	GLStatsRecordCall(361, 0, glad_start, 0);
+}
+static PFNGLMULTITEXCOORDP3UIPROC glad_next_glMultiTexCoordP3ui;
+static void APIENTRY glad_instrument_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiTexCoordP3ui(texture, type, coords);
+	GLStatsRecordCall(362, 0, glad_start, 0);
+}
+static PFNGLMULTITEXCOORDP3UIVPROC glad_next_glMultiTexCoordP3uiv;
+static void APIENTRY glad_instrument_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiTexCoordP3uiv(texture, type, coords);
+	GLStatsRecordCall(363, 0, glad_start, 0);
+}
+static PFNGLMULTITEXCOORDP4UIPROC glad_next_glMultiTexCoordP4ui;
+static void APIENTRY glad_instrument_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiTexCoordP4ui(texture, type, coords);
+	GLStatsRecordCall(364, 0, glad_start, 0);
+}
+static PFNGLMULTITEXCOORDP4UIVPROC glad_next_glMultiTexCoordP4uiv;
+static void APIENTRY glad_instrument_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiTexCoordP4uiv(texture, type, coords);
+	GLStatsRecordCall(365, 0, glad_start, 0);
+}
+static PFNGLNORMALP3UIPROC glad_next_glNormalP3ui;
+static void APIENTRY glad_instrument_glNormalP3ui(GLenum type, GLuint coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNormalP3ui(type, coords);
+	GLStatsRecordCall(366, 0, glad_start, 0);
+}
+static PFNGLNORMALP3UIVPROC glad_next_glNormalP3uiv;
+static void APIENTRY glad_instrument_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNormalP3uiv(type, coords);
+	GLStatsRecordCall(367, 0, glad_start, 0);
+}
+static PFNGLCOLORP3UIPROC glad_next_glColorP3ui;
+static void APIENTRY glad_instrument_glColorP3ui(GLenum type, GLuint color) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glColorP3ui(type, color);
+	GLStatsRecordCall(368, 0, glad_start, 0);
+}
+static PFNGLCOLORP3UIVPROC glad_next_glColorP3uiv;
+static void APIENTRY glad_instrument_glColorP3uiv(GLenum type, const GLuint *color) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glColorP3uiv(type, color);
+	GLStatsRecordCall(369, 0, glad_start, 0);
+}
+static PFNGLCOLORP4UIPROC glad_next_glColorP4ui;
+static void APIENTRY glad_instrument_glColorP4ui(GLenum type, GLuint color) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glColorP4ui(type, color);
+	GLStatsRecordCall(370, 0, glad_start, 0);
+}
+static PFNGLCOLORP4UIVPROC glad_next_glColorP4uiv;
+static void APIENTRY glad_instrument_glColorP4uiv(GLenum type, const GLuint *color) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glColorP4uiv(type, color);
+	GLStatsRecordCall(371, 0, glad_start, 0);
+}
+static PFNGLSECONDARYCOLORP3UIPROC glad_next_glSecondaryColorP3ui;
+static void APIENTRY glad_instrument_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSecondaryColorP3ui(type, color);
+	GLStatsRecordCall(372, 0, glad_start, 0);
+}
+static PFNGLSECONDARYCOLORP3UIVPROC glad_next_glSecondaryColorP3uiv;
+static void APIENTRY glad_instrument_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glSecondaryColorP3uiv(type, color);
+	GLStatsRecordCall(373, 0, glad_start, 0);
+}
+static PFNGLMINSAMPLESHADINGPROC glad_next_glMinSampleShading;
+static void APIENTRY glad_instrument_glMinSampleShading(GLfloat value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMinSampleShading(value);
+	GLStatsRecordCall(374, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBLENDEQUATIONIPROC glad_next_glBlendEquationi;
+static void APIENTRY glad_instrument_glBlendEquationi(GLuint buf, GLenum mode) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlendEquationi(buf, mode);
+	GLStatsRecordCall(375, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBLENDEQUATIONSEPARATEIPROC glad_next_glBlendEquationSeparatei;
+static void APIENTRY glad_instrument_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+	GLStatsRecordCall(376, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBLENDFUNCIPROC glad_next_glBlendFunci;
+static void APIENTRY glad_instrument_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlendFunci(buf, src, dst);
+	GLStatsRecordCall(377, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBLENDFUNCSEPARATEIPROC glad_next_glBlendFuncSeparatei;
+static void APIENTRY glad_instrument_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	GLStatsRecordCall(378, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDRAWARRAYSINDIRECTPROC glad_next_glDrawArraysIndirect;
+static void APIENTRY glad_instrument_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawArraysIndirect(mode, indirect);
+	GLStatsRecordCall(379, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLDRAWELEMENTSINDIRECTPROC glad_next_glDrawElementsIndirect;
+static void APIENTRY glad_instrument_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawElementsIndirect(mode, type, indirect);
+	GLStatsRecordCall(380, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLUNIFORM1DPROC glad_next_glUniform1d;
+static void APIENTRY glad_instrument_glUniform1d(GLint location, GLdouble x) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform1d(location, x);
+	GLStatsRecordCall(381, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM2DPROC glad_next_glUniform2d;
+static void APIENTRY glad_instrument_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform2d(location, x, y);
+	GLStatsRecordCall(382, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM3DPROC glad_next_glUniform3d;
+static void APIENTRY glad_instrument_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform3d(location, x, y, z);
+	GLStatsRecordCall(383, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM4DPROC glad_next_glUniform4d;
+static void APIENTRY glad_instrument_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform4d(location, x, y, z, w);
+	GLStatsRecordCall(384, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM1DVPROC glad_next_glUniform1dv;
+static void APIENTRY glad_instrument_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform1dv(location, count, value);
+	GLStatsRecordCall(385, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM2DVPROC glad_next_glUniform2dv;
+static void APIENTRY glad_instrument_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform2dv(location, count, value);
+	GLStatsRecordCall(386, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM3DVPROC glad_next_glUniform3dv;
+static void APIENTRY glad_instrument_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform3dv(location, count, value);
+	GLStatsRecordCall(387, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORM4DVPROC glad_next_glUniform4dv;
+static void APIENTRY glad_instrument_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniform4dv(location, count, value);
+	GLStatsRecordCall(388, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX2DVPROC glad_next_glUniformMatrix2dv;
+static void APIENTRY glad_instrument_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix2dv(location, count, transpose, value);
+	GLStatsRecordCall(389, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX3DVPROC glad_next_glUniformMatrix3dv;
+static void APIENTRY glad_instrument_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix3dv(location, count, transpose, value);
+	GLStatsRecordCall(390, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX4DVPROC glad_next_glUniformMatrix4dv;
+static void APIENTRY glad_instrument_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix4dv(location, count, transpose, value);
+	GLStatsRecordCall(391, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX2X3DVPROC glad_next_glUniformMatrix2x3dv;
+static void APIENTRY glad_instrument_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix2x3dv(location, count, transpose, value);
+	GLStatsRecordCall(392, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX2X4DVPROC glad_next_glUniformMatrix2x4dv;
+static void APIENTRY glad_instrument_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix2x4dv(location, count, transpose, value);
+	GLStatsRecordCall(393, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX3X2DVPROC glad_next_glUniformMatrix3x2dv;
+static void APIENTRY glad_instrument_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix3x2dv(location, count, transpose, value);
+	GLStatsRecordCall(394, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX3X4DVPROC glad_next_glUniformMatrix3x4dv;
+static void APIENTRY glad_instrument_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix3x4dv(location, count, transpose, value);
+	GLStatsRecordCall(395, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX4X2DVPROC glad_next_glUniformMatrix4x2dv;
+static void APIENTRY glad_instrument_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix4x2dv(location, count, transpose, value);
+	GLStatsRecordCall(396, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLUNIFORMMATRIX4X3DVPROC glad_next_glUniformMatrix4x3dv;
+static void APIENTRY glad_instrument_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformMatrix4x3dv(location, count, transpose, value);
+	GLStatsRecordCall(397, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLGETUNIFORMDVPROC glad_next_glGetUniformdv;
+static void APIENTRY glad_instrument_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetUniformdv(program, location, params);
+	GLStatsRecordCall(398, 0, glad_start, 0);
+}
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_next_glGetSubroutineUniformLocation;
+static GLint APIENTRY glad_instrument_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	GLint glad_result = glad_next_glGetSubroutineUniformLocation(program, shadertype, name);
+	GLStatsRecordCall(399, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETSUBROUTINEINDEXPROC glad_next_glGetSubroutineIndex;
+static GLuint APIENTRY glad_instrument_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	GLuint glad_result = glad_next_glGetSubroutineIndex(program, shadertype, name);
+	GLStatsRecordCall(400, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_next_glGetActiveSubroutineUniformiv;
+static void APIENTRY glad_instrument_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+	GLStatsRecordCall(401, 0, glad_start, 0);
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_next_glGetActiveSubroutineUniformName;
+static void APIENTRY glad_instrument_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+	GLStatsRecordCall(402, 0, glad_start, 0);
+}
+static PFNGLGETACTIVESUBROUTINENAMEPROC glad_next_glGetActiveSubroutineName;
+static void APIENTRY glad_instrument_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+	GLStatsRecordCall(403, 0, glad_start, 0);
+}
+static PFNGLUNIFORMSUBROUTINESUIVPROC glad_next_glUniformSubroutinesuiv;
+static void APIENTRY glad_instrument_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUniformSubroutinesuiv(shadertype, count, indices);
+	GLStatsRecordCall(404, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_next_glGetUniformSubroutineuiv;
+static void APIENTRY glad_instrument_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetUniformSubroutineuiv(shadertype, location, params);
+	GLStatsRecordCall(405, 0, glad_start, 0);
+}
+static PFNGLGETPROGRAMSTAGEIVPROC glad_next_glGetProgramStageiv;
+static void APIENTRY glad_instrument_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetProgramStageiv(program, shadertype, pname, values);
+	GLStatsRecordCall(406, 0, glad_start, 0);
+}
+static PFNGLPATCHPARAMETERIPROC glad_next_glPatchParameteri;
+static void APIENTRY glad_instrument_glPatchParameteri(GLenum pname, GLint value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPatchParameteri(pname, value);
+	GLStatsRecordCall(407, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLPATCHPARAMETERFVPROC glad_next_glPatchParameterfv;
+static void APIENTRY glad_instrument_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPatchParameterfv(pname, values);
+	GLStatsRecordCall(408, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBINDTRANSFORMFEEDBACKPROC glad_next_glBindTransformFeedback;
+static void APIENTRY glad_instrument_glBindTransformFeedback(GLenum target, GLuint id) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindTransformFeedback(target, id);
+	GLStatsRecordCall(409, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDELETETRANSFORMFEEDBACKSPROC glad_next_glDeleteTransformFeedbacks;
+static void APIENTRY glad_instrument_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteTransformFeedbacks(n, ids);
+	GLStatsRecordCall(410, 0, glad_start, 0);
+}
+static PFNGLGENTRANSFORMFEEDBACKSPROC glad_next_glGenTransformFeedbacks;
+static void APIENTRY glad_instrument_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenTransformFeedbacks(n, ids);
+	GLStatsRecordCall(411, 0, glad_start, 0);
+}
+static PFNGLISTRANSFORMFEEDBACKPROC glad_next_glIsTransformFeedback;
+static GLboolean APIENTRY glad_instrument_glIsTransformFeedback(GLuint id) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsTransformFeedback(id);
+	GLStatsRecordCall(412, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLPAUSETRANSFORMFEEDBACKPROC glad_next_glPauseTransformFeedback;
+static void APIENTRY glad_instrument_glPauseTransformFeedback(void) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPauseTransformFeedback();
+	GLStatsRecordCall(413, 0, glad_start, 0);
+}
+static PFNGLRESUMETRANSFORMFEEDBACKPROC glad_next_glResumeTransformFeedback;
+static void APIENTRY glad_instrument_glResumeTransformFeedback(void) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glResumeTransformFeedback();
+	GLStatsRecordCall(414, 0, glad_start, 0);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKPROC glad_next_glDrawTransformFeedback;
+static void APIENTRY glad_instrument_glDrawTransformFeedback(GLenum mode, GLuint id) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawTransformFeedback(mode, id);
+	GLStatsRecordCall(415, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_next_glDrawTransformFeedbackStream;
+static void APIENTRY glad_instrument_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawTransformFeedbackStream(mode, id, stream);
+	GLStatsRecordCall(416, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLBEGINQUERYINDEXEDPROC glad_next_glBeginQueryIndexed;
+static void APIENTRY glad_instrument_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBeginQueryIndexed(target, index, id);
+	GLStatsRecordCall(417, 0, glad_start, 0);
+}
+static PFNGLENDQUERYINDEXEDPROC glad_next_glEndQueryIndexed;
+static void APIENTRY glad_instrument_glEndQueryIndexed(GLenum target, GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glEndQueryIndexed(target, index);
+	GLStatsRecordCall(418, 0, glad_start, 0);
+}
+static PFNGLGETQUERYINDEXEDIVPROC glad_next_glGetQueryIndexediv;
+static void APIENTRY glad_instrument_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryIndexediv(target, index, pname, params);
+	GLStatsRecordCall(419, 0, glad_start, 0);
+}
+static PFNGLRELEASESHADERCOMPILERPROC glad_next_glReleaseShaderCompiler;
+static void APIENTRY glad_instrument_glReleaseShaderCompiler(void) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glReleaseShaderCompiler();
+	GLStatsRecordCall(420, 0, glad_start, 0);
+}
+static PFNGLSHADERBINARYPROC glad_next_glShaderBinary;
+static void APIENTRY glad_instrument_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glShaderBinary(count, shaders, binaryformat, binary, length);
+	GLStatsRecordCall(421, 0, glad_start, 0);
+}
+static PFNGLGETSHADERPRECISIONFORMATPROC glad_next_glGetShaderPrecisionFormat;
+static void APIENTRY glad_instrument_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+	GLStatsRecordCall(422, 0, glad_start, 0);
+}
+static PFNGLDEPTHRANGEFPROC glad_next_glDepthRangef;
+static void APIENTRY glad_instrument_glDepthRangef(GLfloat n, GLfloat f) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDepthRangef(n, f);
+	GLStatsRecordCall(423, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLCLEARDEPTHFPROC glad_next_glClearDepthf;
+static void APIENTRY glad_instrument_glClearDepthf(GLfloat d) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearDepthf(d);
+	GLStatsRecordCall(424, 0, glad_start, 0);
+}
+static PFNGLGETPROGRAMBINARYPROC glad_next_glGetProgramBinary;
+static void APIENTRY glad_instrument_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	GLStatsRecordCall(425, 0, glad_start, 0);
+}
+static PFNGLPROGRAMBINARYPROC glad_next_glProgramBinary;
+static void APIENTRY glad_instrument_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramBinary(program, binaryFormat, binary, length);
+	GLStatsRecordCall(426, 0, glad_start, 0);
+}
+static PFNGLPROGRAMPARAMETERIPROC glad_next_glProgramParameteri;
+static void APIENTRY glad_instrument_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramParameteri(program, pname, value);
+	GLStatsRecordCall(427, 0, glad_start, 0);
+}
+static PFNGLUSEPROGRAMSTAGESPROC glad_next_glUseProgramStages;
+static void APIENTRY glad_instrument_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glUseProgramStages(pipeline, stages, program);
+	GLStatsRecordCall(428, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLACTIVESHADERPROGRAMPROC glad_next_glActiveShaderProgram;
+static void APIENTRY glad_instrument_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glActiveShaderProgram(pipeline, program);
+	GLStatsRecordCall(429, 0, glad_start, 0);
+}
+static PFNGLCREATESHADERPROGRAMVPROC glad_next_glCreateShaderProgramv;
+static GLuint APIENTRY glad_instrument_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+	u64 glad_start = ReadProfileTicks();
+	GLuint glad_result = glad_next_glCreateShaderProgramv(type, count, strings);
+	GLStatsRecordCall(430, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLBINDPROGRAMPIPELINEPROC glad_next_glBindProgramPipeline;
+static void APIENTRY glad_instrument_glBindProgramPipeline(GLuint pipeline) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindProgramPipeline(pipeline);
+	GLStatsRecordCall(431, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDELETEPROGRAMPIPELINESPROC glad_next_glDeleteProgramPipelines;
+static void APIENTRY glad_instrument_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDeleteProgramPipelines(n, pipelines);
+	GLStatsRecordCall(432, 0, glad_start, 0);
+}
+static PFNGLGENPROGRAMPIPELINESPROC glad_next_glGenProgramPipelines;
+static void APIENTRY glad_instrument_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenProgramPipelines(n, pipelines);
+	GLStatsRecordCall(433, 0, glad_start, 0);
+}
+static PFNGLISPROGRAMPIPELINEPROC glad_next_glIsProgramPipeline;
+static GLboolean APIENTRY glad_instrument_glIsProgramPipeline(GLuint pipeline) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glIsProgramPipeline(pipeline);
+	GLStatsRecordCall(434, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETPROGRAMPIPELINEIVPROC glad_next_glGetProgramPipelineiv;
+static void APIENTRY glad_instrument_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetProgramPipelineiv(pipeline, pname, params);
+	GLStatsRecordCall(435, 0, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM1IPROC glad_next_glProgramUniform1i;
+static void APIENTRY glad_instrument_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform1i(program, location, v0);
+	GLStatsRecordCall(436, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM1IVPROC glad_next_glProgramUniform1iv;
+static void APIENTRY glad_instrument_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform1iv(program, location, count, value);
+	GLStatsRecordCall(437, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM1FPROC glad_next_glProgramUniform1f;
+static void APIENTRY glad_instrument_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform1f(program, location, v0);
+	GLStatsRecordCall(438, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM1FVPROC glad_next_glProgramUniform1fv;
+static void APIENTRY glad_instrument_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform1fv(program, location, count, value);
+	GLStatsRecordCall(439, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM1DPROC glad_next_glProgramUniform1d;
+static void APIENTRY glad_instrument_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform1d(program, location, v0);
+	GLStatsRecordCall(440, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM1DVPROC glad_next_glProgramUniform1dv;
+static void APIENTRY glad_instrument_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform1dv(program, location, count, value);
+	GLStatsRecordCall(441, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM1UIPROC glad_next_glProgramUniform1ui;
+static void APIENTRY glad_instrument_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform1ui(program, location, v0);
+	GLStatsRecordCall(442, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM1UIVPROC glad_next_glProgramUniform1uiv;
+static void APIENTRY glad_instrument_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform1uiv(program, location, count, value);
+	GLStatsRecordCall(443, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM2IPROC glad_next_glProgramUniform2i;
+static void APIENTRY glad_instrument_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform2i(program, location, v0, v1);
+	GLStatsRecordCall(444, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM2IVPROC glad_next_glProgramUniform2iv;
+static void APIENTRY glad_instrument_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform2iv(program, location, count, value);
+	GLStatsRecordCall(445, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM2FPROC glad_next_glProgramUniform2f;
+static void APIENTRY glad_instrument_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform2f(program, location, v0, v1);
+	GLStatsRecordCall(446, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM2FVPROC glad_next_glProgramUniform2fv;
+static void APIENTRY glad_instrument_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform2fv(program, location, count, value);
+	GLStatsRecordCall(447, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM2DPROC glad_next_glProgramUniform2d;
+static void APIENTRY glad_instrument_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform2d(program, location, v0, v1);
+	GLStatsRecordCall(448, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM2DVPROC glad_next_glProgramUniform2dv;
+static void APIENTRY glad_instrument_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform2dv(program, location, count, value);
+	GLStatsRecordCall(449, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM2UIPROC glad_next_glProgramUniform2ui;
+static void APIENTRY glad_instrument_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform2ui(program, location, v0, v1);
+	GLStatsRecordCall(450, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM2UIVPROC glad_next_glProgramUniform2uiv;
+static void APIENTRY glad_instrument_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform2uiv(program, location, count, value);
+	GLStatsRecordCall(451, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM3IPROC glad_next_glProgramUniform3i;
+static void APIENTRY glad_instrument_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform3i(program, location, v0, v1, v2);
+	GLStatsRecordCall(452, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM3IVPROC glad_next_glProgramUniform3iv;
+static void APIENTRY glad_instrument_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform3iv(program, location, count, value);
+	GLStatsRecordCall(453, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM3FPROC glad_next_glProgramUniform3f;
+static void APIENTRY glad_instrument_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform3f(program, location, v0, v1, v2);
+	GLStatsRecordCall(454, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM3FVPROC glad_next_glProgramUniform3fv;
+static void APIENTRY glad_instrument_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform3fv(program, location, count, value);
+	GLStatsRecordCall(455, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM3DPROC glad_next_glProgramUniform3d;
+static void APIENTRY glad_instrument_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform3d(program, location, v0, v1, v2);
+	GLStatsRecordCall(456, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM3DVPROC glad_next_glProgramUniform3dv;
+static void APIENTRY glad_instrument_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform3dv(program, location, count, value);
+	GLStatsRecordCall(457, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM3UIPROC glad_next_glProgramUniform3ui;
+static void APIENTRY glad_instrument_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform3ui(program, location, v0, v1, v2);
+	GLStatsRecordCall(458, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM3UIVPROC glad_next_glProgramUniform3uiv;
+static void APIENTRY glad_instrument_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform3uiv(program, location, count, value);
+	GLStatsRecordCall(459, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM4IPROC glad_next_glProgramUniform4i;
+static void APIENTRY glad_instrument_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform4i(program, location, v0, v1, v2, v3);
+	GLStatsRecordCall(460, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM4IVPROC glad_next_glProgramUniform4iv;
+static void APIENTRY glad_instrument_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform4iv(program, location, count, value);
+	GLStatsRecordCall(461, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM4FPROC glad_next_glProgramUniform4f;
+static void APIENTRY glad_instrument_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform4f(program, location, v0, v1, v2, v3);
+	GLStatsRecordCall(462, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM4FVPROC glad_next_glProgramUniform4fv;
+static void APIENTRY glad_instrument_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform4fv(program, location, count, value);
+	GLStatsRecordCall(463, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM4DPROC glad_next_glProgramUniform4d;
+static void APIENTRY glad_instrument_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform4d(program, location, v0, v1, v2, v3);
+	GLStatsRecordCall(464, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM4DVPROC glad_next_glProgramUniform4dv;
+static void APIENTRY glad_instrument_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform4dv(program, location, count, value);
+	GLStatsRecordCall(465, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM4UIPROC glad_next_glProgramUniform4ui;
+static void APIENTRY glad_instrument_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+	GLStatsRecordCall(466, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORM4UIVPROC glad_next_glProgramUniform4uiv;
+static void APIENTRY glad_instrument_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniform4uiv(program, location, count, value);
+	GLStatsRecordCall(467, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_next_glProgramUniformMatrix2fv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+	GLStatsRecordCall(468, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_next_glProgramUniformMatrix3fv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+	GLStatsRecordCall(469, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_next_glProgramUniformMatrix4fv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+	GLStatsRecordCall(470, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_next_glProgramUniformMatrix2dv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+	GLStatsRecordCall(471, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_next_glProgramUniformMatrix3dv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+	GLStatsRecordCall(472, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_next_glProgramUniformMatrix4dv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+	GLStatsRecordCall(473, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_next_glProgramUniformMatrix2x3fv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+	GLStatsRecordCall(474, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_next_glProgramUniformMatrix3x2fv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+	GLStatsRecordCall(475, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_next_glProgramUniformMatrix2x4fv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+	GLStatsRecordCall(476, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_next_glProgramUniformMatrix4x2fv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+	GLStatsRecordCall(477, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_next_glProgramUniformMatrix3x4fv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+	GLStatsRecordCall(478, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_next_glProgramUniformMatrix4x3fv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+	GLStatsRecordCall(479, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_next_glProgramUniformMatrix2x3dv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+	GLStatsRecordCall(480, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_next_glProgramUniformMatrix3x2dv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+	GLStatsRecordCall(481, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_next_glProgramUniformMatrix2x4dv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+	GLStatsRecordCall(482, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_next_glProgramUniformMatrix4x2dv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+	GLStatsRecordCall(483, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_next_glProgramUniformMatrix3x4dv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+	GLStatsRecordCall(484, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_next_glProgramUniformMatrix4x3dv;
+static void APIENTRY glad_instrument_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+	GLStatsRecordCall(485, GL_STATS_UNIFORM, glad_start, 0);
+}
+static PFNGLVALIDATEPROGRAMPIPELINEPROC glad_next_glValidateProgramPipeline;
+static void APIENTRY glad_instrument_glValidateProgramPipeline(GLuint pipeline) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glValidateProgramPipeline(pipeline);
+	GLStatsRecordCall(486, 0, glad_start, 0);
+}
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_next_glGetProgramPipelineInfoLog;
+static void APIENTRY glad_instrument_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+	GLStatsRecordCall(487, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBL1DPROC glad_next_glVertexAttribL1d;
+static void APIENTRY glad_instrument_glVertexAttribL1d(GLuint index, GLdouble x) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribL1d(index, x);
+	GLStatsRecordCall(488, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBL2DPROC glad_next_glVertexAttribL2d;
+static void APIENTRY glad_instrument_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribL2d(index, x, y);
+	GLStatsRecordCall(489, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBL3DPROC glad_next_glVertexAttribL3d;
+static void APIENTRY glad_instrument_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribL3d(index, x, y, z);
+	GLStatsRecordCall(490, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBL4DPROC glad_next_glVertexAttribL4d;
+static void APIENTRY glad_instrument_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribL4d(index, x, y, z, w);
+	GLStatsRecordCall(491, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBL1DVPROC glad_next_glVertexAttribL1dv;
+static void APIENTRY glad_instrument_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribL1dv(index, v);
+	GLStatsRecordCall(492, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBL2DVPROC glad_next_glVertexAttribL2dv;
+static void APIENTRY glad_instrument_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribL2dv(index, v);
+	GLStatsRecordCall(493, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBL3DVPROC glad_next_glVertexAttribL3dv;
+static void APIENTRY glad_instrument_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribL3dv(index, v);
+	GLStatsRecordCall(494, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBL4DVPROC glad_next_glVertexAttribL4dv;
+static void APIENTRY glad_instrument_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribL4dv(index, v);
+	GLStatsRecordCall(495, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBLPOINTERPROC glad_next_glVertexAttribLPointer;
+static void APIENTRY glad_instrument_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribLPointer(index, size, type, stride, pointer);
+	GLStatsRecordCall(496, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXATTRIBLDVPROC glad_next_glGetVertexAttribLdv;
+static void APIENTRY glad_instrument_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexAttribLdv(index, pname, params);
+	GLStatsRecordCall(497, 0, glad_start, 0);
+}
+static PFNGLVIEWPORTARRAYVPROC glad_next_glViewportArrayv;
+static void APIENTRY glad_instrument_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glViewportArrayv(first, count, v);
+	GLStatsRecordCall(498, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLVIEWPORTINDEXEDFPROC glad_next_glViewportIndexedf;
+static void APIENTRY glad_instrument_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glViewportIndexedf(index, x, y, w, h);
+	GLStatsRecordCall(499, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLVIEWPORTINDEXEDFVPROC glad_next_glViewportIndexedfv;
+static void APIENTRY glad_instrument_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glViewportIndexedfv(index, v);
+	GLStatsRecordCall(500, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSCISSORARRAYVPROC glad_next_glScissorArrayv;
+static void APIENTRY glad_instrument_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glScissorArrayv(first, count, v);
+	GLStatsRecordCall(501, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSCISSORINDEXEDPROC glad_next_glScissorIndexed;
+static void APIENTRY glad_instrument_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glScissorIndexed(index, left, bottom, width, height);
+	GLStatsRecordCall(502, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLSCISSORINDEXEDVPROC glad_next_glScissorIndexedv;
+static void APIENTRY glad_instrument_glScissorIndexedv(GLuint index, const GLint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glScissorIndexedv(index, v);
+	GLStatsRecordCall(503, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDEPTHRANGEARRAYVPROC glad_next_glDepthRangeArrayv;
+static void APIENTRY glad_instrument_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDepthRangeArrayv(first, count, v);
+	GLStatsRecordCall(504, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLDEPTHRANGEINDEXEDPROC glad_next_glDepthRangeIndexed;
+static void APIENTRY glad_instrument_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDepthRangeIndexed(index, n, f);
+	GLStatsRecordCall(505, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLGETFLOATI_VPROC glad_next_glGetFloati_v;
+static void APIENTRY glad_instrument_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetFloati_v(target, index, data);
+	GLStatsRecordCall(506, 0, glad_start, 0);
+}
+static PFNGLGETDOUBLEI_VPROC glad_next_glGetDoublei_v;
+static void APIENTRY glad_instrument_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetDoublei_v(target, index, data);
+	GLStatsRecordCall(507, 0, glad_start, 0);
+}
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_next_glDrawArraysInstancedBaseInstance;
+static void APIENTRY glad_instrument_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	GLStatsRecordCall(508, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_next_glDrawElementsInstancedBaseInstance;
+static void APIENTRY glad_instrument_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	GLStatsRecordCall(509, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_next_glDrawElementsInstancedBaseVertexBaseInstance;
+static void APIENTRY glad_instrument_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	GLStatsRecordCall(510, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLGETINTERNALFORMATIVPROC glad_next_glGetInternalformativ;
+static void APIENTRY glad_instrument_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetInternalformativ(target, internalformat, pname, bufSize, params);
+	GLStatsRecordCall(511, 0, glad_start, 0);
+}
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_next_glGetActiveAtomicCounterBufferiv;
+static void APIENTRY glad_instrument_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+	GLStatsRecordCall(512, 0, glad_start, 0);
+}
+static PFNGLBINDIMAGETEXTUREPROC glad_next_glBindImageTexture;
+static void APIENTRY glad_instrument_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+	GLStatsRecordCall(513, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLMEMORYBARRIERPROC glad_next_glMemoryBarrier;
+static void APIENTRY glad_instrument_glMemoryBarrier(GLbitfield barriers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMemoryBarrier(barriers);
+	GLStatsRecordCall(514, 0, glad_start, 0);
+}
+static PFNGLTEXSTORAGE1DPROC glad_next_glTexStorage1D;
+static void APIENTRY glad_instrument_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexStorage1D(target, levels, internalformat, width);
+	GLStatsRecordCall(515, 0, glad_start, 0);
+}
+static PFNGLTEXSTORAGE2DPROC glad_next_glTexStorage2D;
+static void APIENTRY glad_instrument_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexStorage2D(target, levels, internalformat, width, height);
+	GLStatsRecordCall(516, 0, glad_start, 0);
+}
+static PFNGLTEXSTORAGE3DPROC glad_next_glTexStorage3D;
+static void APIENTRY glad_instrument_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexStorage3D(target, levels, internalformat, width, height, depth);
+	GLStatsRecordCall(517, 0, glad_start, 0);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_next_glDrawTransformFeedbackInstanced;
+static void APIENTRY glad_instrument_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+	GLStatsRecordCall(518, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_next_glDrawTransformFeedbackStreamInstanced;
+static void APIENTRY glad_instrument_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	GLStatsRecordCall(519, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLCLEARBUFFERDATAPROC glad_next_glClearBufferData;
+static void APIENTRY glad_instrument_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearBufferData(target, internalformat, format, type, data);
+	GLStatsRecordCall(520, 0, glad_start, 0);
+}
+static PFNGLCLEARBUFFERSUBDATAPROC glad_next_glClearBufferSubData;
+static void APIENTRY glad_instrument_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+	GLStatsRecordCall(521, 0, glad_start, 0);
+}
+static PFNGLDISPATCHCOMPUTEPROC glad_next_glDispatchCompute;
+static void APIENTRY glad_instrument_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	GLStatsRecordCall(522, 0, glad_start, 0);
+}
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_next_glDispatchComputeIndirect;
+static void APIENTRY glad_instrument_glDispatchComputeIndirect(GLintptr indirect) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDispatchComputeIndirect(indirect);
+	GLStatsRecordCall(523, 0, glad_start, 0);
+}
+static PFNGLCOPYIMAGESUBDATAPROC glad_next_glCopyImageSubData;
+static void APIENTRY glad_instrument_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	GLStatsRecordCall(524, 0, glad_start, 0);
+}
+static PFNGLFRAMEBUFFERPARAMETERIPROC glad_next_glFramebufferParameteri;
+static void APIENTRY glad_instrument_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFramebufferParameteri(target, pname, param);
+	GLStatsRecordCall(525, 0, glad_start, 0);
+}
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_next_glGetFramebufferParameteriv;
+static void APIENTRY glad_instrument_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetFramebufferParameteriv(target, pname, params);
+	GLStatsRecordCall(526, 0, glad_start, 0);
+}
+static PFNGLGETINTERNALFORMATI64VPROC glad_next_glGetInternalformati64v;
+static void APIENTRY glad_instrument_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetInternalformati64v(target, internalformat, pname, bufSize, params);
+	GLStatsRecordCall(527, 0, glad_start, 0);
+}
+static PFNGLINVALIDATETEXSUBIMAGEPROC glad_next_glInvalidateTexSubImage;
+static void APIENTRY glad_instrument_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	GLStatsRecordCall(528, 0, glad_start, 0);
+}
+static PFNGLINVALIDATETEXIMAGEPROC glad_next_glInvalidateTexImage;
+static void APIENTRY glad_instrument_glInvalidateTexImage(GLuint texture, GLint level) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glInvalidateTexImage(texture, level);
+	GLStatsRecordCall(529, 0, glad_start, 0);
+}
+static PFNGLINVALIDATEBUFFERSUBDATAPROC glad_next_glInvalidateBufferSubData;
+static void APIENTRY glad_instrument_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glInvalidateBufferSubData(buffer, offset, length);
+	GLStatsRecordCall(530, 0, glad_start, 0);
+}
+static PFNGLINVALIDATEBUFFERDATAPROC glad_next_glInvalidateBufferData;
+static void APIENTRY glad_instrument_glInvalidateBufferData(GLuint buffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glInvalidateBufferData(buffer);
+	GLStatsRecordCall(531, 0, glad_start, 0);
+}
+static PFNGLINVALIDATEFRAMEBUFFERPROC glad_next_glInvalidateFramebuffer;
+static void APIENTRY glad_instrument_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glInvalidateFramebuffer(target, numAttachments, attachments);
+	GLStatsRecordCall(532, 0, glad_start, 0);
+}
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_next_glInvalidateSubFramebuffer;
+static void APIENTRY glad_instrument_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	GLStatsRecordCall(533, 0, glad_start, 0);
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_next_glMultiDrawArraysIndirect;
+static void APIENTRY glad_instrument_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	GLStatsRecordCall(534, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_next_glMultiDrawElementsIndirect;
+static void APIENTRY glad_instrument_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	GLStatsRecordCall(535, GL_STATS_DRAW, glad_start, 0);
+}
+static PFNGLGETPROGRAMINTERFACEIVPROC glad_next_glGetProgramInterfaceiv;
+static void APIENTRY glad_instrument_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetProgramInterfaceiv(program, programInterface, pname, params);
+	GLStatsRecordCall(536, 0, glad_start, 0);
+}
+static PFNGLGETPROGRAMRESOURCEINDEXPROC glad_next_glGetProgramResourceIndex;
+static GLuint APIENTRY glad_instrument_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	GLuint glad_result = glad_next_glGetProgramResourceIndex(program, programInterface, name);
+	GLStatsRecordCall(537, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETPROGRAMRESOURCENAMEPROC glad_next_glGetProgramResourceName;
+static void APIENTRY glad_instrument_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+	GLStatsRecordCall(538, 0, glad_start, 0);
+}
+static PFNGLGETPROGRAMRESOURCEIVPROC glad_next_glGetProgramResourceiv;
+static void APIENTRY glad_instrument_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+	GLStatsRecordCall(539, 0, glad_start, 0);
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_next_glGetProgramResourceLocation;
+static GLint APIENTRY glad_instrument_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	GLint glad_result = glad_next_glGetProgramResourceLocation(program, programInterface, name);
+	GLStatsRecordCall(540, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_next_glGetProgramResourceLocationIndex;
+static GLint APIENTRY glad_instrument_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	u64 glad_start = ReadProfileTicks();
+	GLint glad_result = glad_next_glGetProgramResourceLocationIndex(program, programInterface, name);
+	GLStatsRecordCall(541, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_next_glShaderStorageBlockBinding;
+static void APIENTRY glad_instrument_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	GLStatsRecordCall(542, 0, glad_start, 0);
+}
+static PFNGLTEXBUFFERRANGEPROC glad_next_glTexBufferRange;
+static void APIENTRY glad_instrument_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexBufferRange(target, internalformat, buffer, offset, size);
+	GLStatsRecordCall(543, 0, glad_start, 0);
+}
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_next_glTexStorage2DMultisample;
+static void APIENTRY glad_instrument_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	GLStatsRecordCall(544, 0, glad_start, 0);
+}
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_next_glTexStorage3DMultisample;
+static void APIENTRY glad_instrument_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	GLStatsRecordCall(545, 0, glad_start, 0);
+}
+static PFNGLTEXTUREVIEWPROC glad_next_glTextureView;
+static void APIENTRY glad_instrument_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	GLStatsRecordCall(546, 0, glad_start, 0);
+}
+static PFNGLBINDVERTEXBUFFERPROC glad_next_glBindVertexBuffer;
+static void APIENTRY glad_instrument_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+	GLStatsRecordCall(547, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBFORMATPROC glad_next_glVertexAttribFormat;
+static void APIENTRY glad_instrument_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	GLStatsRecordCall(548, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBIFORMATPROC glad_next_glVertexAttribIFormat;
+static void APIENTRY glad_instrument_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+	GLStatsRecordCall(549, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBLFORMATPROC glad_next_glVertexAttribLFormat;
+static void APIENTRY glad_instrument_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+	GLStatsRecordCall(550, 0, glad_start, 0);
+}
+static PFNGLVERTEXATTRIBBINDINGPROC glad_next_glVertexAttribBinding;
+static void APIENTRY glad_instrument_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexAttribBinding(attribindex, bindingindex);
+	GLStatsRecordCall(551, 0, glad_start, 0);
+}
+static PFNGLVERTEXBINDINGDIVISORPROC glad_next_glVertexBindingDivisor;
+static void APIENTRY glad_instrument_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexBindingDivisor(bindingindex, divisor);
+	GLStatsRecordCall(552, 0, glad_start, 0);
+}
+static PFNGLDEBUGMESSAGECONTROLPROC glad_next_glDebugMessageControl;
+static void APIENTRY glad_instrument_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDebugMessageControl(source, type, severity, count, ids, enabled);
+	GLStatsRecordCall(553, 0, glad_start, 0);
+}
+static PFNGLDEBUGMESSAGEINSERTPROC glad_next_glDebugMessageInsert;
+static void APIENTRY glad_instrument_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDebugMessageInsert(source, type, id, severity, length, buf);
+	GLStatsRecordCall(554, 0, glad_start, 0);
+}
+static PFNGLDEBUGMESSAGECALLBACKPROC glad_next_glDebugMessageCallback;
+static void APIENTRY glad_instrument_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDebugMessageCallback(callback, userParam);
+	GLStatsRecordCall(555, 0, glad_start, 0);
+}
+static PFNGLGETDEBUGMESSAGELOGPROC glad_next_glGetDebugMessageLog;
+static GLuint APIENTRY glad_instrument_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	u64 glad_start = ReadProfileTicks();
+	GLuint glad_result = glad_next_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	GLStatsRecordCall(556, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLPUSHDEBUGGROUPPROC glad_next_glPushDebugGroup;
+static void APIENTRY glad_instrument_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPushDebugGroup(source, id, length, message);
+	GLStatsRecordCall(557, 0, glad_start, 0);
+}
+static PFNGLPOPDEBUGGROUPPROC glad_next_glPopDebugGroup;
+static void APIENTRY glad_instrument_glPopDebugGroup(void) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glPopDebugGroup();
+	GLStatsRecordCall(558, 0, glad_start, 0);
+}
+static PFNGLOBJECTLABELPROC glad_next_glObjectLabel;
+static void APIENTRY glad_instrument_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glObjectLabel(identifier, name, length, label);
+	GLStatsRecordCall(559, 0, glad_start, 0);
+}
+static PFNGLGETOBJECTLABELPROC glad_next_glGetObjectLabel;
+static void APIENTRY glad_instrument_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetObjectLabel(identifier, name, bufSize, length, label);
+	GLStatsRecordCall(560, 0, glad_start, 0);
+}
+static PFNGLOBJECTPTRLABELPROC glad_next_glObjectPtrLabel;
+static void APIENTRY glad_instrument_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glObjectPtrLabel(ptr, length, label);
+	GLStatsRecordCall(561, 0, glad_start, 0);
+}
+static PFNGLGETOBJECTPTRLABELPROC glad_next_glGetObjectPtrLabel;
+static void APIENTRY glad_instrument_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetObjectPtrLabel(ptr, bufSize, length, label);
+	GLStatsRecordCall(562, 0, glad_start, 0);
+}
+static PFNGLGETPOINTERVPROC glad_next_glGetPointerv;
+static void APIENTRY glad_instrument_glGetPointerv(GLenum pname, void **params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetPointerv(pname, params);
+	GLStatsRecordCall(563, 0, glad_start, 0);
+}
+static PFNGLBUFFERSTORAGEPROC glad_next_glBufferStorage;
+static void APIENTRY glad_instrument_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBufferStorage(target, size, data, flags);
+	GLStatsRecordCall(564, GL_STATS_UPLOAD, glad_start, (data ? (u64)size : 0));
+}
+static PFNGLCLEARTEXIMAGEPROC glad_next_glClearTexImage;
+static void APIENTRY glad_instrument_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearTexImage(texture, level, format, type, data);
+	GLStatsRecordCall(565, 0, glad_start, 0);
+}
+static PFNGLCLEARTEXSUBIMAGEPROC glad_next_glClearTexSubImage;
+static void APIENTRY glad_instrument_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	GLStatsRecordCall(566, 0, glad_start, 0);
+}
+static PFNGLBINDBUFFERSBASEPROC glad_next_glBindBuffersBase;
+static void APIENTRY glad_instrument_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindBuffersBase(target, first, count, buffers);
+	GLStatsRecordCall(567, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBINDBUFFERSRANGEPROC glad_next_glBindBuffersRange;
+static void APIENTRY glad_instrument_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+	GLStatsRecordCall(568, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBINDTEXTURESPROC glad_next_glBindTextures;
+static void APIENTRY glad_instrument_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindTextures(first, count, textures);
+	GLStatsRecordCall(569, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBINDSAMPLERSPROC glad_next_glBindSamplers;
+static void APIENTRY glad_instrument_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindSamplers(first, count, samplers);
+	GLStatsRecordCall(570, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBINDIMAGETEXTURESPROC glad_next_glBindImageTextures;
+static void APIENTRY glad_instrument_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindImageTextures(first, count, textures);
+	GLStatsRecordCall(571, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLBINDVERTEXBUFFERSPROC glad_next_glBindVertexBuffers;
+static void APIENTRY glad_instrument_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindVertexBuffers(first, count, buffers, offsets, strides);
+	GLStatsRecordCall(572, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLCLIPCONTROLPROC glad_next_glClipControl;
+static void APIENTRY glad_instrument_glClipControl(GLenum origin, GLenum depth) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClipControl(origin, depth);
+	GLStatsRecordCall(573, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLCREATETRANSFORMFEEDBACKSPROC glad_next_glCreateTransformFeedbacks;
+static void APIENTRY glad_instrument_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCreateTransformFeedbacks(n, ids);
+	GLStatsRecordCall(574, 0, glad_start, 0);
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_next_glTransformFeedbackBufferBase;
+static void APIENTRY glad_instrument_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTransformFeedbackBufferBase(xfb, index, buffer);
+	GLStatsRecordCall(575, 0, glad_start, 0);
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_next_glTransformFeedbackBufferRange;
+static void APIENTRY glad_instrument_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+	GLStatsRecordCall(576, 0, glad_start, 0);
+}
+static PFNGLGETTRANSFORMFEEDBACKIVPROC glad_next_glGetTransformFeedbackiv;
+static void APIENTRY glad_instrument_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTransformFeedbackiv(xfb, pname, param);
+	GLStatsRecordCall(577, 0, glad_start, 0);
+}
+static PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_next_glGetTransformFeedbacki_v;
+static void APIENTRY glad_instrument_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTransformFeedbacki_v(xfb, pname, index, param);
+	GLStatsRecordCall(578, 0, glad_start, 0);
+}
+static PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_next_glGetTransformFeedbacki64_v;
+static void APIENTRY glad_instrument_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+	GLStatsRecordCall(579, 0, glad_start, 0);
+}
+static PFNGLCREATEBUFFERSPROC glad_next_glCreateBuffers;
+static void APIENTRY glad_instrument_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCreateBuffers(n, buffers);
+	GLStatsRecordCall(580, 0, glad_start, 0);
+}
+static PFNGLNAMEDBUFFERSTORAGEPROC glad_next_glNamedBufferStorage;
+static void APIENTRY glad_instrument_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedBufferStorage(buffer, size, data, flags);
+	GLStatsRecordCall(581, GL_STATS_UPLOAD, glad_start, (data ? (u64)size : 0));
+}
+static PFNGLNAMEDBUFFERDATAPROC glad_next_glNamedBufferData;
+static void APIENTRY glad_instrument_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedBufferData(buffer, size, data, usage);
+	GLStatsRecordCall(582, GL_STATS_UPLOAD, glad_start, (u64)size);
+}
+static PFNGLNAMEDBUFFERSUBDATAPROC glad_next_glNamedBufferSubData;
+static void APIENTRY glad_instrument_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedBufferSubData(buffer, offset, size, data);
+	GLStatsRecordCall(583, GL_STATS_UPLOAD, glad_start, (u64)size);
+}
+static PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_next_glCopyNamedBufferSubData;
+static void APIENTRY glad_instrument_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	GLStatsRecordCall(584, 0, glad_start, 0);
+}
+static PFNGLCLEARNAMEDBUFFERDATAPROC glad_next_glClearNamedBufferData;
+static void APIENTRY glad_instrument_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearNamedBufferData(buffer, internalformat, format, type, data);
+	GLStatsRecordCall(585, 0, glad_start, 0);
+}
+static PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_next_glClearNamedBufferSubData;
+static void APIENTRY glad_instrument_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+	GLStatsRecordCall(586, 0, glad_start, 0);
+}
+static PFNGLMAPNAMEDBUFFERPROC glad_next_glMapNamedBuffer;
+static void * APIENTRY glad_instrument_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	u64 glad_start = ReadProfileTicks();
+	void * glad_result = glad_next_glMapNamedBuffer(buffer, access);
+	GLStatsRecordCall(587, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLMAPNAMEDBUFFERRANGEPROC glad_next_glMapNamedBufferRange;
+static void * APIENTRY glad_instrument_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	u64 glad_start = ReadProfileTicks();
+	void * glad_result = glad_next_glMapNamedBufferRange(buffer, offset, length, access);
+	GLStatsRecordCall(588, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLUNMAPNAMEDBUFFERPROC glad_next_glUnmapNamedBuffer;
+static GLboolean APIENTRY glad_instrument_glUnmapNamedBuffer(GLuint buffer) {
+	u64 glad_start = ReadProfileTicks();
+	GLboolean glad_result = glad_next_glUnmapNamedBuffer(buffer);
+	GLStatsRecordCall(589, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_next_glFlushMappedNamedBufferRange;
+static void APIENTRY glad_instrument_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glFlushMappedNamedBufferRange(buffer, offset, length);
+	GLStatsRecordCall(590, 0, glad_start, 0);
+}
+static PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_next_glGetNamedBufferParameteriv;
+static void APIENTRY glad_instrument_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetNamedBufferParameteriv(buffer, pname, params);
+	GLStatsRecordCall(591, 0, glad_start, 0);
+}
+static PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_next_glGetNamedBufferParameteri64v;
+static void APIENTRY glad_instrument_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetNamedBufferParameteri64v(buffer, pname, params);
+	GLStatsRecordCall(592, 0, glad_start, 0);
+}
+static PFNGLGETNAMEDBUFFERPOINTERVPROC glad_next_glGetNamedBufferPointerv;
+static void APIENTRY glad_instrument_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetNamedBufferPointerv(buffer, pname, params);
+	GLStatsRecordCall(593, 0, glad_start, 0);
+}
+static PFNGLGETNAMEDBUFFERSUBDATAPROC glad_next_glGetNamedBufferSubData;
+static void APIENTRY glad_instrument_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetNamedBufferSubData(buffer, offset, size, data);
+	GLStatsRecordCall(594, 0, glad_start, 0);
+}
+static PFNGLCREATEFRAMEBUFFERSPROC glad_next_glCreateFramebuffers;
+static void APIENTRY glad_instrument_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCreateFramebuffers(n, framebuffers);
+	GLStatsRecordCall(595, 0, glad_start, 0);
+}
+static PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_next_glNamedFramebufferRenderbuffer;
+static void APIENTRY glad_instrument_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+	GLStatsRecordCall(596, 0, glad_start, 0);
+}
+static PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_next_glNamedFramebufferParameteri;
+static void APIENTRY glad_instrument_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedFramebufferParameteri(framebuffer, pname, param);
+	GLStatsRecordCall(597, 0, glad_start, 0);
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_next_glNamedFramebufferTexture;
+static void APIENTRY glad_instrument_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+	GLStatsRecordCall(598, 0, glad_start, 0);
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_next_glNamedFramebufferTextureLayer;
+static void APIENTRY glad_instrument_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+	GLStatsRecordCall(599, 0, glad_start, 0);
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_next_glNamedFramebufferDrawBuffer;
+static void APIENTRY glad_instrument_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedFramebufferDrawBuffer(framebuffer, buf);
+	GLStatsRecordCall(600, 0, glad_start, 0);
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_next_glNamedFramebufferDrawBuffers;
+static void APIENTRY glad_instrument_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+	GLStatsRecordCall(601, 0, glad_start, 0);
+}
+static PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_next_glNamedFramebufferReadBuffer;
+static void APIENTRY glad_instrument_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedFramebufferReadBuffer(framebuffer, src);
+	GLStatsRecordCall(602, 0, glad_start, 0);
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_next_glInvalidateNamedFramebufferData;
+static void APIENTRY glad_instrument_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+	GLStatsRecordCall(603, 0, glad_start, 0);
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_next_glInvalidateNamedFramebufferSubData;
+static void APIENTRY glad_instrument_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+	GLStatsRecordCall(604, 0, glad_start, 0);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_next_glClearNamedFramebufferiv;
+static void APIENTRY glad_instrument_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+	GLStatsRecordCall(605, 0, glad_start, 0);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_next_glClearNamedFramebufferuiv;
+static void APIENTRY glad_instrument_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+	GLStatsRecordCall(606, 0, glad_start, 0);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_next_glClearNamedFramebufferfv;
+static void APIENTRY glad_instrument_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+	GLStatsRecordCall(607, 0, glad_start, 0);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_next_glClearNamedFramebufferfi;
+static void APIENTRY glad_instrument_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+	GLStatsRecordCall(608, 0, glad_start, 0);
+}
+static PFNGLBLITNAMEDFRAMEBUFFERPROC glad_next_glBlitNamedFramebuffer;
+static void APIENTRY glad_instrument_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	GLStatsRecordCall(609, 0, glad_start, 0);
+}
+static PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_next_glCheckNamedFramebufferStatus;
+static GLenum APIENTRY glad_instrument_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+	u64 glad_start = ReadProfileTicks();
+	GLenum glad_result = glad_next_glCheckNamedFramebufferStatus(framebuffer, target);
+	GLStatsRecordCall(610, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_next_glGetNamedFramebufferParameteriv;
+static void APIENTRY glad_instrument_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+	GLStatsRecordCall(611, 0, glad_start, 0);
+}
+static PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_next_glGetNamedFramebufferAttachmentParameteriv;
+static void APIENTRY glad_instrument_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+	GLStatsRecordCall(612, 0, glad_start, 0);
+}
+static PFNGLCREATERENDERBUFFERSPROC glad_next_glCreateRenderbuffers;
+static void APIENTRY glad_instrument_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCreateRenderbuffers(n, renderbuffers);
+	GLStatsRecordCall(613, 0, glad_start, 0);
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_next_glNamedRenderbufferStorage;
+static void APIENTRY glad_instrument_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+	GLStatsRecordCall(614, 0, glad_start, 0);
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_next_glNamedRenderbufferStorageMultisample;
+static void APIENTRY glad_instrument_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+	GLStatsRecordCall(615, 0, glad_start, 0);
+}
+static PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_next_glGetNamedRenderbufferParameteriv;
+static void APIENTRY glad_instrument_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+	GLStatsRecordCall(616, 0, glad_start, 0);
+}
+static PFNGLCREATETEXTURESPROC glad_next_glCreateTextures;
+static void APIENTRY glad_instrument_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCreateTextures(target, n, textures);
+	GLStatsRecordCall(617, 0, glad_start, 0);
+}
+static PFNGLTEXTUREBUFFERPROC glad_next_glTextureBuffer;
+static void APIENTRY glad_instrument_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureBuffer(texture, internalformat, buffer);
+	GLStatsRecordCall(618, 0, glad_start, 0);
+}
+static PFNGLTEXTUREBUFFERRANGEPROC glad_next_glTextureBufferRange;
+static void APIENTRY glad_instrument_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+	GLStatsRecordCall(619, 0, glad_start, 0);
+}
+static PFNGLTEXTURESTORAGE1DPROC glad_next_glTextureStorage1D;
+static void APIENTRY glad_instrument_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureStorage1D(texture, levels, internalformat, width);
+	GLStatsRecordCall(620, 0, glad_start, 0);
+}
+static PFNGLTEXTURESTORAGE2DPROC glad_next_glTextureStorage2D;
+static void APIENTRY glad_instrument_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureStorage2D(texture, levels, internalformat, width, height);
+	GLStatsRecordCall(621, 0, glad_start, 0);
+}
+static PFNGLTEXTURESTORAGE3DPROC glad_next_glTextureStorage3D;
+static void APIENTRY glad_instrument_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+	GLStatsRecordCall(622, 0, glad_start, 0);
+}
+static PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_next_glTextureStorage2DMultisample;
+static void APIENTRY glad_instrument_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+	GLStatsRecordCall(623, 0, glad_start, 0);
+}
+static PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_next_glTextureStorage3DMultisample;
+static void APIENTRY glad_instrument_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+	GLStatsRecordCall(624, 0, glad_start, 0);
+}
+static PFNGLTEXTURESUBIMAGE1DPROC glad_next_glTextureSubImage1D;
+static void APIENTRY glad_instrument_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+	GLStatsRecordCall(625, 0, glad_start, 0);
+}
+static PFNGLTEXTURESUBIMAGE2DPROC glad_next_glTextureSubImage2D;
+static void APIENTRY glad_instrument_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+	GLStatsRecordCall(626, 0, glad_start, 0);
+}
+static PFNGLTEXTURESUBIMAGE3DPROC glad_next_glTextureSubImage3D;
+static void APIENTRY glad_instrument_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	GLStatsRecordCall(627, 0, glad_start, 0);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_next_glCompressedTextureSubImage1D;
+static void APIENTRY glad_instrument_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+	GLStatsRecordCall(628, 0, glad_start, 0);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_next_glCompressedTextureSubImage2D;
+static void APIENTRY glad_instrument_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+	GLStatsRecordCall(629, 0, glad_start, 0);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_next_glCompressedTextureSubImage3D;
+static void APIENTRY glad_instrument_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	GLStatsRecordCall(630, 0, glad_start, 0);
+}
+static PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_next_glCopyTextureSubImage1D;
+static void APIENTRY glad_instrument_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+	GLStatsRecordCall(631, 0, glad_start, 0);
+}
+static PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_next_glCopyTextureSubImage2D;
+static void APIENTRY glad_instrument_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+	GLStatsRecordCall(632, 0, glad_start, 0);
+}
+static PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_next_glCopyTextureSubImage3D;
+static void APIENTRY glad_instrument_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+	GLStatsRecordCall(633, 0, glad_start, 0);
+}
+static PFNGLTEXTUREPARAMETERFPROC glad_next_glTextureParameterf;
+static void APIENTRY glad_instrument_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureParameterf(texture, pname, param);
+	GLStatsRecordCall(634, 0, glad_start, 0);
+}
+static PFNGLTEXTUREPARAMETERFVPROC glad_next_glTextureParameterfv;
+static void APIENTRY glad_instrument_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureParameterfv(texture, pname, param);
+	GLStatsRecordCall(635, 0, glad_start, 0);
+}
+static PFNGLTEXTUREPARAMETERIPROC glad_next_glTextureParameteri;
+static void APIENTRY glad_instrument_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureParameteri(texture, pname, param);
+	GLStatsRecordCall(636, 0, glad_start, 0);
+}
+static PFNGLTEXTUREPARAMETERIIVPROC glad_next_glTextureParameterIiv;
+static void APIENTRY glad_instrument_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureParameterIiv(texture, pname, params);
+	GLStatsRecordCall(637, 0, glad_start, 0);
+}
+static PFNGLTEXTUREPARAMETERIUIVPROC glad_next_glTextureParameterIuiv;
+static void APIENTRY glad_instrument_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureParameterIuiv(texture, pname, params);
+	GLStatsRecordCall(638, 0, glad_start, 0);
+}
+static PFNGLTEXTUREPARAMETERIVPROC glad_next_glTextureParameteriv;
+static void APIENTRY glad_instrument_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureParameteriv(texture, pname, param);
+	GLStatsRecordCall(639, 0, glad_start, 0);
+}
+static PFNGLGENERATETEXTUREMIPMAPPROC glad_next_glGenerateTextureMipmap;
+static void APIENTRY glad_instrument_glGenerateTextureMipmap(GLuint texture) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGenerateTextureMipmap(texture);
+	GLStatsRecordCall(640, 0, glad_start, 0);
+}
+static PFNGLBINDTEXTUREUNITPROC glad_next_glBindTextureUnit;
+static void APIENTRY glad_instrument_glBindTextureUnit(GLuint unit, GLuint texture) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glBindTextureUnit(unit, texture);
+	GLStatsRecordCall(641, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLGETTEXTUREIMAGEPROC glad_next_glGetTextureImage;
+static void APIENTRY glad_instrument_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+	GLStatsRecordCall(642, 0, glad_start, 0);
+}
+static PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_next_glGetCompressedTextureImage;
+static void APIENTRY glad_instrument_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+	GLStatsRecordCall(643, 0, glad_start, 0);
+}
+static PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_next_glGetTextureLevelParameterfv;
+static void APIENTRY glad_instrument_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTextureLevelParameterfv(texture, level, pname, params);
+	GLStatsRecordCall(644, 0, glad_start, 0);
+}
+static PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_next_glGetTextureLevelParameteriv;
+static void APIENTRY glad_instrument_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTextureLevelParameteriv(texture, level, pname, params);
+	GLStatsRecordCall(645, 0, glad_start, 0);
+}
+static PFNGLGETTEXTUREPARAMETERFVPROC glad_next_glGetTextureParameterfv;
+static void APIENTRY glad_instrument_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTextureParameterfv(texture, pname, params);
+	GLStatsRecordCall(646, 0, glad_start, 0);
+}
+static PFNGLGETTEXTUREPARAMETERIIVPROC glad_next_glGetTextureParameterIiv;
+static void APIENTRY glad_instrument_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTextureParameterIiv(texture, pname, params);
+	GLStatsRecordCall(647, 0, glad_start, 0);
+}
+static PFNGLGETTEXTUREPARAMETERIUIVPROC glad_next_glGetTextureParameterIuiv;
+static void APIENTRY glad_instrument_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTextureParameterIuiv(texture, pname, params);
+	GLStatsRecordCall(648, 0, glad_start, 0);
+}
+static PFNGLGETTEXTUREPARAMETERIVPROC glad_next_glGetTextureParameteriv;
+static void APIENTRY glad_instrument_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTextureParameteriv(texture, pname, params);
+	GLStatsRecordCall(649, 0, glad_start, 0);
+}
+static PFNGLCREATEVERTEXARRAYSPROC glad_next_glCreateVertexArrays;
+static void APIENTRY glad_instrument_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCreateVertexArrays(n, arrays);
+	GLStatsRecordCall(650, 0, glad_start, 0);
+}
+static PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_next_glDisableVertexArrayAttrib;
+static void APIENTRY glad_instrument_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glDisableVertexArrayAttrib(vaobj, index);
+	GLStatsRecordCall(651, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLENABLEVERTEXARRAYATTRIBPROC glad_next_glEnableVertexArrayAttrib;
+static void APIENTRY glad_instrument_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glEnableVertexArrayAttrib(vaobj, index);
+	GLStatsRecordCall(652, GL_STATS_STATE, glad_start, 0);
+}
+static PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_next_glVertexArrayElementBuffer;
+static void APIENTRY glad_instrument_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexArrayElementBuffer(vaobj, buffer);
+	GLStatsRecordCall(653, 0, glad_start, 0);
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_next_glVertexArrayVertexBuffer;
+static void APIENTRY glad_instrument_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+	GLStatsRecordCall(654, 0, glad_start, 0);
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_next_glVertexArrayVertexBuffers;
+static void APIENTRY glad_instrument_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+	GLStatsRecordCall(655, 0, glad_start, 0);
+}
+static PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_next_glVertexArrayAttribBinding;
+static void APIENTRY glad_instrument_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+	GLStatsRecordCall(656, 0, glad_start, 0);
+}
+static PFNGLVERTEXARRAYATTRIBFORMATPROC glad_next_glVertexArrayAttribFormat;
+static void APIENTRY glad_instrument_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+	GLStatsRecordCall(657, 0, glad_start, 0);
+}
+static PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_next_glVertexArrayAttribIFormat;
+static void APIENTRY glad_instrument_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+	GLStatsRecordCall(658, 0, glad_start, 0);
+}
+static PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_next_glVertexArrayAttribLFormat;
+static void APIENTRY glad_instrument_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+	GLStatsRecordCall(659, 0, glad_start, 0);
+}
+static PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_next_glVertexArrayBindingDivisor;
+static void APIENTRY glad_instrument_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+	GLStatsRecordCall(660, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXARRAYIVPROC glad_next_glGetVertexArrayiv;
+static void APIENTRY glad_instrument_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexArrayiv(vaobj, pname, param);
+	GLStatsRecordCall(661, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_next_glGetVertexArrayIndexediv;
+static void APIENTRY glad_instrument_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+	GLStatsRecordCall(662, 0, glad_start, 0);
+}
+static PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_next_glGetVertexArrayIndexed64iv;
+static void APIENTRY glad_instrument_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+	GLStatsRecordCall(663, 0, glad_start, 0);
+}
+static PFNGLCREATESAMPLERSPROC glad_next_glCreateSamplers;
+static void APIENTRY glad_instrument_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCreateSamplers(n, samplers);
+	GLStatsRecordCall(664, 0, glad_start, 0);
+}
+static PFNGLCREATEPROGRAMPIPELINESPROC glad_next_glCreateProgramPipelines;
+static void APIENTRY glad_instrument_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCreateProgramPipelines(n, pipelines);
+	GLStatsRecordCall(665, 0, glad_start, 0);
+}
+static PFNGLCREATEQUERIESPROC glad_next_glCreateQueries;
+static void APIENTRY glad_instrument_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glCreateQueries(target, n, ids);
+	GLStatsRecordCall(666, 0, glad_start, 0);
+}
+static PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_next_glGetQueryBufferObjecti64v;
+static void APIENTRY glad_instrument_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+	GLStatsRecordCall(667, 0, glad_start, 0);
+}
+static PFNGLGETQUERYBUFFEROBJECTIVPROC glad_next_glGetQueryBufferObjectiv;
+static void APIENTRY glad_instrument_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+	GLStatsRecordCall(668, 0, glad_start, 0);
+}
+static PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_next_glGetQueryBufferObjectui64v;
+static void APIENTRY glad_instrument_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+	GLStatsRecordCall(669, 0, glad_start, 0);
+}
+static PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_next_glGetQueryBufferObjectuiv;
+static void APIENTRY glad_instrument_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+	GLStatsRecordCall(670, 0, glad_start, 0);
+}
+static PFNGLMEMORYBARRIERBYREGIONPROC glad_next_glMemoryBarrierByRegion;
+static void APIENTRY glad_instrument_glMemoryBarrierByRegion(GLbitfield barriers) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glMemoryBarrierByRegion(barriers);
+	GLStatsRecordCall(671, 0, glad_start, 0);
+}
+static PFNGLGETTEXTURESUBIMAGEPROC glad_next_glGetTextureSubImage;
+static void APIENTRY glad_instrument_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+	GLStatsRecordCall(672, 0, glad_start, 0);
+}
+static PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_next_glGetCompressedTextureSubImage;
+static void APIENTRY glad_instrument_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+	GLStatsRecordCall(673, 0, glad_start, 0);
+}
+static PFNGLGETGRAPHICSRESETSTATUSPROC glad_next_glGetGraphicsResetStatus;
+static GLenum APIENTRY glad_instrument_glGetGraphicsResetStatus(void) {
+	u64 glad_start = ReadProfileTicks();
+	GLenum glad_result = glad_next_glGetGraphicsResetStatus();
+	GLStatsRecordCall(674, 0, glad_start, 0);
+	return glad_result;
+}
+static PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_next_glGetnCompressedTexImage;
+static void APIENTRY glad_instrument_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+	GLStatsRecordCall(675, 0, glad_start, 0);
+}
+static PFNGLGETNTEXIMAGEPROC glad_next_glGetnTexImage;
+static void APIENTRY glad_instrument_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnTexImage(target, level, format, type, bufSize, pixels);
+	GLStatsRecordCall(676, 0, glad_start, 0);
+}
+static PFNGLGETNUNIFORMDVPROC glad_next_glGetnUniformdv;
+static void APIENTRY glad_instrument_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnUniformdv(program, location, bufSize, params);
+	GLStatsRecordCall(677, 0, glad_start, 0);
+}
+static PFNGLGETNUNIFORMFVPROC glad_next_glGetnUniformfv;
+static void APIENTRY glad_instrument_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnUniformfv(program, location, bufSize, params);
+	GLStatsRecordCall(678, 0, glad_start, 0);
+}
+static PFNGLGETNUNIFORMIVPROC glad_next_glGetnUniformiv;
+static void APIENTRY glad_instrument_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnUniformiv(program, location, bufSize, params);
+	GLStatsRecordCall(679, 0, glad_start, 0);
+}
+static PFNGLGETNUNIFORMUIVPROC glad_next_glGetnUniformuiv;
+static void APIENTRY glad_instrument_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnUniformuiv(program, location, bufSize, params);
+	GLStatsRecordCall(680, 0, glad_start, 0);
+}
+static PFNGLREADNPIXELSPROC glad_next_glReadnPixels;
+static void APIENTRY glad_instrument_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+	GLStatsRecordCall(681, 0, glad_start, 0);
+}
+static PFNGLGETNMAPDVPROC glad_next_glGetnMapdv;
+static void APIENTRY glad_instrument_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnMapdv(target, query, bufSize, v);
+	GLStatsRecordCall(682, 0, glad_start, 0);
+}
+static PFNGLGETNMAPFVPROC glad_next_glGetnMapfv;
+static void APIENTRY glad_instrument_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnMapfv(target, query, bufSize, v);
+	GLStatsRecordCall(683, 0, glad_start, 0);
+}
+static PFNGLGETNMAPIVPROC glad_next_glGetnMapiv;
+static void APIENTRY glad_instrument_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnMapiv(target, query, bufSize, v);
+	GLStatsRecordCall(684, 0, glad_start, 0);
+}
+static PFNGLGETNPIXELMAPFVPROC glad_next_glGetnPixelMapfv;
+static void APIENTRY glad_instrument_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnPixelMapfv(map, bufSize, values);
+	GLStatsRecordCall(685, 0, glad_start, 0);
+}
+static PFNGLGETNPIXELMAPUIVPROC glad_next_glGetnPixelMapuiv;
+static void APIENTRY glad_instrument_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnPixelMapuiv(map, bufSize, values);
+	GLStatsRecordCall(686, 0, glad_start, 0);
+}
+static PFNGLGETNPIXELMAPUSVPROC glad_next_glGetnPixelMapusv;
+static void APIENTRY glad_instrument_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnPixelMapusv(map, bufSize, values);
+	GLStatsRecordCall(687, 0, glad_start, 0);
+}
+static PFNGLGETNPOLYGONSTIPPLEPROC glad_next_glGetnPolygonStipple;
+static void APIENTRY glad_instrument_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnPolygonStipple(bufSize, pattern);
+	GLStatsRecordCall(688, 0, glad_start, 0);
+}
+static PFNGLGETNCOLORTABLEPROC glad_next_glGetnColorTable;
+static void APIENTRY glad_instrument_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnColorTable(target, format, type, bufSize, table);
+	GLStatsRecordCall(689, 0, glad_start, 0);
+}
+static PFNGLGETNCONVOLUTIONFILTERPROC glad_next_glGetnConvolutionFilter;
+static void APIENTRY glad_instrument_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnConvolutionFilter(target, format, type, bufSize, image);
+	GLStatsRecordCall(690, 0, glad_start, 0);
+}
+static PFNGLGETNSEPARABLEFILTERPROC glad_next_glGetnSeparableFilter;
+static void APIENTRY glad_instrument_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+	GLStatsRecordCall(691, 0, glad_start, 0);
+}
+static PFNGLGETNHISTOGRAMPROC glad_next_glGetnHistogram;
+static void APIENTRY glad_instrument_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnHistogram(target, reset, format, type, bufSize, values);
+	GLStatsRecordCall(692, 0, glad_start, 0);
+}
+static PFNGLGETNMINMAXPROC glad_next_glGetnMinmax;
+static void APIENTRY glad_instrument_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glGetnMinmax(target, reset, format, type, bufSize, values);
+	GLStatsRecordCall(693, 0, glad_start, 0);
+}
+static PFNGLTEXTUREBARRIERPROC glad_next_glTextureBarrier;
+static void APIENTRY glad_instrument_glTextureBarrier(void) {
+	u64 glad_start = ReadProfileTicks();
+	glad_next_glTextureBarrier();
+	GLStatsRecordCall(694, 0, glad_start, 0);
+}
+
+void gladInstrumentInstall(void) {
+	if (glad_glCullFace != NULL && glad_glCullFace != glad_instrument_glCullFace) {
+		glad_next_glCullFace = glad_glCullFace;
+		glad_glCullFace = glad_instrument_glCullFace;
+	}
+	if (glad_glFrontFace != NULL && glad_glFrontFace != glad_instrument_glFrontFace) {
+		glad_next_glFrontFace = glad_glFrontFace;
+		glad_glFrontFace = glad_instrument_glFrontFace;
+	}
+	if (glad_glHint != NULL && glad_glHint != glad_instrument_glHint) {
+		glad_next_glHint = glad_glHint;
+		glad_glHint = glad_instrument_glHint;
+	}
+	if (glad_glLineWidth != NULL && glad_glLineWidth != glad_instrument_glLineWidth) {
+		glad_next_glLineWidth = glad_glLineWidth;
+		glad_glLineWidth = glad_instrument_glLineWidth;
+	}
+	if (glad_glPointSize != NULL && glad_glPointSize != glad_instrument_glPointSize) {
+		glad_next_glPointSize = glad_glPointSize;
+		glad_glPointSize = glad_instrument_glPointSize;
+	}
+	if (glad_glPolygonMode != NULL && glad_glPolygonMode != glad_instrument_glPolygonMode) {
+		glad_next_glPolygonMode = glad_glPolygonMode;
+		glad_glPolygonMode = glad_instrument_glPolygonMode;
+	}
+	if (glad_glScissor != NULL && glad_glScissor != glad_instrument_glScissor) {
+		glad_next_glScissor = glad_glScissor;
+		glad_glScissor = glad_instrument_glScissor;
+	}
+	if (glad_glTexParameterf != NULL && glad_glTexParameterf != glad_instrument_glTexParameterf) {
+		glad_next_glTexParameterf = glad_glTexParameterf;
+		glad_glTexParameterf = glad_instrument_glTexParameterf;
+	}
+	if (glad_glTexParameterfv != NULL && glad_glTexParameterfv != glad_instrument_glTexParameterfv) {
+		glad_next_glTexParameterfv = glad_glTexParameterfv;
+		glad_glTexParameterfv = glad_instrument_glTexParameterfv;
+	}
+	if (glad_glTexParameteri != NULL && glad_glTexParameteri != glad_instrument_glTexParameteri) {
+		glad_next_glTexParameteri = glad_glTexParameteri;
+		glad_glTexParameteri = glad_instrument_glTexParameteri;
+	}
+	if (glad_glTexParameteriv != NULL && glad_glTexParameteriv != glad_instrument_glTexParameteriv) {
+		glad_next_glTexParameteriv = glad_glTexParameteriv;
+		glad_glTexParameteriv = glad_instrument_glTexParameteriv;
+	}
+	if (glad_glTexImage1D != NULL && glad_glTexImage1D != glad_instrument_glTexImage1D) {
+		glad_next_glTexImage1D = glad_glTexImage1D;
+		glad_glTexImage1D = glad_instrument_glTexImage1D;
+	}
+	if (glad_glTexImage2D != NULL && glad_glTexImage2D != glad_instrument_glTexImage2D) {
+		glad_next_glTexImage2D = glad_glTexImage2D;
+		glad_glTexImage2D = glad_instrument_glTexImage2D;
+	}
+	if (glad_glDrawBuffer != NULL && glad_glDrawBuffer != glad_instrument_glDrawBuffer) {
+		glad_next_glDrawBuffer = glad_glDrawBuffer;
+		glad_glDrawBuffer = glad_instrument_glDrawBuffer;
+	}
+	if (glad_glClear != NULL && glad_glClear != glad_instrument_glClear) {
+		glad_next_glClear = glad_glClear;
+		glad_glClear = glad_instrument_glClear;
+	}
+	if (glad_glClearColor != NULL && glad_glClearColor != glad_instrument_glClearColor) {
+		glad_next_glClearColor = glad_glClearColor;
+		glad_glClearColor = glad_instrument_glClearColor;
+	}
+	if (glad_glClearStencil != NULL && glad_glClearStencil != glad_instrument_glClearStencil) {
+		glad_next_glClearStencil = glad_glClearStencil;
+		glad_glClearStencil = glad_instrument_glClearStencil;
+	}
+	if (glad_glClearDepth != NULL && glad_glClearDepth != glad_instrument_glClearDepth) {
+		glad_next_glClearDepth = glad_glClearDepth;
+		glad_glClearDepth = glad_instrument_glClearDepth;
+	}
+	if (glad_glStencilMask != NULL && glad_glStencilMask != glad_instrument_glStencilMask) {
+		glad_next_glStencilMask = glad_glStencilMask;
+		glad_glStencilMask = glad_instrument_glStencilMask;
+	}
+	if (glad_glColorMask != NULL && glad_glColorMask != glad_instrument_glColorMask) {
+		glad_next_glColorMask = glad_glColorMask;
+		glad_glColorMask = glad_instrument_glColorMask;
+	}
+	if (glad_glDepthMask != NULL && glad_glDepthMask != glad_instrument_glDepthMask) {
+		glad_next_glDepthMask = glad_glDepthMask;
+		glad_glDepthMask = glad_instrument_glDepthMask;
+	}
+	if (glad_glDisable != NULL && glad_glDisable != glad_instrument_glDisable) {
+		glad_next_glDisable = glad_glDisable;
+		glad_glDisable = glad_instrument_glDisable;
+	}
+	if (glad_glEnable != NULL && glad_glEnable != glad_instrument_glEnable) {
+		glad_next_glEnable = glad_glEnable;
+		glad_glEnable = glad_instrument_glEnable;
+	}
+	if (glad_glFinish != NULL && glad_glFinish != glad_instrument_glFinish) {
+		glad_next_glFinish = glad_glFinish;
+		glad_glFinish = glad_instrument_glFinish;
+	}
+	if (glad_glFlush != NULL && glad_glFlush != glad_instrument_glFlush) {
+		glad_next_glFlush = glad_glFlush;
+		glad_glFlush = glad_instrument_glFlush;
+	}
+	if (glad_glBlendFunc != NULL && glad_glBlendFunc != glad_instrument_glBlendFunc) {
+		glad_next_glBlendFunc = glad_glBlendFunc;
+		glad_glBlendFunc = glad_instrument_glBlendFunc;
+	}
+	if (glad_glLogicOp != NULL && glad_glLogicOp != glad_instrument_glLogicOp) {
+		glad_next_glLogicOp = glad_glLogicOp;
+		glad_glLogicOp = glad_instrument_glLogicOp;
+	}
+	if (glad_glStencilFunc != NULL && glad_glStencilFunc != glad_instrument_glStencilFunc) {
+		glad_next_glStencilFunc = glad_glStencilFunc;
+		glad_glStencilFunc = glad_instrument_glStencilFunc;
+	}
+	if (glad_glStencilOp != NULL && glad_glStencilOp != glad_instrument_glStencilOp) {
+		glad_next_glStencilOp = glad_glStencilOp;
+		glad_glStencilOp = glad_instrument_glStencilOp;
+	}
+	if (glad_glDepthFunc != NULL && glad_glDepthFunc != glad_instrument_glDepthFunc) {
+		glad_next_glDepthFunc = glad_glDepthFunc;
+		glad_glDepthFunc = glad_instrument_glDepthFunc;
+	}
+	if (glad_glPixelStoref != NULL && glad_glPixelStoref != glad_instrument_glPixelStoref) {
+		glad_next_glPixelStoref = glad_glPixelStoref;
+		glad_glPixelStoref = glad_instrument_glPixelStoref;
+	}
+	if (glad_glPixelStorei != NULL && glad_glPixelStorei != glad_instrument_glPixelStorei) {
+		glad_next_glPixelStorei = glad_glPixelStorei;
+		glad_glPixelStorei = glad_instrument_glPixelStorei;
+	}
+	if (glad_glReadBuffer != NULL && glad_glReadBuffer != glad_instrument_glReadBuffer) {
+		glad_next_glReadBuffer = glad_glReadBuffer;
+		glad_glReadBuffer = glad_instrument_glReadBuffer;
+	}
+	if (glad_glReadPixels != NULL && glad_glReadPixels != glad_instrument_glReadPixels) {
+		glad_next_glReadPixels = glad_glReadPixels;
+		glad_glReadPixels = glad_instrument_glReadPixels;
+	}
+	if (glad_glGetBooleanv != NULL && glad_glGetBooleanv != glad_instrument_glGetBooleanv) {
+		glad_next_glGetBooleanv = glad_glGetBooleanv;
+		glad_glGetBooleanv = glad_instrument_glGetBooleanv;
+	}
+	if (glad_glGetDoublev != NULL && glad_glGetDoublev != glad_instrument_glGetDoublev) {
+		glad_next_glGetDoublev = glad_glGetDoublev;
+		glad_glGetDoublev = glad_instrument_glGetDoublev;
+	}
+	if (glad_glGetError != NULL && glad_glGetError != glad_instrument_glGetError) {
+		glad_next_glGetError = glad_glGetError;
+		glad_glGetError = glad_instrument_glGetError;
+	}
+	if (glad_glGetFloatv != NULL && glad_glGetFloatv != glad_instrument_glGetFloatv) {
+		glad_next_glGetFloatv = glad_glGetFloatv;
+		glad_glGetFloatv = glad_instrument_glGetFloatv;
+	}
+	if (glad_glGetIntegerv != NULL && glad_glGetIntegerv != glad_instrument_glGetIntegerv) {
+		glad_next_glGetIntegerv = glad_glGetIntegerv;
+		glad_glGetIntegerv = glad_instrument_glGetIntegerv;
+	}
+	if (glad_glGetString != NULL && glad_glGetString != glad_instrument_glGetString) {
+		glad_next_glGetString = glad_glGetString;
+		glad_glGetString = glad_instrument_glGetString;
+	}
+	if (glad_glGetTexImage != NULL && glad_glGetTexImage != glad_instrument_glGetTexImage) {
+		glad_next_glGetTexImage = glad_glGetTexImage;
+		glad_glGetTexImage = glad_instrument_glGetTexImage;
+	}
+	if (glad_glGetTexParameterfv != NULL && glad_glGetTexParameterfv != glad_instrument_glGetTexParameterfv) {
+		glad_next_glGetTexParameterfv = glad_glGetTexParameterfv;
+		glad_glGetTexParameterfv = glad_instrument_glGetTexParameterfv;
+	}
+	if (glad_glGetTexParameteriv != NULL && glad_glGetTexParameteriv != glad_instrument_glGetTexParameteriv) {
+		glad_next_glGetTexParameteriv = glad_glGetTexParameteriv;
+		glad_glGetTexParameteriv = glad_instrument_glGetTexParameteriv;
+	}
+	if (glad_glGetTexLevelParameterfv != NULL && glad_glGetTexLevelParameterfv != glad_instrument_glGetTexLevelParameterfv) {
+		glad_next_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+		glad_glGetTexLevelParameterfv = glad_instrument_glGetTexLevelParameterfv;
+	}
+	if (glad_glGetTexLevelParameteriv != NULL && glad_glGetTexLevelParameteriv != glad_instrument_glGetTexLevelParameteriv) {
+		glad_next_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+		glad_glGetTexLevelParameteriv = glad_instrument_glGetTexLevelParameteriv;
+	}
+	if (glad_glIsEnabled != NULL && glad_glIsEnabled != glad_instrument_glIsEnabled) {
+		glad_next_glIsEnabled = glad_glIsEnabled;
+		glad_glIsEnabled = glad_instrument_glIsEnabled;
+	}
+	if (glad_glDepthRange != NULL && glad_glDepthRange != glad_instrument_glDepthRange) {
+		glad_next_glDepthRange = glad_glDepthRange;
+		glad_glDepthRange = glad_instrument_glDepthRange;
+	}
+	if (glad_glViewport != NULL && glad_glViewport != glad_instrument_glViewport) {
+		glad_next_glViewport = glad_glViewport;
+		glad_glViewport = glad_instrument_glViewport;
+	}
+	if (glad_glDrawArrays != NULL && glad_glDrawArrays != glad_instrument_glDrawArrays) {
+		glad_next_glDrawArrays = glad_glDrawArrays;
+		glad_glDrawArrays = glad_instrument_glDrawArrays;
+	}
+	if (glad_glDrawElements != NULL && glad_glDrawElements != glad_instrument_glDrawElements) {
+		glad_next_glDrawElements = glad_glDrawElements;
+		glad_glDrawElements = glad_instrument_glDrawElements;
+	}
+	if (glad_glPolygonOffset != NULL && glad_glPolygonOffset != glad_instrument_glPolygonOffset) {
+		glad_next_glPolygonOffset = glad_glPolygonOffset;
+		glad_glPolygonOffset = glad_instrument_glPolygonOffset;
+	}
+	if (glad_glCopyTexImage1D != NULL && glad_glCopyTexImage1D != glad_instrument_glCopyTexImage1D) {
+		glad_next_glCopyTexImage1D = glad_glCopyTexImage1D;
+		glad_glCopyTexImage1D = glad_instrument_glCopyTexImage1D;
+	}
+	if (glad_glCopyTexImage2D != NULL && glad_glCopyTexImage2D != glad_instrument_glCopyTexImage2D) {
+		glad_next_glCopyTexImage2D = glad_glCopyTexImage2D;
+		glad_glCopyTexImage2D = glad_instrument_glCopyTexImage2D;
+	}
+	if (glad_glCopyTexSubImage1D != NULL && glad_glCopyTexSubImage1D != glad_instrument_glCopyTexSubImage1D) {
+		glad_next_glCopyTexSubImage1D = glad_glCopyTexSubImage1D;
+		glad_glCopyTexSubImage1D = glad_instrument_glCopyTexSubImage1D;
+	}
+	if (glad_glCopyTexSubImage2D != NULL && glad_glCopyTexSubImage2D != glad_instrument_glCopyTexSubImage2D) {
+		glad_next_glCopyTexSubImage2D = glad_glCopyTexSubImage2D;
+		glad_glCopyTexSubImage2D = glad_instrument_glCopyTexSubImage2D;
+	}
+	if (glad_glTexSubImage1D != NULL && glad_glTexSubImage1D != glad_instrument_glTexSubImage1D) {
+		glad_next_glTexSubImage1D = glad_glTexSubImage1D;
+		glad_glTexSubImage1D = glad_instrument_glTexSubImage1D;
+	}
+	if (glad_glTexSubImage2D != NULL && glad_glTexSubImage2D != glad_instrument_glTexSubImage2D) {
+		glad_next_glTexSubImage2D = glad_glTexSubImage2D;
+		glad_glTexSubImage2D = glad_instrument_glTexSubImage2D;
+	}
+	if (glad_glBindTexture != NULL && glad_glBindTexture != glad_instrument_glBindTexture) {
+		glad_next_glBindTexture = glad_glBindTexture;
+		glad_glBindTexture = glad_instrument_glBindTexture;
+	}
+	if (glad_glDeleteTextures != NULL && glad_glDeleteTextures != glad_instrument_glDeleteTextures) {
+		glad_next_glDeleteTextures = glad_glDeleteTextures;
+		glad_glDeleteTextures = glad_instrument_glDeleteTextures;
+	}
+	if (glad_glGenTextures != NULL && glad_glGenTextures != glad_instrument_glGenTextures) {
+		glad_next_glGenTextures = glad_glGenTextures;
+		glad_glGenTextures = glad_instrument_glGenTextures;
+	}
+	if (glad_glIsTexture != NULL && glad_glIsTexture != glad_instrument_glIsTexture) {
+		glad_next_glIsTexture = glad_glIsTexture;
+		glad_glIsTexture = glad_instrument_glIsTexture;
+	}
+	if (glad_glDrawRangeElements != NULL && glad_glDrawRangeElements != glad_instrument_glDrawRangeElements) {
+		glad_next_glDrawRangeElements = glad_glDrawRangeElements;
+		glad_glDrawRangeElements = glad_instrument_glDrawRangeElements;
+	}
+	if (glad_glTexImage3D != NULL && glad_glTexImage3D != glad_instrument_glTexImage3D) {
+		glad_next_glTexImage3D = glad_glTexImage3D;
+		glad_glTexImage3D = glad_instrument_glTexImage3D;
+	}
+	if (glad_glTexSubImage3D != NULL && glad_glTexSubImage3D != glad_instrument_glTexSubImage3D) {
+		glad_next_glTexSubImage3D = glad_glTexSubImage3D;
+		glad_glTexSubImage3D = glad_instrument_glTexSubImage3D;
+	}
+	if (glad_glCopyTexSubImage3D != NULL && glad_glCopyTexSubImage3D != glad_instrument_glCopyTexSubImage3D) {
+		glad_next_glCopyTexSubImage3D = glad_glCopyTexSubImage3D;
+		glad_glCopyTexSubImage3D = glad_instrument_glCopyTexSubImage3D;
+	}
+	if (glad_glActiveTexture != NULL && glad_glActiveTexture != glad_instrument_glActiveTexture) {
+		glad_next_glActiveTexture = glad_glActiveTexture;
+		glad_glActiveTexture = glad_instrument_glActiveTexture;
+	}
+	if (glad_glSampleCoverage != NULL && glad_glSampleCoverage != glad_instrument_glSampleCoverage) {
+		glad_next_glSampleCoverage = glad_glSampleCoverage;
+		glad_glSampleCoverage = glad_instrument_glSampleCoverage;
+	}
+	if (glad_glCompressedTexImage3D != NULL && glad_glCompressedTexImage3D != glad_instrument_glCompressedTexImage3D) {
+		glad_next_glCompressedTexImage3D = glad_glCompressedTexImage3D;
+		glad_glCompressedTexImage3D = glad_instrument_glCompressedTexImage3D;
+	}
+	if (glad_glCompressedTexImage2D != NULL && glad_glCompressedTexImage2D != glad_instrument_glCompressedTexImage2D) {
+		glad_next_glCompressedTexImage2D = glad_glCompressedTexImage2D;
+		glad_glCompressedTexImage2D = glad_instrument_glCompressedTexImage2D;
+	}
+	if (glad_glCompressedTexImage1D != NULL && glad_glCompressedTexImage1D != glad_instrument_glCompressedTexImage1D) {
+		glad_next_glCompressedTexImage1D = glad_glCompressedTexImage1D;
+		glad_glCompressedTexImage1D = glad_instrument_glCompressedTexImage1D;
+	}
+	if (glad_glCompressedTexSubImage3D != NULL && glad_glCompressedTexSubImage3D != glad_instrument_glCompressedTexSubImage3D) {
+		glad_next_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+		glad_glCompressedTexSubImage3D = glad_instrument_glCompressedTexSubImage3D;
+	}
+	if (glad_glCompressedTexSubImage2D != NULL && glad_glCompressedTexSubImage2D != glad_instrument_glCompressedTexSubImage2D) {
+		glad_next_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+		glad_glCompressedTexSubImage2D = glad_instrument_glCompressedTexSubImage2D;
+	}
+	if (glad_glCompressedTexSubImage1D != NULL && glad_glCompressedTexSubImage1D != glad_instrument_glCompressedTexSubImage1D) {
+		glad_next_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+		glad_glCompressedTexSubImage1D = glad_instrument_glCompressedTexSubImage1D;
+	}
+	if (glad_glGetCompressedTexImage != NULL && glad_glGetCompressedTexImage != glad_instrument_glGetCompressedTexImage) {
+		glad_next_glGetCompressedTexImage = glad_glGetCompressedTexImage;
+		glad_glGetCompressedTexImage = glad_instrument_glGetCompressedTexImage;
+	}
+	if (glad_glBlendFuncSeparate != NULL && glad_glBlendFuncSeparate != glad_instrument_glBlendFuncSeparate) {
+		glad_next_glBlendFuncSeparate = glad_glBlendFuncSeparate;
+		glad_glBlendFuncSeparate = glad_instrument_glBlendFuncSeparate;
+	}
+	if (glad_glMultiDrawArrays != NULL && glad_glMultiDrawArrays != glad_instrument_glMultiDrawArrays) {
+		glad_next_glMultiDrawArrays = glad_glMultiDrawArrays;
+		glad_glMultiDrawArrays = glad_instrument_glMultiDrawArrays;
+	}
+	if (glad_glMultiDrawElements != NULL && glad_glMultiDrawElements != glad_instrument_glMultiDrawElements) {
+		glad_next_glMultiDrawElements = glad_glMultiDrawElements;
+		glad_glMultiDrawElements = glad_instrument_glMultiDrawElements;
+	}
+	if (glad_glPointParameterf != NULL && glad_glPointParameterf != glad_instrument_glPointParameterf) {
+		glad_next_glPointParameterf = glad_glPointParameterf;
+		glad_glPointParameterf = glad_instrument_glPointParameterf;
+	}
+	if (glad_glPointParameterfv != NULL && glad_glPointParameterfv != glad_instrument_glPointParameterfv) {
+		glad_next_glPointParameterfv = glad_glPointParameterfv;
+		glad_glPointParameterfv = glad_instrument_glPointParameterfv;
+	}
+	if (glad_glPointParameteri != NULL && glad_glPointParameteri != glad_instrument_glPointParameteri) {
+		glad_next_glPointParameteri = glad_glPointParameteri;
+		glad_glPointParameteri = glad_instrument_glPointParameteri;
+	}
+	if (glad_glPointParameteriv != NULL && glad_glPointParameteriv != glad_instrument_glPointParameteriv) {
+		glad_next_glPointParameteriv = glad_glPointParameteriv;
+		glad_glPointParameteriv = glad_instrument_glPointParameteriv;
+	}
+	if (glad_glBlendColor != NULL && glad_glBlendColor != glad_instrument_glBlendColor) {
+		glad_next_glBlendColor = glad_glBlendColor;
+		glad_glBlendColor = glad_instrument_glBlendColor;
+	}
+	if (glad_glBlendEquation != NULL && glad_glBlendEquation != glad_instrument_glBlendEquation) {
+		glad_next_glBlendEquation = glad_glBlendEquation;
+		glad_glBlendEquation = glad_instrument_glBlendEquation;
+	}
+	if (glad_glGenQueries != NULL && glad_glGenQueries != glad_instrument_glGenQueries) {
+		glad_next_glGenQueries = glad_glGenQueries;
+		glad_glGenQueries = glad_instrument_glGenQueries;
+	}
+	if (glad_glDeleteQueries != NULL && glad_glDeleteQueries != glad_instrument_glDeleteQueries) {
+		glad_next_glDeleteQueries = glad_glDeleteQueries;
+		glad_glDeleteQueries = glad_instrument_glDeleteQueries;
+	}
+	if (glad_glIsQuery != NULL && glad_glIsQuery != glad_instrument_glIsQuery) {
+		glad_next_glIsQuery = glad_glIsQuery;
+		glad_glIsQuery = glad_instrument_glIsQuery;
+	}
+	if (glad_glBeginQuery != NULL && glad_glBeginQuery != glad_instrument_glBeginQuery) {
+		glad_next_glBeginQuery = glad_glBeginQuery;
+		glad_glBeginQuery = glad_instrument_glBeginQuery;
+	}
+	if (glad_glEndQuery != NULL && glad_glEndQuery != glad_instrument_glEndQuery) {
+		glad_next_glEndQuery = glad_glEndQuery;
+		glad_glEndQuery = glad_instrument_glEndQuery;
+	}
+	if (glad_glGetQueryiv != NULL && glad_glGetQueryiv != glad_instrument_glGetQueryiv) {
+		glad_next_glGetQueryiv = glad_glGetQueryiv;
+		glad_glGetQueryiv = glad_instrument_glGetQueryiv;
+	}
+	if (glad_glGetQueryObjectiv != NULL && glad_glGetQueryObjectiv != glad_instrument_glGetQueryObjectiv) {
+		glad_next_glGetQueryObjectiv = glad_glGetQueryObjectiv;
+		glad_glGetQueryObjectiv = glad_instrument_glGetQueryObjectiv;
+	}
+	if (glad_glGetQueryObjectuiv != NULL && glad_glGetQueryObjectuiv != glad_instrument_glGetQueryObjectuiv) {
+		glad_next_glGetQueryObjectuiv = glad_glGetQueryObjectuiv;
+		glad_glGetQueryObjectuiv = glad_instrument_glGetQueryObjectuiv;
+	}
+	if (glad_glBindBuffer != NULL && glad_glBindBuffer != glad_instrument_glBindBuffer) {
+		glad_next_glBindBuffer = glad_glBindBuffer;
+		glad_glBindBuffer = glad_instrument_glBindBuffer;
+	}
+	if (glad_glDeleteBuffers != NULL && glad_glDeleteBuffers != glad_instrument_glDeleteBuffers) {
+		glad_next_glDeleteBuffers = glad_glDeleteBuffers;
+		glad_glDeleteBuffers = glad_instrument_glDeleteBuffers;
+	}
+	if (glad_glGenBuffers != NULL && glad_glGenBuffers != glad_instrument_glGenBuffers) {
+		glad_next_glGenBuffers = glad_glGenBuffers;
+		glad_glGenBuffers = glad_instrument_glGenBuffers;
+	}
+	if (glad_glIsBuffer != NULL && glad_glIsBuffer != glad_instrument_glIsBuffer) {
+		glad_next_glIsBuffer = glad_glIsBuffer;
+		glad_glIsBuffer = glad_instrument_glIsBuffer;
+	}
+	if (glad_glBufferData != NULL && glad_glBufferData != glad_instrument_glBufferData) {
+		glad_next_glBufferData = glad_glBufferData;
+		glad_glBufferData = glad_instrument_glBufferData;
+	}
+	if (glad_glBufferSubData != NULL && glad_glBufferSubData != glad_instrument_glBufferSubData) {
+		glad_next_glBufferSubData = glad_glBufferSubData;
+		glad_glBufferSubData = glad_instrument_glBufferSubData;
+	}
+	if (glad_glGetBufferSubData != NULL && glad_glGetBufferSubData != glad_instrument_glGetBufferSubData) {
+		glad_next_glGetBufferSubData = glad_glGetBufferSubData;
+		glad_glGetBufferSubData = glad_instrument_glGetBufferSubData;
+	}
+	if (glad_glMapBuffer != NULL && glad_glMapBuffer != glad_instrument_glMapBuffer) {
+		glad_next_glMapBuffer = glad_glMapBuffer;
+		glad_glMapBuffer = glad_instrument_glMapBuffer;
+	}
+	if (glad_glUnmapBuffer != NULL && glad_glUnmapBuffer != glad_instrument_glUnmapBuffer) {
+		glad_next_glUnmapBuffer = glad_glUnmapBuffer;
+		glad_glUnmapBuffer = glad_instrument_glUnmapBuffer;
+	}
+	if (glad_glGetBufferParameteriv != NULL && glad_glGetBufferParameteriv != glad_instrument_glGetBufferParameteriv) {
+		glad_next_glGetBufferParameteriv = glad_glGetBufferParameteriv;
+		glad_glGetBufferParameteriv = glad_instrument_glGetBufferParameteriv;
+	}
+	if (glad_glGetBufferPointerv != NULL && glad_glGetBufferPointerv != glad_instrument_glGetBufferPointerv) {
+		glad_next_glGetBufferPointerv = glad_glGetBufferPointerv;
+		glad_glGetBufferPointerv = glad_instrument_glGetBufferPointerv;
+	}
+	if (glad_glBlendEquationSeparate != NULL && glad_glBlendEquationSeparate != glad_instrument_glBlendEquationSeparate) {
+		glad_next_glBlendEquationSeparate = glad_glBlendEquationSeparate;
+		glad_glBlendEquationSeparate = glad_instrument_glBlendEquationSeparate;
+	}
+	if (glad_glDrawBuffers != NULL && glad_glDrawBuffers != glad_instrument_glDrawBuffers) {
+		glad_next_glDrawBuffers = glad_glDrawBuffers;
+		glad_glDrawBuffers = glad_instrument_glDrawBuffers;
+	}
+	if (glad_glStencilOpSeparate != NULL && glad_glStencilOpSeparate != glad_instrument_glStencilOpSeparate) {
+		glad_next_glStencilOpSeparate = glad_glStencilOpSeparate;
+		glad_glStencilOpSeparate = glad_instrument_glStencilOpSeparate;
+	}
+	if (glad_glStencilFuncSeparate != NULL && glad_glStencilFuncSeparate != glad_instrument_glStencilFuncSeparate) {
+		glad_next_glStencilFuncSeparate = glad_glStencilFuncSeparate;
+		glad_glStencilFuncSeparate = glad_instrument_glStencilFuncSeparate;
+	}
+	if (glad_glStencilMaskSeparate != NULL && glad_glStencilMaskSeparate != glad_instrument_glStencilMaskSeparate) {
+		glad_next_glStencilMaskSeparate = glad_glStencilMaskSeparate;
+		glad_glStencilMaskSeparate = glad_instrument_glStencilMaskSeparate;
+	}
+	if (glad_glAttachShader != NULL && glad_glAttachShader != glad_instrument_glAttachShader) {
+		glad_next_glAttachShader = glad_glAttachShader;
+		glad_glAttachShader = glad_instrument_glAttachShader;
+	}
+	if (glad_glBindAttribLocation != NULL && glad_glBindAttribLocation != glad_instrument_glBindAttribLocation) {
+		glad_next_glBindAttribLocation = glad_glBindAttribLocation;
+		glad_glBindAttribLocation = glad_instrument_glBindAttribLocation;
+	}
+	if (glad_glCompileShader != NULL && glad_glCompileShader != glad_instrument_glCompileShader) {
+		glad_next_glCompileShader = glad_glCompileShader;
+		glad_glCompileShader = glad_instrument_glCompileShader;
+	}
+	if (glad_glCreateProgram != NULL && glad_glCreateProgram != glad_instrument_glCreateProgram) {
+		glad_next_glCreateProgram = glad_glCreateProgram;
+		glad_glCreateProgram = glad_instrument_glCreateProgram;
+	}
+	if (glad_glCreateShader != NULL && glad_glCreateShader != glad_instrument_glCreateShader) {
+		glad_next_glCreateShader = glad_glCreateShader;
+		glad_glCreateShader = glad_instrument_glCreateShader;
+	}
+	if (glad_glDeleteProgram != NULL && glad_glDeleteProgram != glad_instrument_glDeleteProgram) {
+		glad_next_glDeleteProgram = glad_glDeleteProgram;
+		glad_glDeleteProgram = glad_instrument_glDeleteProgram;
+	}
+	if (glad_glDeleteShader != NULL && glad_glDeleteShader != glad_instrument_glDeleteShader) {
+		glad_next_glDeleteShader = glad_glDeleteShader;
+		glad_glDeleteShader = glad_instrument_glDeleteShader;
+	}
+	if (glad_glDetachShader != NULL && glad_glDetachShader != glad_instrument_glDetachShader) {
+		glad_next_glDetachShader = glad_glDetachShader;
+		glad_glDetachShader = glad_instrument_glDetachShader;
+	}
+	if (glad_glDisableVertexAttribArray != NULL && glad_glDisableVertexAttribArray != glad_instrument_glDisableVertexAttribArray) {
+		glad_next_glDisableVertexAttribArray = glad_glDisableVertexAttribArray;
+		glad_glDisableVertexAttribArray = glad_instrument_glDisableVertexAttribArray;
+	}
+	if (glad_glEnableVertexAttribArray != NULL && glad_glEnableVertexAttribArray != glad_instrument_glEnableVertexAttribArray) {
+		glad_next_glEnableVertexAttribArray = glad_glEnableVertexAttribArray;
+		glad_glEnableVertexAttribArray = glad_instrument_glEnableVertexAttribArray;
+	}
+	if (glad_glGetActiveAttrib != NULL && glad_glGetActiveAttrib != glad_instrument_glGetActiveAttrib) {
+		glad_next_glGetActiveAttrib = glad_glGetActiveAttrib;
+		glad_glGetActiveAttrib = glad_instrument_glGetActiveAttrib;
+	}
+	if (glad_glGetActiveUniform != NULL && glad_glGetActiveUniform != glad_instrument_glGetActiveUniform) {
+		glad_next_glGetActiveUniform = glad_glGetActiveUniform;
+		glad_glGetActiveUniform = glad_instrument_glGetActiveUniform;
+	}
+	if (glad_glGetAttachedShaders != NULL && glad_glGetAttachedShaders != glad_instrument_glGetAttachedShaders) {
+		glad_next_glGetAttachedShaders = glad_glGetAttachedShaders;
+		glad_glGetAttachedShaders = glad_instrument_glGetAttachedShaders;
+	}
+	if (glad_glGetAttribLocation != NULL && glad_glGetAttribLocation != glad_instrument_glGetAttribLocation) {
+		glad_next_glGetAttribLocation = glad_glGetAttribLocation;
+		glad_glGetAttribLocation = glad_instrument_glGetAttribLocation;
+	}
+	if (glad_glGetProgramiv != NULL && glad_glGetProgramiv != glad_instrument_glGetProgramiv) {
+		glad_next_glGetProgramiv = glad_glGetProgramiv;
+		glad_glGetProgramiv = glad_instrument_glGetProgramiv;
+	}
+	if (glad_glGetProgramInfoLog != NULL && glad_glGetProgramInfoLog != glad_instrument_glGetProgramInfoLog) {
+		glad_next_glGetProgramInfoLog = glad_glGetProgramInfoLog;
+		glad_glGetProgramInfoLog = glad_instrument_glGetProgramInfoLog;
+	}
+	if (glad_glGetShaderiv != NULL && glad_glGetShaderiv != glad_instrument_glGetShaderiv) {
+		glad_next_glGetShaderiv = glad_glGetShaderiv;
+		glad_glGetShaderiv = glad_instrument_glGetShaderiv;
+	}
+	if (glad_glGetShaderInfoLog != NULL && glad_glGetShaderInfoLog != glad_instrument_glGetShaderInfoLog) {
+		glad_next_glGetShaderInfoLog = glad_glGetShaderInfoLog;
+		glad_glGetShaderInfoLog = glad_instrument_glGetShaderInfoLog;
+	}
+	if (glad_glGetShaderSource != NULL && glad_glGetShaderSource != glad_instrument_glGetShaderSource) {
+		glad_next_glGetShaderSource = glad_glGetShaderSource;
+		glad_glGetShaderSource = glad_instrument_glGetShaderSource;
+	}
+	if (glad_glGetUniformLocation != NULL && glad_glGetUniformLocation != glad_instrument_glGetUniformLocation) {
+		glad_next_glGetUniformLocation = glad_glGetUniformLocation;
+		glad_glGetUniformLocation = glad_instrument_glGetUniformLocation;
+	}
+	if (glad_glGetUniformfv != NULL && glad_glGetUniformfv != glad_instrument_glGetUniformfv) {
+		glad_next_glGetUniformfv = glad_glGetUniformfv;
+		glad_glGetUniformfv = glad_instrument_glGetUniformfv;
+	}
+	if (glad_glGetUniformiv != NULL && glad_glGetUniformiv != glad_instrument_glGetUniformiv) {
+		glad_next_glGetUniformiv = glad_glGetUniformiv;
+		glad_glGetUniformiv = glad_instrument_glGetUniformiv;
+	}
+	if (glad_glGetVertexAttribdv != NULL && glad_glGetVertexAttribdv != glad_instrument_glGetVertexAttribdv) {
+		glad_next_glGetVertexAttribdv = glad_glGetVertexAttribdv;
+		glad_glGetVertexAttribdv = glad_instrument_glGetVertexAttribdv;
+	}
+	if (glad_glGetVertexAttribfv != NULL && glad_glGetVertexAttribfv != glad_instrument_glGetVertexAttribfv) {
+		glad_next_glGetVertexAttribfv = glad_glGetVertexAttribfv;
+		glad_glGetVertexAttribfv = glad_instrument_glGetVertexAttribfv;
+	}
+	if (glad_glGetVertexAttribiv != NULL && glad_glGetVertexAttribiv != glad_instrument_glGetVertexAttribiv) {
+		glad_next_glGetVertexAttribiv = glad_glGetVertexAttribiv;
+		glad_glGetVertexAttribiv = glad_instrument_glGetVertexAttribiv;
+	}
+	if (glad_glGetVertexAttribPointerv != NULL && glad_glGetVertexAttribPointerv != glad_instrument_glGetVertexAttribPointerv) {
+		glad_next_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+		glad_glGetVertexAttribPointerv = glad_instrument_glGetVertexAttribPointerv;
+	}
+	if (glad_glIsProgram != NULL && glad_glIsProgram != glad_instrument_glIsProgram) {
+		glad_next_glIsProgram = glad_glIsProgram;
+		glad_glIsProgram = glad_instrument_glIsProgram;
+	}
+	if (glad_glIsShader != NULL && glad_glIsShader != glad_instrument_glIsShader) {
+		glad_next_glIsShader = glad_glIsShader;
+		glad_glIsShader = glad_instrument_glIsShader;
+	}
+	if (glad_glLinkProgram != NULL && glad_glLinkProgram != glad_instrument_glLinkProgram) {
+		glad_next_glLinkProgram = glad_glLinkProgram;
+		glad_glLinkProgram = glad_instrument_glLinkProgram;
+	}
+	if (glad_glShaderSource != NULL && glad_glShaderSource != glad_instrument_glShaderSource) {
+		glad_next_glShaderSource = glad_glShaderSource;
+		glad_glShaderSource = glad_instrument_glShaderSource;
+	}
+	if (glad_glUseProgram != NULL && glad_glUseProgram != glad_instrument_glUseProgram) {
+		glad_next_glUseProgram = glad_glUseProgram;
+		glad_glUseProgram = glad_instrument_glUseProgram;
+	}
+	if (glad_glUniform1f != NULL && glad_glUniform1f != glad_instrument_glUniform1f) {
+		glad_next_glUniform1f = glad_glUniform1f;
+		glad_glUniform1f = glad_instrument_glUniform1f;
+	}
+	if (glad_glUniform2f != NULL && glad_glUniform2f != glad_instrument_glUniform2f) {
+		glad_next_glUniform2f = glad_glUniform2f;
+		glad_glUniform2f = glad_instrument_glUniform2f;
+	}
+	if (glad_glUniform3f != NULL && glad_glUniform3f != glad_instrument_glUniform3f) {
+		glad_next_glUniform3f = glad_glUniform3f;
+		glad_glUniform3f = glad_instrument_glUniform3f;
+	}
+	if (glad_glUniform4f != NULL && glad_glUniform4f != glad_instrument_glUniform4f) {
+		glad_next_glUniform4f = glad_glUniform4f;
+		glad_glUniform4f = glad_instrument_glUniform4f;
+	}
+	if (glad_glUniform1i != NULL && glad_glUniform1i != glad_instrument_glUniform1i) {
+		glad_next_glUniform1i = glad_glUniform1i;
+		glad_glUniform1i = glad_instrument_glUniform1i;
+	}
+	if (glad_glUniform2i != NULL && glad_glUniform2i != glad_instrument_glUniform2i) {
+		glad_next_glUniform2i = glad_glUniform2i;
+		glad_glUniform2i = glad_instrument_glUniform2i;
+	}
+	if (glad_glUniform3i != NULL && glad_glUniform3i != glad_instrument_glUniform3i) {
+		glad_next_glUniform3i = glad_glUniform3i;
+		glad_glUniform3i = glad_instrument_glUniform3i;
+	}
+	if (glad_glUniform4i != NULL && glad_glUniform4i != glad_instrument_glUniform4i) {
+		glad_next_glUniform4i = glad_glUniform4i;
+		glad_glUniform4i = glad_instrument_glUniform4i;
+	}
+	if (glad_glUniform1fv != NULL && glad_glUniform1fv != glad_instrument_glUniform1fv) {
+		glad_next_glUniform1fv = glad_glUniform1fv;
+		glad_glUniform1fv = glad_instrument_glUniform1fv;
+	}
+	if (glad_glUniform2fv != NULL && glad_glUniform2fv != glad_instrument_glUniform2fv) {
+		glad_next_glUniform2fv = glad_glUniform2fv;
+		glad_glUniform2fv = glad_instrument_glUniform2fv;
+	}
+	if (glad_glUniform3fv != NULL && glad_glUniform3fv != glad_instrument_glUniform3fv) {
+		glad_next_glUniform3fv = glad_glUniform3fv;
+		glad_glUniform3fv = glad_instrument_glUniform3fv;
+	}
+	if (glad_glUniform4fv != NULL && glad_glUniform4fv != glad_instrument_glUniform4fv) {
+		glad_next_glUniform4fv = glad_glUniform4fv;
+		glad_glUniform4fv = glad_instrument_glUniform4fv;
+	}
+	if (glad_glUniform1iv != NULL && glad_glUniform1iv != glad_instrument_glUniform1iv) {
+		glad_next_glUniform1iv = glad_glUniform1iv;
+		glad_glUniform1iv = glad_instrument_glUniform1iv;
+	}
+	if (glad_glUniform2iv != NULL && glad_glUniform2iv != glad_instrument_glUniform2iv) {
+		glad_next_glUniform2iv = glad_glUniform2iv;
+		glad_glUniform2iv = glad_instrument_glUniform2iv;
+	}
+	if (glad_glUniform3iv != NULL && glad_glUniform3iv != glad_instrument_glUniform3iv) {
+		glad_next_glUniform3iv = glad_glUniform3iv;
+		glad_glUniform3iv = glad_instrument_glUniform3iv;
+	}
+	if (glad_glUniform4iv != NULL && glad_glUniform4iv != glad_instrument_glUniform4iv) {
+		glad_next_glUniform4iv = glad_glUniform4iv;
+		glad_glUniform4iv = glad_instrument_glUniform4iv;
+	}
+	if (glad_glUniformMatrix2fv != NULL && glad_glUniformMatrix2fv != glad_instrument_glUniformMatrix2fv) {
+		glad_next_glUniformMatrix2fv = glad_glUniformMatrix2fv;
+		glad_glUniformMatrix2fv = glad_instrument_glUniformMatrix2fv;
+	}
+	if (glad_glUniformMatrix3fv != NULL && glad_glUniformMatrix3fv != glad_instrument_glUniformMatrix3fv) {
+		glad_next_glUniformMatrix3fv = glad_glUniformMatrix3fv;
+		glad_glUniformMatrix3fv = glad_instrument_glUniformMatrix3fv;
+	}
+	if (glad_glUniformMatrix4fv != NULL && glad_glUniformMatrix4fv != glad_instrument_glUniformMatrix4fv) {
+		glad_next_glUniformMatrix4fv = glad_glUniformMatrix4fv;
+		glad_glUniformMatrix4fv = glad_instrument_glUniformMatrix4fv;
+	}
+	if (glad_glValidateProgram != NULL && glad_glValidateProgram != glad_instrument_glValidateProgram) {
+		glad_next_glValidateProgram = glad_glValidateProgram;
+		glad_glValidateProgram = glad_instrument_glValidateProgram;
+	}
+	if (glad_glVertexAttrib1d != NULL && glad_glVertexAttrib1d != glad_instrument_glVertexAttrib1d) {
+		glad_next_glVertexAttrib1d = glad_glVertexAttrib1d;
+		glad_glVertexAttrib1d = glad_instrument_glVertexAttrib1d;
+	}
+	if (glad_glVertexAttrib1dv != NULL && glad_glVertexAttrib1dv != glad_instrument_glVertexAttrib1dv) {
+		glad_next_glVertexAttrib1dv = glad_glVertexAttrib1dv;
+		glad_glVertexAttrib1dv = glad_instrument_glVertexAttrib1dv;
+	}
+	if (glad_glVertexAttrib1f != NULL && glad_glVertexAttrib1f != glad_instrument_glVertexAttrib1f) {
+		glad_next_glVertexAttrib1f = glad_glVertexAttrib1f;
+		glad_glVertexAttrib1f = glad_instrument_glVertexAttrib1f;
+	}
+	if (glad_glVertexAttrib1fv != NULL && glad_glVertexAttrib1fv != glad_instrument_glVertexAttrib1fv) {
+		glad_next_glVertexAttrib1fv = glad_glVertexAttrib1fv;
+		glad_glVertexAttrib1fv = glad_instrument_glVertexAttrib1fv;
+	}
+	if (glad_glVertexAttrib1s != NULL && glad_glVertexAttrib1s != glad_instrument_glVertexAttrib1s) {
+		glad_next_glVertexAttrib1s = glad_glVertexAttrib1s;
+		glad_glVertexAttrib1s = glad_instrument_glVertexAttrib1s;
+	}
+	if (glad_glVertexAttrib1sv != NULL && glad_glVertexAttrib1sv != glad_instrument_glVertexAttrib1sv) {
+		glad_next_glVertexAttrib1sv = glad_glVertexAttrib1sv;
+		glad_glVertexAttrib1sv = glad_instrument_glVertexAttrib1sv;
+	}
+	if (glad_glVertexAttrib2d != NULL && glad_glVertexAttrib2d != glad_instrument_glVertexAttrib2d) {
+		glad_next_glVertexAttrib2d = glad_glVertexAttrib2d;
+		glad_glVertexAttrib2d = glad_instrument_glVertexAttrib2d;
+	}
+	if (glad_glVertexAttrib2dv != NULL && glad_glVertexAttrib2dv != glad_instrument_glVertexAttrib2dv) {
+		glad_next_glVertexAttrib2dv = glad_glVertexAttrib2dv;
+		glad_glVertexAttrib2dv = glad_instrument_glVertexAttrib2dv;
+	}
+	if (glad_glVertexAttrib2f != NULL && glad_glVertexAttrib2f != glad_instrument_glVertexAttrib2f) {
+		glad_next_glVertexAttrib2f = glad_glVertexAttrib2f;
+		glad_glVertexAttrib2f = glad_instrument_glVertexAttrib2f;
+	}
+	if (glad_glVertexAttrib2fv != NULL && glad_glVertexAttrib2fv != glad_instrument_glVertexAttrib2fv) {
+		glad_next_glVertexAttrib2fv = glad_glVertexAttrib2fv;
+		glad_glVertexAttrib2fv = glad_instrument_glVertexAttrib2fv;
+	}
+	if (glad_glVertexAttrib2s != NULL && glad_glVertexAttrib2s != glad_instrument_glVertexAttrib2s) {
+		glad_next_glVertexAttrib2s = glad_glVertexAttrib2s;
+		glad_glVertexAttrib2s = glad_instrument_glVertexAttrib2s;
+	}
+	if (glad_glVertexAttrib2sv != NULL && glad_glVertexAttrib2sv != glad_instrument_glVertexAttrib2sv) {
+		glad_next_glVertexAttrib2sv = glad_glVertexAttrib2sv;
+		glad_glVertexAttrib2sv = glad_instrument_glVertexAttrib2sv;
+	}
+	if (glad_glVertexAttrib3d != NULL && glad_glVertexAttrib3d != glad_instrument_glVertexAttrib3d) {
+		glad_next_glVertexAttrib3d = glad_glVertexAttrib3d;
+		glad_glVertexAttrib3d = glad_instrument_glVertexAttrib3d;
+	}
+	if (glad_glVertexAttrib3dv != NULL && glad_glVertexAttrib3dv != glad_instrument_glVertexAttrib3dv) {
+		glad_next_glVertexAttrib3dv = glad_glVertexAttrib3dv;
+		glad_glVertexAttrib3dv = glad_instrument_glVertexAttrib3dv;
+	}
+	if (glad_glVertexAttrib3f != NULL && glad_glVertexAttrib3f != glad_instrument_glVertexAttrib3f) {
+		glad_next_glVertexAttrib3f = glad_glVertexAttrib3f;
+		glad_glVertexAttrib3f = glad_instrument_glVertexAttrib3f;
+	}
+	if (glad_glVertexAttrib3fv != NULL && glad_glVertexAttrib3fv != glad_instrument_glVertexAttrib3fv) {
+		glad_next_glVertexAttrib3fv = glad_glVertexAttrib3fv;
+		glad_glVertexAttrib3fv = glad_instrument_glVertexAttrib3fv;
+	}
+	if (glad_glVertexAttrib3s != NULL && glad_glVertexAttrib3s != glad_instrument_glVertexAttrib3s) {
+		glad_next_glVertexAttrib3s = glad_glVertexAttrib3s;
+		glad_glVertexAttrib3s = glad_instrument_glVertexAttrib3s;
+	}
+	if (glad_glVertexAttrib3sv != NULL && glad_glVertexAttrib3sv != glad_instrument_glVertexAttrib3sv) {
+		glad_next_glVertexAttrib3sv = glad_glVertexAttrib3sv;
+		glad_glVertexAttrib3sv = glad_instrument_glVertexAttrib3sv;
+	}
+	if (glad_glVertexAttrib4Nbv != NULL && glad_glVertexAttrib4Nbv != glad_instrument_glVertexAttrib4Nbv) {
+		glad_next_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+		glad_glVertexAttrib4Nbv = glad_instrument_glVertexAttrib4Nbv;
+	}
+	if (glad_glVertexAttrib4Niv != NULL && glad_glVertexAttrib4Niv != glad_instrument_glVertexAttrib4Niv) {
+		glad_next_glVertexAttrib4Niv = glad_glVertexAttrib4Niv;
+		glad_glVertexAttrib4Niv = glad_instrument_glVertexAttrib4Niv;
+	}
+	if (glad_glVertexAttrib4Nsv != NULL && glad_glVertexAttrib4Nsv != glad_instrument_glVertexAttrib4Nsv) {
+		glad_next_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+		glad_glVertexAttrib4Nsv = glad_instrument_glVertexAttrib4Nsv;
+	}
+	if (glad_glVertexAttrib4Nub != NULL && glad_glVertexAttrib4Nub != glad_instrument_glVertexAttrib4Nub) {
+		glad_next_glVertexAttrib4Nub = glad_glVertexAttrib4Nub;
+		glad_glVertexAttrib4Nub = glad_instrument_glVertexAttrib4Nub;
+	}
+	if (glad_glVertexAttrib4Nubv != NULL && glad_glVertexAttrib4Nubv != glad_instrument_glVertexAttrib4Nubv) {
+		glad_next_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+		glad_glVertexAttrib4Nubv = glad_instrument_glVertexAttrib4Nubv;
+	}
+	if (glad_glVertexAttrib4Nuiv != NULL && glad_glVertexAttrib4Nuiv != glad_instrument_glVertexAttrib4Nuiv) {
+		glad_next_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+		glad_glVertexAttrib4Nuiv = glad_instrument_glVertexAttrib4Nuiv;
+	}
+	if (glad_glVertexAttrib4Nusv != NULL && glad_glVertexAttrib4Nusv != glad_instrument_glVertexAttrib4Nusv) {
+		glad_next_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+		glad_glVertexAttrib4Nusv = glad_instrument_glVertexAttrib4Nusv;
+	}
+	if (glad_glVertexAttrib4bv != NULL && glad_glVertexAttrib4bv != glad_instrument_glVertexAttrib4bv) {
+		glad_next_glVertexAttrib4bv = glad_glVertexAttrib4bv;
+		glad_glVertexAttrib4bv = glad_instrument_glVertexAttrib4bv;
+	}
+	if (glad_glVertexAttrib4d != NULL && glad_glVertexAttrib4d != glad_instrument_glVertexAttrib4d) {
+		glad_next_glVertexAttrib4d = glad_glVertexAttrib4d;
+		glad_glVertexAttrib4d = glad_instrument_glVertexAttrib4d;
+	}
+	if (glad_glVertexAttrib4dv != NULL && glad_glVertexAttrib4dv != glad_instrument_glVertexAttrib4dv) {
+		glad_next_glVertexAttrib4dv = glad_glVertexAttrib4dv;
+		glad_glVertexAttrib4dv = glad_instrument_glVertexAttrib4dv;
+	}
+	if (glad_glVertexAttrib4f != NULL && glad_glVertexAttrib4f != glad_instrument_glVertexAttrib4f) {
+		glad_next_glVertexAttrib4f = glad_glVertexAttrib4f;
+		glad_glVertexAttrib4f = glad_instrument_glVertexAttrib4f;
+	}
+	if (glad_glVertexAttrib4fv != NULL && glad_glVertexAttrib4fv != glad_instrument_glVertexAttrib4fv) {
+		glad_next_glVertexAttrib4fv = glad_glVertexAttrib4fv;
+		glad_glVertexAttrib4fv = glad_instrument_glVertexAttrib4fv;
+	}
+	if (glad_glVertexAttrib4iv != NULL && glad_glVertexAttrib4iv != glad_instrument_glVertexAttrib4iv) {
+		glad_next_glVertexAttrib4iv = glad_glVertexAttrib4iv;
+		glad_glVertexAttrib4iv = glad_instrument_glVertexAttrib4iv;
+	}
+	if (glad_glVertexAttrib4s != NULL && glad_glVertexAttrib4s != glad_instrument_glVertexAttrib4s) {
+		glad_next_glVertexAttrib4s = glad_glVertexAttrib4s;
+		glad_glVertexAttrib4s = glad_instrument_glVertexAttrib4s;
+	}
+	if (glad_glVertexAttrib4sv != NULL && glad_glVertexAttrib4sv != glad_instrument_glVertexAttrib4sv) {
+		glad_next_glVertexAttrib4sv = glad_glVertexAttrib4sv;
+		glad_glVertexAttrib4sv = glad_instrument_glVertexAttrib4sv;
+	}
+	if (glad_glVertexAttrib4ubv != NULL && glad_glVertexAttrib4ubv != glad_instrument_glVertexAttrib4ubv) {
+		glad_next_glVertexAttrib4ubv = glad_glVertexAttrib4ubv;
+		glad_glVertexAttrib4ubv = glad_instrument_glVertexAttrib4ubv;
+	}
+	if (glad_glVertexAttrib4uiv != NULL && glad_glVertexAttrib4uiv != glad_instrument_glVertexAttrib4uiv) {
+		glad_next_glVertexAttrib4uiv = glad_glVertexAttrib4uiv;
+		glad_glVertexAttrib4uiv = glad_instrument_glVertexAttrib4uiv;
+	}
+	if (glad_glVertexAttrib4usv != NULL && glad_glVertexAttrib4usv != glad_instrument_glVertexAttrib4usv) {
+		glad_next_glVertexAttrib4usv = glad_glVertexAttrib4usv;
+		glad_glVertexAttrib4usv = glad_instrument_glVertexAttrib4usv;
+	}
+	if (glad_glVertexAttribPointer != NULL && glad_glVertexAttribPointer != glad_instrument_glVertexAttribPointer) {
+		glad_next_glVertexAttribPointer = glad_glVertexAttribPointer;
+		glad_glVertexAttribPointer = glad_instrument_glVertexAttribPointer;
+	}
+	if (glad_glUniformMatrix2x3fv != NULL && glad_glUniformMatrix2x3fv != glad_instrument_glUniformMatrix2x3fv) {
+		glad_next_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+		glad_glUniformMatrix2x3fv = glad_instrument_glUniformMatrix2x3fv;
+	}
+	if (glad_glUniformMatrix3x2fv != NULL && glad_glUniformMatrix3x2fv != glad_instrument_glUniformMatrix3x2fv) {
+		glad_next_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+		glad_glUniformMatrix3x2fv = glad_instrument_glUniformMatrix3x2fv;
+	}
+	if (glad_glUniformMatrix2x4fv != NULL && glad_glUniformMatrix2x4fv != glad_instrument_glUniformMatrix2x4fv) {
+		glad_next_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+		glad_glUniformMatrix2x4fv = glad_instrument_glUniformMatrix2x4fv;
+	}
+	if (glad_glUniformMatrix4x2fv != NULL && glad_glUniformMatrix4x2fv != glad_instrument_glUniformMatrix4x2fv) {
+		glad_next_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+		glad_glUniformMatrix4x2fv = glad_instrument_glUniformMatrix4x2fv;
+	}
+	if (glad_glUniformMatrix3x4fv != NULL && glad_glUniformMatrix3x4fv != glad_instrument_glUniformMatrix3x4fv) {
+		glad_next_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+		glad_glUniformMatrix3x4fv = glad_instrument_glUniformMatrix3x4fv;
+	}
+	if (glad_glUniformMatrix4x3fv != NULL && glad_glUniformMatrix4x3fv != glad_instrument_glUniformMatrix4x3fv) {
+		glad_next_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+		glad_glUniformMatrix4x3fv = glad_instrument_glUniformMatrix4x3fv;
+	}
+	if (glad_glColorMaski != NULL && glad_glColorMaski != glad_instrument_glColorMaski) {
+		glad_next_glColorMaski = glad_glColorMaski;
+		glad_glColorMaski = glad_instrument_glColorMaski;
+	}
+	if (glad_glGetBooleani_v != NULL && glad_glGetBooleani_v != glad_instrument_glGetBooleani_v) {
+		glad_next_glGetBooleani_v = glad_glGetBooleani_v;
+		glad_glGetBooleani_v = glad_instrument_glGetBooleani_v;
+	}
+	if (glad_glGetIntegeri_v != NULL && glad_glGetIntegeri_v != glad_instrument_glGetIntegeri_v) {
+		glad_next_glGetIntegeri_v = glad_glGetIntegeri_v;
+		glad_glGetIntegeri_v = glad_instrument_glGetIntegeri_v;
+	}
+	if (glad_glEnablei != NULL && glad_glEnablei != glad_instrument_glEnablei) {
+		glad_next_glEnablei = glad_glEnablei;
+		glad_glEnablei = glad_instrument_glEnablei;
+	}
+	if (glad_glDisablei != NULL && glad_glDisablei != glad_instrument_glDisablei) {
+		glad_next_glDisablei = glad_glDisablei;
+		glad_glDisablei = glad_instrument_glDisablei;
+	}
+	if (glad_glIsEnabledi != NULL && glad_glIsEnabledi != glad_instrument_glIsEnabledi) {
+		glad_next_glIsEnabledi = glad_glIsEnabledi;
+		glad_glIsEnabledi = glad_instrument_glIsEnabledi;
+	}
+	if (glad_glBeginTransformFeedback != NULL && glad_glBeginTransformFeedback != glad_instrument_glBeginTransformFeedback) {
+		glad_next_glBeginTransformFeedback = glad_glBeginTransformFeedback;
+		glad_glBeginTransformFeedback = glad_instrument_glBeginTransformFeedback;
+	}
+	if (glad_glEndTransformFeedback != NULL && glad_glEndTransformFeedback != glad_instrument_glEndTransformFeedback) {
+		glad_next_glEndTransformFeedback = glad_glEndTransformFeedback;
+		glad_glEndTransformFeedback = glad_instrument_glEndTransformFeedback;
+	}
+	if (glad_glBindBufferRange != NULL && glad_glBindBufferRange != glad_instrument_glBindBufferRange) {
+		glad_next_glBindBufferRange = glad_glBindBufferRange;
+		glad_glBindBufferRange = glad_instrument_glBindBufferRange;
+	}
+	if (glad_glBindBufferBase != NULL && glad_glBindBufferBase != glad_instrument_glBindBufferBase) {
+		glad_next_glBindBufferBase = glad_glBindBufferBase;
+		glad_glBindBufferBase = glad_instrument_glBindBufferBase;
+	}
+	if (glad_glTransformFeedbackVaryings != NULL && glad_glTransformFeedbackVaryings != glad_instrument_glTransformFeedbackVaryings) {
+		glad_next_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+		glad_glTransformFeedbackVaryings = glad_instrument_glTransformFeedbackVaryings;
+	}
+	if (glad_glGetTransformFeedbackVarying != NULL && glad_glGetTransformFeedbackVarying != glad_instrument_glGetTransformFeedbackVarying) {
+		glad_next_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+		glad_glGetTransformFeedbackVarying = glad_instrument_glGetTransformFeedbackVarying;
+	}
+	if (glad_glClampColor != NULL && glad_glClampColor != glad_instrument_glClampColor) {
+		glad_next_glClampColor = glad_glClampColor;
+		glad_glClampColor = glad_instrument_glClampColor;
+	}
+	if (glad_glBeginConditionalRender != NULL && glad_glBeginConditionalRender != glad_instrument_glBeginConditionalRender) {
+		glad_next_glBeginConditionalRender = glad_glBeginConditionalRender;
+		glad_glBeginConditionalRender = glad_instrument_glBeginConditionalRender;
+	}
+	if (glad_glEndConditionalRender != NULL && glad_glEndConditionalRender != glad_instrument_glEndConditionalRender) {
+		glad_next_glEndConditionalRender = glad_glEndConditionalRender;
+		glad_glEndConditionalRender = glad_instrument_glEndConditionalRender;
+	}
+	if (glad_glVertexAttribIPointer != NULL && glad_glVertexAttribIPointer != glad_instrument_glVertexAttribIPointer) {
+		glad_next_glVertexAttribIPointer = glad_glVertexAttribIPointer;
+		glad_glVertexAttribIPointer = glad_instrument_glVertexAttribIPointer;
+	}
+	if (glad_glGetVertexAttribIiv != NULL && glad_glGetVertexAttribIiv != glad_instrument_glGetVertexAttribIiv) {
+		glad_next_glGetVertexAttribIiv = glad_glGetVertexAttribIiv;
+		glad_glGetVertexAttribIiv = glad_instrument_glGetVertexAttribIiv;
+	}
+	if (glad_glGetVertexAttribIuiv != NULL && glad_glGetVertexAttribIuiv != glad_instrument_glGetVertexAttribIuiv) {
+		glad_next_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+		glad_glGetVertexAttribIuiv = glad_instrument_glGetVertexAttribIuiv;
+	}
+	if (glad_glVertexAttribI1i != NULL && glad_glVertexAttribI1i != glad_instrument_glVertexAttribI1i) {
+		glad_next_glVertexAttribI1i = glad_glVertexAttribI1i;
+		glad_glVertexAttribI1i = glad_instrument_glVertexAttribI1i;
+	}
+	if (glad_glVertexAttribI2i != NULL && glad_glVertexAttribI2i != glad_instrument_glVertexAttribI2i) {
+		glad_next_glVertexAttribI2i = glad_glVertexAttribI2i;
+		glad_glVertexAttribI2i = glad_instrument_glVertexAttribI2i;
+	}
+	if (glad_glVertexAttribI3i != NULL && glad_glVertexAttribI3i != glad_instrument_glVertexAttribI3i) {
+		glad_next_glVertexAttribI3i = glad_glVertexAttribI3i;
+		glad_glVertexAttribI3i = glad_instrument_glVertexAttribI3i;
+	}
+	if (glad_glVertexAttribI4i != NULL && glad_glVertexAttribI4i != glad_instrument_glVertexAttribI4i) {
+		glad_next_glVertexAttribI4i = glad_glVertexAttribI4i;
+		glad_glVertexAttribI4i = glad_instrument_glVertexAttribI4i;
+	}
+	if (glad_glVertexAttribI1ui != NULL && glad_glVertexAttribI1ui != glad_instrument_glVertexAttribI1ui) {
+		glad_next_glVertexAttribI1ui = glad_glVertexAttribI1ui;
+		glad_glVertexAttribI1ui = glad_instrument_glVertexAttribI1ui;
+	}
+	if (glad_glVertexAttribI2ui != NULL && glad_glVertexAttribI2ui != glad_instrument_glVertexAttribI2ui) {
+		glad_next_glVertexAttribI2ui = glad_glVertexAttribI2ui;
+		glad_glVertexAttribI2ui = glad_instrument_glVertexAttribI2ui;
+	}
+	if (glad_glVertexAttribI3ui != NULL && glad_glVertexAttribI3ui != glad_instrument_glVertexAttribI3ui) {
+		glad_next_glVertexAttribI3ui = glad_glVertexAttribI3ui;
+		glad_glVertexAttribI3ui = glad_instrument_glVertexAttribI3ui;
+	}
+	if (glad_glVertexAttribI4ui != NULL && glad_glVertexAttribI4ui != glad_instrument_glVertexAttribI4ui) {
+		glad_next_glVertexAttribI4ui = glad_glVertexAttribI4ui;
+		glad_glVertexAttribI4ui = glad_instrument_glVertexAttribI4ui;
+	}
+	if (glad_glVertexAttribI1iv != NULL && glad_glVertexAttribI1iv != glad_instrument_glVertexAttribI1iv) {
+		glad_next_glVertexAttribI1iv = glad_glVertexAttribI1iv;
+		glad_glVertexAttribI1iv = glad_instrument_glVertexAttribI1iv;
+	}
+	if (glad_glVertexAttribI2iv != NULL && glad_glVertexAttribI2iv != glad_instrument_glVertexAttribI2iv) {
+		glad_next_glVertexAttribI2iv = glad_glVertexAttribI2iv;
+		glad_glVertexAttribI2iv = glad_instrument_glVertexAttribI2iv;
+	}
+	if (glad_glVertexAttribI3iv != NULL && glad_glVertexAttribI3iv != glad_instrument_glVertexAttribI3iv) {
+		glad_next_glVertexAttribI3iv = glad_glVertexAttribI3iv;
+		glad_glVertexAttribI3iv = glad_instrument_glVertexAttribI3iv;
+	}
+	if (glad_glVertexAttribI4iv != NULL && glad_glVertexAttribI4iv != glad_instrument_glVertexAttribI4iv) {
+		glad_next_glVertexAttribI4iv = glad_glVertexAttribI4iv;
+		glad_glVertexAttribI4iv = glad_instrument_glVertexAttribI4iv;
+	}
+	if (glad_glVertexAttribI1uiv != NULL && glad_glVertexAttribI1uiv != glad_instrument_glVertexAttribI1uiv) {
+		glad_next_glVertexAttribI1uiv = glad_glVertexAttribI1uiv;
+		glad_glVertexAttribI1uiv = glad_instrument_glVertexAttribI1uiv;
+	}
+	if (glad_glVertexAttribI2uiv != NULL && glad_glVertexAttribI2uiv != glad_instrument_glVertexAttribI2uiv) {
+		glad_next_glVertexAttribI2uiv = glad_glVertexAttribI2uiv;
+		glad_glVertexAttribI2uiv = glad_instrument_glVertexAttribI2uiv;
+	}
+	if (glad_glVertexAttribI3uiv != NULL && glad_glVertexAttribI3uiv != glad_instrument_glVertexAttribI3uiv) {
+		glad_next_glVertexAttribI3uiv = glad_glVertexAttribI3uiv;
+		glad_glVertexAttribI3uiv = glad_instrument_glVertexAttribI3uiv;
+	}
+	if (glad_glVertexAttribI4uiv != NULL && glad_glVertexAttribI4uiv != glad_instrument_glVertexAttribI4uiv) {
+		glad_next_glVertexAttribI4uiv = glad_glVertexAttribI4uiv;
+		glad_glVertexAttribI4uiv = glad_instrument_glVertexAttribI4uiv;
+	}
+	if (glad_glVertexAttribI4bv != NULL && glad_glVertexAttribI4bv != glad_instrument_glVertexAttribI4bv) {
+		glad_next_glVertexAttribI4bv = glad_glVertexAttribI4bv;
+		glad_glVertexAttribI4bv = glad_instrument_glVertexAttribI4bv;
+	}
+	if (glad_glVertexAttribI4sv != NULL && glad_glVertexAttribI4sv != glad_instrument_glVertexAttribI4sv) {
+		glad_next_glVertexAttribI4sv = glad_glVertexAttribI4sv;
+		glad_glVertexAttribI4sv = glad_instrument_glVertexAttribI4sv;
+	}
+	if (glad_glVertexAttribI4ubv != NULL && glad_glVertexAttribI4ubv != glad_instrument_glVertexAttribI4ubv) {
+		glad_next_glVertexAttribI4ubv = glad_glVertexAttribI4ubv;
+		glad_glVertexAttribI4ubv = glad_instrument_glVertexAttribI4ubv;
+	}
+	if (glad_glVertexAttribI4usv != NULL && glad_glVertexAttribI4usv != glad_instrument_glVertexAttribI4usv) {
+		glad_next_glVertexAttribI4usv = glad_glVertexAttribI4usv;
+		glad_glVertexAttribI4usv = glad_instrument_glVertexAttribI4usv;
+	}
+	if (glad_glGetUniformuiv != NULL && glad_glGetUniformuiv != glad_instrument_glGetUniformuiv) {
+		glad_next_glGetUniformuiv = glad_glGetUniformuiv;
+		glad_glGetUniformuiv = glad_instrument_glGetUniformuiv;
+	}
+	if (glad_glBindFragDataLocation != NULL && glad_glBindFragDataLocation != glad_instrument_glBindFragDataLocation) {
+		glad_next_glBindFragDataLocation = glad_glBindFragDataLocation;
+		glad_glBindFragDataLocation = glad_instrument_glBindFragDataLocation;
+	}
+	if (glad_glGetFragDataLocation != NULL && glad_glGetFragDataLocation != glad_instrument_glGetFragDataLocation) {
+		glad_next_glGetFragDataLocation = glad_glGetFragDataLocation;
+		glad_glGetFragDataLocation = glad_instrument_glGetFragDataLocation;
+	}
+	if (glad_glUniform1ui != NULL && glad_glUniform1ui != glad_instrument_glUniform1ui) {
+		glad_next_glUniform1ui = glad_glUniform1ui;
+		glad_glUniform1ui = glad_instrument_glUniform1ui;
+	}
+	if (glad_glUniform2ui != NULL && glad_glUniform2ui != glad_instrument_glUniform2ui) {
+		glad_next_glUniform2ui = glad_glUniform2ui;
+		glad_glUniform2ui = glad_instrument_glUniform2ui;
+	}
+	if (glad_glUniform3ui != NULL && glad_glUniform3ui != glad_instrument_glUniform3ui) {
+		glad_next_glUniform3ui = glad_glUniform3ui;
+		glad_glUniform3ui = glad_instrument_glUniform3ui;
+	}
+	if (glad_glUniform4ui != NULL && glad_glUniform4ui != glad_instrument_glUniform4ui) {
+		glad_next_glUniform4ui = glad_glUniform4ui;
+		glad_glUniform4ui = glad_instrument_glUniform4ui;
+	}
+	if (glad_glUniform1uiv != NULL && glad_glUniform1uiv != glad_instrument_glUniform1uiv) {
+		glad_next_glUniform1uiv = glad_glUniform1uiv;
+		glad_glUniform1uiv = glad_instrument_glUniform1uiv;
+	}
+	if (glad_glUniform2uiv != NULL && glad_glUniform2uiv != glad_instrument_glUniform2uiv) {
+		glad_next_glUniform2uiv = glad_glUniform2uiv;
+		glad_glUniform2uiv = glad_instrument_glUniform2uiv;
+	}
+	if (glad_glUniform3uiv != NULL && glad_glUniform3uiv != glad_instrument_glUniform3uiv) {
+		glad_next_glUniform3uiv = glad_glUniform3uiv;
+		glad_glUniform3uiv = glad_instrument_glUniform3uiv;
+	}
+	if (glad_glUniform4uiv != NULL && glad_glUniform4uiv != glad_instrument_glUniform4uiv) {
+		glad_next_glUniform4uiv = glad_glUniform4uiv;
+		glad_glUniform4uiv = glad_instrument_glUniform4uiv;
+	}
+	if (glad_glTexParameterIiv != NULL && glad_glTexParameterIiv != glad_instrument_glTexParameterIiv) {
+		glad_next_glTexParameterIiv = glad_glTexParameterIiv;
+		glad_glTexParameterIiv = glad_instrument_glTexParameterIiv;
+	}
+	if (glad_glTexParameterIuiv != NULL && glad_glTexParameterIuiv != glad_instrument_glTexParameterIuiv) {
+		glad_next_glTexParameterIuiv = glad_glTexParameterIuiv;
+		glad_glTexParameterIuiv = glad_instrument_glTexParameterIuiv;
+	}
+	if (glad_glGetTexParameterIiv != NULL && glad_glGetTexParameterIiv != glad_instrument_glGetTexParameterIiv) {
+		glad_next_glGetTexParameterIiv = glad_glGetTexParameterIiv;
+		glad_glGetTexParameterIiv = glad_instrument_glGetTexParameterIiv;
+	}
+	if (glad_glGetTexParameterIuiv != NULL && glad_glGetTexParameterIuiv != glad_instrument_glGetTexParameterIuiv) {
+		glad_next_glGetTexParameterIuiv = glad_glGetTexParameterIuiv;
+		glad_glGetTexParameterIuiv = glad_instrument_glGetTexParameterIuiv;
+	}
+	if (glad_glClearBufferiv != NULL && glad_glClearBufferiv != glad_instrument_glClearBufferiv) {
+		glad_next_glClearBufferiv = glad_glClearBufferiv;
+		glad_glClearBufferiv = glad_instrument_glClearBufferiv;
+	}
+	if (glad_glClearBufferuiv != NULL && glad_glClearBufferuiv != glad_instrument_glClearBufferuiv) {
+		glad_next_glClearBufferuiv = glad_glClearBufferuiv;
+		glad_glClearBufferuiv = glad_instrument_glClearBufferuiv;
+	}
+	if (glad_glClearBufferfv != NULL && glad_glClearBufferfv != glad_instrument_glClearBufferfv) {
+		glad_next_glClearBufferfv = glad_glClearBufferfv;
+		glad_glClearBufferfv = glad_instrument_glClearBufferfv;
+	}
+	if (glad_glClearBufferfi != NULL && glad_glClearBufferfi != glad_instrument_glClearBufferfi) {
+		glad_next_glClearBufferfi = glad_glClearBufferfi;
+		glad_glClearBufferfi = glad_instrument_glClearBufferfi;
+	}
+	if (glad_glGetStringi != NULL && glad_glGetStringi != glad_instrument_glGetStringi) {
+		glad_next_glGetStringi = glad_glGetStringi;
+		glad_glGetStringi = glad_instrument_glGetStringi;
+	}
+	if (glad_glIsRenderbuffer != NULL && glad_glIsRenderbuffer != glad_instrument_glIsRenderbuffer) {
+		glad_next_glIsRenderbuffer = glad_glIsRenderbuffer;
+		glad_glIsRenderbuffer = glad_instrument_glIsRenderbuffer;
+	}
+	if (glad_glBindRenderbuffer != NULL && glad_glBindRenderbuffer != glad_instrument_glBindRenderbuffer) {
+		glad_next_glBindRenderbuffer = glad_glBindRenderbuffer;
+		glad_glBindRenderbuffer = glad_instrument_glBindRenderbuffer;
+	}
+	if (glad_glDeleteRenderbuffers != NULL && glad_glDeleteRenderbuffers != glad_instrument_glDeleteRenderbuffers) {
+		glad_next_glDeleteRenderbuffers = glad_glDeleteRenderbuffers;
+		glad_glDeleteRenderbuffers = glad_instrument_glDeleteRenderbuffers;
+	}
+	if (glad_glGenRenderbuffers != NULL && glad_glGenRenderbuffers != glad_instrument_glGenRenderbuffers) {
+		glad_next_glGenRenderbuffers = glad_glGenRenderbuffers;
+		glad_glGenRenderbuffers = glad_instrument_glGenRenderbuffers;
+	}
+	if (glad_glRenderbufferStorage != NULL && glad_glRenderbufferStorage != glad_instrument_glRenderbufferStorage) {
+		glad_next_glRenderbufferStorage = glad_glRenderbufferStorage;
+		glad_glRenderbufferStorage = glad_instrument_glRenderbufferStorage;
+	}
+	if (glad_glGetRenderbufferParameteriv != NULL && glad_glGetRenderbufferParameteriv != glad_instrument_glGetRenderbufferParameteriv) {
+		glad_next_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+		glad_glGetRenderbufferParameteriv = glad_instrument_glGetRenderbufferParameteriv;
+	}
+	if (glad_glIsFramebuffer != NULL && glad_glIsFramebuffer != glad_instrument_glIsFramebuffer) {
+		glad_next_glIsFramebuffer = glad_glIsFramebuffer;
+		glad_glIsFramebuffer = glad_instrument_glIsFramebuffer;
+	}
+	if (glad_glBindFramebuffer != NULL && glad_glBindFramebuffer != glad_instrument_glBindFramebuffer) {
+		glad_next_glBindFramebuffer = glad_glBindFramebuffer;
+		glad_glBindFramebuffer = glad_instrument_glBindFramebuffer;
+	}
+	if (glad_glDeleteFramebuffers != NULL && glad_glDeleteFramebuffers != glad_instrument_glDeleteFramebuffers) {
+		glad_next_glDeleteFramebuffers = glad_glDeleteFramebuffers;
+		glad_glDeleteFramebuffers = glad_instrument_glDeleteFramebuffers;
+	}
+	if (glad_glGenFramebuffers != NULL && glad_glGenFramebuffers != glad_instrument_glGenFramebuffers) {
+		glad_next_glGenFramebuffers = glad_glGenFramebuffers;
+		glad_glGenFramebuffers = glad_instrument_glGenFramebuffers;
+	}
+	if (glad_glCheckFramebufferStatus != NULL && glad_glCheckFramebufferStatus != glad_instrument_glCheckFramebufferStatus) {
+		glad_next_glCheckFramebufferStatus = glad_glCheckFramebufferStatus;
+		glad_glCheckFramebufferStatus = glad_instrument_glCheckFramebufferStatus;
+	}
+	if (glad_glFramebufferTexture1D != NULL && glad_glFramebufferTexture1D != glad_instrument_glFramebufferTexture1D) {
+		glad_next_glFramebufferTexture1D = glad_glFramebufferTexture1D;
+		glad_glFramebufferTexture1D = glad_instrument_glFramebufferTexture1D;
+	}
+	if (glad_glFramebufferTexture2D != NULL && glad_glFramebufferTexture2D != glad_instrument_glFramebufferTexture2D) {
+		glad_next_glFramebufferTexture2D = glad_glFramebufferTexture2D;
+		glad_glFramebufferTexture2D = glad_instrument_glFramebufferTexture2D;
+	}
+	if (glad_glFramebufferTexture3D != NULL && glad_glFramebufferTexture3D != glad_instrument_glFramebufferTexture3D) {
+		glad_next_glFramebufferTexture3D = glad_glFramebufferTexture3D;
+		glad_glFramebufferTexture3D = glad_instrument_glFramebufferTexture3D;
+	}
+	if (glad_glFramebufferRenderbuffer != NULL && glad_glFramebufferRenderbuffer != glad_instrument_glFramebufferRenderbuffer) {
+		glad_next_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+		glad_glFramebufferRenderbuffer = glad_instrument_glFramebufferRenderbuffer;
+	}
+	if (glad_glGetFramebufferAttachmentParameteriv != NULL && glad_glGetFramebufferAttachmentParameteriv != glad_instrument_glGetFramebufferAttachmentParameteriv) {
+		glad_next_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+		glad_glGetFramebufferAttachmentParameteriv = glad_instrument_glGetFramebufferAttachmentParameteriv;
+	}
+	if (glad_glGenerateMipmap != NULL && glad_glGenerateMipmap != glad_instrument_glGenerateMipmap) {
+		glad_next_glGenerateMipmap = glad_glGenerateMipmap;
+		glad_glGenerateMipmap = glad_instrument_glGenerateMipmap;
+	}
+	if (glad_glBlitFramebuffer != NULL && glad_glBlitFramebuffer != glad_instrument_glBlitFramebuffer) {
+		glad_next_glBlitFramebuffer = glad_glBlitFramebuffer;
+		glad_glBlitFramebuffer = glad_instrument_glBlitFramebuffer;
+	}
+	if (glad_glRenderbufferStorageMultisample != NULL && glad_glRenderbufferStorageMultisample != glad_instrument_glRenderbufferStorageMultisample) {
+		glad_next_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+		glad_glRenderbufferStorageMultisample = glad_instrument_glRenderbufferStorageMultisample;
+	}
+	if (glad_glFramebufferTextureLayer != NULL && glad_glFramebufferTextureLayer != glad_instrument_glFramebufferTextureLayer) {
+		glad_next_glFramebufferTextureLayer = glad_glFramebufferTextureLayer;
+		glad_glFramebufferTextureLayer = glad_instrument_glFramebufferTextureLayer;
+	}
+	if (glad_glMapBufferRange != NULL && glad_glMapBufferRange != glad_instrument_glMapBufferRange) {
+		glad_next_glMapBufferRange = glad_glMapBufferRange;
+		glad_glMapBufferRange = glad_instrument_glMapBufferRange;
+	}
+	if (glad_glFlushMappedBufferRange != NULL && glad_glFlushMappedBufferRange != glad_instrument_glFlushMappedBufferRange) {
+		glad_next_glFlushMappedBufferRange = glad_glFlushMappedBufferRange;
+		glad_glFlushMappedBufferRange = glad_instrument_glFlushMappedBufferRange;
+	}
+	if (glad_glBindVertexArray != NULL && glad_glBindVertexArray != glad_instrument_glBindVertexArray) {
+		glad_next_glBindVertexArray = glad_glBindVertexArray;
+		glad_glBindVertexArray = glad_instrument_glBindVertexArray;
+	}
+	if (glad_glDeleteVertexArrays != NULL && glad_glDeleteVertexArrays != glad_instrument_glDeleteVertexArrays) {
+		glad_next_glDeleteVertexArrays = glad_glDeleteVertexArrays;
+		glad_glDeleteVertexArrays = glad_instrument_glDeleteVertexArrays;
+	}
+	if (glad_glGenVertexArrays != NULL && glad_glGenVertexArrays != glad_instrument_glGenVertexArrays) {
+		glad_next_glGenVertexArrays = glad_glGenVertexArrays;
+		glad_glGenVertexArrays = glad_instrument_glGenVertexArrays;
+	}
+	if (glad_glIsVertexArray != NULL && glad_glIsVertexArray != glad_instrument_glIsVertexArray) {
+		glad_next_glIsVertexArray = glad_glIsVertexArray;
+		glad_glIsVertexArray = glad_instrument_glIsVertexArray;
+	}
+	if (glad_glDrawArraysInstanced != NULL && glad_glDrawArraysInstanced != glad_instrument_glDrawArraysInstanced) {
+		glad_next_glDrawArraysInstanced = glad_glDrawArraysInstanced;
+		glad_glDrawArraysInstanced = glad_instrument_glDrawArraysInstanced;
+	}
+	if (glad_glDrawElementsInstanced != NULL && glad_glDrawElementsInstanced != glad_instrument_glDrawElementsInstanced) {
+		glad_next_glDrawElementsInstanced = glad_glDrawElementsInstanced;
+		glad_glDrawElementsInstanced = glad_instrument_glDrawElementsInstanced;
+	}
+	if (glad_glTexBuffer != NULL && glad_glTexBuffer != glad_instrument_glTexBuffer) {
+		glad_next_glTexBuffer = glad_glTexBuffer;
+		glad_glTexBuffer = glad_instrument_glTexBuffer;
+	}
+	if (glad_glPrimitiveRestartIndex != NULL && glad_glPrimitiveRestartIndex != glad_instrument_glPrimitiveRestartIndex) {
+		glad_next_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+		glad_glPrimitiveRestartIndex = glad_instrument_glPrimitiveRestartIndex;
+	}
+	if (glad_glCopyBufferSubData != NULL && glad_glCopyBufferSubData != glad_instrument_glCopyBufferSubData) {
+		glad_next_glCopyBufferSubData = glad_glCopyBufferSubData;
+		glad_glCopyBufferSubData = glad_instrument_glCopyBufferSubData;
+	}
+	if (glad_glGetUniformIndices != NULL && glad_glGetUniformIndices != glad_instrument_glGetUniformIndices) {
+		glad_next_glGetUniformIndices = glad_glGetUniformIndices;
+		glad_glGetUniformIndices = glad_instrument_glGetUniformIndices;
+	}
+	if (glad_glGetActiveUniformsiv != NULL && glad_glGetActiveUniformsiv != glad_instrument_glGetActiveUniformsiv) {
+		glad_next_glGetActiveUniformsiv = glad_glGetActiveUniformsiv;
+		glad_glGetActiveUniformsiv = glad_instrument_glGetActiveUniformsiv;
+	}
+	if (glad_glGetActiveUniformName != NULL && glad_glGetActiveUniformName != glad_instrument_glGetActiveUniformName) {
+		glad_next_glGetActiveUniformName = glad_glGetActiveUniformName;
+		glad_glGetActiveUniformName = glad_instrument_glGetActiveUniformName;
+	}
+	if (glad_glGetUniformBlockIndex != NULL && glad_glGetUniformBlockIndex != glad_instrument_glGetUniformBlockIndex) {
+		glad_next_glGetUniformBlockIndex = glad_glGetUniformBlockIndex;
+		glad_glGetUniformBlockIndex = glad_instrument_glGetUniformBlockIndex;
+	}
+	if (glad_glGetActiveUniformBlockiv != NULL && glad_glGetActiveUniformBlockiv != glad_instrument_glGetActiveUniformBlockiv) {
+		glad_next_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+		glad_glGetActiveUniformBlockiv = glad_instrument_glGetActiveUniformBlockiv;
+	}
+	if (glad_glGetActiveUniformBlockName != NULL && glad_glGetActiveUniformBlockName != glad_instrument_glGetActiveUniformBlockName) {
+		glad_next_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+		glad_glGetActiveUniformBlockName = glad_instrument_glGetActiveUniformBlockName;
+	}
+	if (glad_glUniformBlockBinding != NULL && glad_glUniformBlockBinding != glad_instrument_glUniformBlockBinding) {
+		glad_next_glUniformBlockBinding = glad_glUniformBlockBinding;
+		glad_glUniformBlockBinding = glad_instrument_glUniformBlockBinding;
+	}
+	if (glad_glDrawElementsBaseVertex != NULL && glad_glDrawElementsBaseVertex != glad_instrument_glDrawElementsBaseVertex) {
+		glad_next_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+		glad_glDrawElementsBaseVertex = glad_instrument_glDrawElementsBaseVertex;
+	}
+	if (glad_glDrawRangeElementsBaseVertex != NULL && glad_glDrawRangeElementsBaseVertex != glad_instrument_glDrawRangeElementsBaseVertex) {
+		glad_next_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+		glad_glDrawRangeElementsBaseVertex = glad_instrument_glDrawRangeElementsBaseVertex;
+	}
+	if (glad_glDrawElementsInstancedBaseVertex != NULL && glad_glDrawElementsInstancedBaseVertex != glad_instrument_glDrawElementsInstancedBaseVertex) {
+		glad_next_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+		glad_glDrawElementsInstancedBaseVertex = glad_instrument_glDrawElementsInstancedBaseVertex;
+	}
+	if (glad_glMultiDrawElementsBaseVertex != NULL && glad_glMultiDrawElementsBaseVertex != glad_instrument_glMultiDrawElementsBaseVertex) {
+		glad_next_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+		glad_glMultiDrawElementsBaseVertex = glad_instrument_glMultiDrawElementsBaseVertex;
+	}
+	if (glad_glProvokingVertex != NULL && glad_glProvokingVertex != glad_instrument_glProvokingVertex) {
+		glad_next_glProvokingVertex = glad_glProvokingVertex;
+		glad_glProvokingVertex = glad_instrument_glProvokingVertex;
+	}
+	if (glad_glFenceSync != NULL && glad_glFenceSync != glad_instrument_glFenceSync) {
+		glad_next_glFenceSync = glad_glFenceSync;
+		glad_glFenceSync = glad_instrument_glFenceSync;
+	}
+	if (glad_glIsSync != NULL && glad_glIsSync != glad_instrument_glIsSync) {
+		glad_next_glIsSync = glad_glIsSync;
+		glad_glIsSync = glad_instrument_glIsSync;
+	}
+	if (glad_glDeleteSync != NULL && glad_glDeleteSync != glad_instrument_glDeleteSync) {
+		glad_next_glDeleteSync = glad_glDeleteSync;
+		glad_glDeleteSync = glad_instrument_glDeleteSync;
+	}
+	if (glad_glClientWaitSync != NULL && glad_glClientWaitSync != glad_instrument_glClientWaitSync) {
+		glad_next_glClientWaitSync = glad_glClientWaitSync;
+		glad_glClientWaitSync = glad_instrument_glClientWaitSync;
+	}
+	if (glad_glWaitSync != NULL && glad_glWaitSync != glad_instrument_glWaitSync) {
+		glad_next_glWaitSync = glad_glWaitSync;
+		glad_glWaitSync = glad_instrument_glWaitSync;
+	}
+	if (glad_glGetInteger64v != NULL && glad_glGetInteger64v != glad_instrument_glGetInteger64v) {
+		glad_next_glGetInteger64v = glad_glGetInteger64v;
+		glad_glGetInteger64v = glad_instrument_glGetInteger64v;
+	}
+	if (glad_glGetSynciv != NULL && glad_glGetSynciv != glad_instrument_glGetSynciv) {
+		glad_next_glGetSynciv = glad_glGetSynciv;
+		glad_glGetSynciv = glad_instrument_glGetSynciv;
+	}
+	if (glad_glGetInteger64i_v != NULL && glad_glGetInteger64i_v != glad_instrument_glGetInteger64i_v) {
+		glad_next_glGetInteger64i_v = glad_glGetInteger64i_v;
+		glad_glGetInteger64i_v = glad_instrument_glGetInteger64i_v;
+	}
+	if (glad_glGetBufferParameteri64v != NULL && glad_glGetBufferParameteri64v != glad_instrument_glGetBufferParameteri64v) {
+		glad_next_glGetBufferParameteri64v = glad_glGetBufferParameteri64v;
+		glad_glGetBufferParameteri64v = glad_instrument_glGetBufferParameteri64v;
+	}
+	if (glad_glFramebufferTexture != NULL && glad_glFramebufferTexture != glad_instrument_glFramebufferTexture) {
+		glad_next_glFramebufferTexture = glad_glFramebufferTexture;
+		glad_glFramebufferTexture = glad_instrument_glFramebufferTexture;
+	}
+	if (glad_glTexImage2DMultisample != NULL && glad_glTexImage2DMultisample != glad_instrument_glTexImage2DMultisample) {
+		glad_next_glTexImage2DMultisample = glad_glTexImage2DMultisample;
+		glad_glTexImage2DMultisample = glad_instrument_glTexImage2DMultisample;
+	}
+	if (glad_glTexImage3DMultisample != NULL && glad_glTexImage3DMultisample != glad_instrument_glTexImage3DMultisample) {
+		glad_next_glTexImage3DMultisample = glad_glTexImage3DMultisample;
+		glad_glTexImage3DMultisample = glad_instrument_glTexImage3DMultisample;
+	}
+	if (glad_glGetMultisamplefv != NULL && glad_glGetMultisamplefv != glad_instrument_glGetMultisamplefv) {
+		glad_next_glGetMultisamplefv = glad_glGetMultisamplefv;
+		glad_glGetMultisamplefv = glad_instrument_glGetMultisamplefv;
+	}
+	if (glad_glSampleMaski != NULL && glad_glSampleMaski != glad_instrument_glSampleMaski) {
+		glad_next_glSampleMaski = glad_glSampleMaski;
+		glad_glSampleMaski = glad_instrument_glSampleMaski;
+	}
+	if (glad_glBindFragDataLocationIndexed != NULL && glad_glBindFragDataLocationIndexed != glad_instrument_glBindFragDataLocationIndexed) {
+		glad_next_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+		glad_glBindFragDataLocationIndexed = glad_instrument_glBindFragDataLocationIndexed;
+	}
+	if (glad_glGetFragDataIndex != NULL && glad_glGetFragDataIndex != glad_instrument_glGetFragDataIndex) {
+		glad_next_glGetFragDataIndex = glad_glGetFragDataIndex;
+		glad_glGetFragDataIndex = glad_instrument_glGetFragDataIndex;
+	}
+	if (glad_glGenSamplers != NULL && glad_glGenSamplers != glad_instrument_glGenSamplers) {
+		glad_next_glGenSamplers = glad_glGenSamplers;
+		glad_glGenSamplers = glad_instrument_glGenSamplers;
+	}
+	if (glad_glDeleteSamplers != NULL && glad_glDeleteSamplers != glad_instrument_glDeleteSamplers) {
+		glad_next_glDeleteSamplers = glad_glDeleteSamplers;
+		glad_glDeleteSamplers = glad_instrument_glDeleteSamplers;
+	}
+	if (glad_glIsSampler != NULL && glad_glIsSampler != glad_instrument_glIsSampler) {
+		glad_next_glIsSampler = glad_glIsSampler;
+		glad_glIsSampler = glad_instrument_glIsSampler;
+	}
+	if (glad_glBindSampler != NULL && glad_glBindSampler != glad_instrument_glBindSampler) {
+		glad_next_glBindSampler = glad_glBindSampler;
+		glad_glBindSampler = glad_instrument_glBindSampler;
+	}
+	if (glad_glSamplerParameteri != NULL && glad_glSamplerParameteri != glad_instrument_glSamplerParameteri) {
+		glad_next_glSamplerParameteri = glad_glSamplerParameteri;
+		glad_glSamplerParameteri = glad_instrument_glSamplerParameteri;
+	}
+	if (glad_glSamplerParameteriv != NULL && glad_glSamplerParameteriv != glad_instrument_glSamplerParameteriv) {
+		glad_next_glSamplerParameteriv = glad_glSamplerParameteriv;
+		glad_glSamplerParameteriv = glad_instrument_glSamplerParameteriv;
+	}
+	if (glad_glSamplerParameterf != NULL && glad_glSamplerParameterf != glad_instrument_glSamplerParameterf) {
+		glad_next_glSamplerParameterf = glad_glSamplerParameterf;
+		glad_glSamplerParameterf = glad_instrument_glSamplerParameterf;
+	}
+	if (glad_glSamplerParameterfv != NULL && glad_glSamplerParameterfv != glad_instrument_glSamplerParameterfv) {
+		glad_next_glSamplerParameterfv = glad_glSamplerParameterfv;
+		glad_glSamplerParameterfv = glad_instrument_glSamplerParameterfv;
+	}
+	if (glad_glSamplerParameterIiv != NULL && glad_glSamplerParameterIiv != glad_instrument_glSamplerParameterIiv) {
+		glad_next_glSamplerParameterIiv = glad_glSamplerParameterIiv;
+		glad_glSamplerParameterIiv = glad_instrument_glSamplerParameterIiv;
+	}
+	if (glad_glSamplerParameterIuiv != NULL && glad_glSamplerParameterIuiv != glad_instrument_glSamplerParameterIuiv) {
+		glad_next_glSamplerParameterIuiv = glad_glSamplerParameterIuiv;
+		glad_glSamplerParameterIuiv = glad_instrument_glSamplerParameterIuiv;
+	}
+	if (glad_glGetSamplerParameteriv != NULL && glad_glGetSamplerParameteriv != glad_instrument_glGetSamplerParameteriv) {
+		glad_next_glGetSamplerParameteriv = glad_glGetSamplerParameteriv;
+		glad_glGetSamplerParameteriv = glad_instrument_glGetSamplerParameteriv;
+	}
+	if (glad_glGetSamplerParameterIiv != NULL && glad_glGetSamplerParameterIiv != glad_instrument_glGetSamplerParameterIiv) {
+		glad_next_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+		glad_glGetSamplerParameterIiv = glad_instrument_glGetSamplerParameterIiv;
+	}
+	if (glad_glGetSamplerParameterfv != NULL && glad_glGetSamplerParameterfv != glad_instrument_glGetSamplerParameterfv) {
+		glad_next_glGetSamplerParameterfv = glad_glGetSamplerParameterfv;
+		glad_glGetSamplerParameterfv = glad_instrument_glGetSamplerParameterfv;
+	}
+	if (glad_glGetSamplerParameterIuiv != NULL && glad_glGetSamplerParameterIuiv != glad_instrument_glGetSamplerParameterIuiv) {
+		glad_next_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+		glad_glGetSamplerParameterIuiv = glad_instrument_glGetSamplerParameterIuiv;
+	}
+	if (glad_glQueryCounter != NULL && glad_glQueryCounter != glad_instrument_glQueryCounter) {
+		glad_next_glQueryCounter = glad_glQueryCounter;
+		glad_glQueryCounter = glad_instrument_glQueryCounter;
+	}
+	if (glad_glGetQueryObjecti64v != NULL && glad_glGetQueryObjecti64v != glad_instrument_glGetQueryObjecti64v) {
+		glad_next_glGetQueryObjecti64v = glad_glGetQueryObjecti64v;
+		glad_glGetQueryObjecti64v = glad_instrument_glGetQueryObjecti64v;
+	}
+	if (glad_glGetQueryObjectui64v != NULL && glad_glGetQueryObjectui64v != glad_instrument_glGetQueryObjectui64v) {
+		glad_next_glGetQueryObjectui64v = glad_glGetQueryObjectui64v;
+		glad_glGetQueryObjectui64v = glad_instrument_glGetQueryObjectui64v;
+	}
+	if (glad_glVertexAttribDivisor != NULL && glad_glVertexAttribDivisor != glad_instrument_glVertexAttribDivisor) {
+		glad_next_glVertexAttribDivisor = glad_glVertexAttribDivisor;
+		glad_glVertexAttribDivisor = glad_instrument_glVertexAttribDivisor;
+	}
+	if (glad_glVertexAttribP1ui != NULL && glad_glVertexAttribP1ui != glad_instrument_glVertexAttribP1ui) {
+		glad_next_glVertexAttribP1ui = glad_glVertexAttribP1ui;
+		glad_glVertexAttribP1ui = glad_instrument_glVertexAttribP1ui;
+	}
+	if (glad_glVertexAttribP1uiv != NULL && glad_glVertexAttribP1uiv != glad_instrument_glVertexAttribP1uiv) {
+		glad_next_glVertexAttribP1uiv = glad_glVertexAttribP1uiv;
+		glad_glVertexAttribP1uiv = glad_instrument_glVertexAttribP1uiv;
+	}
+	if (glad_glVertexAttribP2ui != NULL && glad_glVertexAttribP2ui != glad_instrument_glVertexAttribP2ui) {
+		glad_next_glVertexAttribP2ui = glad_glVertexAttribP2ui;
+		glad_glVertexAttribP2ui = glad_instrument_glVertexAttribP2ui;
+	}
+	if (glad_glVertexAttribP2uiv != NULL && glad_glVertexAttribP2uiv != glad_instrument_glVertexAttribP2uiv) {
+		glad_next_glVertexAttribP2uiv = glad_glVertexAttribP2uiv;
+		glad_glVertexAttribP2uiv = glad_instrument_glVertexAttribP2uiv;
+	}
+	if (glad_glVertexAttribP3ui != NULL && glad_glVertexAttribP3ui != glad_instrument_glVertexAttribP3ui) {
+		glad_next_glVertexAttribP3ui = glad_glVertexAttribP3ui;
+		glad_glVertexAttribP3ui = glad_instrument_glVertexAttribP3ui;
+	}
+	if (glad_glVertexAttribP3uiv != NULL && glad_glVertexAttribP3uiv != glad_instrument_glVertexAttribP3uiv) {
+		glad_next_glVertexAttribP3uiv = glad_glVertexAttribP3uiv;
+		glad_glVertexAttribP3uiv = glad_instrument_glVertexAttribP3uiv;
+	}
+	if (glad_glVertexAttribP4ui != NULL && glad_glVertexAttribP4ui != glad_instrument_glVertexAttribP4ui) {
+		glad_next_glVertexAttribP4ui = glad_glVertexAttribP4ui;
+		glad_glVertexAttribP4ui = glad_instrument_glVertexAttribP4ui;
+	}
+	if (glad_glVertexAttribP4uiv != NULL && glad_glVertexAttribP4uiv != glad_instrument_glVertexAttribP4uiv) {
+		glad_next_glVertexAttribP4uiv = glad_glVertexAttribP4uiv;
+		glad_glVertexAttribP4uiv = glad_instrument_glVertexAttribP4uiv;
+	}
+	if (glad_glVertexP2ui != NULL && glad_glVertexP2ui != glad_instrument_glVertexP2ui) {
+		glad_next_glVertexP2ui = glad_glVertexP2ui;
+		glad_glVertexP2ui = glad_instrument_glVertexP2ui;
+	}
+	if (glad_glVertexP2uiv != NULL && glad_glVertexP2uiv != glad_instrument_glVertexP2uiv) {
+		glad_next_glVertexP2uiv = glad_glVertexP2uiv;
+		glad_glVertexP2uiv = glad_instrument_glVertexP2uiv;
+	}
+	if (glad_glVertexP3ui != NULL && glad_glVertexP3ui != glad_instrument_glVertexP3ui) {
+		glad_next_glVertexP3ui = glad_glVertexP3ui;
+		glad_glVertexP3ui = glad_instrument_glVertexP3ui;
+	}
+	if (glad_glVertexP3uiv != NULL && glad_glVertexP3uiv != glad_instrument_glVertexP3uiv) {
+		glad_next_glVertexP3uiv = glad_glVertexP3uiv;
+		glad_glVertexP3uiv = glad_instrument_glVertexP3uiv;
+	}
+	if (glad_glVertexP4ui != NULL && glad_glVertexP4ui != glad_instrument_glVertexP4ui) {
+		glad_next_glVertexP4ui = glad_glVertexP4ui;
+		glad_glVertexP4ui = glad_instrument_glVertexP4ui;
+	}
+	if (glad_glVertexP4uiv != NULL && glad_glVertexP4uiv != glad_instrument_glVertexP4uiv) {
+		glad_next_glVertexP4uiv = glad_glVertexP4uiv;
+		glad_glVertexP4uiv = glad_instrument_glVertexP4uiv;
+	}
+	if (glad_glTexCoordP1ui != NULL && glad_glTexCoordP1ui != glad_instrument_glTexCoordP1ui) {
+		glad_next_glTexCoordP1ui = glad_glTexCoordP1ui;
+		glad_glTexCoordP1ui = glad_instrument_glTexCoordP1ui;
+	}
+	if (glad_glTexCoordP1uiv != NULL && glad_glTexCoordP1uiv != glad_instrument_glTexCoordP1uiv) {
+		glad_next_glTexCoordP1uiv = glad_glTexCoordP1uiv;
+		glad_glTexCoordP1uiv = glad_instrument_glTexCoordP1uiv;
+	}
+	if (glad_glTexCoordP2ui != NULL && glad_glTexCoordP2ui != glad_instrument_glTexCoordP2ui) {
+		glad_next_glTexCoordP2ui = glad_glTexCoordP2ui;
+		glad_glTexCoordP2ui = glad_instrument_glTexCoordP2ui;
+	}
+	if (glad_glTexCoordP2uiv != NULL && glad_glTexCoordP2uiv != glad_instrument_glTexCoordP2uiv) {
+		glad_next_glTexCoordP2uiv = glad_glTexCoordP2uiv;
+		glad_glTexCoordP2uiv = glad_instrument_glTexCoordP2uiv;
+	}
+	if (glad_glTexCoordP3ui != NULL && glad_glTexCoordP3ui != glad_instrument_glTexCoordP3ui) {
+		glad_next_glTexCoordP3ui = glad_glTexCoordP3ui;
+		glad_glTexCoordP3ui = glad_instrument_glTexCoordP3ui;
+	}
+	if (glad_glTexCoordP3uiv != NULL && glad_glTexCoordP3uiv != glad_instrument_glTexCoordP3uiv) {
+		glad_next_glTexCoordP3uiv = glad_glTexCoordP3uiv;
+		glad_glTexCoordP3uiv = glad_instrument_glTexCoordP3uiv;
+	}
+	if (glad_glTexCoordP4ui != NULL && glad_glTexCoordP4ui != glad_instrument_glTexCoordP4ui) {
+		glad_next_glTexCoordP4ui = glad_glTexCoordP4ui;
+		glad_glTexCoordP4ui = glad_instrument_glTexCoordP4ui;
+	}
+	if (glad_glTexCoordP4uiv != NULL && glad_glTexCoordP4uiv != glad_instrument_glTexCoordP4uiv) {
+		glad_next_glTexCoordP4uiv = glad_glTexCoordP4uiv;
+		glad_glTexCoordP4uiv = glad_instrument_glTexCoordP4uiv;
+	}
+	if (glad_glMultiTexCoordP1ui != NULL && glad_glMultiTexCoordP1ui != glad_instrument_glMultiTexCoordP1ui) {
+		glad_next_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+		glad_glMultiTexCoordP1ui = glad_instrument_glMultiTexCoordP1ui;
+	}
+	if (glad_glMultiTexCoordP1uiv != NULL && glad_glMultiTexCoordP1uiv != glad_instrument_glMultiTexCoordP1uiv) {
+		glad_next_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+		glad_glMultiTexCoordP1uiv = glad_instrument_glMultiTexCoordP1uiv;
+	}
+	if (glad_glMultiTexCoordP2ui != NULL && glad_glMultiTexCoordP2ui != glad_instrument_glMultiTexCoordP2ui) {
+		glad_next_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+		glad_glMultiTexCoordP2ui = glad_instrument_glMultiTexCoordP2ui;
+	}
+	if (glad_glMultiTexCoordP2uiv != NULL && glad_glMultiTexCoordP2uiv != glad_instrument_glMultiTexCoordP2uiv) {
+		glad_next_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+		glad_glMultiTexCoordP2uiv = glad_instrument_glMultiTexCoordP2uiv;
+	}
+	if (glad_glMultiTexCoordP3ui != NULL && glad_glMultiTexCoordP3ui != glad_instrument_glMultiTexCoordP3ui) {
+		glad_next_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+		glad_glMultiTexCoordP3ui = glad_instrument_glMultiTexCoordP3ui;
+	}
+	if (glad_glMultiTexCoordP3uiv != NULL && glad_glMultiTexCoordP3uiv != glad_instrument_glMultiTexCoordP3uiv) {
+		glad_next_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+		glad_glMultiTexCoordP3uiv = glad_instrument_glMultiTexCoordP3uiv;
+	}
+	if (glad_glMultiTexCoordP4ui != NULL && glad_glMultiTexCoordP4ui != glad_instrument_glMultiTexCoordP4ui) {
+		glad_next_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+		glad_glMultiTexCoordP4ui = glad_instrument_glMultiTexCoordP4ui;
+	}
+	if (glad_glMultiTexCoordP4uiv != NULL && glad_glMultiTexCoordP4uiv != glad_instrument_glMultiTexCoordP4uiv) {
+		glad_next_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+		glad_glMultiTexCoordP4uiv = glad_instrument_glMultiTexCoordP4uiv;
+	}
+	if (glad_glNormalP3ui != NULL && glad_glNormalP3ui != glad_instrument_glNormalP3ui) {
+		glad_next_glNormalP3ui = glad_glNormalP3ui;
+		glad_glNormalP3ui = glad_instrument_glNormalP3ui;
+	}
+	if (glad_glNormalP3uiv != NULL && glad_glNormalP3uiv != glad_instrument_glNormalP3uiv) {
+		glad_next_glNormalP3uiv = glad_glNormalP3uiv;
+		glad_glNormalP3uiv = glad_instrument_glNormalP3uiv;
+	}
+	if (glad_glColorP3ui != NULL && glad_glColorP3ui != glad_instrument_glColorP3ui) {
+		glad_next_glColorP3ui = glad_glColorP3ui;
+		glad_glColorP3ui = glad_instrument_glColorP3ui;
+	}
+	if (glad_glColorP3uiv != NULL && glad_glColorP3uiv != glad_instrument_glColorP3uiv) {
+		glad_next_glColorP3uiv = glad_glColorP3uiv;
+		glad_glColorP3uiv = glad_instrument_glColorP3uiv;
+	}
+	if (glad_glColorP4ui != NULL && glad_glColorP4ui != glad_instrument_glColorP4ui) {
+		glad_next_glColorP4ui = glad_glColorP4ui;
+		glad_glColorP4ui = glad_instrument_glColorP4ui;
+	}
+	if (glad_glColorP4uiv != NULL && glad_glColorP4uiv != glad_instrument_glColorP4uiv) {
+		glad_next_glColorP4uiv = glad_glColorP4uiv;
+		glad_glColorP4uiv = glad_instrument_glColorP4uiv;
+	}
+	if (glad_glSecondaryColorP3ui != NULL && glad_glSecondaryColorP3ui != glad_instrument_glSecondaryColorP3ui) {
+		glad_next_glSecondaryColorP3ui = glad_glSecondaryColorP3ui;
+		glad_glSecondaryColorP3ui = glad_instrument_glSecondaryColorP3ui;
+	}
+	if (glad_glSecondaryColorP3uiv != NULL && glad_glSecondaryColorP3uiv != glad_instrument_glSecondaryColorP3uiv) {
+		glad_next_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+		glad_glSecondaryColorP3uiv = glad_instrument_glSecondaryColorP3uiv;
+	}
+	if (glad_glMinSampleShading != NULL && glad_glMinSampleShading != glad_instrument_glMinSampleShading) {
+		glad_next_glMinSampleShading = glad_glMinSampleShading;
+		glad_glMinSampleShading = glad_instrument_glMinSampleShading;
+	}
+	if (glad_glBlendEquationi != NULL && glad_glBlendEquationi != glad_instrument_glBlendEquationi) {
+		glad_next_glBlendEquationi = glad_glBlendEquationi;
+		glad_glBlendEquationi = glad_instrument_glBlendEquationi;
+	}
+	if (glad_glBlendEquationSeparatei != NULL && glad_glBlendEquationSeparatei != glad_instrument_glBlendEquationSeparatei) {
+		glad_next_glBlendEquationSeparatei = glad_glBlendEquationSeparatei;
+		glad_glBlendEquationSeparatei = glad_instrument_glBlendEquationSeparatei;
+	}
+	if (glad_glBlendFunci != NULL && glad_glBlendFunci != glad_instrument_glBlendFunci) {
+		glad_next_glBlendFunci = glad_glBlendFunci;
+		glad_glBlendFunci = glad_instrument_glBlendFunci;
+	}
+	if (glad_glBlendFuncSeparatei != NULL && glad_glBlendFuncSeparatei != glad_instrument_glBlendFuncSeparatei) {
+		glad_next_glBlendFuncSeparatei = glad_glBlendFuncSeparatei;
+		glad_glBlendFuncSeparatei = glad_instrument_glBlendFuncSeparatei;
+	}
+	if (glad_glDrawArraysIndirect != NULL && glad_glDrawArraysIndirect != glad_instrument_glDrawArraysIndirect) {
+		glad_next_glDrawArraysIndirect = glad_glDrawArraysIndirect;
+		glad_glDrawArraysIndirect = glad_instrument_glDrawArraysIndirect;
+	}
+	if (glad_glDrawElementsIndirect != NULL && glad_glDrawElementsIndirect != glad_instrument_glDrawElementsIndirect) {
+		glad_next_glDrawElementsIndirect = glad_glDrawElementsIndirect;
+		glad_glDrawElementsIndirect = glad_instrument_glDrawElementsIndirect;
+	}
+	if (glad_glUniform1d != NULL && glad_glUniform1d != glad_instrument_glUniform1d) {
+		glad_next_glUniform1d = glad_glUniform1d;
+		glad_glUniform1d = glad_instrument_glUniform1d;
+	}
+	if (glad_glUniform2d != NULL && glad_glUniform2d != glad_instrument_glUniform2d) {
+		glad_next_glUniform2d = glad_glUniform2d;
+		glad_glUniform2d = glad_instrument_glUniform2d;
+	}
+	if (glad_glUniform3d != NULL && glad_glUniform3d != glad_instrument_glUniform3d) {
+		glad_next_glUniform3d = glad_glUniform3d;
+		glad_glUniform3d = glad_instrument_glUniform3d;
+	}
+	if (glad_glUniform4d != NULL && glad_glUniform4d != glad_instrument_glUniform4d) {
+		glad_next_glUniform4d = glad_glUniform4d;
+		glad_glUniform4d = glad_instrument_glUniform4d;
+	}
+	if (glad_glUniform1dv != NULL && glad_glUniform1dv != glad_instrument_glUniform1dv) {
+		glad_next_glUniform1dv = glad_glUniform1dv;
+		glad_glUniform1dv = glad_instrument_glUniform1dv;
+	}
+	if (glad_glUniform2dv != NULL && glad_glUniform2dv != glad_instrument_glUniform2dv) {
+		glad_next_glUniform2dv = glad_glUniform2dv;
+		glad_glUniform2dv = glad_instrument_glUniform2dv;
+	}
+	if (glad_glUniform3dv != NULL && glad_glUniform3dv != glad_instrument_glUniform3dv) {
+		glad_next_glUniform3dv = glad_glUniform3dv;
+		glad_glUniform3dv = glad_instrument_glUniform3dv;
+	}
+	if (glad_glUniform4dv != NULL && glad_glUniform4dv != glad_instrument_glUniform4dv) {
+		glad_next_glUniform4dv = glad_glUniform4dv;
+		glad_glUniform4dv = glad_instrument_glUniform4dv;
+	}
+	if (glad_glUniformMatrix2dv != NULL && glad_glUniformMatrix2dv != glad_instrument_glUniformMatrix2dv) {
+		glad_next_glUniformMatrix2dv = glad_glUniformMatrix2dv;
+		glad_glUniformMatrix2dv = glad_instrument_glUniformMatrix2dv;
+	}
+	if (glad_glUniformMatrix3dv != NULL && glad_glUniformMatrix3dv != glad_instrument_glUniformMatrix3dv) {
+		glad_next_glUniformMatrix3dv = glad_glUniformMatrix3dv;
+		glad_glUniformMatrix3dv = glad_instrument_glUniformMatrix3dv;
+	}
+	if (glad_glUniformMatrix4dv != NULL && glad_glUniformMatrix4dv != glad_instrument_glUniformMatrix4dv) {
+		glad_next_glUniformMatrix4dv = glad_glUniformMatrix4dv;
+		glad_glUniformMatrix4dv = glad_instrument_glUniformMatrix4dv;
+	}
+	if (glad_glUniformMatrix2x3dv != NULL && glad_glUniformMatrix2x3dv != glad_instrument_glUniformMatrix2x3dv) {
+		glad_next_glUniformMatrix2x3dv = glad_glUniformMatrix2x3dv;
+		glad_glUniformMatrix2x3dv = glad_instrument_glUniformMatrix2x3dv;
+	}
+	if (glad_glUniformMatrix2x4dv != NULL && glad_glUniformMatrix2x4dv != glad_instrument_glUniformMatrix2x4dv) {
+		glad_next_glUniformMatrix2x4dv = glad_glUniformMatrix2x4dv;
+		glad_glUniformMatrix2x4dv = glad_instrument_glUniformMatrix2x4dv;
+	}
+	if (glad_glUniformMatrix3x2dv != NULL && glad_glUniformMatrix3x2dv != glad_instrument_glUniformMatrix3x2dv) {
+		glad_next_glUniformMatrix3x2dv = glad_glUniformMatrix3x2dv;
+		glad_glUniformMatrix3x2dv = glad_instrument_glUniformMatrix3x2dv;
+	}
+	if (glad_glUniformMatrix3x4dv != NULL && glad_glUniformMatrix3x4dv != glad_instrument_glUniformMatrix3x4dv) {
+		glad_next_glUniformMatrix3x4dv = glad_glUniformMatrix3x4dv;
+		glad_glUniformMatrix3x4dv = glad_instrument_glUniformMatrix3x4dv;
+	}
+	if (glad_glUniformMatrix4x2dv != NULL && glad_glUniformMatrix4x2dv != glad_instrument_glUniformMatrix4x2dv) {
+		glad_next_glUniformMatrix4x2dv = glad_glUniformMatrix4x2dv;
+		glad_glUniformMatrix4x2dv = glad_instrument_glUniformMatrix4x2dv;
+	}
+	if (glad_glUniformMatrix4x3dv != NULL && glad_glUniformMatrix4x3dv != glad_instrument_glUniformMatrix4x3dv) {
+		glad_next_glUniformMatrix4x3dv = glad_glUniformMatrix4x3dv;
+		glad_glUniformMatrix4x3dv = glad_instrument_glUniformMatrix4x3dv;
+	}
+	if (glad_glGetUniformdv != NULL && glad_glGetUniformdv != glad_instrument_glGetUniformdv) {
+		glad_next_glGetUniformdv = glad_glGetUniformdv;
+		glad_glGetUniformdv = glad_instrument_glGetUniformdv;
+	}
+	if (glad_glGetSubroutineUniformLocation != NULL && glad_glGetSubroutineUniformLocation != glad_instrument_glGetSubroutineUniformLocation) {
+		glad_next_glGetSubroutineUniformLocation = glad_glGetSubroutineUniformLocation;
+		glad_glGetSubroutineUniformLocation = glad_instrument_glGetSubroutineUniformLocation;
+	}
+	if (glad_glGetSubroutineIndex != NULL && glad_glGetSubroutineIndex != glad_instrument_glGetSubroutineIndex) {
+		glad_next_glGetSubroutineIndex = glad_glGetSubroutineIndex;
+		glad_glGetSubroutineIndex = glad_instrument_glGetSubroutineIndex;
+	}
+	if (glad_glGetActiveSubroutineUniformiv != NULL && glad_glGetActiveSubroutineUniformiv != glad_instrument_glGetActiveSubroutineUniformiv) {
+		glad_next_glGetActiveSubroutineUniformiv = glad_glGetActiveSubroutineUniformiv;
+		glad_glGetActiveSubroutineUniformiv = glad_instrument_glGetActiveSubroutineUniformiv;
+	}
+	if (glad_glGetActiveSubroutineUniformName != NULL && glad_glGetActiveSubroutineUniformName != glad_instrument_glGetActiveSubroutineUniformName) {
+		glad_next_glGetActiveSubroutineUniformName = glad_glGetActiveSubroutineUniformName;
+		glad_glGetActiveSubroutineUniformName = glad_instrument_glGetActiveSubroutineUniformName;
+	}
+	if (glad_glGetActiveSubroutineName != NULL && glad_glGetActiveSubroutineName != glad_instrument_glGetActiveSubroutineName) {
+		glad_next_glGetActiveSubroutineName = glad_glGetActiveSubroutineName;
+		glad_glGetActiveSubroutineName = glad_instrument_glGetActiveSubroutineName;
+	}
+	if (glad_glUniformSubroutinesuiv != NULL && glad_glUniformSubroutinesuiv != glad_instrument_glUniformSubroutinesuiv) {
+		glad_next_glUniformSubroutinesuiv = glad_glUniformSubroutinesuiv;
+		glad_glUniformSubroutinesuiv = glad_instrument_glUniformSubroutinesuiv;
+	}
+	if (glad_glGetUniformSubroutineuiv != NULL && glad_glGetUniformSubroutineuiv != glad_instrument_glGetUniformSubroutineuiv) {
+		glad_next_glGetUniformSubroutineuiv = glad_glGetUniformSubroutineuiv;
+		glad_glGetUniformSubroutineuiv = glad_instrument_glGetUniformSubroutineuiv;
+	}
+	if (glad_glGetProgramStageiv != NULL && glad_glGetProgramStageiv != glad_instrument_glGetProgramStageiv) {
+		glad_next_glGetProgramStageiv = glad_glGetProgramStageiv;
+		glad_glGetProgramStageiv = glad_instrument_glGetProgramStageiv;
+	}
+	if (glad_glPatchParameteri != NULL && glad_glPatchParameteri != glad_instrument_glPatchParameteri) {
+		glad_next_glPatchParameteri = glad_glPatchParameteri;
+		glad_glPatchParameteri = glad_instrument_glPatchParameteri;
+	}
+	if (glad_glPatchParameterfv != NULL && glad_glPatchParameterfv != glad_instrument_glPatchParameterfv) {
+		glad_next_glPatchParameterfv = glad_glPatchParameterfv;
+		glad_glPatchParameterfv = glad_instrument_glPatchParameterfv;
+	}
+	if (glad_glBindTransformFeedback != NULL && glad_glBindTransformFeedback != glad_instrument_glBindTransformFeedback) {
+		glad_next_glBindTransformFeedback = glad_glBindTransformFeedback;
+		glad_glBindTransformFeedback = glad_instrument_glBindTransformFeedback;
+	}
+	if (glad_glDeleteTransformFeedbacks != NULL && glad_glDeleteTransformFeedbacks != glad_instrument_glDeleteTransformFeedbacks) {
+		glad_next_glDeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks;
+		glad_glDeleteTransformFeedbacks = glad_instrument_glDeleteTransformFeedbacks;
+	}
+	if (glad_glGenTransformFeedbacks != NULL && glad_glGenTransformFeedbacks != glad_instrument_glGenTransformFeedbacks) {
+		glad_next_glGenTransformFeedbacks = glad_glGenTransformFeedbacks;
+		glad_glGenTransformFeedbacks = glad_instrument_glGenTransformFeedbacks;
+	}
+	if (glad_glIsTransformFeedback != NULL && glad_glIsTransformFeedback != glad_instrument_glIsTransformFeedback) {
+		glad_next_glIsTransformFeedback = glad_glIsTransformFeedback;
+		glad_glIsTransformFeedback = glad_instrument_glIsTransformFeedback;
+	}
+	if (glad_glPauseTransformFeedback != NULL && glad_glPauseTransformFeedback != glad_instrument_glPauseTransformFeedback) {
+		glad_next_glPauseTransformFeedback = glad_glPauseTransformFeedback;
+		glad_glPauseTransformFeedback = glad_instrument_glPauseTransformFeedback;
+	}
+	if (glad_glResumeTransformFeedback != NULL && glad_glResumeTransformFeedback != glad_instrument_glResumeTransformFeedback) {
+		glad_next_glResumeTransformFeedback = glad_glResumeTransformFeedback;
+		glad_glResumeTransformFeedback = glad_instrument_glResumeTransformFeedback;
+	}
+	if (glad_glDrawTransformFeedback != NULL && glad_glDrawTransformFeedback != glad_instrument_glDrawTransformFeedback) {
+		glad_next_glDrawTransformFeedback = glad_glDrawTransformFeedback;
+		glad_glDrawTransformFeedback = glad_instrument_glDrawTransformFeedback;
+	}
+	if (glad_glDrawTransformFeedbackStream != NULL && glad_glDrawTransformFeedbackStream != glad_instrument_glDrawTransformFeedbackStream) {
+		glad_next_glDrawTransformFeedbackStream = glad_glDrawTransformFeedbackStream;
+		glad_glDrawTransformFeedbackStream = glad_instrument_glDrawTransformFeedbackStream;
+	}
+	if (glad_glBeginQueryIndexed != NULL && glad_glBeginQueryIndexed != glad_instrument_glBeginQueryIndexed) {
+		glad_next_glBeginQueryIndexed = glad_glBeginQueryIndexed;
+		glad_glBeginQueryIndexed = glad_instrument_glBeginQueryIndexed;
+	}
+	if (glad_glEndQueryIndexed != NULL && glad_glEndQueryIndexed != glad_instrument_glEndQueryIndexed) {
+		glad_next_glEndQueryIndexed = glad_glEndQueryIndexed;
+		glad_glEndQueryIndexed = glad_instrument_glEndQueryIndexed;
+	}
+	if (glad_glGetQueryIndexediv != NULL && glad_glGetQueryIndexediv != glad_instrument_glGetQueryIndexediv) {
+		glad_next_glGetQueryIndexediv = glad_glGetQueryIndexediv;
+		glad_glGetQueryIndexediv = glad_instrument_glGetQueryIndexediv;
+	}
+	if (glad_glReleaseShaderCompiler != NULL && glad_glReleaseShaderCompiler != glad_instrument_glReleaseShaderCompiler) {
+		glad_next_glReleaseShaderCompiler = glad_glReleaseShaderCompiler;
+		glad_glReleaseShaderCompiler = glad_instrument_glReleaseShaderCompiler;
+	}
+	if (glad_glShaderBinary != NULL && glad_glShaderBinary != glad_instrument_glShaderBinary) {
+		glad_next_glShaderBinary = glad_glShaderBinary;
+		glad_glShaderBinary = glad_instrument_glShaderBinary;
+	}
+	if (glad_glGetShaderPrecisionFormat != NULL && glad_glGetShaderPrecisionFormat != glad_instrument_glGetShaderPrecisionFormat) {
+		glad_next_glGetShaderPrecisionFormat = glad_glGetShaderPrecisionFormat;
+		glad_glGetShaderPrecisionFormat = glad_instrument_glGetShaderPrecisionFormat;
+	}
+	if (glad_glDepthRangef != NULL && glad_glDepthRangef != glad_instrument_glDepthRangef) {
+		glad_next_glDepthRangef = glad_glDepthRangef;
+		glad_glDepthRangef = glad_instrument_glDepthRangef;
+	}
+	if (glad_glClearDepthf != NULL && glad_glClearDepthf != glad_instrument_glClearDepthf) {
+		glad_next_glClearDepthf = glad_glClearDepthf;
+		glad_glClearDepthf = glad_instrument_glClearDepthf;
+	}
+	if (glad_glGetProgramBinary != NULL && glad_glGetProgramBinary != glad_instrument_glGetProgramBinary) {
+		glad_next_glGetProgramBinary = glad_glGetProgramBinary;
+		glad_glGetProgramBinary = glad_instrument_glGetProgramBinary;
+	}
+	if (glad_glProgramBinary != NULL && glad_glProgramBinary != glad_instrument_glProgramBinary) {
+		glad_next_glProgramBinary = glad_glProgramBinary;
+		glad_glProgramBinary = glad_instrument_glProgramBinary;
+	}
+	if (glad_glProgramParameteri != NULL && glad_glProgramParameteri != glad_instrument_glProgramParameteri) {
+		glad_next_glProgramParameteri = glad_glProgramParameteri;
+		glad_glProgramParameteri = glad_instrument_glProgramParameteri;
+	}
+	if (glad_glUseProgramStages != NULL && glad_glUseProgramStages != glad_instrument_glUseProgramStages) {
+		glad_next_glUseProgramStages = glad_glUseProgramStages;
+		glad_glUseProgramStages = glad_instrument_glUseProgramStages;
+	}
+	if (glad_glActiveShaderProgram != NULL && glad_glActiveShaderProgram != glad_instrument_glActiveShaderProgram) {
+		glad_next_glActiveShaderProgram = glad_glActiveShaderProgram;
+		glad_glActiveShaderProgram = glad_instrument_glActiveShaderProgram;
+	}
+	if (glad_glCreateShaderProgramv != NULL && glad_glCreateShaderProgramv != glad_instrument_glCreateShaderProgramv) {
+		glad_next_glCreateShaderProgramv = glad_glCreateShaderProgramv;
+		glad_glCreateShaderProgramv = glad_instrument_glCreateShaderProgramv;
+	}
+	if (glad_glBindProgramPipeline != NULL && glad_glBindProgramPipeline != glad_instrument_glBindProgramPipeline) {
+		glad_next_glBindProgramPipeline = glad_glBindProgramPipeline;
+		glad_glBindProgramPipeline = glad_instrument_glBindProgramPipeline;
+	}
+	if (glad_glDeleteProgramPipelines != NULL && glad_glDeleteProgramPipelines != glad_instrument_glDeleteProgramPipelines) {
+		glad_next_glDeleteProgramPipelines = glad_glDeleteProgramPipelines;
+		glad_glDeleteProgramPipelines = glad_instrument_glDeleteProgramPipelines;
+	}
+	if (glad_glGenProgramPipelines != NULL && glad_glGenProgramPipelines != glad_instrument_glGenProgramPipelines) {
+		glad_next_glGenProgramPipelines = glad_glGenProgramPipelines;
+		glad_glGenProgramPipelines = glad_instrument_glGenProgramPipelines;
+	}
+	if (glad_glIsProgramPipeline != NULL && glad_glIsProgramPipeline != glad_instrument_glIsProgramPipeline) {
+		glad_next_glIsProgramPipeline = glad_glIsProgramPipeline;
+		glad_glIsProgramPipeline = glad_instrument_glIsProgramPipeline;
+	}
+	if (glad_glGetProgramPipelineiv != NULL && glad_glGetProgramPipelineiv != glad_instrument_glGetProgramPipelineiv) {
+		glad_next_glGetProgramPipelineiv = glad_glGetProgramPipelineiv;
+		glad_glGetProgramPipelineiv = glad_instrument_glGetProgramPipelineiv;
+	}
+	if (glad_glProgramUniform1i != NULL && glad_glProgramUniform1i != glad_instrument_glProgramUniform1i) {
+		glad_next_glProgramUniform1i = glad_glProgramUniform1i;
+		glad_glProgramUniform1i = glad_instrument_glProgramUniform1i;
+	}
+	if (glad_glProgramUniform1iv != NULL && glad_glProgramUniform1iv != glad_instrument_glProgramUniform1iv) {
+		glad_next_glProgramUniform1iv = glad_glProgramUniform1iv;
+		glad_glProgramUniform1iv = glad_instrument_glProgramUniform1iv;
+	}
+	if (glad_glProgramUniform1f != NULL && glad_glProgramUniform1f != glad_instrument_glProgramUniform1f) {
+		glad_next_glProgramUniform1f = glad_glProgramUniform1f;
+		glad_glProgramUniform1f = glad_instrument_glProgramUniform1f;
+	}
+	if (glad_glProgramUniform1fv != NULL && glad_glProgramUniform1fv != glad_instrument_glProgramUniform1fv) {
+		glad_next_glProgramUniform1fv = glad_glProgramUniform1fv;
+		glad_glProgramUniform1fv = glad_instrument_glProgramUniform1fv;
+	}
+	if (glad_glProgramUniform1d != NULL && glad_glProgramUniform1d != glad_instrument_glProgramUniform1d) {
+		glad_next_glProgramUniform1d = glad_glProgramUniform1d;
+		glad_glProgramUniform1d = glad_instrument_glProgramUniform1d;
+	}
+	if (glad_glProgramUniform1dv != NULL && glad_glProgramUniform1dv != glad_instrument_glProgramUniform1dv) {
+		glad_next_glProgramUniform1dv = glad_glProgramUniform1dv;
+		glad_glProgramUniform1dv = glad_instrument_glProgramUniform1dv;
+	}
+	if (glad_glProgramUniform1ui != NULL && glad_glProgramUniform1ui != glad_instrument_glProgramUniform1ui) {
+		glad_next_glProgramUniform1ui = glad_glProgramUniform1ui;
+		glad_glProgramUniform1ui = glad_instrument_glProgramUniform1ui;
+	}
+	if (glad_glProgramUniform1uiv != NULL && glad_glProgramUniform1uiv != glad_instrument_glProgramUniform1uiv) {
+		glad_next_glProgramUniform1uiv = glad_glProgramUniform1uiv;
+		glad_glProgramUniform1uiv = glad_instrument_glProgramUniform1uiv;
+	}
+	if (glad_glProgramUniform2i != NULL && glad_glProgramUniform2i != glad_instrument_glProgramUniform2i) {
+		glad_next_glProgramUniform2i = glad_glProgramUniform2i;
+		glad_glProgramUniform2i = glad_instrument_glProgramUniform2i;
+	}
+	if (glad_glProgramUniform2iv != NULL && glad_glProgramUniform2iv != glad_instrument_glProgramUniform2iv) {
+		glad_next_glProgramUniform2iv = glad_glProgramUniform2iv;
+		glad_glProgramUniform2iv = glad_instrument_glProgramUniform2iv;
+	}
+	if (glad_glProgramUniform2f != NULL && glad_glProgramUniform2f != glad_instrument_glProgramUniform2f) {
+		glad_next_glProgramUniform2f = glad_glProgramUniform2f;
+		glad_glProgramUniform2f = glad_instrument_glProgramUniform2f;
+	}
+	if (glad_glProgramUniform2fv != NULL && glad_glProgramUniform2fv != glad_instrument_glProgramUniform2fv) {
+		glad_next_glProgramUniform2fv = glad_glProgramUniform2fv;
+		glad_glProgramUniform2fv = glad_instrument_glProgramUniform2fv;
+	}
+	if (glad_glProgramUniform2d != NULL && glad_glProgramUniform2d != glad_instrument_glProgramUniform2d) {
+		glad_next_glProgramUniform2d = glad_glProgramUniform2d;
+		glad_glProgramUniform2d = glad_instrument_glProgramUniform2d;
+	}
+	if (glad_glProgramUniform2dv != NULL && glad_glProgramUniform2dv != glad_instrument_glProgramUniform2dv) {
+		glad_next_glProgramUniform2dv = glad_glProgramUniform2dv;
+		glad_glProgramUniform2dv = glad_instrument_glProgramUniform2dv;
+	}
+	if (glad_glProgramUniform2ui != NULL && glad_glProgramUniform2ui != glad_instrument_glProgramUniform2ui) {
+		glad_next_glProgramUniform2ui = glad_glProgramUniform2ui;
+		glad_glProgramUniform2ui = glad_instrument_glProgramUniform2ui;
+	}
+	if (glad_glProgramUniform2uiv != NULL && glad_glProgramUniform2uiv != glad_instrument_glProgramUniform2uiv) {
+		glad_next_glProgramUniform2uiv = glad_glProgramUniform2uiv;
+		glad_glProgramUniform2uiv = glad_instrument_glProgramUniform2uiv;
+	}
+	if (glad_glProgramUniform3i != NULL && glad_glProgramUniform3i != glad_instrument_glProgramUniform3i) {
+		glad_next_glProgramUniform3i = glad_glProgramUniform3i;
+		glad_glProgramUniform3i = glad_instrument_glProgramUniform3i;
+	}
+	if (glad_glProgramUniform3iv != NULL && glad_glProgramUniform3iv != glad_instrument_glProgramUniform3iv) {
+		glad_next_glProgramUniform3iv = glad_glProgramUniform3iv;
+		glad_glProgramUniform3iv = glad_instrument_glProgramUniform3iv;
+	}
+	if (glad_glProgramUniform3f != NULL && glad_glProgramUniform3f != glad_instrument_glProgramUniform3f) {
+		glad_next_glProgramUniform3f = glad_glProgramUniform3f;
+		glad_glProgramUniform3f = glad_instrument_glProgramUniform3f;
+	}
+	if (glad_glProgramUniform3fv != NULL && glad_glProgramUniform3fv != glad_instrument_glProgramUniform3fv) {
+		glad_next_glProgramUniform3fv = glad_glProgramUniform3fv;
+		glad_glProgramUniform3fv = glad_instrument_glProgramUniform3fv;
+	}
+	if (glad_glProgramUniform3d != NULL && glad_glProgramUniform3d != glad_instrument_glProgramUniform3d) {
+		glad_next_glProgramUniform3d = glad_glProgramUniform3d;
+		glad_glProgramUniform3d = glad_instrument_glProgramUniform3d;
+	}
+	if (glad_glProgramUniform3dv != NULL && glad_glProgramUniform3dv != glad_instrument_glProgramUniform3dv) {
+		glad_next_glProgramUniform3dv = glad_glProgramUniform3dv;
+		glad_glProgramUniform3dv = glad_instrument_glProgramUniform3dv;
+	}
+	if (glad_glProgramUniform3ui != NULL && glad_glProgramUniform3ui != glad_instrument_glProgramUniform3ui) {
+		glad_next_glProgramUniform3ui = glad_glProgramUniform3ui;
+		glad_glProgramUniform3ui = glad_instrument_glProgramUniform3ui;
+	}
+	if (glad_glProgramUniform3uiv != NULL && glad_glProgramUniform3uiv != glad_instrument_glProgramUniform3uiv) {
+		glad_next_glProgramUniform3uiv = glad_glProgramUniform3uiv;
+		glad_glProgramUniform3uiv = glad_instrument_glProgramUniform3uiv;
+	}
+	if (glad_glProgramUniform4i != NULL && glad_glProgramUniform4i != glad_instrument_glProgramUniform4i) {
+		glad_next_glProgramUniform4i = glad_glProgramUniform4i;
+		glad_glProgramUniform4i = glad_instrument_glProgramUniform4i;
+	}
+	if (glad_glProgramUniform4iv != NULL && glad_glProgramUniform4iv != glad_instrument_glProgramUniform4iv) {
+		glad_next_glProgramUniform4iv = glad_glProgramUniform4iv;
+		glad_glProgramUniform4iv = glad_instrument_glProgramUniform4iv;
+	}
+	if (glad_glProgramUniform4f != NULL && glad_glProgramUniform4f != glad_instrument_glProgramUniform4f) {
+		glad_next_glProgramUniform4f = glad_glProgramUniform4f;
+		glad_glProgramUniform4f = glad_instrument_glProgramUniform4f;
+	}
+	if (glad_glProgramUniform4fv != NULL && glad_glProgramUniform4fv != glad_instrument_glProgramUniform4fv) {
+		glad_next_glProgramUniform4fv = glad_glProgramUniform4fv;
+		glad_glProgramUniform4fv = glad_instrument_glProgramUniform4fv;
+	}
+	if (glad_glProgramUniform4d != NULL && glad_glProgramUniform4d != glad_instrument_glProgramUniform4d) {
+		glad_next_glProgramUniform4d = glad_glProgramUniform4d;
+		glad_glProgramUniform4d = glad_instrument_glProgramUniform4d;
+	}
+	if (glad_glProgramUniform4dv != NULL && glad_glProgramUniform4dv != glad_instrument_glProgramUniform4dv) {
+		glad_next_glProgramUniform4dv = glad_glProgramUniform4dv;
+		glad_glProgramUniform4dv = glad_instrument_glProgramUniform4dv;
+	}
+	if (glad_glProgramUniform4ui != NULL && glad_glProgramUniform4ui != glad_instrument_glProgramUniform4ui) {
+		glad_next_glProgramUniform4ui = glad_glProgramUniform4ui;
+		glad_glProgramUniform4ui = glad_instrument_glProgramUniform4ui;
+	}
+	if (glad_glProgramUniform4uiv != NULL && glad_glProgramUniform4uiv != glad_instrument_glProgramUniform4uiv) {
+		glad_next_glProgramUniform4uiv = glad_glProgramUniform4uiv;
+		glad_glProgramUniform4uiv = glad_instrument_glProgramUniform4uiv;
+	}
+	if (glad_glProgramUniformMatrix2fv != NULL && glad_glProgramUniformMatrix2fv != glad_instrument_glProgramUniformMatrix2fv) {
+		glad_next_glProgramUniformMatrix2fv = glad_glProgramUniformMatrix2fv;
+		glad_glProgramUniformMatrix2fv = glad_instrument_glProgramUniformMatrix2fv;
+	}
+	if (glad_glProgramUniformMatrix3fv != NULL && glad_glProgramUniformMatrix3fv != glad_instrument_glProgramUniformMatrix3fv) {
+		glad_next_glProgramUniformMatrix3fv = glad_glProgramUniformMatrix3fv;
+		glad_glProgramUniformMatrix3fv = glad_instrument_glProgramUniformMatrix3fv;
+	}
+	if (glad_glProgramUniformMatrix4fv != NULL && glad_glProgramUniformMatrix4fv != glad_instrument_glProgramUniformMatrix4fv) {
+		glad_next_glProgramUniformMatrix4fv = glad_glProgramUniformMatrix4fv;
+		glad_glProgramUniformMatrix4fv = glad_instrument_glProgramUniformMatrix4fv;
+	}
+	if (glad_glProgramUniformMatrix2dv != NULL && glad_glProgramUniformMatrix2dv != glad_instrument_glProgramUniformMatrix2dv) {
+		glad_next_glProgramUniformMatrix2dv = glad_glProgramUniformMatrix2dv;
+		glad_glProgramUniformMatrix2dv = glad_instrument_glProgramUniformMatrix2dv;
+	}
+	if (glad_glProgramUniformMatrix3dv != NULL && glad_glProgramUniformMatrix3dv != glad_instrument_glProgramUniformMatrix3dv) {
+		glad_next_glProgramUniformMatrix3dv = glad_glProgramUniformMatrix3dv;
+		glad_glProgramUniformMatrix3dv = glad_instrument_glProgramUniformMatrix3dv;
+	}
+	if (glad_glProgramUniformMatrix4dv != NULL && glad_glProgramUniformMatrix4dv != glad_instrument_glProgramUniformMatrix4dv) {
+		glad_next_glProgramUniformMatrix4dv = glad_glProgramUniformMatrix4dv;
+		glad_glProgramUniformMatrix4dv = glad_instrument_glProgramUniformMatrix4dv;
+	}
+	if (glad_glProgramUniformMatrix2x3fv != NULL && glad_glProgramUniformMatrix2x3fv != glad_instrument_glProgramUniformMatrix2x3fv) {
+		glad_next_glProgramUniformMatrix2x3fv = glad_glProgramUniformMatrix2x3fv;
+		glad_glProgramUniformMatrix2x3fv = glad_instrument_glProgramUniformMatrix2x3fv;
+	}
+	if (glad_glProgramUniformMatrix3x2fv != NULL && glad_glProgramUniformMatrix3x2fv != glad_instrument_glProgramUniformMatrix3x2fv) {
+		glad_next_glProgramUniformMatrix3x2fv = glad_glProgramUniformMatrix3x2fv;
+		glad_glProgramUniformMatrix3x2fv = glad_instrument_glProgramUniformMatrix3x2fv;
+	}
+	if (glad_glProgramUniformMatrix2x4fv != NULL && glad_glProgramUniformMatrix2x4fv != glad_instrument_glProgramUniformMatrix2x4fv) {
+		glad_next_glProgramUniformMatrix2x4fv = glad_glProgramUniformMatrix2x4fv;
+		glad_glProgramUniformMatrix2x4fv = glad_instrument_glProgramUniformMatrix2x4fv;
+	}
+	if (glad_glProgramUniformMatrix4x2fv != NULL && glad_glProgramUniformMatrix4x2fv != glad_instrument_glProgramUniformMatrix4x2fv) {
+		glad_next_glProgramUniformMatrix4x2fv = glad_glProgramUniformMatrix4x2fv;
+		glad_glProgramUniformMatrix4x2fv = glad_instrument_glProgramUniformMatrix4x2fv;
+	}
+	if (glad_glProgramUniformMatrix3x4fv != NULL && glad_glProgramUniformMatrix3x4fv != glad_instrument_glProgramUniformMatrix3x4fv) {
+		glad_next_glProgramUniformMatrix3x4fv = glad_glProgramUniformMatrix3x4fv;
+		glad_glProgramUniformMatrix3x4fv = glad_instrument_glProgramUniformMatrix3x4fv;
+	}
+	if (glad_glProgramUniformMatrix4x3fv != NULL && glad_glProgramUniformMatrix4x3fv != glad_instrument_glProgramUniformMatrix4x3fv) {
+		glad_next_glProgramUniformMatrix4x3fv = glad_glProgramUniformMatrix4x3fv;
+		glad_glProgramUniformMatrix4x3fv = glad_instrument_glProgramUniformMatrix4x3fv;
+	}
+	if (glad_glProgramUniformMatrix2x3dv != NULL && glad_glProgramUniformMatrix2x3dv != glad_instrument_glProgramUniformMatrix2x3dv) {
+		glad_next_glProgramUniformMatrix2x3dv = glad_glProgramUniformMatrix2x3dv;
+		glad_glProgramUniformMatrix2x3dv = glad_instrument_glProgramUniformMatrix2x3dv;
+	}
+	if (glad_glProgramUniformMatrix3x2dv != NULL && glad_glProgramUniformMatrix3x2dv != glad_instrument_glProgramUniformMatrix3x2dv) {
+		glad_next_glProgramUniformMatrix3x2dv = glad_glProgramUniformMatrix3x2dv;
+		glad_glProgramUniformMatrix3x2dv = glad_instrument_glProgramUniformMatrix3x2dv;
+	}
+	if (glad_glProgramUniformMatrix2x4dv != NULL && glad_glProgramUniformMatrix2x4dv != glad_instrument_glProgramUniformMatrix2x4dv) {
+		glad_next_glProgramUniformMatrix2x4dv = glad_glProgramUniformMatrix2x4dv;
+		glad_glProgramUniformMatrix2x4dv = glad_instrument_glProgramUniformMatrix2x4dv;
+	}
+	if (glad_glProgramUniformMatrix4x2dv != NULL && glad_glProgramUniformMatrix4x2dv != glad_instrument_glProgramUniformMatrix4x2dv) {
+		glad_next_glProgramUniformMatrix4x2dv = glad_glProgramUniformMatrix4x2dv;
+		glad_glProgramUniformMatrix4x2dv = glad_instrument_glProgramUniformMatrix4x2dv;
+	}
+	if (glad_glProgramUniformMatrix3x4dv != NULL && glad_glProgramUniformMatrix3x4dv != glad_instrument_glProgramUniformMatrix3x4dv) {
+		glad_next_glProgramUniformMatrix3x4dv = glad_glProgramUniformMatrix3x4dv;
+		glad_glProgramUniformMatrix3x4dv = glad_instrument_glProgramUniformMatrix3x4dv;
+	}
+	if (glad_glProgramUniformMatrix4x3dv != NULL && glad_glProgramUniformMatrix4x3dv != glad_instrument_glProgramUniformMatrix4x3dv) {
+		glad_next_glProgramUniformMatrix4x3dv = glad_glProgramUniformMatrix4x3dv;
+		glad_glProgramUniformMatrix4x3dv = glad_instrument_glProgramUniformMatrix4x3dv;
+	}
+	if (glad_glValidateProgramPipeline != NULL && glad_glValidateProgramPipeline != glad_instrument_glValidateProgramPipeline) {
+		glad_next_glValidateProgramPipeline = glad_glValidateProgramPipeline;
+		glad_glValidateProgramPipeline = glad_instrument_glValidateProgramPipeline;
+	}
+	if (glad_glGetProgramPipelineInfoLog != NULL && glad_glGetProgramPipelineInfoLog != glad_instrument_glGetProgramPipelineInfoLog) {
+		glad_next_glGetProgramPipelineInfoLog = glad_glGetProgramPipelineInfoLog;
+		glad_glGetProgramPipelineInfoLog = glad_instrument_glGetProgramPipelineInfoLog;
+	}
+	if (glad_glVertexAttribL1d != NULL && glad_glVertexAttribL1d != glad_instrument_glVertexAttribL1d) {
+		glad_next_glVertexAttribL1d = glad_glVertexAttribL1d;
+		glad_glVertexAttribL1d = glad_instrument_glVertexAttribL1d;
+	}
+	if (glad_glVertexAttribL2d != NULL && glad_glVertexAttribL2d != glad_instrument_glVertexAttribL2d) {
+		glad_next_glVertexAttribL2d = glad_glVertexAttribL2d;
+		glad_glVertexAttribL2d = glad_instrument_glVertexAttribL2d;
+	}
+	if (glad_glVertexAttribL3d != NULL && glad_glVertexAttribL3d != glad_instrument_glVertexAttribL3d) {
+		glad_next_glVertexAttribL3d = glad_glVertexAttribL3d;
+		glad_glVertexAttribL3d = glad_instrument_glVertexAttribL3d;
+	}
+	if (glad_glVertexAttribL4d != NULL && glad_glVertexAttribL4d != glad_instrument_glVertexAttribL4d) {
+		glad_next_glVertexAttribL4d = glad_glVertexAttribL4d;
+		glad_glVertexAttribL4d = glad_instrument_glVertexAttribL4d;
+	}
+	if (glad_glVertexAttribL1dv != NULL && glad_glVertexAttribL1dv != glad_instrument_glVertexAttribL1dv) {
+		glad_next_glVertexAttribL1dv = glad_glVertexAttribL1dv;
+		glad_glVertexAttribL1dv = glad_instrument_glVertexAttribL1dv;
+	}
+	if (glad_glVertexAttribL2dv != NULL && glad_glVertexAttribL2dv != glad_instrument_glVertexAttribL2dv) {
+		glad_next_glVertexAttribL2dv = glad_glVertexAttribL2dv;
+		glad_glVertexAttribL2dv = glad_instrument_glVertexAttribL2dv;
+	}
+	if (glad_glVertexAttribL3dv != NULL && glad_glVertexAttribL3dv != glad_instrument_glVertexAttribL3dv) {
+		glad_next_glVertexAttribL3dv = glad_glVertexAttribL3dv;
+		glad_glVertexAttribL3dv = glad_instrument_glVertexAttribL3dv;
+	}
+	if (glad_glVertexAttribL4dv != NULL && glad_glVertexAttribL4dv != glad_instrument_glVertexAttribL4dv) {
+		glad_next_glVertexAttribL4dv = glad_glVertexAttribL4dv;
+		glad_glVertexAttribL4dv = glad_instrument_glVertexAttribL4dv;
+	}
+	if (glad_glVertexAttribLPointer != NULL && glad_glVertexAttribLPointer != glad_instrument_glVertexAttribLPointer) {
+		glad_next_glVertexAttribLPointer = glad_glVertexAttribLPointer;
+		glad_glVertexAttribLPointer = glad_instrument_glVertexAttribLPointer;
+	}
+	if (glad_glGetVertexAttribLdv != NULL && glad_glGetVertexAttribLdv != glad_instrument_glGetVertexAttribLdv) {
+		glad_next_glGetVertexAttribLdv = glad_glGetVertexAttribLdv;
+		glad_glGetVertexAttribLdv = glad_instrument_glGetVertexAttribLdv;
+	}
+	if (glad_glViewportArrayv != NULL && glad_glViewportArrayv != glad_instrument_glViewportArrayv) {
+		glad_next_glViewportArrayv = glad_glViewportArrayv;
+		glad_glViewportArrayv = glad_instrument_glViewportArrayv;
+	}
+	if (glad_glViewportIndexedf != NULL && glad_glViewportIndexedf != glad_instrument_glViewportIndexedf) {
+		glad_next_glViewportIndexedf = glad_glViewportIndexedf;
+		glad_glViewportIndexedf = glad_instrument_glViewportIndexedf;
+	}
+	if (glad_glViewportIndexedfv != NULL && glad_glViewportIndexedfv != glad_instrument_glViewportIndexedfv) {
+		glad_next_glViewportIndexedfv = glad_glViewportIndexedfv;
+		glad_glViewportIndexedfv = glad_instrument_glViewportIndexedfv;
+	}
+	if (glad_glScissorArrayv != NULL && glad_glScissorArrayv != glad_instrument_glScissorArrayv) {
+		glad_next_glScissorArrayv = glad_glScissorArrayv;
+		glad_glScissorArrayv = glad_instrument_glScissorArrayv;
+	}
+	if (glad_glScissorIndexed != NULL && glad_glScissorIndexed != glad_instrument_glScissorIndexed) {
+		glad_next_glScissorIndexed = glad_glScissorIndexed;
+		glad_glScissorIndexed = glad_instrument_glScissorIndexed;
+	}
+	if (glad_glScissorIndexedv != NULL && glad_glScissorIndexedv != glad_instrument_glScissorIndexedv) {
+		glad_next_glScissorIndexedv = glad_glScissorIndexedv;
+		glad_glScissorIndexedv = glad_instrument_glScissorIndexedv;
+	}
+	if (glad_glDepthRangeArrayv != NULL && glad_glDepthRangeArrayv != glad_instrument_glDepthRangeArrayv) {
+		glad_next_glDepthRangeArrayv = glad_glDepthRangeArrayv;
+		glad_glDepthRangeArrayv = glad_instrument_glDepthRangeArrayv;
+	}
+	if (glad_glDepthRangeIndexed != NULL && glad_glDepthRangeIndexed != glad_instrument_glDepthRangeIndexed) {
+		glad_next_glDepthRangeIndexed = glad_glDepthRangeIndexed;
+		glad_glDepthRangeIndexed = glad_instrument_glDepthRangeIndexed;
+	}
+	if (glad_glGetFloati_v != NULL && glad_glGetFloati_v != glad_instrument_glGetFloati_v) {
+		glad_next_glGetFloati_v = glad_glGetFloati_v;
+		glad_glGetFloati_v = glad_instrument_glGetFloati_v;
+	}
+	if (glad_glGetDoublei_v != NULL && glad_glGetDoublei_v != glad_instrument_glGetDoublei_v) {
+		glad_next_glGetDoublei_v = glad_glGetDoublei_v;
+		glad_glGetDoublei_v = glad_instrument_glGetDoublei_v;
+	}
+	if (glad_glDrawArraysInstancedBaseInstance != NULL && glad_glDrawArraysInstancedBaseInstance != glad_instrument_glDrawArraysInstancedBaseInstance) {
+		glad_next_glDrawArraysInstancedBaseInstance = glad_glDrawArraysInstancedBaseInstance;
+		glad_glDrawArraysInstancedBaseInstance = glad_instrument_glDrawArraysInstancedBaseInstance;
+	}
+	if (glad_glDrawElementsInstancedBaseInstance != NULL && glad_glDrawElementsInstancedBaseInstance != glad_instrument_glDrawElementsInstancedBaseInstance) {
+		glad_next_glDrawElementsInstancedBaseInstance = glad_glDrawElementsInstancedBaseInstance;
+		glad_glDrawElementsInstancedBaseInstance = glad_instrument_glDrawElementsInstancedBaseInstance;
+	}
+	if (glad_glDrawElementsInstancedBaseVertexBaseInstance != NULL && glad_glDrawElementsInstancedBaseVertexBaseInstance != glad_instrument_glDrawElementsInstancedBaseVertexBaseInstance) {
+		glad_next_glDrawElementsInstancedBaseVertexBaseInstance = glad_glDrawElementsInstancedBaseVertexBaseInstance;
+		glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_instrument_glDrawElementsInstancedBaseVertexBaseInstance;
+	}
+	if (glad_glGetInternalformativ != NULL && glad_glGetInternalformativ != glad_instrument_glGetInternalformativ) {
+		glad_next_glGetInternalformativ = glad_glGetInternalformativ;
+		glad_glGetInternalformativ = glad_instrument_glGetInternalformativ;
+	}
+	if (glad_glGetActiveAtomicCounterBufferiv != NULL && glad_glGetActiveAtomicCounterBufferiv != glad_instrument_glGetActiveAtomicCounterBufferiv) {
+		glad_next_glGetActiveAtomicCounterBufferiv = glad_glGetActiveAtomicCounterBufferiv;
+		glad_glGetActiveAtomicCounterBufferiv = glad_instrument_glGetActiveAtomicCounterBufferiv;
+	}
+	if (glad_glBindImageTexture != NULL && glad_glBindImageTexture != glad_instrument_glBindImageTexture) {
+		glad_next_glBindImageTexture = glad_glBindImageTexture;
+		glad_glBindImageTexture = glad_instrument_glBindImageTexture;
+	}
+	if (glad_glMemoryBarrier != NULL && glad_glMemoryBarrier != glad_instrument_glMemoryBarrier) {
+		glad_next_glMemoryBarrier = glad_glMemoryBarrier;
+		glad_glMemoryBarrier = glad_instrument_glMemoryBarrier;
+	}
+	if (glad_glTexStorage1D != NULL && glad_glTexStorage1D != glad_instrument_glTexStorage1D) {
+		glad_next_glTexStorage1D = glad_glTexStorage1D;
+		glad_glTexStorage1D = glad_instrument_glTexStorage1D;
+	}
+	if (glad_glTexStorage2D != NULL && glad_glTexStorage2D != glad_instrument_glTexStorage2D) {
+		glad_next_glTexStorage2D = glad_glTexStorage2D;
+		glad_glTexStorage2D = glad_instrument_glTexStorage2D;
+	}
+	if (glad_glTexStorage3D != NULL && glad_glTexStorage3D != glad_instrument_glTexStorage3D) {
+		glad_next_glTexStorage3D = glad_glTexStorage3D;
+		glad_glTexStorage3D = glad_instrument_glTexStorage3D;
+	}
+	if (glad_glDrawTransformFeedbackInstanced != NULL && glad_glDrawTransformFeedbackInstanced != glad_instrument_glDrawTransformFeedbackInstanced) {
+		glad_next_glDrawTransformFeedbackInstanced = glad_glDrawTransformFeedbackInstanced;
+		glad_glDrawTransformFeedbackInstanced = glad_instrument_glDrawTransformFeedbackInstanced;
+	}
+	if (glad_glDrawTransformFeedbackStreamInstanced != NULL && glad_glDrawTransformFeedbackStreamInstanced != glad_instrument_glDrawTransformFeedbackStreamInstanced) {
+		glad_next_glDrawTransformFeedbackStreamInstanced = glad_glDrawTransformFeedbackStreamInstanced;
+		glad_glDrawTransformFeedbackStreamInstanced = glad_instrument_glDrawTransformFeedbackStreamInstanced;
+	}
+	if (glad_glClearBufferData != NULL && glad_glClearBufferData != glad_instrument_glClearBufferData) {
+		glad_next_glClearBufferData = glad_glClearBufferData;
+		glad_glClearBufferData = glad_instrument_glClearBufferData;
+	}
+	if (glad_glClearBufferSubData != NULL && glad_glClearBufferSubData != glad_instrument_glClearBufferSubData) {
+		glad_next_glClearBufferSubData = glad_glClearBufferSubData;
+		glad_glClearBufferSubData = glad_instrument_glClearBufferSubData;
+	}
+	if (glad_glDispatchCompute != NULL && glad_glDispatchCompute != glad_instrument_glDispatchCompute) {
+		glad_next_glDispatchCompute = glad_glDispatchCompute;
+		glad_glDispatchCompute = glad_instrument_glDispatchCompute;
+	}
+	if (glad_glDispatchComputeIndirect != NULL && glad_glDispatchComputeIndirect != glad_instrument_glDispatchComputeIndirect) {
+		glad_next_glDispatchComputeIndirect = glad_glDispatchComputeIndirect;
+		glad_glDispatchComputeIndirect = glad_instrument_glDispatchComputeIndirect;
+	}
+	if (glad_glCopyImageSubData != NULL && glad_glCopyImageSubData != glad_instrument_glCopyImageSubData) {
+		glad_next_glCopyImageSubData = glad_glCopyImageSubData;
+		glad_glCopyImageSubData = glad_instrument_glCopyImageSubData;
+	}
+	if (glad_glFramebufferParameteri != NULL && glad_glFramebufferParameteri != glad_instrument_glFramebufferParameteri) {
+		glad_next_glFramebufferParameteri = glad_glFramebufferParameteri;
+		glad_glFramebufferParameteri = glad_instrument_glFramebufferParameteri;
+	}
+	if (glad_glGetFramebufferParameteriv != NULL && glad_glGetFramebufferParameteriv != glad_instrument_glGetFramebufferParameteriv) {
+		glad_next_glGetFramebufferParameteriv = glad_glGetFramebufferParameteriv;
+		glad_glGetFramebufferParameteriv = glad_instrument_glGetFramebufferParameteriv;
+	}
+	if (glad_glGetInternalformati64v != NULL && glad_glGetInternalformati64v != glad_instrument_glGetInternalformati64v) {
+		glad_next_glGetInternalformati64v = glad_glGetInternalformati64v;
+		glad_glGetInternalformati64v = glad_instrument_glGetInternalformati64v;
+	}
+	if (glad_glInvalidateTexSubImage != NULL && glad_glInvalidateTexSubImage != glad_instrument_glInvalidateTexSubImage) {
+		glad_next_glInvalidateTexSubImage = glad_glInvalidateTexSubImage;
+		glad_glInvalidateTexSubImage = glad_instrument_glInvalidateTexSubImage;
+	}
+	if (glad_glInvalidateTexImage != NULL && glad_glInvalidateTexImage != glad_instrument_glInvalidateTexImage) {
+		glad_next_glInvalidateTexImage = glad_glInvalidateTexImage;
+		glad_glInvalidateTexImage = glad_instrument_glInvalidateTexImage;
+	}
+	if (glad_glInvalidateBufferSubData != NULL && glad_glInvalidateBufferSubData != glad_instrument_glInvalidateBufferSubData) {
+		glad_next_glInvalidateBufferSubData = glad_glInvalidateBufferSubData;
+		glad_glInvalidateBufferSubData = glad_instrument_glInvalidateBufferSubData;
+	}
+	if (glad_glInvalidateBufferData != NULL && glad_glInvalidateBufferData != glad_instrument_glInvalidateBufferData) {
+		glad_next_glInvalidateBufferData = glad_glInvalidateBufferData;
+		glad_glInvalidateBufferData = glad_instrument_glInvalidateBufferData;
+	}
+	if (glad_glInvalidateFramebuffer != NULL && glad_glInvalidateFramebuffer != glad_instrument_glInvalidateFramebuffer) {
+		glad_next_glInvalidateFramebuffer = glad_glInvalidateFramebuffer;
+		glad_glInvalidateFramebuffer = glad_instrument_glInvalidateFramebuffer;
+	}
+	if (glad_glInvalidateSubFramebuffer != NULL && glad_glInvalidateSubFramebuffer != glad_instrument_glInvalidateSubFramebuffer) {
+		glad_next_glInvalidateSubFramebuffer = glad_glInvalidateSubFramebuffer;
+		glad_glInvalidateSubFramebuffer = glad_instrument_glInvalidateSubFramebuffer;
+	}
+	if (glad_glMultiDrawArraysIndirect != NULL && glad_glMultiDrawArraysIndirect != glad_instrument_glMultiDrawArraysIndirect) {
+		glad_next_glMultiDrawArraysIndirect = glad_glMultiDrawArraysIndirect;
+		glad_glMultiDrawArraysIndirect = glad_instrument_glMultiDrawArraysIndirect;
+	}
+	if (glad_glMultiDrawElementsIndirect != NULL && glad_glMultiDrawElementsIndirect != glad_instrument_glMultiDrawElementsIndirect) {
+		glad_next_glMultiDrawElementsIndirect = glad_glMultiDrawElementsIndirect;
+		glad_glMultiDrawElementsIndirect = glad_instrument_glMultiDrawElementsIndirect;
+	}
+	if (glad_glGetProgramInterfaceiv != NULL && glad_glGetProgramInterfaceiv != glad_instrument_glGetProgramInterfaceiv) {
+		glad_next_glGetProgramInterfaceiv = glad_glGetProgramInterfaceiv;
+		glad_glGetProgramInterfaceiv = glad_instrument_glGetProgramInterfaceiv;
+	}
+	if (glad_glGetProgramResourceIndex != NULL && glad_glGetProgramResourceIndex != glad_instrument_glGetProgramResourceIndex) {
+		glad_next_glGetProgramResourceIndex = glad_glGetProgramResourceIndex;
+		glad_glGetProgramResourceIndex = glad_instrument_glGetProgramResourceIndex;
+	}
+	if (glad_glGetProgramResourceName != NULL && glad_glGetProgramResourceName != glad_instrument_glGetProgramResourceName) {
+		glad_next_glGetProgramResourceName = glad_glGetProgramResourceName;
+		glad_glGetProgramResourceName = glad_instrument_glGetProgramResourceName;
+	}
+	if (glad_glGetProgramResourceiv != NULL && glad_glGetProgramResourceiv != glad_instrument_glGetProgramResourceiv) {
+		glad_next_glGetProgramResourceiv = glad_glGetProgramResourceiv;
+		glad_glGetProgramResourceiv = glad_instrument_glGetProgramResourceiv;
+	}
+	if (glad_glGetProgramResourceLocation != NULL && glad_glGetProgramResourceLocation != glad_instrument_glGetProgramResourceLocation) {
+		glad_next_glGetProgramResourceLocation = glad_glGetProgramResourceLocation;
+		glad_glGetProgramResourceLocation = glad_instrument_glGetProgramResourceLocation;
+	}
+	if (glad_glGetProgramResourceLocationIndex != NULL && glad_glGetProgramResourceLocationIndex != glad_instrument_glGetProgramResourceLocationIndex) {
+		glad_next_glGetProgramResourceLocationIndex = glad_glGetProgramResourceLocationIndex;
+		glad_glGetProgramResourceLocationIndex = glad_instrument_glGetProgramResourceLocationIndex;
+	}
+	if (glad_glShaderStorageBlockBinding != NULL && glad_glShaderStorageBlockBinding != glad_instrument_glShaderStorageBlockBinding) {
+		glad_next_glShaderStorageBlockBinding = glad_glShaderStorageBlockBinding;
+		glad_glShaderStorageBlockBinding = glad_instrument_glShaderStorageBlockBinding;
+	}
+	if (glad_glTexBufferRange != NULL && glad_glTexBufferRange != glad_instrument_glTexBufferRange) {
+		glad_next_glTexBufferRange = glad_glTexBufferRange;
+		glad_glTexBufferRange = glad_instrument_glTexBufferRange;
+	}
+	if (glad_glTexStorage2DMultisample != NULL && glad_glTexStorage2DMultisample != glad_instrument_glTexStorage2DMultisample) {
+		glad_next_glTexStorage2DMultisample = glad_glTexStorage2DMultisample;
+		glad_glTexStorage2DMultisample = glad_instrument_glTexStorage2DMultisample;
+	}
+	if (glad_glTexStorage3DMultisample != NULL && glad_glTexStorage3DMultisample != glad_instrument_glTexStorage3DMultisample) {
+		glad_next_glTexStorage3DMultisample = glad_glTexStorage3DMultisample;
+		glad_glTexStorage3DMultisample = glad_instrument_glTexStorage3DMultisample;
+	}
+	if (glad_glTextureView != NULL && glad_glTextureView != glad_instrument_glTextureView) {
+		glad_next_glTextureView = glad_glTextureView;
+		glad_glTextureView = glad_instrument_glTextureView;
+	}
+	if (glad_glBindVertexBuffer != NULL && glad_glBindVertexBuffer != glad_instrument_glBindVertexBuffer) {
+		glad_next_glBindVertexBuffer = glad_glBindVertexBuffer;
+		glad_glBindVertexBuffer = glad_instrument_glBindVertexBuffer;
+	}
+	if (glad_glVertexAttribFormat != NULL && glad_glVertexAttribFormat != glad_instrument_glVertexAttribFormat) {
+		glad_next_glVertexAttribFormat = glad_glVertexAttribFormat;
+		glad_glVertexAttribFormat = glad_instrument_glVertexAttribFormat;
+	}
+	if (glad_glVertexAttribIFormat != NULL && glad_glVertexAttribIFormat != glad_instrument_glVertexAttribIFormat) {
+		glad_next_glVertexAttribIFormat = glad_glVertexAttribIFormat;
+		glad_glVertexAttribIFormat = glad_instrument_glVertexAttribIFormat;
+	}
+	if (glad_glVertexAttribLFormat != NULL && glad_glVertexAttribLFormat != glad_instrument_glVertexAttribLFormat) {
+		glad_next_glVertexAttribLFormat = glad_glVertexAttribLFormat;
+		glad_glVertexAttribLFormat = glad_instrument_glVertexAttribLFormat;
+	}
+	if (glad_glVertexAttribBinding != NULL && glad_glVertexAttribBinding != glad_instrument_glVertexAttribBinding) {
+		glad_next_glVertexAttribBinding = glad_glVertexAttribBinding;
+		glad_glVertexAttribBinding = glad_instrument_glVertexAttribBinding;
+	}
+	if (glad_glVertexBindingDivisor != NULL && glad_glVertexBindingDivisor != glad_instrument_glVertexBindingDivisor) {
+		glad_next_glVertexBindingDivisor = glad_glVertexBindingDivisor;
+		glad_glVertexBindingDivisor = glad_instrument_glVertexBindingDivisor;
+	}
+	if (glad_glDebugMessageControl != NULL && glad_glDebugMessageControl != glad_instrument_glDebugMessageControl) {
+		glad_next_glDebugMessageControl = glad_glDebugMessageControl;
+		glad_glDebugMessageControl = glad_instrument_glDebugMessageControl;
+	}
+	if (glad_glDebugMessageInsert != NULL && glad_glDebugMessageInsert != glad_instrument_glDebugMessageInsert) {
+		glad_next_glDebugMessageInsert = glad_glDebugMessageInsert;
+		glad_glDebugMessageInsert = glad_instrument_glDebugMessageInsert;
+	}
+	if (glad_glDebugMessageCallback != NULL && glad_glDebugMessageCallback != glad_instrument_glDebugMessageCallback) {
+		glad_next_glDebugMessageCallback = glad_glDebugMessageCallback;
+		glad_glDebugMessageCallback = glad_instrument_glDebugMessageCallback;
+	}
+	if (glad_glGetDebugMessageLog != NULL && glad_glGetDebugMessageLog != glad_instrument_glGetDebugMessageLog) {
+		glad_next_glGetDebugMessageLog = glad_glGetDebugMessageLog;
+		glad_glGetDebugMessageLog = glad_instrument_glGetDebugMessageLog;
+	}
+	if (glad_glPushDebugGroup != NULL && glad_glPushDebugGroup != glad_instrument_glPushDebugGroup) {
+		glad_next_glPushDebugGroup = glad_glPushDebugGroup;
+		glad_glPushDebugGroup = glad_instrument_glPushDebugGroup;
+	}
+	if (glad_glPopDebugGroup != NULL && glad_glPopDebugGroup != glad_instrument_glPopDebugGroup) {
+		glad_next_glPopDebugGroup = glad_glPopDebugGroup;
+		glad_glPopDebugGroup = glad_instrument_glPopDebugGroup;
+	}
+	if (glad_glObjectLabel != NULL && glad_glObjectLabel != glad_instrument_glObjectLabel) {
+		glad_next_glObjectLabel = glad_glObjectLabel;
+		glad_glObjectLabel = glad_instrument_glObjectLabel;
+	}
+	if (glad_glGetObjectLabel != NULL && glad_glGetObjectLabel != glad_instrument_glGetObjectLabel) {
+		glad_next_glGetObjectLabel = glad_glGetObjectLabel;
+		glad_glGetObjectLabel = glad_instrument_glGetObjectLabel;
+	}
+	if (glad_glObjectPtrLabel != NULL && glad_glObjectPtrLabel != glad_instrument_glObjectPtrLabel) {
+		glad_next_glObjectPtrLabel = glad_glObjectPtrLabel;
+		glad_glObjectPtrLabel = glad_instrument_glObjectPtrLabel;
+	}
+	if (glad_glGetObjectPtrLabel != NULL && glad_glGetObjectPtrLabel != glad_instrument_glGetObjectPtrLabel) {
+		glad_next_glGetObjectPtrLabel = glad_glGetObjectPtrLabel;
+		glad_glGetObjectPtrLabel = glad_instrument_glGetObjectPtrLabel;
+	}
+	if (glad_glGetPointerv != NULL && glad_glGetPointerv != glad_instrument_glGetPointerv) {
+		glad_next_glGetPointerv = glad_glGetPointerv;
+		glad_glGetPointerv = glad_instrument_glGetPointerv;
+	}
+	if (glad_glBufferStorage != NULL && glad_glBufferStorage != glad_instrument_glBufferStorage) {
+		glad_next_glBufferStorage = glad_glBufferStorage;
+		glad_glBufferStorage = glad_instrument_glBufferStorage;
+	}
+	if (glad_glClearTexImage != NULL && glad_glClearTexImage != glad_instrument_glClearTexImage) {
+		glad_next_glClearTexImage = glad_glClearTexImage;
+		glad_glClearTexImage = glad_instrument_glClearTexImage;
+	}
+	if (glad_glClearTexSubImage != NULL && glad_glClearTexSubImage != glad_instrument_glClearTexSubImage) {
+		glad_next_glClearTexSubImage = glad_glClearTexSubImage;
+		glad_glClearTexSubImage = glad_instrument_glClearTexSubImage;
+	}
+	if (glad_glBindBuffersBase != NULL && glad_glBindBuffersBase != glad_instrument_glBindBuffersBase) {
+		glad_next_glBindBuffersBase = glad_glBindBuffersBase;
+		glad_glBindBuffersBase = glad_instrument_glBindBuffersBase;
+	}
+	if (glad_glBindBuffersRange != NULL && glad_glBindBuffersRange != glad_instrument_glBindBuffersRange) {
+		glad_next_glBindBuffersRange = glad_glBindBuffersRange;
+		glad_glBindBuffersRange = glad_instrument_glBindBuffersRange;
+	}
+	if (glad_glBindTextures != NULL && glad_glBindTextures != glad_instrument_glBindTextures) {
+		glad_next_glBindTextures = glad_glBindTextures;
+		glad_glBindTextures = glad_instrument_glBindTextures;
+	}
+	if (glad_glBindSamplers != NULL && glad_glBindSamplers != glad_instrument_glBindSamplers) {
+		glad_next_glBindSamplers = glad_glBindSamplers;
+		glad_glBindSamplers = glad_instrument_glBindSamplers;
+	}
+	if (glad_glBindImageTextures != NULL && glad_glBindImageTextures != glad_instrument_glBindImageTextures) {
+		glad_next_glBindImageTextures = glad_glBindImageTextures;
+		glad_glBindImageTextures = glad_instrument_glBindImageTextures;
+	}
+	if (glad_glBindVertexBuffers != NULL && glad_glBindVertexBuffers != glad_instrument_glBindVertexBuffers) {
+		glad_next_glBindVertexBuffers = glad_glBindVertexBuffers;
+		glad_glBindVertexBuffers = glad_instrument_glBindVertexBuffers;
+	}
+	if (glad_glClipControl != NULL && glad_glClipControl != glad_instrument_glClipControl) {
+		glad_next_glClipControl = glad_glClipControl;
+		glad_glClipControl = glad_instrument_glClipControl;
+	}
+	if (glad_glCreateTransformFeedbacks != NULL && glad_glCreateTransformFeedbacks != glad_instrument_glCreateTransformFeedbacks) {
+		glad_next_glCreateTransformFeedbacks = glad_glCreateTransformFeedbacks;
+		glad_glCreateTransformFeedbacks = glad_instrument_glCreateTransformFeedbacks;
+	}
+	if (glad_glTransformFeedbackBufferBase != NULL && glad_glTransformFeedbackBufferBase != glad_instrument_glTransformFeedbackBufferBase) {
+		glad_next_glTransformFeedbackBufferBase = glad_glTransformFeedbackBufferBase;
+		glad_glTransformFeedbackBufferBase = glad_instrument_glTransformFeedbackBufferBase;
+	}
+	if (glad_glTransformFeedbackBufferRange != NULL && glad_glTransformFeedbackBufferRange != glad_instrument_glTransformFeedbackBufferRange) {
+		glad_next_glTransformFeedbackBufferRange = glad_glTransformFeedbackBufferRange;
+		glad_glTransformFeedbackBufferRange = glad_instrument_glTransformFeedbackBufferRange;
+	}
+	if (glad_glGetTransformFeedbackiv != NULL && glad_glGetTransformFeedbackiv != glad_instrument_glGetTransformFeedbackiv) {
+		glad_next_glGetTransformFeedbackiv = glad_glGetTransformFeedbackiv;
+		glad_glGetTransformFeedbackiv = glad_instrument_glGetTransformFeedbackiv;
+	}
+	if (glad_glGetTransformFeedbacki_v != NULL && glad_glGetTransformFeedbacki_v != glad_instrument_glGetTransformFeedbacki_v) {
+		glad_next_glGetTransformFeedbacki_v = glad_glGetTransformFeedbacki_v;
+		glad_glGetTransformFeedbacki_v = glad_instrument_glGetTransformFeedbacki_v;
+	}
+	if (glad_glGetTransformFeedbacki64_v != NULL && glad_glGetTransformFeedbacki64_v != glad_instrument_glGetTransformFeedbacki64_v) {
+		glad_next_glGetTransformFeedbacki64_v = glad_glGetTransformFeedbacki64_v;
+		glad_glGetTransformFeedbacki64_v = glad_instrument_glGetTransformFeedbacki64_v;
+	}
+	if (glad_glCreateBuffers != NULL && glad_glCreateBuffers != glad_instrument_glCreateBuffers) {
+		glad_next_glCreateBuffers = glad_glCreateBuffers;
+		glad_glCreateBuffers = glad_instrument_glCreateBuffers;
+	}
+	if (glad_glNamedBufferStorage != NULL && glad_glNamedBufferStorage != glad_instrument_glNamedBufferStorage) {
+		glad_next_glNamedBufferStorage = glad_glNamedBufferStorage;
+		glad_glNamedBufferStorage = glad_instrument_glNamedBufferStorage;
+	}
+	if (glad_glNamedBufferData != NULL && glad_glNamedBufferData != glad_instrument_glNamedBufferData) {
+		glad_next_glNamedBufferData = glad_glNamedBufferData;
+		glad_glNamedBufferData = glad_instrument_glNamedBufferData;
+	}
+	if (glad_glNamedBufferSubData != NULL && glad_glNamedBufferSubData != glad_instrument_glNamedBufferSubData) {
+		glad_next_glNamedBufferSubData = glad_glNamedBufferSubData;
+		glad_glNamedBufferSubData = glad_instrument_glNamedBufferSubData;
+	}
+	if (glad_glCopyNamedBufferSubData != NULL && glad_glCopyNamedBufferSubData != glad_instrument_glCopyNamedBufferSubData) {
+		glad_next_glCopyNamedBufferSubData = glad_glCopyNamedBufferSubData;
+		glad_glCopyNamedBufferSubData = glad_instrument_glCopyNamedBufferSubData;
+	}
+	if (glad_glClearNamedBufferData != NULL && glad_glClearNamedBufferData != glad_instrument_glClearNamedBufferData) {
+		glad_next_glClearNamedBufferData = glad_glClearNamedBufferData;
+		glad_glClearNamedBufferData = glad_instrument_glClearNamedBufferData;
+	}
+	if (glad_glClearNamedBufferSubData != NULL && glad_glClearNamedBufferSubData != glad_instrument_glClearNamedBufferSubData) {
+		glad_next_glClearNamedBufferSubData = glad_glClearNamedBufferSubData;
+		glad_glClearNamedBufferSubData = glad_instrument_glClearNamedBufferSubData;
+	}
+	if (glad_glMapNamedBuffer != NULL && glad_glMapNamedBuffer != glad_instrument_glMapNamedBuffer) {
+		glad_next_glMapNamedBuffer = glad_glMapNamedBuffer;
+		glad_glMapNamedBuffer = glad_instrument_glMapNamedBuffer;
+	}
+	if (glad_glMapNamedBufferRange != NULL && glad_glMapNamedBufferRange != glad_instrument_glMapNamedBufferRange) {
+		glad_next_glMapNamedBufferRange = glad_glMapNamedBufferRange;
+		glad_glMapNamedBufferRange = glad_instrument_glMapNamedBufferRange;
+	}
+	if (glad_glUnmapNamedBuffer != NULL && glad_glUnmapNamedBuffer != glad_instrument_glUnmapNamedBuffer) {
+		glad_next_glUnmapNamedBuffer = glad_glUnmapNamedBuffer;
+		glad_glUnmapNamedBuffer = glad_instrument_glUnmapNamedBuffer;
+	}
+	if (glad_glFlushMappedNamedBufferRange != NULL && glad_glFlushMappedNamedBufferRange != glad_instrument_glFlushMappedNamedBufferRange) {
+		glad_next_glFlushMappedNamedBufferRange = glad_glFlushMappedNamedBufferRange;
+		glad_glFlushMappedNamedBufferRange = glad_instrument_glFlushMappedNamedBufferRange;
+	}
+	if (glad_glGetNamedBufferParameteriv != NULL && glad_glGetNamedBufferParameteriv != glad_instrument_glGetNamedBufferParameteriv) {
+		glad_next_glGetNamedBufferParameteriv = glad_glGetNamedBufferParameteriv;
+		glad_glGetNamedBufferParameteriv = glad_instrument_glGetNamedBufferParameteriv;
+	}
+	if (glad_glGetNamedBufferParameteri64v != NULL && glad_glGetNamedBufferParameteri64v != glad_instrument_glGetNamedBufferParameteri64v) {
+		glad_next_glGetNamedBufferParameteri64v = glad_glGetNamedBufferParameteri64v;
+		glad_glGetNamedBufferParameteri64v = glad_instrument_glGetNamedBufferParameteri64v;
+	}
+	if (glad_glGetNamedBufferPointerv != NULL && glad_glGetNamedBufferPointerv != glad_instrument_glGetNamedBufferPointerv) {
+		glad_next_glGetNamedBufferPointerv = glad_glGetNamedBufferPointerv;
+		glad_glGetNamedBufferPointerv = glad_instrument_glGetNamedBufferPointerv;
+	}
+	if (glad_glGetNamedBufferSubData != NULL && glad_glGetNamedBufferSubData != glad_instrument_glGetNamedBufferSubData) {
+		glad_next_glGetNamedBufferSubData = glad_glGetNamedBufferSubData;
+		glad_glGetNamedBufferSubData = glad_instrument_glGetNamedBufferSubData;
+	}
+	if (glad_glCreateFramebuffers != NULL && glad_glCreateFramebuffers != glad_instrument_glCreateFramebuffers) {
+		glad_next_glCreateFramebuffers = glad_glCreateFramebuffers;
+		glad_glCreateFramebuffers = glad_instrument_glCreateFramebuffers;
+	}
+	if (glad_glNamedFramebufferRenderbuffer != NULL && glad_glNamedFramebufferRenderbuffer != glad_instrument_glNamedFramebufferRenderbuffer) {
+		glad_next_glNamedFramebufferRenderbuffer = glad_glNamedFramebufferRenderbuffer;
+		glad_glNamedFramebufferRenderbuffer = glad_instrument_glNamedFramebufferRenderbuffer;
+	}
+	if (glad_glNamedFramebufferParameteri != NULL && glad_glNamedFramebufferParameteri != glad_instrument_glNamedFramebufferParameteri) {
+		glad_next_glNamedFramebufferParameteri = glad_glNamedFramebufferParameteri;
+		glad_glNamedFramebufferParameteri = glad_instrument_glNamedFramebufferParameteri;
+	}
+	if (glad_glNamedFramebufferTexture != NULL && glad_glNamedFramebufferTexture != glad_instrument_glNamedFramebufferTexture) {
+		glad_next_glNamedFramebufferTexture = glad_glNamedFramebufferTexture;
+		glad_glNamedFramebufferTexture = glad_instrument_glNamedFramebufferTexture;
+	}
+	if (glad_glNamedFramebufferTextureLayer != NULL && glad_glNamedFramebufferTextureLayer != glad_instrument_glNamedFramebufferTextureLayer) {
+		glad_next_glNamedFramebufferTextureLayer = glad_glNamedFramebufferTextureLayer;
+		glad_glNamedFramebufferTextureLayer = glad_instrument_glNamedFramebufferTextureLayer;
+	}
+	if (glad_glNamedFramebufferDrawBuffer != NULL && glad_glNamedFramebufferDrawBuffer != glad_instrument_glNamedFramebufferDrawBuffer) {
+		glad_next_glNamedFramebufferDrawBuffer = glad_glNamedFramebufferDrawBuffer;
+		glad_glNamedFramebufferDrawBuffer = glad_instrument_glNamedFramebufferDrawBuffer;
+	}
+	if (glad_glNamedFramebufferDrawBuffers != NULL && glad_glNamedFramebufferDrawBuffers != glad_instrument_glNamedFramebufferDrawBuffers) {
+		glad_next_glNamedFramebufferDrawBuffers = glad_glNamedFramebufferDrawBuffers;
+		glad_glNamedFramebufferDrawBuffers = glad_instrument_glNamedFramebufferDrawBuffers;
+	}
+	if (glad_glNamedFramebufferReadBuffer != NULL && glad_glNamedFramebufferReadBuffer != glad_instrument_glNamedFramebufferReadBuffer) {
+		glad_next_glNamedFramebufferReadBuffer = glad_glNamedFramebufferReadBuffer;
+		glad_glNamedFramebufferReadBuffer = glad_instrument_glNamedFramebufferReadBuffer;
+	}
+	if (glad_glInvalidateNamedFramebufferData != NULL && glad_glInvalidateNamedFramebufferData != glad_instrument_glInvalidateNamedFramebufferData) {
+		glad_next_glInvalidateNamedFramebufferData = glad_glInvalidateNamedFramebufferData;
+		glad_glInvalidateNamedFramebufferData = glad_instrument_glInvalidateNamedFramebufferData;
+	}
+	if (glad_glInvalidateNamedFramebufferSubData != NULL && glad_glInvalidateNamedFramebufferSubData != glad_instrument_glInvalidateNamedFramebufferSubData) {
+		glad_next_glInvalidateNamedFramebufferSubData = glad_glInvalidateNamedFramebufferSubData;
+		glad_glInvalidateNamedFramebufferSubData = glad_instrument_glInvalidateNamedFramebufferSubData;
+	}
+	if (glad_glClearNamedFramebufferiv != NULL && glad_glClearNamedFramebufferiv != glad_instrument_glClearNamedFramebufferiv) {
+		glad_next_glClearNamedFramebufferiv = glad_glClearNamedFramebufferiv;
+		glad_glClearNamedFramebufferiv = glad_instrument_glClearNamedFramebufferiv;
+	}
+	if (glad_glClearNamedFramebufferuiv != NULL && glad_glClearNamedFramebufferuiv != glad_instrument_glClearNamedFramebufferuiv) {
+		glad_next_glClearNamedFramebufferuiv = glad_glClearNamedFramebufferuiv;
+		glad_glClearNamedFramebufferuiv = glad_instrument_glClearNamedFramebufferuiv;
+	}
+	if (glad_glClearNamedFramebufferfv != NULL && glad_glClearNamedFramebufferfv != glad_instrument_glClearNamedFramebufferfv) {
+		glad_next_glClearNamedFramebufferfv = glad_glClearNamedFramebufferfv;
+		glad_glClearNamedFramebufferfv = glad_instrument_glClearNamedFramebufferfv;
+	}
+	if (glad_glClearNamedFramebufferfi != NULL && glad_glClearNamedFramebufferfi != glad_instrument_glClearNamedFramebufferfi) {
+		glad_next_glClearNamedFramebufferfi = glad_glClearNamedFramebufferfi;
+		glad_glClearNamedFramebufferfi = glad_instrument_glClearNamedFramebufferfi;
+	}
+	if (glad_glBlitNamedFramebuffer != NULL && glad_glBlitNamedFramebuffer != glad_instrument_glBlitNamedFramebuffer) {
+		glad_next_glBlitNamedFramebuffer = glad_glBlitNamedFramebuffer;
+		glad_glBlitNamedFramebuffer = glad_instrument_glBlitNamedFramebuffer;
+	}
+	if (glad_glCheckNamedFramebufferStatus != NULL && glad_glCheckNamedFramebufferStatus != glad_instrument_glCheckNamedFramebufferStatus) {
+		glad_next_glCheckNamedFramebufferStatus = glad_glCheckNamedFramebufferStatus;
+		glad_glCheckNamedFramebufferStatus = glad_instrument_glCheckNamedFramebufferStatus;
+	}
+	if (glad_glGetNamedFramebufferParameteriv != NULL && glad_glGetNamedFramebufferParameteriv != glad_instrument_glGetNamedFramebufferParameteriv) {
+		glad_next_glGetNamedFramebufferParameteriv = glad_glGetNamedFramebufferParameteriv;
+		glad_glGetNamedFramebufferParameteriv = glad_instrument_glGetNamedFramebufferParameteriv;
+	}
+	if (glad_glGetNamedFramebufferAttachmentParameteriv != NULL && glad_glGetNamedFramebufferAttachmentParameteriv != glad_instrument_glGetNamedFramebufferAttachmentParameteriv) {
+		glad_next_glGetNamedFramebufferAttachmentParameteriv = glad_glGetNamedFramebufferAttachmentParameteriv;
+		glad_glGetNamedFramebufferAttachmentParameteriv = glad_instrument_glGetNamedFramebufferAttachmentParameteriv;
+	}
+	if (glad_glCreateRenderbuffers != NULL && glad_glCreateRenderbuffers != glad_instrument_glCreateRenderbuffers) {
+		glad_next_glCreateRenderbuffers = glad_glCreateRenderbuffers;
+		glad_glCreateRenderbuffers = glad_instrument_glCreateRenderbuffers;
+	}
+	if (glad_glNamedRenderbufferStorage != NULL && glad_glNamedRenderbufferStorage != glad_instrument_glNamedRenderbufferStorage) {
+		glad_next_glNamedRenderbufferStorage = glad_glNamedRenderbufferStorage;
+		glad_glNamedRenderbufferStorage = glad_instrument_glNamedRenderbufferStorage;
+	}
+	if (glad_glNamedRenderbufferStorageMultisample != NULL && glad_glNamedRenderbufferStorageMultisample != glad_instrument_glNamedRenderbufferStorageMultisample) {
+		glad_next_glNamedRenderbufferStorageMultisample = glad_glNamedRenderbufferStorageMultisample;
+		glad_glNamedRenderbufferStorageMultisample = glad_instrument_glNamedRenderbufferStorageMultisample;
+	}
+	if (glad_glGetNamedRenderbufferParameteriv != NULL && glad_glGetNamedRenderbufferParameteriv != glad_instrument_glGetNamedRenderbufferParameteriv) {
+		glad_next_glGetNamedRenderbufferParameteriv = glad_glGetNamedRenderbufferParameteriv;
+		glad_glGetNamedRenderbufferParameteriv = glad_instrument_glGetNamedRenderbufferParameteriv;
+	}
+	if (glad_glCreateTextures != NULL && glad_glCreateTextures != glad_instrument_glCreateTextures) {
+		glad_next_glCreateTextures = glad_glCreateTextures;
+		glad_glCreateTextures = glad_instrument_glCreateTextures;
+	}
+	if (glad_glTextureBuffer != NULL && glad_glTextureBuffer != glad_instrument_glTextureBuffer) {
+		glad_next_glTextureBuffer = glad_glTextureBuffer;
+		glad_glTextureBuffer = glad_instrument_glTextureBuffer;
+	}
+	if (glad_glTextureBufferRange != NULL && glad_glTextureBufferRange != glad_instrument_glTextureBufferRange) {
+		glad_next_glTextureBufferRange = glad_glTextureBufferRange;
+		glad_glTextureBufferRange = glad_instrument_glTextureBufferRange;
+	}
+	if (glad_glTextureStorage1D != NULL && glad_glTextureStorage1D != glad_instrument_glTextureStorage1D) {
+		glad_next_glTextureStorage1D = glad_glTextureStorage1D;
+		glad_glTextureStorage1D = glad_instrument_glTextureStorage1D;
+	}
+	if (glad_glTextureStorage2D != NULL && glad_glTextureStorage2D != glad_instrument_glTextureStorage2D) {
+		glad_next_glTextureStorage2D = glad_glTextureStorage2D;
+		glad_glTextureStorage2D = glad_instrument_glTextureStorage2D;
+	}
+	if (glad_glTextureStorage3D != NULL && glad_glTextureStorage3D != glad_instrument_glTextureStorage3D) {
+		glad_next_glTextureStorage3D = glad_glTextureStorage3D;
+		glad_glTextureStorage3D = glad_instrument_glTextureStorage3D;
+	}
+	if (glad_glTextureStorage2DMultisample != NULL && glad_glTextureStorage2DMultisample != glad_instrument_glTextureStorage2DMultisample) {
+		glad_next_glTextureStorage2DMultisample = glad_glTextureStorage2DMultisample;
+		glad_glTextureStorage2DMultisample = glad_instrument_glTextureStorage2DMultisample;
+	}
+	if (glad_glTextureStorage3DMultisample != NULL && glad_glTextureStorage3DMultisample != glad_instrument_glTextureStorage3DMultisample) {
+		glad_next_glTextureStorage3DMultisample = glad_glTextureStorage3DMultisample;
+		glad_glTextureStorage3DMultisample = glad_instrument_glTextureStorage3DMultisample;
+	}
+	if (glad_glTextureSubImage1D != NULL && glad_glTextureSubImage1D != glad_instrument_glTextureSubImage1D) {
+		glad_next_glTextureSubImage1D = glad_glTextureSubImage1D;
+		glad_glTextureSubImage1D = glad_instrument_glTextureSubImage1D;
+	}
+	if (glad_glTextureSubImage2D != NULL && glad_glTextureSubImage2D != glad_instrument_glTextureSubImage2D) {
+		glad_next_glTextureSubImage2D = glad_glTextureSubImage2D;
+		glad_glTextureSubImage2D = glad_instrument_glTextureSubImage2D;
+	}
+	if (glad_glTextureSubImage3D != NULL && glad_glTextureSubImage3D != glad_instrument_glTextureSubImage3D) {
+		glad_next_glTextureSubImage3D = glad_glTextureSubImage3D;
+		glad_glTextureSubImage3D = glad_instrument_glTextureSubImage3D;
+	}
+	if (glad_glCompressedTextureSubImage1D != NULL && glad_glCompressedTextureSubImage1D != glad_instrument_glCompressedTextureSubImage1D) {
+		glad_next_glCompressedTextureSubImage1D = glad_glCompressedTextureSubImage1D;
+		glad_glCompressedTextureSubImage1D = glad_instrument_glCompressedTextureSubImage1D;
+	}
+	if (glad_glCompressedTextureSubImage2D != NULL && glad_glCompressedTextureSubImage2D != glad_instrument_glCompressedTextureSubImage2D) {
+		glad_next_glCompressedTextureSubImage2D = glad_glCompressedTextureSubImage2D;
+		glad_glCompressedTextureSubImage2D = glad_instrument_glCompressedTextureSubImage2D;
+	}
+	if (glad_glCompressedTextureSubImage3D != NULL && glad_glCompressedTextureSubImage3D != glad_instrument_glCompressedTextureSubImage3D) {
+		glad_next_glCompressedTextureSubImage3D = glad_glCompressedTextureSubImage3D;
+		glad_glCompressedTextureSubImage3D = glad_instrument_glCompressedTextureSubImage3D;
+	}
+	if (glad_glCopyTextureSubImage1D != NULL && glad_glCopyTextureSubImage1D != glad_instrument_glCopyTextureSubImage1D) {
+		glad_next_glCopyTextureSubImage1D = glad_glCopyTextureSubImage1D;
+		glad_glCopyTextureSubImage1D = glad_instrument_glCopyTextureSubImage1D;
+	}
+	if (glad_glCopyTextureSubImage2D != NULL && glad_glCopyTextureSubImage2D != glad_instrument_glCopyTextureSubImage2D) {
+		glad_next_glCopyTextureSubImage2D = glad_glCopyTextureSubImage2D;
+		glad_glCopyTextureSubImage2D = glad_instrument_glCopyTextureSubImage2D;
+	}
+	if (glad_glCopyTextureSubImage3D != NULL && glad_glCopyTextureSubImage3D != glad_instrument_glCopyTextureSubImage3D) {
+		glad_next_glCopyTextureSubImage3D = glad_glCopyTextureSubImage3D;
+		glad_glCopyTextureSubImage3D = glad_instrument_glCopyTextureSubImage3D;
+	}
+	if (glad_glTextureParameterf != NULL && glad_glTextureParameterf != glad_instrument_glTextureParameterf) {
+		glad_next_glTextureParameterf = glad_glTextureParameterf;
+		glad_glTextureParameterf = glad_instrument_glTextureParameterf;
+	}
+	if (glad_glTextureParameterfv != NULL && glad_glTextureParameterfv != glad_instrument_glTextureParameterfv) {
+		glad_next_glTextureParameterfv = glad_glTextureParameterfv;
+		glad_glTextureParameterfv = glad_instrument_glTextureParameterfv;
+	}
+	if (glad_glTextureParameteri != NULL && glad_glTextureParameteri != glad_instrument_glTextureParameteri) {
+		glad_next_glTextureParameteri = glad_glTextureParameteri;
+		glad_glTextureParameteri = glad_instrument_glTextureParameteri;
+	}
+	if (glad_glTextureParameterIiv != NULL && glad_glTextureParameterIiv != glad_instrument_glTextureParameterIiv) {
+		glad_next_glTextureParameterIiv = glad_glTextureParameterIiv;
+		glad_glTextureParameterIiv = glad_instrument_glTextureParameterIiv;
+	}
+	if (glad_glTextureParameterIuiv != NULL && glad_glTextureParameterIuiv != glad_instrument_glTextureParameterIuiv) {
+		glad_next_glTextureParameterIuiv = glad_glTextureParameterIuiv;
+		glad_glTextureParameterIuiv = glad_instrument_glTextureParameterIuiv;
+	}
+	if (glad_glTextureParameteriv != NULL && glad_glTextureParameteriv != glad_instrument_glTextureParameteriv) {
+		glad_next_glTextureParameteriv = glad_glTextureParameteriv;
+		glad_glTextureParameteriv = glad_instrument_glTextureParameteriv;
+	}
+	if (glad_glGenerateTextureMipmap != NULL && glad_glGenerateTextureMipmap != glad_instrument_glGenerateTextureMipmap) {
+		glad_next_glGenerateTextureMipmap = glad_glGenerateTextureMipmap;
+		glad_glGenerateTextureMipmap = glad_instrument_glGenerateTextureMipmap;
+	}
+	if (glad_glBindTextureUnit != NULL && glad_glBindTextureUnit != glad_instrument_glBindTextureUnit) {
+		glad_next_glBindTextureUnit = glad_glBindTextureUnit;
+		glad_glBindTextureUnit = glad_instrument_glBindTextureUnit;
+	}
+	if (glad_glGetTextureImage != NULL && glad_glGetTextureImage != glad_instrument_glGetTextureImage) {
+		glad_next_glGetTextureImage = glad_glGetTextureImage;
+		glad_glGetTextureImage = glad_instrument_glGetTextureImage;
+	}
+	if (glad_glGetCompressedTextureImage != NULL && glad_glGetCompressedTextureImage != glad_instrument_glGetCompressedTextureImage) {
+		glad_next_glGetCompressedTextureImage = glad_glGetCompressedTextureImage;
+		glad_glGetCompressedTextureImage = glad_instrument_glGetCompressedTextureImage;
+	}
+	if (glad_glGetTextureLevelParameterfv != NULL && glad_glGetTextureLevelParameterfv != glad_instrument_glGetTextureLevelParameterfv) {
+		glad_next_glGetTextureLevelParameterfv = glad_glGetTextureLevelParameterfv;
+		glad_glGetTextureLevelParameterfv = glad_instrument_glGetTextureLevelParameterfv;
+	}
+	if (glad_glGetTextureLevelParameteriv != NULL && glad_glGetTextureLevelParameteriv != glad_instrument_glGetTextureLevelParameteriv) {
+		glad_next_glGetTextureLevelParameteriv = glad_glGetTextureLevelParameteriv;
+		glad_glGetTextureLevelParameteriv = glad_instrument_glGetTextureLevelParameteriv;
+	}
+	if (glad_glGetTextureParameterfv != NULL && glad_glGetTextureParameterfv != glad_instrument_glGetTextureParameterfv) {
+		glad_next_glGetTextureParameterfv = glad_glGetTextureParameterfv;
+		glad_glGetTextureParameterfv = glad_instrument_glGetTextureParameterfv;
+	}
+	if (glad_glGetTextureParameterIiv != NULL && glad_glGetTextureParameterIiv != glad_instrument_glGetTextureParameterIiv) {
+		glad_next_glGetTextureParameterIiv = glad_glGetTextureParameterIiv;
+		glad_glGetTextureParameterIiv = glad_instrument_glGetTextureParameterIiv;
+	}
+	if (glad_glGetTextureParameterIuiv != NULL && glad_glGetTextureParameterIuiv != glad_instrument_glGetTextureParameterIuiv) {
+		glad_next_glGetTextureParameterIuiv = glad_glGetTextureParameterIuiv;
+		glad_glGetTextureParameterIuiv = glad_instrument_glGetTextureParameterIuiv;
+	}
+	if (glad_glGetTextureParameteriv != NULL && glad_glGetTextureParameteriv != glad_instrument_glGetTextureParameteriv) {
+		glad_next_glGetTextureParameteriv = glad_glGetTextureParameteriv;
+		glad_glGetTextureParameteriv = glad_instrument_glGetTextureParameteriv;
+	}
+	if (glad_glCreateVertexArrays != NULL && glad_glCreateVertexArrays != glad_instrument_glCreateVertexArrays) {
+		glad_next_glCreateVertexArrays = glad_glCreateVertexArrays;
+		glad_glCreateVertexArrays = glad_instrument_glCreateVertexArrays;
+	}
+	if (glad_glDisableVertexArrayAttrib != NULL && glad_glDisableVertexArrayAttrib != glad_instrument_glDisableVertexArrayAttrib) {
+		glad_next_glDisableVertexArrayAttrib = glad_glDisableVertexArrayAttrib;
+		glad_glDisableVertexArrayAttrib = glad_instrument_glDisableVertexArrayAttrib;
+	}
+	if (glad_glEnableVertexArrayAttrib != NULL && glad_glEnableVertexArrayAttrib != glad_instrument_glEnableVertexArrayAttrib) {
+		glad_next_glEnableVertexArrayAttrib = glad_glEnableVertexArrayAttrib;
+		glad_glEnableVertexArrayAttrib = glad_instrument_glEnableVertexArrayAttrib;
+	}
+	if (glad_glVertexArrayElementBuffer != NULL && glad_glVertexArrayElementBuffer != glad_instrument_glVertexArrayElementBuffer) {
+		glad_next_glVertexArrayElementBuffer = glad_glVertexArrayElementBuffer;
+		glad_glVertexArrayElementBuffer = glad_instrument_glVertexArrayElementBuffer;
+	}
+	if (glad_glVertexArrayVertexBuffer != NULL && glad_glVertexArrayVertexBuffer != glad_instrument_glVertexArrayVertexBuffer) {
+		glad_next_glVertexArrayVertexBuffer = glad_glVertexArrayVertexBuffer;
+		glad_glVertexArrayVertexBuffer = glad_instrument_glVertexArrayVertexBuffer;
+	}
+	if (glad_glVertexArrayVertexBuffers != NULL && glad_glVertexArrayVertexBuffers != glad_instrument_glVertexArrayVertexBuffers) {
+		glad_next_glVertexArrayVertexBuffers = glad_glVertexArrayVertexBuffers;
+		glad_glVertexArrayVertexBuffers = glad_instrument_glVertexArrayVertexBuffers;
+	}
+	if (glad_glVertexArrayAttribBinding != NULL && glad_glVertexArrayAttribBinding != glad_instrument_glVertexArrayAttribBinding) {
+		glad_next_glVertexArrayAttribBinding = glad_glVertexArrayAttribBinding;
+		glad_glVertexArrayAttribBinding = glad_instrument_glVertexArrayAttribBinding;
+	}
+	if (glad_glVertexArrayAttribFormat != NULL && glad_glVertexArrayAttribFormat != glad_instrument_glVertexArrayAttribFormat) {
+		glad_next_glVertexArrayAttribFormat = glad_glVertexArrayAttribFormat;
+		glad_glVertexArrayAttribFormat = glad_instrument_glVertexArrayAttribFormat;
+	}
+	if (glad_glVertexArrayAttribIFormat != NULL && glad_glVertexArrayAttribIFormat != glad_instrument_glVertexArrayAttribIFormat) {
+		glad_next_glVertexArrayAttribIFormat = glad_glVertexArrayAttribIFormat;
+		glad_glVertexArrayAttribIFormat = glad_instrument_glVertexArrayAttribIFormat;
+	}
+	if (glad_glVertexArrayAttribLFormat != NULL && glad_glVertexArrayAttribLFormat != glad_instrument_glVertexArrayAttribLFormat) {
+		glad_next_glVertexArrayAttribLFormat = glad_glVertexArrayAttribLFormat;
+		glad_glVertexArrayAttribLFormat = glad_instrument_glVertexArrayAttribLFormat;
+	}
+	if (glad_glVertexArrayBindingDivisor != NULL && glad_glVertexArrayBindingDivisor != glad_instrument_glVertexArrayBindingDivisor) {
+		glad_next_glVertexArrayBindingDivisor = glad_glVertexArrayBindingDivisor;
+		glad_glVertexArrayBindingDivisor = glad_instrument_glVertexArrayBindingDivisor;
+	}
+	if (glad_glGetVertexArrayiv != NULL && glad_glGetVertexArrayiv != glad_instrument_glGetVertexArrayiv) {
+		glad_next_glGetVertexArrayiv = glad_glGetVertexArrayiv;
+		glad_glGetVertexArrayiv = glad_instrument_glGetVertexArrayiv;
+	}
+	if (glad_glGetVertexArrayIndexediv != NULL && glad_glGetVertexArrayIndexediv != glad_instrument_glGetVertexArrayIndexediv) {
+		glad_next_glGetVertexArrayIndexediv = glad_glGetVertexArrayIndexediv;
+		glad_glGetVertexArrayIndexediv = glad_instrument_glGetVertexArrayIndexediv;
+	}
+	if (glad_glGetVertexArrayIndexed64iv != NULL && glad_glGetVertexArrayIndexed64iv != glad_instrument_glGetVertexArrayIndexed64iv) {
+		glad_next_glGetVertexArrayIndexed64iv = glad_glGetVertexArrayIndexed64iv;
+		glad_glGetVertexArrayIndexed64iv = glad_instrument_glGetVertexArrayIndexed64iv;
+	}
+	if (glad_glCreateSamplers != NULL && glad_glCreateSamplers != glad_instrument_glCreateSamplers) {
+		glad_next_glCreateSamplers = glad_glCreateSamplers;
+		glad_glCreateSamplers = glad_instrument_glCreateSamplers;
+	}
+	if (glad_glCreateProgramPipelines != NULL && glad_glCreateProgramPipelines != glad_instrument_glCreateProgramPipelines) {
+		glad_next_glCreateProgramPipelines = glad_glCreateProgramPipelines;
+		glad_glCreateProgramPipelines = glad_instrument_glCreateProgramPipelines;
+	}
+	if (glad_glCreateQueries != NULL && glad_glCreateQueries != glad_instrument_glCreateQueries) {
+		glad_next_glCreateQueries = glad_glCreateQueries;
+		glad_glCreateQueries = glad_instrument_glCreateQueries;
+	}
+	if (glad_glGetQueryBufferObjecti64v != NULL && glad_glGetQueryBufferObjecti64v != glad_instrument_glGetQueryBufferObjecti64v) {
+		glad_next_glGetQueryBufferObjecti64v = glad_glGetQueryBufferObjecti64v;
+		glad_glGetQueryBufferObjecti64v = glad_instrument_glGetQueryBufferObjecti64v;
+	}
+	if (glad_glGetQueryBufferObjectiv != NULL && glad_glGetQueryBufferObjectiv != glad_instrument_glGetQueryBufferObjectiv) {
+		glad_next_glGetQueryBufferObjectiv = glad_glGetQueryBufferObjectiv;
+		glad_glGetQueryBufferObjectiv = glad_instrument_glGetQueryBufferObjectiv;
+	}
+	if (glad_glGetQueryBufferObjectui64v != NULL && glad_glGetQueryBufferObjectui64v != glad_instrument_glGetQueryBufferObjectui64v) {
+		glad_next_glGetQueryBufferObjectui64v = glad_glGetQueryBufferObjectui64v;
+		glad_glGetQueryBufferObjectui64v = glad_instrument_glGetQueryBufferObjectui64v;
+	}
+	if (glad_glGetQueryBufferObjectuiv != NULL && glad_glGetQueryBufferObjectuiv != glad_instrument_glGetQueryBufferObjectuiv) {
+		glad_next_glGetQueryBufferObjectuiv = glad_glGetQueryBufferObjectuiv;
+		glad_glGetQueryBufferObjectuiv = glad_instrument_glGetQueryBufferObjectuiv;
+	}
+	if (glad_glMemoryBarrierByRegion != NULL && glad_glMemoryBarrierByRegion != glad_instrument_glMemoryBarrierByRegion) {
+		glad_next_glMemoryBarrierByRegion = glad_glMemoryBarrierByRegion;
+		glad_glMemoryBarrierByRegion = glad_instrument_glMemoryBarrierByRegion;
+	}
+	if (glad_glGetTextureSubImage != NULL && glad_glGetTextureSubImage != glad_instrument_glGetTextureSubImage) {
+		glad_next_glGetTextureSubImage = glad_glGetTextureSubImage;
+		glad_glGetTextureSubImage = glad_instrument_glGetTextureSubImage;
+	}
+	if (glad_glGetCompressedTextureSubImage != NULL && glad_glGetCompressedTextureSubImage != glad_instrument_glGetCompressedTextureSubImage) {
+		glad_next_glGetCompressedTextureSubImage = glad_glGetCompressedTextureSubImage;
+		glad_glGetCompressedTextureSubImage = glad_instrument_glGetCompressedTextureSubImage;
+	}
+	if (glad_glGetGraphicsResetStatus != NULL && glad_glGetGraphicsResetStatus != glad_instrument_glGetGraphicsResetStatus) {
+		glad_next_glGetGraphicsResetStatus = glad_glGetGraphicsResetStatus;
+		glad_glGetGraphicsResetStatus = glad_instrument_glGetGraphicsResetStatus;
+	}
+	if (glad_glGetnCompressedTexImage != NULL && glad_glGetnCompressedTexImage != glad_instrument_glGetnCompressedTexImage) {
+		glad_next_glGetnCompressedTexImage = glad_glGetnCompressedTexImage;
+		glad_glGetnCompressedTexImage = glad_instrument_glGetnCompressedTexImage;
+	}
+	if (glad_glGetnTexImage != NULL && glad_glGetnTexImage != glad_instrument_glGetnTexImage) {
+		glad_next_glGetnTexImage = glad_glGetnTexImage;
+		glad_glGetnTexImage = glad_instrument_glGetnTexImage;
+	}
+	if (glad_glGetnUniformdv != NULL && glad_glGetnUniformdv != glad_instrument_glGetnUniformdv) {
+		glad_next_glGetnUniformdv = glad_glGetnUniformdv;
+		glad_glGetnUniformdv = glad_instrument_glGetnUniformdv;
+	}
+	if (glad_glGetnUniformfv != NULL && glad_glGetnUniformfv != glad_instrument_glGetnUniformfv) {
+		glad_next_glGetnUniformfv = glad_glGetnUniformfv;
+		glad_glGetnUniformfv = glad_instrument_glGetnUniformfv;
+	}
+	if (glad_glGetnUniformiv != NULL && glad_glGetnUniformiv != glad_instrument_glGetnUniformiv) {
+		glad_next_glGetnUniformiv = glad_glGetnUniformiv;
+		glad_glGetnUniformiv = glad_instrument_glGetnUniformiv;
+	}
+	if (glad_glGetnUniformuiv != NULL && glad_glGetnUniformuiv != glad_instrument_glGetnUniformuiv) {
+		glad_next_glGetnUniformuiv = glad_glGetnUniformuiv;
+		glad_glGetnUniformuiv = glad_instrument_glGetnUniformuiv;
+	}
+	if (glad_glReadnPixels != NULL && glad_glReadnPixels != glad_instrument_glReadnPixels) {
+		glad_next_glReadnPixels = glad_glReadnPixels;
+		glad_glReadnPixels = glad_instrument_glReadnPixels;
+	}
+	if (glad_glGetnMapdv != NULL && glad_glGetnMapdv != glad_instrument_glGetnMapdv) {
+		glad_next_glGetnMapdv = glad_glGetnMapdv;
+		glad_glGetnMapdv = glad_instrument_glGetnMapdv;
+	}
+	if (glad_glGetnMapfv != NULL && glad_glGetnMapfv != glad_instrument_glGetnMapfv) {
+		glad_next_glGetnMapfv = glad_glGetnMapfv;
+		glad_glGetnMapfv = glad_instrument_glGetnMapfv;
+	}
+	if (glad_glGetnMapiv != NULL && glad_glGetnMapiv != glad_instrument_glGetnMapiv) {
+		glad_next_glGetnMapiv = glad_glGetnMapiv;
+		glad_glGetnMapiv = glad_instrument_glGetnMapiv;
+	}
+	if (glad_glGetnPixelMapfv != NULL && glad_glGetnPixelMapfv != glad_instrument_glGetnPixelMapfv) {
+		glad_next_glGetnPixelMapfv = glad_glGetnPixelMapfv;
+		glad_glGetnPixelMapfv = glad_instrument_glGetnPixelMapfv;
+	}
+	if (glad_glGetnPixelMapuiv != NULL && glad_glGetnPixelMapuiv != glad_instrument_glGetnPixelMapuiv) {
+		glad_next_glGetnPixelMapuiv = glad_glGetnPixelMapuiv;
+		glad_glGetnPixelMapuiv = glad_instrument_glGetnPixelMapuiv;
+	}
+	if (glad_glGetnPixelMapusv != NULL && glad_glGetnPixelMapusv != glad_instrument_glGetnPixelMapusv) {
+		glad_next_glGetnPixelMapusv = glad_glGetnPixelMapusv;
+		glad_glGetnPixelMapusv = glad_instrument_glGetnPixelMapusv;
+	}
+	if (glad_glGetnPolygonStipple != NULL && glad_glGetnPolygonStipple != glad_instrument_glGetnPolygonStipple) {
+		glad_next_glGetnPolygonStipple = glad_glGetnPolygonStipple;
+		glad_glGetnPolygonStipple = glad_instrument_glGetnPolygonStipple;
+	}
+	if (glad_glGetnColorTable != NULL && glad_glGetnColorTable != glad_instrument_glGetnColorTable) {
+		glad_next_glGetnColorTable = glad_glGetnColorTable;
+		glad_glGetnColorTable = glad_instrument_glGetnColorTable;
+	}
+	if (glad_glGetnConvolutionFilter != NULL && glad_glGetnConvolutionFilter != glad_instrument_glGetnConvolutionFilter) {
+		glad_next_glGetnConvolutionFilter = glad_glGetnConvolutionFilter;
+		glad_glGetnConvolutionFilter = glad_instrument_glGetnConvolutionFilter;
+	}
+	if (glad_glGetnSeparableFilter != NULL && glad_glGetnSeparableFilter != glad_instrument_glGetnSeparableFilter) {
+		glad_next_glGetnSeparableFilter = glad_glGetnSeparableFilter;
+		glad_glGetnSeparableFilter = glad_instrument_glGetnSeparableFilter;
+	}
+	if (glad_glGetnHistogram != NULL && glad_glGetnHistogram != glad_instrument_glGetnHistogram) {
+		glad_next_glGetnHistogram = glad_glGetnHistogram;
+		glad_glGetnHistogram = glad_instrument_glGetnHistogram;
+	}
+	if (glad_glGetnMinmax != NULL && glad_glGetnMinmax != glad_instrument_glGetnMinmax) {
+		glad_next_glGetnMinmax = glad_glGetnMinmax;
+		glad_glGetnMinmax = glad_instrument_glGetnMinmax;
+	}
+	if (glad_glTextureBarrier != NULL && glad_glTextureBarrier != glad_instrument_glTextureBarrier) {
+		glad_next_glTextureBarrier = glad_glTextureBarrier;
+		glad_glTextureBarrier = glad_instrument_glTextureBarrier;
+	}
+}
+
+void gladInstrumentUninstall(void) {
+	if (glad_glCullFace == glad_instrument_glCullFace) glad_glCullFace = glad_next_glCullFace;
+	if (glad_glFrontFace == glad_instrument_glFrontFace) glad_glFrontFace = glad_next_glFrontFace;
+	if (glad_glHint == glad_instrument_glHint) glad_glHint = glad_next_glHint;
+	if (glad_glLineWidth == glad_instrument_glLineWidth) glad_glLineWidth = glad_next_glLineWidth;
+	if (glad_glPointSize == glad_instrument_glPointSize) glad_glPointSize = glad_next_glPointSize;
+	if (glad_glPolygonMode == glad_instrument_glPolygonMode) glad_glPolygonMode = glad_next_glPolygonMode;
+	if (glad_glScissor == glad_instrument_glScissor) glad_glScissor = glad_next_glScissor;
+	if (glad_glTexParameterf == glad_instrument_glTexParameterf) glad_glTexParameterf = glad_next_glTexParameterf;
+	if (glad_glTexParameterfv == glad_instrument_glTexParameterfv) glad_glTexParameterfv = glad_next_glTexParameterfv;
+	if (glad_glTexParameteri == glad_instrument_glTexParameteri) glad_glTexParameteri = glad_next_glTexParameteri;
+	if (glad_glTexParameteriv == glad_instrument_glTexParameteriv) glad_glTexParameteriv = glad_next_glTexParameteriv;
+	if (glad_glTexImage1D == glad_instrument_glTexImage1D) glad_glTexImage1D = glad_next_glTexImage1D;
+	if (glad_glTexImage2D == glad_instrument_glTexImage2D) glad_glTexImage2D = glad_next_glTexImage2D;
+	if (glad_glDrawBuffer == glad_instrument_glDrawBuffer) glad_glDrawBuffer = glad_next_glDrawBuffer;
+	if (glad_glClear == glad_instrument_glClear) glad_glClear = glad_next_glClear;
+	if (glad_glClearColor == glad_instrument_glClearColor) glad_glClearColor = glad_next_glClearColor;
+	if (glad_glClearStencil == glad_instrument_glClearStencil) glad_glClearStencil = glad_next_glClearStencil;
+	if (glad_glClearDepth == glad_instrument_glClearDepth) glad_glClearDepth = glad_next_glClearDepth;
+	if (glad_glStencilMask == glad_instrument_glStencilMask) glad_glStencilMask = glad_next_glStencilMask;
+	if (glad_glColorMask == glad_instrument_glColorMask) glad_glColorMask = glad_next_glColorMask;
+	if (glad_glDepthMask == glad_instrument_glDepthMask) glad_glDepthMask = glad_next_glDepthMask;
+	if (glad_glDisable == glad_instrument_glDisable) glad_glDisable = glad_next_glDisable;
+	if (glad_glEnable == glad_instrument_glEnable) glad_glEnable = glad_next_glEnable;
+	if (glad_glFinish == glad_instrument_glFinish) glad_glFinish = glad_next_glFinish;
+	if (glad_glFlush == glad_instrument_glFlush) glad_glFlush = glad_next_glFlush;
+	if (glad_glBlendFunc == glad_instrument_glBlendFunc) glad_glBlendFunc = glad_next_glBlendFunc;
+	if (glad_glLogicOp == glad_instrument_glLogicOp) glad_glLogicOp = glad_next_glLogicOp;
+	if (glad_glStencilFunc == glad_instrument_glStencilFunc) glad_glStencilFunc = glad_next_glStencilFunc;
+	if (glad_glStencilOp == glad_instrument_glStencilOp) glad_glStencilOp = glad_next_glStencilOp;
+	if (glad_glDepthFunc == glad_instrument_glDepthFunc) glad_glDepthFunc = glad_next_glDepthFunc;
+	if (glad_glPixelStoref == glad_instrument_glPixelStoref) glad_glPixelStoref = glad_next_glPixelStoref;
+	if (glad_glPixelStorei == glad_instrument_glPixelStorei) glad_glPixelStorei = glad_next_glPixelStorei;
+	if (glad_glReadBuffer == glad_instrument_glReadBuffer) glad_glReadBuffer = glad_next_glReadBuffer;
+	if (glad_glReadPixels == glad_instrument_glReadPixels) glad_glReadPixels = glad_next_glReadPixels;
+	if (glad_glGetBooleanv == glad_instrument_glGetBooleanv) glad_glGetBooleanv = glad_next_glGetBooleanv;
+	if (glad_glGetDoublev == glad_instrument_glGetDoublev) glad_glGetDoublev = glad_next_glGetDoublev;
+	if (glad_glGetError == glad_instrument_glGetError) glad_glGetError = glad_next_glGetError;
+	if (glad_glGetFloatv == glad_instrument_glGetFloatv) glad_glGetFloatv = glad_next_glGetFloatv;
+	if (glad_glGetIntegerv == glad_instrument_glGetIntegerv) glad_glGetIntegerv = glad_next_glGetIntegerv;
+	if (glad_glGetString == glad_instrument_glGetString) glad_glGetString = glad_next_glGetString;
+	if (glad_glGetTexImage == glad_instrument_glGetTexImage) glad_glGetTexImage = glad_next_glGetTexImage;
+	if (glad_glGetTexParameterfv == glad_instrument_glGetTexParameterfv) glad_glGetTexParameterfv = glad_next_glGetTexParameterfv;
+	if (glad_glGetTexParameteriv == glad_instrument_glGetTexParameteriv) glad_glGetTexParameteriv = glad_next_glGetTexParameteriv;
+	if (glad_glGetTexLevelParameterfv == glad_instrument_glGetTexLevelParameterfv) glad_glGetTexLevelParameterfv = glad_next_glGetTexLevelParameterfv;
+	if (glad_glGetTexLevelParameteriv == glad_instrument_glGetTexLevelParameteriv) glad_glGetTexLevelParameteriv = glad_next_glGetTexLevelParameteriv;
+	if (glad_glIsEnabled == glad_instrument_glIsEnabled) glad_glIsEnabled = glad_next_glIsEnabled;
+	if (glad_glDepthRange == glad_instrument_glDepthRange) glad_glDepthRange = glad_next_glDepthRange;
+	if (glad_glViewport == glad_instrument_glViewport) glad_glViewport = glad_next_glViewport;
+	if (glad_glDrawArrays == glad_instrument_glDrawArrays) glad_glDrawArrays = glad_next_glDrawArrays;
+	if (glad_glDrawElements == glad_instrument_glDrawElements) glad_glDrawElements = glad_next_glDrawElements;
+	if (glad_glPolygonOffset == glad_instrument_glPolygonOffset) glad_glPolygonOffset = glad_next_glPolygonOffset;
+	if (glad_glCopyTexImage1D == glad_instrument_glCopyTexImage1D) glad_glCopyTexImage1D = glad_next_glCopyTexImage1D;
+	if (glad_glCopyTexImage2D == glad_instrument_glCopyTexImage2D) glad_glCopyTexImage2D = glad_next_glCopyTexImage2D;
+	if (glad_glCopyTexSubImage1D == glad_instrument_glCopyTexSubImage1D) glad_glCopyTexSubImage1D = glad_next_glCopyTexSubImage1D;
+	if (glad_glCopyTexSubImage2D == glad_instrument_glCopyTexSubImage2D) glad_glCopyTexSubImage2D = glad_next_glCopyTexSubImage2D;
+	if (glad_glTexSubImage1D == glad_instrument_glTexSubImage1D) glad_glTexSubImage1D = glad_next_glTexSubImage1D;
+	if (glad_glTexSubImage2D == glad_instrument_glTexSubImage2D) glad_glTexSubImage2D = glad_next_glTexSubImage2D;
+	if (glad_glBindTexture == glad_instrument_glBindTexture) glad_glBindTexture = glad_next_glBindTexture;
+	if (glad_glDeleteTextures == glad_instrument_glDeleteTextures) glad_glDeleteTextures = glad_next_glDeleteTextures;
+	if (glad_glGenTextures == glad_instrument_glGenTextures) glad_glGenTextures = glad_next_glGenTextures;
+	if (glad_glIsTexture == glad_instrument_glIsTexture) glad_glIsTexture = glad_next_glIsTexture;
+	if (glad_glDrawRangeElements == glad_instrument_glDrawRangeElements) glad_glDrawRangeElements = glad_next_glDrawRangeElements;
+	if (glad_glTexImage3D == glad_instrument_glTexImage3D) glad_glTexImage3D = glad_next_glTexImage3D;
+	if (glad_glTexSubImage3D == glad_instrument_glTexSubImage3D) glad_glTexSubImage3D = glad_next_glTexSubImage3D;
+	if (glad_glCopyTexSubImage3D == glad_instrument_glCopyTexSubImage3D) glad_glCopyTexSubImage3D = glad_next_glCopyTexSubImage3D;
+	if (glad_glActiveTexture == glad_instrument_glActiveTexture) glad_glActiveTexture = glad_next_glActiveTexture;
+	if (glad_glSampleCoverage == glad_instrument_glSampleCoverage) glad_glSampleCoverage = glad_next_glSampleCoverage;
+	if (glad_glCompressedTexImage3D == glad_instrument_glCompressedTexImage3D) glad_glCompressedTexImage3D = glad_next_glCompressedTexImage3D;
+	if (glad_glCompressedTexImage2D == glad_instrument_glCompressedTexImage2D) glad_glCompressedTexImage2D = glad_next_glCompressedTexImage2D;
+	if (glad_glCompressedTexImage1D == glad_instrument_glCompressedTexImage1D) glad_glCompressedTexImage1D = glad_next_glCompressedTexImage1D;
+	if (glad_glCompressedTexSubImage3D == glad_instrument_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D = glad_next_glCompressedTexSubImage3D;
+	if (glad_glCompressedTexSubImage2D == glad_instrument_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D = glad_next_glCompressedTexSubImage2D;
+	if (glad_glCompressedTexSubImage1D == glad_instrument_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D = glad_next_glCompressedTexSubImage1D;
+	if (glad_glGetCompressedTexImage == glad_instrument_glGetCompressedTexImage) glad_glGetCompressedTexImage = glad_next_glGetCompressedTexImage;
+	if (glad_glBlendFuncSeparate == glad_instrument_glBlendFuncSeparate) glad_glBlendFuncSeparate = glad_next_glBlendFuncSeparate;
+	if (glad_glMultiDrawArrays == glad_instrument_glMultiDrawArrays) glad_glMultiDrawArrays = glad_next_glMultiDrawArrays;
+	if (glad_glMultiDrawElements == glad_instrument_glMultiDrawElements) glad_glMultiDrawElements = glad_next_glMultiDrawElements;
+	if (glad_glPointParameterf == glad_instrument_glPointParameterf) glad_glPointParameterf = glad_next_glPointParameterf;
+	if (glad_glPointParameterfv == glad_instrument_glPointParameterfv) glad_glPointParameterfv = glad_next_glPointParameterfv;
+	if (glad_glPointParameteri == glad_instrument_glPointParameteri) glad_glPointParameteri = glad_next_glPointParameteri;
+	if (glad_glPointParameteriv == glad_instrument_glPointParameteriv) glad_glPointParameteriv = glad_next_glPointParameteriv;
+	if (glad_glBlendColor == glad_instrument_glBlendColor) glad_glBlendColor = glad_next_glBlendColor;
+	if (glad_glBlendEquation == glad_instrument_glBlendEquation) glad_glBlendEquation = glad_next_glBlendEquation;
+	if (glad_glGenQueries == glad_instrument_glGenQueries) glad_glGenQueries = glad_next_glGenQueries;
+	if (glad_glDeleteQueries == glad_instrument_glDeleteQueries) glad_glDeleteQueries = glad_next_glDeleteQueries;
+	if (glad_glIsQuery == glad_instrument_glIsQuery) glad_glIsQuery = glad_next_glIsQuery;
+	if (glad_glBeginQuery == glad_instrument_glBeginQuery) glad_glBeginQuery = glad_next_glBeginQuery;
+	if (glad_glEndQuery == glad_instrument_glEndQuery) glad_glEndQuery = glad_next_glEndQuery;
+	if (glad_glGetQueryiv == glad_instrument_glGetQueryiv) glad_glGetQueryiv = glad_next_glGetQueryiv;
+	if (glad_glGetQueryObjectiv == glad_instrument_glGetQueryObjectiv) glad_glGetQueryObjectiv = glad_next_glGetQueryObjectiv;
+	if (glad_glGetQueryObjectuiv == glad_instrument_glGetQueryObjectuiv) glad_glGetQueryObjectuiv = glad_next_glGetQueryObjectuiv;
+	if (glad_glBindBuffer == glad_instrument_glBindBuffer) glad_glBindBuffer = glad_next_glBindBuffer;
+	if (glad_glDeleteBuffers == glad_instrument_glDeleteBuffers) glad_glDeleteBuffers = glad_next_glDeleteBuffers;
+	if (glad_glGenBuffers == glad_instrument_glGenBuffers) glad_glGenBuffers = glad_next_glGenBuffers;
+	if (glad_glIsBuffer == glad_instrument_glIsBuffer) glad_glIsBuffer = glad_next_glIsBuffer;
+	if (glad_glBufferData == glad_instrument_glBufferData) glad_glBufferData = glad_next_glBufferData;
+	if (glad_glBufferSubData == glad_instrument_glBufferSubData) glad_glBufferSubData = glad_next_glBufferSubData;
+	if (glad_glGetBufferSubData == glad_instrument_glGetBufferSubData) glad_glGetBufferSubData = glad_next_glGetBufferSubData;
+	if (glad_glMapBuffer == glad_instrument_glMapBuffer) glad_glMapBuffer = glad_next_glMapBuffer;
+	if (glad_glUnmapBuffer == glad_instrument_glUnmapBuffer) glad_glUnmapBuffer = glad_next_glUnmapBuffer;
+	if (glad_glGetBufferParameteriv == glad_instrument_glGetBufferParameteriv) glad_glGetBufferParameteriv = glad_next_glGetBufferParameteriv;
+	if (glad_glGetBufferPointerv == glad_instrument_glGetBufferPointerv) glad_glGetBufferPointerv = glad_next_glGetBufferPointerv;
+	if (glad_glBlendEquationSeparate == glad_instrument_glBlendEquationSeparate) glad_glBlendEquationSeparate = glad_next_glBlendEquationSeparate;
+	if (glad_glDrawBuffers == glad_instrument_glDrawBuffers) glad_glDrawBuffers = glad_next_glDrawBuffers;
+	if (glad_glStencilOpSeparate == glad_instrument_glStencilOpSeparate) glad_glStencilOpSeparate = glad_next_glStencilOpSeparate;
+	if (glad_glStencilFuncSeparate == glad_instrument_glStencilFuncSeparate) glad_glStencilFuncSeparate = glad_next_glStencilFuncSeparate;
+	if (glad_glStencilMaskSeparate == glad_instrument_glStencilMaskSeparate) glad_glStencilMaskSeparate = glad_next_glStencilMaskSeparate;
+	if (glad_glAttachShader == glad_instrument_glAttachShader) glad_glAttachShader = glad_next_glAttachShader;
+	if (glad_glBindAttribLocation == glad_instrument_glBindAttribLocation) glad_glBindAttribLocation = glad_next_glBindAttribLocation;
+	if (glad_glCompileShader == glad_instrument_glCompileShader) glad_glCompileShader = glad_next_glCompileShader;
+	if (glad_glCreateProgram == glad_instrument_glCreateProgram) glad_glCreateProgram = glad_next_glCreateProgram;
+	if (glad_glCreateShader == glad_instrument_glCreateShader) glad_glCreateShader = glad_next_glCreateShader;
+	if (glad_glDeleteProgram == glad_instrument_glDeleteProgram) glad_glDeleteProgram = glad_next_glDeleteProgram;
+	if (glad_glDeleteShader == glad_instrument_glDeleteShader) glad_glDeleteShader = glad_next_glDeleteShader;
+	if (glad_glDetachShader == glad_instrument_glDetachShader) glad_glDetachShader = glad_next_glDetachShader;
+	if (glad_glDisableVertexAttribArray == glad_instrument_glDisableVertexAttribArray) glad_glDisableVertexAttribArray = glad_next_glDisableVertexAttribArray;
+	if (glad_glEnableVertexAttribArray == glad_instrument_glEnableVertexAttribArray) glad_glEnableVertexAttribArray = glad_next_glEnableVertexAttribArray;
+	if (glad_glGetActiveAttrib == glad_instrument_glGetActiveAttrib) glad_glGetActiveAttrib = glad_next_glGetActiveAttrib;
+	if (glad_glGetActiveUniform == glad_instrument_glGetActiveUniform) glad_glGetActiveUniform = glad_next_glGetActiveUniform;
+	if (glad_glGetAttachedShaders == glad_instrument_glGetAttachedShaders) glad_glGetAttachedShaders = glad_next_glGetAttachedShaders;
+	if (glad_glGetAttribLocation == glad_instrument_glGetAttribLocation) glad_glGetAttribLocation = glad_next_glGetAttribLocation;
+	if (glad_glGetProgramiv == glad_instrument_glGetProgramiv) glad_glGetProgramiv = glad_next_glGetProgramiv;
+	if (glad_glGetProgramInfoLog == glad_instrument_glGetProgramInfoLog) glad_glGetProgramInfoLog = glad_next_glGetProgramInfoLog;
+	if (glad_glGetShaderiv == glad_instrument_glGetShaderiv) glad_glGetShaderiv = glad_next_glGetShaderiv;
+	if (glad_glGetShaderInfoLog == glad_instrument_glGetShaderInfoLog) glad_glGetShaderInfoLog = glad_next_glGetShaderInfoLog;
+	if (glad_glGetShaderSource == glad_instrument_glGetShaderSource) glad_glGetShaderSource = glad_next_glGetShaderSource;
+	if (glad_glGetUniformLocation == glad_instrument_glGetUniformLocation) glad_glGetUniformLocation = glad_next_glGetUniformLocation;
+	if (glad_glGetUniformfv == glad_instrument_glGetUniformfv) glad_glGetUniformfv = glad_next_glGetUniformfv;
+	if (glad_glGetUniformiv == glad_instrument_glGetUniformiv) glad_glGetUniformiv = glad_next_glGetUniformiv;
+	if (glad_glGetVertexAttribdv == glad_instrument_glGetVertexAttribdv) glad_glGetVertexAttribdv = glad_next_glGetVertexAttribdv;
+	if (glad_glGetVertexAttribfv == glad_instrument_glGetVertexAttribfv) glad_glGetVertexAttribfv = glad_next_glGetVertexAttribfv;
+	if (glad_glGetVertexAttribiv == glad_instrument_glGetVertexAttribiv) glad_glGetVertexAttribiv = glad_next_glGetVertexAttribiv;
+	if (glad_glGetVertexAttribPointerv == glad_instrument_glGetVertexAttribPointerv) glad_glGetVertexAttribPointerv = glad_next_glGetVertexAttribPointerv;
+	if (glad_glIsProgram == glad_instrument_glIsProgram) glad_glIsProgram = glad_next_glIsProgram;
+	if (glad_glIsShader == glad_instrument_glIsShader) glad_glIsShader = glad_next_glIsShader;
+	if (glad_glLinkProgram == glad_instrument_glLinkProgram) glad_glLinkProgram = glad_next_glLinkProgram;
+	if (glad_glShaderSource == glad_instrument_glShaderSource) glad_glShaderSource = glad_next_glShaderSource;
+	if (glad_glUseProgram == glad_instrument_glUseProgram) glad_glUseProgram = glad_next_glUseProgram;
+	if (glad_glUniform1f == glad_instrument_glUniform1f) glad_glUniform1f = glad_next_glUniform1f;
+	if (glad_glUniform2f == glad_instrument_glUniform2f) glad_glUniform2f = glad_next_glUniform2f;
+	if (glad_glUniform3f == glad_instrument_glUniform3f) glad_glUniform3f = glad_next_glUniform3f;
+	if (glad_glUniform4f == glad_instrument_glUniform4f) glad_glUniform4f = glad_next_glUniform4f;
+	if (glad_glUniform1i == glad_instrument_glUniform1i) glad_glUniform1i = glad_next_glUniform1i;
+	if (glad_glUniform2i == glad_instrument_glUniform2i) glad_glUniform2i = glad_next_glUniform2i;
+	if (glad_glUniform3i == glad_instrument_glUniform3i) glad_glUniform3i = glad_next_glUniform3i;
+	if (glad_glUniform4i == glad_instrument_glUniform4i) glad_glUniform4i = glad_next_glUniform4i;
+	if (glad_glUniform1fv == glad_instrument_glUniform1fv) glad_glUniform1fv = glad_next_glUniform1fv;
+	if (glad_glUniform2fv == glad_instrument_glUniform2fv) glad_glUniform2fv = glad_next_glUniform2fv;
+	if (glad_glUniform3fv == glad_instrument_glUniform3fv) glad_glUniform3fv = glad_next_glUniform3fv;
+	if (glad_glUniform4fv == glad_instrument_glUniform4fv) glad_glUniform4fv = glad_next_glUniform4fv;
+	if (glad_glUniform1iv == glad_instrument_glUniform1iv) glad_glUniform1iv = glad_next_glUniform1iv;
+	if (glad_glUniform2iv == glad_instrument_glUniform2iv) glad_glUniform2iv = glad_next_glUniform2iv;
+	if (glad_glUniform3iv == glad_instrument_glUniform3iv) glad_glUniform3iv = glad_next_glUniform3iv;
+	if (glad_glUniform4iv == glad_instrument_glUniform4iv) glad_glUniform4iv = glad_next_glUniform4iv;
+	if (glad_glUniformMatrix2fv == glad_instrument_glUniformMatrix2fv) glad_glUniformMatrix2fv = glad_next_glUniformMatrix2fv;
+	if (glad_glUniformMatrix3fv == glad_instrument_glUniformMatrix3fv) glad_glUniformMatrix3fv = glad_next_glUniformMatrix3fv;
+	if (glad_glUniformMatrix4fv == glad_instrument_glUniformMatrix4fv) glad_glUniformMatrix4fv = glad_next_glUniformMatrix4fv;
+	if (glad_glValidateProgram == glad_instrument_glValidateProgram) glad_glValidateProgram = glad_next_glValidateProgram;
+	if (glad_glVertexAttrib1d == glad_instrument_glVertexAttrib1d) glad_glVertexAttrib1d = glad_next_glVertexAttrib1d;
+	if (glad_glVertexAttrib1dv == glad_instrument_glVertexAttrib1dv) glad_glVertexAttrib1dv = glad_next_glVertexAttrib1dv;
+	if (glad_glVertexAttrib1f == glad_instrument_glVertexAttrib1f) glad_glVertexAttrib1f = glad_next_glVertexAttrib1f;
+	if (glad_glVertexAttrib1fv == glad_instrument_glVertexAttrib1fv) glad_glVertexAttrib1fv = glad_next_glVertexAttrib1fv;
+	if (glad_glVertexAttrib1s == glad_instrument_glVertexAttrib1s) glad_glVertexAttrib1s = glad_next_glVertexAttrib1s;
+	if (glad_glVertexAttrib1sv == glad_instrument_glVertexAttrib1sv) glad_glVertexAttrib1sv = glad_next_glVertexAttrib1sv;
+	if (glad_glVertexAttrib2d == glad_instrument_glVertexAttrib2d) glad_glVertexAttrib2d = glad_next_glVertexAttrib2d;
+	if (glad_glVertexAttrib2dv == glad_instrument_glVertexAttrib2dv) glad_glVertexAttrib2dv = glad_next_glVertexAttrib2dv;
+	if (glad_glVertexAttrib2f == glad_instrument_glVertexAttrib2f) glad_glVertexAttrib2f = glad_next_glVertexAttrib2f;
+	if (glad_glVertexAttrib2fv == glad_instrument_glVertexAttrib2fv) glad_glVertexAttrib2fv = glad_next_glVertexAttrib2fv;
+	if (glad_glVertexAttrib2s == glad_instrument_glVertexAttrib2s) glad_glVertexAttrib2s = glad_next_glVertexAttrib2s;
+	if (glad_glVertexAttrib2sv == glad_instrument_glVertexAttrib2sv) glad_glVertexAttrib2sv = glad_next_glVertexAttrib2sv;
+	if (glad_glVertexAttrib3d == glad_instrument_glVertexAttrib3d) glad_glVertexAttrib3d = glad_next_glVertexAttrib3d;
+	if (glad_glVertexAttrib3dv == glad_instrument_glVertexAttrib3dv) glad_glVertexAttrib3dv = glad_next_glVertexAttrib3dv;
+	if (glad_glVertexAttrib3f == glad_instrument_glVertexAttrib3f) glad_glVertexAttrib3f = glad_next_glVertexAttrib3f;
+	if (glad_glVertexAttrib3fv == glad_instrument_glVertexAttrib3fv) glad_glVertexAttrib3fv = glad_next_glVertexAttrib3fv;
+	if (glad_glVertexAttrib3s == glad_instrument_glVertexAttrib3s) glad_glVertexAttrib3s = glad_next_glVertexAttrib3s;
+	if (glad_glVertexAttrib3sv == glad_instrument_glVertexAttrib3sv) glad_glVertexAttrib3sv = glad_next_glVertexAttrib3sv;
+	if (glad_glVertexAttrib4Nbv == glad_instrument_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv = glad_next_glVertexAttrib4Nbv;
+	if (glad_glVertexAttrib4Niv == glad_instrument_glVertexAttrib4Niv) glad_glVertexAttrib4Niv = glad_next_glVertexAttrib4Niv;
+	if (glad_glVertexAttrib4Nsv == glad_instrument_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv = glad_next_glVertexAttrib4Nsv;
+	if (glad_glVertexAttrib4Nub == glad_instrument_glVertexAttrib4Nub) glad_glVertexAttrib4Nub = glad_next_glVertexAttrib4Nub;
+	if (glad_glVertexAttrib4Nubv == glad_instrument_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv = glad_next_glVertexAttrib4Nubv;
+	if (glad_glVertexAttrib4Nuiv == glad_instrument_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv = glad_next_glVertexAttrib4Nuiv;
+	if (glad_glVertexAttrib4Nusv == glad_instrument_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv = glad_next_glVertexAttrib4Nusv;
+	if (glad_glVertexAttrib4bv == glad_instrument_glVertexAttrib4bv) glad_glVertexAttrib4bv = glad_next_glVertexAttrib4bv;
+	if (glad_glVertexAttrib4d == glad_instrument_glVertexAttrib4d) glad_glVertexAttrib4d = glad_next_glVertexAttrib4d;
+	if (glad_glVertexAttrib4dv == glad_instrument_glVertexAttrib4dv) glad_glVertexAttrib4dv = glad_next_glVertexAttrib4dv;
+	if (glad_glVertexAttrib4f == glad_instrument_glVertexAttrib4f) glad_glVertexAttrib4f = glad_next_glVertexAttrib4f;
+	if (glad_glVertexAttrib4fv == glad_instrument_glVertexAttrib4fv) glad_glVertexAttrib4fv = glad_next_glVertexAttrib4fv;
+	if (glad_glVertexAttrib4iv == glad_instrument_glVertexAttrib4iv) glad_glVertexAttrib4iv = glad_next_glVertexAttrib4iv;
+	if (glad_glVertexAttrib4s == glad_instrument_glVertexAttrib4s) glad_glVertexAttrib4s = glad_next_glVertexAttrib4s;
+	if (glad_glVertexAttrib4sv == glad_instrument_glVertexAttrib4sv) glad_glVertexAttrib4sv = glad_next_glVertexAttrib4sv;
+	if (glad_glVertexAttrib4ubv == glad_instrument_glVertexAttrib4ubv) glad_glVertexAttrib4ubv = glad_next_glVertexAttrib4ubv;
+	if (glad_glVertexAttrib4uiv == glad_instrument_glVertexAttrib4uiv) glad_glVertexAttrib4uiv = glad_next_glVertexAttrib4uiv;
+	if (glad_glVertexAttrib4usv == glad_instrument_glVertexAttrib4usv) glad_glVertexAttrib4usv = glad_next_glVertexAttrib4usv;
+	if (glad_glVertexAttribPointer == glad_instrument_glVertexAttribPointer) glad_glVertexAttribPointer = glad_next_glVertexAttribPointer;
+	if (glad_glUniformMatrix2x3fv == glad_instrument_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv = glad_next_glUniformMatrix2x3fv;
+	if (glad_glUniformMatrix3x2fv == glad_instrument_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv = glad_next_glUniformMatrix3x2fv;
+	if (glad_glUniformMatrix2x4fv == glad_instrument_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv = glad_next_glUniformMatrix2x4fv;
+	if (glad_glUniformMatrix4x2fv == glad_instrument_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv = glad_next_glUniformMatrix4x2fv;
+	if (glad_glUniformMatrix3x4fv == glad_instrument_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv = glad_next_glUniformMatrix3x4fv;
+	if (glad_glUniformMatrix4x3fv == glad_instrument_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv = glad_next_glUniformMatrix4x3fv;
+	if (glad_glColorMaski == glad_instrument_glColorMaski) glad_glColorMaski = glad_next_glColorMaski;
+	if (glad_glGetBooleani_v == glad_instrument_glGetBooleani_v) glad_glGetBooleani_v = glad_next_glGetBooleani_v;
+	if (glad_glGetIntegeri_v == glad_instrument_glGetIntegeri_v) glad_glGetIntegeri_v = glad_next_glGetIntegeri_v;
+	if (glad_glEnablei == glad_instrument_glEnablei) glad_glEnablei = glad_next_glEnablei;
+	if (glad_glDisablei == glad_instrument_glDisablei) glad_glDisablei = glad_next_glDisablei;
+	if (glad_glIsEnabledi == glad_instrument_glIsEnabledi) glad_glIsEnabledi = glad_next_glIsEnabledi;
+	if (glad_glBeginTransformFeedback == glad_instrument_glBeginTransformFeedback) glad_glBeginTransformFeedback = glad_next_glBeginTransformFeedback;
+	if (glad_glEndTransformFeedback == glad_instrument_glEndTransformFeedback) glad_glEndTransformFeedback = glad_next_glEndTransformFeedback;
+	if (glad_glBindBufferRange == glad_instrument_glBindBufferRange) glad_glBindBufferRange = glad_next_glBindBufferRange;
+	if (glad_glBindBufferBase == glad_instrument_glBindBufferBase) glad_glBindBufferBase = glad_next_glBindBufferBase;
+	if (glad_glTransformFeedbackVaryings == glad_instrument_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings = glad_next_glTransformFeedbackVaryings;
+	if (glad_glGetTransformFeedbackVarying == glad_instrument_glGetTransformFeedbackVarying) glad_glGetTransformFeedbackVarying = glad_next_glGetTransformFeedbackVarying;
+	if (glad_glClampColor == glad_instrument_glClampColor) glad_glClampColor = glad_next_glClampColor;
+	if (glad_glBeginConditionalRender == glad_instrument_glBeginConditionalRender) glad_glBeginConditionalRender = glad_next_glBeginConditionalRender;
+	if (glad_glEndConditionalRender == glad_instrument_glEndConditionalRender) glad_glEndConditionalRender = glad_next_glEndConditionalRender;
+	if (glad_glVertexAttribIPointer == glad_instrument_glVertexAttribIPointer) glad_glVertexAttribIPointer = glad_next_glVertexAttribIPointer;
+	if (glad_glGetVertexAttribIiv == glad_instrument_glGetVertexAttribIiv) glad_glGetVertexAttribIiv = glad_next_glGetVertexAttribIiv;
+	if (glad_glGetVertexAttribIuiv == glad_instrument_glGetVertexAttribIuiv) glad_glGetVertexAttribIuiv = glad_next_glGetVertexAttribIuiv;
+	if (glad_glVertexAttribI1i == glad_instrument_glVertexAttribI1i) glad_glVertexAttribI1i = glad_next_glVertexAttribI1i;
+	if (glad_glVertexAttribI2i == glad_instrument_glVertexAttribI2i) glad_glVertexAttribI2i = glad_next_glVertexAttribI2i;
+	if (glad_glVertexAttribI3i == glad_instrument_glVertexAttribI3i) glad_glVertexAttribI3i = glad_next_glVertexAttribI3i;
+	if (glad_glVertexAttribI4i == glad_instrument_glVertexAttribI4i) glad_glVertexAttribI4i = glad_next_glVertexAttribI4i;
+	if (glad_glVertexAttribI1ui == glad_instrument_glVertexAttribI1ui) glad_glVertexAttribI1ui = glad_next_glVertexAttribI1ui;
+	if (glad_glVertexAttribI2ui == glad_instrument_glVertexAttribI2ui) glad_glVertexAttribI2ui = glad_next_glVertexAttribI2ui;
+	if (glad_glVertexAttribI3ui == glad_instrument_glVertexAttribI3ui) glad_glVertexAttribI3ui = glad_next_glVertexAttribI3ui;
+	if (glad_glVertexAttribI4ui == glad_instrument_glVertexAttribI4ui) glad_glVertexAttribI4ui = glad_next_glVertexAttribI4ui;
+	if (glad_glVertexAttribI1iv == glad_instrument_glVertexAttribI1iv) glad_glVertexAttribI1iv = glad_next_glVertexAttribI1iv;
+	if (glad_glVertexAttribI2iv == glad_instrument_glVertexAttribI2iv) glad_glVertexAttribI2iv = glad_next_glVertexAttribI2iv;
+	if (glad_glVertexAttribI3iv == glad_instrument_glVertexAttribI3iv) glad_glVertexAttribI3iv = glad_next_glVertexAttribI3iv;
+	if (glad_glVertexAttribI4iv == glad_instrument_glVertexAttribI4iv) glad_glVertexAttribI4iv = glad_next_glVertexAttribI4iv;
+	if (glad_glVertexAttribI1uiv == glad_instrument_glVertexAttribI1uiv) glad_glVertexAttribI1uiv = glad_next_glVertexAttribI1uiv;
+	if (glad_glVertexAttribI2uiv == glad_instrument_glVertexAttribI2uiv) glad_glVertexAttribI2uiv = glad_next_glVertexAttribI2uiv;
+	if (glad_glVertexAttribI3uiv == glad_instrument_glVertexAttribI3uiv) glad_glVertexAttribI3uiv = glad_next_glVertexAttribI3uiv;
+	if (glad_glVertexAttribI4uiv == glad_instrument_glVertexAttribI4uiv) glad_glVertexAttribI4uiv = glad_next_glVertexAttribI4uiv;
+	if (glad_glVertexAttribI4bv == glad_instrument_glVertexAttribI4bv) glad_glVertexAttribI4bv = glad_next_glVertexAttribI4bv;
+	if (glad_glVertexAttribI4sv == glad_instrument_glVertexAttribI4sv) glad_glVertexAttribI4sv = glad_next_glVertexAttribI4sv;
+	if (glad_glVertexAttribI4ubv == glad_instrument_glVertexAttribI4ubv) glad_glVertexAttribI4ubv = glad_next_glVertexAttribI4ubv;
+	if (glad_glVertexAttribI4usv == glad_instrument_glVertexAttribI4usv) glad_glVertexAttribI4usv = glad_next_glVertexAttribI4usv;
+	if (glad_glGetUniformuiv == glad_instrument_glGetUniformuiv) glad_glGetUniformuiv = glad_next_glGetUniformuiv;
+	if (glad_glBindFragDataLocation == glad_instrument_glBindFragDataLocation) glad_glBindFragDataLocation = glad_next_glBindFragDataLocation;
+	if (glad_glGetFragDataLocation == glad_instrument_glGetFragDataLocation) glad_glGetFragDataLocation = glad_next_glGetFragDataLocation;
+	if (glad_glUniform1ui == glad_instrument_glUniform1ui) glad_glUniform1ui = glad_next_glUniform1ui;
+	if (glad_glUniform2ui == glad_instrument_glUniform2ui) glad_glUniform2ui = glad_next_glUniform2ui;
+	if (glad_glUniform3ui == glad_instrument_glUniform3ui) glad_glUniform3ui = glad_next_glUniform3ui;
+	if (glad_glUniform4ui == glad_instrument_glUniform4ui) glad_glUniform4ui = glad_next_glUniform4ui;
+	if (glad_glUniform1uiv == glad_instrument_glUniform1uiv) glad_glUniform1uiv = glad_next_glUniform1uiv;
+	if (glad_glUniform2uiv == glad_instrument_glUniform2uiv) glad_glUniform2uiv = glad_next_glUniform2uiv;
+	if (glad_glUniform3uiv == glad_instrument_glUniform3uiv) glad_glUniform3uiv = glad_next_glUniform3uiv;
+	if (glad_glUniform4uiv == glad_instrument_glUniform4uiv) glad_glUniform4uiv = glad_next_glUniform4uiv;
+	if (glad_glTexParameterIiv == glad_instrument_glTexParameterIiv) glad_glTexParameterIiv = glad_next_glTexParameterIiv;
+	if (glad_glTexParameterIuiv == glad_instrument_glTexParameterIuiv) glad_glTexParameterIuiv = glad_next_glTexParameterIuiv;
+	if (glad_glGetTexParameterIiv == glad_instrument_glGetTexParameterIiv) glad_glGetTexParameterIiv = glad_next_glGetTexParameterIiv;
+	if (glad_glGetTexParameterIuiv == glad_instrument_glGetTexParameterIuiv) glad_glGetTexParameterIuiv = glad_next_glGetTexParameterIuiv;
+	if (glad_glClearBufferiv == glad_instrument_glClearBufferiv) glad_glClearBufferiv = glad_next_glClearBufferiv;
+	if (glad_glClearBufferuiv == glad_instrument_glClearBufferuiv) glad_glClearBufferuiv = glad_next_glClearBufferuiv;
+	if (glad_glClearBufferfv == glad_instrument_glClearBufferfv) glad_glClearBufferfv = glad_next_glClearBufferfv;
+	if (glad_glClearBufferfi == glad_instrument_glClearBufferfi) glad_glClearBufferfi = glad_next_glClearBufferfi;
+	if (glad_glGetStringi == glad_instrument_glGetStringi) glad_glGetStringi = glad_next_glGetStringi;
+	if (glad_glIsRenderbuffer == glad_instrument_glIsRenderbuffer) glad_glIsRenderbuffer = glad_next_glIsRenderbuffer;
+	if (glad_glBindRenderbuffer == glad_instrument_glBindRenderbuffer) glad_glBindRenderbuffer = glad_next_glBindRenderbuffer;
+	if (glad_glDeleteRenderbuffers == glad_instrument_glDeleteRenderbuffers) glad_glDeleteRenderbuffers = glad_next_glDeleteRenderbuffers;
+	if (glad_glGenRenderbuffers == glad_instrument_glGenRenderbuffers) glad_glGenRenderbuffers = glad_next_glGenRenderbuffers;
+	if (glad_glRenderbufferStorage == glad_instrument_glRenderbufferStorage) glad_glRenderbufferStorage = glad_next_glRenderbufferStorage;
+	if (glad_glGetRenderbufferParameteriv == glad_instrument_glGetRenderbufferParameteriv) glad_glGetRenderbufferParameteriv = glad_next_glGetRenderbufferParameteriv;
+	if (glad_glIsFramebuffer == glad_instrument_glIsFramebuffer) glad_glIsFramebuffer = glad_next_glIsFramebuffer;
+	if (glad_glBindFramebuffer == glad_instrument_glBindFramebuffer) glad_glBindFramebuffer = glad_next_glBindFramebuffer;
+	if (glad_glDeleteFramebuffers == glad_instrument_glDeleteFramebuffers) glad_glDeleteFramebuffers = glad_next_glDeleteFramebuffers;
+	if (glad_glGenFramebuffers == glad_instrument_glGenFramebuffers) glad_glGenFramebuffers = glad_next_glGenFramebuffers;
+	if (glad_glCheckFramebufferStatus == glad_instrument_glCheckFramebufferStatus) glad_glCheckFramebufferStatus = glad_next_glCheckFramebufferStatus;
+	if (glad_glFramebufferTexture1D == glad_instrument_glFramebufferTexture1D) glad_glFramebufferTexture1D = glad_next_glFramebufferTexture1D;
+	if (glad_glFramebufferTexture2D == glad_instrument_glFramebufferTexture2D) glad_glFramebufferTexture2D = glad_next_glFramebufferTexture2D;
+	if (glad_glFramebufferTexture3D == glad_instrument_glFramebufferTexture3D) glad_glFramebufferTexture3D = glad_next_glFramebufferTexture3D;
+	if (glad_glFramebufferRenderbuffer == glad_instrument_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer = glad_next_glFramebufferRenderbuffer;
+	if (glad_glGetFramebufferAttachmentParameteriv == glad_instrument_glGetFramebufferAttachmentParameteriv) glad_glGetFramebufferAttachmentParameteriv = glad_next_glGetFramebufferAttachmentParameteriv;
+	if (glad_glGenerateMipmap == glad_instrument_glGenerateMipmap) glad_glGenerateMipmap = glad_next_glGenerateMipmap;
+	if (glad_glBlitFramebuffer == glad_instrument_glBlitFramebuffer) glad_glBlitFramebuffer = glad_next_glBlitFramebuffer;
+	if (glad_glRenderbufferStorageMultisample == glad_instrument_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample = glad_next_glRenderbufferStorageMultisample;
+	if (glad_glFramebufferTextureLayer == glad_instrument_glFramebufferTextureLayer) glad_glFramebufferTextureLayer = glad_next_glFramebufferTextureLayer;
+	if (glad_glMapBufferRange == glad_instrument_glMapBufferRange) glad_glMapBufferRange = glad_next_glMapBufferRange;
+	if (glad_glFlushMappedBufferRange == glad_instrument_glFlushMappedBufferRange) glad_glFlushMappedBufferRange = glad_next_glFlushMappedBufferRange;
+	if (glad_glBindVertexArray == glad_instrument_glBindVertexArray) glad_glBindVertexArray = glad_next_glBindVertexArray;
+	if (glad_glDeleteVertexArrays == glad_instrument_glDeleteVertexArrays) glad_glDeleteVertexArrays = glad_next_glDeleteVertexArrays;
+	if (glad_glGenVertexArrays == glad_instrument_glGenVertexArrays) glad_glGenVertexArrays = glad_next_glGenVertexArrays;
+	if (glad_glIsVertexArray == glad_instrument_glIsVertexArray) glad_glIsVertexArray = glad_next_glIsVertexArray;
+	if (glad_glDrawArraysInstanced == glad_instrument_glDrawArraysInstanced) glad_glDrawArraysInstanced = glad_next_glDrawArraysInstanced;
+	if (glad_glDrawElementsInstanced == glad_instrument_glDrawElementsInstanced) glad_glDrawElementsInstanced = glad_next_glDrawElementsInstanced;
+	if (glad_glTexBuffer == glad_instrument_glTexBuffer) glad_glTexBuffer = glad_next_glTexBuffer;
+	if (glad_glPrimitiveRestartIndex == glad_instrument_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex = glad_next_glPrimitiveRestartIndex;
+	if (glad_glCopyBufferSubData == glad_instrument_glCopyBufferSubData) glad_glCopyBufferSubData = glad_next_glCopyBufferSubData;
+	if (glad_glGetUniformIndices == glad_instrument_glGetUniformIndices) glad_glGetUniformIndices = glad_next_glGetUniformIndices;
+	if (glad_glGetActiveUniformsiv == glad_instrument_glGetActiveUniformsiv) glad_glGetActiveUniformsiv = glad_next_glGetActiveUniformsiv;
+	if (glad_glGetActiveUniformName == glad_instrument_glGetActiveUniformName) glad_glGetActiveUniformName = glad_next_glGetActiveUniformName;
+	if (glad_glGetUniformBlockIndex == glad_instrument_glGetUniformBlockIndex) glad_glGetUniformBlockIndex = glad_next_glGetUniformBlockIndex;
+	if (glad_glGetActiveUniformBlockiv == glad_instrument_glGetActiveUniformBlockiv) glad_glGetActiveUniformBlockiv = glad_next_glGetActiveUniformBlockiv;
+	if (glad_glGetActiveUniformBlockName == glad_instrument_glGetActiveUniformBlockName) glad_glGetActiveUniformBlockName = glad_next_glGetActiveUniformBlockName;
+	if (glad_glUniformBlockBinding == glad_instrument_glUniformBlockBinding) glad_glUniformBlockBinding = glad_next_glUniformBlockBinding;
+	if (glad_glDrawElementsBaseVertex == glad_instrument_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex = glad_next_glDrawElementsBaseVertex;
+	if (glad_glDrawRangeElementsBaseVertex == glad_instrument_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex = glad_next_glDrawRangeElementsBaseVertex;
+	if (glad_glDrawElementsInstancedBaseVertex == glad_instrument_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex = glad_next_glDrawElementsInstancedBaseVertex;
+	if (glad_glMultiDrawElementsBaseVertex == glad_instrument_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex = glad_next_glMultiDrawElementsBaseVertex;
+	if (glad_glProvokingVertex == glad_instrument_glProvokingVertex) glad_glProvokingVertex = glad_next_glProvokingVertex;
+	if (glad_glFenceSync == glad_instrument_glFenceSync) glad_glFenceSync = glad_next_glFenceSync;
+	if (glad_glIsSync == glad_instrument_glIsSync) glad_glIsSync = glad_next_glIsSync;
+	if (glad_glDeleteSync == glad_instrument_glDeleteSync) glad_glDeleteSync = glad_next_glDeleteSync;
+	if (glad_glClientWaitSync == glad_instrument_glClientWaitSync) glad_glClientWaitSync = glad_next_glClientWaitSync;
+	if (glad_glWaitSync == glad_instrument_glWaitSync) glad_glWaitSync = glad_next_glWaitSync;
+	if (glad_glGetInteger64v == glad_instrument_glGetInteger64v) glad_glGetInteger64v = glad_next_glGetInteger64v;
+	if (glad_glGetSynciv == glad_instrument_glGetSynciv) glad_glGetSynciv = glad_next_glGetSynciv;
+	if (glad_glGetInteger64i_v == glad_instrument_glGetInteger64i_v) glad_glGetInteger64i_v = glad_next_glGetInteger64i_v;
+	if (glad_glGetBufferParameteri64v == glad_instrument_glGetBufferParameteri64v) glad_glGetBufferParameteri64v = glad_next_glGetBufferParameteri64v;
+	if (glad_glFramebufferTexture == glad_instrument_glFramebufferTexture) glad_glFramebufferTexture = glad_next_glFramebufferTexture;
+	if (glad_glTexImage2DMultisample == glad_instrument_glTexImage2DMultisample) glad_glTexImage2DMultisample = glad_next_glTexImage2DMultisample;
+	if (glad_glTexImage3DMultisample == glad_instrument_glTexImage3DMultisample) glad_glTexImage3DMultisample = glad_next_glTexImage3DMultisample;
+	if (glad_glGetMultisamplefv == glad_instrument_glGetMultisamplefv) glad_glGetMultisamplefv = glad_next_glGetMultisamplefv;
+	if (glad_glSampleMaski == glad_instrument_glSampleMaski) glad_glSampleMaski = glad_next_glSampleMaski;
+	if (glad_glBindFragDataLocationIndexed == glad_instrument_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed = glad_next_glBindFragDataLocationIndexed;
+	if (glad_glGetFragDataIndex == glad_instrument_glGetFragDataIndex) glad_glGetFragDataIndex = glad_next_glGetFragDataIndex;
+	if (glad_glGenSamplers == glad_instrument_glGenSamplers) glad_glGenSamplers = glad_next_glGenSamplers;
+	if (glad_glDeleteSamplers == glad_instrument_glDeleteSamplers) glad_glDeleteSamplers = glad_next_glDeleteSamplers;
+	if (glad_glIsSampler == glad_instrument_glIsSampler) glad_glIsSampler = glad_next_glIsSampler;
+	if (glad_glBindSampler == glad_instrument_glBindSampler) glad_glBindSampler = glad_next_glBindSampler;
+	if (glad_glSamplerParameteri == glad_instrument_glSamplerParameteri) glad_glSamplerParameteri = glad_next_glSamplerParameteri;
+	if (glad_glSamplerParameteriv == glad_instrument_glSamplerParameteriv) glad_glSamplerParameteriv = glad_next_glSamplerParameteriv;
+	if (glad_glSamplerParameterf == glad_instrument_glSamplerParameterf) glad_glSamplerParameterf = glad_next_glSamplerParameterf;
+	if (glad_glSamplerParameterfv == glad_instrument_glSamplerParameterfv) glad_glSamplerParameterfv = glad_next_glSamplerParameterfv;
+	if (glad_glSamplerParameterIiv == glad_instrument_glSamplerParameterIiv) glad_glSamplerParameterIiv = glad_next_glSamplerParameterIiv;
+	if (glad_glSamplerParameterIuiv == glad_instrument_glSamplerParameterIuiv) glad_glSamplerParameterIuiv = glad_next_glSamplerParameterIuiv;
+	if (glad_glGetSamplerParameteriv == glad_instrument_glGetSamplerParameteriv) glad_glGetSamplerParameteriv = glad_next_glGetSamplerParameteriv;
+	if (glad_glGetSamplerParameterIiv == glad_instrument_glGetSamplerParameterIiv) glad_glGetSamplerParameterIiv = glad_next_glGetSamplerParameterIiv;
+	if (glad_glGetSamplerParameterfv == glad_instrument_glGetSamplerParameterfv) glad_glGetSamplerParameterfv = glad_next_glGetSamplerParameterfv;
+	if (glad_glGetSamplerParameterIuiv == glad_instrument_glGetSamplerParameterIuiv) glad_glGetSamplerParameterIuiv = glad_next_glGetSamplerParameterIuiv;
+	if (glad_glQueryCounter == glad_instrument_glQueryCounter) glad_glQueryCounter = glad_next_glQueryCounter;
+	if (glad_glGetQueryObjecti64v == glad_instrument_glGetQueryObjecti64v) glad_glGetQueryObjecti64v = glad_next_glGetQueryObjecti64v;
+	if (glad_glGetQueryObjectui64v == glad_instrument_glGetQueryObjectui64v) glad_glGetQueryObjectui64v = glad_next_glGetQueryObjectui64v;
+	if (glad_glVertexAttribDivisor == glad_instrument_glVertexAttribDivisor) glad_glVertexAttribDivisor = glad_next_glVertexAttribDivisor;
+	if (glad_glVertexAttribP1ui == glad_instrument_glVertexAttribP1ui) glad_glVertexAttribP1ui = glad_next_glVertexAttribP1ui;
+	if (glad_glVertexAttribP1uiv == glad_instrument_glVertexAttribP1uiv) glad_glVertexAttribP1uiv = glad_next_glVertexAttribP1uiv;
+	if (glad_glVertexAttribP2ui == glad_instrument_glVertexAttribP2ui) glad_glVertexAttribP2ui = glad_next_glVertexAttribP2ui;
+	if (glad_glVertexAttribP2uiv == glad_instrument_glVertexAttribP2uiv) glad_glVertexAttribP2uiv = glad_next_glVertexAttribP2uiv;
+	if (glad_glVertexAttribP3ui == glad_instrument_glVertexAttribP3ui) glad_glVertexAttribP3ui = glad_next_glVertexAttribP3ui;
+	if (glad_glVertexAttribP3uiv == glad_instrument_glVertexAttribP3uiv) glad_glVertexAttribP3uiv = glad_next_glVertexAttribP3uiv;
+	if (glad_glVertexAttribP4ui == glad_instrument_glVertexAttribP4ui) glad_glVertexAttribP4ui = glad_next_glVertexAttribP4ui;
+	if (glad_glVertexAttribP4uiv == glad_instrument_glVertexAttribP4uiv) glad_glVertexAttribP4uiv = glad_next_glVertexAttribP4uiv;
+	if (glad_glVertexP2ui == glad_instrument_glVertexP2ui) glad_glVertexP2ui = glad_next_glVertexP2ui;
+	if (glad_glVertexP2uiv == glad_instrument_glVertexP2uiv) glad_glVertexP2uiv = glad_next_glVertexP2uiv;
+	if (glad_glVertexP3ui == glad_instrument_glVertexP3ui) glad_glVertexP3ui = glad_next_glVertexP3ui;
+	if (glad_glVertexP3uiv == glad_instrument_glVertexP3uiv) glad_glVertexP3uiv = glad_next_glVertexP3uiv;
+	if (glad_glVertexP4ui == glad_instrument_glVertexP4ui) glad_glVertexP4ui = glad_next_glVertexP4ui;
+	if (glad_glVertexP4uiv == glad_instrument_glVertexP4uiv) glad_glVertexP4uiv = glad_next_glVertexP4uiv;
+	if (glad_glTexCoordP1ui == glad_instrument_glTexCoordP1ui) glad_glTexCoordP1ui = glad_next_glTexCoordP1ui;
+	if (glad_glTexCoordP1uiv == glad_instrument_glTexCoordP1uiv) glad_glTexCoordP1uiv = glad_next_glTexCoordP1uiv;
+	if (glad_glTexCoordP2ui == glad_instrument_glTexCoordP2ui) glad_glTexCoordP2ui = glad_next_glTexCoordP2ui;
+	if (glad_glTexCoordP2uiv == glad_instrument_glTexCoordP2uiv) glad_glTexCoordP2uiv = glad_next_glTexCoordP2uiv;
+	if (glad_glTexCoordP3ui == glad_instrument_glTexCoordP3ui) glad_glTexCoordP3ui = glad_next_glTexCoordP3ui;
+	if (glad_glTexCoordP3uiv == glad_instrument_glTexCoordP3uiv) glad_glTexCoordP3uiv = glad_next_glTexCoordP3uiv;
+	if (glad_glTexCoordP4ui == glad_instrument_glTexCoordP4ui) glad_glTexCoordP4ui = glad_next_glTexCoordP4ui;
+	if (glad_glTexCoordP4uiv == glad_instrument_glTexCoordP4uiv) glad_glTexCoordP4uiv = glad_next_glTexCoordP4uiv;
+	if (glad_glMultiTexCoordP1ui == glad_instrument_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui = glad_next_glMultiTexCoordP1ui;
+	if (glad_glMultiTexCoordP1uiv == glad_instrument_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv = glad_next_glMultiTexCoordP1uiv;
+	if (glad_glMultiTexCoordP2ui == glad_instrument_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui = glad_next_glMultiTexCoordP2ui;
+	if (glad_glMultiTexCoordP2uiv == glad_instrument_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv = glad_next_glMultiTexCoordP2uiv;
+	if (glad_glMultiTexCoordP3ui == glad_instrument_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui = glad_next_glMultiTexCoordP3ui;
+	if (glad_glMultiTexCoordP3uiv == glad_instrument_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv = glad_next_glMultiTexCoordP3uiv;
+	if (glad_glMultiTexCoordP4ui == glad_instrument_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui = glad_next_glMultiTexCoordP4ui;
+	if (glad_glMultiTexCoordP4uiv == glad_instrument_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv = glad_next_glMultiTexCoordP4uiv;
+	if (glad_glNormalP3ui == glad_instrument_glNormalP3ui) glad_glNormalP3ui = glad_next_glNormalP3ui;
+	if (glad_glNormalP3uiv == glad_instrument_glNormalP3uiv) glad_glNormalP3uiv = glad_next_glNormalP3uiv;
+	if (glad_glColorP3ui == glad_instrument_glColorP3ui) glad_glColorP3ui = glad_next_glColorP3ui;
+	if (glad_glColorP3uiv == glad_instrument_glColorP3uiv) glad_glColorP3uiv = glad_next_glColorP3uiv;
+	if (glad_glColorP4ui == glad_instrument_glColorP4ui) glad_glColorP4ui = glad_next_glColorP4ui;
+	if (glad_glColorP4uiv == glad_instrument_glColorP4uiv) glad_glColorP4uiv = glad_next_glColorP4uiv;
+	if (glad_glSecondaryColorP3ui == glad_instrument_glSecondaryColorP3ui) glad_glSecondaryColorP3ui = glad_next_glSecondaryColorP3ui;
+	if (glad_glSecondaryColorP3uiv == glad_instrument_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv = glad_next_glSecondaryColorP3uiv;
+	if (glad_glMinSampleShading == glad_instrument_glMinSampleShading) glad_glMinSampleShading = glad_next_glMinSampleShading;
+	if (glad_glBlendEquationi == glad_instrument_glBlendEquationi) glad_glBlendEquationi = glad_next_glBlendEquationi;
+	if (glad_glBlendEquationSeparatei == glad_instrument_glBlendEquationSeparatei) glad_glBlendEquationSeparatei = glad_next_glBlendEquationSeparatei;
+	if (glad_glBlendFunci == glad_instrument_glBlendFunci) glad_glBlendFunci = glad_next_glBlendFunci;
+	if (glad_glBlendFuncSeparatei == glad_instrument_glBlendFuncSeparatei) glad_glBlendFuncSeparatei = glad_next_glBlendFuncSeparatei;
+	if (glad_glDrawArraysIndirect == glad_instrument_glDrawArraysIndirect) glad_glDrawArraysIndirect = glad_next_glDrawArraysIndirect;
+	if (glad_glDrawElementsIndirect == glad_instrument_glDrawElementsIndirect) glad_glDrawElementsIndirect = glad_next_glDrawElementsIndirect;
+	if (glad_glUniform1d == glad_instrument_glUniform1d) glad_glUniform1d = glad_next_glUniform1d;
+	if (glad_glUniform2d == glad_instrument_glUniform2d) glad_glUniform2d = glad_next_glUniform2d;
+	if (glad_glUniform3d == glad_instrument_glUniform3d) glad_glUniform3d = glad_next_glUniform3d;
+	if (glad_glUniform4d == glad_instrument_glUniform4d) glad_glUniform4d = glad_next_glUniform4d;
+	if (glad_glUniform1dv == glad_instrument_glUniform1dv) glad_glUniform1dv = glad_next_glUniform1dv;
+	if (glad_glUniform2dv == glad_instrument_glUniform2dv) glad_glUniform2dv = glad_next_glUniform2dv;
+	if (glad_glUniform3dv == glad_instrument_glUniform3dv) glad_glUniform3dv = glad_next_glUniform3dv;
+	if (glad_glUniform4dv == glad_instrument_glUniform4dv) glad_glUniform4dv = glad_next_glUniform4dv;
+	if (glad_glUniformMatrix2dv == glad_instrument_glUniformMatrix2dv) glad_glUniformMatrix2dv = glad_next_glUniformMatrix2dv;
+	if (glad_glUniformMatrix3dv == glad_instrument_glUniformMatrix3dv) glad_glUniformMatrix3dv = glad_next_glUniformMatrix3dv;
+	if (glad_glUniformMatrix4dv == glad_instrument_glUniformMatrix4dv) glad_glUniformMatrix4dv = glad_next_glUniformMatrix4dv;
+	if (glad_glUniformMatrix2x3dv == glad_instrument_glUniformMatrix2x3dv) glad_glUniformMatrix2x3dv = glad_next_glUniformMatrix2x3dv;
+	if (glad_glUniformMatrix2x4dv == glad_instrument_glUniformMatrix2x4dv) glad_glUniformMatrix2x4dv = glad_next_glUniformMatrix2x4dv;
+	if (glad_glUniformMatrix3x2dv == glad_instrument_glUniformMatrix3x2dv) glad_glUniformMatrix3x2dv = glad_next_glUniformMatrix3x2dv;
+	if (glad_glUniformMatrix3x4dv == glad_instrument_glUniformMatrix3x4dv) glad_glUniformMatrix3x4dv = glad_next_glUniformMatrix3x4dv;
+	if (glad_glUniformMatrix4x2dv == glad_instrument_glUniformMatrix4x2dv) glad_glUniformMatrix4x2dv = glad_next_glUniformMatrix4x2dv;
+	if (glad_glUniformMatrix4x3dv == glad_instrument_glUniformMatrix4x3dv) glad_glUniformMatrix4x3dv = glad_next_glUniformMatrix4x3dv;
+	if (glad_glGetUniformdv == glad_instrument_glGetUniformdv) glad_glGetUniformdv = glad_next_glGetUniformdv;
+	if (glad_glGetSubroutineUniformLocation == glad_instrument_glGetSubroutineUniformLocation) glad_glGetSubroutineUniformLocation = glad_next_glGetSubroutineUniformLocation;
+	if (glad_glGetSubroutineIndex == glad_instrument_glGetSubroutineIndex) glad_glGetSubroutineIndex = glad_next_glGetSubroutineIndex;
+	if (glad_glGetActiveSubroutineUniformiv == glad_instrument_glGetActiveSubroutineUniformiv) glad_glGetActiveSubroutineUniformiv = glad_next_glGetActiveSubroutineUniformiv;
+	if (glad_glGetActiveSubroutineUniformName == glad_instrument_glGetActiveSubroutineUniformName) glad_glGetActiveSubroutineUniformName = glad_next_glGetActiveSubroutineUniformName;
+	if (glad_glGetActiveSubroutineName == glad_instrument_glGetActiveSubroutineName) glad_glGetActiveSubroutineName = glad_next_glGetActiveSubroutineName;
+	if (glad_glUniformSubroutinesuiv == glad_instrument_glUniformSubroutinesuiv) glad_glUniformSubroutinesuiv = glad_next_glUniformSubroutinesuiv;
+	if (glad_glGetUniformSubroutineuiv == glad_instrument_glGetUniformSubroutineuiv) glad_glGetUniformSubroutineuiv = glad_next_glGetUniformSubroutineuiv;
+	if (glad_glGetProgramStageiv == glad_instrument_glGetProgramStageiv) glad_glGetProgramStageiv = glad_next_glGetProgramStageiv;
+	if (glad_glPatchParameteri == glad_instrument_glPatchParameteri) glad_glPatchParameteri = glad_next_glPatchParameteri;
+	if (glad_glPatchParameterfv == glad_instrument_glPatchParameterfv) glad_glPatchParameterfv = glad_next_glPatchParameterfv;
+	if (glad_glBindTransformFeedback == glad_instrument_glBindTransformFeedback) glad_glBindTransformFeedback = glad_next_glBindTransformFeedback;
+	if (glad_glDeleteTransformFeedbacks == glad_instrument_glDeleteTransformFeedbacks) glad_glDeleteTransformFeedbacks = glad_next_glDeleteTransformFeedbacks;
+	if (glad_glGenTransformFeedbacks == glad_instrument_glGenTransformFeedbacks) glad_glGenTransformFeedbacks = glad_next_glGenTransformFeedbacks;
+	if (glad_glIsTransformFeedback == glad_instrument_glIsTransformFeedback) glad_glIsTransformFeedback = glad_next_glIsTransformFeedback;
+	if (glad_glPauseTransformFeedback == glad_instrument_glPauseTransformFeedback) glad_glPauseTransformFeedback = glad_next_glPauseTransformFeedback;
+	if (glad_glResumeTransformFeedback == glad_instrument_glResumeTransformFeedback) glad_glResumeTransformFeedback = glad_next_glResumeTransformFeedback;
+	if (glad_glDrawTransformFeedback == glad_instrument_glDrawTransformFeedback) glad_glDrawTransformFeedback = glad_next_glDrawTransformFeedback;
+	if (glad_glDrawTransformFeedbackStream == glad_instrument_glDrawTransformFeedbackStream) glad_glDrawTransformFeedbackStream = glad_next_glDrawTransformFeedbackStream;
+	if (glad_glBeginQueryIndexed == glad_instrument_glBeginQueryIndexed) glad_glBeginQueryIndexed = glad_next_glBeginQueryIndexed;
+	if (glad_glEndQueryIndexed == glad_instrument_glEndQueryIndexed) glad_glEndQueryIndexed = glad_next_glEndQueryIndexed;
+	if (glad_glGetQueryIndexediv == glad_instrument_glGetQueryIndexediv) glad_glGetQueryIndexediv = glad_next_glGetQueryIndexediv;
+	if (glad_glReleaseShaderCompiler == glad_instrument_glReleaseShaderCompiler) glad_glReleaseShaderCompiler = glad_next_glReleaseShaderCompiler;
+	if (glad_glShaderBinary == glad_instrument_glShaderBinary) glad_glShaderBinary = glad_next_glShaderBinary;
+	if (glad_glGetShaderPrecisionFormat == glad_instrument_glGetShaderPrecisionFormat) glad_glGetShaderPrecisionFormat = glad_next_glGetShaderPrecisionFormat;
+	if (glad_glDepthRangef == glad_instrument_glDepthRangef) glad_glDepthRangef = glad_next_glDepthRangef;
+	if (glad_glClearDepthf == glad_instrument_glClearDepthf) glad_glClearDepthf = glad_next_glClearDepthf;
+	if (glad_glGetProgramBinary == glad_instrument_glGetProgramBinary) glad_glGetProgramBinary = glad_next_glGetProgramBinary;
+	if (glad_glProgramBinary == glad_instrument_glProgramBinary) glad_glProgramBinary = glad_next_glProgramBinary;
+	if (glad_glProgramParameteri == glad_instrument_glProgramParameteri) glad_glProgramParameteri = glad_next_glProgramParameteri;
+	if (glad_glUseProgramStages == glad_instrument_glUseProgramStages) glad_glUseProgramStages = glad_next_glUseProgramStages;
+	if (glad_glActiveShaderProgram == glad_instrument_glActiveShaderProgram) glad_glActiveShaderProgram = glad_next_glActiveShaderProgram;
+	if (glad_glCreateShaderProgramv == glad_instrument_glCreateShaderProgramv) glad_glCreateShaderProgramv = glad_next_glCreateShaderProgramv;
+	if (glad_glBindProgramPipeline == glad_instrument_glBindProgramPipeline) glad_glBindProgramPipeline = glad_next_glBindProgramPipeline;
+	if (glad_glDeleteProgramPipelines == glad_instrument_glDeleteProgramPipelines) glad_glDeleteProgramPipelines = glad_next_glDeleteProgramPipelines;
+	if (glad_glGenProgramPipelines == glad_instrument_glGenProgramPipelines) glad_glGenProgramPipelines = glad_next_glGenProgramPipelines;
+	if (glad_glIsProgramPipeline == glad_instrument_glIsProgramPipeline) glad_glIsProgramPipeline = glad_next_glIsProgramPipeline;
+	if (glad_glGetProgramPipelineiv == glad_instrument_glGetProgramPipelineiv) glad_glGetProgramPipelineiv = glad_next_glGetProgramPipelineiv;
+	if (glad_glProgramUniform1i == glad_instrument_glProgramUniform1i) glad_glProgramUniform1i = glad_next_glProgramUniform1i;
+	if (glad_glProgramUniform1iv == glad_instrument_glProgramUniform1iv) glad_glProgramUniform1iv = glad_next_glProgramUniform1iv;
+	if (glad_glProgramUniform1f == glad_instrument_glProgramUniform1f) glad_glProgramUniform1f = glad_next_glProgramUniform1f;
+	if (glad_glProgramUniform1fv == glad_instrument_glProgramUniform1fv) glad_glProgramUniform1fv = glad_next_glProgramUniform1fv;
+	if (glad_glProgramUniform1d == glad_instrument_glProgramUniform1d) glad_glProgramUniform1d = glad_next_glProgramUniform1d;
+	if (glad_glProgramUniform1dv == glad_instrument_glProgramUniform1dv) glad_glProgramUniform1dv = glad_next_glProgramUniform1dv;
+	if (glad_glProgramUniform1ui == glad_instrument_glProgramUniform1ui) glad_glProgramUniform1ui = glad_next_glProgramUniform1ui;
+	if (glad_glProgramUniform1uiv == glad_instrument_glProgramUniform1uiv) glad_glProgramUniform1uiv = glad_next_glProgramUniform1uiv;
+	if (glad_glProgramUniform2i == glad_instrument_glProgramUniform2i) glad_glProgramUniform2i = glad_next_glProgramUniform2i;
+	if (glad_glProgramUniform2iv == glad_instrument_glProgramUniform2iv) glad_glProgramUniform2iv = glad_next_glProgramUniform2iv;
+	if (glad_glProgramUniform2f == glad_instrument_glProgramUniform2f) glad_glProgramUniform2f = glad_next_glProgramUniform2f;
+	if (glad_glProgramUniform2fv == glad_instrument_glProgramUniform2fv) glad_glProgramUniform2fv = glad_next_glProgramUniform2fv;
+	if (glad_glProgramUniform2d == glad_instrument_glProgramUniform2d) glad_glProgramUniform2d = glad_next_glProgramUniform2d;
+	if (glad_glProgramUniform2dv == glad_instrument_glProgramUniform2dv) glad_glProgramUniform2dv = glad_next_glProgramUniform2dv;
+	if (glad_glProgramUniform2ui == glad_instrument_glProgramUniform2ui) glad_glProgramUniform2ui = glad_next_glProgramUniform2ui;
+	if (glad_glProgramUniform2uiv == glad_instrument_glProgramUniform2uiv) glad_glProgramUniform2uiv = glad_next_glProgramUniform2uiv;
+	if (glad_glProgramUniform3i == glad_instrument_glProgramUniform3i) glad_glProgramUniform3i = glad_next_glProgramUniform3i;
+	if (glad_glProgramUniform3iv == glad_instrument_glProgramUniform3iv) glad_glProgramUniform3iv = glad_next_glProgramUniform3iv;
+	if (glad_glProgramUniform3f == glad_instrument_glProgramUniform3f) glad_glProgramUniform3f = glad_next_glProgramUniform3f;
+	if (glad_glProgramUniform3fv == glad_instrument_glProgramUniform3fv) glad_glProgramUniform3fv = glad_next_glProgramUniform3fv;
+	if (glad_glProgramUniform3d == glad_instrument_glProgramUniform3d) glad_glProgramUniform3d = glad_next_glProgramUniform3d;
+	if (glad_glProgramUniform3dv == glad_instrument_glProgramUniform3dv) glad_glProgramUniform3dv = glad_next_glProgramUniform3dv;
+	if (glad_glProgramUniform3ui == glad_instrument_glProgramUniform3ui) glad_glProgramUniform3ui = glad_next_glProgramUniform3ui;
+	if (glad_glProgramUniform3uiv == glad_instrument_glProgramUniform3uiv) glad_glProgramUniform3uiv = glad_next_glProgramUniform3uiv;
+	if (glad_glProgramUniform4i == glad_instrument_glProgramUniform4i) glad_glProgramUniform4i = glad_next_glProgramUniform4i;
+	if (glad_glProgramUniform4iv == glad_instrument_glProgramUniform4iv) glad_glProgramUniform4iv = glad_next_glProgramUniform4iv;
+	if (glad_glProgramUniform4f == glad_instrument_glProgramUniform4f) glad_glProgramUniform4f = glad_next_glProgramUniform4f;
+	if (glad_glProgramUniform4fv == glad_instrument_glProgramUniform4fv) glad_glProgramUniform4fv = glad_next_glProgramUniform4fv;
+	if (glad_glProgramUniform4d == glad_instrument_glProgramUniform4d) glad_glProgramUniform4d = glad_next_glProgramUniform4d;
+	if (glad_glProgramUniform4dv == glad_instrument_glProgramUniform4dv) glad_glProgramUniform4dv = glad_next_glProgramUniform4dv;
+	if (glad_glProgramUniform4ui == glad_instrument_glProgramUniform4ui) glad_glProgramUniform4ui = glad_next_glProgramUniform4ui;
+	if (glad_glProgramUniform4uiv == glad_instrument_glProgramUniform4uiv) glad_glProgramUniform4uiv = glad_next_glProgramUniform4uiv;
+	if (glad_glProgramUniformMatrix2fv == glad_instrument_glProgramUniformMatrix2fv) glad_glProgramUniformMatrix2fv = glad_next_glProgramUniformMatrix2fv;
+	if (glad_glProgramUniformMatrix3fv == glad_instrument_glProgramUniformMatrix3fv) glad_glProgramUniformMatrix3fv = glad_next_glProgramUniformMatrix3fv;
+	if (glad_glProgramUniformMatrix4fv == glad_instrument_glProgramUniformMatrix4fv) glad_glProgramUniformMatrix4fv = glad_next_glProgramUniformMatrix4fv;
+	if (glad_glProgramUniformMatrix2dv == glad_instrument_glProgramUniformMatrix2dv) glad_glProgramUniformMatrix2dv = glad_next_glProgramUniformMatrix2dv;
+	if (glad_glProgramUniformMatrix3dv == glad_instrument_glProgramUniformMatrix3dv) glad_glProgramUniformMatrix3dv = glad_next_glProgramUniformMatrix3dv;
+	if (glad_glProgramUniformMatrix4dv == glad_instrument_glProgramUniformMatrix4dv) glad_glProgramUniformMatrix4dv = glad_next_glProgramUniformMatrix4dv;
+	if (glad_glProgramUniformMatrix2x3fv == glad_instrument_glProgramUniformMatrix2x3fv) glad_glProgramUniformMatrix2x3fv = glad_next_glProgramUniformMatrix2x3fv;
+	if (glad_glProgramUniformMatrix3x2fv == glad_instrument_glProgramUniformMatrix3x2fv) glad_glProgramUniformMatrix3x2fv = glad_next_glProgramUniformMatrix3x2fv;
+	if (glad_glProgramUniformMatrix2x4fv == glad_instrument_glProgramUniformMatrix2x4fv) glad_glProgramUniformMatrix2x4fv = glad_next_glProgramUniformMatrix2x4fv;
+	if (glad_glProgramUniformMatrix4x2fv == glad_instrument_glProgramUniformMatrix4x2fv) glad_glProgramUniformMatrix4x2fv = glad_next_glProgramUniformMatrix4x2fv;
+	if (glad_glProgramUniformMatrix3x4fv == glad_instrument_glProgramUniformMatrix3x4fv) glad_glProgramUniformMatrix3x4fv = glad_next_glProgramUniformMatrix3x4fv;
+	if (glad_glProgramUniformMatrix4x3fv == glad_instrument_glProgramUniformMatrix4x3fv) glad_glProgramUniformMatrix4x3fv = glad_next_glProgramUniformMatrix4x3fv;
+	if (glad_glProgramUniformMatrix2x3dv == glad_instrument_glProgramUniformMatrix2x3dv) glad_glProgramUniformMatrix2x3dv = glad_next_glProgramUniformMatrix2x3dv;
+	if (glad_glProgramUniformMatrix3x2dv == glad_instrument_glProgramUniformMatrix3x2dv) glad_glProgramUniformMatrix3x2dv = glad_next_glProgramUniformMatrix3x2dv;
+	if (glad_glProgramUniformMatrix2x4dv == glad_instrument_glProgramUniformMatrix2x4dv) glad_glProgramUniformMatrix2x4dv = glad_next_glProgramUniformMatrix2x4dv;
+	if (glad_glProgramUniformMatrix4x2dv == glad_instrument_glProgramUniformMatrix4x2dv) glad_glProgramUniformMatrix4x2dv = glad_next_glProgramUniformMatrix4x2dv;
+	if (glad_glProgramUniformMatrix3x4dv == glad_instrument_glProgramUniformMatrix3x4dv) glad_glProgramUniformMatrix3x4dv = glad_next_glProgramUniformMatrix3x4dv;
+	if (glad_glProgramUniformMatrix4x3dv == glad_instrument_glProgramUniformMatrix4x3dv) glad_glProgramUniformMatrix4x3dv = glad_next_glProgramUniformMatrix4x3dv;
+	if (glad_glValidateProgramPipeline == glad_instrument_glValidateProgramPipeline) glad_glValidateProgramPipeline = glad_next_glValidateProgramPipeline;
+	if (glad_glGetProgramPipelineInfoLog == glad_instrument_glGetProgramPipelineInfoLog) glad_glGetProgramPipelineInfoLog = glad_next_glGetProgramPipelineInfoLog;
+	if (glad_glVertexAttribL1d == glad_instrument_glVertexAttribL1d) glad_glVertexAttribL1d = glad_next_glVertexAttribL1d;
+	if (glad_glVertexAttribL2d == glad_instrument_glVertexAttribL2d) glad_glVertexAttribL2d = glad_next_glVertexAttribL2d;
+	if (glad_glVertexAttribL3d == glad_instrument_glVertexAttribL3d) glad_glVertexAttribL3d = glad_next_glVertexAttribL3d;
+	if (glad_glVertexAttribL4d == glad_instrument_glVertexAttribL4d) glad_glVertexAttribL4d = glad_next_glVertexAttribL4d;
+	if (glad_glVertexAttribL1dv == glad_instrument_glVertexAttribL1dv) glad_glVertexAttribL1dv = glad_next_glVertexAttribL1dv;
+	if (glad_glVertexAttribL2dv == glad_instrument_glVertexAttribL2dv) glad_glVertexAttribL2dv = glad_next_glVertexAttribL2dv;
+	if (glad_glVertexAttribL3dv == glad_instrument_glVertexAttribL3dv) glad_glVertexAttribL3dv = glad_next_glVertexAttribL3dv;
+	if (glad_glVertexAttribL4dv == glad_instrument_glVertexAttribL4dv) glad_glVertexAttribL4dv = glad_next_glVertexAttribL4dv;
+	if (glad_glVertexAttribLPointer == glad_instrument_glVertexAttribLPointer) glad_glVertexAttribLPointer = glad_next_glVertexAttribLPointer;
+	if (glad_glGetVertexAttribLdv == glad_instrument_glGetVertexAttribLdv) glad_glGetVertexAttribLdv = glad_next_glGetVertexAttribLdv;
+	if (glad_glViewportArrayv == glad_instrument_glViewportArrayv) glad_glViewportArrayv = glad_next_glViewportArrayv;
+	if (glad_glViewportIndexedf == glad_instrument_glViewportIndexedf) glad_glViewportIndexedf = glad_next_glViewportIndexedf;
+	if (glad_glViewportIndexedfv == glad_instrument_glViewportIndexedfv) glad_glViewportIndexedfv = glad_next_glViewportIndexedfv;
+	if (glad_glScissorArrayv == glad_instrument_glScissorArrayv) glad_glScissorArrayv = glad_next_glScissorArrayv;
+	if (glad_glScissorIndexed == glad_instrument_glScissorIndexed) glad_glScissorIndexed = glad_next_glScissorIndexed;
+	if (glad_glScissorIndexedv == glad_instrument_glScissorIndexedv) glad_glScissorIndexedv = glad_next_glScissorIndexedv;
+	if (glad_glDepthRangeArrayv == glad_instrument_glDepthRangeArrayv) glad_glDepthRangeArrayv = glad_next_glDepthRangeArrayv;
+	if (glad_glDepthRangeIndexed == glad_instrument_glDepthRangeIndexed) glad_glDepthRangeIndexed = glad_next_glDepthRangeIndexed;
+	if (glad_glGetFloati_v == glad_instrument_glGetFloati_v) glad_glGetFloati_v = glad_next_glGetFloati_v;
+	if (glad_glGetDoublei_v == glad_instrument_glGetDoublei_v) glad_glGetDoublei_v = glad_next_glGetDoublei_v;
+	if (glad_glDrawArraysInstancedBaseInstance == glad_instrument_glDrawArraysInstancedBaseInstance) glad_glDrawArraysInstancedBaseInstance = glad_next_glDrawArraysInstancedBaseInstance;
+	if (glad_glDrawElementsInstancedBaseInstance == glad_instrument_glDrawElementsInstancedBaseInstance) glad_glDrawElementsInstancedBaseInstance = glad_next_glDrawElementsInstancedBaseInstance;
+	if (glad_glDrawElementsInstancedBaseVertexBaseInstance == glad_instrument_glDrawElementsInstancedBaseVertexBaseInstance) glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_next_glDrawElementsInstancedBaseVertexBaseInstance;
+	if (glad_glGetInternalformativ == glad_instrument_glGetInternalformativ) glad_glGetInternalformativ = glad_next_glGetInternalformativ;
+	if (glad_glGetActiveAtomicCounterBufferiv == glad_instrument_glGetActiveAtomicCounterBufferiv) glad_glGetActiveAtomicCounterBufferiv = glad_next_glGetActiveAtomicCounterBufferiv;
+	if (glad_glBindImageTexture == glad_instrument_glBindImageTexture) glad_glBindImageTexture = glad_next_glBindImageTexture;
+	if (glad_glMemoryBarrier == glad_instrument_glMemoryBarrier) glad_glMemoryBarrier = glad_next_glMemoryBarrier;
+	if (glad_glTexStorage1D == glad_instrument_glTexStorage1D) glad_glTexStorage1D = glad_next_glTexStorage1D;
+	if (glad_glTexStorage2D == glad_instrument_glTexStorage2D) glad_glTexStorage2D = glad_next_glTexStorage2D;
+	if (glad_glTexStorage3D == glad_instrument_glTexStorage3D) glad_glTexStorage3D = glad_next_glTexStorage3D;
+	if (glad_glDrawTransformFeedbackInstanced == glad_instrument_glDrawTransformFeedbackInstanced) glad_glDrawTransformFeedbackInstanced = glad_next_glDrawTransformFeedbackInstanced;
+	if (glad_glDrawTransformFeedbackStreamInstanced == glad_instrument_glDrawTransformFeedbackStreamInstanced) glad_glDrawTransformFeedbackStreamInstanced = glad_next_glDrawTransformFeedbackStreamInstanced;
+	if (glad_glClearBufferData == glad_instrument_glClearBufferData) glad_glClearBufferData = glad_next_glClearBufferData;
+	if (glad_glClearBufferSubData == glad_instrument_glClearBufferSubData) glad_glClearBufferSubData = glad_next_glClearBufferSubData;
+	if (glad_glDispatchCompute == glad_instrument_glDispatchCompute) glad_glDispatchCompute = glad_next_glDispatchCompute;
+	if (glad_glDispatchComputeIndirect == glad_instrument_glDispatchComputeIndirect) glad_glDispatchComputeIndirect = glad_next_glDispatchComputeIndirect;
+	if (glad_glCopyImageSubData == glad_instrument_glCopyImageSubData) glad_glCopyImageSubData = glad_next_glCopyImageSubData;
+	if (glad_glFramebufferParameteri == glad_instrument_glFramebufferParameteri) glad_glFramebufferParameteri = glad_next_glFramebufferParameteri;
+	if (glad_glGetFramebufferParameteriv == glad_instrument_glGetFramebufferParameteriv) glad_glGetFramebufferParameteriv = glad_next_glGetFramebufferParameteriv;
+	if (glad_glGetInternalformati64v == glad_instrument_glGetInternalformati64v) glad_glGetInternalformati64v = glad_next_glGetInternalformati64v;
+	if (glad_glInvalidateTexSubImage == glad_instrument_glInvalidateTexSubImage) glad_glInvalidateTexSubImage = glad_next_glInvalidateTexSubImage;
+	if (glad_glInvalidateTexImage == glad_instrument_glInvalidateTexImage) glad_glInvalidateTexImage = glad_next_glInvalidateTexImage;
+	if (glad_glInvalidateBufferSubData == glad_instrument_glInvalidateBufferSubData) glad_glInvalidateBufferSubData = glad_next_glInvalidateBufferSubData;
+	if (glad_glInvalidateBufferData == glad_instrument_glInvalidateBufferData) glad_glInvalidateBufferData = glad_next_glInvalidateBufferData;
+	if (glad_glInvalidateFramebuffer == glad_instrument_glInvalidateFramebuffer) glad_glInvalidateFramebuffer = glad_next_glInvalidateFramebuffer;
+	if (glad_glInvalidateSubFramebuffer == glad_instrument_glInvalidateSubFramebuffer) glad_glInvalidateSubFramebuffer = glad_next_glInvalidateSubFramebuffer;
+	if (glad_glMultiDrawArraysIndirect == glad_instrument_glMultiDrawArraysIndirect) glad_glMultiDrawArraysIndirect = glad_next_glMultiDrawArraysIndirect;
+	if (glad_glMultiDrawElementsIndirect == glad_instrument_glMultiDrawElementsIndirect) glad_glMultiDrawElementsIndirect = glad_next_glMultiDrawElementsIndirect;
+	if (glad_glGetProgramInterfaceiv == glad_instrument_glGetProgramInterfaceiv) glad_glGetProgramInterfaceiv = glad_next_glGetProgramInterfaceiv;
+	if (glad_glGetProgramResourceIndex == glad_instrument_glGetProgramResourceIndex) glad_glGetProgramResourceIndex = glad_next_glGetProgramResourceIndex;
+	if (glad_glGetProgramResourceName == glad_instrument_glGetProgramResourceName) glad_glGetProgramResourceName = glad_next_glGetProgramResourceName;
+	if (glad_glGetProgramResourceiv == glad_instrument_glGetProgramResourceiv) glad_glGetProgramResourceiv = glad_next_glGetProgramResourceiv;
+	if (glad_glGetProgramResourceLocation == glad_instrument_glGetProgramResourceLocation) glad_glGetProgramResourceLocation = glad_next_glGetProgramResourceLocation;
+	if (glad_glGetProgramResourceLocationIndex == glad_instrument_glGetProgramResourceLocationIndex) glad_glGetProgramResourceLocationIndex = glad_next_glGetProgramResourceLocationIndex;
+	if (glad_glShaderStorageBlockBinding == glad_instrument_glShaderStorageBlockBinding) glad_glShaderStorageBlockBinding = glad_next_glShaderStorageBlockBinding;
+	if (glad_glTexBufferRange == glad_instrument_glTexBufferRange) glad_glTexBufferRange = glad_next_glTexBufferRange;
+	if (glad_glTexStorage2DMultisample == glad_instrument_glTexStorage2DMultisample) glad_glTexStorage2DMultisample = glad_next_glTexStorage2DMultisample;
+	if (glad_glTexStorage3DMultisample == glad_instrument_glTexStorage3DMultisample) glad_glTexStorage3DMultisample = glad_next_glTexStorage3DMultisample;
+	if (glad_glTextureView == glad_instrument_glTextureView) glad_glTextureView = glad_next_glTextureView;
+	if (glad_glBindVertexBuffer == glad_instrument_glBindVertexBuffer) glad_glBindVertexBuffer = glad_next_glBindVertexBuffer;
+	if (glad_glVertexAttribFormat == glad_instrument_glVertexAttribFormat) glad_glVertexAttribFormat = glad_next_glVertexAttribFormat;
+	if (glad_glVertexAttribIFormat == glad_instrument_glVertexAttribIFormat) glad_glVertexAttribIFormat = glad_next_glVertexAttribIFormat;
+	if (glad_glVertexAttribLFormat == glad_instrument_glVertexAttribLFormat) glad_glVertexAttribLFormat = glad_next_glVertexAttribLFormat;
+	if (glad_glVertexAttribBinding == glad_instrument_glVertexAttribBinding) glad_glVertexAttribBinding = glad_next_glVertexAttribBinding;
+	if (glad_glVertexBindingDivisor == glad_instrument_glVertexBindingDivisor) glad_glVertexBindingDivisor = glad_next_glVertexBindingDivisor;
+	if (glad_glDebugMessageControl == glad_instrument_glDebugMessageControl) glad_glDebugMessageControl = glad_next_glDebugMessageControl;
+	if (glad_glDebugMessageInsert == glad_instrument_glDebugMessageInsert) glad_glDebugMessageInsert = glad_next_glDebugMessageInsert;
+	if (glad_glDebugMessageCallback == glad_instrument_glDebugMessageCallback) glad_glDebugMessageCallback = glad_next_glDebugMessageCallback;
+	if (glad_glGetDebugMessageLog == glad_instrument_glGetDebugMessageLog) glad_glGetDebugMessageLog = glad_next_glGetDebugMessageLog;
+	if (glad_glPushDebugGroup == glad_instrument_glPushDebugGroup) glad_glPushDebugGroup = glad_next_glPushDebugGroup;
+	if (glad_glPopDebugGroup == glad_instrument_glPopDebugGroup) glad_glPopDebugGroup = glad_next_glPopDebugGroup;
+	if (glad_glObjectLabel == glad_instrument_glObjectLabel) glad_glObjectLabel = glad_next_glObjectLabel;
+	if (glad_glGetObjectLabel == glad_instrument_glGetObjectLabel) glad_glGetObjectLabel = glad_next_glGetObjectLabel;
+	if (glad_glObjectPtrLabel == glad_instrument_glObjectPtrLabel) glad_glObjectPtrLabel = glad_next_glObjectPtrLabel;
+	if (glad_glGetObjectPtrLabel == glad_instrument_glGetObjectPtrLabel) glad_glGetObjectPtrLabel = glad_next_glGetObjectPtrLabel;
+	if (glad_glGetPointerv == glad_instrument_glGetPointerv) glad_glGetPointerv = glad_next_glGetPointerv;
+	if (glad_glBufferStorage == glad_instrument_glBufferStorage) glad_glBufferStorage = glad_next_glBufferStorage;
+	if (glad_glClearTexImage == glad_instrument_glClearTexImage) glad_glClearTexImage = glad_next_glClearTexImage;
+	if (glad_glClearTexSubImage == glad_instrument_glClearTexSubImage) glad_glClearTexSubImage = glad_next_glClearTexSubImage;
+	if (glad_glBindBuffersBase == glad_instrument_glBindBuffersBase) glad_glBindBuffersBase = glad_next_glBindBuffersBase;
+	if (glad_glBindBuffersRange == glad_instrument_glBindBuffersRange) glad_glBindBuffersRange = glad_next_glBindBuffersRange;
+	if (glad_glBindTextures == glad_instrument_glBindTextures) glad_glBindTextures = glad_next_glBindTextures;
+	if (glad_glBindSamplers == glad_instrument_glBindSamplers) glad_glBindSamplers = glad_next_glBindSamplers;
+	if (glad_glBindImageTextures == glad_instrument_glBindImageTextures) glad_glBindImageTextures = glad_next_glBindImageTextures;
+	if (glad_glBindVertexBuffers == glad_instrument_glBindVertexBuffers) glad_glBindVertexBuffers = glad_next_glBindVertexBuffers;
+	if (glad_glClipControl == glad_instrument_glClipControl) glad_glClipControl = glad_next_glClipControl;
+	if (glad_glCreateTransformFeedbacks == glad_instrument_glCreateTransformFeedbacks) glad_glCreateTransformFeedbacks = glad_next_glCreateTransformFeedbacks;
+	if (glad_glTransformFeedbackBufferBase == glad_instrument_glTransformFeedbackBufferBase) glad_glTransformFeedbackBufferBase = glad_next_glTransformFeedbackBufferBase;
+	if (glad_glTransformFeedbackBufferRange == glad_instrument_glTransformFeedbackBufferRange) glad_glTransformFeedbackBufferRange = glad_next_glTransformFeedbackBufferRange;
+	if (glad_glGetTransformFeedbackiv == glad_instrument_glGetTransformFeedbackiv) glad_glGetTransformFeedbackiv = glad_next_glGetTransformFeedbackiv;
+	if (glad_glGetTransformFeedbacki_v == glad_instrument_glGetTransformFeedbacki_v) glad_glGetTransformFeedbacki_v = glad_next_glGetTransformFeedbacki_v;
+	if (glad_glGetTransformFeedbacki64_v == glad_instrument_glGetTransformFeedbacki64_v) glad_glGetTransformFeedbacki64_v = glad_next_glGetTransformFeedbacki64_v;
+	if (glad_glCreateBuffers == glad_instrument_glCreateBuffers) glad_glCreateBuffers = glad_next_glCreateBuffers;
+	if (glad_glNamedBufferStorage == glad_instrument_glNamedBufferStorage) glad_glNamedBufferStorage = glad_next_glNamedBufferStorage;
+	if (glad_glNamedBufferData == glad_instrument_glNamedBufferData) glad_glNamedBufferData = glad_next_glNamedBufferData;
+	if (glad_glNamedBufferSubData == glad_instrument_glNamedBufferSubData) glad_glNamedBufferSubData = glad_next_glNamedBufferSubData;
+	if (glad_glCopyNamedBufferSubData == glad_instrument_glCopyNamedBufferSubData) glad_glCopyNamedBufferSubData = glad_next_glCopyNamedBufferSubData;
+	if (glad_glClearNamedBufferData == glad_instrument_glClearNamedBufferData) glad_glClearNamedBufferData = glad_next_glClearNamedBufferData;
+	if (glad_glClearNamedBufferSubData == glad_instrument_glClearNamedBufferSubData) glad_glClearNamedBufferSubData = glad_next_glClearNamedBufferSubData;
+	if (glad_glMapNamedBuffer == glad_instrument_glMapNamedBuffer) glad_glMapNamedBuffer = glad_next_glMapNamedBuffer;
+	if (glad_glMapNamedBufferRange == glad_instrument_glMapNamedBufferRange) glad_glMapNamedBufferRange = glad_next_glMapNamedBufferRange;
+	if (glad_glUnmapNamedBuffer == glad_instrument_glUnmapNamedBuffer) glad_glUnmapNamedBuffer = glad_next_glUnmapNamedBuffer;
+	if (glad_glFlushMappedNamedBufferRange == glad_instrument_glFlushMappedNamedBufferRange) glad_glFlushMappedNamedBufferRange = glad_next_glFlushMappedNamedBufferRange;
+	if (glad_glGetNamedBufferParameteriv == glad_instrument_glGetNamedBufferParameteriv) glad_glGetNamedBufferParameteriv = glad_next_glGetNamedBufferParameteriv;
+	if (glad_glGetNamedBufferParameteri64v == glad_instrument_glGetNamedBufferParameteri64v) glad_glGetNamedBufferParameteri64v = glad_next_glGetNamedBufferParameteri64v;
+	if (glad_glGetNamedBufferPointerv == glad_instrument_glGetNamedBufferPointerv) glad_glGetNamedBufferPointerv = glad_next_glGetNamedBufferPointerv;
+	if (glad_glGetNamedBufferSubData == glad_instrument_glGetNamedBufferSubData) glad_glGetNamedBufferSubData = glad_next_glGetNamedBufferSubData;
+	if (glad_glCreateFramebuffers == glad_instrument_glCreateFramebuffers) glad_glCreateFramebuffers = glad_next_glCreateFramebuffers;
+	if (glad_glNamedFramebufferRenderbuffer == glad_instrument_glNamedFramebufferRenderbuffer) glad_glNamedFramebufferRenderbuffer = glad_next_glNamedFramebufferRenderbuffer;
+	if (glad_glNamedFramebufferParameteri == glad_instrument_glNamedFramebufferParameteri) glad_glNamedFramebufferParameteri = glad_next_glNamedFramebufferParameteri;
+	if (glad_glNamedFramebufferTexture == glad_instrument_glNamedFramebufferTexture) glad_glNamedFramebufferTexture = glad_next_glNamedFramebufferTexture;
+	if (glad_glNamedFramebufferTextureLayer == glad_instrument_glNamedFramebufferTextureLayer) glad_glNamedFramebufferTextureLayer = glad_next_glNamedFramebufferTextureLayer;
+	if (glad_glNamedFramebufferDrawBuffer == glad_instrument_glNamedFramebufferDrawBuffer) glad_glNamedFramebufferDrawBuffer = glad_next_glNamedFramebufferDrawBuffer;
+	if (glad_glNamedFramebufferDrawBuffers == glad_instrument_glNamedFramebufferDrawBuffers) glad_glNamedFramebufferDrawBuffers = glad_next_glNamedFramebufferDrawBuffers;
+	if (glad_glNamedFramebufferReadBuffer == glad_instrument_glNamedFramebufferReadBuffer) glad_glNamedFramebufferReadBuffer = glad_next_glNamedFramebufferReadBuffer;
+	if (glad_glInvalidateNamedFramebufferData == glad_instrument_glInvalidateNamedFramebufferData) glad_glInvalidateNamedFramebufferData = glad_next_glInvalidateNamedFramebufferData;
+	if (glad_glInvalidateNamedFramebufferSubData == glad_instrument_glInvalidateNamedFramebufferSubData) glad_glInvalidateNamedFramebufferSubData = glad_next_glInvalidateNamedFramebufferSubData;
+	if (glad_glClearNamedFramebufferiv == glad_instrument_glClearNamedFramebufferiv) glad_glClearNamedFramebufferiv = glad_next_glClearNamedFramebufferiv;
+	if (glad_glClearNamedFramebufferuiv == glad_instrument_glClearNamedFramebufferuiv) glad_glClearNamedFramebufferuiv = glad_next_glClearNamedFramebufferuiv;
+	if (glad_glClearNamedFramebufferfv == glad_instrument_glClearNamedFramebufferfv) glad_glClearNamedFramebufferfv = glad_next_glClearNamedFramebufferfv;
+	if (glad_glClearNamedFramebufferfi == glad_instrument_glClearNamedFramebufferfi) glad_glClearNamedFramebufferfi = glad_next_glClearNamedFramebufferfi;
+	if (glad_glBlitNamedFramebuffer == glad_instrument_glBlitNamedFramebuffer) glad_glBlitNamedFramebuffer = glad_next_glBlitNamedFramebuffer;
+	if (glad_glCheckNamedFramebufferStatus == glad_instrument_glCheckNamedFramebufferStatus) glad_glCheckNamedFramebufferStatus = glad_next_glCheckNamedFramebufferStatus;
+	if (glad_glGetNamedFramebufferParameteriv == glad_instrument_glGetNamedFramebufferParameteriv) glad_glGetNamedFramebufferParameteriv = glad_next_glGetNamedFramebufferParameteriv;
+	if (glad_glGetNamedFramebufferAttachmentParameteriv == glad_instrument_glGetNamedFramebufferAttachmentParameteriv) glad_glGetNamedFramebufferAttachmentParameteriv = glad_next_glGetNamedFramebufferAttachmentParameteriv;
+	if (glad_glCreateRenderbuffers == glad_instrument_glCreateRenderbuffers) glad_glCreateRenderbuffers = glad_next_glCreateRenderbuffers;
+	if (glad_glNamedRenderbufferStorage == glad_instrument_glNamedRenderbufferStorage) glad_glNamedRenderbufferStorage = glad_next_glNamedRenderbufferStorage;
+	if (glad_glNamedRenderbufferStorageMultisample == glad_instrument_glNamedRenderbufferStorageMultisample) glad_glNamedRenderbufferStorageMultisample = glad_next_glNamedRenderbufferStorageMultisample;
+	if (glad_glGetNamedRenderbufferParameteriv == glad_instrument_glGetNamedRenderbufferParameteriv) glad_glGetNamedRenderbufferParameteriv = glad_next_glGetNamedRenderbufferParameteriv;
+	if (glad_glCreateTextures == glad_instrument_glCreateTextures) glad_glCreateTextures = glad_next_glCreateTextures;
+	if (glad_glTextureBuffer == glad_instrument_glTextureBuffer) glad_glTextureBuffer = glad_next_glTextureBuffer;
+	if (glad_glTextureBufferRange == glad_instrument_glTextureBufferRange) glad_glTextureBufferRange = glad_next_glTextureBufferRange;
+	if (glad_glTextureStorage1D == glad_instrument_glTextureStorage1D) glad_glTextureStorage1D = glad_next_glTextureStorage1D;
+	if (glad_glTextureStorage2D == glad_instrument_glTextureStorage2D) glad_glTextureStorage2D = glad_next_glTextureStorage2D;
+	if (glad_glTextureStorage3D == glad_instrument_glTextureStorage3D) glad_glTextureStorage3D = glad_next_glTextureStorage3D;
+	if (glad_glTextureStorage2DMultisample == glad_instrument_glTextureStorage2DMultisample) glad_glTextureStorage2DMultisample = glad_next_glTextureStorage2DMultisample;
+	if (glad_glTextureStorage3DMultisample == glad_instrument_glTextureStorage3DMultisample) glad_glTextureStorage3DMultisample = glad_next_glTextureStorage3DMultisample;
+	if (glad_glTextureSubImage1D == glad_instrument_glTextureSubImage1D) glad_glTextureSubImage1D = glad_next_glTextureSubImage1D;
+	if (glad_glTextureSubImage2D == glad_instrument_glTextureSubImage2D) glad_glTextureSubImage2D = glad_next_glTextureSubImage2D;
+	if (glad_glTextureSubImage3D == glad_instrument_glTextureSubImage3D) glad_glTextureSubImage3D = glad_next_glTextureSubImage3D;
+	if (glad_glCompressedTextureSubImage1D == glad_instrument_glCompressedTextureSubImage1D) glad_glCompressedTextureSubImage1D = glad_next_glCompressedTextureSubImage1D;
+	if (glad_glCompressedTextureSubImage2D == glad_instrument_glCompressedTextureSubImage2D) glad_glCompressedTextureSubImage2D = glad_next_glCompressedTextureSubImage2D;
+	if (glad_glCompressedTextureSubImage3D == glad_instrument_glCompressedTextureSubImage3D) glad_glCompressedTextureSubImage3D = glad_next_glCompressedTextureSubImage3D;
+	if (glad_glCopyTextureSubImage1D == glad_instrument_glCopyTextureSubImage1D) glad_glCopyTextureSubImage1D = glad_next_glCopyTextureSubImage1D;
+	if (glad_glCopyTextureSubImage2D == glad_instrument_glCopyTextureSubImage2D) glad_glCopyTextureSubImage2D = glad_next_glCopyTextureSubImage2D;
+	if (glad_glCopyTextureSubImage3D == glad_instrument_glCopyTextureSubImage3D) glad_glCopyTextureSubImage3D = glad_next_glCopyTextureSubImage3D;
+	if (glad_glTextureParameterf == glad_instrument_glTextureParameterf) glad_glTextureParameterf = glad_next_glTextureParameterf;
+	if (glad_glTextureParameterfv == glad_instrument_glTextureParameterfv) glad_glTextureParameterfv = glad_next_glTextureParameterfv;
+	if (glad_glTextureParameteri == glad_instrument_glTextureParameteri) glad_glTextureParameteri = glad_next_glTextureParameteri;
+	if (glad_glTextureParameterIiv == glad_instrument_glTextureParameterIiv) glad_glTextureParameterIiv = glad_next_glTextureParameterIiv;
+	if (glad_glTextureParameterIuiv == glad_instrument_glTextureParameterIuiv) glad_glTextureParameterIuiv = glad_next_glTextureParameterIuiv;
+	if (glad_glTextureParameteriv == glad_instrument_glTextureParameteriv) glad_glTextureParameteriv = glad_next_glTextureParameteriv;
+	if (glad_glGenerateTextureMipmap == glad_instrument_glGenerateTextureMipmap) glad_glGenerateTextureMipmap = glad_next_glGenerateTextureMipmap;
+	if (glad_glBindTextureUnit == glad_instrument_glBindTextureUnit) glad_glBindTextureUnit = glad_next_glBindTextureUnit;
+	if (glad_glGetTextureImage == glad_instrument_glGetTextureImage) glad_glGetTextureImage = glad_next_glGetTextureImage;
+	if (glad_glGetCompressedTextureImage == glad_instrument_glGetCompressedTextureImage) glad_glGetCompressedTextureImage = glad_next_glGetCompressedTextureImage;
+	if (glad_glGetTextureLevelParameterfv == glad_instrument_glGetTextureLevelParameterfv) glad_glGetTextureLevelParameterfv = glad_next_glGetTextureLevelParameterfv;
+	if (glad_glGetTextureLevelParameteriv == glad_instrument_glGetTextureLevelParameteriv) glad_glGetTextureLevelParameteriv = glad_next_glGetTextureLevelParameteriv;
+	if (glad_glGetTextureParameterfv == glad_instrument_glGetTextureParameterfv) glad_glGetTextureParameterfv = glad_next_glGetTextureParameterfv;
+	if (glad_glGetTextureParameterIiv == glad_instrument_glGetTextureParameterIiv) glad_glGetTextureParameterIiv = glad_next_glGetTextureParameterIiv;
+	if (glad_glGetTextureParameterIuiv == glad_instrument_glGetTextureParameterIuiv) glad_glGetTextureParameterIuiv = glad_next_glGetTextureParameterIuiv;
+	if (glad_glGetTextureParameteriv == glad_instrument_glGetTextureParameteriv) glad_glGetTextureParameteriv = glad_next_glGetTextureParameteriv;
+	if (glad_glCreateVertexArrays == glad_instrument_glCreateVertexArrays) glad_glCreateVertexArrays = glad_next_glCreateVertexArrays;
+	if (glad_glDisableVertexArrayAttrib == glad_instrument_glDisableVertexArrayAttrib) glad_glDisableVertexArrayAttrib = glad_next_glDisableVertexArrayAttrib;
+	if (glad_glEnableVertexArrayAttrib == glad_instrument_glEnableVertexArrayAttrib) glad_glEnableVertexArrayAttrib = glad_next_glEnableVertexArrayAttrib;
+	if (glad_glVertexArrayElementBuffer == glad_instrument_glVertexArrayElementBuffer) glad_glVertexArrayElementBuffer = glad_next_glVertexArrayElementBuffer;
+	if (glad_glVertexArrayVertexBuffer == glad_instrument_glVertexArrayVertexBuffer) glad_glVertexArrayVertexBuffer = glad_next_glVertexArrayVertexBuffer;
+	if (glad_glVertexArrayVertexBuffers == glad_instrument_glVertexArrayVertexBuffers) glad_glVertexArrayVertexBuffers = glad_next_glVertexArrayVertexBuffers;
+	if (glad_glVertexArrayAttribBinding == glad_instrument_glVertexArrayAttribBinding) glad_glVertexArrayAttribBinding = glad_next_glVertexArrayAttribBinding;
+	if (glad_glVertexArrayAttribFormat == glad_instrument_glVertexArrayAttribFormat) glad_glVertexArrayAttribFormat = glad_next_glVertexArrayAttribFormat;
+	if (glad_glVertexArrayAttribIFormat == glad_instrument_glVertexArrayAttribIFormat) glad_glVertexArrayAttribIFormat = glad_next_glVertexArrayAttribIFormat;
+	if (glad_glVertexArrayAttribLFormat == glad_instrument_glVertexArrayAttribLFormat) glad_glVertexArrayAttribLFormat = glad_next_glVertexArrayAttribLFormat;
+	if (glad_glVertexArrayBindingDivisor == glad_instrument_glVertexArrayBindingDivisor) glad_glVertexArrayBindingDivisor = glad_next_glVertexArrayBindingDivisor;
+	if (glad_glGetVertexArrayiv == glad_instrument_glGetVertexArrayiv) glad_glGetVertexArrayiv = glad_next_glGetVertexArrayiv;
+	if (glad_glGetVertexArrayIndexediv == glad_instrument_glGetVertexArrayIndexediv) glad_glGetVertexArrayIndexediv = glad_next_glGetVertexArrayIndexediv;
+	if (glad_glGetVertexArrayIndexed64iv == glad_instrument_glGetVertexArrayIndexed64iv) glad_glGetVertexArrayIndexed64iv = glad_next_glGetVertexArrayIndexed64iv;
+	if (glad_glCreateSamplers == glad_instrument_glCreateSamplers) glad_glCreateSamplers = glad_next_glCreateSamplers;
+	if (glad_glCreateProgramPipelines == glad_instrument_glCreateProgramPipelines) glad_glCreateProgramPipelines = glad_next_glCreateProgramPipelines;
+	if (glad_glCreateQueries == glad_instrument_glCreateQueries) glad_glCreateQueries = glad_next_glCreateQueries;
+	if (glad_glGetQueryBufferObjecti64v == glad_instrument_glGetQueryBufferObjecti64v) glad_glGetQueryBufferObjecti64v = glad_next_glGetQueryBufferObjecti64v;
+	if (glad_glGetQueryBufferObjectiv == glad_instrument_glGetQueryBufferObjectiv) glad_glGetQueryBufferObjectiv = glad_next_glGetQueryBufferObjectiv;
+	if (glad_glGetQueryBufferObjectui64v == glad_instrument_glGetQueryBufferObjectui64v) glad_glGetQueryBufferObjectui64v = glad_next_glGetQueryBufferObjectui64v;
+	if (glad_glGetQueryBufferObjectuiv == glad_instrument_glGetQueryBufferObjectuiv) glad_glGetQueryBufferObjectuiv = glad_next_glGetQueryBufferObjectuiv;
+	if (glad_glMemoryBarrierByRegion == glad_instrument_glMemoryBarrierByRegion) glad_glMemoryBarrierByRegion = glad_next_glMemoryBarrierByRegion;
+	if (glad_glGetTextureSubImage == glad_instrument_glGetTextureSubImage) glad_glGetTextureSubImage = glad_next_glGetTextureSubImage;
+	if (glad_glGetCompressedTextureSubImage == glad_instrument_glGetCompressedTextureSubImage) glad_glGetCompressedTextureSubImage = glad_next_glGetCompressedTextureSubImage;
+	if (glad_glGetGraphicsResetStatus == glad_instrument_glGetGraphicsResetStatus) glad_glGetGraphicsResetStatus = glad_next_glGetGraphicsResetStatus;
+	if (glad_glGetnCompressedTexImage == glad_instrument_glGetnCompressedTexImage) glad_glGetnCompressedTexImage = glad_next_glGetnCompressedTexImage;
+	if (glad_glGetnTexImage == glad_instrument_glGetnTexImage) glad_glGetnTexImage = glad_next_glGetnTexImage;
+	if (glad_glGetnUniformdv == glad_instrument_glGetnUniformdv) glad_glGetnUniformdv = glad_next_glGetnUniformdv;
+	if (glad_glGetnUniformfv == glad_instrument_glGetnUniformfv) glad_glGetnUniformfv = glad_next_glGetnUniformfv;
+	if (glad_glGetnUniformiv == glad_instrument_glGetnUniformiv) glad_glGetnUniformiv = glad_next_glGetnUniformiv;
+	if (glad_glGetnUniformuiv == glad_instrument_glGetnUniformuiv) glad_glGetnUniformuiv = glad_next_glGetnUniformuiv;
+	if (glad_glReadnPixels == glad_instrument_glReadnPixels) glad_glReadnPixels = glad_next_glReadnPixels;
+	if (glad_glGetnMapdv == glad_instrument_glGetnMapdv) glad_glGetnMapdv = glad_next_glGetnMapdv;
+	if (glad_glGetnMapfv == glad_instrument_glGetnMapfv) glad_glGetnMapfv = glad_next_glGetnMapfv;
+	if (glad_glGetnMapiv == glad_instrument_glGetnMapiv) glad_glGetnMapiv = glad_next_glGetnMapiv;
+	if (glad_glGetnPixelMapfv == glad_instrument_glGetnPixelMapfv) glad_glGetnPixelMapfv = glad_next_glGetnPixelMapfv;
+	if (glad_glGetnPixelMapuiv == glad_instrument_glGetnPixelMapuiv) glad_glGetnPixelMapuiv = glad_next_glGetnPixelMapuiv;
+	if (glad_glGetnPixelMapusv == glad_instrument_glGetnPixelMapusv) glad_glGetnPixelMapusv = glad_next_glGetnPixelMapusv;
+	if (glad_glGetnPolygonStipple == glad_instrument_glGetnPolygonStipple) glad_glGetnPolygonStipple = glad_next_glGetnPolygonStipple;
+	if (glad_glGetnColorTable == glad_instrument_glGetnColorTable) glad_glGetnColorTable = glad_next_glGetnColorTable;
+	if (glad_glGetnConvolutionFilter == glad_instrument_glGetnConvolutionFilter) glad_glGetnConvolutionFilter = glad_next_glGetnConvolutionFilter;
+	if (glad_glGetnSeparableFilter == glad_instrument_glGetnSeparableFilter) glad_glGetnSeparableFilter = glad_next_glGetnSeparableFilter;
+	if (glad_glGetnHistogram == glad_instrument_glGetnHistogram) glad_glGetnHistogram = glad_next_glGetnHistogram;
+	if (glad_glGetnMinmax == glad_instrument_glGetnMinmax) glad_glGetnMinmax = glad_next_glGetnMinmax;
+	if (glad_glTextureBarrier == glad_instrument_glTextureBarrier) glad_glTextureBarrier = glad_next_glTextureBarrier;
+}
+#endif
@@ -0,0 +1,11977 @@
+/*
+    Generated by gen-glad-layers.py from glad.h. Do not edit.
+*/
+
+#include <stdint.h>
+#include "glad.h"
+#include "gl-trace.h"
+
+const unsigned gladTraceProcCount = 695;
+
+const char *const gladTraceNames[] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+	"glVertexP2ui",
+	"glVertexP2uiv",
+	"glVertexP3ui",
+	"glVertexP3uiv",
+	"glVertexP4ui",
+	"glVertexP4uiv",
+	"glTexCoordP1ui",
+	"glTexCoordP1uiv",
+	"glTexCoordP2ui",
+	"glTexCoordP2uiv",
+	"glTexCoordP3ui",
+	"glTexCoordP3uiv",
+	"glTexCoordP4ui",
+	"glTexCoordP4uiv",
+	"glMultiTexCoordP1ui",
+	"glMultiTexCoordP1uiv",
+	"glMultiTexCoordP2ui",
+	"glMultiTexCoordP2uiv",
+	"glMultiTexCoordP3ui",
+	"glMultiTexCoordP3uiv",
+	"glMultiTexCoordP4ui",
+	"glMultiTexCoordP4uiv",
+	"glNormalP3ui",
+	"glNormalP3uiv",
+	"glColorP3ui",
+	"glColorP3uiv",
+	"glColorP4ui",
+	"glColorP4uiv",
+	"glSecondaryColorP3ui",
+	"glSecondaryColorP3uiv",
+	"glMinSampleShading",
+	"glBlendEquationi",
+	"glBlendEquationSeparatei",
+	"glBlendFunci",
+	"glBlendFuncSeparatei",
+	"glDrawArraysIndirect",
+	"glDrawElementsIndirect",
+	"glUniform1d",
+	"glUniform2d",
+	"glUniform3d",
+	"glUniform4d",
+	"glUniform1dv",
+	"glUniform2dv",
+	"glUniform3dv",
+	"glUniform4dv",
+	"glUniformMatrix2dv",
+	"glUniformMatrix3dv",
+	"glUniformMatrix4dv",
+	"glUniformMatrix2x3dv",
+	"glUniformMatrix2x4dv",
+	"glUniformMatrix3x2dv",
+	"glUniformMatrix3x4dv",
+	"glUniformMatrix4x2dv",
+	"glUniformMatrix4x3dv",
+	"glGetUniformdv",
+	"glGetSubroutineUniformLocation",
+	"glGetSubroutineIndex",
+	"glGetActiveSubroutineUniformiv",
+	"glGetActiveSubroutineUniformName",
+	"glGetActiveSubroutineName",
+	"glUniformSubroutinesuiv",
+	"glGetUniformSubroutineuiv",
+	"glGetProgramStageiv",
+	"glPatchParameteri",
+	"glPatchParameterfv",
+	"glBindTransformFeedback",
+	"glDeleteTransformFeedbacks",
+	"glGenTransformFeedbacks",
+	"glIsTransformFeedback",
+	"glPauseTransformFeedback",
+	"glResumeTransformFeedback",
+	"glDrawTransformFeedback",
+	"glDrawTransformFeedbackStream",
+	"glBeginQueryIndexed",
+	"glEndQueryIndexed",
+	"glGetQueryIndexediv",
+	"glReleaseShaderCompiler",
+	"glShaderBinary",
+	"glGetShaderPrecisionFormat",
+	"glDepthRangef",
+	"glClearDepthf",
+	"glGetProgramBinary",
+	"glProgramBinary",
+	"glProgramParameteri",
+	"glUseProgramStages",
+	"glActiveShaderProgram",
+	"glCreateShaderProgramv",
+	"glBindProgramPipeline",
+	"glDeleteProgramPipelines",
+	"glGenProgramPipelines",
+	"glIsProgramPipeline",
+	"glGetProgramPipelineiv",
+	"glProgramUniform1i",
+	"glProgramUniform1iv",
+	"glProgramUniform1f",
+	"glProgramUniform1fv",
+	"glProgramUniform1d",
+	"glProgramUniform1dv",
+	"glProgramUniform1ui",
+	"glProgramUniform1uiv",
+	"glProgramUniform2i",
+	"glProgramUniform2iv",
+	"glProgramUniform2f",
+	"glProgramUniform2fv",
+	"glProgramUniform2d",
+	"glProgramUniform2dv",
+	"glProgramUniform2ui",
+	"glProgramUniform2uiv",
+	"glProgramUniform3i",
+	"glProgramUniform3iv",
+	"glProgramUniform3f",
+	"glProgramUniform3fv",
+	"glProgramUniform3d",
+	"glProgramUniform3dv",
+	"glProgramUniform3ui",
+	"glProgramUniform3uiv",
+	"glProgramUniform4i",
+	"glProgramUniform4iv",
+	"glProgramUniform4f",
+	"glProgramUniform4fv",
+	"glProgramUniform4d",
+	"glProgramUniform4dv",
+	"glProgramUniform4ui",
+	"glProgramUniform4uiv",
+	"glProgramUniformMatrix2fv",
+	"glProgramUniformMatrix3fv",
+	"glProgramUniformMatrix4fv",
+	"glProgramUniformMatrix2dv",
+	"glProgramUniformMatrix3dv",
+	"glProgramUniformMatrix4dv",
+	"glProgramUniformMatrix2x3fv",
+	"glProgramUniformMatrix3x2fv",
+	"glProgramUniformMatrix2x4fv",
+	"glProgramUniformMatrix4x2fv",
+	"glProgramUniformMatrix3x4fv",
+	"glProgramUniformMatrix4x3fv",
+	"glProgramUniformMatrix2x3dv",
+	"glProgramUniformMatrix3x2dv",
+	"glProgramUniformMatrix2x4dv",
+	"glProgramUniformMatrix4x2dv",
+	"glProgramUniformMatrix3x4dv",
+	"glProgramUniformMatrix4x3dv",
+	"glValidateProgramPipeline",
+	"glGetProgramPipelineInfoLog",
+	"glVertexAttribL1d",
+	"glVertexAttribL2d",
+	"glVertexAttribL3d",
+	"glVertexAttribL4d",
+	"glVertexAttribL1dv",
+	"glVertexAttribL2dv",
+	"glVertexAttribL3dv",
+	"glVertexAttribL4dv",
+	"glVertexAttribLPointer",
+	"glGetVertexAttribLdv",
+	"glViewportArrayv",
+	"glViewportIndexedf",
+	"glViewportIndexedfv",
+	"glScissorArrayv",
+	"glScissorIndexed",
+	"glScissorIndexedv",
+	"glDepthRangeArrayv",
+	"glDepthRangeIndexed",
+	"glGetFloati_v",
+	"glGetDoublei_v",
+	"glDrawArraysInstancedBaseInstance",
+	"glDrawElementsInstancedBaseInstance",
+	"glDrawElementsInstancedBaseVertexBaseInstance",
+	"glGetInternalformativ",
+	"glGetActiveAtomicCounterBufferiv",
+	"glBindImageTexture",
+	"glMemoryBarrier",
+	"glTexStorage1D",
+	"glTexStorage2D",
+	"glTexStorage3D",
+	"glDrawTransformFeedbackInstanced",
+	"glDrawTransformFeedbackStreamInstanced",
+	"glClearBufferData",
+	"glClearBufferSubData",
+	"glDispatchCompute",
+	"glDispatchComputeIndirect",
+	"glCopyImageSubData",
+	"glFramebufferParameteri",
+	"glGetFramebufferParameteriv",
+	"glGetInternalformati64v",
+	"glInvalidateTexSubImage",
+	"glInvalidateTexImage",
+	"glInvalidateBufferSubData",
+	"glInvalidateBufferData",
+	"glInvalidateFramebuffer",
+	"glInvalidateSubFramebuffer",
+	"glMultiDrawArraysIndirect",
+	"glMultiDrawElementsIndirect",
+	"glGetProgramInterfaceiv",
+	"glGetProgramResourceIndex",
+	"glGetProgramResourceName",
+	"glGetProgramResourceiv",
+	"glGetProgramResourceLocation",
+	"glGetProgramResourceLocationIndex",
+	"glShaderStorageBlockBinding",
+	"glTexBufferRange",
+	"glTexStorage2DMultisample",
+	"glTexStorage3DMultisample",
+	"glTextureView",
+	"glBindVertexBuffer",
+	"glVertexAttribFormat",
+	"glVertexAttribIFormat",
+	"glVertexAttribLFormat",
+	"glVertexAttribBinding",
+	"glVertexBindingDivisor",
+	"glDebugMessageControl",
+	"glDebugMessageInsert",
+	"glDebugMessageCallback",
+	"glGetDebugMessageLog",
+	"glPushDebugGroup",
+	"glPopDebugGroup",
+	"glObjectLabel",
+	"glGetObjectLabel",
+	"glObjectPtrLabel",
+	"glGetObjectPtrLabel",
+	"glGetPointerv",
+	"glBufferStorage",
+	"glClearTexImage",
+	"glClearTexSubImage",
+	"glBindBuffersBase",
+	"glBindBuffersRange",
+	"glBindTextures",
+	"glBindSamplers",
+	"glBindImageTextures",
+	"glBindVertexBuffers",
+	"glClipControl",
+	"glCreateTransformFeedbacks",
+	"glTransformFeedbackBufferBase",
+	"glTransformFeedbackBufferRange",
+	"glGetTransformFeedbackiv",
+	"glGetTransformFeedbacki_v",
+	"glGetTransformFeedbacki64_v",
+	"glCreateBuffers",
+	"glNamedBufferStorage",
+	"glNamedBufferData",
+	"glNamedBufferSubData",
+	"glCopyNamedBufferSubData",
+	"glClearNamedBufferData",
+	"glClearNamedBufferSubData",
+	"glMapNamedBuffer",
+	"glMapNamedBufferRange",
+	"glUnmapNamedBuffer",
+	"glFlushMappedNamedBufferRange",
+	"glGetNamedBufferParameteriv",
+	"glGetNamedBufferParameteri64v",
+	"glGetNamedBufferPointerv",
+	"glGetNamedBufferSubData",
+	"glCreateFramebuffers",
+	"glNamedFramebufferRenderbuffer",
+	"glNamedFramebufferParameteri",
+	"glNamedFramebufferTexture",
+	"glNamedFramebufferTextureLayer",
+	"glNamedFramebufferDrawBuffer",
+	"glNamedFramebufferDrawBuffers",
+	"glNamedFramebufferReadBuffer",
+	"glInvalidateNamedFramebufferData",
+	"glInvalidateNamedFramebufferSubData",
+	"glClearNamedFramebufferiv",
+	"glClearNamedFramebufferuiv",
+	"glClearNamedFramebufferfv",
+	"glClearNamedFramebufferfi",
+	"glBlitNamedFramebuffer",
+	"glCheckNamedFramebufferStatus",
+	"glGetNamedFramebufferParameteriv",
+	"glGetNamedFramebufferAttachmentParameteriv",
+	"glCreateRenderbuffers",
+	"glNamedRenderbufferStorage",
+	"glNamedRenderbufferStorageMultisample",
+	"glGetNamedRenderbufferParameteriv",
+	"glCreateTextures",
+	"glTextureBuffer",
+	"glTextureBufferRange",
+	"glTextureStorage1D",
+	"glTextureStorage2D",
+	"glTextureStorage3D",
+	"glTextureStorage2DMultisample",
+	"glTextureStorage3DMultisample",
+	"glTextureSubImage1D",
+	"glTextureSubImage2D",
+	"glTextureSubImage3D",
+	"glCompressedTextureSubImage1D",
+	"glCompressedTextureSubImage2D",
+	"glCompressedTextureSubImage3D",
+	"glCopyTextureSubImage1D",
+	"glCopyTextureSubImage2D",
+	"glCopyTextureSubImage3D",
+	"glTextureParameterf",
+	"glTextureParameterfv",
+	"glTextureParameteri",
+	"glTextureParameterIiv",
+	"glTextureParameterIuiv",
+	"glTextureParameteriv",
+	"glGenerateTextureMipmap",
+	"glBindTextureUnit",
+	"glGetTextureImage",
+	"glGetCompressedTextureImage",
+	"glGetTextureLevelParameterfv",
+	"glGetTextureLevelParameteriv",
+	"glGetTextureParameterfv",
+	"glGetTextureParameterIiv",
+	"glGetTextureParameterIuiv",
+	"glGetTextureParameteriv",
+	"glCreateVertexArrays",
+	"glDisableVertexArrayAttrib",
+	"glEnableVertexArrayAttrib",
+	"glVertexArrayElementBuffer",
+	"glVertexArrayVertexBuffer",
+	"glVertexArrayVertexBuffers",
+	"glVertexArrayAttribBinding",
+	"glVertexArrayAttribFormat",
+	"glVertexArrayAttribIFormat",
+	"glVertexArrayAttribLFormat",
+	"glVertexArrayBindingDivisor",
+	"glGetVertexArrayiv",
+	"glGetVertexArrayIndexediv",
+	"glGetVertexArrayIndexed64iv",
+	"glCreateSamplers",
+	"glCreateProgramPipelines",
+	"glCreateQueries",
+	"glGetQueryBufferObjecti64v",
+	"glGetQueryBufferObjectiv",
+	"glGetQueryBufferObjectui64v",
+	"glGetQueryBufferObjectuiv",
+	"glMemoryBarrierByRegion",
+	"glGetTextureSubImage",
+	"glGetCompressedTextureSubImage",
+	"glGetGraphicsResetStatus",
+	"glGetnCompressedTexImage",
+	"glGetnTexImage",
+	"glGetnUniformdv",
+	"glGetnUniformfv",
+	"glGetnUniformiv",
+	"glGetnUniformuiv",
+	"glReadnPixels",
+	"glGetnMapdv",
+	"glGetnMapfv",
+	"glGetnMapiv",
+	"glGetnPixelMapfv",
+	"glGetnPixelMapuiv",
+	"glGetnPixelMapusv",
+	"glGetnPolygonStipple",
+	"glGetnColorTable",
+	"glGetnConvolutionFilter",
+	"glGetnSeparableFilter",
+	"glGetnHistogram",
+	"glGetnMinmax",
+	"glTextureBarrier",
+};
+
+static PFNGLCULLFACEPROC glad_trace_next_glCullFace;
+static void APIENTRY glad_trace_glCullFace(GLenum mode) {
+	glad_trace_next_glCullFace(mode);
+	GLTraceBeginCall(0);
+	GLTraceWrite(&mode, sizeof(mode));
+}
+static PFNGLFRONTFACEPROC glad_trace_next_glFrontFace;
+static void APIENTRY glad_trace_glFrontFace(GLenum mode) {
+	glad_trace_next_glFrontFace(mode);
+	GLTraceBeginCall(1);
+	GLTraceWrite(&mode, sizeof(mode));
+}
+static PFNGLHINTPROC glad_trace_next_glHint;
+static void APIENTRY glad_trace_glHint(GLenum target, GLenum mode) {
+	glad_trace_next_glHint(target, mode);
+	GLTraceBeginCall(2);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&mode, sizeof(mode));
+}
+static PFNGLLINEWIDTHPROC glad_trace_next_glLineWidth;
+static void APIENTRY glad_trace_glLineWidth(GLfloat width) {
+	glad_trace_next_glLineWidth(width);
+	GLTraceBeginCall(3);
+	GLTraceWrite(&width, sizeof(width));
+}
+static PFNGLPOINTSIZEPROC glad_trace_next_glPointSize;
+static void APIENTRY glad_trace_glPointSize(GLfloat size) {
+	glad_trace_next_glPointSize(size);
+	GLTraceBeginCall(4);
+	GLTraceWrite(&size, sizeof(size));
+}
+static PFNGLPOLYGONMODEPROC glad_trace_next_glPolygonMode;
+static void APIENTRY glad_trace_glPolygonMode(GLenum face, GLenum mode) {
+	glad_trace_next_glPolygonMode(face, mode);
+	GLTraceBeginCall(5);
+	GLTraceWrite(&face, sizeof(face));
+	GLTraceWrite(&mode, sizeof(mode));
+}
+static PFNGLSCISSORPROC glad_trace_next_glScissor;
+static void APIENTRY glad_trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_next_glScissor(x, y, width, height);
+	GLTraceBeginCall(6);
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLTEXPARAMETERFPROC glad_trace_next_glTexParameterf;
+static void APIENTRY glad_trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glad_trace_next_glTexParameterf(target, pname, param);
+	GLTraceBeginCall(7);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLTEXPARAMETERFVPROC glad_trace_next_glTexParameterfv;
+static void APIENTRY glad_trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_trace_next_glTexParameterfv(target, pname, params);
+	GLTraceBeginCall(8);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(params, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLfloat)));
+}
+static PFNGLTEXPARAMETERIPROC glad_trace_next_glTexParameteri;
+static void APIENTRY glad_trace_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_trace_next_glTexParameteri(target, pname, param);
+	GLTraceBeginCall(9);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLTEXPARAMETERIVPROC glad_trace_next_glTexParameteriv;
+static void APIENTRY glad_trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_trace_next_glTexParameteriv(target, pname, params);
+	GLTraceBeginCall(10);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(params, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLint)));
+}
+static PFNGLTEXIMAGE1DPROC glad_trace_next_glTexImage1D;
+static void APIENTRY glad_trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_next_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	GLTraceBeginCall(11);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&border, sizeof(border));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixels(pixels, (u64)(GLTraceImageSize(format, type, width, 1, 1)));
+}
+static PFNGLTEXIMAGE2DPROC glad_trace_next_glTexImage2D;
+static void APIENTRY glad_trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_next_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	GLTraceBeginCall(12);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&border, sizeof(border));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixels(pixels, (u64)(GLTraceImageSize(format, type, width, height, 1)));
+}
+static PFNGLDRAWBUFFERPROC glad_trace_next_glDrawBuffer;
+static void APIENTRY glad_trace_glDrawBuffer(GLenum buf) {
+	glad_trace_next_glDrawBuffer(buf);
+	GLTraceBeginCall(13);
+	GLTraceWrite(&buf, sizeof(buf));
+}
+static PFNGLCLEARPROC glad_trace_next_glClear;
+static void APIENTRY glad_trace_glClear(GLbitfield mask) {
+	glad_trace_next_glClear(mask);
+	GLTraceBeginCall(14);
+	GLTraceWrite(&mask, sizeof(mask));
+}
+static PFNGLCLEARCOLORPROC glad_trace_next_glClearColor;
+static void APIENTRY glad_trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_trace_next_glClearColor(red, green, blue, alpha);
+	GLTraceBeginCall(15);
+	GLTraceWrite(&red, sizeof(red));
+	GLTraceWrite(&green, sizeof(green));
+	GLTraceWrite(&blue, sizeof(blue));
+	GLTraceWrite(&alpha, sizeof(alpha));
+}
+static PFNGLCLEARSTENCILPROC glad_trace_next_glClearStencil;
+static void APIENTRY glad_trace_glClearStencil(GLint s) {
+	glad_trace_next_glClearStencil(s);
+	GLTraceBeginCall(16);
+	GLTraceWrite(&s, sizeof(s));
+}
+static PFNGLCLEARDEPTHPROC glad_trace_next_glClearDepth;
+static void APIENTRY glad_trace_glClearDepth(GLdouble depth) {
+	glad_trace_next_glClearDepth(depth);
+	GLTraceBeginCall(17);
+	GLTraceWrite(&depth, sizeof(depth));
+}
+static PFNGLSTENCILMASKPROC glad_trace_next_glStencilMask;
+static void APIENTRY glad_trace_glStencilMask(GLuint mask) {
+	glad_trace_next_glStencilMask(mask);
+	GLTraceBeginCall(18);
+	GLTraceWrite(&mask, sizeof(mask));
+}
+static PFNGLCOLORMASKPROC glad_trace_next_glColorMask;
+static void APIENTRY glad_trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_trace_next_glColorMask(red, green, blue, alpha);
+	GLTraceBeginCall(19);
+	GLTraceWrite(&red, sizeof(red));
+	GLTraceWrite(&green, sizeof(green));
+	GLTraceWrite(&blue, sizeof(blue));
+	GLTraceWrite(&alpha, sizeof(alpha));
+}
+static PFNGLDEPTHMASKPROC glad_trace_next_glDepthMask;
+static void APIENTRY glad_trace_glDepthMask(GLboolean flag) {
+	glad_trace_next_glDepthMask(flag);
+	GLTraceBeginCall(20);
+	GLTraceWrite(&flag, sizeof(flag));
+}
+static PFNGLDISABLEPROC glad_trace_next_glDisable;
+static void APIENTRY glad_trace_glDisable(GLenum cap) {
+	glad_trace_next_glDisable(cap);
+	GLTraceBeginCall(21);
+	GLTraceWrite(&cap, sizeof(cap));
+}
+static PFNGLENABLEPROC glad_trace_next_glEnable;
+static void APIENTRY glad_trace_glEnable(GLenum cap) {
+	glad_trace_next_glEnable(cap);
+	GLTraceBeginCall(22);
+	GLTraceWrite(&cap, sizeof(cap));
+}
+static PFNGLFINISHPROC glad_trace_next_glFinish;
+static void APIENTRY glad_trace_glFinish(void) {
+	glad_trace_next_glFinish();
+	GLTraceBeginCall(23);
+}
+static PFNGLFLUSHPROC glad_trace_next_glFlush;
+static void APIENTRY glad_trace_glFlush(void) {
+	glad_trace_next_glFlush();
+	GLTraceBeginCall(24);
+}
+static PFNGLBLENDFUNCPROC glad_trace_next_glBlendFunc;
+static void APIENTRY glad_trace_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glad_trace_next_glBlendFunc(sfactor, dfactor);
+	GLTraceBeginCall(25);
+	GLTraceWrite(&sfactor, sizeof(sfactor));
+	GLTraceWrite(&dfactor, sizeof(dfactor));
+}
+static PFNGLLOGICOPPROC glad_trace_next_glLogicOp;
+static void APIENTRY glad_trace_glLogicOp(GLenum opcode) {
+	glad_trace_next_glLogicOp(opcode);
+	GLTraceBeginCall(26);
+	GLTraceWrite(&opcode, sizeof(opcode));
+}
+static PFNGLSTENCILFUNCPROC glad_trace_next_glStencilFunc;
+static void APIENTRY glad_trace_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glad_trace_next_glStencilFunc(func, ref, mask);
+	GLTraceBeginCall(27);
+	GLTraceWrite(&func, sizeof(func));
+	GLTraceWrite(&ref, sizeof(ref));
+	GLTraceWrite(&mask, sizeof(mask));
+}
+static PFNGLSTENCILOPPROC glad_trace_next_glStencilOp;
+static void APIENTRY glad_trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glad_trace_next_glStencilOp(fail, zfail, zpass);
+	GLTraceBeginCall(28);
+	GLTraceWrite(&fail, sizeof(fail));
+	GLTraceWrite(&zfail, sizeof(zfail));
+	GLTraceWrite(&zpass, sizeof(zpass));
+}
+static PFNGLDEPTHFUNCPROC glad_trace_next_glDepthFunc;
+static void APIENTRY glad_trace_glDepthFunc(GLenum func) {
+	glad_trace_next_glDepthFunc(func);
+	GLTraceBeginCall(29);
+	GLTraceWrite(&func, sizeof(func));
+}
+static PFNGLPIXELSTOREFPROC glad_trace_next_glPixelStoref;
+static void APIENTRY glad_trace_glPixelStoref(GLenum pname, GLfloat param) {
+	glad_trace_next_glPixelStoref(pname, param);
+	GLTraceBeginCall(30);
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLPIXELSTOREIPROC glad_trace_next_glPixelStorei;
+static void APIENTRY glad_trace_glPixelStorei(GLenum pname, GLint param) {
+	glad_trace_next_glPixelStorei(pname, param);
+	GLTraceBeginCall(31);
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLREADBUFFERPROC glad_trace_next_glReadBuffer;
+static void APIENTRY glad_trace_glReadBuffer(GLenum src) {
+	glad_trace_next_glReadBuffer(src);
+	GLTraceBeginCall(32);
+	GLTraceWrite(&src, sizeof(src));
+}
+static PFNGLREADPIXELSPROC glad_trace_next_glReadPixels;
+static void APIENTRY glad_trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glad_trace_next_glReadPixels(x, y, width, height, format, type, pixels);
+	GLTraceBeginCall(33);
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixelsOut(pixels, (u64)(GLTraceImageSize(format, type, width, height, 1)));
+}
+static PFNGLDEPTHRANGEPROC glad_trace_next_glDepthRange;
+static void APIENTRY glad_trace_glDepthRange(GLdouble n, GLdouble f) {
+	glad_trace_next_glDepthRange(n, f);
+	GLTraceBeginCall(46);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWrite(&f, sizeof(f));
+}
+static PFNGLVIEWPORTPROC glad_trace_next_glViewport;
+static void APIENTRY glad_trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_next_glViewport(x, y, width, height);
+	GLTraceBeginCall(47);
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLDRAWARRAYSPROC glad_trace_next_glDrawArrays;
+static void APIENTRY glad_trace_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glad_trace_next_glDrawArrays(mode, first, count);
+	GLTraceBeginCall(48);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+}
+static PFNGLDRAWELEMENTSPROC glad_trace_next_glDrawElements;
+static void APIENTRY glad_trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glad_trace_next_glDrawElements(mode, count, type, indices);
+	GLTraceBeginCall(49);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indices);
+}
+static PFNGLPOLYGONOFFSETPROC glad_trace_next_glPolygonOffset;
+static void APIENTRY glad_trace_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glad_trace_next_glPolygonOffset(factor, units);
+	GLTraceBeginCall(50);
+	GLTraceWrite(&factor, sizeof(factor));
+	GLTraceWrite(&units, sizeof(units));
+}
+static PFNGLCOPYTEXIMAGE1DPROC glad_trace_next_glCopyTexImage1D;
+static void APIENTRY glad_trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_trace_next_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	GLTraceBeginCall(51);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&border, sizeof(border));
+}
+static PFNGLCOPYTEXIMAGE2DPROC glad_trace_next_glCopyTexImage2D;
+static void APIENTRY glad_trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_trace_next_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	GLTraceBeginCall(52);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&border, sizeof(border));
+}
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_trace_next_glCopyTexSubImage1D;
+static void APIENTRY glad_trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_trace_next_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	GLTraceBeginCall(53);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+}
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_trace_next_glCopyTexSubImage2D;
+static void APIENTRY glad_trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_next_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	GLTraceBeginCall(54);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLTEXSUBIMAGE1DPROC glad_trace_next_glTexSubImage1D;
+static void APIENTRY glad_trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_next_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	GLTraceBeginCall(55);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixels(pixels, (u64)(GLTraceImageSize(format, type, width, 1, 1)));
+}
+static PFNGLTEXSUBIMAGE2DPROC glad_trace_next_glTexSubImage2D;
+static void APIENTRY glad_trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_next_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	GLTraceBeginCall(56);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixels(pixels, (u64)(GLTraceImageSize(format, type, width, height, 1)));
+}
+static PFNGLBINDTEXTUREPROC glad_trace_next_glBindTexture;
+static void APIENTRY glad_trace_glBindTexture(GLenum target, GLuint texture) {
+	glad_trace_next_glBindTexture(target, texture);
+	GLTraceBeginCall(57);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&texture, sizeof(texture));
+}
+static PFNGLDELETETEXTURESPROC glad_trace_next_glDeleteTextures;
+static void APIENTRY glad_trace_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	glad_trace_next_glDeleteTextures(n, textures);
+	GLTraceBeginCall(58);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(textures, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLGENTEXTURESPROC glad_trace_next_glGenTextures;
+static void APIENTRY glad_trace_glGenTextures(GLsizei n, GLuint *textures) {
+	glad_trace_next_glGenTextures(n, textures);
+	GLTraceBeginCall(59);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(textures, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLDRAWRANGEELEMENTSPROC glad_trace_next_glDrawRangeElements;
+static void APIENTRY glad_trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_trace_next_glDrawRangeElements(mode, start, end, count, type, indices);
+	GLTraceBeginCall(61);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&start, sizeof(start));
+	GLTraceWrite(&end, sizeof(end));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indices);
+}
+static PFNGLTEXIMAGE3DPROC glad_trace_next_glTexImage3D;
+static void APIENTRY glad_trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_next_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	GLTraceBeginCall(62);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&border, sizeof(border));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixels(pixels, (u64)(GLTraceImageSize(format, type, width, height, depth)));
+}
+static PFNGLTEXSUBIMAGE3DPROC glad_trace_next_glTexSubImage3D;
+static void APIENTRY glad_trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_next_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	GLTraceBeginCall(63);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&zoffset, sizeof(zoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixels(pixels, (u64)(GLTraceImageSize(format, type, width, height, depth)));
+}
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_trace_next_glCopyTexSubImage3D;
+static void APIENTRY glad_trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_next_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	GLTraceBeginCall(64);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&zoffset, sizeof(zoffset));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLACTIVETEXTUREPROC glad_trace_next_glActiveTexture;
+static void APIENTRY glad_trace_glActiveTexture(GLenum texture) {
+	glad_trace_next_glActiveTexture(texture);
+	GLTraceBeginCall(65);
+	GLTraceWrite(&texture, sizeof(texture));
+}
+static PFNGLSAMPLECOVERAGEPROC glad_trace_next_glSampleCoverage;
+static void APIENTRY glad_trace_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glad_trace_next_glSampleCoverage(value, invert);
+	GLTraceBeginCall(66);
+	GLTraceWrite(&value, sizeof(value));
+	GLTraceWrite(&invert, sizeof(invert));
+}
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_trace_next_glCompressedTexImage3D;
+static void APIENTRY glad_trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_trace_next_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	GLTraceBeginCall(67);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&border, sizeof(border));
+	GLTraceWrite(&imageSize, sizeof(imageSize));
+	GLTraceWritePixels(data, (u64)(imageSize));
+}
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_trace_next_glCompressedTexImage2D;
+static void APIENTRY glad_trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_trace_next_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	GLTraceBeginCall(68);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&border, sizeof(border));
+	GLTraceWrite(&imageSize, sizeof(imageSize));
+	GLTraceWritePixels(data, (u64)(imageSize));
+}
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_trace_next_glCompressedTexImage1D;
+static void APIENTRY glad_trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_trace_next_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	GLTraceBeginCall(69);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&border, sizeof(border));
+	GLTraceWrite(&imageSize, sizeof(imageSize));
+	GLTraceWritePixels(data, (u64)(imageSize));
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_trace_next_glCompressedTexSubImage3D;
+static void APIENTRY glad_trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_trace_next_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	GLTraceBeginCall(70);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&zoffset, sizeof(zoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&imageSize, sizeof(imageSize));
+	GLTraceWritePixels(data, (u64)(imageSize));
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_trace_next_glCompressedTexSubImage2D;
+static void APIENTRY glad_trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_trace_next_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	GLTraceBeginCall(71);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&imageSize, sizeof(imageSize));
+	GLTraceWritePixels(data, (u64)(imageSize));
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_trace_next_glCompressedTexSubImage1D;
+static void APIENTRY glad_trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_trace_next_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	GLTraceBeginCall(72);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&imageSize, sizeof(imageSize));
+	GLTraceWritePixels(data, (u64)(imageSize));
+}
+static PFNGLBLENDFUNCSEPARATEPROC glad_trace_next_glBlendFuncSeparate;
+static void APIENTRY glad_trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_trace_next_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	GLTraceBeginCall(74);
+	GLTraceWrite(&sfactorRGB, sizeof(sfactorRGB));
+	GLTraceWrite(&dfactorRGB, sizeof(dfactorRGB));
+	GLTraceWrite(&sfactorAlpha, sizeof(sfactorAlpha));
+	GLTraceWrite(&dfactorAlpha, sizeof(dfactorAlpha));
+}
+static PFNGLMULTIDRAWARRAYSPROC glad_trace_next_glMultiDrawArrays;
+static void APIENTRY glad_trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glad_trace_next_glMultiDrawArrays(mode, first, count, drawcount);
+	GLTraceBeginCall(75);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWriteBlob(first, (u64)(drawcount * sizeof(GLint)));
+	GLTraceWriteBlob(count, (u64)(drawcount * sizeof(GLsizei)));
+	GLTraceWrite(&drawcount, sizeof(drawcount));
+}
+static PFNGLMULTIDRAWELEMENTSPROC glad_trace_next_glMultiDrawElements;
+static void APIENTRY glad_trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glad_trace_next_glMultiDrawElements(mode, count, type, indices, drawcount);
+	GLTraceBeginCall(76);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWriteBlob(count, (u64)(drawcount * sizeof(GLsizei)));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(indices, (u64)(drawcount * sizeof(void *)));
+	GLTraceWrite(&drawcount, sizeof(drawcount));
+}
+static PFNGLPOINTPARAMETERFPROC glad_trace_next_glPointParameterf;
+static void APIENTRY glad_trace_glPointParameterf(GLenum pname, GLfloat param) {
+	glad_trace_next_glPointParameterf(pname, param);
+	GLTraceBeginCall(77);
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLPOINTPARAMETERFVPROC glad_trace_next_glPointParameterfv;
+static void APIENTRY glad_trace_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	glad_trace_next_glPointParameterfv(pname, params);
+	GLTraceBeginCall(78);
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(params, (u64)(sizeof(GLfloat)));
+}
+static PFNGLPOINTPARAMETERIPROC glad_trace_next_glPointParameteri;
+static void APIENTRY glad_trace_glPointParameteri(GLenum pname, GLint param) {
+	glad_trace_next_glPointParameteri(pname, param);
+	GLTraceBeginCall(79);
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLPOINTPARAMETERIVPROC glad_trace_next_glPointParameteriv;
+static void APIENTRY glad_trace_glPointParameteriv(GLenum pname, const GLint *params) {
+	glad_trace_next_glPointParameteriv(pname, params);
+	GLTraceBeginCall(80);
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(params, (u64)(sizeof(GLint)));
+}
+static PFNGLBLENDCOLORPROC glad_trace_next_glBlendColor;
+static void APIENTRY glad_trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_trace_next_glBlendColor(red, green, blue, alpha);
+	GLTraceBeginCall(81);
+	GLTraceWrite(&red, sizeof(red));
+	GLTraceWrite(&green, sizeof(green));
+	GLTraceWrite(&blue, sizeof(blue));
+	GLTraceWrite(&alpha, sizeof(alpha));
+}
+static PFNGLBLENDEQUATIONPROC glad_trace_next_glBlendEquation;
+static void APIENTRY glad_trace_glBlendEquation(GLenum mode) {
+	glad_trace_next_glBlendEquation(mode);
+	GLTraceBeginCall(82);
+	GLTraceWrite(&mode, sizeof(mode));
+}
+static PFNGLGENQUERIESPROC glad_trace_next_glGenQueries;
+static void APIENTRY glad_trace_glGenQueries(GLsizei n, GLuint *ids) {
+	glad_trace_next_glGenQueries(n, ids);
+	GLTraceBeginCall(83);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(ids, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLDELETEQUERIESPROC glad_trace_next_glDeleteQueries;
+static void APIENTRY glad_trace_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	glad_trace_next_glDeleteQueries(n, ids);
+	GLTraceBeginCall(84);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(ids, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLBEGINQUERYPROC glad_trace_next_glBeginQuery;
+static void APIENTRY glad_trace_glBeginQuery(GLenum target, GLuint id) {
+	glad_trace_next_glBeginQuery(target, id);
+	GLTraceBeginCall(86);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&id, sizeof(id));
+}
+static PFNGLENDQUERYPROC glad_trace_next_glEndQuery;
+static void APIENTRY glad_trace_glEndQuery(GLenum target) {
+	glad_trace_next_glEndQuery(target);
+	GLTraceBeginCall(87);
+	GLTraceWrite(&target, sizeof(target));
+}
+static PFNGLBINDBUFFERPROC glad_trace_next_glBindBuffer;
+static void APIENTRY glad_trace_glBindBuffer(GLenum target, GLuint buffer) {
+	glad_trace_next_glBindBuffer(target, buffer);
+	GLTraceBeginCall(91);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&buffer, sizeof(buffer));
+}
+static PFNGLDELETEBUFFERSPROC glad_trace_next_glDeleteBuffers;
+static void APIENTRY glad_trace_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glad_trace_next_glDeleteBuffers(n, buffers);
+	GLTraceBeginCall(92);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(buffers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLGENBUFFERSPROC glad_trace_next_glGenBuffers;
+static void APIENTRY glad_trace_glGenBuffers(GLsizei n, GLuint *buffers) {
+	glad_trace_next_glGenBuffers(n, buffers);
+	GLTraceBeginCall(93);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(buffers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLBUFFERDATAPROC glad_trace_next_glBufferData;
+static void APIENTRY glad_trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_trace_next_glBufferData(target, size, data, usage);
+	GLTraceBeginCall(95);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWriteBlob(data, (u64)(size));
+	GLTraceWrite(&usage, sizeof(usage));
+}
+static PFNGLBUFFERSUBDATAPROC glad_trace_next_glBufferSubData;
+static void APIENTRY glad_trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_trace_next_glBufferSubData(target, offset, size, data);
+	GLTraceBeginCall(96);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWriteBlob(data, (u64)(size));
+}
+static PFNGLMAPBUFFERPROC glad_trace_next_glMapBuffer;
+static void * APIENTRY glad_trace_glMapBuffer(GLenum target, GLenum access) {
+	void * glad_result = glad_trace_next_glMapBuffer(target, access);
+	GLTraceUnsupported(98);
+	return glad_result;
+}
+static PFNGLUNMAPBUFFERPROC glad_trace_next_glUnmapBuffer;
+static GLboolean APIENTRY glad_trace_glUnmapBuffer(GLenum target) {
+	GLboolean glad_result = glad_trace_next_glUnmapBuffer(target);
+	GLTraceUnsupported(99);
+	return glad_result;
+}
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_trace_next_glBlendEquationSeparate;
+static void APIENTRY glad_trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glad_trace_next_glBlendEquationSeparate(modeRGB, modeAlpha);
+	GLTraceBeginCall(102);
+	GLTraceWrite(&modeRGB, sizeof(modeRGB));
+	GLTraceWrite(&modeAlpha, sizeof(modeAlpha));
+}
+static PFNGLDRAWBUFFERSPROC glad_trace_next_glDrawBuffers;
+static void APIENTRY glad_trace_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	glad_trace_next_glDrawBuffers(n, bufs);
+	GLTraceBeginCall(103);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(bufs, (u64)(n * sizeof(GLenum)));
+}
+static PFNGLSTENCILOPSEPARATEPROC glad_trace_next_glStencilOpSeparate;
+static void APIENTRY glad_trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_trace_next_glStencilOpSeparate(face, sfail, dpfail, dppass);
+	GLTraceBeginCall(104);
+	GLTraceWrite(&face, sizeof(face));
+	GLTraceWrite(&sfail, sizeof(sfail));
+	GLTraceWrite(&dpfail, sizeof(dpfail));
+	GLTraceWrite(&dppass, sizeof(dppass));
+}
+static PFNGLSTENCILFUNCSEPARATEPROC glad_trace_next_glStencilFuncSeparate;
+static void APIENTRY glad_trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glad_trace_next_glStencilFuncSeparate(face, func, ref, mask);
+	GLTraceBeginCall(105);
+	GLTraceWrite(&face, sizeof(face));
+	GLTraceWrite(&func, sizeof(func));
+	GLTraceWrite(&ref, sizeof(ref));
+	GLTraceWrite(&mask, sizeof(mask));
+}
+static PFNGLSTENCILMASKSEPARATEPROC glad_trace_next_glStencilMaskSeparate;
+static void APIENTRY glad_trace_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glad_trace_next_glStencilMaskSeparate(face, mask);
+	GLTraceBeginCall(106);
+	GLTraceWrite(&face, sizeof(face));
+	GLTraceWrite(&mask, sizeof(mask));
+}
+static PFNGLATTACHSHADERPROC glad_trace_next_glAttachShader;
+static void APIENTRY glad_trace_glAttachShader(GLuint program, GLuint shader) {
+	glad_trace_next_glAttachShader(program, shader);
+	GLTraceBeginCall(107);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&shader, sizeof(shader));
+}
+static PFNGLBINDATTRIBLOCATIONPROC glad_trace_next_glBindAttribLocation;
+static void APIENTRY glad_trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glad_trace_next_glBindAttribLocation(program, index, name);
+	GLTraceBeginCall(108);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteString(name, -1);
+}
+static PFNGLCOMPILESHADERPROC glad_trace_next_glCompileShader;
+static void APIENTRY glad_trace_glCompileShader(GLuint shader) {
+	glad_trace_next_glCompileShader(shader);
+	GLTraceBeginCall(109);
+	GLTraceWrite(&shader, sizeof(shader));
+}
+static PFNGLCREATEPROGRAMPROC glad_trace_next_glCreateProgram;
+static GLuint APIENTRY glad_trace_glCreateProgram(void) {
+	GLuint glad_result = glad_trace_next_glCreateProgram();
+	GLTraceBeginCall(110);
+	{ u64 glad_handle = (u64)(uintptr_t)glad_result; GLTraceWrite(&glad_handle, sizeof(glad_handle)); }
+	return glad_result;
+}
+static PFNGLCREATESHADERPROC glad_trace_next_glCreateShader;
+static GLuint APIENTRY glad_trace_glCreateShader(GLenum type) {
+	GLuint glad_result = glad_trace_next_glCreateShader(type);
+	GLTraceBeginCall(111);
+	GLTraceWrite(&type, sizeof(type));
+	{ u64 glad_handle = (u64)(uintptr_t)glad_result; GLTraceWrite(&glad_handle, sizeof(glad_handle)); }
+	return glad_result;
+}
+static PFNGLDELETEPROGRAMPROC glad_trace_next_glDeleteProgram;
+static void APIENTRY glad_trace_glDeleteProgram(GLuint program) {
+	glad_trace_next_glDeleteProgram(program);
+	GLTraceBeginCall(112);
+	GLTraceWrite(&program, sizeof(program));
+}
+static PFNGLDELETESHADERPROC glad_trace_next_glDeleteShader;
+static void APIENTRY glad_trace_glDeleteShader(GLuint shader) {
+	glad_trace_next_glDeleteShader(shader);
+	GLTraceBeginCall(113);
+	GLTraceWrite(&shader, sizeof(shader));
+}
+static PFNGLDETACHSHADERPROC glad_trace_next_glDetachShader;
+static void APIENTRY glad_trace_glDetachShader(GLuint program, GLuint shader) {
+	glad_trace_next_glDetachShader(program, shader);
+	GLTraceBeginCall(114);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&shader, sizeof(shader));
+}
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_trace_next_glDisableVertexAttribArray;
+static void APIENTRY glad_trace_glDisableVertexAttribArray(GLuint index) {
+	glad_trace_next_glDisableVertexAttribArray(index);
+	GLTraceBeginCall(115);
+	GLTraceWrite(&index, sizeof(index));
+}
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_trace_next_glEnableVertexAttribArray;
+static void APIENTRY glad_trace_glEnableVertexAttribArray(GLuint index) {
+	glad_trace_next_glEnableVertexAttribArray(index);
+	GLTraceBeginCall(116);
+	GLTraceWrite(&index, sizeof(index));
+}
+static PFNGLLINKPROGRAMPROC glad_trace_next_glLinkProgram;
+static void APIENTRY glad_trace_glLinkProgram(GLuint program) {
+	glad_trace_next_glLinkProgram(program);
+	GLTraceBeginCall(135);
+	GLTraceWrite(&program, sizeof(program));
+}
+static PFNGLSHADERSOURCEPROC glad_trace_next_glShaderSource;
+static void APIENTRY glad_trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glad_trace_next_glShaderSource(shader, count, string, length);
+	GLTraceBeginCall(136);
+	GLTraceWrite(&shader, sizeof(shader));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteStrings(count, string, length);
+}
+static PFNGLUSEPROGRAMPROC glad_trace_next_glUseProgram;
+static void APIENTRY glad_trace_glUseProgram(GLuint program) {
+	glad_trace_next_glUseProgram(program);
+	GLTraceBeginCall(137);
+	GLTraceWrite(&program, sizeof(program));
+}
+static PFNGLUNIFORM1FPROC glad_trace_next_glUniform1f;
+static void APIENTRY glad_trace_glUniform1f(GLint location, GLfloat v0) {
+	glad_trace_next_glUniform1f(location, v0);
+	GLTraceBeginCall(138);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+}
+static PFNGLUNIFORM2FPROC glad_trace_next_glUniform2f;
+static void APIENTRY glad_trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glad_trace_next_glUniform2f(location, v0, v1);
+	GLTraceBeginCall(139);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+}
+static PFNGLUNIFORM3FPROC glad_trace_next_glUniform3f;
+static void APIENTRY glad_trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_trace_next_glUniform3f(location, v0, v1, v2);
+	GLTraceBeginCall(140);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+}
+static PFNGLUNIFORM4FPROC glad_trace_next_glUniform4f;
+static void APIENTRY glad_trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_trace_next_glUniform4f(location, v0, v1, v2, v3);
+	GLTraceBeginCall(141);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+	GLTraceWrite(&v3, sizeof(v3));
+}
+static PFNGLUNIFORM1IPROC glad_trace_next_glUniform1i;
+static void APIENTRY glad_trace_glUniform1i(GLint location, GLint v0) {
+	glad_trace_next_glUniform1i(location, v0);
+	GLTraceBeginCall(142);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+}
+static PFNGLUNIFORM2IPROC glad_trace_next_glUniform2i;
+static void APIENTRY glad_trace_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glad_trace_next_glUniform2i(location, v0, v1);
+	GLTraceBeginCall(143);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+}
+static PFNGLUNIFORM3IPROC glad_trace_next_glUniform3i;
+static void APIENTRY glad_trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_trace_next_glUniform3i(location, v0, v1, v2);
+	GLTraceBeginCall(144);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+}
+static PFNGLUNIFORM4IPROC glad_trace_next_glUniform4i;
+static void APIENTRY glad_trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_trace_next_glUniform4i(location, v0, v1, v2, v3);
+	GLTraceBeginCall(145);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+	GLTraceWrite(&v3, sizeof(v3));
+}
+static PFNGLUNIFORM1FVPROC glad_trace_next_glUniform1fv;
+static void APIENTRY glad_trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_next_glUniform1fv(location, count, value);
+	GLTraceBeginCall(146);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 1 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORM2FVPROC glad_trace_next_glUniform2fv;
+static void APIENTRY glad_trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_next_glUniform2fv(location, count, value);
+	GLTraceBeginCall(147);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 2 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORM3FVPROC glad_trace_next_glUniform3fv;
+static void APIENTRY glad_trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_next_glUniform3fv(location, count, value);
+	GLTraceBeginCall(148);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 3 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORM4FVPROC glad_trace_next_glUniform4fv;
+static void APIENTRY glad_trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_next_glUniform4fv(location, count, value);
+	GLTraceBeginCall(149);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORM1IVPROC glad_trace_next_glUniform1iv;
+static void APIENTRY glad_trace_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glad_trace_next_glUniform1iv(location, count, value);
+	GLTraceBeginCall(150);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 1 * sizeof(GLint)));
+}
+static PFNGLUNIFORM2IVPROC glad_trace_next_glUniform2iv;
+static void APIENTRY glad_trace_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glad_trace_next_glUniform2iv(location, count, value);
+	GLTraceBeginCall(151);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 2 * sizeof(GLint)));
+}
+static PFNGLUNIFORM3IVPROC glad_trace_next_glUniform3iv;
+static void APIENTRY glad_trace_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glad_trace_next_glUniform3iv(location, count, value);
+	GLTraceBeginCall(152);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 3 * sizeof(GLint)));
+}
+static PFNGLUNIFORM4IVPROC glad_trace_next_glUniform4iv;
+static void APIENTRY glad_trace_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glad_trace_next_glUniform4iv(location, count, value);
+	GLTraceBeginCall(153);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLint)));
+}
+static PFNGLUNIFORMMATRIX2FVPROC glad_trace_next_glUniformMatrix2fv;
+static void APIENTRY glad_trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glUniformMatrix2fv(location, count, transpose, value);
+	GLTraceBeginCall(154);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORMMATRIX3FVPROC glad_trace_next_glUniformMatrix3fv;
+static void APIENTRY glad_trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glUniformMatrix3fv(location, count, transpose, value);
+	GLTraceBeginCall(155);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 9 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORMMATRIX4FVPROC glad_trace_next_glUniformMatrix4fv;
+static void APIENTRY glad_trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glUniformMatrix4fv(location, count, transpose, value);
+	GLTraceBeginCall(156);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 16 * sizeof(GLfloat)));
+}
+static PFNGLVALIDATEPROGRAMPROC glad_trace_next_glValidateProgram;
+static void APIENTRY glad_trace_glValidateProgram(GLuint program) {
+	glad_trace_next_glValidateProgram(program);
+	GLTraceBeginCall(157);
+	GLTraceWrite(&program, sizeof(program));
+}
+static PFNGLVERTEXATTRIB1DPROC glad_trace_next_glVertexAttrib1d;
+static void APIENTRY glad_trace_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glad_trace_next_glVertexAttrib1d(index, x);
+	GLTraceBeginCall(158);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+}
+static PFNGLVERTEXATTRIB1DVPROC glad_trace_next_glVertexAttrib1dv;
+static void APIENTRY glad_trace_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glad_trace_next_glVertexAttrib1dv(index, v);
+	GLTraceBeginCall(159);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(1 * sizeof(GLdouble)));
+}
+static PFNGLVERTEXATTRIB1FPROC glad_trace_next_glVertexAttrib1f;
+static void APIENTRY glad_trace_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glad_trace_next_glVertexAttrib1f(index, x);
+	GLTraceBeginCall(160);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+}
+static PFNGLVERTEXATTRIB1FVPROC glad_trace_next_glVertexAttrib1fv;
+static void APIENTRY glad_trace_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glad_trace_next_glVertexAttrib1fv(index, v);
+	GLTraceBeginCall(161);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(1 * sizeof(GLfloat)));
+}
+static PFNGLVERTEXATTRIB1SPROC glad_trace_next_glVertexAttrib1s;
+static void APIENTRY glad_trace_glVertexAttrib1s(GLuint index, GLshort x) {
+	glad_trace_next_glVertexAttrib1s(index, x);
+	GLTraceBeginCall(162);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+}
+static PFNGLVERTEXATTRIB1SVPROC glad_trace_next_glVertexAttrib1sv;
+static void APIENTRY glad_trace_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	glad_trace_next_glVertexAttrib1sv(index, v);
+	GLTraceBeginCall(163);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(1 * sizeof(GLshort)));
+}
+static PFNGLVERTEXATTRIB2DPROC glad_trace_next_glVertexAttrib2d;
+static void APIENTRY glad_trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_trace_next_glVertexAttrib2d(index, x, y);
+	GLTraceBeginCall(164);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+}
+static PFNGLVERTEXATTRIB2DVPROC glad_trace_next_glVertexAttrib2dv;
+static void APIENTRY glad_trace_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glad_trace_next_glVertexAttrib2dv(index, v);
+	GLTraceBeginCall(165);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(2 * sizeof(GLdouble)));
+}
+static PFNGLVERTEXATTRIB2FPROC glad_trace_next_glVertexAttrib2f;
+static void APIENTRY glad_trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glad_trace_next_glVertexAttrib2f(index, x, y);
+	GLTraceBeginCall(166);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+}
+static PFNGLVERTEXATTRIB2FVPROC glad_trace_next_glVertexAttrib2fv;
+static void APIENTRY glad_trace_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glad_trace_next_glVertexAttrib2fv(index, v);
+	GLTraceBeginCall(167);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(2 * sizeof(GLfloat)));
+}
+static PFNGLVERTEXATTRIB2SPROC glad_trace_next_glVertexAttrib2s;
+static void APIENTRY glad_trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glad_trace_next_glVertexAttrib2s(index, x, y);
+	GLTraceBeginCall(168);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+}
+static PFNGLVERTEXATTRIB2SVPROC glad_trace_next_glVertexAttrib2sv;
+static void APIENTRY glad_trace_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	glad_trace_next_glVertexAttrib2sv(index, v);
+	GLTraceBeginCall(169);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(2 * sizeof(GLshort)));
+}
+static PFNGLVERTEXATTRIB3DPROC glad_trace_next_glVertexAttrib3d;
+static void APIENTRY glad_trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_next_glVertexAttrib3d(index, x, y, z);
+	GLTraceBeginCall(170);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+}
+static PFNGLVERTEXATTRIB3DVPROC glad_trace_next_glVertexAttrib3dv;
+static void APIENTRY glad_trace_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glad_trace_next_glVertexAttrib3dv(index, v);
+	GLTraceBeginCall(171);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(3 * sizeof(GLdouble)));
+}
+static PFNGLVERTEXATTRIB3FPROC glad_trace_next_glVertexAttrib3f;
+static void APIENTRY glad_trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_trace_next_glVertexAttrib3f(index, x, y, z);
+	GLTraceBeginCall(172);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+}
+static PFNGLVERTEXATTRIB3FVPROC glad_trace_next_glVertexAttrib3fv;
+static void APIENTRY glad_trace_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glad_trace_next_glVertexAttrib3fv(index, v);
+	GLTraceBeginCall(173);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(3 * sizeof(GLfloat)));
+}
+static PFNGLVERTEXATTRIB3SPROC glad_trace_next_glVertexAttrib3s;
+static void APIENTRY glad_trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_trace_next_glVertexAttrib3s(index, x, y, z);
+	GLTraceBeginCall(174);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+}
+static PFNGLVERTEXATTRIB3SVPROC glad_trace_next_glVertexAttrib3sv;
+static void APIENTRY glad_trace_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	glad_trace_next_glVertexAttrib3sv(index, v);
+	GLTraceBeginCall(175);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(3 * sizeof(GLshort)));
+}
+static PFNGLVERTEXATTRIB4NBVPROC glad_trace_next_glVertexAttrib4Nbv;
+static void APIENTRY glad_trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glad_trace_next_glVertexAttrib4Nbv(index, v);
+	GLTraceBeginCall(176);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLbyte)));
+}
+static PFNGLVERTEXATTRIB4NIVPROC glad_trace_next_glVertexAttrib4Niv;
+static void APIENTRY glad_trace_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	glad_trace_next_glVertexAttrib4Niv(index, v);
+	GLTraceBeginCall(177);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLint)));
+}
+static PFNGLVERTEXATTRIB4NSVPROC glad_trace_next_glVertexAttrib4Nsv;
+static void APIENTRY glad_trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glad_trace_next_glVertexAttrib4Nsv(index, v);
+	GLTraceBeginCall(178);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLshort)));
+}
+static PFNGLVERTEXATTRIB4NUBPROC glad_trace_next_glVertexAttrib4Nub;
+static void APIENTRY glad_trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_trace_next_glVertexAttrib4Nub(index, x, y, z, w);
+	GLTraceBeginCall(179);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+	GLTraceWrite(&w, sizeof(w));
+}
+static PFNGLVERTEXATTRIB4NUBVPROC glad_trace_next_glVertexAttrib4Nubv;
+static void APIENTRY glad_trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glad_trace_next_glVertexAttrib4Nubv(index, v);
+	GLTraceBeginCall(180);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLubyte)));
+}
+static PFNGLVERTEXATTRIB4NUIVPROC glad_trace_next_glVertexAttrib4Nuiv;
+static void APIENTRY glad_trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glad_trace_next_glVertexAttrib4Nuiv(index, v);
+	GLTraceBeginCall(181);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLuint)));
+}
+static PFNGLVERTEXATTRIB4NUSVPROC glad_trace_next_glVertexAttrib4Nusv;
+static void APIENTRY glad_trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glad_trace_next_glVertexAttrib4Nusv(index, v);
+	GLTraceBeginCall(182);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLushort)));
+}
+static PFNGLVERTEXATTRIB4BVPROC glad_trace_next_glVertexAttrib4bv;
+static void APIENTRY glad_trace_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glad_trace_next_glVertexAttrib4bv(index, v);
+	GLTraceBeginCall(183);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLbyte)));
+}
+static PFNGLVERTEXATTRIB4DPROC glad_trace_next_glVertexAttrib4d;
+static void APIENTRY glad_trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_trace_next_glVertexAttrib4d(index, x, y, z, w);
+	GLTraceBeginCall(184);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+	GLTraceWrite(&w, sizeof(w));
+}
+static PFNGLVERTEXATTRIB4DVPROC glad_trace_next_glVertexAttrib4dv;
+static void APIENTRY glad_trace_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glad_trace_next_glVertexAttrib4dv(index, v);
+	GLTraceBeginCall(185);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLdouble)));
+}
+static PFNGLVERTEXATTRIB4FPROC glad_trace_next_glVertexAttrib4f;
+static void APIENTRY glad_trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_trace_next_glVertexAttrib4f(index, x, y, z, w);
+	GLTraceBeginCall(186);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+	GLTraceWrite(&w, sizeof(w));
+}
+static PFNGLVERTEXATTRIB4FVPROC glad_trace_next_glVertexAttrib4fv;
+static void APIENTRY glad_trace_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glad_trace_next_glVertexAttrib4fv(index, v);
+	GLTraceBeginCall(187);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLfloat)));
+}
+static PFNGLVERTEXATTRIB4IVPROC glad_trace_next_glVertexAttrib4iv;
+static void APIENTRY glad_trace_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	glad_trace_next_glVertexAttrib4iv(index, v);
+	GLTraceBeginCall(188);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLint)));
+}
+static PFNGLVERTEXATTRIB4SPROC glad_trace_next_glVertexAttrib4s;
+static void APIENTRY glad_trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_trace_next_glVertexAttrib4s(index, x, y, z, w);
+	GLTraceBeginCall(189);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+	GLTraceWrite(&w, sizeof(w));
+}
+static PFNGLVERTEXATTRIB4SVPROC glad_trace_next_glVertexAttrib4sv;
+static void APIENTRY glad_trace_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	glad_trace_next_glVertexAttrib4sv(index, v);
+	GLTraceBeginCall(190);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLshort)));
+}
+static PFNGLVERTEXATTRIB4UBVPROC glad_trace_next_glVertexAttrib4ubv;
+static void APIENTRY glad_trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glad_trace_next_glVertexAttrib4ubv(index, v);
+	GLTraceBeginCall(191);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLubyte)));
+}
+static PFNGLVERTEXATTRIB4UIVPROC glad_trace_next_glVertexAttrib4uiv;
+static void APIENTRY glad_trace_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glad_trace_next_glVertexAttrib4uiv(index, v);
+	GLTraceBeginCall(192);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLuint)));
+}
+static PFNGLVERTEXATTRIB4USVPROC glad_trace_next_glVertexAttrib4usv;
+static void APIENTRY glad_trace_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	glad_trace_next_glVertexAttrib4usv(index, v);
+	GLTraceBeginCall(193);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLushort)));
+}
+static PFNGLVERTEXATTRIBPOINTERPROC glad_trace_next_glVertexAttribPointer;
+static void APIENTRY glad_trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_trace_next_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	GLTraceBeginCall(194);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWrite(&stride, sizeof(stride));
+	GLTraceWriteOffset(pointer);
+}
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_trace_next_glUniformMatrix2x3fv;
+static void APIENTRY glad_trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glUniformMatrix2x3fv(location, count, transpose, value);
+	GLTraceBeginCall(195);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 6 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_trace_next_glUniformMatrix3x2fv;
+static void APIENTRY glad_trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glUniformMatrix3x2fv(location, count, transpose, value);
+	GLTraceBeginCall(196);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 6 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_trace_next_glUniformMatrix2x4fv;
+static void APIENTRY glad_trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glUniformMatrix2x4fv(location, count, transpose, value);
+	GLTraceBeginCall(197);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 8 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_trace_next_glUniformMatrix4x2fv;
+static void APIENTRY glad_trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glUniformMatrix4x2fv(location, count, transpose, value);
+	GLTraceBeginCall(198);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 8 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_trace_next_glUniformMatrix3x4fv;
+static void APIENTRY glad_trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glUniformMatrix3x4fv(location, count, transpose, value);
+	GLTraceBeginCall(199);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 12 * sizeof(GLfloat)));
+}
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_trace_next_glUniformMatrix4x3fv;
+static void APIENTRY glad_trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glUniformMatrix4x3fv(location, count, transpose, value);
+	GLTraceBeginCall(200);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 12 * sizeof(GLfloat)));
+}
+static PFNGLCOLORMASKIPROC glad_trace_next_glColorMaski;
+static void APIENTRY glad_trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_trace_next_glColorMaski(index, r, g, b, a);
+	GLTraceBeginCall(201);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&r, sizeof(r));
+	GLTraceWrite(&g, sizeof(g));
+	GLTraceWrite(&b, sizeof(b));
+	GLTraceWrite(&a, sizeof(a));
+}
+static PFNGLENABLEIPROC glad_trace_next_glEnablei;
+static void APIENTRY glad_trace_glEnablei(GLenum target, GLuint index) {
+	glad_trace_next_glEnablei(target, index);
+	GLTraceBeginCall(204);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&index, sizeof(index));
+}
+static PFNGLDISABLEIPROC glad_trace_next_glDisablei;
+static void APIENTRY glad_trace_glDisablei(GLenum target, GLuint index) {
+	glad_trace_next_glDisablei(target, index);
+	GLTraceBeginCall(205);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&index, sizeof(index));
+}
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_trace_next_glBeginTransformFeedback;
+static void APIENTRY glad_trace_glBeginTransformFeedback(GLenum primitiveMode) {
+	glad_trace_next_glBeginTransformFeedback(primitiveMode);
+	GLTraceBeginCall(207);
+	GLTraceWrite(&primitiveMode, sizeof(primitiveMode));
+}
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_trace_next_glEndTransformFeedback;
+static void APIENTRY glad_trace_glEndTransformFeedback(void) {
+	glad_trace_next_glEndTransformFeedback();
+	GLTraceBeginCall(208);
+}
+static PFNGLBINDBUFFERRANGEPROC glad_trace_next_glBindBufferRange;
+static void APIENTRY glad_trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_trace_next_glBindBufferRange(target, index, buffer, offset, size);
+	GLTraceBeginCall(209);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&size, sizeof(size));
+}
+static PFNGLBINDBUFFERBASEPROC glad_trace_next_glBindBufferBase;
+static void APIENTRY glad_trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glad_trace_next_glBindBufferBase(target, index, buffer);
+	GLTraceBeginCall(210);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&buffer, sizeof(buffer));
+}
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_trace_next_glTransformFeedbackVaryings;
+static void APIENTRY glad_trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_trace_next_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	GLTraceBeginCall(211);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteStrings(count, varyings, NULL);
+	GLTraceWrite(&bufferMode, sizeof(bufferMode));
+}
+static PFNGLCLAMPCOLORPROC glad_trace_next_glClampColor;
+static void APIENTRY glad_trace_glClampColor(GLenum target, GLenum clamp) {
+	glad_trace_next_glClampColor(target, clamp);
+	GLTraceBeginCall(213);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&clamp, sizeof(clamp));
+}
+static PFNGLBEGINCONDITIONALRENDERPROC glad_trace_next_glBeginConditionalRender;
+static void APIENTRY glad_trace_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glad_trace_next_glBeginConditionalRender(id, mode);
+	GLTraceBeginCall(214);
+	GLTraceWrite(&id, sizeof(id));
+	GLTraceWrite(&mode, sizeof(mode));
+}
+static PFNGLENDCONDITIONALRENDERPROC glad_trace_next_glEndConditionalRender;
+static void APIENTRY glad_trace_glEndConditionalRender(void) {
+	glad_trace_next_glEndConditionalRender();
+	GLTraceBeginCall(215);
+}
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_trace_next_glVertexAttribIPointer;
+static void APIENTRY glad_trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_next_glVertexAttribIPointer(index, size, type, stride, pointer);
+	GLTraceBeginCall(216);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&stride, sizeof(stride));
+	GLTraceWriteOffset(pointer);
+}
+static PFNGLVERTEXATTRIBI1IPROC glad_trace_next_glVertexAttribI1i;
+static void APIENTRY glad_trace_glVertexAttribI1i(GLuint index, GLint x) {
+	glad_trace_next_glVertexAttribI1i(index, x);
+	GLTraceBeginCall(219);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+}
+static PFNGLVERTEXATTRIBI2IPROC glad_trace_next_glVertexAttribI2i;
+static void APIENTRY glad_trace_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glad_trace_next_glVertexAttribI2i(index, x, y);
+	GLTraceBeginCall(220);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+}
+static PFNGLVERTEXATTRIBI3IPROC glad_trace_next_glVertexAttribI3i;
+static void APIENTRY glad_trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glad_trace_next_glVertexAttribI3i(index, x, y, z);
+	GLTraceBeginCall(221);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+}
+static PFNGLVERTEXATTRIBI4IPROC glad_trace_next_glVertexAttribI4i;
+static void APIENTRY glad_trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_trace_next_glVertexAttribI4i(index, x, y, z, w);
+	GLTraceBeginCall(222);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+	GLTraceWrite(&w, sizeof(w));
+}
+static PFNGLVERTEXATTRIBI1UIPROC glad_trace_next_glVertexAttribI1ui;
+static void APIENTRY glad_trace_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glad_trace_next_glVertexAttribI1ui(index, x);
+	GLTraceBeginCall(223);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+}
+static PFNGLVERTEXATTRIBI2UIPROC glad_trace_next_glVertexAttribI2ui;
+static void APIENTRY glad_trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glad_trace_next_glVertexAttribI2ui(index, x, y);
+	GLTraceBeginCall(224);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+}
+static PFNGLVERTEXATTRIBI3UIPROC glad_trace_next_glVertexAttribI3ui;
+static void APIENTRY glad_trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_trace_next_glVertexAttribI3ui(index, x, y, z);
+	GLTraceBeginCall(225);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+}
+static PFNGLVERTEXATTRIBI4UIPROC glad_trace_next_glVertexAttribI4ui;
+static void APIENTRY glad_trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_trace_next_glVertexAttribI4ui(index, x, y, z, w);
+	GLTraceBeginCall(226);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+	GLTraceWrite(&w, sizeof(w));
+}
+static PFNGLVERTEXATTRIBI1IVPROC glad_trace_next_glVertexAttribI1iv;
+static void APIENTRY glad_trace_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	glad_trace_next_glVertexAttribI1iv(index, v);
+	GLTraceBeginCall(227);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(1 * sizeof(GLint)));
+}
+static PFNGLVERTEXATTRIBI2IVPROC glad_trace_next_glVertexAttribI2iv;
+static void APIENTRY glad_trace_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	glad_trace_next_glVertexAttribI2iv(index, v);
+	GLTraceBeginCall(228);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(2 * sizeof(GLint)));
+}
+static PFNGLVERTEXATTRIBI3IVPROC glad_trace_next_glVertexAttribI3iv;
+static void APIENTRY glad_trace_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	glad_trace_next_glVertexAttribI3iv(index, v);
+	GLTraceBeginCall(229);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(3 * sizeof(GLint)));
+}
+static PFNGLVERTEXATTRIBI4IVPROC glad_trace_next_glVertexAttribI4iv;
+static void APIENTRY glad_trace_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	glad_trace_next_glVertexAttribI4iv(index, v);
+	GLTraceBeginCall(230);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLint)));
+}
+static PFNGLVERTEXATTRIBI1UIVPROC glad_trace_next_glVertexAttribI1uiv;
+static void APIENTRY glad_trace_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glad_trace_next_glVertexAttribI1uiv(index, v);
+	GLTraceBeginCall(231);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(1 * sizeof(GLuint)));
+}
+static PFNGLVERTEXATTRIBI2UIVPROC glad_trace_next_glVertexAttribI2uiv;
+static void APIENTRY glad_trace_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glad_trace_next_glVertexAttribI2uiv(index, v);
+	GLTraceBeginCall(232);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(2 * sizeof(GLuint)));
+}
+static PFNGLVERTEXATTRIBI3UIVPROC glad_trace_next_glVertexAttribI3uiv;
+static void APIENTRY glad_trace_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glad_trace_next_glVertexAttribI3uiv(index, v);
+	GLTraceBeginCall(233);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(3 * sizeof(GLuint)));
+}
+static PFNGLVERTEXATTRIBI4UIVPROC glad_trace_next_glVertexAttribI4uiv;
+static void APIENTRY glad_trace_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glad_trace_next_glVertexAttribI4uiv(index, v);
+	GLTraceBeginCall(234);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLuint)));
+}
+static PFNGLVERTEXATTRIBI4BVPROC glad_trace_next_glVertexAttribI4bv;
+static void APIENTRY glad_trace_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glad_trace_next_glVertexAttribI4bv(index, v);
+	GLTraceBeginCall(235);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLbyte)));
+}
+static PFNGLVERTEXATTRIBI4SVPROC glad_trace_next_glVertexAttribI4sv;
+static void APIENTRY glad_trace_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	glad_trace_next_glVertexAttribI4sv(index, v);
+	GLTraceBeginCall(236);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLshort)));
+}
+static PFNGLVERTEXATTRIBI4UBVPROC glad_trace_next_glVertexAttribI4ubv;
+static void APIENTRY glad_trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glad_trace_next_glVertexAttribI4ubv(index, v);
+	GLTraceBeginCall(237);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLubyte)));
+}
+static PFNGLVERTEXATTRIBI4USVPROC glad_trace_next_glVertexAttribI4usv;
+static void APIENTRY glad_trace_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	glad_trace_next_glVertexAttribI4usv(index, v);
+	GLTraceBeginCall(238);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLushort)));
+}
+static PFNGLBINDFRAGDATALOCATIONPROC glad_trace_next_glBindFragDataLocation;
+static void APIENTRY glad_trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glad_trace_next_glBindFragDataLocation(program, color, name);
+	GLTraceBeginCall(240);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&color, sizeof(color));
+	GLTraceWriteString(name, -1);
+}
+static PFNGLUNIFORM1UIPROC glad_trace_next_glUniform1ui;
+static void APIENTRY glad_trace_glUniform1ui(GLint location, GLuint v0) {
+	glad_trace_next_glUniform1ui(location, v0);
+	GLTraceBeginCall(242);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+}
+static PFNGLUNIFORM2UIPROC glad_trace_next_glUniform2ui;
+static void APIENTRY glad_trace_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glad_trace_next_glUniform2ui(location, v0, v1);
+	GLTraceBeginCall(243);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+}
+static PFNGLUNIFORM3UIPROC glad_trace_next_glUniform3ui;
+static void APIENTRY glad_trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_trace_next_glUniform3ui(location, v0, v1, v2);
+	GLTraceBeginCall(244);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+}
+static PFNGLUNIFORM4UIPROC glad_trace_next_glUniform4ui;
+static void APIENTRY glad_trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_trace_next_glUniform4ui(location, v0, v1, v2, v3);
+	GLTraceBeginCall(245);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+	GLTraceWrite(&v3, sizeof(v3));
+}
+static PFNGLUNIFORM1UIVPROC glad_trace_next_glUniform1uiv;
+static void APIENTRY glad_trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_next_glUniform1uiv(location, count, value);
+	GLTraceBeginCall(246);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 1 * sizeof(GLuint)));
+}
+static PFNGLUNIFORM2UIVPROC glad_trace_next_glUniform2uiv;
+static void APIENTRY glad_trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_next_glUniform2uiv(location, count, value);
+	GLTraceBeginCall(247);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 2 * sizeof(GLuint)));
+}
+static PFNGLUNIFORM3UIVPROC glad_trace_next_glUniform3uiv;
+static void APIENTRY glad_trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_next_glUniform3uiv(location, count, value);
+	GLTraceBeginCall(248);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 3 * sizeof(GLuint)));
+}
+static PFNGLUNIFORM4UIVPROC glad_trace_next_glUniform4uiv;
+static void APIENTRY glad_trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_next_glUniform4uiv(location, count, value);
+	GLTraceBeginCall(249);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLuint)));
+}
+static PFNGLTEXPARAMETERIIVPROC glad_trace_next_glTexParameterIiv;
+static void APIENTRY glad_trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glad_trace_next_glTexParameterIiv(target, pname, params);
+	GLTraceBeginCall(250);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(params, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLint)));
+}
+static PFNGLTEXPARAMETERIUIVPROC glad_trace_next_glTexParameterIuiv;
+static void APIENTRY glad_trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glad_trace_next_glTexParameterIuiv(target, pname, params);
+	GLTraceBeginCall(251);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(params, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLuint)));
+}
+static PFNGLCLEARBUFFERIVPROC glad_trace_next_glClearBufferiv;
+static void APIENTRY glad_trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_trace_next_glClearBufferiv(buffer, drawbuffer, value);
+	GLTraceBeginCall(254);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&drawbuffer, sizeof(drawbuffer));
+	GLTraceWriteBlob(value, (u64)((buffer == GL_COLOR ? 4 : 1) * sizeof(GLint)));
+}
+static PFNGLCLEARBUFFERUIVPROC glad_trace_next_glClearBufferuiv;
+static void APIENTRY glad_trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_trace_next_glClearBufferuiv(buffer, drawbuffer, value);
+	GLTraceBeginCall(255);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&drawbuffer, sizeof(drawbuffer));
+	GLTraceWriteBlob(value, (u64)((buffer == GL_COLOR ? 4 : 1) * sizeof(GLuint)));
+}
+static PFNGLCLEARBUFFERFVPROC glad_trace_next_glClearBufferfv;
+static void APIENTRY glad_trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_trace_next_glClearBufferfv(buffer, drawbuffer, value);
+	GLTraceBeginCall(256);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&drawbuffer, sizeof(drawbuffer));
+	GLTraceWriteBlob(value, (u64)((buffer == GL_COLOR ? 4 : 1) * sizeof(GLfloat)));
+}
+static PFNGLCLEARBUFFERFIPROC glad_trace_next_glClearBufferfi;
+static void APIENTRY glad_trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_trace_next_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	GLTraceBeginCall(257);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&drawbuffer, sizeof(drawbuffer));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&stencil, sizeof(stencil));
+}
+static PFNGLBINDRENDERBUFFERPROC glad_trace_next_glBindRenderbuffer;
+static void APIENTRY glad_trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glad_trace_next_glBindRenderbuffer(target, renderbuffer);
+	GLTraceBeginCall(260);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&renderbuffer, sizeof(renderbuffer));
+}
+static PFNGLDELETERENDERBUFFERSPROC glad_trace_next_glDeleteRenderbuffers;
+static void APIENTRY glad_trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glad_trace_next_glDeleteRenderbuffers(n, renderbuffers);
+	GLTraceBeginCall(261);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(renderbuffers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLGENRENDERBUFFERSPROC glad_trace_next_glGenRenderbuffers;
+static void APIENTRY glad_trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_trace_next_glGenRenderbuffers(n, renderbuffers);
+	GLTraceBeginCall(262);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(renderbuffers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLRENDERBUFFERSTORAGEPROC glad_trace_next_glRenderbufferStorage;
+static void APIENTRY glad_trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_trace_next_glRenderbufferStorage(target, internalformat, width, height);
+	GLTraceBeginCall(263);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLBINDFRAMEBUFFERPROC glad_trace_next_glBindFramebuffer;
+static void APIENTRY glad_trace_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glad_trace_next_glBindFramebuffer(target, framebuffer);
+	GLTraceBeginCall(266);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+}
+static PFNGLDELETEFRAMEBUFFERSPROC glad_trace_next_glDeleteFramebuffers;
+static void APIENTRY glad_trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glad_trace_next_glDeleteFramebuffers(n, framebuffers);
+	GLTraceBeginCall(267);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(framebuffers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLGENFRAMEBUFFERSPROC glad_trace_next_glGenFramebuffers;
+static void APIENTRY glad_trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_trace_next_glGenFramebuffers(n, framebuffers);
+	GLTraceBeginCall(268);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(framebuffers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_trace_next_glFramebufferTexture1D;
+static void APIENTRY glad_trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_trace_next_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	GLTraceBeginCall(270);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&attachment, sizeof(attachment));
+	GLTraceWrite(&textarget, sizeof(textarget));
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+}
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_trace_next_glFramebufferTexture2D;
+static void APIENTRY glad_trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_trace_next_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	GLTraceBeginCall(271);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&attachment, sizeof(attachment));
+	GLTraceWrite(&textarget, sizeof(textarget));
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+}
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_trace_next_glFramebufferTexture3D;
+static void APIENTRY glad_trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_trace_next_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	GLTraceBeginCall(272);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&attachment, sizeof(attachment));
+	GLTraceWrite(&textarget, sizeof(textarget));
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&zoffset, sizeof(zoffset));
+}
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_trace_next_glFramebufferRenderbuffer;
+static void APIENTRY glad_trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_trace_next_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	GLTraceBeginCall(273);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&attachment, sizeof(attachment));
+	GLTraceWrite(&renderbuffertarget, sizeof(renderbuffertarget));
+	GLTraceWrite(&renderbuffer, sizeof(renderbuffer));
+}
+static PFNGLGENERATEMIPMAPPROC glad_trace_next_glGenerateMipmap;
+static void APIENTRY glad_trace_glGenerateMipmap(GLenum target) {
+	glad_trace_next_glGenerateMipmap(target);
+	GLTraceBeginCall(275);
+	GLTraceWrite(&target, sizeof(target));
+}
+static PFNGLBLITFRAMEBUFFERPROC glad_trace_next_glBlitFramebuffer;
+static void APIENTRY glad_trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_trace_next_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	GLTraceBeginCall(276);
+	GLTraceWrite(&srcX0, sizeof(srcX0));
+	GLTraceWrite(&srcY0, sizeof(srcY0));
+	GLTraceWrite(&srcX1, sizeof(srcX1));
+	GLTraceWrite(&srcY1, sizeof(srcY1));
+	GLTraceWrite(&dstX0, sizeof(dstX0));
+	GLTraceWrite(&dstY0, sizeof(dstY0));
+	GLTraceWrite(&dstX1, sizeof(dstX1));
+	GLTraceWrite(&dstY1, sizeof(dstY1));
+	GLTraceWrite(&mask, sizeof(mask));
+	GLTraceWrite(&filter, sizeof(filter));
+}
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_trace_next_glRenderbufferStorageMultisample;
+static void APIENTRY glad_trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_trace_next_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	GLTraceBeginCall(277);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&samples, sizeof(samples));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_trace_next_glFramebufferTextureLayer;
+static void APIENTRY glad_trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_trace_next_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	GLTraceBeginCall(278);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&attachment, sizeof(attachment));
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&layer, sizeof(layer));
+}
+static PFNGLMAPBUFFERRANGEPROC glad_trace_next_glMapBufferRange;
+static void * APIENTRY glad_trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	void * glad_result = glad_trace_next_glMapBufferRange(target, offset, length, access);
+	GLTraceUnsupported(279);
+	return glad_result;
+}
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_trace_next_glFlushMappedBufferRange;
+static void APIENTRY glad_trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glad_trace_next_glFlushMappedBufferRange(target, offset, length);
+	GLTraceUnsupported(280);
+}
+static PFNGLBINDVERTEXARRAYPROC glad_trace_next_glBindVertexArray;
+static void APIENTRY glad_trace_glBindVertexArray(GLuint array) {
+	glad_trace_next_glBindVertexArray(array);
+	GLTraceBeginCall(281);
+	GLTraceWrite(&array, sizeof(array));
+}
+static PFNGLDELETEVERTEXARRAYSPROC glad_trace_next_glDeleteVertexArrays;
+static void APIENTRY glad_trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glad_trace_next_glDeleteVertexArrays(n, arrays);
+	GLTraceBeginCall(282);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(arrays, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLGENVERTEXARRAYSPROC glad_trace_next_glGenVertexArrays;
+static void APIENTRY glad_trace_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_trace_next_glGenVertexArrays(n, arrays);
+	GLTraceBeginCall(283);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(arrays, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_trace_next_glDrawArraysInstanced;
+static void APIENTRY glad_trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glad_trace_next_glDrawArraysInstanced(mode, first, count, instancecount);
+	GLTraceBeginCall(285);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&instancecount, sizeof(instancecount));
+}
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_trace_next_glDrawElementsInstanced;
+static void APIENTRY glad_trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glad_trace_next_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	GLTraceBeginCall(286);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indices);
+	GLTraceWrite(&instancecount, sizeof(instancecount));
+}
+static PFNGLTEXBUFFERPROC glad_trace_next_glTexBuffer;
+static void APIENTRY glad_trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_trace_next_glTexBuffer(target, internalformat, buffer);
+	GLTraceBeginCall(287);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&buffer, sizeof(buffer));
+}
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_trace_next_glPrimitiveRestartIndex;
+static void APIENTRY glad_trace_glPrimitiveRestartIndex(GLuint index) {
+	glad_trace_next_glPrimitiveRestartIndex(index);
+	GLTraceBeginCall(288);
+	GLTraceWrite(&index, sizeof(index));
+}
+static PFNGLCOPYBUFFERSUBDATAPROC glad_trace_next_glCopyBufferSubData;
+static void APIENTRY glad_trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_trace_next_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	GLTraceBeginCall(289);
+	GLTraceWrite(&readTarget, sizeof(readTarget));
+	GLTraceWrite(&writeTarget, sizeof(writeTarget));
+	GLTraceWrite(&readOffset, sizeof(readOffset));
+	GLTraceWrite(&writeOffset, sizeof(writeOffset));
+	GLTraceWrite(&size, sizeof(size));
+}
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_trace_next_glUniformBlockBinding;
+static void APIENTRY glad_trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glad_trace_next_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	GLTraceBeginCall(296);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&uniformBlockIndex, sizeof(uniformBlockIndex));
+	GLTraceWrite(&uniformBlockBinding, sizeof(uniformBlockBinding));
+}
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_trace_next_glDrawElementsBaseVertex;
+static void APIENTRY glad_trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_trace_next_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	GLTraceBeginCall(297);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indices);
+	GLTraceWrite(&basevertex, sizeof(basevertex));
+}
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_trace_next_glDrawRangeElementsBaseVertex;
+static void APIENTRY glad_trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_trace_next_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	GLTraceBeginCall(298);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&start, sizeof(start));
+	GLTraceWrite(&end, sizeof(end));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indices);
+	GLTraceWrite(&basevertex, sizeof(basevertex));
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_trace_next_glDrawElementsInstancedBaseVertex;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glad_trace_next_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	GLTraceBeginCall(299);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indices);
+	GLTraceWrite(&instancecount, sizeof(instancecount));
+	GLTraceWrite(&basevertex, sizeof(basevertex));
+}
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_trace_next_glMultiDrawElementsBaseVertex;
+static void APIENTRY glad_trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glad_trace_next_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	GLTraceBeginCall(300);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWriteBlob(count, (u64)(drawcount * sizeof(GLsizei)));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(indices, (u64)(drawcount * sizeof(void *)));
+	GLTraceWrite(&drawcount, sizeof(drawcount));
+	GLTraceWriteBlob(basevertex, (u64)(drawcount * sizeof(GLint)));
+}
+static PFNGLPROVOKINGVERTEXPROC glad_trace_next_glProvokingVertex;
+static void APIENTRY glad_trace_glProvokingVertex(GLenum mode) {
+	glad_trace_next_glProvokingVertex(mode);
+	GLTraceBeginCall(301);
+	GLTraceWrite(&mode, sizeof(mode));
+}
+static PFNGLFENCESYNCPROC glad_trace_next_glFenceSync;
+static GLsync APIENTRY glad_trace_glFenceSync(GLenum condition, GLbitfield flags) {
+	GLsync glad_result = glad_trace_next_glFenceSync(condition, flags);
+	GLTraceBeginCall(302);
+	GLTraceWrite(&condition, sizeof(condition));
+	GLTraceWrite(&flags, sizeof(flags));
+	{ u64 glad_handle = (u64)(uintptr_t)glad_result; GLTraceWrite(&glad_handle, sizeof(glad_handle)); }
+	return glad_result;
+}
+static PFNGLDELETESYNCPROC glad_trace_next_glDeleteSync;
+static void APIENTRY glad_trace_glDeleteSync(GLsync sync) {
+	glad_trace_next_glDeleteSync(sync);
+	GLTraceBeginCall(304);
+	{ u64 glad_handle = (u64)(uintptr_t)sync; GLTraceWrite(&glad_handle, sizeof(glad_handle)); }
+}
+static PFNGLCLIENTWAITSYNCPROC glad_trace_next_glClientWaitSync;
+static GLenum APIENTRY glad_trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLenum glad_result = glad_trace_next_glClientWaitSync(sync, flags, timeout);
+	GLTraceBeginCall(305);
+	{ u64 glad_handle = (u64)(uintptr_t)sync; GLTraceWrite(&glad_handle, sizeof(glad_handle)); }
+	GLTraceWrite(&flags, sizeof(flags));
+	GLTraceWrite(&timeout, sizeof(timeout));
+	return glad_result;
+}
+static PFNGLWAITSYNCPROC glad_trace_next_glWaitSync;
+static void APIENTRY glad_trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_trace_next_glWaitSync(sync, flags, timeout);
+	GLTraceBeginCall(306);
+	{ u64 glad_handle = (u64)(uintptr_t)sync; GLTraceWrite(&glad_handle, sizeof(glad_handle)); }
+	GLTraceWrite(&flags, sizeof(flags));
+	GLTraceWrite(&timeout, sizeof(timeout));
+}
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_trace_next_glFramebufferTexture;
+static void APIENTRY glad_trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_trace_next_glFramebufferTexture(target, attachment, texture, level);
+	GLTraceBeginCall(311);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&attachment, sizeof(attachment));
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+}
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_trace_next_glTexImage2DMultisample;
+static void APIENTRY glad_trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_trace_next_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	GLTraceBeginCall(312);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&samples, sizeof(samples));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_trace_next_glTexImage3DMultisample;
+static void APIENTRY glad_trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_trace_next_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	GLTraceBeginCall(313);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&samples, sizeof(samples));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+static PFNGLSAMPLEMASKIPROC glad_trace_next_glSampleMaski;
+static void APIENTRY glad_trace_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glad_trace_next_glSampleMaski(maskNumber, mask);
+	GLTraceBeginCall(315);
+	GLTraceWrite(&maskNumber, sizeof(maskNumber));
+	GLTraceWrite(&mask, sizeof(mask));
+}
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_trace_next_glBindFragDataLocationIndexed;
+static void APIENTRY glad_trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glad_trace_next_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	GLTraceBeginCall(316);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&colorNumber, sizeof(colorNumber));
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteString(name, -1);
+}
+static PFNGLGENSAMPLERSPROC glad_trace_next_glGenSamplers;
+static void APIENTRY glad_trace_glGenSamplers(GLsizei count, GLuint *samplers) {
+	glad_trace_next_glGenSamplers(count, samplers);
+	GLTraceBeginCall(318);
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(samplers, (u64)(count) * sizeof(GLuint));
+}
+static PFNGLDELETESAMPLERSPROC glad_trace_next_glDeleteSamplers;
+static void APIENTRY glad_trace_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glad_trace_next_glDeleteSamplers(count, samplers);
+	GLTraceBeginCall(319);
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(samplers, (u64)(count) * sizeof(GLuint));
+}
+static PFNGLBINDSAMPLERPROC glad_trace_next_glBindSampler;
+static void APIENTRY glad_trace_glBindSampler(GLuint unit, GLuint sampler) {
+	glad_trace_next_glBindSampler(unit, sampler);
+	GLTraceBeginCall(321);
+	GLTraceWrite(&unit, sizeof(unit));
+	GLTraceWrite(&sampler, sizeof(sampler));
+}
+static PFNGLSAMPLERPARAMETERIPROC glad_trace_next_glSamplerParameteri;
+static void APIENTRY glad_trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glad_trace_next_glSamplerParameteri(sampler, pname, param);
+	GLTraceBeginCall(322);
+	GLTraceWrite(&sampler, sizeof(sampler));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLSAMPLERPARAMETERIVPROC glad_trace_next_glSamplerParameteriv;
+static void APIENTRY glad_trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_trace_next_glSamplerParameteriv(sampler, pname, param);
+	GLTraceBeginCall(323);
+	GLTraceWrite(&sampler, sizeof(sampler));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(param, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLint)));
+}
+static PFNGLSAMPLERPARAMETERFPROC glad_trace_next_glSamplerParameterf;
+static void APIENTRY glad_trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glad_trace_next_glSamplerParameterf(sampler, pname, param);
+	GLTraceBeginCall(324);
+	GLTraceWrite(&sampler, sizeof(sampler));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLSAMPLERPARAMETERFVPROC glad_trace_next_glSamplerParameterfv;
+static void APIENTRY glad_trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glad_trace_next_glSamplerParameterfv(sampler, pname, param);
+	GLTraceBeginCall(325);
+	GLTraceWrite(&sampler, sizeof(sampler));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(param, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLfloat)));
+}
+static PFNGLSAMPLERPARAMETERIIVPROC glad_trace_next_glSamplerParameterIiv;
+static void APIENTRY glad_trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_trace_next_glSamplerParameterIiv(sampler, pname, param);
+	GLTraceBeginCall(326);
+	GLTraceWrite(&sampler, sizeof(sampler));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(param, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLint)));
+}
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_trace_next_glSamplerParameterIuiv;
+static void APIENTRY glad_trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glad_trace_next_glSamplerParameterIuiv(sampler, pname, param);
+	GLTraceBeginCall(327);
+	GLTraceWrite(&sampler, sizeof(sampler));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(param, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLuint)));
+}
+static PFNGLQUERYCOUNTERPROC glad_trace_next_glQueryCounter;
+static void APIENTRY glad_trace_glQueryCounter(GLuint id, GLenum target) {
+	glad_trace_next_glQueryCounter(id, target);
+	GLTraceBeginCall(332);
+	GLTraceWrite(&id, sizeof(id));
+	GLTraceWrite(&target, sizeof(target));
+}
+static PFNGLVERTEXATTRIBDIVISORPROC glad_trace_next_glVertexAttribDivisor;
+static void APIENTRY glad_trace_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glad_trace_next_glVertexAttribDivisor(index, divisor);
+	GLTraceBeginCall(335);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&divisor, sizeof(divisor));
+}
+static PFNGLVERTEXATTRIBP1UIPROC glad_trace_next_glVertexAttribP1ui;
+static void APIENTRY glad_trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_trace_next_glVertexAttribP1ui(index, type, normalized, value);
+	GLTraceBeginCall(336);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLVERTEXATTRIBP1UIVPROC glad_trace_next_glVertexAttribP1uiv;
+static void APIENTRY glad_trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_trace_next_glVertexAttribP1uiv(index, type, normalized, value);
+	GLTraceBeginCall(337);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWriteBlob(value, (u64)(sizeof(GLuint)));
+}
+static PFNGLVERTEXATTRIBP2UIPROC glad_trace_next_glVertexAttribP2ui;
+static void APIENTRY glad_trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_trace_next_glVertexAttribP2ui(index, type, normalized, value);
+	GLTraceBeginCall(338);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLVERTEXATTRIBP2UIVPROC glad_trace_next_glVertexAttribP2uiv;
+static void APIENTRY glad_trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_trace_next_glVertexAttribP2uiv(index, type, normalized, value);
+	GLTraceBeginCall(339);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWriteBlob(value, (u64)(sizeof(GLuint)));
+}
+static PFNGLVERTEXATTRIBP3UIPROC glad_trace_next_glVertexAttribP3ui;
+static void APIENTRY glad_trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_trace_next_glVertexAttribP3ui(index, type, normalized, value);
+	GLTraceBeginCall(340);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLVERTEXATTRIBP3UIVPROC glad_trace_next_glVertexAttribP3uiv;
+static void APIENTRY glad_trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_trace_next_glVertexAttribP3uiv(index, type, normalized, value);
+	GLTraceBeginCall(341);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWriteBlob(value, (u64)(sizeof(GLuint)));
+}
+static PFNGLVERTEXATTRIBP4UIPROC glad_trace_next_glVertexAttribP4ui;
+static void APIENTRY glad_trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_trace_next_glVertexAttribP4ui(index, type, normalized, value);
+	GLTraceBeginCall(342);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLVERTEXATTRIBP4UIVPROC glad_trace_next_glVertexAttribP4uiv;
+static void APIENTRY glad_trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_trace_next_glVertexAttribP4uiv(index, type, normalized, value);
+	GLTraceBeginCall(343);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWriteBlob(value, (u64)(sizeof(GLuint)));
+}
+static PFNGLVERTEXP2UIPROC glad_trace_next_glVertexP2ui;
+static void APIENTRY glad_trace_glVertexP2ui(GLenum type, GLuint value) {
+	glad_trace_next_glVertexP2ui(type, value);
+	GLTraceBeginCall(344);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLVERTEXP2UIVPROC glad_trace_next_glVertexP2uiv;
+static void APIENTRY glad_trace_glVertexP2uiv(GLenum type, const GLuint *value) {
+	glad_trace_next_glVertexP2uiv(type, value);
+	GLTraceBeginCall(345);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(value, (u64)(sizeof(GLuint)));
+}
+static PFNGLVERTEXP3UIPROC glad_trace_next_glVertexP3ui;
+static void APIENTRY glad_trace_glVertexP3ui(GLenum type, GLuint value) {
+	glad_trace_next_glVertexP3ui(type, value);
+	GLTraceBeginCall(346);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLVERTEXP3UIVPROC glad_trace_next_glVertexP3uiv;
+static void APIENTRY glad_trace_glVertexP3uiv(GLenum type, const GLuint *value) {
+	glad_trace_next_glVertexP3uiv(type, value);
+	GLTraceBeginCall(347);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(value, (u64)(sizeof(GLuint)));
+}
+static PFNGLVERTEXP4UIPROC glad_trace_next_glVertexP4ui;
+static void APIENTRY glad_trace_glVertexP4ui(GLenum type, GLuint value) {
+	glad_trace_next_glVertexP4ui(type, value);
+	GLTraceBeginCall(348);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLVERTEXP4UIVPROC glad_trace_next_glVertexP4uiv;
+static void APIENTRY glad_trace_glVertexP4uiv(GLenum type, const GLuint *value) {
+	glad_trace_next_glVertexP4uiv(type, value);
+	GLTraceBeginCall(349);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(value, (u64)(sizeof(GLuint)));
+}
+static PFNGLTEXCOORDP1UIPROC glad_trace_next_glTexCoordP1ui;
+static void APIENTRY glad_trace_glTexCoordP1ui(GLenum type, GLuint coords) {
+	glad_trace_next_glTexCoordP1ui(type, coords);
+	GLTraceBeginCall(350);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&coords, sizeof(coords));
+}
+static PFNGLTEXCOORDP1UIVPROC glad_trace_next_glTexCoordP1uiv;
+static void APIENTRY glad_trace_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	glad_trace_next_glTexCoordP1uiv(type, coords);
+	GLTraceBeginCall(351);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(coords, (u64)(sizeof(GLuint)));
+}
+static PFNGLTEXCOORDP2UIPROC glad_trace_next_glTexCoordP2ui;
+static void APIENTRY glad_trace_glTexCoordP2ui(GLenum type, GLuint coords) {
+	glad_trace_next_glTexCoordP2ui(type, coords);
+	GLTraceBeginCall(352);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&coords, sizeof(coords));
+}
+static PFNGLTEXCOORDP2UIVPROC glad_trace_next_glTexCoordP2uiv;
+static void APIENTRY glad_trace_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	glad_trace_next_glTexCoordP2uiv(type, coords);
+	GLTraceBeginCall(353);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(coords, (u64)(sizeof(GLuint)));
+}
+static PFNGLTEXCOORDP3UIPROC glad_trace_next_glTexCoordP3ui;
+static void APIENTRY glad_trace_glTexCoordP3ui(GLenum type, GLuint coords) {
+	glad_trace_next_glTexCoordP3ui(type, coords);
+	GLTraceBeginCall(354);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&coords, sizeof(coords));
+}
+static PFNGLTEXCOORDP3UIVPROC glad_trace_next_glTexCoordP3uiv;
+static void APIENTRY glad_trace_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	glad_trace_next_glTexCoordP3uiv(type, coords);
+	GLTraceBeginCall(355);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(coords, (u64)(sizeof(GLuint)));
+}
+static PFNGLTEXCOORDP4UIPROC glad_trace_next_glTexCoordP4ui;
+static void APIENTRY glad_trace_glTexCoordP4ui(GLenum type, GLuint coords) {
+	glad_trace_next_glTexCoordP4ui(type, coords);
+	GLTraceBeginCall(356);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&coords, sizeof(coords));
+}
+static PFNGLTEXCOORDP4UIVPROC glad_trace_next_glTexCoordP4uiv;
+static void APIENTRY glad_trace_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	glad_trace_next_glTexCoordP4uiv(type, coords);
+	GLTraceBeginCall(357);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(coords, (u64)(sizeof(GLuint)));
+}
+static PFNGLMULTITEXCOORDP1UIPROC glad_trace_next_glMultiTexCoordP1ui;
+static void APIENTRY glad_trace_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_trace_next_glMultiTexCoordP1ui(texture, type, coords);
+	GLTraceBeginCall(358);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&coords, sizeof(coords));
+}
+static PFNGLMULTITEXCOORDP1UIVPROC glad_trace_next_glMultiTexCoordP1uiv;
+static void APIENTRY glad_trace_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_trace_next_glMultiTexCoordP1uiv(texture, type, coords);
+	GLTraceBeginCall(359);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(coords, (u64)(sizeof(GLuint)));
+}
+static PFNGLMULTITEXCOORDP2UIPROC glad_trace_next_glMultiTexCoordP2ui;
+static void APIENTRY glad_trace_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_trace_next_glMultiTexCoordP2ui(texture, type, coords);
+	GLTraceBeginCall(360);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&coords, sizeof(coords));
+}
+static PFNGLMULTITEXCOORDP2UIVPROC glad_trace_next_glMultiTexCoordP2uiv;
+static void APIENTRY glad_trace_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_trace_next_glMultiTexCoordP2uiv(texture, type, coords);
+	GLTraceBeginCall(361);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(coords, (u64)(sizeof(GLuint)));
+}
+static PFNGLMULTITEXCOORDP3UIPROC glad_trace_next_glMultiTexCoordP3ui;
+static void APIENTRY glad_trace_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_trace_next_glMultiTexCoordP3ui(texture, type, coords);
+	GLTraceBeginCall(362);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&coords, sizeof(coords));
+}
+static PFNGLMULTITEXCOORDP3UIVPROC glad_trace_next_glMultiTexCoordP3uiv;
+static void APIENTRY glad_trace_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_trace_next_glMultiTexCoordP3uiv(texture, type, coords);
+	GLTraceBeginCall(363);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(coords, (u64)(sizeof(GLuint)));
+}
+static PFNGLMULTITEXCOORDP4UIPROC glad_trace_next_glMultiTexCoordP4ui;
+static void APIENTRY glad_trace_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_trace_next_glMultiTexCoordP4ui(texture, type, coords);
+	GLTraceBeginCall(364);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&coords, sizeof(coords));
+}
+static PFNGLMULTITEXCOORDP4UIVPROC glad_trace_next_glMultiTexCoordP4uiv;
+static void APIENTRY glad_trace_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_trace_next_glMultiTexCoordP4uiv(texture, type, coords);
+	GLTraceBeginCall(365);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(coords, (u64)(sizeof(GLuint)));
+}
+static PFNGLNORMALP3UIPROC glad_trace_next_glNormalP3ui;
+static void APIENTRY glad_trace_glNormalP3ui(GLenum type, GLuint coords) {
+	glad_trace_next_glNormalP3ui(type, coords);
+	GLTraceBeginCall(366);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&coords, sizeof(coords));
+}
+static PFNGLNORMALP3UIVPROC glad_trace_next_glNormalP3uiv;
+static void APIENTRY glad_trace_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	glad_trace_next_glNormalP3uiv(type, coords);
+	GLTraceBeginCall(367);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(coords, (u64)(sizeof(GLuint)));
+}
+static PFNGLCOLORP3UIPROC glad_trace_next_glColorP3ui;
+static void APIENTRY glad_trace_glColorP3ui(GLenum type, GLuint color) {
+	glad_trace_next_glColorP3ui(type, color);
+	GLTraceBeginCall(368);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&color, sizeof(color));
+}
+static PFNGLCOLORP3UIVPROC glad_trace_next_glColorP3uiv;
+static void APIENTRY glad_trace_glColorP3uiv(GLenum type, const GLuint *color) {
+	glad_trace_next_glColorP3uiv(type, color);
+	GLTraceBeginCall(369);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(color, (u64)(sizeof(GLuint)));
+}
+static PFNGLCOLORP4UIPROC glad_trace_next_glColorP4ui;
+static void APIENTRY glad_trace_glColorP4ui(GLenum type, GLuint color) {
+	glad_trace_next_glColorP4ui(type, color);
+	GLTraceBeginCall(370);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&color, sizeof(color));
+}
+static PFNGLCOLORP4UIVPROC glad_trace_next_glColorP4uiv;
+static void APIENTRY glad_trace_glColorP4uiv(GLenum type, const GLuint *color) {
+	glad_trace_next_glColorP4uiv(type, color);
+	GLTraceBeginCall(371);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(color, (u64)(sizeof(GLuint)));
+}
+static PFNGLSECONDARYCOLORP3UIPROC glad_trace_next_glSecondaryColorP3ui;
+static void APIENTRY glad_trace_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	glad_trace_next_glSecondaryColorP3ui(type, color);
+	GLTraceBeginCall(372);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&color, sizeof(color));
+}
+static PFNGLSECONDARYCOLORP3UIVPROC glad_trace_next_glSecondaryColorP3uiv;
+static void APIENTRY glad_trace_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	glad_trace_next_glSecondaryColorP3uiv(type, color);
+	GLTraceBeginCall(373);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(color, (u64)(sizeof(GLuint)));
+}
+static PFNGLMINSAMPLESHADINGPROC glad_trace_next_glMinSampleShading;
+static void APIENTRY glad_trace_glMinSampleShading(GLfloat value) {
+	glad_trace_next_glMinSampleShading(value);
+	GLTraceBeginCall(374);
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLBLENDEQUATIONIPROC glad_trace_next_glBlendEquationi;
+static void APIENTRY glad_trace_glBlendEquationi(GLuint buf, GLenum mode) {
+	glad_trace_next_glBlendEquationi(buf, mode);
+	GLTraceBeginCall(375);
+	GLTraceWrite(&buf, sizeof(buf));
+	GLTraceWrite(&mode, sizeof(mode));
+}
+static PFNGLBLENDEQUATIONSEPARATEIPROC glad_trace_next_glBlendEquationSeparatei;
+static void APIENTRY glad_trace_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	glad_trace_next_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+	GLTraceBeginCall(376);
+	GLTraceWrite(&buf, sizeof(buf));
+	GLTraceWrite(&modeRGB, sizeof(modeRGB));
+	GLTraceWrite(&modeAlpha, sizeof(modeAlpha));
+}
+static PFNGLBLENDFUNCIPROC glad_trace_next_glBlendFunci;
+static void APIENTRY glad_trace_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+	glad_trace_next_glBlendFunci(buf, src, dst);
+	GLTraceBeginCall(377);
+	GLTraceWrite(&buf, sizeof(buf));
+	GLTraceWrite(&src, sizeof(src));
+	GLTraceWrite(&dst, sizeof(dst));
+}
+static PFNGLBLENDFUNCSEPARATEIPROC glad_trace_next_glBlendFuncSeparatei;
+static void APIENTRY glad_trace_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	glad_trace_next_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	GLTraceBeginCall(378);
+	GLTraceWrite(&buf, sizeof(buf));
+	GLTraceWrite(&srcRGB, sizeof(srcRGB));
+	GLTraceWrite(&dstRGB, sizeof(dstRGB));
+	GLTraceWrite(&srcAlpha, sizeof(srcAlpha));
+	GLTraceWrite(&dstAlpha, sizeof(dstAlpha));
+}
+static PFNGLDRAWARRAYSINDIRECTPROC glad_trace_next_glDrawArraysIndirect;
+static void APIENTRY glad_trace_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	glad_trace_next_glDrawArraysIndirect(mode, indirect);
+	GLTraceBeginCall(379);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWriteOffset(indirect);
+}
+static PFNGLDRAWELEMENTSINDIRECTPROC glad_trace_next_glDrawElementsIndirect;
+static void APIENTRY glad_trace_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	glad_trace_next_glDrawElementsIndirect(mode, type, indirect);
+	GLTraceBeginCall(380);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indirect);
+}
+static PFNGLUNIFORM1DPROC glad_trace_next_glUniform1d;
+static void APIENTRY glad_trace_glUniform1d(GLint location, GLdouble x) {
+	glad_trace_next_glUniform1d(location, x);
+	GLTraceBeginCall(381);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&x, sizeof(x));
+}
+static PFNGLUNIFORM2DPROC glad_trace_next_glUniform2d;
+static void APIENTRY glad_trace_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+	glad_trace_next_glUniform2d(location, x, y);
+	GLTraceBeginCall(382);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+}
+static PFNGLUNIFORM3DPROC glad_trace_next_glUniform3d;
+static void APIENTRY glad_trace_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_next_glUniform3d(location, x, y, z);
+	GLTraceBeginCall(383);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+}
+static PFNGLUNIFORM4DPROC glad_trace_next_glUniform4d;
+static void APIENTRY glad_trace_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_trace_next_glUniform4d(location, x, y, z, w);
+	GLTraceBeginCall(384);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+	GLTraceWrite(&w, sizeof(w));
+}
+static PFNGLUNIFORM1DVPROC glad_trace_next_glUniform1dv;
+static void APIENTRY glad_trace_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_trace_next_glUniform1dv(location, count, value);
+	GLTraceBeginCall(385);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 1 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORM2DVPROC glad_trace_next_glUniform2dv;
+static void APIENTRY glad_trace_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_trace_next_glUniform2dv(location, count, value);
+	GLTraceBeginCall(386);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 2 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORM3DVPROC glad_trace_next_glUniform3dv;
+static void APIENTRY glad_trace_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_trace_next_glUniform3dv(location, count, value);
+	GLTraceBeginCall(387);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 3 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORM4DVPROC glad_trace_next_glUniform4dv;
+static void APIENTRY glad_trace_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_trace_next_glUniform4dv(location, count, value);
+	GLTraceBeginCall(388);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMMATRIX2DVPROC glad_trace_next_glUniformMatrix2dv;
+static void APIENTRY glad_trace_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glUniformMatrix2dv(location, count, transpose, value);
+	GLTraceBeginCall(389);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMMATRIX3DVPROC glad_trace_next_glUniformMatrix3dv;
+static void APIENTRY glad_trace_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glUniformMatrix3dv(location, count, transpose, value);
+	GLTraceBeginCall(390);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 9 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMMATRIX4DVPROC glad_trace_next_glUniformMatrix4dv;
+static void APIENTRY glad_trace_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glUniformMatrix4dv(location, count, transpose, value);
+	GLTraceBeginCall(391);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 16 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMMATRIX2X3DVPROC glad_trace_next_glUniformMatrix2x3dv;
+static void APIENTRY glad_trace_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glUniformMatrix2x3dv(location, count, transpose, value);
+	GLTraceBeginCall(392);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 6 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMMATRIX2X4DVPROC glad_trace_next_glUniformMatrix2x4dv;
+static void APIENTRY glad_trace_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glUniformMatrix2x4dv(location, count, transpose, value);
+	GLTraceBeginCall(393);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 8 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMMATRIX3X2DVPROC glad_trace_next_glUniformMatrix3x2dv;
+static void APIENTRY glad_trace_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glUniformMatrix3x2dv(location, count, transpose, value);
+	GLTraceBeginCall(394);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 6 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMMATRIX3X4DVPROC glad_trace_next_glUniformMatrix3x4dv;
+static void APIENTRY glad_trace_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glUniformMatrix3x4dv(location, count, transpose, value);
+	GLTraceBeginCall(395);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 12 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMMATRIX4X2DVPROC glad_trace_next_glUniformMatrix4x2dv;
+static void APIENTRY glad_trace_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glUniformMatrix4x2dv(location, count, transpose, value);
+	GLTraceBeginCall(396);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 8 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMMATRIX4X3DVPROC glad_trace_next_glUniformMatrix4x3dv;
+static void APIENTRY glad_trace_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glUniformMatrix4x3dv(location, count, transpose, value);
+	GLTraceBeginCall(397);
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 12 * sizeof(GLdouble)));
+}
+static PFNGLUNIFORMSUBROUTINESUIVPROC glad_trace_next_glUniformSubroutinesuiv;
+static void APIENTRY glad_trace_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+	glad_trace_next_glUniformSubroutinesuiv(shadertype, count, indices);
+	GLTraceBeginCall(404);
+	GLTraceWrite(&shadertype, sizeof(shadertype));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(indices, (u64)(count * sizeof(GLuint)));
+}
+static PFNGLPATCHPARAMETERIPROC glad_trace_next_glPatchParameteri;
+static void APIENTRY glad_trace_glPatchParameteri(GLenum pname, GLint value) {
+	glad_trace_next_glPatchParameteri(pname, value);
+	GLTraceBeginCall(407);
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLPATCHPARAMETERFVPROC glad_trace_next_glPatchParameterfv;
+static void APIENTRY glad_trace_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+	glad_trace_next_glPatchParameterfv(pname, values);
+	GLTraceBeginCall(408);
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(values, (u64)((pname == GL_PATCH_DEFAULT_OUTER_LEVEL ? 4 : 2) * sizeof(GLfloat)));
+}
+static PFNGLBINDTRANSFORMFEEDBACKPROC glad_trace_next_glBindTransformFeedback;
+static void APIENTRY glad_trace_glBindTransformFeedback(GLenum target, GLuint id) {
+	glad_trace_next_glBindTransformFeedback(target, id);
+	GLTraceBeginCall(409);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&id, sizeof(id));
+}
+static PFNGLDELETETRANSFORMFEEDBACKSPROC glad_trace_next_glDeleteTransformFeedbacks;
+static void APIENTRY glad_trace_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+	glad_trace_next_glDeleteTransformFeedbacks(n, ids);
+	GLTraceBeginCall(410);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(ids, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLGENTRANSFORMFEEDBACKSPROC glad_trace_next_glGenTransformFeedbacks;
+static void APIENTRY glad_trace_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_trace_next_glGenTransformFeedbacks(n, ids);
+	GLTraceBeginCall(411);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(ids, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLPAUSETRANSFORMFEEDBACKPROC glad_trace_next_glPauseTransformFeedback;
+static void APIENTRY glad_trace_glPauseTransformFeedback(void) {
+	glad_trace_next_glPauseTransformFeedback();
+	GLTraceBeginCall(413);
+}
+static PFNGLRESUMETRANSFORMFEEDBACKPROC glad_trace_next_glResumeTransformFeedback;
+static void APIENTRY glad_trace_glResumeTransformFeedback(void) {
+	glad_trace_next_glResumeTransformFeedback();
+	GLTraceBeginCall(414);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKPROC glad_trace_next_glDrawTransformFeedback;
+static void APIENTRY glad_trace_glDrawTransformFeedback(GLenum mode, GLuint id) {
+	glad_trace_next_glDrawTransformFeedback(mode, id);
+	GLTraceBeginCall(415);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&id, sizeof(id));
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_trace_next_glDrawTransformFeedbackStream;
+static void APIENTRY glad_trace_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+	glad_trace_next_glDrawTransformFeedbackStream(mode, id, stream);
+	GLTraceBeginCall(416);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&id, sizeof(id));
+	GLTraceWrite(&stream, sizeof(stream));
+}
+static PFNGLBEGINQUERYINDEXEDPROC glad_trace_next_glBeginQueryIndexed;
+static void APIENTRY glad_trace_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+	glad_trace_next_glBeginQueryIndexed(target, index, id);
+	GLTraceBeginCall(417);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&id, sizeof(id));
+}
+static PFNGLENDQUERYINDEXEDPROC glad_trace_next_glEndQueryIndexed;
+static void APIENTRY glad_trace_glEndQueryIndexed(GLenum target, GLuint index) {
+	glad_trace_next_glEndQueryIndexed(target, index);
+	GLTraceBeginCall(418);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&index, sizeof(index));
+}
+static PFNGLRELEASESHADERCOMPILERPROC glad_trace_next_glReleaseShaderCompiler;
+static void APIENTRY glad_trace_glReleaseShaderCompiler(void) {
+	glad_trace_next_glReleaseShaderCompiler();
+	GLTraceBeginCall(420);
+}
+static PFNGLSHADERBINARYPROC glad_trace_next_glShaderBinary;
+static void APIENTRY glad_trace_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length) {
+	glad_trace_next_glShaderBinary(count, shaders, binaryformat, binary, length);
+	GLTraceBeginCall(421);
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(shaders, (u64)(count) * sizeof(GLuint));
+	GLTraceWrite(&binaryformat, sizeof(binaryformat));
+	GLTraceWriteBlob(binary, (u64)(length));
+	GLTraceWrite(&length, sizeof(length));
+}
+static PFNGLDEPTHRANGEFPROC glad_trace_next_glDepthRangef;
+static void APIENTRY glad_trace_glDepthRangef(GLfloat n, GLfloat f) {
+	glad_trace_next_glDepthRangef(n, f);
+	GLTraceBeginCall(423);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWrite(&f, sizeof(f));
+}
+static PFNGLCLEARDEPTHFPROC glad_trace_next_glClearDepthf;
+static void APIENTRY glad_trace_glClearDepthf(GLfloat d) {
+	glad_trace_next_glClearDepthf(d);
+	GLTraceBeginCall(424);
+	GLTraceWrite(&d, sizeof(d));
+}
+static PFNGLPROGRAMBINARYPROC glad_trace_next_glProgramBinary;
+static void APIENTRY glad_trace_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_trace_next_glProgramBinary(program, binaryFormat, binary, length);
+	GLTraceBeginCall(426);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&binaryFormat, sizeof(binaryFormat));
+	GLTraceWriteBlob(binary, (u64)(length));
+	GLTraceWrite(&length, sizeof(length));
+}
+static PFNGLPROGRAMPARAMETERIPROC glad_trace_next_glProgramParameteri;
+static void APIENTRY glad_trace_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	glad_trace_next_glProgramParameteri(program, pname, value);
+	GLTraceBeginCall(427);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&value, sizeof(value));
+}
+static PFNGLUSEPROGRAMSTAGESPROC glad_trace_next_glUseProgramStages;
+static void APIENTRY glad_trace_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+	glad_trace_next_glUseProgramStages(pipeline, stages, program);
+	GLTraceBeginCall(428);
+	GLTraceWrite(&pipeline, sizeof(pipeline));
+	GLTraceWrite(&stages, sizeof(stages));
+	GLTraceWrite(&program, sizeof(program));
+}
+static PFNGLACTIVESHADERPROGRAMPROC glad_trace_next_glActiveShaderProgram;
+static void APIENTRY glad_trace_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+	glad_trace_next_glActiveShaderProgram(pipeline, program);
+	GLTraceBeginCall(429);
+	GLTraceWrite(&pipeline, sizeof(pipeline));
+	GLTraceWrite(&program, sizeof(program));
+}
+static PFNGLCREATESHADERPROGRAMVPROC glad_trace_next_glCreateShaderProgramv;
+static GLuint APIENTRY glad_trace_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+	GLuint glad_result = glad_trace_next_glCreateShaderProgramv(type, count, strings);
+	GLTraceBeginCall(430);
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteStrings(count, strings, NULL);
+	{ u64 glad_handle = (u64)(uintptr_t)glad_result; GLTraceWrite(&glad_handle, sizeof(glad_handle)); }
+	return glad_result;
+}
+static PFNGLBINDPROGRAMPIPELINEPROC glad_trace_next_glBindProgramPipeline;
+static void APIENTRY glad_trace_glBindProgramPipeline(GLuint pipeline) {
+	glad_trace_next_glBindProgramPipeline(pipeline);
+	GLTraceBeginCall(431);
+	GLTraceWrite(&pipeline, sizeof(pipeline));
+}
+static PFNGLDELETEPROGRAMPIPELINESPROC glad_trace_next_glDeleteProgramPipelines;
+static void APIENTRY glad_trace_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+	glad_trace_next_glDeleteProgramPipelines(n, pipelines);
+	GLTraceBeginCall(432);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(pipelines, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLGENPROGRAMPIPELINESPROC glad_trace_next_glGenProgramPipelines;
+static void APIENTRY glad_trace_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_trace_next_glGenProgramPipelines(n, pipelines);
+	GLTraceBeginCall(433);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(pipelines, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLPROGRAMUNIFORM1IPROC glad_trace_next_glProgramUniform1i;
+static void APIENTRY glad_trace_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+	glad_trace_next_glProgramUniform1i(program, location, v0);
+	GLTraceBeginCall(436);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+}
+static PFNGLPROGRAMUNIFORM1IVPROC glad_trace_next_glProgramUniform1iv;
+static void APIENTRY glad_trace_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_trace_next_glProgramUniform1iv(program, location, count, value);
+	GLTraceBeginCall(437);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 1 * sizeof(GLint)));
+}
+static PFNGLPROGRAMUNIFORM1FPROC glad_trace_next_glProgramUniform1f;
+static void APIENTRY glad_trace_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+	glad_trace_next_glProgramUniform1f(program, location, v0);
+	GLTraceBeginCall(438);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+}
+static PFNGLPROGRAMUNIFORM1FVPROC glad_trace_next_glProgramUniform1fv;
+static void APIENTRY glad_trace_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_next_glProgramUniform1fv(program, location, count, value);
+	GLTraceBeginCall(439);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 1 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORM1DPROC glad_trace_next_glProgramUniform1d;
+static void APIENTRY glad_trace_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+	glad_trace_next_glProgramUniform1d(program, location, v0);
+	GLTraceBeginCall(440);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+}
+static PFNGLPROGRAMUNIFORM1DVPROC glad_trace_next_glProgramUniform1dv;
+static void APIENTRY glad_trace_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_trace_next_glProgramUniform1dv(program, location, count, value);
+	GLTraceBeginCall(441);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 1 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORM1UIPROC glad_trace_next_glProgramUniform1ui;
+static void APIENTRY glad_trace_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+	glad_trace_next_glProgramUniform1ui(program, location, v0);
+	GLTraceBeginCall(442);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+}
+static PFNGLPROGRAMUNIFORM1UIVPROC glad_trace_next_glProgramUniform1uiv;
+static void APIENTRY glad_trace_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_next_glProgramUniform1uiv(program, location, count, value);
+	GLTraceBeginCall(443);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 1 * sizeof(GLuint)));
+}
+static PFNGLPROGRAMUNIFORM2IPROC glad_trace_next_glProgramUniform2i;
+static void APIENTRY glad_trace_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+	glad_trace_next_glProgramUniform2i(program, location, v0, v1);
+	GLTraceBeginCall(444);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+}
+static PFNGLPROGRAMUNIFORM2IVPROC glad_trace_next_glProgramUniform2iv;
+static void APIENTRY glad_trace_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_trace_next_glProgramUniform2iv(program, location, count, value);
+	GLTraceBeginCall(445);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 2 * sizeof(GLint)));
+}
+static PFNGLPROGRAMUNIFORM2FPROC glad_trace_next_glProgramUniform2f;
+static void APIENTRY glad_trace_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	glad_trace_next_glProgramUniform2f(program, location, v0, v1);
+	GLTraceBeginCall(446);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+}
+static PFNGLPROGRAMUNIFORM2FVPROC glad_trace_next_glProgramUniform2fv;
+static void APIENTRY glad_trace_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_next_glProgramUniform2fv(program, location, count, value);
+	GLTraceBeginCall(447);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 2 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORM2DPROC glad_trace_next_glProgramUniform2d;
+static void APIENTRY glad_trace_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+	glad_trace_next_glProgramUniform2d(program, location, v0, v1);
+	GLTraceBeginCall(448);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+}
+static PFNGLPROGRAMUNIFORM2DVPROC glad_trace_next_glProgramUniform2dv;
+static void APIENTRY glad_trace_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_trace_next_glProgramUniform2dv(program, location, count, value);
+	GLTraceBeginCall(449);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 2 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORM2UIPROC glad_trace_next_glProgramUniform2ui;
+static void APIENTRY glad_trace_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	glad_trace_next_glProgramUniform2ui(program, location, v0, v1);
+	GLTraceBeginCall(450);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+}
+static PFNGLPROGRAMUNIFORM2UIVPROC glad_trace_next_glProgramUniform2uiv;
+static void APIENTRY glad_trace_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_next_glProgramUniform2uiv(program, location, count, value);
+	GLTraceBeginCall(451);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 2 * sizeof(GLuint)));
+}
+static PFNGLPROGRAMUNIFORM3IPROC glad_trace_next_glProgramUniform3i;
+static void APIENTRY glad_trace_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_trace_next_glProgramUniform3i(program, location, v0, v1, v2);
+	GLTraceBeginCall(452);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+}
+static PFNGLPROGRAMUNIFORM3IVPROC glad_trace_next_glProgramUniform3iv;
+static void APIENTRY glad_trace_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_trace_next_glProgramUniform3iv(program, location, count, value);
+	GLTraceBeginCall(453);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 3 * sizeof(GLint)));
+}
+static PFNGLPROGRAMUNIFORM3FPROC glad_trace_next_glProgramUniform3f;
+static void APIENTRY glad_trace_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_trace_next_glProgramUniform3f(program, location, v0, v1, v2);
+	GLTraceBeginCall(454);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+}
+static PFNGLPROGRAMUNIFORM3FVPROC glad_trace_next_glProgramUniform3fv;
+static void APIENTRY glad_trace_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_next_glProgramUniform3fv(program, location, count, value);
+	GLTraceBeginCall(455);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 3 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORM3DPROC glad_trace_next_glProgramUniform3d;
+static void APIENTRY glad_trace_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+	glad_trace_next_glProgramUniform3d(program, location, v0, v1, v2);
+	GLTraceBeginCall(456);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+}
+static PFNGLPROGRAMUNIFORM3DVPROC glad_trace_next_glProgramUniform3dv;
+static void APIENTRY glad_trace_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_trace_next_glProgramUniform3dv(program, location, count, value);
+	GLTraceBeginCall(457);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 3 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORM3UIPROC glad_trace_next_glProgramUniform3ui;
+static void APIENTRY glad_trace_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_trace_next_glProgramUniform3ui(program, location, v0, v1, v2);
+	GLTraceBeginCall(458);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+}
+static PFNGLPROGRAMUNIFORM3UIVPROC glad_trace_next_glProgramUniform3uiv;
+static void APIENTRY glad_trace_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_next_glProgramUniform3uiv(program, location, count, value);
+	GLTraceBeginCall(459);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 3 * sizeof(GLuint)));
+}
+static PFNGLPROGRAMUNIFORM4IPROC glad_trace_next_glProgramUniform4i;
+static void APIENTRY glad_trace_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_trace_next_glProgramUniform4i(program, location, v0, v1, v2, v3);
+	GLTraceBeginCall(460);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+	GLTraceWrite(&v3, sizeof(v3));
+}
+static PFNGLPROGRAMUNIFORM4IVPROC glad_trace_next_glProgramUniform4iv;
+static void APIENTRY glad_trace_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_trace_next_glProgramUniform4iv(program, location, count, value);
+	GLTraceBeginCall(461);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLint)));
+}
+static PFNGLPROGRAMUNIFORM4FPROC glad_trace_next_glProgramUniform4f;
+static void APIENTRY glad_trace_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_trace_next_glProgramUniform4f(program, location, v0, v1, v2, v3);
+	GLTraceBeginCall(462);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+	GLTraceWrite(&v3, sizeof(v3));
+}
+static PFNGLPROGRAMUNIFORM4FVPROC glad_trace_next_glProgramUniform4fv;
+static void APIENTRY glad_trace_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_trace_next_glProgramUniform4fv(program, location, count, value);
+	GLTraceBeginCall(463);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORM4DPROC glad_trace_next_glProgramUniform4d;
+static void APIENTRY glad_trace_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+	glad_trace_next_glProgramUniform4d(program, location, v0, v1, v2, v3);
+	GLTraceBeginCall(464);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+	GLTraceWrite(&v3, sizeof(v3));
+}
+static PFNGLPROGRAMUNIFORM4DVPROC glad_trace_next_glProgramUniform4dv;
+static void APIENTRY glad_trace_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_trace_next_glProgramUniform4dv(program, location, count, value);
+	GLTraceBeginCall(465);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORM4UIPROC glad_trace_next_glProgramUniform4ui;
+static void APIENTRY glad_trace_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_trace_next_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+	GLTraceBeginCall(466);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&v0, sizeof(v0));
+	GLTraceWrite(&v1, sizeof(v1));
+	GLTraceWrite(&v2, sizeof(v2));
+	GLTraceWrite(&v3, sizeof(v3));
+}
+static PFNGLPROGRAMUNIFORM4UIVPROC glad_trace_next_glProgramUniform4uiv;
+static void APIENTRY glad_trace_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_trace_next_glProgramUniform4uiv(program, location, count, value);
+	GLTraceBeginCall(467);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLuint)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_trace_next_glProgramUniformMatrix2fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+	GLTraceBeginCall(468);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_trace_next_glProgramUniformMatrix3fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+	GLTraceBeginCall(469);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 9 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_trace_next_glProgramUniformMatrix4fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+	GLTraceBeginCall(470);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 16 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_trace_next_glProgramUniformMatrix2dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+	GLTraceBeginCall(471);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 4 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_trace_next_glProgramUniformMatrix3dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+	GLTraceBeginCall(472);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 9 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_trace_next_glProgramUniformMatrix4dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+	GLTraceBeginCall(473);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 16 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_trace_next_glProgramUniformMatrix2x3fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+	GLTraceBeginCall(474);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 6 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_trace_next_glProgramUniformMatrix3x2fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+	GLTraceBeginCall(475);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 6 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_trace_next_glProgramUniformMatrix2x4fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+	GLTraceBeginCall(476);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 8 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_trace_next_glProgramUniformMatrix4x2fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+	GLTraceBeginCall(477);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 8 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_trace_next_glProgramUniformMatrix3x4fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+	GLTraceBeginCall(478);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 12 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_trace_next_glProgramUniformMatrix4x3fv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_trace_next_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+	GLTraceBeginCall(479);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 12 * sizeof(GLfloat)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_trace_next_glProgramUniformMatrix2x3dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+	GLTraceBeginCall(480);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 6 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_trace_next_glProgramUniformMatrix3x2dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+	GLTraceBeginCall(481);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 6 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_trace_next_glProgramUniformMatrix2x4dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+	GLTraceBeginCall(482);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 8 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_trace_next_glProgramUniformMatrix4x2dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+	GLTraceBeginCall(483);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 8 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_trace_next_glProgramUniformMatrix3x4dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+	GLTraceBeginCall(484);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 12 * sizeof(GLdouble)));
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_trace_next_glProgramUniformMatrix4x3dv;
+static void APIENTRY glad_trace_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_trace_next_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+	GLTraceBeginCall(485);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&location, sizeof(location));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&transpose, sizeof(transpose));
+	GLTraceWriteBlob(value, (u64)(count * 12 * sizeof(GLdouble)));
+}
+static PFNGLVALIDATEPROGRAMPIPELINEPROC glad_trace_next_glValidateProgramPipeline;
+static void APIENTRY glad_trace_glValidateProgramPipeline(GLuint pipeline) {
+	glad_trace_next_glValidateProgramPipeline(pipeline);
+	GLTraceBeginCall(486);
+	GLTraceWrite(&pipeline, sizeof(pipeline));
+}
+static PFNGLVERTEXATTRIBL1DPROC glad_trace_next_glVertexAttribL1d;
+static void APIENTRY glad_trace_glVertexAttribL1d(GLuint index, GLdouble x) {
+	glad_trace_next_glVertexAttribL1d(index, x);
+	GLTraceBeginCall(488);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+}
+static PFNGLVERTEXATTRIBL2DPROC glad_trace_next_glVertexAttribL2d;
+static void APIENTRY glad_trace_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_trace_next_glVertexAttribL2d(index, x, y);
+	GLTraceBeginCall(489);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+}
+static PFNGLVERTEXATTRIBL3DPROC glad_trace_next_glVertexAttribL3d;
+static void APIENTRY glad_trace_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_trace_next_glVertexAttribL3d(index, x, y, z);
+	GLTraceBeginCall(490);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+}
+static PFNGLVERTEXATTRIBL4DPROC glad_trace_next_glVertexAttribL4d;
+static void APIENTRY glad_trace_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_trace_next_glVertexAttribL4d(index, x, y, z, w);
+	GLTraceBeginCall(491);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&z, sizeof(z));
+	GLTraceWrite(&w, sizeof(w));
+}
+static PFNGLVERTEXATTRIBL1DVPROC glad_trace_next_glVertexAttribL1dv;
+static void APIENTRY glad_trace_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+	glad_trace_next_glVertexAttribL1dv(index, v);
+	GLTraceBeginCall(492);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(1 * sizeof(GLdouble)));
+}
+static PFNGLVERTEXATTRIBL2DVPROC glad_trace_next_glVertexAttribL2dv;
+static void APIENTRY glad_trace_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+	glad_trace_next_glVertexAttribL2dv(index, v);
+	GLTraceBeginCall(493);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(2 * sizeof(GLdouble)));
+}
+static PFNGLVERTEXATTRIBL3DVPROC glad_trace_next_glVertexAttribL3dv;
+static void APIENTRY glad_trace_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+	glad_trace_next_glVertexAttribL3dv(index, v);
+	GLTraceBeginCall(494);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(3 * sizeof(GLdouble)));
+}
+static PFNGLVERTEXATTRIBL4DVPROC glad_trace_next_glVertexAttribL4dv;
+static void APIENTRY glad_trace_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+	glad_trace_next_glVertexAttribL4dv(index, v);
+	GLTraceBeginCall(495);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLdouble)));
+}
+static PFNGLVERTEXATTRIBLPOINTERPROC glad_trace_next_glVertexAttribLPointer;
+static void APIENTRY glad_trace_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_trace_next_glVertexAttribLPointer(index, size, type, stride, pointer);
+	GLTraceBeginCall(496);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&stride, sizeof(stride));
+	GLTraceWriteOffset(pointer);
+}
+static PFNGLVIEWPORTARRAYVPROC glad_trace_next_glViewportArrayv;
+static void APIENTRY glad_trace_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+	glad_trace_next_glViewportArrayv(first, count, v);
+	GLTraceBeginCall(498);
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(v, (u64)(count * 4 * sizeof(GLfloat)));
+}
+static PFNGLVIEWPORTINDEXEDFPROC glad_trace_next_glViewportIndexedf;
+static void APIENTRY glad_trace_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+	glad_trace_next_glViewportIndexedf(index, x, y, w, h);
+	GLTraceBeginCall(499);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&w, sizeof(w));
+	GLTraceWrite(&h, sizeof(h));
+}
+static PFNGLVIEWPORTINDEXEDFVPROC glad_trace_next_glViewportIndexedfv;
+static void APIENTRY glad_trace_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+	glad_trace_next_glViewportIndexedfv(index, v);
+	GLTraceBeginCall(500);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLfloat)));
+}
+static PFNGLSCISSORARRAYVPROC glad_trace_next_glScissorArrayv;
+static void APIENTRY glad_trace_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+	glad_trace_next_glScissorArrayv(first, count, v);
+	GLTraceBeginCall(501);
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(v, (u64)(count * 4 * sizeof(GLint)));
+}
+static PFNGLSCISSORINDEXEDPROC glad_trace_next_glScissorIndexed;
+static void APIENTRY glad_trace_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+	glad_trace_next_glScissorIndexed(index, left, bottom, width, height);
+	GLTraceBeginCall(502);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&left, sizeof(left));
+	GLTraceWrite(&bottom, sizeof(bottom));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLSCISSORINDEXEDVPROC glad_trace_next_glScissorIndexedv;
+static void APIENTRY glad_trace_glScissorIndexedv(GLuint index, const GLint *v) {
+	glad_trace_next_glScissorIndexedv(index, v);
+	GLTraceBeginCall(503);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWriteBlob(v, (u64)(4 * sizeof(GLint)));
+}
+static PFNGLDEPTHRANGEARRAYVPROC glad_trace_next_glDepthRangeArrayv;
+static void APIENTRY glad_trace_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+	glad_trace_next_glDepthRangeArrayv(first, count, v);
+	GLTraceBeginCall(504);
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(v, (u64)(count * 2 * sizeof(GLdouble)));
+}
+static PFNGLDEPTHRANGEINDEXEDPROC glad_trace_next_glDepthRangeIndexed;
+static void APIENTRY glad_trace_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+	glad_trace_next_glDepthRangeIndexed(index, n, f);
+	GLTraceBeginCall(505);
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWrite(&f, sizeof(f));
+}
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_trace_next_glDrawArraysInstancedBaseInstance;
+static void APIENTRY glad_trace_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	glad_trace_next_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	GLTraceBeginCall(508);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&instancecount, sizeof(instancecount));
+	GLTraceWrite(&baseinstance, sizeof(baseinstance));
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_trace_next_glDrawElementsInstancedBaseInstance;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	glad_trace_next_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	GLTraceBeginCall(509);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indices);
+	GLTraceWrite(&instancecount, sizeof(instancecount));
+	GLTraceWrite(&baseinstance, sizeof(baseinstance));
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_trace_next_glDrawElementsInstancedBaseVertexBaseInstance;
+static void APIENTRY glad_trace_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	glad_trace_next_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	GLTraceBeginCall(510);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indices);
+	GLTraceWrite(&instancecount, sizeof(instancecount));
+	GLTraceWrite(&basevertex, sizeof(basevertex));
+	GLTraceWrite(&baseinstance, sizeof(baseinstance));
+}
+static PFNGLBINDIMAGETEXTUREPROC glad_trace_next_glBindImageTexture;
+static void APIENTRY glad_trace_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+	glad_trace_next_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+	GLTraceBeginCall(513);
+	GLTraceWrite(&unit, sizeof(unit));
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&layered, sizeof(layered));
+	GLTraceWrite(&layer, sizeof(layer));
+	GLTraceWrite(&access, sizeof(access));
+	GLTraceWrite(&format, sizeof(format));
+}
+static PFNGLMEMORYBARRIERPROC glad_trace_next_glMemoryBarrier;
+static void APIENTRY glad_trace_glMemoryBarrier(GLbitfield barriers) {
+	glad_trace_next_glMemoryBarrier(barriers);
+	GLTraceBeginCall(514);
+	GLTraceWrite(&barriers, sizeof(barriers));
+}
+static PFNGLTEXSTORAGE1DPROC glad_trace_next_glTexStorage1D;
+static void APIENTRY glad_trace_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_trace_next_glTexStorage1D(target, levels, internalformat, width);
+	GLTraceBeginCall(515);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&levels, sizeof(levels));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+}
+static PFNGLTEXSTORAGE2DPROC glad_trace_next_glTexStorage2D;
+static void APIENTRY glad_trace_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_trace_next_glTexStorage2D(target, levels, internalformat, width, height);
+	GLTraceBeginCall(516);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&levels, sizeof(levels));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLTEXSTORAGE3DPROC glad_trace_next_glTexStorage3D;
+static void APIENTRY glad_trace_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_trace_next_glTexStorage3D(target, levels, internalformat, width, height, depth);
+	GLTraceBeginCall(517);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&levels, sizeof(levels));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+}
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_trace_next_glDrawTransformFeedbackInstanced;
+static void APIENTRY glad_trace_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+	glad_trace_next_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+	GLTraceBeginCall(518);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&id, sizeof(id));
+	GLTraceWrite(&instancecount, sizeof(instancecount));
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_trace_next_glDrawTransformFeedbackStreamInstanced;
+static void APIENTRY glad_trace_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+	glad_trace_next_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	GLTraceBeginCall(519);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&id, sizeof(id));
+	GLTraceWrite(&stream, sizeof(stream));
+	GLTraceWrite(&instancecount, sizeof(instancecount));
+}
+static PFNGLCLEARBUFFERDATAPROC glad_trace_next_glClearBufferData;
+static void APIENTRY glad_trace_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_trace_next_glClearBufferData(target, internalformat, format, type, data);
+	GLTraceBeginCall(520);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(data, (u64)(GLTraceImageSize(format, type, 1, 1, 1)));
+}
+static PFNGLCLEARBUFFERSUBDATAPROC glad_trace_next_glClearBufferSubData;
+static void APIENTRY glad_trace_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_trace_next_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+	GLTraceBeginCall(521);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(data, (u64)(GLTraceImageSize(format, type, 1, 1, 1)));
+}
+static PFNGLDISPATCHCOMPUTEPROC glad_trace_next_glDispatchCompute;
+static void APIENTRY glad_trace_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+	glad_trace_next_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	GLTraceBeginCall(522);
+	GLTraceWrite(&num_groups_x, sizeof(num_groups_x));
+	GLTraceWrite(&num_groups_y, sizeof(num_groups_y));
+	GLTraceWrite(&num_groups_z, sizeof(num_groups_z));
+}
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_trace_next_glDispatchComputeIndirect;
+static void APIENTRY glad_trace_glDispatchComputeIndirect(GLintptr indirect) {
+	glad_trace_next_glDispatchComputeIndirect(indirect);
+	GLTraceBeginCall(523);
+	GLTraceWrite(&indirect, sizeof(indirect));
+}
+static PFNGLCOPYIMAGESUBDATAPROC glad_trace_next_glCopyImageSubData;
+static void APIENTRY glad_trace_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	glad_trace_next_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	GLTraceBeginCall(524);
+	GLTraceWrite(&srcName, sizeof(srcName));
+	GLTraceWrite(&srcTarget, sizeof(srcTarget));
+	GLTraceWrite(&srcLevel, sizeof(srcLevel));
+	GLTraceWrite(&srcX, sizeof(srcX));
+	GLTraceWrite(&srcY, sizeof(srcY));
+	GLTraceWrite(&srcZ, sizeof(srcZ));
+	GLTraceWrite(&dstName, sizeof(dstName));
+	GLTraceWrite(&dstTarget, sizeof(dstTarget));
+	GLTraceWrite(&dstLevel, sizeof(dstLevel));
+	GLTraceWrite(&dstX, sizeof(dstX));
+	GLTraceWrite(&dstY, sizeof(dstY));
+	GLTraceWrite(&dstZ, sizeof(dstZ));
+	GLTraceWrite(&srcWidth, sizeof(srcWidth));
+	GLTraceWrite(&srcHeight, sizeof(srcHeight));
+	GLTraceWrite(&srcDepth, sizeof(srcDepth));
+}
+static PFNGLFRAMEBUFFERPARAMETERIPROC glad_trace_next_glFramebufferParameteri;
+static void APIENTRY glad_trace_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_trace_next_glFramebufferParameteri(target, pname, param);
+	GLTraceBeginCall(525);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLINVALIDATETEXSUBIMAGEPROC glad_trace_next_glInvalidateTexSubImage;
+static void APIENTRY glad_trace_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_trace_next_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	GLTraceBeginCall(528);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&zoffset, sizeof(zoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+}
+static PFNGLINVALIDATETEXIMAGEPROC glad_trace_next_glInvalidateTexImage;
+static void APIENTRY glad_trace_glInvalidateTexImage(GLuint texture, GLint level) {
+	glad_trace_next_glInvalidateTexImage(texture, level);
+	GLTraceBeginCall(529);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+}
+static PFNGLINVALIDATEBUFFERSUBDATAPROC glad_trace_next_glInvalidateBufferSubData;
+static void APIENTRY glad_trace_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_trace_next_glInvalidateBufferSubData(buffer, offset, length);
+	GLTraceBeginCall(530);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&length, sizeof(length));
+}
+static PFNGLINVALIDATEBUFFERDATAPROC glad_trace_next_glInvalidateBufferData;
+static void APIENTRY glad_trace_glInvalidateBufferData(GLuint buffer) {
+	glad_trace_next_glInvalidateBufferData(buffer);
+	GLTraceBeginCall(531);
+	GLTraceWrite(&buffer, sizeof(buffer));
+}
+static PFNGLINVALIDATEFRAMEBUFFERPROC glad_trace_next_glInvalidateFramebuffer;
+static void APIENTRY glad_trace_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	glad_trace_next_glInvalidateFramebuffer(target, numAttachments, attachments);
+	GLTraceBeginCall(532);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&numAttachments, sizeof(numAttachments));
+	GLTraceWriteBlob(attachments, (u64)(numAttachments * sizeof(GLenum)));
+}
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_trace_next_glInvalidateSubFramebuffer;
+static void APIENTRY glad_trace_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_next_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	GLTraceBeginCall(533);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&numAttachments, sizeof(numAttachments));
+	GLTraceWriteBlob(attachments, (u64)(numAttachments * sizeof(GLenum)));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_trace_next_glMultiDrawArraysIndirect;
+static void APIENTRY glad_trace_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_trace_next_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	GLTraceBeginCall(534);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWriteOffset(indirect);
+	GLTraceWrite(&drawcount, sizeof(drawcount));
+	GLTraceWrite(&stride, sizeof(stride));
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_trace_next_glMultiDrawElementsIndirect;
+static void APIENTRY glad_trace_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_trace_next_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	GLTraceBeginCall(535);
+	GLTraceWrite(&mode, sizeof(mode));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteOffset(indirect);
+	GLTraceWrite(&drawcount, sizeof(drawcount));
+	GLTraceWrite(&stride, sizeof(stride));
+}
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_trace_next_glShaderStorageBlockBinding;
+static void APIENTRY glad_trace_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+	glad_trace_next_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	GLTraceBeginCall(542);
+	GLTraceWrite(&program, sizeof(program));
+	GLTraceWrite(&storageBlockIndex, sizeof(storageBlockIndex));
+	GLTraceWrite(&storageBlockBinding, sizeof(storageBlockBinding));
+}
+static PFNGLTEXBUFFERRANGEPROC glad_trace_next_glTexBufferRange;
+static void APIENTRY glad_trace_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_trace_next_glTexBufferRange(target, internalformat, buffer, offset, size);
+	GLTraceBeginCall(543);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&size, sizeof(size));
+}
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_trace_next_glTexStorage2DMultisample;
+static void APIENTRY glad_trace_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_trace_next_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	GLTraceBeginCall(544);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&samples, sizeof(samples));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_trace_next_glTexStorage3DMultisample;
+static void APIENTRY glad_trace_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_trace_next_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	GLTraceBeginCall(545);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&samples, sizeof(samples));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+static PFNGLTEXTUREVIEWPROC glad_trace_next_glTextureView;
+static void APIENTRY glad_trace_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+	glad_trace_next_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	GLTraceBeginCall(546);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&origtexture, sizeof(origtexture));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&minlevel, sizeof(minlevel));
+	GLTraceWrite(&numlevels, sizeof(numlevels));
+	GLTraceWrite(&minlayer, sizeof(minlayer));
+	GLTraceWrite(&numlayers, sizeof(numlayers));
+}
+static PFNGLBINDVERTEXBUFFERPROC glad_trace_next_glBindVertexBuffer;
+static void APIENTRY glad_trace_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_trace_next_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+	GLTraceBeginCall(547);
+	GLTraceWrite(&bindingindex, sizeof(bindingindex));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&stride, sizeof(stride));
+}
+static PFNGLVERTEXATTRIBFORMATPROC glad_trace_next_glVertexAttribFormat;
+static void APIENTRY glad_trace_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_trace_next_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	GLTraceBeginCall(548);
+	GLTraceWrite(&attribindex, sizeof(attribindex));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWrite(&relativeoffset, sizeof(relativeoffset));
+}
+static PFNGLVERTEXATTRIBIFORMATPROC glad_trace_next_glVertexAttribIFormat;
+static void APIENTRY glad_trace_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_trace_next_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+	GLTraceBeginCall(549);
+	GLTraceWrite(&attribindex, sizeof(attribindex));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&relativeoffset, sizeof(relativeoffset));
+}
+static PFNGLVERTEXATTRIBLFORMATPROC glad_trace_next_glVertexAttribLFormat;
+static void APIENTRY glad_trace_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_trace_next_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+	GLTraceBeginCall(550);
+	GLTraceWrite(&attribindex, sizeof(attribindex));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&relativeoffset, sizeof(relativeoffset));
+}
+static PFNGLVERTEXATTRIBBINDINGPROC glad_trace_next_glVertexAttribBinding;
+static void APIENTRY glad_trace_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+	glad_trace_next_glVertexAttribBinding(attribindex, bindingindex);
+	GLTraceBeginCall(551);
+	GLTraceWrite(&attribindex, sizeof(attribindex));
+	GLTraceWrite(&bindingindex, sizeof(bindingindex));
+}
+static PFNGLVERTEXBINDINGDIVISORPROC glad_trace_next_glVertexBindingDivisor;
+static void APIENTRY glad_trace_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+	glad_trace_next_glVertexBindingDivisor(bindingindex, divisor);
+	GLTraceBeginCall(552);
+	GLTraceWrite(&bindingindex, sizeof(bindingindex));
+	GLTraceWrite(&divisor, sizeof(divisor));
+}
+static PFNGLDEBUGMESSAGECONTROLPROC glad_trace_next_glDebugMessageControl;
+static void APIENTRY glad_trace_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	glad_trace_next_glDebugMessageControl(source, type, severity, count, ids, enabled);
+	GLTraceBeginCall(553);
+	GLTraceWrite(&source, sizeof(source));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&severity, sizeof(severity));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(ids, (u64)(count * sizeof(GLuint)));
+	GLTraceWrite(&enabled, sizeof(enabled));
+}
+static PFNGLDEBUGMESSAGEINSERTPROC glad_trace_next_glDebugMessageInsert;
+static void APIENTRY glad_trace_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	glad_trace_next_glDebugMessageInsert(source, type, id, severity, length, buf);
+	GLTraceBeginCall(554);
+	GLTraceWrite(&source, sizeof(source));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&id, sizeof(id));
+	GLTraceWrite(&severity, sizeof(severity));
+	GLTraceWrite(&length, sizeof(length));
+	GLTraceWriteString(buf, length);
+}
+static PFNGLDEBUGMESSAGECALLBACKPROC glad_trace_next_glDebugMessageCallback;
+static void APIENTRY glad_trace_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	glad_trace_next_glDebugMessageCallback(callback, userParam);
+	GLTraceUnsupported(555);
+}
+static PFNGLPUSHDEBUGGROUPPROC glad_trace_next_glPushDebugGroup;
+static void APIENTRY glad_trace_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	glad_trace_next_glPushDebugGroup(source, id, length, message);
+	GLTraceBeginCall(557);
+	GLTraceWrite(&source, sizeof(source));
+	GLTraceWrite(&id, sizeof(id));
+	GLTraceWrite(&length, sizeof(length));
+	GLTraceWriteString(message, length);
+}
+static PFNGLPOPDEBUGGROUPPROC glad_trace_next_glPopDebugGroup;
+static void APIENTRY glad_trace_glPopDebugGroup(void) {
+	glad_trace_next_glPopDebugGroup();
+	GLTraceBeginCall(558);
+}
+static PFNGLOBJECTLABELPROC glad_trace_next_glObjectLabel;
+static void APIENTRY glad_trace_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	glad_trace_next_glObjectLabel(identifier, name, length, label);
+	GLTraceBeginCall(559);
+	GLTraceWrite(&identifier, sizeof(identifier));
+	GLTraceWrite(&name, sizeof(name));
+	GLTraceWrite(&length, sizeof(length));
+	GLTraceWriteString(label, length);
+}
+static PFNGLOBJECTPTRLABELPROC glad_trace_next_glObjectPtrLabel;
+static void APIENTRY glad_trace_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	glad_trace_next_glObjectPtrLabel(ptr, length, label);
+	GLTraceUnsupported(561);
+}
+static PFNGLBUFFERSTORAGEPROC glad_trace_next_glBufferStorage;
+static void APIENTRY glad_trace_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_trace_next_glBufferStorage(target, size, data, flags);
+	GLTraceBeginCall(564);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWriteBlob(data, (u64)(size));
+	GLTraceWrite(&flags, sizeof(flags));
+}
+static PFNGLCLEARTEXIMAGEPROC glad_trace_next_glClearTexImage;
+static void APIENTRY glad_trace_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+	glad_trace_next_glClearTexImage(texture, level, format, type, data);
+	GLTraceBeginCall(565);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(data, (u64)(GLTraceImageSize(format, type, 1, 1, 1)));
+}
+static PFNGLCLEARTEXSUBIMAGEPROC glad_trace_next_glClearTexSubImage;
+static void APIENTRY glad_trace_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+	glad_trace_next_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	GLTraceBeginCall(566);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&zoffset, sizeof(zoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(data, (u64)(GLTraceImageSize(format, type, 1, 1, 1)));
+}
+static PFNGLBINDBUFFERSBASEPROC glad_trace_next_glBindBuffersBase;
+static void APIENTRY glad_trace_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+	glad_trace_next_glBindBuffersBase(target, first, count, buffers);
+	GLTraceBeginCall(567);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(buffers, (u64)(count) * sizeof(GLuint));
+}
+static PFNGLBINDBUFFERSRANGEPROC glad_trace_next_glBindBuffersRange;
+static void APIENTRY glad_trace_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+	glad_trace_next_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+	GLTraceBeginCall(568);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(buffers, (u64)(count) * sizeof(GLuint));
+	GLTraceWriteBlob(offsets, (u64)(count * sizeof(GLintptr)));
+	GLTraceWriteBlob(sizes, (u64)(count * sizeof(GLsizeiptr)));
+}
+static PFNGLBINDTEXTURESPROC glad_trace_next_glBindTextures;
+static void APIENTRY glad_trace_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_trace_next_glBindTextures(first, count, textures);
+	GLTraceBeginCall(569);
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(textures, (u64)(count) * sizeof(GLuint));
+}
+static PFNGLBINDSAMPLERSPROC glad_trace_next_glBindSamplers;
+static void APIENTRY glad_trace_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+	glad_trace_next_glBindSamplers(first, count, samplers);
+	GLTraceBeginCall(570);
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(samplers, (u64)(count) * sizeof(GLuint));
+}
+static PFNGLBINDIMAGETEXTURESPROC glad_trace_next_glBindImageTextures;
+static void APIENTRY glad_trace_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_trace_next_glBindImageTextures(first, count, textures);
+	GLTraceBeginCall(571);
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(textures, (u64)(count) * sizeof(GLuint));
+}
+static PFNGLBINDVERTEXBUFFERSPROC glad_trace_next_glBindVertexBuffers;
+static void APIENTRY glad_trace_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_trace_next_glBindVertexBuffers(first, count, buffers, offsets, strides);
+	GLTraceBeginCall(572);
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(buffers, (u64)(count) * sizeof(GLuint));
+	GLTraceWriteBlob(offsets, (u64)(count * sizeof(GLintptr)));
+	GLTraceWriteBlob(strides, (u64)(count * sizeof(GLsizei)));
+}
+static PFNGLCLIPCONTROLPROC glad_trace_next_glClipControl;
+static void APIENTRY glad_trace_glClipControl(GLenum origin, GLenum depth) {
+	glad_trace_next_glClipControl(origin, depth);
+	GLTraceBeginCall(573);
+	GLTraceWrite(&origin, sizeof(origin));
+	GLTraceWrite(&depth, sizeof(depth));
+}
+static PFNGLCREATETRANSFORMFEEDBACKSPROC glad_trace_next_glCreateTransformFeedbacks;
+static void APIENTRY glad_trace_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_trace_next_glCreateTransformFeedbacks(n, ids);
+	GLTraceBeginCall(574);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(ids, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_trace_next_glTransformFeedbackBufferBase;
+static void APIENTRY glad_trace_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	glad_trace_next_glTransformFeedbackBufferBase(xfb, index, buffer);
+	GLTraceBeginCall(575);
+	GLTraceWrite(&xfb, sizeof(xfb));
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&buffer, sizeof(buffer));
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_trace_next_glTransformFeedbackBufferRange;
+static void APIENTRY glad_trace_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_trace_next_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+	GLTraceBeginCall(576);
+	GLTraceWrite(&xfb, sizeof(xfb));
+	GLTraceWrite(&index, sizeof(index));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&size, sizeof(size));
+}
+static PFNGLCREATEBUFFERSPROC glad_trace_next_glCreateBuffers;
+static void APIENTRY glad_trace_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	glad_trace_next_glCreateBuffers(n, buffers);
+	GLTraceBeginCall(580);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(buffers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLNAMEDBUFFERSTORAGEPROC glad_trace_next_glNamedBufferStorage;
+static void APIENTRY glad_trace_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_trace_next_glNamedBufferStorage(buffer, size, data, flags);
+	GLTraceBeginCall(581);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWriteBlob(data, (u64)(size));
+	GLTraceWrite(&flags, sizeof(flags));
+}
+static PFNGLNAMEDBUFFERDATAPROC glad_trace_next_glNamedBufferData;
+static void APIENTRY glad_trace_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_trace_next_glNamedBufferData(buffer, size, data, usage);
+	GLTraceBeginCall(582);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWriteBlob(data, (u64)(size));
+	GLTraceWrite(&usage, sizeof(usage));
+}
+static PFNGLNAMEDBUFFERSUBDATAPROC glad_trace_next_glNamedBufferSubData;
+static void APIENTRY glad_trace_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_trace_next_glNamedBufferSubData(buffer, offset, size, data);
+	GLTraceBeginCall(583);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWriteBlob(data, (u64)(size));
+}
+static PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_trace_next_glCopyNamedBufferSubData;
+static void APIENTRY glad_trace_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_trace_next_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	GLTraceBeginCall(584);
+	GLTraceWrite(&readBuffer, sizeof(readBuffer));
+	GLTraceWrite(&writeBuffer, sizeof(writeBuffer));
+	GLTraceWrite(&readOffset, sizeof(readOffset));
+	GLTraceWrite(&writeOffset, sizeof(writeOffset));
+	GLTraceWrite(&size, sizeof(size));
+}
+static PFNGLCLEARNAMEDBUFFERDATAPROC glad_trace_next_glClearNamedBufferData;
+static void APIENTRY glad_trace_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_trace_next_glClearNamedBufferData(buffer, internalformat, format, type, data);
+	GLTraceBeginCall(585);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(data, (u64)(GLTraceImageSize(format, type, 1, 1, 1)));
+}
+static PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_trace_next_glClearNamedBufferSubData;
+static void APIENTRY glad_trace_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_trace_next_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+	GLTraceBeginCall(586);
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWriteBlob(data, (u64)(GLTraceImageSize(format, type, 1, 1, 1)));
+}
+static PFNGLMAPNAMEDBUFFERPROC glad_trace_next_glMapNamedBuffer;
+static void * APIENTRY glad_trace_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	void * glad_result = glad_trace_next_glMapNamedBuffer(buffer, access);
+	GLTraceUnsupported(587);
+	return glad_result;
+}
+static PFNGLMAPNAMEDBUFFERRANGEPROC glad_trace_next_glMapNamedBufferRange;
+static void * APIENTRY glad_trace_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	void * glad_result = glad_trace_next_glMapNamedBufferRange(buffer, offset, length, access);
+	GLTraceUnsupported(588);
+	return glad_result;
+}
+static PFNGLUNMAPNAMEDBUFFERPROC glad_trace_next_glUnmapNamedBuffer;
+static GLboolean APIENTRY glad_trace_glUnmapNamedBuffer(GLuint buffer) {
+	GLboolean glad_result = glad_trace_next_glUnmapNamedBuffer(buffer);
+	GLTraceUnsupported(589);
+	return glad_result;
+}
+static PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_trace_next_glFlushMappedNamedBufferRange;
+static void APIENTRY glad_trace_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_trace_next_glFlushMappedNamedBufferRange(buffer, offset, length);
+	GLTraceUnsupported(590);
+}
+static PFNGLCREATEFRAMEBUFFERSPROC glad_trace_next_glCreateFramebuffers;
+static void APIENTRY glad_trace_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_trace_next_glCreateFramebuffers(n, framebuffers);
+	GLTraceBeginCall(595);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(framebuffers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_trace_next_glNamedFramebufferRenderbuffer;
+static void APIENTRY glad_trace_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_trace_next_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+	GLTraceBeginCall(596);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&attachment, sizeof(attachment));
+	GLTraceWrite(&renderbuffertarget, sizeof(renderbuffertarget));
+	GLTraceWrite(&renderbuffer, sizeof(renderbuffer));
+}
+static PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_trace_next_glNamedFramebufferParameteri;
+static void APIENTRY glad_trace_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	glad_trace_next_glNamedFramebufferParameteri(framebuffer, pname, param);
+	GLTraceBeginCall(597);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_trace_next_glNamedFramebufferTexture;
+static void APIENTRY glad_trace_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	glad_trace_next_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+	GLTraceBeginCall(598);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&attachment, sizeof(attachment));
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_trace_next_glNamedFramebufferTextureLayer;
+static void APIENTRY glad_trace_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_trace_next_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+	GLTraceBeginCall(599);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&attachment, sizeof(attachment));
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&layer, sizeof(layer));
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_trace_next_glNamedFramebufferDrawBuffer;
+static void APIENTRY glad_trace_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	glad_trace_next_glNamedFramebufferDrawBuffer(framebuffer, buf);
+	GLTraceBeginCall(600);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&buf, sizeof(buf));
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_trace_next_glNamedFramebufferDrawBuffers;
+static void APIENTRY glad_trace_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	glad_trace_next_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+	GLTraceBeginCall(601);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(bufs, (u64)(n * sizeof(GLenum)));
+}
+static PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_trace_next_glNamedFramebufferReadBuffer;
+static void APIENTRY glad_trace_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	glad_trace_next_glNamedFramebufferReadBuffer(framebuffer, src);
+	GLTraceBeginCall(602);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&src, sizeof(src));
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_trace_next_glInvalidateNamedFramebufferData;
+static void APIENTRY glad_trace_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	glad_trace_next_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+	GLTraceBeginCall(603);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&numAttachments, sizeof(numAttachments));
+	GLTraceWriteBlob(attachments, (u64)(numAttachments * sizeof(GLenum)));
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_trace_next_glInvalidateNamedFramebufferSubData;
+static void APIENTRY glad_trace_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_next_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+	GLTraceBeginCall(604);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&numAttachments, sizeof(numAttachments));
+	GLTraceWriteBlob(attachments, (u64)(numAttachments * sizeof(GLenum)));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_trace_next_glClearNamedFramebufferiv;
+static void APIENTRY glad_trace_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_trace_next_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+	GLTraceBeginCall(605);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&drawbuffer, sizeof(drawbuffer));
+	GLTraceWriteBlob(value, (u64)((buffer == GL_COLOR ? 4 : 1) * sizeof(GLint)));
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_trace_next_glClearNamedFramebufferuiv;
+static void APIENTRY glad_trace_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_trace_next_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+	GLTraceBeginCall(606);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&drawbuffer, sizeof(drawbuffer));
+	GLTraceWriteBlob(value, (u64)((buffer == GL_COLOR ? 4 : 1) * sizeof(GLuint)));
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_trace_next_glClearNamedFramebufferfv;
+static void APIENTRY glad_trace_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_trace_next_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+	GLTraceBeginCall(607);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&drawbuffer, sizeof(drawbuffer));
+	GLTraceWriteBlob(value, (u64)((buffer == GL_COLOR ? 4 : 1) * sizeof(GLfloat)));
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_trace_next_glClearNamedFramebufferfi;
+static void APIENTRY glad_trace_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_trace_next_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+	GLTraceBeginCall(608);
+	GLTraceWrite(&framebuffer, sizeof(framebuffer));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&drawbuffer, sizeof(drawbuffer));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&stencil, sizeof(stencil));
+}
+static PFNGLBLITNAMEDFRAMEBUFFERPROC glad_trace_next_glBlitNamedFramebuffer;
+static void APIENTRY glad_trace_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_trace_next_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	GLTraceBeginCall(609);
+	GLTraceWrite(&readFramebuffer, sizeof(readFramebuffer));
+	GLTraceWrite(&drawFramebuffer, sizeof(drawFramebuffer));
+	GLTraceWrite(&srcX0, sizeof(srcX0));
+	GLTraceWrite(&srcY0, sizeof(srcY0));
+	GLTraceWrite(&srcX1, sizeof(srcX1));
+	GLTraceWrite(&srcY1, sizeof(srcY1));
+	GLTraceWrite(&dstX0, sizeof(dstX0));
+	GLTraceWrite(&dstY0, sizeof(dstY0));
+	GLTraceWrite(&dstX1, sizeof(dstX1));
+	GLTraceWrite(&dstY1, sizeof(dstY1));
+	GLTraceWrite(&mask, sizeof(mask));
+	GLTraceWrite(&filter, sizeof(filter));
+}
+static PFNGLCREATERENDERBUFFERSPROC glad_trace_next_glCreateRenderbuffers;
+static void APIENTRY glad_trace_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_trace_next_glCreateRenderbuffers(n, renderbuffers);
+	GLTraceBeginCall(613);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(renderbuffers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_trace_next_glNamedRenderbufferStorage;
+static void APIENTRY glad_trace_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_trace_next_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+	GLTraceBeginCall(614);
+	GLTraceWrite(&renderbuffer, sizeof(renderbuffer));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_trace_next_glNamedRenderbufferStorageMultisample;
+static void APIENTRY glad_trace_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_trace_next_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+	GLTraceBeginCall(615);
+	GLTraceWrite(&renderbuffer, sizeof(renderbuffer));
+	GLTraceWrite(&samples, sizeof(samples));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLCREATETEXTURESPROC glad_trace_next_glCreateTextures;
+static void APIENTRY glad_trace_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	glad_trace_next_glCreateTextures(target, n, textures);
+	GLTraceBeginCall(617);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(textures, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLTEXTUREBUFFERPROC glad_trace_next_glTextureBuffer;
+static void APIENTRY glad_trace_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	glad_trace_next_glTextureBuffer(texture, internalformat, buffer);
+	GLTraceBeginCall(618);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&buffer, sizeof(buffer));
+}
+static PFNGLTEXTUREBUFFERRANGEPROC glad_trace_next_glTextureBufferRange;
+static void APIENTRY glad_trace_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_trace_next_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+	GLTraceBeginCall(619);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&size, sizeof(size));
+}
+static PFNGLTEXTURESTORAGE1DPROC glad_trace_next_glTextureStorage1D;
+static void APIENTRY glad_trace_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_trace_next_glTextureStorage1D(texture, levels, internalformat, width);
+	GLTraceBeginCall(620);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&levels, sizeof(levels));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+}
+static PFNGLTEXTURESTORAGE2DPROC glad_trace_next_glTextureStorage2D;
+static void APIENTRY glad_trace_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_trace_next_glTextureStorage2D(texture, levels, internalformat, width, height);
+	GLTraceBeginCall(621);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&levels, sizeof(levels));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLTEXTURESTORAGE3DPROC glad_trace_next_glTextureStorage3D;
+static void APIENTRY glad_trace_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_trace_next_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+	GLTraceBeginCall(622);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&levels, sizeof(levels));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+}
+static PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_trace_next_glTextureStorage2DMultisample;
+static void APIENTRY glad_trace_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_trace_next_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+	GLTraceBeginCall(623);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&samples, sizeof(samples));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+static PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_trace_next_glTextureStorage3DMultisample;
+static void APIENTRY glad_trace_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_trace_next_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+	GLTraceBeginCall(624);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&samples, sizeof(samples));
+	GLTraceWrite(&internalformat, sizeof(internalformat));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&fixedsamplelocations, sizeof(fixedsamplelocations));
+}
+static PFNGLTEXTURESUBIMAGE1DPROC glad_trace_next_glTextureSubImage1D;
+static void APIENTRY glad_trace_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_next_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+	GLTraceBeginCall(625);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixels(pixels, (u64)(GLTraceImageSize(format, type, width, 1, 1)));
+}
+static PFNGLTEXTURESUBIMAGE2DPROC glad_trace_next_glTextureSubImage2D;
+static void APIENTRY glad_trace_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_next_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+	GLTraceBeginCall(626);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixels(pixels, (u64)(GLTraceImageSize(format, type, width, height, 1)));
+}
+static PFNGLTEXTURESUBIMAGE3DPROC glad_trace_next_glTextureSubImage3D;
+static void APIENTRY glad_trace_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_trace_next_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	GLTraceBeginCall(627);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&zoffset, sizeof(zoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWritePixels(pixels, (u64)(GLTraceImageSize(format, type, width, height, depth)));
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_trace_next_glCompressedTextureSubImage1D;
+static void APIENTRY glad_trace_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_trace_next_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+	GLTraceBeginCall(628);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&imageSize, sizeof(imageSize));
+	GLTraceWritePixels(data, (u64)(imageSize));
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_trace_next_glCompressedTextureSubImage2D;
+static void APIENTRY glad_trace_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_trace_next_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+	GLTraceBeginCall(629);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&imageSize, sizeof(imageSize));
+	GLTraceWritePixels(data, (u64)(imageSize));
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_trace_next_glCompressedTextureSubImage3D;
+static void APIENTRY glad_trace_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_trace_next_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	GLTraceBeginCall(630);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&zoffset, sizeof(zoffset));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&depth, sizeof(depth));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&imageSize, sizeof(imageSize));
+	GLTraceWritePixels(data, (u64)(imageSize));
+}
+static PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_trace_next_glCopyTextureSubImage1D;
+static void APIENTRY glad_trace_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_trace_next_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+	GLTraceBeginCall(631);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+}
+static PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_trace_next_glCopyTextureSubImage2D;
+static void APIENTRY glad_trace_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_next_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+	GLTraceBeginCall(632);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_trace_next_glCopyTextureSubImage3D;
+static void APIENTRY glad_trace_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_trace_next_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+	GLTraceBeginCall(633);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&level, sizeof(level));
+	GLTraceWrite(&xoffset, sizeof(xoffset));
+	GLTraceWrite(&yoffset, sizeof(yoffset));
+	GLTraceWrite(&zoffset, sizeof(zoffset));
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+}
+static PFNGLTEXTUREPARAMETERFPROC glad_trace_next_glTextureParameterf;
+static void APIENTRY glad_trace_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	glad_trace_next_glTextureParameterf(texture, pname, param);
+	GLTraceBeginCall(634);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLTEXTUREPARAMETERFVPROC glad_trace_next_glTextureParameterfv;
+static void APIENTRY glad_trace_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	glad_trace_next_glTextureParameterfv(texture, pname, param);
+	GLTraceBeginCall(635);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(param, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLfloat)));
+}
+static PFNGLTEXTUREPARAMETERIPROC glad_trace_next_glTextureParameteri;
+static void APIENTRY glad_trace_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	glad_trace_next_glTextureParameteri(texture, pname, param);
+	GLTraceBeginCall(636);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWrite(&param, sizeof(param));
+}
+static PFNGLTEXTUREPARAMETERIIVPROC glad_trace_next_glTextureParameterIiv;
+static void APIENTRY glad_trace_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	glad_trace_next_glTextureParameterIiv(texture, pname, params);
+	GLTraceBeginCall(637);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(params, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLint)));
+}
+static PFNGLTEXTUREPARAMETERIUIVPROC glad_trace_next_glTextureParameterIuiv;
+static void APIENTRY glad_trace_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	glad_trace_next_glTextureParameterIuiv(texture, pname, params);
+	GLTraceBeginCall(638);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(params, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLuint)));
+}
+static PFNGLTEXTUREPARAMETERIVPROC glad_trace_next_glTextureParameteriv;
+static void APIENTRY glad_trace_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	glad_trace_next_glTextureParameteriv(texture, pname, param);
+	GLTraceBeginCall(639);
+	GLTraceWrite(&texture, sizeof(texture));
+	GLTraceWrite(&pname, sizeof(pname));
+	GLTraceWriteBlob(param, (u64)((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * sizeof(GLint)));
+}
+static PFNGLGENERATETEXTUREMIPMAPPROC glad_trace_next_glGenerateTextureMipmap;
+static void APIENTRY glad_trace_glGenerateTextureMipmap(GLuint texture) {
+	glad_trace_next_glGenerateTextureMipmap(texture);
+	GLTraceBeginCall(640);
+	GLTraceWrite(&texture, sizeof(texture));
+}
+static PFNGLBINDTEXTUREUNITPROC glad_trace_next_glBindTextureUnit;
+static void APIENTRY glad_trace_glBindTextureUnit(GLuint unit, GLuint texture) {
+	glad_trace_next_glBindTextureUnit(unit, texture);
+	GLTraceBeginCall(641);
+	GLTraceWrite(&unit, sizeof(unit));
+	GLTraceWrite(&texture, sizeof(texture));
+}
+static PFNGLCREATEVERTEXARRAYSPROC glad_trace_next_glCreateVertexArrays;
+static void APIENTRY glad_trace_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_trace_next_glCreateVertexArrays(n, arrays);
+	GLTraceBeginCall(650);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(arrays, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_trace_next_glDisableVertexArrayAttrib;
+static void APIENTRY glad_trace_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_trace_next_glDisableVertexArrayAttrib(vaobj, index);
+	GLTraceBeginCall(651);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&index, sizeof(index));
+}
+static PFNGLENABLEVERTEXARRAYATTRIBPROC glad_trace_next_glEnableVertexArrayAttrib;
+static void APIENTRY glad_trace_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_trace_next_glEnableVertexArrayAttrib(vaobj, index);
+	GLTraceBeginCall(652);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&index, sizeof(index));
+}
+static PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_trace_next_glVertexArrayElementBuffer;
+static void APIENTRY glad_trace_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	glad_trace_next_glVertexArrayElementBuffer(vaobj, buffer);
+	GLTraceBeginCall(653);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&buffer, sizeof(buffer));
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_trace_next_glVertexArrayVertexBuffer;
+static void APIENTRY glad_trace_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_trace_next_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+	GLTraceBeginCall(654);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&bindingindex, sizeof(bindingindex));
+	GLTraceWrite(&buffer, sizeof(buffer));
+	GLTraceWrite(&offset, sizeof(offset));
+	GLTraceWrite(&stride, sizeof(stride));
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_trace_next_glVertexArrayVertexBuffers;
+static void APIENTRY glad_trace_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_trace_next_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+	GLTraceBeginCall(655);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&first, sizeof(first));
+	GLTraceWrite(&count, sizeof(count));
+	GLTraceWriteBlob(buffers, (u64)(count) * sizeof(GLuint));
+	GLTraceWriteBlob(offsets, (u64)(count * sizeof(GLintptr)));
+	GLTraceWriteBlob(strides, (u64)(count * sizeof(GLsizei)));
+}
+static PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_trace_next_glVertexArrayAttribBinding;
+static void APIENTRY glad_trace_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	glad_trace_next_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+	GLTraceBeginCall(656);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&attribindex, sizeof(attribindex));
+	GLTraceWrite(&bindingindex, sizeof(bindingindex));
+}
+static PFNGLVERTEXARRAYATTRIBFORMATPROC glad_trace_next_glVertexArrayAttribFormat;
+static void APIENTRY glad_trace_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_trace_next_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+	GLTraceBeginCall(657);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&attribindex, sizeof(attribindex));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&normalized, sizeof(normalized));
+	GLTraceWrite(&relativeoffset, sizeof(relativeoffset));
+}
+static PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_trace_next_glVertexArrayAttribIFormat;
+static void APIENTRY glad_trace_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_trace_next_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+	GLTraceBeginCall(658);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&attribindex, sizeof(attribindex));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&relativeoffset, sizeof(relativeoffset));
+}
+static PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_trace_next_glVertexArrayAttribLFormat;
+static void APIENTRY glad_trace_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_trace_next_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+	GLTraceBeginCall(659);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&attribindex, sizeof(attribindex));
+	GLTraceWrite(&size, sizeof(size));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&relativeoffset, sizeof(relativeoffset));
+}
+static PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_trace_next_glVertexArrayBindingDivisor;
+static void APIENTRY glad_trace_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	glad_trace_next_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+	GLTraceBeginCall(660);
+	GLTraceWrite(&vaobj, sizeof(vaobj));
+	GLTraceWrite(&bindingindex, sizeof(bindingindex));
+	GLTraceWrite(&divisor, sizeof(divisor));
+}
+static PFNGLCREATESAMPLERSPROC glad_trace_next_glCreateSamplers;
+static void APIENTRY glad_trace_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	glad_trace_next_glCreateSamplers(n, samplers);
+	GLTraceBeginCall(664);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(samplers, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLCREATEPROGRAMPIPELINESPROC glad_trace_next_glCreateProgramPipelines;
+static void APIENTRY glad_trace_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_trace_next_glCreateProgramPipelines(n, pipelines);
+	GLTraceBeginCall(665);
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(pipelines, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLCREATEQUERIESPROC glad_trace_next_glCreateQueries;
+static void APIENTRY glad_trace_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	glad_trace_next_glCreateQueries(target, n, ids);
+	GLTraceBeginCall(666);
+	GLTraceWrite(&target, sizeof(target));
+	GLTraceWrite(&n, sizeof(n));
+	GLTraceWriteBlob(ids, (u64)(n) * sizeof(GLuint));
+}
+static PFNGLMEMORYBARRIERBYREGIONPROC glad_trace_next_glMemoryBarrierByRegion;
+static void APIENTRY glad_trace_glMemoryBarrierByRegion(GLbitfield barriers) {
+	glad_trace_next_glMemoryBarrierByRegion(barriers);
+	GLTraceBeginCall(671);
+	GLTraceWrite(&barriers, sizeof(barriers));
+}
+static PFNGLREADNPIXELSPROC glad_trace_next_glReadnPixels;
+static void APIENTRY glad_trace_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	glad_trace_next_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+	GLTraceBeginCall(681);
+	GLTraceWrite(&x, sizeof(x));
+	GLTraceWrite(&y, sizeof(y));
+	GLTraceWrite(&width, sizeof(width));
+	GLTraceWrite(&height, sizeof(height));
+	GLTraceWrite(&format, sizeof(format));
+	GLTraceWrite(&type, sizeof(type));
+	GLTraceWrite(&bufSize, sizeof(bufSize));
+	GLTraceWritePixelsOut(data, (u64)(bufSize));
+}
+static PFNGLTEXTUREBARRIERPROC glad_trace_next_glTextureBarrier;
+static void APIENTRY glad_trace_glTextureBarrier(void) {
+	glad_trace_next_glTextureBarrier();
+	GLTraceBeginCall(694);
+}
+
+void gladTraceInstall(void) {
+	if (glad_glCullFace != NULL && glad_glCullFace != glad_trace_glCullFace) {
+		glad_trace_next_glCullFace = glad_glCullFace;
+		glad_glCullFace = glad_trace_glCullFace;
+	}
+	if (glad_glFrontFace != NULL && glad_glFrontFace != glad_trace_glFrontFace) {
+		glad_trace_next_glFrontFace = glad_glFrontFace;
+		glad_glFrontFace = glad_trace_glFrontFace;
+	}
+	if (glad_glHint != NULL && glad_glHint != glad_trace_glHint) {
+		glad_trace_next_glHint = glad_glHint;
+		glad_glHint = glad_trace_glHint;
+	}
+	if (glad_glLineWidth != NULL && glad_glLineWidth != glad_trace_glLineWidth) {
+		glad_trace_next_glLineWidth = glad_glLineWidth;
+		glad_glLineWidth = glad_trace_glLineWidth;
+	}
+	if (glad_glPointSize != NULL && glad_glPointSize != glad_trace_glPointSize) {
+		glad_trace_next_glPointSize = glad_glPointSize;
+		glad_glPointSize = glad_trace_glPointSize;
+	}
+	if (glad_glPolygonMode != NULL && glad_glPolygonMode != glad_trace_glPolygonMode) {
+		glad_trace_next_glPolygonMode = glad_glPolygonMode;
+		glad_glPolygonMode = glad_trace_glPolygonMode;
+	}
+	if (glad_glScissor != NULL && glad_glScissor != glad_trace_glScissor) {
+		glad_trace_next_glScissor = glad_glScissor;
+		glad_glScissor = glad_trace_glScissor;
+	}
+	if (glad_glTexParameterf != NULL && glad_glTexParameterf != glad_trace_glTexParameterf) {
+		glad_trace_next_glTexParameterf = glad_glTexParameterf;
+		glad_glTexParameterf = glad_trace_glTexParameterf;
+	}
+	if (glad_glTexParameterfv != NULL && glad_glTexParameterfv != glad_trace_glTexParameterfv) {
+		glad_trace_next_glTexParameterfv = glad_glTexParameterfv;
+		glad_glTexParameterfv = glad_trace_glTexParameterfv;
+	}
+	if (glad_glTexParameteri != NULL && glad_glTexParameteri != glad_trace_glTexParameteri) {
+		glad_trace_next_glTexParameteri = glad_glTexParameteri;
+		glad_glTexParameteri = glad_trace_glTexParameteri;
+	}
+	if (glad_glTexParameteriv != NULL && glad_glTexParameteriv != glad_trace_glTexParameteriv) {
+		glad_trace_next_glTexParameteriv = glad_glTexParameteriv;
+		glad_glTexParameteriv = glad_trace_glTexParameteriv;
+	}
+	if (glad_glTexImage1D != NULL && glad_glTexImage1D != glad_trace_glTexImage1D) {
+		glad_trace_next_glTexImage1D = glad_glTexImage1D;
+		glad_glTexImage1D = glad_trace_glTexImage1D;
+	}
+	if (glad_glTexImage2D != NULL && glad_glTexImage2D != glad_trace_glTexImage2D) {
+		glad_trace_next_glTexImage2D = glad_glTexImage2D;
+		glad_glTexImage2D = glad_trace_glTexImage2D;
+	}
+	if (glad_glDrawBuffer != NULL && glad_glDrawBuffer != glad_trace_glDrawBuffer) {
+		glad_trace_next_glDrawBuffer = glad_glDrawBuffer;
+		glad_glDrawBuffer = glad_trace_glDrawBuffer;
+	}
+	if (glad_glClear != NULL && glad_glClear != glad_trace_glClear) {
+		glad_trace_next_glClear = glad_glClear;
+		glad_glClear = glad_trace_glClear;
+	}
+	if (glad_glClearColor != NULL && glad_glClearColor != glad_trace_glClearColor) {
+		glad_trace_next_glClearColor = glad_glClearColor;
+		glad_glClearColor = glad_trace_glClearColor;
+	}
+	if (glad_glClearStencil != NULL && glad_glClearStencil != glad_trace_glClearStencil) {
+		glad_trace_next_glClearStencil = glad_glClearStencil;
+		glad_glClearStencil = glad_trace_glClearStencil;
+	}
+	if (glad_glClearDepth != NULL && glad_glClearDepth != glad_trace_glClearDepth) {
+		glad_trace_next_glClearDepth = glad_glClearDepth;
+		glad_glClearDepth = glad_trace_glClearDepth;
+	}
+	if (glad_glStencilMask != NULL && glad_glStencilMask != glad_trace_glStencilMask) {
+		glad_trace_next_glStencilMask = glad_glStencilMask;
+		glad_glStencilMask = glad_trace_glStencilMask;
+	}
+	if (glad_glColorMask != NULL && glad_glColorMask != glad_trace_glColorMask) {
+		glad_trace_next_glColorMask = glad_glColorMask;
+		glad_glColorMask = glad_trace_glColorMask;
+	}
+	if (glad_glDepthMask != NULL && glad_glDepthMask != glad_trace_glDepthMask) {
+		glad_trace_next_glDepthMask = glad_glDepthMask;
+		glad_glDepthMask = glad_trace_glDepthMask;
+	}
+	if (glad_glDisable != NULL && glad_glDisable != glad_trace_glDisable) {
+		glad_trace_next_glDisable = glad_glDisable;
+		glad_glDisable = glad_trace_glDisable;
+	}
+	if (glad_glEnable != NULL && glad_glEnable != glad_trace_glEnable) {
+		glad_trace_next_glEnable = glad_glEnable;
+		glad_glEnable = glad_trace_glEnable;
+	}
+	if (glad_glFinish != NULL && glad_glFinish != glad_trace_glFinish) {
+		glad_trace_next_glFinish = glad_glFinish;
+		glad_glFinish = glad_trace_glFinish;
+	}
+	if (glad_glFlush != NULL && glad_glFlush != glad_trace_glFlush) {
+		glad_trace_next_glFlush = glad_glFlush;
+		glad_glFlush = glad_trace_glFlush;
+	}
+	if (glad_glBlendFunc != NULL && glad_glBlendFunc != glad_trace_glBlendFunc) {
+		glad_trace_next_glBlendFunc = glad_glBlendFunc;
+		glad_glBlendFunc = glad_trace_glBlendFunc;
+	}
+	if (glad_glLogicOp != NULL && glad_glLogicOp != glad_trace_glLogicOp) {
+		glad_trace_next_glLogicOp = glad_glLogicOp;
+		glad_glLogicOp = glad_trace_glLogicOp;
+	}
+	if (glad_glStencilFunc != NULL && glad_glStencilFunc != glad_trace_glStencilFunc) {
+		glad_trace_next_glStencilFunc = glad_glStencilFunc;
+		glad_glStencilFunc = glad_trace_glStencilFunc;
+	}
+	if (glad_glStencilOp != NULL && glad_glStencilOp != glad_trace_glStencilOp) {
+		glad_trace_next_glStencilOp = glad_glStencilOp;
+		glad_glStencilOp = glad_trace_glStencilOp;
+	}
+	if (glad_glDepthFunc != NULL && glad_glDepthFunc != glad_trace_glDepthFunc) {
+		glad_trace_next_glDepthFunc = glad_glDepthFunc;
+		glad_glDepthFunc = glad_trace_glDepthFunc;
+	}
+	if (glad_glPixelStoref != NULL && glad_glPixelStoref != glad_trace_glPixelStoref) {
+		glad_trace_next_glPixelStoref = glad_glPixelStoref;
+		glad_glPixelStoref = glad_trace_glPixelStoref;
+	}
+	if (glad_glPixelStorei != NULL && glad_glPixelStorei != glad_trace_glPixelStorei) {
+		glad_trace_next_glPixelStorei = glad_glPixelStorei;
+		glad_glPixelStorei = glad_trace_glPixelStorei;
+	}
+	if (glad_glReadBuffer != NULL && glad_glReadBuffer != glad_trace_glReadBuffer) {
+		glad_trace_next_glReadBuffer = glad_glReadBuffer;
+		glad_glReadBuffer = glad_trace_glReadBuffer;
+	}
+	if (glad_glReadPixels != NULL && glad_glReadPixels != glad_trace_glReadPixels) {
+		glad_trace_next_glReadPixels = glad_glReadPixels;
+		glad_glReadPixels = glad_trace_glReadPixels;
+	}
+	if (glad_glDepthRange != NULL && glad_glDepthRange != glad_trace_glDepthRange) {
+		glad_trace_next_glDepthRange = glad_glDepthRange;
+		glad_glDepthRange = glad_trace_glDepthRange;
+	}
+	if (glad_glViewport != NULL && glad_glViewport != glad_trace_glViewport) {
+		glad_trace_next_glViewport = glad_glViewport;
+		glad_glViewport = glad_trace_glViewport;
+	}
+	if (glad_glDrawArrays != NULL && glad_glDrawArrays != glad_trace_glDrawArrays) {
+		glad_trace_next_glDrawArrays = glad_glDrawArrays;
+		glad_glDrawArrays = glad_trace_glDrawArrays;
+	}
+	if (glad_glDrawElements != NULL && glad_glDrawElements != glad_trace_glDrawElements) {
+		glad_trace_next_glDrawElements = glad_glDrawElements;
+		glad_glDrawElements = glad_trace_glDrawElements;
+	}
+	if (glad_glPolygonOffset != NULL && glad_glPolygonOffset != glad_trace_glPolygonOffset) {
+		glad_trace_next_glPolygonOffset = glad_glPolygonOffset;
+		glad_glPolygonOffset = glad_trace_glPolygonOffset;
+	}
+	if (glad_glCopyTexImage1D != NULL && glad_glCopyTexImage1D != glad_trace_glCopyTexImage1D) {
+		glad_trace_next_glCopyTexImage1D = glad_glCopyTexImage1D;
+		glad_glCopyTexImage1D = glad_trace_glCopyTexImage1D;
+	}
+	if (glad_glCopyTexImage2D != NULL && glad_glCopyTexImage2D != glad_trace_glCopyTexImage2D) {
+		glad_trace_next_glCopyTexImage2D = glad_glCopyTexImage2D;
+		glad_glCopyTexImage2D = glad_trace_glCopyTexImage2D;
+	}
+	if (glad_glCopyTexSubImage1D != NULL && glad_glCopyTexSubImage1D != glad_trace_glCopyTexSubImage1D) {
+		glad_trace_next_glCopyTexSubImage1D = glad_glCopyTexSubImage1D;
+		glad_glCopyTexSubImage1D = glad_trace_glCopyTexSubImage1D;
+	}
+	if (glad_glCopyTexSubImage2D != NULL && glad_glCopyTexSubImage2D != glad_trace_glCopyTexSubImage2D) {
+		glad_trace_next_glCopyTexSubImage2D = glad_glCopyTexSubImage2D;
+		glad_glCopyTexSubImage2D = glad_trace_glCopyTexSubImage2D;
+	}
+	if (glad_glTexSubImage1D != NULL && glad_glTexSubImage1D != glad_trace_glTexSubImage1D) {
+		glad_trace_next_glTexSubImage1D = glad_glTexSubImage1D;
+		glad_glTexSubImage1D = glad_trace_glTexSubImage1D;
+	}
+	if (glad_glTexSubImage2D != NULL && glad_glTexSubImage2D != glad_trace_glTexSubImage2D) {
+		glad_trace_next_glTexSubImage2D = glad_glTexSubImage2D;
+		glad_glTexSubImage2D = glad_trace_glTexSubImage2D;
+	}
+	if (glad_glBindTexture != NULL && glad_glBindTexture != glad_trace_glBindTexture) {
+		glad_trace_next_glBindTexture = glad_glBindTexture;
+		glad_glBindTexture = glad_trace_glBindTexture;
+	}
+	if (glad_glDeleteTextures != NULL && glad_glDeleteTextures != glad_trace_glDeleteTextures) {
+		glad_trace_next_glDeleteTextures = glad_glDeleteTextures;
+		glad_glDeleteTextures = glad_trace_glDeleteTextures;
+	}
+	if (glad_glGenTextures != NULL && glad_glGenTextures != glad_trace_glGenTextures) {
+		glad_trace_next_glGenTextures = glad_glGenTextures;
+		glad_glGenTextures = glad_trace_glGenTextures;
+	}
+	if (glad_glDrawRangeElements != NULL && glad_glDrawRangeElements != glad_trace_glDrawRangeElements) {
+		glad_trace_next_glDrawRangeElements = glad_glDrawRangeElements;
+		glad_glDrawRangeElements = glad_trace_glDrawRangeElements;
+	}
+	if (glad_glTexImage3D != NULL && glad_glTexImage3D != glad_trace_glTexImage3D) {
+		glad_trace_next_glTexImage3D = glad_glTexImage3D;
+		glad_glTexImage3D = glad_trace_glTexImage3D;
+	}
+	if (glad_glTexSubImage3D != NULL && glad_glTexSubImage3D != glad_trace_glTexSubImage3D) {
+		glad_trace_next_glTexSubImage3D = glad_glTexSubImage3D;
+		glad_glTexSubImage3D = glad_trace_glTexSubImage3D;
+	}
+	if (glad_glCopyTexSubImage3D != NULL && glad_glCopyTexSubImage3D != glad_trace_glCopyTexSubImage3D) {
+		glad_trace_next_glCopyTexSubImage3D = glad_glCopyTexSubImage3D;
+		glad_glCopyTexSubImage3D = glad_trace_glCopyTexSubImage3D;
+	}
+	if (glad_glActiveTexture != NULL && glad_glActiveTexture != glad_trace_glActiveTexture) {
+		glad_trace_next_glActiveTexture = glad_glActiveTexture;
+		glad_glActiveTexture = glad_trace_glActiveTexture;
+	}
+	if (glad_glSampleCoverage != NULL && glad_glSampleCoverage != glad_trace_glSampleCoverage) {
+		glad_trace_next_glSampleCoverage = glad_glSampleCoverage;
+		glad_glSampleCoverage = glad_trace_glSampleCoverage;
+	}
+	if (glad_glCompressedTexImage3D != NULL && glad_glCompressedTexImage3D != glad_trace_glCompressedTexImage3D) {
+		glad_trace_next_glCompressedTexImage3D = glad_glCompressedTexImage3D;
+		glad_glCompressedTexImage3D = glad_trace_glCompressedTexImage3D;
+	}
+	if (glad_glCompressedTexImage2D != NULL && glad_glCompressedTexImage2D != glad_trace_glCompressedTexImage2D) {
+		glad_trace_next_glCompressedTexImage2D = glad_glCompressedTexImage2D;
+		glad_glCompressedTexImage2D = glad_trace_glCompressedTexImage2D;
+	}
+	if (glad_glCompressedTexImage1D != NULL && glad_glCompressedTexImage1D != glad_trace_glCompressedTexImage1D) {
+		glad_trace_next_glCompressedTexImage1D = glad_glCompressedTexImage1D;
+		glad_glCompressedTexImage1D = glad_trace_glCompressedTexImage1D;
+	}
+	if (glad_glCompressedTexSubImage3D != NULL && glad_glCompressedTexSubImage3D != glad_trace_glCompressedTexSubImage3D) {
+		glad_trace_next_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+		glad_glCompressedTexSubImage3D = glad_trace_glCompressedTexSubImage3D;
+	}
+	if (glad_glCompressedTexSubImage2D != NULL && glad_glCompressedTexSubImage2D != glad_trace_glCompressedTexSubImage2D) {
+		glad_trace_next_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+		glad_glCompressedTexSubImage2D = glad_trace_glCompressedTexSubImage2D;
+	}
+	if (glad_glCompressedTexSubImage1D != NULL && glad_glCompressedTexSubImage1D != glad_trace_glCompressedTexSubImage1D) {
+		glad_trace_next_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+		glad_glCompressedTexSubImage1D = glad_trace_glCompressedTexSubImage1D;
+	}
+	if (glad_glBlendFuncSeparate != NULL && glad_glBlendFuncSeparate != glad_trace_glBlendFuncSeparate) {
+		glad_trace_next_glBlendFuncSeparate = glad_glBlendFuncSeparate;
+		glad_glBlendFuncSeparate = glad_trace_glBlendFuncSeparate;
+	}
+	if (glad_glMultiDrawArrays != NULL && glad_glMultiDrawArrays != glad_trace_glMultiDrawArrays) {
+		glad_trace_next_glMultiDrawArrays = glad_glMultiDrawArrays;
+		glad_glMultiDrawArrays = glad_trace_glMultiDrawArrays;
+	}
+	if (glad_glMultiDrawElements != NULL && glad_glMultiDrawElements != glad_trace_glMultiDrawElements) {
+		glad_trace_next_glMultiDrawElements = glad_glMultiDrawElements;
+		glad_glMultiDrawElements = glad_trace_glMultiDrawElements;
+	}
+	if (glad_glPointParameterf != NULL && glad_glPointParameterf != glad_trace_glPointParameterf) {
+		glad_trace_next_glPointParameterf = glad_glPointParameterf;
+		glad_glPointParameterf = glad_trace_glPointParameterf;
+	}
+	if (glad_glPointParameterfv != NULL && glad_glPointParameterfv != glad_trace_glPointParameterfv) {
+		glad_trace_next_glPointParameterfv = glad_glPointParameterfv;
+		glad_glPointParameterfv = glad_trace_glPointParameterfv;
+	}
+	if (glad_glPointParameteri != NULL && glad_glPointParameteri != glad_trace_glPointParameteri) {
+		glad_trace_next_glPointParameteri = glad_glPointParameteri;
+		glad_glPointParameteri = glad_trace_glPointParameteri;
+	}
+	if (glad_glPointParameteriv != NULL && glad_glPointParameteriv != glad_trace_glPointParameteriv) {
+		glad_trace_next_glPointParameteriv = glad_glPointParameteriv;
+		glad_glPointParameteriv = glad_trace_glPointParameteriv;
+	}
+	if (glad_glBlendColor != NULL && glad_glBlendColor != glad_trace_glBlendColor) {
+		glad_trace_next_glBlendColor = glad_glBlendColor;
+		glad_glBlendColor = glad_trace_glBlendColor;
+	}
+	if (glad_glBlendEquation != NULL && glad_glBlendEquation != glad_trace_glBlendEquation) {
+		glad_trace_next_glBlendEquation = glad_glBlendEquation;
+		glad_glBlendEquation = glad_trace_glBlendEquation;
+	}
+	if (glad_glGenQueries != NULL && glad_glGenQueries != glad_trace_glGenQueries) {
+		glad_trace_next_glGenQueries = glad_glGenQueries;
+		glad_glGenQueries = glad_trace_glGenQueries;
+	}
+	if (glad_glDeleteQueries != NULL && glad_glDeleteQueries != glad_trace_glDeleteQueries) {
+		glad_trace_next_glDeleteQueries = glad_glDeleteQueries;
+		glad_glDeleteQueries = glad_trace_glDeleteQueries;
+	}
+	if (glad_glBeginQuery != NULL && glad_glBeginQuery != glad_trace_glBeginQuery) {
+		glad_trace_next_glBeginQuery = glad_glBeginQuery;
+		glad_glBeginQuery = glad_trace_glBeginQuery;
+	}
+	if (glad_glEndQuery != NULL && glad_glEndQuery != glad_trace_glEndQuery) {
+		glad_trace_next_glEndQuery = glad_glEndQuery;
+		glad_glEndQuery = glad_trace_glEndQuery;
+	}
+	if (glad_glBindBuffer != NULL && glad_glBindBuffer != glad_trace_glBindBuffer) {
+		glad_trace_next_glBindBuffer = glad_glBindBuffer;
+		glad_glBindBuffer = glad_trace_glBindBuffer;
+	}
+	if (glad_glDeleteBuffers != NULL && glad_glDeleteBuffers != glad_trace_glDeleteBuffers) {
+		glad_trace_next_glDeleteBuffers = glad_glDeleteBuffers;
+		glad_glDeleteBuffers = glad_trace_glDeleteBuffers;
+	}
+	if (glad_glGenBuffers != NULL && glad_glGenBuffers != glad_trace_glGenBuffers) {
+		glad_trace_next_glGenBuffers = glad_glGenBuffers;
+		glad_glGenBuffers = glad_trace_glGenBuffers;
+	}
+	if (glad_glBufferData != NULL && glad_glBufferData != glad_trace_glBufferData) {
+		glad_trace_next_glBufferData = glad_glBufferData;
+		glad_glBufferData = glad_trace_glBufferData;
+	}
+	if (glad_glBufferSubData != NULL && glad_glBufferSubData != glad_trace_glBufferSubData) {
+		glad_trace_next_glBufferSubData = glad_glBufferSubData;
+		glad_glBufferSubData = glad_trace_glBufferSubData;
+	}
+	if (glad_glMapBuffer != NULL && glad_glMapBuffer != glad_trace_glMapBuffer) {
+		glad_trace_next_glMapBuffer = glad_glMapBuffer;
+		glad_glMapBuffer = glad_trace_glMapBuffer;
+	}
+	if (glad_glUnmapBuffer != NULL && glad_glUnmapBuffer != glad_trace_glUnmapBuffer) {
+		glad_trace_next_glUnmapBuffer = glad_glUnmapBuffer;
+		glad_glUnmapBuffer = glad_trace_glUnmapBuffer;
+	}
+	if (glad_glBlendEquationSeparate != NULL && glad_glBlendEquationSeparate != glad_trace_glBlendEquationSeparate) {
+		glad_trace_next_glBlendEquationSeparate = glad_glBlendEquationSeparate;
+		glad_glBlendEquationSeparate = glad_trace_glBlendEquationSeparate;
+	}
+	if (glad_glDrawBuffers != NULL && glad_glDrawBuffers != glad_trace_glDrawBuffers) {
+		glad_trace_next_glDrawBuffers = glad_glDrawBuffers;
+		glad_glDrawBuffers = glad_trace_glDrawBuffers;
+	}
+	if (glad_glStencilOpSeparate != NULL && glad_glStencilOpSeparate != glad_trace_glStencilOpSeparate) {
+		glad_trace_next_glStencilOpSeparate = glad_glStencilOpSeparate;
+		glad_glStencilOpSeparate = glad_trace_glStencilOpSeparate;
+	}
+	if (glad_glStencilFuncSeparate != NULL && glad_glStencilFuncSeparate != glad_trace_glStencilFuncSeparate) {
+		glad_trace_next_glStencilFuncSeparate = glad_glStencilFuncSeparate;
+		glad_glStencilFuncSeparate = glad_trace_glStencilFuncSeparate;
+	}
+	if (glad_glStencilMaskSeparate != NULL && glad_glStencilMaskSeparate != glad_trace_glStencilMaskSeparate) {
+		glad_trace_next_glStencilMaskSeparate = glad_glStencilMaskSeparate;
+		glad_glStencilMaskSeparate = glad_trace_glStencilMaskSeparate;
+	}
+	if (glad_glAttachShader != NULL && glad_glAttachShader != glad_trace_glAttachShader) {
+		glad_trace_next_glAttachShader = glad_glAttachShader;
+		glad_glAttachShader = glad_trace_glAttachShader;
+	}
+	if (glad_glBindAttribLocation != NULL && glad_glBindAttribLocation != glad_trace_glBindAttribLocation) {
+		glad_trace_next_glBindAttribLocation = glad_glBindAttribLocation;
+		glad_glBindAttribLocation = glad_trace_glBindAttribLocation;
+	}
+	if (glad_glCompileShader != NULL && glad_glCompileShader != glad_trace_glCompileShader) {
+		glad_trace_next_glCompileShader = glad_glCompileShader;
+		glad_glCompileShader = glad_trace_glCompileShader;
+	}
+	if (glad_glCreateProgram != NULL && glad_glCreateProgram != glad_trace_glCreateProgram) {
+		glad_trace_next_glCreateProgram = glad_glCreateProgram;
+		glad_glCreateProgram = glad_trace_glCreateProgram;
+	}
+	if (glad_glCreateShader != NULL && glad_glCreateShader != glad_trace_glCreateShader) {
+		glad_trace_next_glCreateShader = glad_glCreateShader;
+		glad_glCreateShader = glad_trace_glCreateShader;
+	}
+	if (glad_glDeleteProgram != NULL && glad_glDeleteProgram != glad_trace_glDeleteProgram) {
+		glad_trace_next_glDeleteProgram = glad_glDeleteProgram;
+		glad_glDeleteProgram = glad_trace_glDeleteProgram;
+	}
+	if (glad_glDeleteShader != NULL && glad_glDeleteShader != glad_trace_glDeleteShader) {
+		glad_trace_next_glDeleteShader = glad_glDeleteShader;
+		glad_glDeleteShader = glad_trace_glDeleteShader;
+	}
+	if (glad_glDetachShader != NULL && glad_glDetachShader != glad_trace_glDetachShader) {
+		glad_trace_next_glDetachShader = glad_glDetachShader;
+		glad_glDetachShader = glad_trace_glDetachShader;
+	}
+	if (glad_glDisableVertexAttribArray != NULL && glad_glDisableVertexAttribArray != glad_trace_glDisableVertexAttribArray) {
+		glad_trace_next_glDisableVertexAttribArray = glad_glDisableVertexAttribArray;
+		glad_glDisableVertexAttribArray = glad_trace_glDisableVertexAttribArray;
+	}
+	if (glad_glEnableVertexAttribArray != NULL && glad_glEnableVertexAttribArray != glad_trace_glEnableVertexAttribArray) {
+		glad_trace_next_glEnableVertexAttribArray = glad_glEnableVertexAttribArray;
+		glad_glEnableVertexAttribArray = glad_trace_glEnableVertexAttribArray;
+	}
+	if (glad_glLinkProgram != NULL && glad_glLinkProgram != glad_trace_glLinkProgram) {
+		glad_trace_next_glLinkProgram = glad_glLinkProgram;
+		glad_glLinkProgram = glad_trace_glLinkProgram;
+	}
+	if (glad_glShaderSource != NULL && glad_glShaderSource != glad_trace_glShaderSource) {
+		glad_trace_next_glShaderSource = glad_glShaderSource;
+		glad_glShaderSource = glad_trace_glShaderSource;
+	}
+	if (glad_glUseProgram != NULL && glad_glUseProgram != glad_trace_glUseProgram) {
+		glad_trace_next_glUseProgram = glad_glUseProgram;
+		glad_glUseProgram = glad_trace_glUseProgram;
+	}
+	if (glad_glUniform1f != NULL && glad_glUniform1f != glad_trace_glUniform1f) {
+		glad_trace_next_glUniform1f = glad_glUniform1f;
+		glad_glUniform1f = glad_trace_glUniform1f;
+	}
+	if (glad_glUniform2f != NULL && glad_glUniform2f != glad_trace_glUniform2f) {
+		glad_trace_next_glUniform2f = glad_glUniform2f;
+		glad_glUniform2f = glad_trace_glUniform2f;
+	}
+	if (glad_glUniform3f != NULL && glad_glUniform3f != glad_trace_glUniform3f) {
+		glad_trace_next_glUniform3f = glad_glUniform3f;
+		glad_glUniform3f = glad_trace_glUniform3f;
+	}
+	if (glad_glUniform4f != NULL && glad_glUniform4f != glad_trace_glUniform4f) {
+		glad_trace_next_glUniform4f = glad_glUniform4f;
+		glad_glUniform4f = glad_trace_glUniform4f;
+	}
+	if (glad_glUniform1i != NULL && glad_glUniform1i != glad_trace_glUniform1i) {
+		glad_trace_next_glUniform1i = glad_glUniform1i;
+		glad_glUniform1i = glad_trace_glUniform1i;
+	}
+	if (glad_glUniform2i != NULL && glad_glUniform2i != glad_trace_glUniform2i) {
+		glad_trace_next_glUniform2i = glad_glUniform2i;
+		glad_glUniform2i = glad_trace_glUniform2i;
+	}
+	if (glad_glUniform3i != NULL && glad_glUniform3i != glad_trace_glUniform3i) {
+		glad_trace_next_glUniform3i = glad_glUniform3i;
+		glad_glUniform3i = glad_trace_glUniform3i;
+	}
+	if (glad_glUniform4i != NULL && glad_glUniform4i != glad_trace_glUniform4i) {
+		glad_trace_next_glUniform4i = glad_glUniform4i;
+		glad_glUniform4i = glad_trace_glUniform4i;
+	}
+	if (glad_glUniform1fv != NULL && glad_glUniform1fv != glad_trace_glUniform1fv) {
+		glad_trace_next_glUniform1fv = glad_glUniform1fv;
+		glad_glUniform1fv = glad_trace_glUniform1fv;
+	}
+	if (glad_glUniform2fv != NULL && glad_glUniform2fv != glad_trace_glUniform2fv) {
+		glad_trace_next_glUniform2fv = glad_glUniform2fv;
+		glad_glUniform2fv = glad_trace_glUniform2fv;
+	}
+	if (glad_glUniform3fv != NULL && glad_glUniform3fv != glad_trace_glUniform3fv) {
+		glad_trace_next_glUniform3fv = glad_glUniform3fv;
+		glad_glUniform3fv = glad_trace_glUniform3fv;
+	}
+	if (glad_glUniform4fv != NULL && glad_glUniform4fv != glad_trace_glUniform4fv) {
+		glad_trace_next_glUniform4fv = glad_glUniform4fv;
+		glad_glUniform4fv = glad_trace_glUniform4fv;
+	}
+	if (glad_glUniform1iv != NULL && glad_glUniform1iv != glad_trace_glUniform1iv) {
+		glad_trace_next_glUniform1iv = glad_glUniform1iv;
+		glad_glUniform1iv = glad_trace_glUniform1iv;
+	}
+	if (glad_glUniform2iv != NULL && glad_glUniform2iv != glad_trace_glUniform2iv) {
+		glad_trace_next_glUniform2iv = glad_glUniform2iv;
+		glad_glUniform2iv = glad_trace_glUniform2iv;
+	}
+	if (glad_glUniform3iv != NULL && glad_glUniform3iv != glad_trace_glUniform3iv) {
+		glad_trace_next_glUniform3iv = glad_glUniform3iv;
+		glad_glUniform3iv = glad_trace_glUniform3iv;
+	}
+	if (glad_glUniform4iv != NULL && glad_glUniform4iv != glad_trace_glUniform4iv) {
+		glad_trace_next_glUniform4iv = glad_glUniform4iv;
+		glad_glUniform4iv = glad_trace_glUniform4iv;
+	}
+	if (glad_glUniformMatrix2fv != NULL && glad_glUniformMatrix2fv != glad_trace_glUniformMatrix2fv) {
+		glad_trace_next_glUniformMatrix2fv = glad_glUniformMatrix2fv;
+		glad_glUniformMatrix2fv = glad_trace_glUniformMatrix2fv;
+	}
+	if (glad_glUniformMatrix3fv != NULL && glad_glUniformMatrix3fv != glad_trace_glUniformMatrix3fv) {
+		glad_trace_next_glUniformMatrix3fv = glad_glUniformMatrix3fv;
+		glad_glUniformMatrix3fv = glad_trace_glUniformMatrix3fv;
+	}
+	if (glad_glUniformMatrix4fv != NULL && glad_glUniformMatrix4fv != glad_trace_glUniformMatrix4fv) {
+		glad_trace_next_glUniformMatrix4fv = glad_glUniformMatrix4fv;
+		glad_glUniformMatrix4fv = glad_trace_glUniformMatrix4fv;
+	}
+	if (glad_glValidateProgram != NULL && glad_glValidateProgram != glad_trace_glValidateProgram) {
+		glad_trace_next_glValidateProgram = glad_glValidateProgram;
+		glad_glValidateProgram = glad_trace_glValidateProgram;
+	}
+	if (glad_glVertexAttrib1d != NULL && glad_glVertexAttrib1d != glad_trace_glVertexAttrib1d) {
+		glad_trace_next_glVertexAttrib1d = glad_glVertexAttrib1d;
+		glad_glVertexAttrib1d = glad_trace_glVertexAttrib1d;
+	}
+	if (glad_glVertexAttrib1dv != NULL && glad_glVertexAttrib1dv != glad_trace_glVertexAttrib1dv) {
+		glad_trace_next_glVertexAttrib1dv = glad_glVertexAttrib1dv;
+		glad_glVertexAttrib1dv = glad_trace_glVertexAttrib1dv;
+	}
+	if (glad_glVertexAttrib1f != NULL && glad_glVertexAttrib1f != glad_trace_glVertexAttrib1f) {
+		glad_trace_next_glVertexAttrib1f = glad_glVertexAttrib1f;
+		glad_glVertexAttrib1f = glad_trace_glVertexAttrib1f;
+	}
+	if (glad_glVertexAttrib1fv != NULL && glad_glVertexAttrib1fv != glad_trace_glVertexAttrib1fv) {
+		glad_trace_next_glVertexAttrib1fv = glad_glVertexAttrib1fv;
+		glad_glVertexAttrib1fv = glad_trace_glVertexAttrib1fv;
+	}
+	if (glad_glVertexAttrib1s != NULL && glad_glVertexAttrib1s != glad_trace_glVertexAttrib1s) {
+		glad_trace_next_glVertexAttrib1s = glad_glVertexAttrib1s;
+		glad_glVertexAttrib1s = glad_trace_glVertexAttrib1s;
+	}
+	if (glad_glVertexAttrib1sv != NULL && glad_glVertexAttrib1sv != glad_trace_glVertexAttrib1sv) {
+		glad_trace_next_glVertexAttrib1sv = glad_glVertexAttrib1sv;
+		glad_glVertexAttrib1sv = glad_trace_glVertexAttrib1sv;
+	}
+	if (glad_glVertexAttrib2d != NULL && glad_glVertexAttrib2d != glad_trace_glVertexAttrib2d) {
+		glad_trace_next_glVertexAttrib2d = glad_glVertexAttrib2d;
+		glad_glVertexAttrib2d = glad_trace_glVertexAttrib2d;
+	}
+	if (glad_glVertexAttrib2dv != NULL && glad_glVertexAttrib2dv != glad_trace_glVertexAttrib2dv) {
+		glad_trace_next_glVertexAttrib2dv = glad_glVertexAttrib2dv;
+		glad_glVertexAttrib2dv = glad_trace_glVertexAttrib2dv;
+	}
+	if (glad_glVertexAttrib2f != NULL && glad_glVertexAttrib2f != glad_trace_glVertexAttrib2f) {
+		glad_trace_next_glVertexAttrib2f = glad_glVertexAttrib2f;
+		glad_glVertexAttrib2f = glad_trace_glVertexAttrib2f;
+	}
+	if (glad_glVertexAttrib2fv != NULL && glad_glVertexAttrib2fv != glad_trace_glVertexAttrib2fv) {
+		glad_trace_next_glVertexAttrib2fv = glad_glVertexAttrib2fv;
+		glad_glVertexAttrib2fv = glad_trace_glVertexAttrib2fv;
+	}
+	if (glad_glVertexAttrib2s != NULL && glad_glVertexAttrib2s != glad_trace_glVertexAttrib2s) {
+		glad_trace_next_glVertexAttrib2s = glad_glVertexAttrib2s;
+		glad_glVertexAttrib2s = glad_trace_glVertexAttrib2s;
+	}
+	if (glad_glVertexAttrib2sv != NULL && glad_glVertexAttrib2sv != glad_trace_glVertexAttrib2sv) {
+		glad_trace_next_glVertexAttrib2sv = glad_glVertexAttrib2sv;
+		glad_glVertexAttrib2sv = glad_trace_glVertexAttrib2sv;
+	}
+	if (glad_glVertexAttrib3d != NULL && glad_glVertexAttrib3d != glad_trace_glVertexAttrib3d) {
+		glad_trace_next_glVertexAttrib3d = glad_glVertexAttrib3d;
+		glad_glVertexAttrib3d = glad_trace_glVertexAttrib3d;
+	}
+	if (glad_glVertexAttrib3dv != NULL && glad_glVertexAttrib3dv != glad_trace_glVertexAttrib3dv) {
+		glad_trace_next_glVertexAttrib3dv = glad_glVertexAttrib3dv;
+		glad_glVertexAttrib3dv = glad_trace_glVertexAttrib3dv;
+	}
+	if (glad_glVertexAttrib3f != NULL && glad_glVertexAttrib3f != glad_trace_glVertexAttrib3f) {
+		glad_trace_next_glVertexAttrib3f = glad_glVertexAttrib3f;
+		glad_glVertexAttrib3f = glad_trace_glVertexAttrib3f;
+	}
+	if (glad_glVertexAttrib3fv != NULL && glad_glVertexAttrib3fv != glad_trace_glVertexAttrib3fv) {
+		glad_trace_next_glVertexAttrib3fv = glad_glVertexAttrib3fv;
+		glad_glVertexAttrib3fv = glad_trace_glVertexAttrib3fv;
+	}
+	if (glad_glVertexAttrib3s != NULL && glad_glVertexAttrib3s != glad_trace_glVertexAttrib3s) {
+		glad_trace_next_glVertexAttrib3s = glad_glVertexAttrib3s;
+		glad_glVertexAttrib3s = glad_trace_glVertexAttrib3s;
+	}
+	if (glad_glVertexAttrib3sv != NULL && glad_glVertexAttrib3sv != glad_trace_glVertexAttrib3sv) {
+		glad_trace_next_glVertexAttrib3sv = glad_glVertexAttrib3sv;
+		glad_glVertexAttrib3sv = glad_trace_glVertexAttrib3sv;
+	}
+	if (glad_glVertexAttrib4Nbv != NULL && glad_glVertexAttrib4Nbv != glad_trace_glVertexAttrib4Nbv) {
+		glad_trace_next_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+		glad_glVertexAttrib4Nbv = glad_trace_glVertexAttrib4Nbv;
+	}
+	if (glad_glVertexAttrib4Niv != NULL && glad_glVertexAttrib4Niv != glad_trace_glVertexAttrib4Niv) {
+		glad_trace_next_glVertexAttrib4Niv = glad_glVertexAttrib4Niv;
+		glad_glVertexAttrib4Niv = glad_trace_glVertexAttrib4Niv;
+	}
+	if (glad_glVertexAttrib4Nsv != NULL && glad_glVertexAttrib4Nsv != glad_trace_glVertexAttrib4Nsv) {
+		glad_trace_next_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+		glad_glVertexAttrib4Nsv = glad_trace_glVertexAttrib4Nsv;
+	}
+	if (glad_glVertexAttrib4Nub != NULL && glad_glVertexAttrib4Nub != glad_trace_glVertexAttrib4Nub) {
+		glad_trace_next_glVertexAttrib4Nub = glad_glVertexAttrib4Nub;
+		glad_glVertexAttrib4Nub = glad_trace_glVertexAttrib4Nub;
+	}
+	if (glad_glVertexAttrib4Nubv != NULL && glad_glVertexAttrib4Nubv != glad_trace_glVertexAttrib4Nubv) {
+		glad_trace_next_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+		glad_glVertexAttrib4Nubv = glad_trace_glVertexAttrib4Nubv;
+	}
+	if (glad_glVertexAttrib4Nuiv != NULL && glad_glVertexAttrib4Nuiv != glad_trace_glVertexAttrib4Nuiv) {
+		glad_trace_next_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+		glad_glVertexAttrib4Nuiv = glad_trace_glVertexAttrib4Nuiv;
+	}
+	if (glad_glVertexAttrib4Nusv != NULL && glad_glVertexAttrib4Nusv != glad_trace_glVertexAttrib4Nusv) {
+		glad_trace_next_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+		glad_glVertexAttrib4Nusv = glad_trace_glVertexAttrib4Nusv;
+	}
+	if (glad_glVertexAttrib4bv != NULL && glad_glVertexAttrib4bv != glad_trace_glVertexAttrib4bv) {
+		glad_trace_next_glVertexAttrib4bv = glad_glVertexAttrib4bv;
+		glad_glVertexAttrib4bv = glad_trace_glVertexAttrib4bv;
+	}
+	if (glad_glVertexAttrib4d != NULL && glad_glVertexAttrib4d != glad_trace_glVertexAttrib4d) {
+		glad_trace_next_glVertexAttrib4d = glad_glVertexAttrib4d;
+		glad_glVertexAttrib4d = glad_trace_glVertexAttrib4d;
+	}
+	if (glad_glVertexAttrib4dv != NULL && glad_glVertexAttrib4dv != glad_trace_glVertexAttrib4dv) {
+		glad_trace_next_glVertexAttrib4dv = glad_glVertexAttrib4dv;
+		glad_glVertexAttrib4dv = glad_trace_glVertexAttrib4dv;
+	}
+	if (glad_glVertexAttrib4f != NULL && glad_glVertexAttrib4f != glad_trace_glVertexAttrib4f) {
+		glad_trace_next_glVertexAttrib4f = glad_glVertexAttrib4f;
+		glad_glVertexAttrib4f = glad_trace_glVertexAttrib4f;
+	}
+	if (glad_glVertexAttrib4fv != NULL && glad_glVertexAttrib4fv != glad_trace_glVertexAttrib4fv) {
+		glad_trace_next_glVertexAttrib4fv = glad_glVertexAttrib4fv;
+		glad_glVertexAttrib4fv = glad_trace_glVertexAttrib4fv;
+	}
+	if (glad_glVertexAttrib4iv != NULL && glad_glVertexAttrib4iv != glad_trace_glVertexAttrib4iv) {
+		glad_trace_next_glVertexAttrib4iv = glad_glVertexAttrib4iv;
+		glad_glVertexAttrib4iv = glad_trace_glVertexAttrib4iv;
+	}
+	if (glad_glVertexAttrib4s != NULL && glad_glVertexAttrib4s != glad_trace_glVertexAttrib4s) {
+		glad_trace_next_glVertexAttrib4s = glad_glVertexAttrib4s;
+		glad_glVertexAttrib4s = glad_trace_glVertexAttrib4s;
+	}
+	if (glad_glVertexAttrib4sv != NULL && glad_glVertexAttrib4sv != glad_trace_glVertexAttrib4sv) {
+		glad_trace_next_glVertexAttrib4sv = glad_glVertexAttrib4sv;
+		glad_glVertexAttrib4sv = glad_trace_glVertexAttrib4sv;
+	}
+	if (glad_glVertexAttrib4ubv != NULL && glad_glVertexAttrib4ubv != glad_trace_glVertexAttrib4ubv) {
+		glad_trace_next_glVertexAttrib4ubv = glad_glVertexAttrib4ubv;
+		glad_glVertexAttrib4ubv = glad_trace_glVertexAttrib4ubv;
+	}
+	if (glad_glVertexAttrib4uiv != NULL && glad_glVertexAttrib4uiv != glad_trace_glVertexAttrib4uiv) {
+		glad_trace_next_glVertexAttrib4uiv = glad_glVertexAttrib4uiv;
+		glad_glVertexAttrib4uiv = glad_trace_glVertexAttrib4uiv;
+	}
+	if (glad_glVertexAttrib4usv != NULL && glad_glVertexAttrib4usv != glad_trace_glVertexAttrib4usv) {
+		glad_trace_next_glVertexAttrib4usv = glad_glVertexAttrib4usv;
+		glad_glVertexAttrib4usv = glad_trace_glVertexAttrib4usv;
+	}
+	if (glad_glVertexAttribPointer != NULL && glad_glVertexAttribPointer != glad_trace_glVertexAttribPointer) {
+		glad_trace_next_glVertexAttribPointer = glad_glVertexAttribPointer;
+		glad_glVertexAttribPointer = glad_trace_glVertexAttribPointer;
+	}
+	if (glad_glUniformMatrix2x3fv != NULL && glad_glUniformMatrix2x3fv != glad_trace_glUniformMatrix2x3fv) {
+		glad_trace_next_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+		glad_glUniformMatrix2x3fv = glad_trace_glUniformMatrix2x3fv;
+	}
+	if (glad_glUniformMatrix3x2fv != NULL && glad_glUniformMatrix3x2fv != glad_trace_glUniformMatrix3x2fv) {
+		glad_trace_next_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+		glad_glUniformMatrix3x2fv = glad_trace_glUniformMatrix3x2fv;
+	}
+	if (glad_glUniformMatrix2x4fv != NULL && glad_glUniformMatrix2x4fv != glad_trace_glUniformMatrix2x4fv) {
+		glad_trace_next_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+		glad_glUniformMatrix2x4fv = glad_trace_glUniformMatrix2x4fv;
+	}
+	if (glad_glUniformMatrix4x2fv != NULL && glad_glUniformMatrix4x2fv != glad_trace_glUniformMatrix4x2fv) {
+		glad_trace_next_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+		glad_glUniformMatrix4x2fv = glad_trace_glUniformMatrix4x2fv;
+	}
+	if (glad_glUniformMatrix3x4fv != NULL && glad_glUniformMatrix3x4fv != glad_trace_glUniformMatrix3x4fv) {
+		glad_trace_next_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+		glad_glUniformMatrix3x4fv = glad_trace_glUniformMatrix3x4fv;
+	}
+	if (glad_glUniformMatrix4x3fv != NULL && glad_glUniformMatrix4x3fv != glad_trace_glUniformMatrix4x3fv) {
+		glad_trace_next_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+		glad_glUniformMatrix4x3fv = glad_trace_glUniformMatrix4x3fv;
+	}
+	if (glad_glColorMaski != NULL && glad_glColorMaski != glad_trace_glColorMaski) {
+		glad_trace_next_glColorMaski = glad_glColorMaski;
+		glad_glColorMaski = glad_trace_glColorMaski;
+	}
+	if (glad_glEnablei != NULL && glad_glEnablei != glad_trace_glEnablei) {
+		glad_trace_next_glEnablei = glad_glEnablei;
+		glad_glEnablei = glad_trace_glEnablei;
+	}
+	if (glad_glDisablei != NULL && glad_glDisablei != glad_trace_glDisablei) {
+		glad_trace_next_glDisablei = glad_glDisablei;
+		glad_glDisablei = glad_trace_glDisablei;
+	}
+	if (glad_glBeginTransformFeedback != NULL && glad_glBeginTransformFeedback != glad_trace_glBeginTransformFeedback) {
+		glad_trace_next_glBeginTransformFeedback = glad_glBeginTransformFeedback;
+		glad_glBeginTransformFeedback = glad_trace_glBeginTransformFeedback;
+	}
+	if (glad_glEndTransformFeedback != NULL && glad_glEndTransformFeedback != glad_trace_glEndTransformFeedback) {
+		glad_trace_next_glEndTransformFeedback = glad_glEndTransformFeedback;
+		glad_glEndTransformFeedback = glad_trace_glEndTransformFeedback;
+	}
+	if (glad_glBindBufferRange != NULL && glad_glBindBufferRange != glad_trace_glBindBufferRange) {
+		glad_trace_next_glBindBufferRange = glad_glBindBufferRange;
+		glad_glBindBufferRange = glad_trace_glBindBufferRange;
+	}
+	if (glad_glBindBufferBase != NULL && glad_glBindBufferBase != glad_trace_glBindBufferBase) {
+		glad_trace_next_glBindBufferBase = glad_glBindBufferBase;
+		glad_glBindBufferBase = glad_trace_glBindBufferBase;
+	}
+	if (glad_glTransformFeedbackVaryings != NULL && glad_glTransformFeedbackVaryings != glad_trace_glTransformFeedbackVaryings) {
+		glad_trace_next_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+		glad_glTransformFeedbackVaryings = glad_trace_glTransformFeedbackVaryings;
+	}
+	if (glad_glClampColor != NULL && glad_glClampColor != glad_trace_glClampColor) {
+		glad_trace_next_glClampColor = glad_glClampColor;
+		glad_glClampColor = glad_trace_glClampColor;
+	}
+	if (glad_glBeginConditionalRender != NULL && glad_glBeginConditionalRender != glad_trace_glBeginConditionalRender) {
+		glad_trace_next_glBeginConditionalRender = glad_glBeginConditionalRender;
+		glad_glBeginConditionalRender = glad_trace_glBeginConditionalRender;
+	}
+	if (glad_glEndConditionalRender != NULL && glad_glEndConditionalRender != glad_trace_glEndConditionalRender) {
+		glad_trace_next_glEndConditionalRender = glad_glEndConditionalRender;
+		glad_glEndConditionalRender = glad_trace_glEndConditionalRender;
+	}
+	if (glad_glVertexAttribIPointer != NULL && glad_glVertexAttribIPointer != glad_trace_glVertexAttribIPointer) {
+		glad_trace_next_glVertexAttribIPointer = glad_glVertexAttribIPointer;
+		glad_glVertexAttribIPointer = glad_trace_glVertexAttribIPointer;
+	}
+	if (glad_glVertexAttribI1i != NULL && glad_glVertexAttribI1i != glad_trace_glVertexAttribI1i) {
+		glad_trace_next_glVertexAttribI1i = glad_glVertexAttribI1i;
+		glad_glVertexAttribI1i = glad_trace_glVertexAttribI1i;
+	}
+	if (glad_glVertexAttribI2i != NULL && glad_glVertexAttribI2i != glad_trace_glVertexAttribI2i) {
+		glad_trace_next_glVertexAttribI2i = glad_glVertexAttribI2i;
+		glad_glVertexAttribI2i = glad_trace_glVertexAttribI2i;
+	}
+	if (glad_glVertexAttribI3i != NULL && glad_glVertexAttribI3i != glad_trace_glVertexAttribI3i) {
+		glad_trace_next_glVertexAttribI3i = glad_glVertexAttribI3i;
+		glad_glVertexAttribI3i = glad_trace_glVertexAttribI3i;
+	}
+	if (glad_glVertexAttribI4i != NULL && glad_glVertexAttribI4i != glad_trace_glVertexAttribI4i) {
+		glad_trace_next_glVertexAttribI4i = glad_glVertexAttribI4i;
+		glad_glVertexAttribI4i = glad_trace_glVertexAttribI4i;
+	}
+	if (glad_glVertexAttribI1ui != NULL && glad_glVertexAttribI1ui != glad_trace_glVertexAttribI1ui) {
+		glad_trace_next_glVertexAttribI1ui = glad_glVertexAttribI1ui;
+		glad_glVertexAttribI1ui = glad_trace_glVertexAttribI1ui;
+	}
+	if (glad_glVertexAttribI2ui != NULL && glad_glVertexAttribI2ui != glad_trace_glVertexAttribI2ui) {
+		glad_trace_next_glVertexAttribI2ui = glad_glVertexAttribI2ui;
+		glad_glVertexAttribI2ui = glad_trace_glVertexAttribI2ui;
+	}
+	if (glad_glVertexAttribI3ui != NULL && glad_glVertexAttribI3ui != glad_trace_glVertexAttribI3ui) {
+		glad_trace_next_glVertexAttribI3ui = glad_glVertexAttribI3ui;
+		glad_glVertexAttribI3ui = glad_trace_glVertexAttribI3ui;
+	}
+	if (glad_glVertexAttribI4ui != NULL && glad_glVertexAttribI4ui != glad_trace_glVertexAttribI4ui) {
+		glad_trace_next_glVertexAttribI4ui = glad_glVertexAttribI4ui;
+		glad_glVertexAttribI4ui = glad_trace_glVertexAttribI4ui;
+	}
+	if (glad_glVertexAttribI1iv != NULL && glad_glVertexAttribI1iv != glad_trace_glVertexAttribI1iv) {
+		glad_trace_next_glVertexAttribI1iv = glad_glVertexAttribI1iv;
+		glad_glVertexAttribI1iv = glad_trace_glVertexAttribI1iv;
+	}
+	if (glad_glVertexAttribI2iv != NULL && glad_glVertexAttribI2iv != glad_trace_glVertexAttribI2iv) {
+		glad_trace_next_glVertexAttribI2iv = glad_glVertexAttribI2iv;
+		glad_glVertexAttribI2iv = glad_trace_glVertexAttribI2iv;
+	}
+	if (glad_glVertexAttribI3iv != NULL && glad_glVertexAttribI3iv != glad_trace_glVertexAttribI3iv) {
+		glad_trace_next_glVertexAttribI3iv = glad_glVertexAttribI3iv;
+		glad_glVertexAttribI3iv = glad_trace_glVertexAttribI3iv;
+	}
+	if (glad_glVertexAttribI4iv != NULL && glad_glVertexAttribI4iv != glad_trace_glVertexAttribI4iv) {
+		glad_trace_next_glVertexAttribI4iv = glad_glVertexAttribI4iv;
+		glad_glVertexAttribI4iv = glad_trace_glVertexAttribI4iv;
+	}
+	if (glad_glVertexAttribI1uiv != NULL && glad_glVertexAttribI1uiv != glad_trace_glVertexAttribI1uiv) {
+		glad_trace_next_glVertexAttribI1uiv = glad_glVertexAttribI1uiv;
+		glad_glVertexAttribI1uiv = glad_trace_glVertexAttribI1uiv;
+	}
+	if (glad_glVertexAttribI2uiv != NULL && glad_glVertexAttribI2uiv != glad_trace_glVertexAttribI2uiv) {
+		glad_trace_next_glVertexAttribI2uiv = glad_glVertexAttribI2uiv;
+		glad_glVertexAttribI2uiv = glad_trace_glVertexAttribI2uiv;
+	}
+	if (glad_glVertexAttribI3uiv != NULL && glad_glVertexAttribI3uiv != glad_trace_glVertexAttribI3uiv) {
+		glad_trace_next_glVertexAttribI3uiv = glad_glVertexAttribI3uiv;
+		glad_glVertexAttribI3uiv = glad_trace_glVertexAttribI3uiv;
+	}
+	if (glad_glVertexAttribI4uiv != NULL && glad_glVertexAttribI4uiv != glad_trace_glVertexAttribI4uiv) {
+		glad_trace_next_glVertexAttribI4uiv = glad_glVertexAttribI4uiv;
+		glad_glVertexAttribI4uiv = glad_trace_glVertexAttribI4uiv;
+	}
+	if (glad_glVertexAttribI4bv != NULL && glad_glVertexAttribI4bv != glad_trace_glVertexAttribI4bv) {
+		glad_trace_next_glVertexAttribI4bv = glad_glVertexAttribI4bv;
+		glad_glVertexAttribI4bv = glad_trace_glVertexAttribI4bv;
+	}
+	if (glad_glVertexAttribI4sv != NULL && glad_glVertexAttribI4sv != glad_trace_glVertexAttribI4sv) {
+		glad_trace_next_glVertexAttribI4sv = glad_glVertexAttribI4sv;
+		glad_glVertexAttribI4sv = glad_trace_glVertexAttribI4sv;
+	}
+	if (glad_glVertexAttribI4ubv != NULL && glad_glVertexAttribI4ubv != glad_trace_glVertexAttribI4ubv) {
+		glad_trace_next_glVertexAttribI4ubv = glad_glVertexAttribI4ubv;
+		glad_glVertexAttribI4ubv = glad_trace_glVertexAttribI4ubv;
+	}
+	if (glad_glVertexAttribI4usv != NULL && glad_glVertexAttribI4usv != glad_trace_glVertexAttribI4usv) {
+		glad_trace_next_glVertexAttribI4usv = glad_glVertexAttribI4usv;
+		glad_glVertexAttribI4usv = glad_trace_glVertexAttribI4usv;
+	}
+	if (glad_glBindFragDataLocation != NULL && glad_glBindFragDataLocation != glad_trace_glBindFragDataLocation) {
+		glad_trace_next_glBindFragDataLocation = glad_glBindFragDataLocation;
+		glad_glBindFragDataLocation = glad_trace_glBindFragDataLocation;
+	}
+	if (glad_glUniform1ui != NULL && glad_glUniform1ui != glad_trace_glUniform1ui) {
+		glad_trace_next_glUniform1ui = glad_glUniform1ui;
+		glad_glUniform1ui = glad_trace_glUniform1ui;
+	}
+	if (glad_glUniform2ui != NULL && glad_glUniform2ui != glad_trace_glUniform2ui) {
+		glad_trace_next_glUniform2ui = glad_glUniform2ui;
+		glad_glUniform2ui = glad_trace_glUniform2ui;
+	}
+	if (glad_glUniform3ui != NULL && glad_glUniform3ui != glad_trace_glUniform3ui) {
+		glad_trace_next_glUniform3ui = glad_glUniform3ui;
+		glad_glUniform3ui = glad_trace_glUniform3ui;
+	}
+	if (glad_glUniform4ui != NULL && glad_glUniform4ui != glad_trace_glUniform4ui) {
+		glad_trace_next_glUniform4ui = glad_glUniform4ui;
+		glad_glUniform4ui = glad_trace_glUniform4ui;
+	}
+	if (glad_glUniform1uiv != NULL && glad_glUniform1uiv != glad_trace_glUniform1uiv) {
+		glad_trace_next_glUniform1uiv = glad_glUniform1uiv;
+		glad_glUniform1uiv = glad_trace_glUniform1uiv;
+	}
+	if (glad_glUniform2uiv != NULL && glad_glUniform2uiv != glad_trace_glUniform2uiv) {
+		glad_trace_next_glUniform2uiv = glad_glUniform2uiv;
+		glad_glUniform2uiv = glad_trace_glUniform2uiv;
+	}
+	if (glad_glUniform3uiv != NULL && glad_glUniform3uiv != glad_trace_glUniform3uiv) {
+		glad_trace_next_glUniform3uiv = glad_glUniform3uiv;
+		glad_glUniform3uiv = glad_trace_glUniform3uiv;
+	}
+	if (glad_glUniform4uiv != NULL && glad_glUniform4uiv != glad_trace_glUniform4uiv) {
+		glad_trace_next_glUniform4uiv = glad_glUniform4uiv;
+		glad_glUniform4uiv = glad_trace_glUniform4uiv;
+	}
+	if (glad_glTexParameterIiv != NULL && glad_glTexParameterIiv != glad_trace_glTexParameterIiv) {
+		glad_trace_next_glTexParameterIiv = glad_glTexParameterIiv;
+		glad_glTexParameterIiv = glad_trace_glTexParameterIiv;
+	}
+	if (glad_glTexParameterIuiv != NULL && glad_glTexParameterIuiv != glad_trace_glTexParameterIuiv) {
+		glad_trace_next_glTexParameterIuiv = glad_glTexParameterIuiv;
+		glad_glTexParameterIuiv = glad_trace_glTexParameterIuiv;
+	}
+	if (glad_glClearBufferiv != NULL && glad_glClearBufferiv != glad_trace_glClearBufferiv) {
+		glad_trace_next_glClearBufferiv = glad_glClearBufferiv;
+		glad_glClearBufferiv = glad_trace_glClearBufferiv;
+	}
+	if (glad_glClearBufferuiv != NULL && glad_glClearBufferuiv != glad_trace_glClearBufferuiv) {
+		glad_trace_next_glClearBufferuiv = glad_glClearBufferuiv;
+		glad_glClearBufferuiv = glad_trace_glClearBufferuiv;
+	}
+	if (glad_glClearBufferfv != NULL && glad_glClearBufferfv != glad_trace_glClearBufferfv) {
+		glad_trace_next_glClearBufferfv = glad_glClearBufferfv;
+		glad_glClearBufferfv = glad_trace_glClearBufferfv;
+	}
+	if (glad_glClearBufferfi != NULL && glad_glClearBufferfi != glad_trace_glClearBufferfi) {
+		glad_trace_next_glClearBufferfi = glad_glClearBufferfi;
+		glad_glClearBufferfi = glad_trace_glClearBufferfi;
+	}
+	if (glad_glBindRenderbuffer != NULL && glad_glBindRenderbuffer != glad_trace_glBindRenderbuffer) {
+		glad_trace_next_glBindRenderbuffer = glad_glBindRenderbuffer;
+		glad_glBindRenderbuffer = glad_trace_glBindRenderbuffer;
+	}
+	if (glad_glDeleteRenderbuffers != NULL && glad_glDeleteRenderbuffers != glad_trace_glDeleteRenderbuffers) {
+		glad_trace_next_glDeleteRenderbuffers = glad_glDeleteRenderbuffers;
+		glad_glDeleteRenderbuffers = glad_trace_glDeleteRenderbuffers;
+	}
+	if (glad_glGenRenderbuffers != NULL && glad_glGenRenderbuffers != glad_trace_glGenRenderbuffers) {
+		glad_trace_next_glGenRenderbuffers = glad_glGenRenderbuffers;
+		glad_glGenRenderbuffers = glad_trace_glGenRenderbuffers;
+	}
+	if (glad_glRenderbufferStorage != NULL && glad_glRenderbufferStorage != glad_trace_glRenderbufferStorage) {
+		glad_trace_next_glRenderbufferStorage = glad_glRenderbufferStorage;
+		glad_glRenderbufferStorage = glad_trace_glRenderbufferStorage;
+	}
+	if (glad_glBindFramebuffer != NULL && glad_glBindFramebuffer != glad_trace_glBindFramebuffer) {
+		glad_trace_next_glBindFramebuffer = glad_glBindFramebuffer;
+		glad_glBindFramebuffer = glad_trace_glBindFramebuffer;
+	}
+	if (glad_glDeleteFramebuffers != NULL && glad_glDeleteFramebuffers != glad_trace_glDeleteFramebuffers) {
+		glad_trace_next_glDeleteFramebuffers = glad_glDeleteFramebuffers;
+		glad_glDeleteFramebuffers = glad_trace_glDeleteFramebuffers;
+	}
+	if (glad_glGenFramebuffers != NULL && glad_glGenFramebuffers != glad_trace_glGenFramebuffers) {
+		glad_trace_next_glGenFramebuffers = glad_glGenFramebuffers;
+		glad_glGenFramebuffers = glad_trace_glGenFramebuffers;
+	}
+	if (glad_glFramebufferTexture1D != NULL && glad_glFramebufferTexture1D != glad_trace_glFramebufferTexture1D) {
+		glad_trace_next_glFramebufferTexture1D = glad_glFramebufferTexture1D;
+		glad_glFramebufferTexture1D = glad_trace_glFramebufferTexture1D;
+	}
+	if (glad_glFramebufferTexture2D != NULL && glad_glFramebufferTexture2D != glad_trace_glFramebufferTexture2D) {
+		glad_trace_next_glFramebufferTexture2D = glad_glFramebufferTexture2D;
+		glad_glFramebufferTexture2D = glad_trace_glFramebufferTexture2D;
+	}
+	if (glad_glFramebufferTexture3D != NULL && glad_glFramebufferTexture3D != glad_trace_glFramebufferTexture3D) {
+		glad_trace_next_glFramebufferTexture3D = glad_glFramebufferTexture3D;
+		glad_glFramebufferTexture3D = glad_trace_glFramebufferTexture3D;
+	}
+	if (glad_glFramebufferRenderbuffer != NULL && glad_glFramebufferRenderbuffer != glad_trace_glFramebufferRenderbuffer) {
+		glad_trace_next_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+		glad_glFramebufferRenderbuffer = glad_trace_glFramebufferRenderbuffer;
+	}
+	if (glad_glGenerateMipmap != NULL && glad_glGenerateMipmap != glad_trace_glGenerateMipmap) {
+		glad_trace_next_glGenerateMipmap = glad_glGenerateMipmap;
+		glad_glGenerateMipmap = glad_trace_glGenerateMipmap;
+	}
+	if (glad_glBlitFramebuffer != NULL && glad_glBlitFramebuffer != glad_trace_glBlitFramebuffer) {
+		glad_trace_next_glBlitFramebuffer = glad_glBlitFramebuffer;
+		glad_glBlitFramebuffer = glad_trace_glBlitFramebuffer;
+	}
+	if (glad_glRenderbufferStorageMultisample != NULL && glad_glRenderbufferStorageMultisample != glad_trace_glRenderbufferStorageMultisample) {
+		glad_trace_next_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+		glad_glRenderbufferStorageMultisample = glad_trace_glRenderbufferStorageMultisample;
+	}
+	if (glad_glFramebufferTextureLayer != NULL && glad_glFramebufferTextureLayer != glad_trace_glFramebufferTextureLayer) {
+		glad_trace_next_glFramebufferTextureLayer = glad_glFramebufferTextureLayer;
+		glad_glFramebufferTextureLayer = glad_trace_glFramebufferTextureLayer;
+	}
+	if (glad_glMapBufferRange != NULL && glad_glMapBufferRange != glad_trace_glMapBufferRange) {
+		glad_trace_next_glMapBufferRange = glad_glMapBufferRange;
+		glad_glMapBufferRange = glad_trace_glMapBufferRange;
+	}
+	if (glad_glFlushMappedBufferRange != NULL && glad_glFlushMappedBufferRange != glad_trace_glFlushMappedBufferRange) {
+		glad_trace_next_glFlushMappedBufferRange = glad_glFlushMappedBufferRange;
+		glad_glFlushMappedBufferRange = glad_trace_glFlushMappedBufferRange;
+	}
+	if (glad_glBindVertexArray != NULL && glad_glBindVertexArray != glad_trace_glBindVertexArray) {
+		glad_trace_next_glBindVertexArray = glad_glBindVertexArray;
+		glad_glBindVertexArray = glad_trace_glBindVertexArray;
+	}
+	if (glad_glDeleteVertexArrays != NULL && glad_glDeleteVertexArrays != glad_trace_glDeleteVertexArrays) {
+		glad_trace_next_glDeleteVertexArrays = glad_glDeleteVertexArrays;
+		glad_glDeleteVertexArrays = glad_trace_glDeleteVertexArrays;
+	}
+	if (glad_glGenVertexArrays != NULL && glad_glGenVertexArrays != glad_trace_glGenVertexArrays) {
+		glad_trace_next_glGenVertexArrays = glad_glGenVertexArrays;
+		glad_glGenVertexArrays = glad_trace_glGenVertexArrays;
+	}
+	if (glad_glDrawArraysInstanced != NULL && glad_glDrawArraysInstanced != glad_trace_glDrawArraysInstanced) {
+		glad_trace_next_glDrawArraysInstanced = glad_glDrawArraysInstanced;
+		glad_glDrawArraysInstanced = glad_trace_glDrawArraysInstanced;
+	}
+	if (glad_glDrawElementsInstanced != NULL && glad_glDrawElementsInstanced != glad_trace_glDrawElementsInstanced) {
+		glad_trace_next_glDrawElementsInstanced = glad_glDrawElementsInstanced;
+		glad_glDrawElementsInstanced = glad_trace_glDrawElementsInstanced;
+	}
+	if (glad_glTexBuffer != NULL && glad_glTexBuffer != glad_trace_glTexBuffer) {
+		glad_trace_next_glTexBuffer = glad_glTexBuffer;
+		glad_glTexBuffer = glad_trace_glTexBuffer;
+	}
+	if (glad_glPrimitiveRestartIndex != NULL && glad_glPrimitiveRestartIndex != glad_trace_glPrimitiveRestartIndex) {
+		glad_trace_next_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+		glad_glPrimitiveRestartIndex = glad_trace_glPrimitiveRestartIndex;
+	}
+	if (glad_glCopyBufferSubData != NULL && glad_glCopyBufferSubData != glad_trace_glCopyBufferSubData) {
+		glad_trace_next_glCopyBufferSubData = glad_glCopyBufferSubData;
+		glad_glCopyBufferSubData = glad_trace_glCopyBufferSubData;
+	}
+	if (glad_glUniformBlockBinding != NULL && glad_glUniformBlockBinding != glad_trace_glUniformBlockBinding) {
+		glad_trace_next_glUniformBlockBinding = glad_glUniformBlockBinding;
+		glad_glUniformBlockBinding = glad_trace_glUniformBlockBinding;
+	}
+	if (glad_glDrawElementsBaseVertex != NULL && glad_glDrawElementsBaseVertex != glad_trace_glDrawElementsBaseVertex) {
+		glad_trace_next_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+		glad_glDrawElementsBaseVertex = glad_trace_glDrawElementsBaseVertex;
+	}
+	if (glad_glDrawRangeElementsBaseVertex != NULL && glad_glDrawRangeElementsBaseVertex != glad_trace_glDrawRangeElementsBaseVertex) {
+		glad_trace_next_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+		glad_glDrawRangeElementsBaseVertex = glad_trace_glDrawRangeElementsBaseVertex;
+	}
+	if (glad_glDrawElementsInstancedBaseVertex != NULL && glad_glDrawElementsInstancedBaseVertex != glad_trace_glDrawElementsInstancedBaseVertex) {
+		glad_trace_next_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+		glad_glDrawElementsInstancedBaseVertex = glad_trace_glDrawElementsInstancedBaseVertex;
+	}
+	if (glad_glMultiDrawElementsBaseVertex != NULL && glad_glMultiDrawElementsBaseVertex != glad_trace_glMultiDrawElementsBaseVertex) {
+		glad_trace_next_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+		glad_glMultiDrawElementsBaseVertex = glad_trace_glMultiDrawElementsBaseVertex;
+	}
+	if (glad_glProvokingVertex != NULL && glad_glProvokingVertex != glad_trace_glProvokingVertex) {
+		glad_trace_next_glProvokingVertex = glad_glProvokingVertex;
+		glad_glProvokingVertex = glad_trace_glProvokingVertex;
+	}
+	if (glad_glFenceSync != NULL && glad_glFenceSync != glad_trace_glFenceSync) {
+		glad_trace_next_glFenceSync = glad_glFenceSync;
+		glad_glFenceSync = glad_trace_glFenceSync;
+	}
+	if (glad_glDeleteSync != NULL && glad_glDeleteSync != glad_trace_glDeleteSync) {
+		glad_trace_next_glDeleteSync = glad_glDeleteSync;
+		glad_glDeleteSync = glad_trace_glDeleteSync;
+	}
+	if (glad_glClientWaitSync != NULL && glad_glClientWaitSync != glad_trace_glClientWaitSync) {
+		glad_trace_next_glClientWaitSync = glad_glClientWaitSync;
+		glad_glClientWaitSync = glad_trace_glClientWaitSync;
+	}
+	if (glad_glWaitSync != NULL && glad_glWaitSync != glad_trace_glWaitSync) {
+		glad_trace_next_glWaitSync = glad_glWaitSync;
+		glad_glWaitSync = glad_trace_glWaitSync;
+	}
+	if (glad_glFramebufferTexture != NULL && glad_glFramebufferTexture != glad_trace_glFramebufferTexture) {
+		glad_trace_next_glFramebufferTexture = glad_glFramebufferTexture;
+		glad_glFramebufferTexture = glad_trace_glFramebufferTexture;
+	}
+	if (glad_glTexImage2DMultisample != NULL && glad_glTexImage2DMultisample != glad_trace_glTexImage2DMultisample) {
+		glad_trace_next_glTexImage2DMultisample = glad_glTexImage2DMultisample;
+		glad_glTexImage2DMultisample = glad_trace_glTexImage2DMultisample;
+	}
+	if (glad_glTexImage3DMultisample != NULL && glad_glTexImage3DMultisample != glad_trace_glTexImage3DMultisample) {
+		glad_trace_next_glTexImage3DMultisample = glad_glTexImage3DMultisample;
+		glad_glTexImage3DMultisample = glad_trace_glTexImage3DMultisample;
+	}
+	if (glad_glSampleMaski != NULL && glad_glSampleMaski != glad_trace_glSampleMaski) {
+		glad_trace_next_glSampleMaski = glad_glSampleMaski;
+		glad_glSampleMaski = glad_trace_glSampleMaski;
+	}
+	if (glad_glBindFragDataLocationIndexed != NULL && glad_glBindFragDataLocationIndexed != glad_trace_glBindFragDataLocationIndexed) {
+		glad_trace_next_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+		glad_glBindFragDataLocationIndexed = glad_trace_glBindFragDataLocationIndexed;
+	}
+	if (glad_glGenSamplers != NULL && glad_glGenSamplers != glad_trace_glGenSamplers) {
+		glad_trace_next_glGenSamplers = glad_glGenSamplers;
+		glad_glGenSamplers = glad_trace_glGenSamplers;
+	}
+	if (glad_glDeleteSamplers != NULL && glad_glDeleteSamplers != glad_trace_glDeleteSamplers) {
+		glad_trace_next_glDeleteSamplers = glad_glDeleteSamplers;
+		glad_glDeleteSamplers = glad_trace_glDeleteSamplers;
+	}
+	if (glad_glBindSampler != NULL && glad_glBindSampler != glad_trace_glBindSampler) {
+		glad_trace_next_glBindSampler = glad_glBindSampler;
+		glad_glBindSampler = glad_trace_glBindSampler;
+	}
+	if (glad_glSamplerParameteri != NULL && glad_glSamplerParameteri != glad_trace_glSamplerParameteri) {
+		glad_trace_next_glSamplerParameteri = glad_glSamplerParameteri;
+		glad_glSamplerParameteri = glad_trace_glSamplerParameteri;
+	}
+	if (glad_glSamplerParameteriv != NULL && glad_glSamplerParameteriv != glad_trace_glSamplerParameteriv) {
+		glad_trace_next_glSamplerParameteriv = glad_glSamplerParameteriv;
+		glad_glSamplerParameteriv = glad_trace_glSamplerParameteriv;
+	}
+	if (glad_glSamplerParameterf != NULL && glad_glSamplerParameterf != glad_trace_glSamplerParameterf) {
+		glad_trace_next_glSamplerParameterf = glad_glSamplerParameterf;
+		glad_glSamplerParameterf = glad_trace_glSamplerParameterf;
+	}
+	if (glad_glSamplerParameterfv != NULL && glad_glSamplerParameterfv != glad_trace_glSamplerParameterfv) {
+		glad_trace_next_glSamplerParameterfv = glad_glSamplerParameterfv;
+		glad_glSamplerParameterfv = glad_trace_glSamplerParameterfv;
+	}
+	if (glad_glSamplerParameterIiv != NULL && glad_glSamplerParameterIiv != glad_trace_glSamplerParameterIiv) {
+		glad_trace_next_glSamplerParameterIiv = glad_glSamplerParameterIiv;
+		glad_glSamplerParameterIiv = glad_trace_glSamplerParameterIiv;
+	}
+	if (glad_glSamplerParameterIuiv != NULL && glad_glSamplerParameterIuiv != glad_trace_glSamplerParameterIuiv) {
+		glad_trace_next_glSamplerParameterIuiv = glad_glSamplerParameterIuiv;
+		glad_glSamplerParameterIuiv = glad_trace_glSamplerParameterIuiv;
+	}
+	if (glad_glQueryCounter != NULL && glad_glQueryCounter != glad_trace_glQueryCounter) {
+		glad_trace_next_glQueryCounter = glad_glQueryCounter;
+		glad_glQueryCounter = glad_trace_glQueryCounter;
+	}
+	if (glad_glVertexAttribDivisor != NULL && glad_glVertexAttribDivisor != glad_trace_glVertexAttribDivisor) {
+		glad_trace_next_glVertexAttribDivisor = glad_glVertexAttribDivisor;
+		glad_glVertexAttribDivisor = glad_trace_glVertexAttribDivisor;
+	}
+	if (glad_glVertexAttribP1ui != NULL && glad_glVertexAttribP1ui != glad_trace_glVertexAttribP1ui) {
+		glad_trace_next_glVertexAttribP1ui = glad_glVertexAttribP1ui;
+		glad_glVertexAttribP1ui = glad_trace_glVertexAttribP1ui;
+	}
+	if (glad_glVertexAttribP1uiv != NULL && glad_glVertexAttribP1uiv != glad_trace_glVertexAttribP1uiv) {
+		glad_trace_next_glVertexAttribP1uiv = glad_glVertexAttribP1uiv;
+		glad_glVertexAttribP1uiv = glad_trace_glVertexAttribP1uiv;
+	}
+	if (glad_glVertexAttribP2ui != NULL && glad_glVertexAttribP2ui != glad_trace_glVertexAttribP2ui) {
+		glad_trace_next_glVertexAttribP2ui = glad_glVertexAttribP2ui;
+		glad_glVertexAttribP2ui = glad_trace_glVertexAttribP2ui;
+	}
+	if (glad_glVertexAttribP2uiv != NULL && glad_glVertexAttribP2uiv != glad_trace_glVertexAttribP2uiv) {
+		glad_trace_next_glVertexAttribP2uiv = glad_glVertexAttribP2uiv;
+		glad_glVertexAttribP2uiv = glad_trace_glVertexAttribP2uiv;
+	}
+	if (glad_glVertexAttribP3ui != NULL && glad_glVertexAttribP3ui != glad_trace_glVertexAttribP3ui) {
+		glad_trace_next_glVertexAttribP3ui = glad_glVertexAttribP3ui;
+		glad_glVertexAttribP3ui = glad_trace_glVertexAttribP3ui;
+	}
+	if (glad_glVertexAttribP3uiv != NULL && glad_glVertexAttribP3uiv != glad_trace_glVertexAttribP3uiv) {
+		glad_trace_next_glVertexAttribP3uiv = glad_glVertexAttribP3uiv;
+		glad_glVertexAttribP3uiv = glad_trace_glVertexAttribP3uiv;
+	}
+	if (glad_glVertexAttribP4ui != NULL && glad_glVertexAttribP4ui != glad_trace_glVertexAttribP4ui) {
+		glad_trace_next_glVertexAttribP4ui = glad_glVertexAttribP4ui;
+		glad_glVertexAttribP4ui = glad_trace_glVertexAttribP4ui;
+	}
+	if (glad_glVertexAttribP4uiv != NULL && glad_glVertexAttribP4uiv != glad_trace_glVertexAttribP4uiv) {
+		glad_trace_next_glVertexAttribP4uiv = glad_glVertexAttribP4uiv;
+		glad_glVertexAttribP4uiv = glad_trace_glVertexAttribP4uiv;
+	}
+	if (glad_glVertexP2ui != NULL && glad_glVertexP2ui != glad_trace_glVertexP2ui) {
+		glad_trace_next_glVertexP2ui = glad_glVertexP2ui;
+		glad_glVertexP2ui = glad_trace_glVertexP2ui;
+	}
+	if (glad_glVertexP2uiv != NULL && glad_glVertexP2uiv != glad_trace_glVertexP2uiv) {
+		glad_trace_next_glVertexP2uiv = glad_glVertexP2uiv;
+		glad_glVertexP2uiv = glad_trace_glVertexP2uiv;
+	}
+	if (glad_glVertexP3ui != NULL && glad_glVertexP3ui != glad_trace_glVertexP3ui) {
+		glad_trace_next_glVertexP3ui = glad_glVertexP3ui;
+		glad_glVertexP3ui = glad_trace_glVertexP3ui;
+	}
+	if (glad_glVertexP3uiv != NULL && glad_glVertexP3uiv != glad_trace_glVertexP3uiv) {
+		glad_trace_next_glVertexP3uiv = glad_glVertexP3uiv;
+		glad_glVertexP3uiv = glad_trace_glVertexP3uiv;
+	}
+	if (glad_glVertexP4ui != NULL && glad_glVertexP4ui != glad_trace_glVertexP4ui) {
+		glad_trace_next_glVertexP4ui = glad_glVertexP4ui;
+		glad_glVertexP4ui = glad_trace_glVertexP4ui;
+	}
+	if (glad_glVertexP4uiv != NULL && glad_glVertexP4uiv != glad_trace_glVertexP4uiv) {
+		glad_trace_next_glVertexP4uiv = glad_glVertexP4uiv;
+		glad_glVertexP4uiv = glad_trace_glVertexP4uiv;
+	}
+	if (glad_glTexCoordP1ui != NULL && glad_glTexCoordP1ui != glad_trace_glTexCoordP1ui) {
+		glad_trace_next_glTexCoordP1ui = glad_glTexCoordP1ui;
+		glad_glTexCoordP1ui = glad_trace_glTexCoordP1ui;
+	}
+	if (glad_glTexCoordP1uiv != NULL && glad_glTexCoordP1uiv != glad_trace_glTexCoordP1uiv) {
+		glad_trace_next_glTexCoordP1uiv = glad_glTexCoordP1uiv;
+		glad_glTexCoordP1uiv = glad_trace_glTexCoordP1uiv;
+	}
+	if (glad_glTexCoordP2ui != NULL && glad_glTexCoordP2ui != glad_trace_glTexCoordP2ui) {
+		glad_trace_next_glTexCoordP2ui = glad_glTexCoordP2ui;
+		glad_glTexCoordP2ui = glad_trace_glTexCoordP2ui;
+	}
+	if (glad_glTexCoordP2uiv != NULL && glad_glTexCoordP2uiv != glad_trace_glTexCoordP2uiv) {
+		glad_trace_next_glTexCoordP2uiv = glad_glTexCoordP2uiv;
+		glad_glTexCoordP2uiv = glad_trace_glTexCoordP2uiv;
+	}
+	if (glad_glTexCoordP3ui != NULL && glad_glTexCoordP3ui != glad_trace_glTexCoordP3ui) {
+		glad_trace_next_glTexCoordP3ui = glad_glTexCoordP3ui;
+		glad_glTexCoordP3ui = glad_trace_glTexCoordP3ui;
+	}
+	if (glad_glTexCoordP3uiv != NULL && glad_glTexCoordP3uiv != glad_trace_glTexCoordP3uiv) {
+		glad_trace_next_glTexCoordP3uiv = glad_glTexCoordP3uiv;
+		glad_glTexCoordP3uiv = glad_trace_glTexCoordP3uiv;
+	}
+	if (glad_glTexCoordP4ui != NULL && glad_glTexCoordP4ui != glad_trace_glTexCoordP4ui) {
+		glad_trace_next_glTexCoordP4ui = glad_glTexCoordP4ui;
+		glad_glTexCoordP4ui = glad_trace_glTexCoordP4ui;
+	}
+	if (glad_glTexCoordP4uiv != NULL && glad_glTexCoordP4uiv != glad_trace_glTexCoordP4uiv) {
+		glad_trace_next_glTexCoordP4uiv = glad_glTexCoordP4uiv;
+		glad_glTexCoordP4uiv = glad_trace_glTexCoordP4uiv;
+	}
+	if (glad_glMultiTexCoordP1ui != NULL && glad_glMultiTexCoordP1ui != glad_trace_glMultiTexCoordP1ui) {
+		glad_trace_next_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+		glad_glMultiTexCoordP1ui = glad_trace_glMultiTexCoordP1ui;
+	}
+	if (glad_glMultiTexCoordP1uiv != NULL && glad_glMultiTexCoordP1uiv != glad_trace_glMultiTexCoordP1uiv) {
+		glad_trace_next_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+		glad_glMultiTexCoordP1uiv = glad_trace_glMultiTexCoordP1uiv;
+	}
+	if (glad_glMultiTexCoordP2ui != NULL && glad_glMultiTexCoordP2ui != glad_trace_glMultiTexCoordP2ui) {
+		glad_trace_next_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+		glad_glMultiTexCoordP2ui = glad_trace_glMultiTexCoordP2ui;
+	}
+	if (glad_glMultiTexCoordP2uiv != NULL && glad_glMultiTexCoordP2uiv != glad_trace_glMultiTexCoordP2uiv) {
+		glad_trace_next_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+		glad_glMultiTexCoordP2uiv = glad_trace_glMultiTexCoordP2uiv;
+	}
+	if (glad_glMultiTexCoordP3ui != NULL && glad_glMultiTexCoordP3ui != glad_trace_glMultiTexCoordP3ui) {
+		glad_trace_next_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+		glad_glMultiTexCoordP3ui = glad_trace_glMultiTexCoordP3ui;
+	}
+	if (glad_glMultiTexCoordP3uiv != NULL && glad_glMultiTexCoordP3uiv != glad_trace_glMultiTexCoordP3uiv) {
+		glad_trace_next_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+		glad_glMultiTexCoordP3uiv = glad_trace_glMultiTexCoordP3uiv;
+	}
+	if (glad_glMultiTexCoordP4ui != NULL && glad_glMultiTexCoordP4ui != glad_trace_glMultiTexCoordP4ui) {
+		glad_trace_next_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+		glad_glMultiTexCoordP4ui = glad_trace_glMultiTexCoordP4ui;
+	}
+	if (glad_glMultiTexCoordP4uiv != NULL && glad_glMultiTexCoordP4uiv != glad_trace_glMultiTexCoordP4uiv) {
+		glad_trace_next_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+		glad_glMultiTexCoordP4uiv = glad_trace_glMultiTexCoordP4uiv;
+	}
+	if (glad_glNormalP3ui != NULL && glad_glNormalP3ui != glad_trace_glNormalP3ui) {
+		glad_trace_next_glNormalP3ui = glad_glNormalP3ui;
+		glad_glNormalP3ui = glad_trace_glNormalP3ui;
+	}
+	if (glad_glNormalP3uiv != NULL && glad_glNormalP3uiv != glad_trace_glNormalP3uiv) {
+		glad_trace_next_glNormalP3uiv = glad_glNormalP3uiv;
+		glad_glNormalP3uiv = glad_trace_glNormalP3uiv;
+	}
+	if (glad_glColorP3ui != NULL && glad_glColorP3ui != glad_trace_glColorP3ui) {
+		glad_trace_next_glColorP3ui = glad_glColorP3ui;
+		glad_glColorP3ui = glad_trace_glColorP3ui;
+	}
+	if (glad_glColorP3uiv != NULL && glad_glColorP3uiv != glad_trace_glColorP3uiv) {
+		glad_trace_next_glColorP3uiv = glad_glColorP3uiv;
+		glad_glColorP3uiv = glad_trace_glColorP3uiv;
+	}
+	if (glad_glColorP4ui != NULL && glad_glColorP4ui != glad_trace_glColorP4ui) {
+		glad_trace_next_glColorP4ui = glad_glColorP4ui;
+		glad_glColorP4ui = glad_trace_glColorP4ui;
+	}
+	if (glad_glColorP4uiv != NULL && glad_glColorP4uiv != glad_trace_glColorP4uiv) {
+		glad_trace_next_glColorP4uiv = glad_glColorP4uiv;
+		glad_glColorP4uiv = glad_trace_glColorP4uiv;
+	}
+	if (glad_glSecondaryColorP3ui != NULL && glad_glSecondaryColorP3ui != glad_trace_glSecondaryColorP3ui) {
+		glad_trace_next_glSecondaryColorP3ui = glad_glSecondaryColorP3ui;
+		glad_glSecondaryColorP3ui = glad_trace_glSecondaryColorP3ui;
+	}
+	if (glad_glSecondaryColorP3uiv != NULL && glad_glSecondaryColorP3uiv != glad_trace_glSecondaryColorP3uiv) {
+		glad_trace_next_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+		glad_glSecondaryColorP3uiv = glad_trace_glSecondaryColorP3uiv;
+	}
+	if (glad_glMinSampleShading != NULL && glad_glMinSampleShading != glad_trace_glMinSampleShading) {
+		glad_trace_next_glMinSampleShading = glad_glMinSampleShading;
+		glad_glMinSampleShading = glad_trace_glMinSampleShading;
+	}
+	if (glad_glBlendEquationi != NULL && glad_glBlendEquationi != glad_trace_glBlendEquationi) {
+		glad_trace_next_glBlendEquationi = glad_glBlendEquationi;
+		glad_glBlendEquationi = glad_trace_glBlendEquationi;
+	}
+	if (glad_glBlendEquationSeparatei != NULL && glad_glBlendEquationSeparatei != glad_trace_glBlendEquationSeparatei) {
+		glad_trace_next_glBlendEquationSeparatei = glad_glBlendEquationSeparatei;
+		glad_glBlendEquationSeparatei = glad_trace_glBlendEquationSeparatei;
+	}
+	if (glad_glBlendFunci != NULL && glad_glBlendFunci != glad_trace_glBlendFunci) {
+		glad_trace_next_glBlendFunci = glad_glBlendFunci;
+		glad_glBlendFunci = glad_trace_glBlendFunci;
+	}
+	if (glad_glBlendFuncSeparatei != NULL && glad_glBlendFuncSeparatei != glad_trace_glBlendFuncSeparatei) {
+		glad_trace_next_glBlendFuncSeparatei = glad_glBlendFuncSeparatei;
+		glad_glBlendFuncSeparatei = glad_trace_glBlendFuncSeparatei;
+	}
+	if (glad_glDrawArraysIndirect != NULL && glad_glDrawArraysIndirect != glad_trace_glDrawArraysIndirect) {
+		glad_trace_next_glDrawArraysIndirect = glad_glDrawArraysIndirect;
+		glad_glDrawArraysIndirect = glad_trace_glDrawArraysIndirect;
+	}
+	if (glad_glDrawElementsIndirect != NULL && glad_glDrawElementsIndirect != glad_trace_glDrawElementsIndirect) {
+		glad_trace_next_glDrawElementsIndirect = glad_glDrawElementsIndirect;
+		glad_glDrawElementsIndirect = glad_trace_glDrawElementsIndirect;
+	}
+	if (glad_glUniform1d != NULL && glad_glUniform1d != glad_trace_glUniform1d) {
+		glad_trace_next_glUniform1d = glad_glUniform1d;
+		glad_glUniform1d = glad_trace_glUniform1d;
+	}
+	if (glad_glUniform2d != NULL && glad_glUniform2d != glad_trace_glUniform2d) {
+		glad_trace_next_glUniform2d = glad_glUniform2d;
+		glad_glUniform2d = glad_trace_glUniform2d;
+	}
+	if (glad_glUniform3d != NULL && glad_glUniform3d != glad_trace_glUniform3d) {
+		glad_trace_next_glUniform3d = glad_glUniform3d;
+		glad_glUniform3d = glad_trace_glUniform3d;
+	}
+	if (glad_glUniform4d != NULL && glad_glUniform4d != glad_trace_glUniform4d) {
+		glad_trace_next_glUniform4d = glad_glUniform4d;
+		glad_glUniform4d = glad_trace_glUniform4d;
+	}
+	if (glad_glUniform1dv != NULL && glad_glUniform1dv != glad_trace_glUniform1dv) {
+		glad_trace_next_glUniform1dv = glad_glUniform1dv;
+		glad_glUniform1dv = glad_trace_glUniform1dv;
+	}
+	if (glad_glUniform2dv != NULL && glad_glUniform2dv != glad_trace_glUniform2dv) {
+		glad_trace_next_glUniform2dv = glad_glUniform2dv;
+		glad_glUniform2dv = glad_trace_glUniform2dv;
+	}
+	if (glad_glUniform3dv != NULL && glad_glUniform3dv != glad_trace_glUniform3dv) {
+		glad_trace_next_glUniform3dv = glad_glUniform3dv;
+		glad_glUniform3dv = glad_trace_glUniform3dv;
+	}
+	if (glad_glUniform4dv != NULL && glad_glUniform4dv != glad_trace_glUniform4dv) {
+		glad_trace_next_glUniform4dv = glad_glUniform4dv;
+		glad_glUniform4dv = glad_trace_glUniform4dv;
+	}
+	if (glad_glUniformMatrix2dv != NULL && glad_glUniformMatrix2dv != glad_trace_glUniformMatrix2dv) {
+		glad_trace_next_glUniformMatrix2dv = glad_glUniformMatrix2dv;
+		glad_glUniformMatrix2dv = glad_trace_glUniformMatrix2dv;
+	}
+	if (glad_glUniformMatrix3dv != NULL && glad_glUniformMatrix3dv != glad_trace_glUniformMatrix3dv) {
+		glad_trace_next_glUniformMatrix3dv = glad_glUniformMatrix3dv;
+		glad_glUniformMatrix3dv = glad_trace_glUniformMatrix3dv;
+	}
+	if (glad_glUniformMatrix4dv != NULL && glad_glUniformMatrix4dv != glad_trace_glUniformMatrix4dv) {
+		glad_trace_next_glUniformMatrix4dv = glad_glUniformMatrix4dv;
+		glad_glUniformMatrix4dv = glad_trace_glUniformMatrix4dv;
+	}
+	if (glad_glUniformMatrix2x3dv != NULL && glad_glUniformMatrix2x3dv != glad_trace_glUniformMatrix2x3dv) {
+		glad_trace_next_glUniformMatrix2x3dv = glad_glUniformMatrix2x3dv;
+		glad_glUniformMatrix2x3dv = glad_trace_glUniformMatrix2x3dv;
+	}
+	if (glad_glUniformMatrix2x4dv != NULL && glad_glUniformMatrix2x4dv != glad_trace_glUniformMatrix2x4dv) {
+		glad_trace_next_glUniformMatrix2x4dv = glad_glUniformMatrix2x4dv;
+		glad_glUniformMatrix2x4dv = glad_trace_glUniformMatrix2x4dv;
+	}
+	if (glad_glUniformMatrix3x2dv != NULL && glad_glUniformMatrix3x2dv != glad_trace_glUniformMatrix3x2dv) {
+		glad_trace_next_glUniformMatrix3x2dv = glad_glUniformMatrix3x2dv;
+		glad_glUniformMatrix3x2dv = glad_trace_glUniformMatrix3x2dv;
+	}
+	if (glad_glUniformMatrix3x4dv != NULL && glad_glUniformMatrix3x4dv != glad_trace_glUniformMatrix3x4dv) {
+		glad_trace_next_glUniformMatrix3x4dv = glad_glUniformMatrix3x4dv;
+		glad_glUniformMatrix3x4dv = glad_trace_glUniformMatrix3x4dv;
+	}
+	if (glad_glUniformMatrix4x2dv != NULL && glad_glUniformMatrix4x2dv != glad_trace_glUniformMatrix4x2dv) {
+		glad_trace_next_glUniformMatrix4x2dv = glad_glUniformMatrix4x2dv;
+		glad_glUniformMatrix4x2dv = glad_trace_glUniformMatrix4x2dv;
+	}
+	if (glad_glUniformMatrix4x3dv != NULL && glad_glUniformMatrix4x3dv != glad_trace_glUniformMatrix4x3dv) {
+		glad_trace_next_glUniformMatrix4x3dv = glad_glUniformMatrix4x3dv;
+		glad_glUniformMatrix4x3dv = glad_trace_glUniformMatrix4x3dv;
+	}
+	if (glad_glUniformSubroutinesuiv != NULL && glad_glUniformSubroutinesuiv != glad_trace_glUniformSubroutinesuiv) {
+		glad_trace_next_glUniformSubroutinesuiv = glad_glUniformSubroutinesuiv;
+		glad_glUniformSubroutinesuiv = glad_trace_glUniformSubroutinesuiv;
+	}
+	if (glad_glPatchParameteri != NULL && glad_glPatchParameteri != glad_trace_glPatchParameteri) {
+		glad_trace_next_glPatchParameteri = glad_glPatchParameteri;
+		glad_glPatchParameteri = glad_trace_glPatchParameteri;
+	}
+	if (glad_glPatchParameterfv != NULL && glad_glPatchParameterfv != glad_trace_glPatchParameterfv) {
+		glad_trace_next_glPatchParameterfv = glad_glPatchParameterfv;
+		glad_glPatchParameterfv = glad_trace_glPatchParameterfv;
+	}
+	if (glad_glBindTransformFeedback != NULL && glad_glBindTransformFeedback != glad_trace_glBindTransformFeedback) {
+		glad_trace_next_glBindTransformFeedback = glad_glBindTransformFeedback;
+		glad_glBindTransformFeedback = glad_trace_glBindTransformFeedback;
+	}
+	if (glad_glDeleteTransformFeedbacks != NULL && glad_glDeleteTransformFeedbacks != glad_trace_glDeleteTransformFeedbacks) {
+		glad_trace_next_glDeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks;
+		glad_glDeleteTransformFeedbacks = glad_trace_glDeleteTransformFeedbacks;
+	}
+	if (glad_glGenTransformFeedbacks != NULL && glad_glGenTransformFeedbacks != glad_trace_glGenTransformFeedbacks) {
+		glad_trace_next_glGenTransformFeedbacks = glad_glGenTransformFeedbacks;
+		glad_glGenTransformFeedbacks = glad_trace_glGenTransformFeedbacks;
+	}
+	if (glad_glPauseTransformFeedback != NULL && glad_glPauseTransformFeedback != glad_trace_glPauseTransformFeedback) {
+		glad_trace_next_glPauseTransformFeedback = glad_glPauseTransformFeedback;
+		glad_glPauseTransformFeedback = glad_trace_glPauseTransformFeedback;
+	}
+	if (glad_glResumeTransformFeedback != NULL && glad_glResumeTransformFeedback != glad_trace_glResumeTransformFeedback) {
+		glad_trace_next_glResumeTransformFeedback = glad_glResumeTransformFeedback;
+		glad_glResumeTransformFeedback = glad_trace_glResumeTransformFeedback;
+	}
+	if (glad_glDrawTransformFeedback != NULL && glad_glDrawTransformFeedback != glad_trace_glDrawTransformFeedback) {
+		glad_trace_next_glDrawTransformFeedback = glad_glDrawTransformFeedback;
+		glad_glDrawTransformFeedback = glad_trace_glDrawTransformFeedback;
+	}
+	if (glad_glDrawTransformFeedbackStream != NULL && glad_glDrawTransformFeedbackStream != glad_trace_glDrawTransformFeedbackStream) {
+		glad_trace_next_glDrawTransformFeedbackStream = glad_glDrawTransformFeedbackStream;
+		glad_glDrawTransformFeedbackStream = glad_trace_glDrawTransformFeedbackStream;
+	}
+	if (glad_glBeginQueryIndexed != NULL && glad_glBeginQueryIndexed != glad_trace_glBeginQueryIndexed) {
+		glad_trace_next_glBeginQueryIndexed = glad_glBeginQueryIndexed;
+		glad_glBeginQueryIndexed = glad_trace_glBeginQueryIndexed;
+	}
+	if (glad_glEndQueryIndexed != NULL && glad_glEndQueryIndexed != glad_trace_glEndQueryIndexed) {
+		glad_trace_next_glEndQueryIndexed = glad_glEndQueryIndexed;
+		glad_glEndQueryIndexed = glad_trace_glEndQueryIndexed;
+	}
+	if (glad_glReleaseShaderCompiler != NULL && glad_glReleaseShaderCompiler != glad_trace_glReleaseShaderCompiler) {
+		glad_trace_next_glReleaseShaderCompiler = glad_glReleaseShaderCompiler;
+		glad_glReleaseShaderCompiler = glad_trace_glReleaseShaderCompiler;
+	}
+	if (glad_glShaderBinary != NULL && glad_glShaderBinary != glad_trace_glShaderBinary) {
+		glad_trace_next_glShaderBinary = glad_glShaderBinary;
+		glad_glShaderBinary = glad_trace_glShaderBinary;
+	}
+	if (glad_glDepthRangef != NULL && glad_glDepthRangef != glad_trace_glDepthRangef) {
+		glad_trace_next_glDepthRangef = glad_glDepthRangef;
+		glad_glDepthRangef = glad_trace_glDepthRangef;
+	}
+	if (glad_glClearDepthf != NULL && glad_glClearDepthf != glad_trace_glClearDepthf) {
+		glad_trace_next_glClearDepthf = glad_glClearDepthf;
+		glad_glClearDepthf = glad_trace_glClearDepthf;
+	}
+	if (glad_glProgramBinary != NULL && glad_glProgramBinary != glad_trace_glProgramBinary) {
+		glad_trace_next_glProgramBinary = glad_glProgramBinary;
+		glad_glProgramBinary = glad_trace_glProgramBinary;
+	}
+	if (glad_glProgramParameteri != NULL && glad_glProgramParameteri != glad_trace_glProgramParameteri) {
+		glad_trace_next_glProgramParameteri = glad_glProgramParameteri;
+		glad_glProgramParameteri = glad_trace_glProgramParameteri;
+	}
+	if (glad_glUseProgramStages != NULL && glad_glUseProgramStages != glad_trace_glUseProgramStages) {
+		glad_trace_next_glUseProgramStages = glad_glUseProgramStages;
+		glad_glUseProgramStages = glad_trace_glUseProgramStages;
+	}
+	if (glad_glActiveShaderProgram != NULL && glad_glActiveShaderProgram != glad_trace_glActiveShaderProgram) {
+		glad_trace_next_glActiveShaderProgram = glad_glActiveShaderProgram;
+		glad_glActiveShaderProgram = glad_trace_glActiveShaderProgram;
+	}
+	if (glad_glCreateShaderProgramv != NULL && glad_glCreateShaderProgramv != glad_trace_glCreateShaderProgramv) {
+		glad_trace_next_glCreateShaderProgramv = glad_glCreateShaderProgramv;
+		glad_glCreateShaderProgramv = glad_trace_glCreateShaderProgramv;
+	}
+	if (glad_glBindProgramPipeline != NULL && glad_glBindProgramPipeline != glad_trace_glBindProgramPipeline) {
+		glad_trace_next_glBindProgramPipeline = glad_glBindProgramPipeline;
+		glad_glBindProgramPipeline = glad_trace_glBindProgramPipeline;
+	}
+	if (glad_glDeleteProgramPipelines != NULL && glad_glDeleteProgramPipelines != glad_trace_glDeleteProgramPipelines) {
+		glad_trace_next_glDeleteProgramPipelines = glad_glDeleteProgramPipelines;
+		glad_glDeleteProgramPipelines = glad_trace_glDeleteProgramPipelines;
+	}
+	if (glad_glGenProgramPipelines != NULL && glad_glGenProgramPipelines != glad_trace_glGenProgramPipelines) {
+		glad_trace_next_glGenProgramPipelines = glad_glGenProgramPipelines;
+		glad_glGenProgramPipelines = glad_trace_glGenProgramPipelines;
+	}
+	if (glad_glProgramUniform1i != NULL && glad_glProgramUniform1i != glad_trace_glProgramUniform1i) {
+		glad_trace_next_glProgramUniform1i = glad_glProgramUniform1i;
+		glad_glProgramUniform1i = glad_trace_glProgramUniform1i;
+	}
+	if (glad_glProgramUniform1iv != NULL && glad_glProgramUniform1iv != glad_trace_glProgramUniform1iv) {
+		glad_trace_next_glProgramUniform1iv = glad_glProgramUniform1iv;
+		glad_glProgramUniform1iv = glad_trace_glProgramUniform1iv;
+	}
+	if (glad_glProgramUniform1f != NULL && glad_glProgramUniform1f != glad_trace_glProgramUniform1f) {
+		glad_trace_next_glProgramUniform1f = glad_glProgramUniform1f;
+		glad_glProgramUniform1f = glad_trace_glProgramUniform1f;
+	}
+	if (glad_glProgramUniform1fv != NULL && glad_glProgramUniform1fv != glad_trace_glProgramUniform1fv) {
+		glad_trace_next_glProgramUniform1fv = glad_glProgramUniform1fv;
+		glad_glProgramUniform1fv = glad_trace_glProgramUniform1fv;
+	}
+	if (glad_glProgramUniform1d != NULL && glad_glProgramUniform1d != glad_trace_glProgramUniform1d) {
+		glad_trace_next_glProgramUniform1d = glad_glProgramUniform1d;
+		glad_glProgramUniform1d = glad_trace_glProgramUniform1d;
+	}
+	if (glad_glProgramUniform1dv != NULL && glad_glProgramUniform1dv != glad_trace_glProgramUniform1dv) {
+		glad_trace_next_glProgramUniform1dv = glad_glProgramUniform1dv;
+		glad_glProgramUniform1dv = glad_trace_glProgramUniform1dv;
+	}
+	if (glad_glProgramUniform1ui != NULL && glad_glProgramUniform1ui != glad_trace_glProgramUniform1ui) {
+		glad_trace_next_glProgramUniform1ui = glad_glProgramUniform1ui;
+		glad_glProgramUniform1ui = glad_trace_glProgramUniform1ui;
+	}
+	if (glad_glProgramUniform1uiv != NULL && glad_glProgramUniform1uiv != glad_trace_glProgramUniform1uiv) {
+		glad_trace_next_glProgramUniform1uiv = glad_glProgramUniform1uiv;
+		glad_glProgramUniform1uiv = glad_trace_glProgramUniform1uiv;
+	}
+	if (glad_glProgramUniform2i != NULL && glad_glProgramUniform2i != glad_trace_glProgramUniform2i) {
+		glad_trace_next_glProgramUniform2i = glad_glProgramUniform2i;
+		glad_glProgramUniform2i = glad_trace_glProgramUniform2i;
+	}
+	if (glad_glProgramUniform2iv != NULL && glad_glProgramUniform2iv != glad_trace_glProgramUniform2iv) {
+		glad_trace_next_glProgramUniform2iv = glad_glProgramUniform2iv;
+		glad_glProgramUniform2iv = glad_trace_glProgramUniform2iv;
+	}
+	if (glad_glProgramUniform2f != NULL && glad_glProgramUniform2f != glad_trace_glProgramUniform2f) {
+		glad_trace_next_glProgramUniform2f = glad_glProgramUniform2f;
+		glad_glProgramUniform2f = glad_trace_glProgramUniform2f;
+	}
+	if (glad_glProgramUniform2fv != NULL && glad_glProgramUniform2fv != glad_trace_glProgramUniform2fv) {
+		glad_trace_next_glProgramUniform2fv = glad_glProgramUniform2fv;
+		glad_glProgramUniform2fv = glad_trace_glProgramUniform2fv;
+	}
+	if (glad_glProgramUniform2d != NULL && glad_glProgramUniform2d != glad_trace_glProgramUniform2d) {
+		glad_trace_next_glProgramUniform2d = glad_glProgramUniform2d;
+		glad_glProgramUniform2d = glad_trace_glProgramUniform2d;
+	}
+	if (glad_glProgramUniform2dv != NULL && glad_glProgramUniform2dv != glad_trace_glProgramUniform2dv) {
+		glad_trace_next_glProgramUniform2dv = glad_glProgramUniform2dv;
+		glad_glProgramUniform2dv = glad_trace_glProgramUniform2dv;
+	}
+	if (glad_glProgramUniform2ui != NULL && glad_glProgramUniform2ui != glad_trace_glProgramUniform2ui) {
+		glad_trace_next_glProgramUniform2ui = glad_glProgramUniform2ui;
+		glad_glProgramUniform2ui = glad_trace_glProgramUniform2ui;
+	}
+	if (glad_glProgramUniform2uiv != NULL && glad_glProgramUniform2uiv != glad_trace_glProgramUniform2uiv) {
+		glad_trace_next_glProgramUniform2uiv = glad_glProgramUniform2uiv;
+		glad_glProgramUniform2uiv = glad_trace_glProgramUniform2uiv;
+	}
+	if (glad_glProgramUniform3i != NULL && glad_glProgramUniform3i != glad_trace_glProgramUniform3i) {
+		glad_trace_next_glProgramUniform3i = glad_glProgramUniform3i;
+		glad_glProgramUniform3i = glad_trace_glProgramUniform3i;
+	}
+	if (glad_glProgramUniform3iv != NULL && glad_glProgramUniform3iv != glad_trace_glProgramUniform3iv) {
+		glad_trace_next_glProgramUniform3iv = glad_glProgramUniform3iv;
+		glad_glProgramUniform3iv = glad_trace_glProgramUniform3iv;
+	}
+	if (glad_glProgramUniform3f != NULL && glad_glProgramUniform3f != glad_trace_glProgramUniform3f) {
+		glad_trace_next_glProgramUniform3f = glad_glProgramUniform3f;
+		glad_glProgramUniform3f = glad_trace_glProgramUniform3f;
+	}
+	if (glad_glProgramUniform3fv != NULL && glad_glProgramUniform3fv != glad_trace_glProgramUniform3fv) {
+		glad_trace_next_glProgramUniform3fv = glad_glProgramUniform3fv;
+		glad_glProgramUniform3fv = glad_trace_glProgramUniform3fv;
+	}
+	if (glad_glProgramUniform3d != NULL && glad_glProgramUniform3d != glad_trace_glProgramUniform3d) {
+		glad_trace_next_glProgramUniform3d = glad_glProgramUniform3d;
+		glad_glProgramUniform3d = glad_trace_glProgramUniform3d;
+	}
+	if (glad_glProgramUniform3dv != NULL && glad_glProgramUniform3dv != glad_trace_glProgramUniform3dv) {
+		glad_trace_next_glProgramUniform3dv = glad_glProgramUniform3dv;
+		glad_glProgramUniform3dv = glad_trace_glProgramUniform3dv;
+	}
+	if (glad_glProgramUniform3ui != NULL && glad_glProgramUniform3ui != glad_trace_glProgramUniform3ui) {
+		glad_trace_next_glProgramUniform3ui = glad_glProgramUniform3ui;
+		glad_glProgramUniform3ui = glad_trace_glProgramUniform3ui;
+	}
+	if (glad_glProgramUniform3uiv != NULL && glad_glProgramUniform3uiv != glad_trace_glProgramUniform3uiv) {
+		glad_trace_next_glProgramUniform3uiv = glad_glProgramUniform3uiv;
+		glad_glProgramUniform3uiv = glad_trace_glProgramUniform3uiv;
+	}
+	if (glad_glProgramUniform4i != NULL && glad_glProgramUniform4i != glad_trace_glProgramUniform4i) {
+		glad_trace_next_glProgramUniform4i = glad_glProgramUniform4i;
+		glad_glProgramUniform4i = glad_trace_glProgramUniform4i;
+	}
+	if (glad_glProgramUniform4iv != NULL && glad_glProgramUniform4iv != glad_trace_glProgramUniform4iv) {
+		glad_trace_next_glProgramUniform4iv = glad_glProgramUniform4iv;
+		glad_glProgramUniform4iv = glad_trace_glProgramUniform4iv;
+	}
+	if (glad_glProgramUniform4f != NULL && glad_glProgramUniform4f != glad_trace_glProgramUniform4f) {
+		glad_trace_next_glProgramUniform4f = glad_glProgramUniform4f;
+		glad_glProgramUniform4f = glad_trace_glProgramUniform4f;
+	}
+	if (glad_glProgramUniform4fv != NULL && glad_glProgramUniform4fv != glad_trace_glProgramUniform4fv) {
+		glad_trace_next_glProgramUniform4fv = glad_glProgramUniform4fv;
+		glad_glProgramUniform4fv = glad_trace_glProgramUniform4fv;
+	}
+	if (glad_glProgramUniform4d != NULL && glad_glProgramUniform4d != glad_trace_glProgramUniform4d) {
+		glad_trace_next_glProgramUniform4d = glad_glProgramUniform4d;
+		glad_glProgramUniform4d = glad_trace_glProgramUniform4d;
+	}
+	if (glad_glProgramUniform4dv != NULL && glad_glProgramUniform4dv != glad_trace_glProgramUniform4dv) {
+		glad_trace_next_glProgramUniform4dv = glad_glProgramUniform4dv;
+		glad_glProgramUniform4dv = glad_trace_glProgramUniform4dv;
+	}
+	if (glad_glProgramUniform4ui != NULL && glad_glProgramUniform4ui != glad_trace_glProgramUniform4ui) {
+		glad_trace_next_glProgramUniform4ui = glad_glProgramUniform4ui;
+		glad_glProgramUniform4ui = glad_trace_glProgramUniform4ui;
+	}
+	if (glad_glProgramUniform4uiv != NULL && glad_glProgramUniform4uiv != glad_trace_glProgramUniform4uiv) {
+		glad_trace_next_glProgramUniform4uiv = glad_glProgramUniform4uiv;
+		glad_glProgramUniform4uiv = glad_trace_glProgramUniform4uiv;
+	}
+	if (glad_glProgramUniformMatrix2fv != NULL && glad_glProgramUniformMatrix2fv != glad_trace_glProgramUniformMatrix2fv) {
+		glad_trace_next_glProgramUniformMatrix2fv = glad_glProgramUniformMatrix2fv;
+		glad_glProgramUniformMatrix2fv = glad_trace_glProgramUniformMatrix2fv;
+	}
+	if (glad_glProgramUniformMatrix3fv != NULL && glad_glProgramUniformMatrix3fv != glad_trace_glProgramUniformMatrix3fv) {
+		glad_trace_next_glProgramUniformMatrix3fv = glad_glProgramUniformMatrix3fv;
+		glad_glProgramUniformMatrix3fv = glad_trace_glProgramUniformMatrix3fv;
+	}
+	if (glad_glProgramUniformMatrix4fv != NULL && glad_glProgramUniformMatrix4fv != glad_trace_glProgramUniformMatrix4fv) {
+		glad_trace_next_glProgramUniformMatrix4fv = glad_glProgramUniformMatrix4fv;
+		glad_glProgramUniformMatrix4fv = glad_trace_glProgramUniformMatrix4fv;
+	}
+	if (glad_glProgramUniformMatrix2dv != NULL && glad_glProgramUniformMatrix2dv != glad_trace_glProgramUniformMatrix2dv) {
+		glad_trace_next_glProgramUniformMatrix2dv = glad_glProgramUniformMatrix2dv;
+		glad_glProgramUniformMatrix2dv = glad_trace_glProgramUniformMatrix2dv;
+	}
+	if (glad_glProgramUniformMatrix3dv != NULL && glad_glProgramUniformMatrix3dv != glad_trace_glProgramUniformMatrix3dv) {
+		glad_trace_next_glProgramUniformMatrix3dv = glad_glProgramUniformMatrix3dv;
+		glad_glProgramUniformMatrix3dv = glad_trace_glProgramUniformMatrix3dv;
+	}
+	if (glad_glProgramUniformMatrix4dv != NULL && glad_glProgramUniformMatrix4dv != glad_trace_glProgramUniformMatrix4dv) {
+		glad_trace_next_glProgramUniformMatrix4dv = glad_glProgramUniformMatrix4dv;
+		glad_glProgramUniformMatrix4dv = glad_trace_glProgramUniformMatrix4dv;
+	}
+	if (glad_glProgramUniformMatrix2x3fv != NULL && glad_glProgramUniformMatrix2x3fv != glad_trace_glProgramUniformMatrix2x3fv) {
+		glad_trace_next_glProgramUniformMatrix2x3fv = glad_glProgramUniformMatrix2x3fv;
+		glad_glProgramUniformMatrix2x3fv = glad_trace_glProgramUniformMatrix2x3fv;
+	}
+	if (glad_glProgramUniformMatrix3x2fv != NULL && glad_glProgramUniformMatrix3x2fv != glad_trace_glProgramUniformMatrix3x2fv) {
+		glad_trace_next_glProgramUniformMatrix3x2fv = glad_glProgramUniformMatrix3x2fv;
+		glad_glProgramUniformMatrix3x2fv = glad_trace_glProgramUniformMatrix3x2fv;
+	}
+	if (glad_glProgramUniformMatrix2x4fv != NULL && glad_glProgramUniformMatrix2x4fv != glad_trace_glProgramUniformMatrix2x4fv) {
+		glad_trace_next_glProgramUniformMatrix2x4fv = glad_glProgramUniformMatrix2x4fv;
+		glad_glProgramUniformMatrix2x4fv = glad_trace_glProgramUniformMatrix2x4fv;
+	}
+	if (glad_glProgramUniformMatrix4x2fv != NULL && glad_glProgramUniformMatrix4x2fv != glad_trace_glProgramUniformMatrix4x2fv) {
+		glad_trace_next_glProgramUniformMatrix4x2fv = glad_glProgramUniformMatrix4x2fv;
+		glad_glProgramUniformMatrix4x2fv = glad_trace_glProgramUniformMatrix4x2fv;
+	}
+	if (glad_glProgramUniformMatrix3x4fv != NULL && glad_glProgramUniformMatrix3x4fv != glad_trace_glProgramUniformMatrix3x4fv) {
+		glad_trace_next_glProgramUniformMatrix3x4fv = glad_glProgramUniformMatrix3x4fv;
+		glad_glProgramUniformMatrix3x4fv = glad_trace_glProgramUniformMatrix3x4fv;
+	}
+	if (glad_glProgramUniformMatrix4x3fv != NULL && glad_glProgramUniformMatrix4x3fv != glad_trace_glProgramUniformMatrix4x3fv) {
+		glad_trace_next_glProgramUniformMatrix4x3fv = glad_glProgramUniformMatrix4x3fv;
+		glad_glProgramUniformMatrix4x3fv = glad_trace_glProgramUniformMatrix4x3fv;
+	}
+	if (glad_glProgramUniformMatrix2x3dv != NULL && glad_glProgramUniformMatrix2x3dv != glad_trace_glProgramUniformMatrix2x3dv) {
+		glad_trace_next_glProgramUniformMatrix2x3dv = glad_glProgramUniformMatrix2x3dv;
+		glad_glProgramUniformMatrix2x3dv = glad_trace_glProgramUniformMatrix2x3dv;
+	}
+	if (glad_glProgramUniformMatrix3x2dv != NULL && glad_glProgramUniformMatrix3x2dv != glad_trace_glProgramUniformMatrix3x2dv) {
+		glad_trace_next_glProgramUniformMatrix3x2dv = glad_glProgramUniformMatrix3x2dv;
+		glad_glProgramUniformMatrix3x2dv = glad_trace_glProgramUniformMatrix3x2dv;
+	}
+	if (glad_glProgramUniformMatrix2x4dv != NULL && glad_glProgramUniformMatrix2x4dv != glad_trace_glProgramUniformMatrix2x4dv) {
+		glad_trace_next_glProgramUniformMatrix2x4dv = glad_glProgramUniformMatrix2x4dv;
+		glad_glProgramUniformMatrix2x4dv = glad_trace_glProgramUniformMatrix2x4dv;
+	}
+	if (glad_glProgramUniformMatrix4x2dv != NULL && glad_glProgramUniformMatrix4x2dv != glad_trace_glProgramUniformMatrix4x2dv) {
+		glad_trace_next_glProgramUniformMatrix4x2dv = glad_glProgramUniformMatrix4x2dv;
+		glad_glProgramUniformMatrix4x2dv = glad_trace_glProgramUniformMatrix4x2dv;
+	}
+	if (glad_glProgramUniformMatrix3x4dv != NULL && glad_glProgramUniformMatrix3x4dv != glad_trace_glProgramUniformMatrix3x4dv) {
+		glad_trace_next_glProgramUniformMatrix3x4dv = glad_glProgramUniformMatrix3x4dv;
+		glad_glProgramUniformMatrix3x4dv = glad_trace_glProgramUniformMatrix3x4dv;
+	}
+	if (glad_glProgramUniformMatrix4x3dv != NULL && glad_glProgramUniformMatrix4x3dv != glad_trace_glProgramUniformMatrix4x3dv) {
+		glad_trace_next_glProgramUniformMatrix4x3dv = glad_glProgramUniformMatrix4x3dv;
+		glad_glProgramUniformMatrix4x3dv = glad_trace_glProgramUniformMatrix4x3dv;
+	}
+	if (glad_glValidateProgramPipeline != NULL && glad_glValidateProgramPipeline != glad_trace_glValidateProgramPipeline) {
+		glad_trace_next_glValidateProgramPipeline = glad_glValidateProgramPipeline;
+		glad_glValidateProgramPipeline = glad_trace_glValidateProgramPipeline;
+	}
+	if (glad_glVertexAttribL1d != NULL && glad_glVertexAttribL1d != glad_trace_glVertexAttribL1d) {
+		glad_trace_next_glVertexAttribL1d = glad_glVertexAttribL1d;
+		glad_glVertexAttribL1d = glad_trace_glVertexAttribL1d;
+	}
+	if (glad_glVertexAttribL2d != NULL && glad_glVertexAttribL2d != glad_trace_glVertexAttribL2d) {
+		glad_trace_next_glVertexAttribL2d = glad_glVertexAttribL2d;
+		glad_glVertexAttribL2d = glad_trace_glVertexAttribL2d;
+	}
+	if (glad_glVertexAttribL3d != NULL && glad_glVertexAttribL3d != glad_trace_glVertexAttribL3d) {
+		glad_trace_next_glVertexAttribL3d = glad_glVertexAttribL3d;
+		glad_glVertexAttribL3d = glad_trace_glVertexAttribL3d;
+	}
+	if (glad_glVertexAttribL4d != NULL && glad_glVertexAttribL4d != glad_trace_glVertexAttribL4d) {
+		glad_trace_next_glVertexAttribL4d = glad_glVertexAttribL4d;
+		glad_glVertexAttribL4d = glad_trace_glVertexAttribL4d;
+	}
+	if (glad_glVertexAttribL1dv != NULL && glad_glVertexAttribL1dv != glad_trace_glVertexAttribL1dv) {
+		glad_trace_next_glVertexAttribL1dv = glad_glVertexAttribL1dv;
+		glad_glVertexAttribL1dv = glad_trace_glVertexAttribL1dv;
+	}
+	if (glad_glVertexAttribL2dv != NULL && glad_glVertexAttribL2dv != glad_trace_glVertexAttribL2dv) {
+		glad_trace_next_glVertexAttribL2dv = glad_glVertexAttribL2dv;
+		glad_glVertexAttribL2dv = glad_trace_glVertexAttribL2dv;
+	}
+	if (glad_glVertexAttribL3dv != NULL && glad_glVertexAttribL3dv != glad_trace_glVertexAttribL3dv) {
+		glad_trace_next_glVertexAttribL3dv = glad_glVertexAttribL3dv;
+		glad_glVertexAttribL3dv = glad_trace_glVertexAttribL3dv;
+	}
+	if (glad_glVertexAttribL4dv != NULL && glad_glVertexAttribL4dv != glad_trace_glVertexAttribL4dv) {
+		glad_trace_next_glVertexAttribL4dv = glad_glVertexAttribL4dv;
+		glad_glVertexAttribL4dv = glad_trace_glVertexAttribL4dv;
+	}
+	if (glad_glVertexAttribLPointer != NULL && glad_glVertexAttribLPointer != glad_trace_glVertexAttribLPointer) {
+		glad_trace_next_glVertexAttribLPointer = glad_glVertexAttribLPointer;
+		glad_glVertexAttribLPointer = glad_trace_glVertexAttribLPointer;
+	}
+	if (glad_glViewportArrayv != NULL && glad_glViewportArrayv != glad_trace_glViewportArrayv) {
+		glad_trace_next_glViewportArrayv = glad_glViewportArrayv;
+		glad_glViewportArrayv = glad_trace_glViewportArrayv;
+	}
+	if (glad_glViewportIndexedf != NULL && glad_glViewportIndexedf != glad_trace_glViewportIndexedf) {
+		glad_trace_next_glViewportIndexedf = glad_glViewportIndexedf;
+		glad_glViewportIndexedf = glad_trace_glViewportIndexedf;
+	}
+	if (glad_glViewportIndexedfv != NULL && glad_glViewportIndexedfv != glad_trace_glViewportIndexedfv) {
+		glad_trace_next_glViewportIndexedfv = glad_glViewportIndexedfv;
+		glad_glViewportIndexedfv = glad_trace_glViewportIndexedfv;
+	}
+	if (glad_glScissorArrayv != NULL && glad_glScissorArrayv != glad_trace_glScissorArrayv) {
+		glad_trace_next_glScissorArrayv = glad_glScissorArrayv;
+		glad_glScissorArrayv = glad_trace_glScissorArrayv;
+	}
+	if (glad_glScissorIndexed != NULL && glad_glScissorIndexed != glad_trace_glScissorIndexed) {
+		glad_trace_next_glScissorIndexed = glad_glScissorIndexed;
+		glad_glScissorIndexed = glad_trace_glScissorIndexed;
+	}
+	if (glad_glScissorIndexedv != NULL && glad_glScissorIndexedv != glad_trace_glScissorIndexedv) {
+		glad_trace_next_glScissorIndexedv = glad_glScissorIndexedv;
+		glad_glScissorIndexedv = glad_trace_glScissorIndexedv;
+	}
+	if (glad_glDepthRangeArrayv != NULL && glad_glDepthRangeArrayv != glad_trace_glDepthRangeArrayv) {
+		glad_trace_next_glDepthRangeArrayv = glad_glDepthRangeArrayv;
+		glad_glDepthRangeArrayv = glad_trace_glDepthRangeArrayv;
+	}
+	if (glad_glDepthRangeIndexed != NULL && glad_glDepthRangeIndexed != glad_trace_glDepthRangeIndexed) {
+		glad_trace_next_glDepthRangeIndexed = glad_glDepthRangeIndexed;
+		glad_glDepthRangeIndexed = glad_trace_glDepthRangeIndexed;
+	}
+	if (glad_glDrawArraysInstancedBaseInstance != NULL && glad_glDrawArraysInstancedBaseInstance != glad_trace_glDrawArraysInstancedBaseInstance) {
+		glad_trace_next_glDrawArraysInstancedBaseInstance = glad_glDrawArraysInstancedBaseInstance;
+		glad_glDrawArraysInstancedBaseInstance = glad_trace_glDrawArraysInstancedBaseInstance;
+	}
+	if (glad_glDrawElementsInstancedBaseInstance != NULL && glad_glDrawElementsInstancedBaseInstance != glad_trace_glDrawElementsInstancedBaseInstance) {
+		glad_trace_next_glDrawElementsInstancedBaseInstance = glad_glDrawElementsInstancedBaseInstance;
+		glad_glDrawElementsInstancedBaseInstance = glad_trace_glDrawElementsInstancedBaseInstance;
+	}
+	if (glad_glDrawElementsInstancedBaseVertexBaseInstance != NULL && glad_glDrawElementsInstancedBaseVertexBaseInstance != glad_trace_glDrawElementsInstancedBaseVertexBaseInstance) {
+		glad_trace_next_glDrawElementsInstancedBaseVertexBaseInstance = glad_glDrawElementsInstancedBaseVertexBaseInstance;
+		glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_trace_glDrawElementsInstancedBaseVertexBaseInstance;
+	}
+	if (glad_glBindImageTexture != NULL && glad_glBindImageTexture != glad_trace_glBindImageTexture) {
+		glad_trace_next_glBindImageTexture = glad_glBindImageTexture;
+		glad_glBindImageTexture = glad_trace_glBindImageTexture;
+	}
+	if (glad_glMemoryBarrier != NULL && glad_glMemoryBarrier != glad_trace_glMemoryBarrier) {
+		glad_trace_next_glMemoryBarrier = glad_glMemoryBarrier;
+		glad_glMemoryBarrier = glad_trace_glMemoryBarrier;
+	}
+	if (glad_glTexStorage1D != NULL && glad_glTexStorage1D != glad_trace_glTexStorage1D) {
+		glad_trace_next_glTexStorage1D = glad_glTexStorage1D;
+		glad_glTexStorage1D = glad_trace_glTexStorage1D;
+	}
+	if (glad_glTexStorage2D != NULL && glad_glTexStorage2D != glad_trace_glTexStorage2D) {
+		glad_trace_next_glTexStorage2D = glad_glTexStorage2D;
+		glad_glTexStorage2D = glad_trace_glTexStorage2D;
+	}
+	if (glad_glTexStorage3D != NULL && glad_glTexStorage3D != glad_trace_glTexStorage3D) {
+		glad_trace_next_glTexStorage3D = glad_glTexStorage3D;
+		glad_glTexStorage3D = glad_trace_glTexStorage3D;
+	}
+	if (glad_glDrawTransformFeedbackInstanced != NULL && glad_glDrawTransformFeedbackInstanced != glad_trace_glDrawTransformFeedbackInstanced) {
+		glad_trace_next_glDrawTransformFeedbackInstanced = glad_glDrawTransformFeedbackInstanced;
+		glad_glDrawTransformFeedbackInstanced = glad_trace_glDrawTransformFeedbackInstanced;
+	}
+	if (glad_glDrawTransformFeedbackStreamInstanced != NULL && glad_glDrawTransformFeedbackStreamInstanced != glad_trace_glDrawTransformFeedbackStreamInstanced) {
+		glad_trace_next_glDrawTransformFeedbackStreamInstanced = glad_glDrawTransformFeedbackStreamInstanced;
+		glad_glDrawTransformFeedbackStreamInstanced = glad_trace_glDrawTransformFeedbackStreamInstanced;
+	}
+	if (glad_glClearBufferData != NULL && glad_glClearBufferData != glad_trace_glClearBufferData) {
+		glad_trace_next_glClearBufferData = glad_glClearBufferData;
+		glad_glClearBufferData = glad_trace_glClearBufferData;
+	}
+	if (glad_glClearBufferSubData != NULL && glad_glClearBufferSubData != glad_trace_glClearBufferSubData) {
+		glad_trace_next_glClearBufferSubData = glad_glClearBufferSubData;
+		glad_glClearBufferSubData = glad_trace_glClearBufferSubData;
+	}
+	if (glad_glDispatchCompute != NULL && glad_glDispatchCompute != glad_trace_glDispatchCompute) {
+		glad_trace_next_glDispatchCompute = glad_glDispatchCompute;
+		glad_glDispatchCompute = glad_trace_glDispatchCompute;
+	}
+	if (glad_glDispatchComputeIndirect != NULL && glad_glDispatchComputeIndirect != glad_trace_glDispatchComputeIndirect) {
+		glad_trace_next_glDispatchComputeIndirect = glad_glDispatchComputeIndirect;
+		glad_glDispatchComputeIndirect = glad_trace_glDispatchComputeIndirect;
+	}
+	if (glad_glCopyImageSubData != NULL && glad_glCopyImageSubData != glad_trace_glCopyImageSubData) {
+		glad_trace_next_glCopyImageSubData = glad_glCopyImageSubData;
+		glad_glCopyImageSubData = glad_trace_glCopyImageSubData;
+	}
+	if (glad_glFramebufferParameteri != NULL && glad_glFramebufferParameteri != glad_trace_glFramebufferParameteri) {
+		glad_trace_next_glFramebufferParameteri = glad_glFramebufferParameteri;
+		glad_glFramebufferParameteri = glad_trace_glFramebufferParameteri;
+	}
+	if (glad_glInvalidateTexSubImage != NULL && glad_glInvalidateTexSubImage != glad_trace_glInvalidateTexSubImage) {
+		glad_trace_next_glInvalidateTexSubImage = glad_glInvalidateTexSubImage;
+		glad_glInvalidateTexSubImage = glad_trace_glInvalidateTexSubImage;
+	}
+	if (glad_glInvalidateTexImage != NULL && glad_glInvalidateTexImage != glad_trace_glInvalidateTexImage) {
+		glad_trace_next_glInvalidateTexImage = glad_glInvalidateTexImage;
+		glad_glInvalidateTexImage = glad_trace_glInvalidateTexImage;
+	}
+	if (glad_glInvalidateBufferSubData != NULL && glad_glInvalidateBufferSubData != glad_trace_glInvalidateBufferSubData) {
+		glad_trace_next_glInvalidateBufferSubData = glad_glInvalidateBufferSubData;
+		glad_glInvalidateBufferSubData = glad_trace_glInvalidateBufferSubData;
+	}
+	if (glad_glInvalidateBufferData != NULL && glad_glInvalidateBufferData != glad_trace_glInvalidateBufferData) {
+		glad_trace_next_glInvalidateBufferData = glad_glInvalidateBufferData;
+		glad_glInvalidateBufferData = glad_trace_glInvalidateBufferData;
+	}
+	if (glad_glInvalidateFramebuffer != NULL && glad_glInvalidateFramebuffer != glad_trace_glInvalidateFramebuffer) {
+		glad_trace_next_glInvalidateFramebuffer = glad_glInvalidateFramebuffer;
+		glad_glInvalidateFramebuffer = glad_trace_glInvalidateFramebuffer;
+	}
+	if (glad_glInvalidateSubFramebuffer != NULL && glad_glInvalidateSubFramebuffer != glad_trace_glInvalidateSubFramebuffer) {
+		glad_trace_next_glInvalidateSubFramebuffer = glad_glInvalidateSubFramebuffer;
+		glad_glInvalidateSubFramebuffer = glad_trace_glInvalidateSubFramebuffer;
+	}
+	if (glad_glMultiDrawArraysIndirect != NULL && glad_glMultiDrawArraysIndirect != glad_trace_glMultiDrawArraysIndirect) {
+		glad_trace_next_glMultiDrawArraysIndirect = glad_glMultiDrawArraysIndirect;
+		glad_glMultiDrawArraysIndirect = glad_trace_glMultiDrawArraysIndirect;
+	}
+	if (glad_glMultiDrawElementsIndirect != NULL && glad_glMultiDrawElementsIndirect != glad_trace_glMultiDrawElementsIndirect) {
+		glad_trace_next_glMultiDrawElementsIndirect = glad_glMultiDrawElementsIndirect;
+		glad_glMultiDrawElementsIndirect = glad_trace_glMultiDrawElementsIndirect;
+	}
+	if (glad_glShaderStorageBlockBinding != NULL && glad_glShaderStorageBlockBinding != glad_trace_glShaderStorageBlockBinding) {
+		glad_trace_next_glShaderStorageBlockBinding = glad_glShaderStorageBlockBinding;
+		glad_glShaderStorageBlockBinding = glad_trace_glShaderStorageBlockBinding;
+	}
+	if (glad_glTexBufferRange != NULL && glad_glTexBufferRange != glad_trace_glTexBufferRange) {
+		glad_trace_next_glTexBufferRange = glad_glTexBufferRange;
+		glad_glTexBufferRange = glad_trace_glTexBufferRange;
+	}
+	if (glad_glTexStorage2DMultisample != NULL && glad_glTexStorage2DMultisample != glad_trace_glTexStorage2DMultisample) {
+		glad_trace_next_glTexStorage2DMultisample = glad_glTexStorage2DMultisample;
+		glad_glTexStorage2DMultisample = glad_trace_glTexStorage2DMultisample;
+	}
+	if (glad_glTexStorage3DMultisample != NULL && glad_glTexStorage3DMultisample != glad_trace_glTexStorage3DMultisample) {
+		glad_trace_next_glTexStorage3DMultisample = glad_glTexStorage3DMultisample;
+		glad_glTexStorage3DMultisample = glad_trace_glTexStorage3DMultisample;
+	}
+	if (glad_glTextureView != NULL && glad_glTextureView != glad_trace_glTextureView) {
+		glad_trace_next_glTextureView = glad_glTextureView;
+		glad_glTextureView = glad_trace_glTextureView;
+	}
+	if (glad_glBindVertexBuffer != NULL && glad_glBindVertexBuffer != glad_trace_glBindVertexBuffer) {
+		glad_trace_next_glBindVertexBuffer = glad_glBindVertexBuffer;
+		glad_glBindVertexBuffer = glad_trace_glBindVertexBuffer;
+	}
+	if (glad_glVertexAttribFormat != NULL && glad_glVertexAttribFormat != glad_trace_glVertexAttribFormat) {
+		glad_trace_next_glVertexAttribFormat = glad_glVertexAttribFormat;
+		glad_glVertexAttribFormat = glad_trace_glVertexAttribFormat;
+	}
+	if (glad_glVertexAttribIFormat != NULL && glad_glVertexAttribIFormat != glad_trace_glVertexAttribIFormat) {
+		glad_trace_next_glVertexAttribIFormat = glad_glVertexAttribIFormat;
+		glad_glVertexAttribIFormat = glad_trace_glVertexAttribIFormat;
+	}
+	if (glad_glVertexAttribLFormat != NULL && glad_glVertexAttribLFormat != glad_trace_glVertexAttribLFormat) {
+		glad_trace_next_glVertexAttribLFormat = glad_glVertexAttribLFormat;
+		glad_glVertexAttribLFormat = glad_trace_glVertexAttribLFormat;
+	}
+	if (glad_glVertexAttribBinding != NULL && glad_glVertexAttribBinding != glad_trace_glVertexAttribBinding) {
+		glad_trace_next_glVertexAttribBinding = glad_glVertexAttribBinding;
+		glad_glVertexAttribBinding = glad_trace_glVertexAttribBinding;
+	}
+	if (glad_glVertexBindingDivisor != NULL && glad_glVertexBindingDivisor != glad_trace_glVertexBindingDivisor) {
+		glad_trace_next_glVertexBindingDivisor = glad_glVertexBindingDivisor;
+		glad_glVertexBindingDivisor = glad_trace_glVertexBindingDivisor;
+	}
+	if (glad_glDebugMessageControl != NULL && glad_glDebugMessageControl != glad_trace_glDebugMessageControl) {
+		glad_trace_next_glDebugMessageControl = glad_glDebugMessageControl;
+		glad_glDebugMessageControl = glad_trace_glDebugMessageControl;
+	}
+	if (glad_glDebugMessageInsert != NULL && glad_glDebugMessageInsert != glad_trace_glDebugMessageInsert) {
+		glad_trace_next_glDebugMessageInsert = glad_glDebugMessageInsert;
+		glad_glDebugMessageInsert = glad_trace_glDebugMessageInsert;
+	}
+	if (glad_glDebugMessageCallback != NULL && glad_glDebugMessageCallback != glad_trace_glDebugMessageCallback) {
+		glad_trace_next_glDebugMessageCallback = glad_glDebugMessageCallback;
+		glad_glDebugMessageCallback = glad_trace_glDebugMessageCallback;
+	}
+	if (glad_glPushDebugGroup != NULL && glad_glPushDebugGroup != glad_trace_glPushDebugGroup) {
+		glad_trace_next_glPushDebugGroup = glad_glPushDebugGroup;
+		glad_glPushDebugGroup = glad_trace_glPushDebugGroup;
+	}
+	if (glad_glPopDebugGroup != NULL && glad_glPopDebugGroup != glad_trace_glPopDebugGroup) {
+		glad_trace_next_glPopDebugGroup = glad_glPopDebugGroup;
+		glad_glPopDebugGroup = glad_trace_glPopDebugGroup;
+	}
+	if (glad_glObjectLabel != NULL && glad_glObjectLabel != glad_trace_glObjectLabel) {
+		glad_trace_next_glObjectLabel = glad_glObjectLabel;
+		glad_glObjectLabel = glad_trace_glObjectLabel;
+	}
+	if (glad_glObjectPtrLabel != NULL && glad_glObjectPtrLabel != glad_trace_glObjectPtrLabel) {
+		glad_trace_next_glObjectPtrLabel = glad_glObjectPtrLabel;
+		glad_glObjectPtrLabel = glad_trace_glObjectPtrLabel;
+	}
+	if (glad_glBufferStorage != NULL && glad_glBufferStorage != glad_trace_glBufferStorage) {
+		glad_trace_next_glBufferStorage = glad_glBufferStorage;
+		glad_glBufferStorage = glad_trace_glBufferStorage;
+	}
+	if (glad_glClearTexImage != NULL && glad_glClearTexImage != glad_trace_glClearTexImage) {
+		glad_trace_next_glClearTexImage = glad_glClearTexImage;
+		glad_glClearTexImage = glad_trace_glClearTexImage;
+	}
+	if (glad_glClearTexSubImage != NULL && glad_glClearTexSubImage != glad_trace_glClearTexSubImage) {
+		glad_trace_next_glClearTexSubImage = glad_glClearTexSubImage;
+		glad_glClearTexSubImage = glad_trace_glClearTexSubImage;
+	}
+	if (glad_glBindBuffersBase != NULL && glad_glBindBuffersBase != glad_trace_glBindBuffersBase) {
+		glad_trace_next_glBindBuffersBase = glad_glBindBuffersBase;
+		glad_glBindBuffersBase = glad_trace_glBindBuffersBase;
+	}
+	if (glad_glBindBuffersRange != NULL && glad_glBindBuffersRange != glad_trace_glBindBuffersRange) {
+		glad_trace_next_glBindBuffersRange = glad_glBindBuffersRange;
+		glad_glBindBuffersRange = glad_trace_glBindBuffersRange;
+	}
+	if (glad_glBindTextures != NULL && glad_glBindTextures != glad_trace_glBindTextures) {
+		glad_trace_next_glBindTextures = glad_glBindTextures;
+		glad_glBindTextures = glad_trace_glBindTextures;
+	}
+	if (glad_glBindSamplers != NULL && glad_glBindSamplers != glad_trace_glBindSamplers) {
+		glad_trace_next_glBindSamplers = glad_glBindSamplers;
+		glad_glBindSamplers = glad_trace_glBindSamplers;
+	}
+	if (glad_glBindImageTextures != NULL && glad_glBindImageTextures != glad_trace_glBindImageTextures) {
+		glad_trace_next_glBindImageTextures = glad_glBindImageTextures;
+		glad_glBindImageTextures = glad_trace_glBindImageTextures;
+	}
+	if (glad_glBindVertexBuffers != NULL && glad_glBindVertexBuffers != glad_trace_glBindVertexBuffers) {
+		glad_trace_next_glBindVertexBuffers = glad_glBindVertexBuffers;
+		glad_glBindVertexBuffers = glad_trace_glBindVertexBuffers;
+	}
+	if (glad_glClipControl != NULL && glad_glClipControl != glad_trace_glClipControl) {
+		glad_trace_next_glClipControl = glad_glClipControl;
+		glad_glClipControl = glad_trace_glClipControl;
+	}
+	if (glad_glCreateTransformFeedbacks != NULL && glad_glCreateTransformFeedbacks != glad_trace_glCreateTransformFeedbacks) {
+		glad_trace_next_glCreateTransformFeedbacks = glad_glCreateTransformFeedbacks;
+		glad_glCreateTransformFeedbacks = glad_trace_glCreateTransformFeedbacks;
+	}
+	if (glad_glTransformFeedbackBufferBase != NULL && glad_glTransformFeedbackBufferBase != glad_trace_glTransformFeedbackBufferBase) {
+		glad_trace_next_glTransformFeedbackBufferBase = glad_glTransformFeedbackBufferBase;
+		glad_glTransformFeedbackBufferBase = glad_trace_glTransformFeedbackBufferBase;
+	}
+	if (glad_glTransformFeedbackBufferRange != NULL && glad_glTransformFeedbackBufferRange != glad_trace_glTransformFeedbackBufferRange) {
+		glad_trace_next_glTransformFeedbackBufferRange = glad_glTransformFeedbackBufferRange;
+		glad_glTransformFeedbackBufferRange = glad_trace_glTransformFeedbackBufferRange;
+	}
+	if (glad_glCreateBuffers != NULL && glad_glCreateBuffers != glad_trace_glCreateBuffers) {
+		glad_trace_next_glCreateBuffers = glad_glCreateBuffers;
+		glad_glCreateBuffers = glad_trace_glCreateBuffers;
+	}
+	if (glad_glNamedBufferStorage != NULL && glad_glNamedBufferStorage != glad_trace_glNamedBufferStorage) {
+		glad_trace_next_glNamedBufferStorage = glad_glNamedBufferStorage;
+		glad_glNamedBufferStorage = glad_trace_glNamedBufferStorage;
+	}
+	if (glad_glNamedBufferData != NULL && glad_glNamedBufferData != glad_trace_glNamedBufferData) {
+		glad_trace_next_glNamedBufferData = glad_glNamedBufferData;
+		glad_glNamedBufferData = glad_trace_glNamedBufferData;
+	}
+	if (glad_glNamedBufferSubData != NULL && glad_glNamedBufferSubData != glad_trace_glNamedBufferSubData) {
+		glad_trace_next_glNamedBufferSubData = glad_glNamedBufferSubData;
+		glad_glNamedBufferSubData = glad_trace_glNamedBufferSubData;
+	}
+	if (glad_glCopyNamedBufferSubData != NULL && glad_glCopyNamedBufferSubData != glad_trace_glCopyNamedBufferSubData) {
+		glad_trace_next_glCopyNamedBufferSubData = glad_glCopyNamedBufferSubData;
+		glad_glCopyNamedBufferSubData = glad_trace_glCopyNamedBufferSubData;
+	}
+	if (glad_glClearNamedBufferData != NULL && glad_glClearNamedBufferData != glad_trace_glClearNamedBufferData) {
+		glad_trace_next_glClearNamedBufferData = glad_glClearNamedBufferData;
+		glad_glClearNamedBufferData = glad_trace_glClearNamedBufferData;
+	}
+	if (glad_glClearNamedBufferSubData != NULL && glad_glClearNamedBufferSubData != glad_trace_glClearNamedBufferSubData) {
+		glad_trace_next_glClearNamedBufferSubData = glad_glClearNamedBufferSubData;
+		glad_glClearNamedBufferSubData = glad_trace_glClearNamedBufferSubData;
+	}
+	if (glad_glMapNamedBuffer != NULL && glad_glMapNamedBuffer != glad_trace_glMapNamedBuffer) {
+		glad_trace_next_glMapNamedBuffer = glad_glMapNamedBuffer;
+		glad_glMapNamedBuffer = glad_trace_glMapNamedBuffer;
+	}
+	if (glad_glMapNamedBufferRange != NULL && glad_glMapNamedBufferRange != glad_trace_glMapNamedBufferRange) {
+		glad_trace_next_glMapNamedBufferRange = glad_glMapNamedBufferRange;
+		glad_glMapNamedBufferRange = glad_trace_glMapNamedBufferRange;
+	}
+	if (glad_glUnmapNamedBuffer != NULL && glad_glUnmapNamedBuffer != glad_trace_glUnmapNamedBuffer) {
+		glad_trace_next_glUnmapNamedBuffer = glad_glUnmapNamedBuffer;
+		glad_glUnmapNamedBuffer = glad_trace_glUnmapNamedBuffer;
+	}
+	if (glad_glFlushMappedNamedBufferRange != NULL && glad_glFlushMappedNamedBufferRange != glad_trace_glFlushMappedNamedBufferRange) {
+		glad_trace_next_glFlushMappedNamedBufferRange = glad_glFlushMappedNamedBufferRange;
+		glad_glFlushMappedNamedBufferRange = glad_trace_glFlushMappedNamedBufferRange;
+	}
+	if (glad_glCreateFramebuffers != NULL && glad_glCreateFramebuffers != glad_trace_glCreateFramebuffers) {
+		glad_trace_next_glCreateFramebuffers = glad_glCreateFramebuffers;
+		glad_glCreateFramebuffers = glad_trace_glCreateFramebuffers;
+	}
+	if (glad_glNamedFramebufferRenderbuffer != NULL && glad_glNamedFramebufferRenderbuffer != glad_trace_glNamedFramebufferRenderbuffer) {
+		glad_trace_next_glNamedFramebufferRenderbuffer = glad_glNamedFramebufferRenderbuffer;
+		glad_glNamedFramebufferRenderbuffer = glad_trace_glNamedFramebufferRenderbuffer;
+	}
+	if (glad_glNamedFramebufferParameteri != NULL && glad_glNamedFramebufferParameteri != glad_trace_glNamedFramebufferParameteri) {
+		glad_trace_next_glNamedFramebufferParameteri = glad_glNamedFramebufferParameteri;
+		glad_glNamedFramebufferParameteri = glad_trace_glNamedFramebufferParameteri;
+	}
+	if (glad_glNamedFramebufferTexture != NULL && glad_glNamedFramebufferTexture != glad_trace_glNamedFramebufferTexture) {
+		glad_trace_next_glNamedFramebufferTexture = glad_glNamedFramebufferTexture;
+		glad_glNamedFramebufferTexture = glad_trace_glNamedFramebufferTexture;
+	}
+	if (glad_glNamedFramebufferTextureLayer != NULL && glad_glNamedFramebufferTextureLayer != glad_trace_glNamedFramebufferTextureLayer) {
+		glad_trace_next_glNamedFramebufferTextureLayer = glad_glNamedFramebufferTextureLayer;
+		glad_glNamedFramebufferTextureLayer = glad_trace_glNamedFramebufferTextureLayer;
+	}
+	if (glad_glNamedFramebufferDrawBuffer != NULL && glad_glNamedFramebufferDrawBuffer != glad_trace_glNamedFramebufferDrawBuffer) {
+		glad_trace_next_glNamedFramebufferDrawBuffer = glad_glNamedFramebufferDrawBuffer;
+		glad_glNamedFramebufferDrawBuffer = glad_trace_glNamedFramebufferDrawBuffer;
+	}
+	if (glad_glNamedFramebufferDrawBuffers != NULL && glad_glNamedFramebufferDrawBuffers != glad_trace_glNamedFramebufferDrawBuffers) {
+		glad_trace_next_glNamedFramebufferDrawBuffers = glad_glNamedFramebufferDrawBuffers;
+		glad_glNamedFramebufferDrawBuffers = glad_trace_glNamedFramebufferDrawBuffers;
+	}
+	if (glad_glNamedFramebufferReadBuffer != NULL && glad_glNamedFramebufferReadBuffer != glad_trace_glNamedFramebufferReadBuffer) {
+		glad_trace_next_glNamedFramebufferReadBuffer = glad_glNamedFramebufferReadBuffer;
+		glad_glNamedFramebufferReadBuffer = glad_trace_glNamedFramebufferReadBuffer;
+	}
+	if (glad_glInvalidateNamedFramebufferData != NULL && glad_glInvalidateNamedFramebufferData != glad_trace_glInvalidateNamedFramebufferData) {
+		glad_trace_next_glInvalidateNamedFramebufferData = glad_glInvalidateNamedFramebufferData;
+		glad_glInvalidateNamedFramebufferData = glad_trace_glInvalidateNamedFramebufferData;
+	}
+	if (glad_glInvalidateNamedFramebufferSubData != NULL && glad_glInvalidateNamedFramebufferSubData != glad_trace_glInvalidateNamedFramebufferSubData) {
+		glad_trace_next_glInvalidateNamedFramebufferSubData = glad_glInvalidateNamedFramebufferSubData;
+		glad_glInvalidateNamedFramebufferSubData = glad_trace_glInvalidateNamedFramebufferSubData;
+	}
+	if (glad_glClearNamedFramebufferiv != NULL && glad_glClearNamedFramebufferiv != glad_trace_glClearNamedFramebufferiv) {
+		glad_trace_next_glClearNamedFramebufferiv = glad_glClearNamedFramebufferiv;
+		glad_glClearNamedFramebufferiv = glad_trace_glClearNamedFramebufferiv;
+	}
+	if (glad_glClearNamedFramebufferuiv != NULL && glad_glClearNamedFramebufferuiv != glad_trace_glClearNamedFramebufferuiv) {
+		glad_trace_next_glClearNamedFramebufferuiv = glad_glClearNamedFramebufferuiv;
+		glad_glClearNamedFramebufferuiv = glad_trace_glClearNamedFramebufferuiv;
+	}
+	if (glad_glClearNamedFramebufferfv != NULL && glad_glClearNamedFramebufferfv != glad_trace_glClearNamedFramebufferfv) {
+		glad_trace_next_glClearNamedFramebufferfv = glad_glClearNamedFramebufferfv;
+		glad_glClearNamedFramebufferfv = glad_trace_glClearNamedFramebufferfv;
+	}
+	if (glad_glClearNamedFramebufferfi != NULL && glad_glClearNamedFramebufferfi != glad_trace_glClearNamedFramebufferfi) {
+		glad_trace_next_glClearNamedFramebufferfi = glad_glClearNamedFramebufferfi;
+		glad_glClearNamedFramebufferfi = glad_trace_glClearNamedFramebufferfi;
+	}
+	if (glad_glBlitNamedFramebuffer != NULL && glad_glBlitNamedFramebuffer != glad_trace_glBlitNamedFramebuffer) {
+		glad_trace_next_glBlitNamedFramebuffer = glad_glBlitNamedFramebuffer;
+		glad_glBlitNamedFramebuffer = glad_trace_glBlitNamedFramebuffer;
+	}
+	if (glad_glCreateRenderbuffers != NULL && glad_glCreateRenderbuffers != glad_trace_glCreateRenderbuffers) {
+		glad_trace_next_glCreateRenderbuffers = glad_glCreateRenderbuffers;
+		glad_glCreateRenderbuffers = glad_trace_glCreateRenderbuffers;
+	}
+	if (glad_glNamedRenderbufferStorage != NULL && glad_glNamedRenderbufferStorage != glad_trace_glNamedRenderbufferStorage) {
+		glad_trace_next_glNamedRenderbufferStorage = glad_glNamedRenderbufferStorage;
+		glad_glNamedRenderbufferStorage = glad_trace_glNamedRenderbufferStorage;
+	}
+	if (glad_glNamedRenderbufferStorageMultisample != NULL && glad_glNamedRenderbufferStorageMultisample != glad_trace_glNamedRenderbufferStorageMultisample) {
+		glad_trace_next_glNamedRenderbufferStorageMultisample = glad_glNamedRenderbufferStorageMultisample;
+		glad_glNamedRenderbufferStorageMultisample = glad_trace_glNamedRenderbufferStorageMultisample;
+	}
+	if (glad_glCreateTextures != NULL && glad_glCreateTextures != glad_trace_glCreateTextures) {
+		glad_trace_next_glCreateTextures = glad_glCreateTextures;
+		glad_glCreateTextures = glad_trace_glCreateTextures;
+	}
+	if (glad_glTextureBuffer != NULL && glad_glTextureBuffer != glad_trace_glTextureBuffer) {
+		glad_trace_next_glTextureBuffer = glad_glTextureBuffer;
+		glad_glTextureBuffer = glad_trace_glTextureBuffer;
+	}
+	if (glad_glTextureBufferRange != NULL && glad_glTextureBufferRange != glad_trace_glTextureBufferRange) {
+		glad_trace_next_glTextureBufferRange = glad_glTextureBufferRange;
+		glad_glTextureBufferRange = glad_trace_glTextureBufferRange;
+	}
+	if (glad_glTextureStorage1D != NULL && glad_glTextureStorage1D != glad_trace_glTextureStorage1D) {
+		glad_trace_next_glTextureStorage1D = glad_glTextureStorage1D;
+		glad_glTextureStorage1D = glad_trace_glTextureStorage1D;
+	}
+	if (glad_glTextureStorage2D != NULL && glad_glTextureStorage2D != glad_trace_glTextureStorage2D) {
+		glad_trace_next_glTextureStorage2D = glad_glTextureStorage2D;
+		glad_glTextureStorage2D = glad_trace_glTextureStorage2D;
+	}
+	if (glad_glTextureStorage3D != NULL && glad_glTextureStorage3D != glad_trace_glTextureStorage3D) {
+		glad_trace_next_glTextureStorage3D = glad_glTextureStorage3D;
+		glad_glTextureStorage3D = glad_trace_glTextureStorage3D;
+	}
+	if (glad_glTextureStorage2DMultisample != NULL && glad_glTextureStorage2DMultisample != glad_trace_glTextureStorage2DMultisample) {
+		glad_trace_next_glTextureStorage2DMultisample = glad_glTextureStorage2DMultisample;
+		glad_glTextureStorage2DMultisample = glad_trace_glTextureStorage2DMultisample;
+	}
+	if (glad_glTextureStorage3DMultisample != NULL && glad_glTextureStorage3DMultisample != glad_trace_glTextureStorage3DMultisample) {
+		glad_trace_next_glTextureStorage3DMultisample = glad_glTextureStorage3DMultisample;
+		glad_glTextureStorage3DMultisample = glad_trace_glTextureStorage3DMultisample;
+	}
+	if (glad_glTextureSubImage1D != NULL && glad_glTextureSubImage1D != glad_trace_glTextureSubImage1D) {
+		glad_trace_next_glTextureSubImage1D = glad_glTextureSubImage1D;
+		glad_glTextureSubImage1D = glad_trace_glTextureSubImage1D;
+	}
+	if (glad_glTextureSubImage2D != NULL && glad_glTextureSubImage2D != glad_trace_glTextureSubImage2D) {
+		glad_trace_next_glTextureSubImage2D = glad_glTextureSubImage2D;
+		glad_glTextureSubImage2D = glad_trace_glTextureSubImage2D;
+	}
+	if (glad_glTextureSubImage3D != NULL && glad_glTextureSubImage3D != glad_trace_glTextureSubImage3D) {
+		glad_trace_next_glTextureSubImage3D = glad_glTextureSubImage3D;
+		glad_glTextureSubImage3D = glad_trace_glTextureSubImage3D;
+	}
+	if (glad_glCompressedTextureSubImage1D != NULL && glad_glCompressedTextureSubImage1D != glad_trace_glCompressedTextureSubImage1D) {
+		glad_trace_next_glCompressedTextureSubImage1D = glad_glCompressedTextureSubImage1D;
+		glad_glCompressedTextureSubImage1D = glad_trace_glCompressedTextureSubImage1D;
+	}
+	if (glad_glCompressedTextureSubImage2D != NULL && glad_glCompressedTextureSubImage2D != glad_trace_glCompressedTextureSubImage2D) {
+		glad_trace_next_glCompressedTextureSubImage2D = glad_glCompressedTextureSubImage2D;
+		glad_glCompressedTextureSubImage2D = glad_trace_glCompressedTextureSubImage2D;
+	}
+	if (glad_glCompressedTextureSubImage3D != NULL && glad_glCompressedTextureSubImage3D != glad_trace_glCompressedTextureSubImage3D) {
+		glad_trace_next_glCompressedTextureSubImage3D = glad_glCompressedTextureSubImage3D;
+		glad_glCompressedTextureSubImage3D = glad_trace_glCompressedTextureSubImage3D;
+	}
+	if (glad_glCopyTextureSubImage1D != NULL && glad_glCopyTextureSubImage1D != glad_trace_glCopyTextureSubImage1D) {
+		glad_trace_next_glCopyTextureSubImage1D = glad_glCopyTextureSubImage1D;
+		glad_glCopyTextureSubImage1D = glad_trace_glCopyTextureSubImage1D;
+	}
+	if (glad_glCopyTextureSubImage2D != NULL && glad_glCopyTextureSubImage2D != glad_trace_glCopyTextureSubImage2D) {
+		glad_trace_next_glCopyTextureSubImage2D = glad_glCopyTextureSubImage2D;
+		glad_glCopyTextureSubImage2D = glad_trace_glCopyTextureSubImage2D;
+	}
+	if (glad_glCopyTextureSubImage3D != NULL && glad_glCopyTextureSubImage3D != glad_trace_glCopyTextureSubImage3D) {
+		glad_trace_next_glCopyTextureSubImage3D = glad_glCopyTextureSubImage3D;
+		glad_glCopyTextureSubImage3D = glad_trace_glCopyTextureSubImage3D;
+	}
+	if (glad_glTextureParameterf != NULL && glad_glTextureParameterf != glad_trace_glTextureParameterf) {
+		glad_trace_next_glTextureParameterf = glad_glTextureParameterf;
+		glad_glTextureParameterf = glad_trace_glTextureParameterf;
+	}
+	if (glad_glTextureParameterfv != NULL && glad_glTextureParameterfv != glad_trace_glTextureParameterfv) {
+		glad_trace_next_glTextureParameterfv = glad_glTextureParameterfv;
+		glad_glTextureParameterfv = glad_trace_glTextureParameterfv;
+	}
+	if (glad_glTextureParameteri != NULL && glad_glTextureParameteri != glad_trace_glTextureParameteri) {
+		glad_trace_next_glTextureParameteri = glad_glTextureParameteri;
+		glad_glTextureParameteri = glad_trace_glTextureParameteri;
+	}
+	if (glad_glTextureParameterIiv != NULL && glad_glTextureParameterIiv != glad_trace_glTextureParameterIiv) {
+		glad_trace_next_glTextureParameterIiv = glad_glTextureParameterIiv;
+		glad_glTextureParameterIiv = glad_trace_glTextureParameterIiv;
+	}
+	if (glad_glTextureParameterIuiv != NULL && glad_glTextureParameterIuiv != glad_trace_glTextureParameterIuiv) {
+		glad_trace_next_glTextureParameterIuiv = glad_glTextureParameterIuiv;
+		glad_glTextureParameterIuiv = glad_trace_glTextureParameterIuiv;
+	}
+	if (glad_glTextureParameteriv != NULL && glad_glTextureParameteriv != glad_trace_glTextureParameteriv) {
+		glad_trace_next_glTextureParameteriv = glad_glTextureParameteriv;
+		glad_glTextureParameteriv = glad_trace_glTextureParameteriv;
+	}
+	if (glad_glGenerateTextureMipmap != NULL && glad_glGenerateTextureMipmap != glad_trace_glGenerateTextureMipmap) {
+		glad_trace_next_glGenerateTextureMipmap = glad_glGenerateTextureMipmap;
+		glad_glGenerateTextureMipmap = glad_trace_glGenerateTextureMipmap;
+	}
+	if (glad_glBindTextureUnit != NULL && glad_glBindTextureUnit != glad_trace_glBindTextureUnit) {
+		glad_trace_next_glBindTextureUnit = glad_glBindTextureUnit;
+		glad_glBindTextureUnit = glad_trace_glBindTextureUnit;
+	}
+	if (glad_glCreateVertexArrays != NULL && glad_glCreateVertexArrays != glad_trace_glCreateVertexArrays) {
+		glad_trace_next_glCreateVertexArrays = glad_glCreateVertexArrays;
+		glad_glCreateVertexArrays = glad_trace_glCreateVertexArrays;
+	}
+	if (glad_glDisableVertexArrayAttrib != NULL && glad_glDisableVertexArrayAttrib != glad_trace_glDisableVertexArrayAttrib) {
+		glad_trace_next_glDisableVertexArrayAttrib = glad_glDisableVertexArrayAttrib;
+		glad_glDisableVertexArrayAttrib = glad_trace_glDisableVertexArrayAttrib;
+	}
+	if (glad_glEnableVertexArrayAttrib != NULL && glad_glEnableVertexArrayAttrib != glad_trace_glEnableVertexArrayAttrib) {
+		glad_trace_next_glEnableVertexArrayAttrib = glad_glEnableVertexArrayAttrib;
+		glad_glEnableVertexArrayAttrib = glad_trace_glEnableVertexArrayAttrib;
+	}
+	if (glad_glVertexArrayElementBuffer != NULL && glad_glVertexArrayElementBuffer != glad_trace_glVertexArrayElementBuffer) {
+		glad_trace_next_glVertexArrayElementBuffer = glad_glVertexArrayElementBuffer;
+		glad_glVertexArrayElementBuffer = glad_trace_glVertexArrayElementBuffer;
+	}
+	if (glad_glVertexArrayVertexBuffer != NULL && glad_glVertexArrayVertexBuffer != glad_trace_glVertexArrayVertexBuffer) {
+		glad_trace_next_glVertexArrayVertexBuffer = glad_glVertexArrayVertexBuffer;
+		glad_glVertexArrayVertexBuffer = glad_trace_glVertexArrayVertexBuffer;
+	}
+	if (glad_glVertexArrayVertexBuffers != NULL && glad_glVertexArrayVertexBuffers != glad_trace_glVertexArrayVertexBuffers) {
+		glad_trace_next_glVertexArrayVertexBuffers = glad_glVertexArrayVertexBuffers;
+		glad_glVertexArrayVertexBuffers = glad_trace_glVertexArrayVertexBuffers;
+	}
+	if (glad_glVertexArrayAttribBinding != NULL && glad_glVertexArrayAttribBinding != glad_trace_glVertexArrayAttribBinding) {
+		glad_trace_next_glVertexArrayAttribBinding = glad_glVertexArrayAttribBinding;
+		glad_glVertexArrayAttribBinding = glad_trace_glVertexArrayAttribBinding;
+	}
+	if (glad_glVertexArrayAttribFormat != NULL && glad_glVertexArrayAttribFormat != glad_trace_glVertexArrayAttribFormat) {
+		glad_trace_next_glVertexArrayAttribFormat = glad_glVertexArrayAttribFormat;
+		glad_glVertexArrayAttribFormat = glad_trace_glVertexArrayAttribFormat;
+	}
+	if (glad_glVertexArrayAttribIFormat != NULL && glad_glVertexArrayAttribIFormat != glad_trace_glVertexArrayAttribIFormat) {
+		glad_trace_next_glVertexArrayAttribIFormat = glad_glVertexArrayAttribIFormat;
+		glad_glVertexArrayAttribIFormat = glad_trace_glVertexArrayAttribIFormat;
+	}
+	if (glad_glVertexArrayAttribLFormat != NULL && glad_glVertexArrayAttribLFormat != glad_trace_glVertexArrayAttribLFormat) {
+		glad_trace_next_glVertexArrayAttribLFormat = glad_glVertexArrayAttribLFormat;
+		glad_glVertexArrayAttribLFormat = glad_trace_glVertexArrayAttribLFormat;
+	}
+	if (glad_glVertexArrayBindingDivisor != NULL && glad_glVertexArrayBindingDivisor != glad_trace_glVertexArrayBindingDivisor) {
+		glad_trace_next_glVertexArrayBindingDivisor = glad_glVertexArrayBindingDivisor;
+		glad_glVertexArrayBindingDivisor = glad_trace_glVertexArrayBindingDivisor;
+	}
+	if (glad_glCreateSamplers != NULL && glad_glCreateSamplers != glad_trace_glCreateSamplers) {
+		glad_trace_next_glCreateSamplers = glad_glCreateSamplers;
+		glad_glCreateSamplers = glad_trace_glCreateSamplers;
+	}
+	if (glad_glCreateProgramPipelines != NULL && glad_glCreateProgramPipelines != glad_trace_glCreateProgramPipelines) {
+		glad_trace_next_glCreateProgramPipelines = glad_glCreateProgramPipelines;
+		glad_glCreateProgramPipelines = glad_trace_glCreateProgramPipelines;
+	}
+	if (glad_glCreateQueries != NULL && glad_glCreateQueries != glad_trace_glCreateQueries) {
+		glad_trace_next_glCreateQueries = glad_glCreateQueries;
+		glad_glCreateQueries = glad_trace_glCreateQueries;
+	}
+	if (glad_glMemoryBarrierByRegion != NULL && glad_glMemoryBarrierByRegion != glad_trace_glMemoryBarrierByRegion) {
+		glad_trace_next_glMemoryBarrierByRegion = glad_glMemoryBarrierByRegion;
+		glad_glMemoryBarrierByRegion = glad_trace_glMemoryBarrierByRegion;
+	}
+	if (glad_glReadnPixels != NULL && glad_glReadnPixels != glad_trace_glReadnPixels) {
+		glad_trace_next_glReadnPixels = glad_glReadnPixels;
+		glad_glReadnPixels = glad_trace_glReadnPixels;
+	}
+	if (glad_glTextureBarrier != NULL && glad_glTextureBarrier != glad_trace_glTextureBarrier) {
+		glad_trace_next_glTextureBarrier = glad_glTextureBarrier;
+		glad_glTextureBarrier = glad_trace_glTextureBarrier;
+	}
+}
+
+void gladTraceUninstall(void) {
+	if (glad_glCullFace == glad_trace_glCullFace) glad_glCullFace = glad_trace_next_glCullFace;
+	if (glad_glFrontFace == glad_trace_glFrontFace) glad_glFrontFace = glad_trace_next_glFrontFace;
+	if (glad_glHint == glad_trace_glHint) glad_glHint = glad_trace_next_glHint;
+	if (glad_glLineWidth == glad_trace_glLineWidth) glad_glLineWidth = glad_trace_next_glLineWidth;
+	if (glad_glPointSize == glad_trace_glPointSize) glad_glPointSize = glad_trace_next_glPointSize;
+	if (glad_glPolygonMode == glad_trace_glPolygonMode) glad_glPolygonMode = glad_trace_next_glPolygonMode;
+	if (glad_glScissor == glad_trace_glScissor) glad_glScissor = glad_trace_next_glScissor;
+	if (glad_glTexParameterf == glad_trace_glTexParameterf) glad_glTexParameterf = glad_trace_next_glTexParameterf;
+	if (glad_glTexParameterfv == glad_trace_glTexParameterfv) glad_glTexParameterfv = glad_trace_next_glTexParameterfv;
+	if (glad_glTexParameteri == glad_trace_glTexParameteri) glad_glTexParameteri = glad_trace_next_glTexParameteri;
+	if (glad_glTexParameteriv == glad_trace_glTexParameteriv) glad_glTexParameteriv = glad_trace_next_glTexParameteriv;
+	if (glad_glTexImage1D == glad_trace_glTexImage1D) glad_glTexImage1D = glad_trace_next_glTexImage1D;
+	if (glad_glTexImage2D == glad_trace_glTexImage2D) glad_glTexImage2D = glad_trace_next_glTexImage2D;
+	if (glad_glDrawBuffer == glad_trace_glDrawBuffer) glad_glDrawBuffer = glad_trace_next_glDrawBuffer;
+	if (glad_glClear == glad_trace_glClear) glad_glClear = glad_trace_next_glClear;
+	if (glad_glClearColor == glad_trace_glClearColor) glad_glClearColor = glad_trace_next_glClearColor;
+	if (glad_glClearStencil == glad_trace_glClearStencil) glad_glClearStencil = glad_trace_next_glClearStencil;
+	if (glad_glClearDepth == glad_trace_glClearDepth) glad_glClearDepth = glad_trace_next_glClearDepth;
+	if (glad_glStencilMask == glad_trace_glStencilMask) glad_glStencilMask = glad_trace_next_glStencilMask;
+	if (glad_glColorMask == glad_trace_glColorMask) glad_glColorMask = glad_trace_next_glColorMask;
+	if (glad_glDepthMask == glad_trace_glDepthMask) glad_glDepthMask = glad_trace_next_glDepthMask;
+	if (glad_glDisable == glad_trace_glDisable) glad_glDisable = glad_trace_next_glDisable;
+	if (glad_glEnable == glad_trace_glEnable) glad_glEnable = glad_trace_next_glEnable;
+	if (glad_glFinish == glad_trace_glFinish) glad_glFinish = glad_trace_next_glFinish;
+	if (glad_glFlush == glad_trace_glFlush) glad_glFlush = glad_trace_next_glFlush;
+	if (glad_glBlendFunc == glad_trace_glBlendFunc) glad_glBlendFunc = glad_trace_next_glBlendFunc;
+	if (glad_glLogicOp == glad_trace_glLogicOp) glad_glLogicOp = glad_trace_next_glLogicOp;
+	if (glad_glStencilFunc == glad_trace_glStencilFunc) glad_glStencilFunc = glad_trace_next_glStencilFunc;
+	if (glad_glStencilOp == glad_trace_glStencilOp) glad_glStencilOp = glad_trace_next_glStencilOp;
+	if (glad_glDepthFunc == glad_trace_glDepthFunc) glad_glDepthFunc = glad_trace_next_glDepthFunc;
+	if (glad_glPixelStoref == glad_trace_glPixelStoref) glad_glPixelStoref = glad_trace_next_glPixelStoref;
+	if (glad_glPixelStorei == glad_trace_glPixelStorei) glad_glPixelStorei = glad_trace_next_glPixelStorei;
+	if (glad_glReadBuffer == glad_trace_glReadBuffer) glad_glReadBuffer = glad_trace_next_glReadBuffer;
+	if (glad_glReadPixels == glad_trace_glReadPixels) glad_glReadPixels = glad_trace_next_glReadPixels;
+	if (glad_glDepthRange == glad_trace_glDepthRange) glad_glDepthRange = glad_trace_next_glDepthRange;
+	if (glad_glViewport == glad_trace_glViewport) glad_glViewport = glad_trace_next_glViewport;
+	if (glad_glDrawArrays == glad_trace_glDrawArrays) glad_glDrawArrays = glad_trace_next_glDrawArrays;
+	if (glad_glDrawElements == glad_trace_glDrawElements) glad_glDrawElements = glad_trace_next_glDrawElements;
+	if (glad_glPolygonOffset == glad_trace_glPolygonOffset) glad_glPolygonOffset = glad_trace_next_glPolygonOffset;
+	if (glad_glCopyTexImage1D == glad_trace_glCopyTexImage1D) glad_glCopyTexImage1D = glad_trace_next_glCopyTexImage1D;
+	if (glad_glCopyTexImage2D == glad_trace_glCopyTexImage2D) glad_glCopyTexImage2D = glad_trace_next_glCopyTexImage2D;
+	if (glad_glCopyTexSubImage1D == glad_trace_glCopyTexSubImage1D) glad_glCopyTexSubImage1D = glad_trace_next_glCopyTexSubImage1D;
+	if (glad_glCopyTexSubImage2D == glad_trace_glCopyTexSubImage2D) glad_glCopyTexSubImage2D = glad_trace_next_glCopyTexSubImage2D;
+	if (glad_glTexSubImage1D == glad_trace_glTexSubImage1D) glad_glTexSubImage1D = glad_trace_next_glTexSubImage1D;
+	if (glad_glTexSubImage2D == glad_trace_glTexSubImage2D) glad_glTexSubImage2D = glad_trace_next_glTexSubImage2D;
+	if (glad_glBindTexture == glad_trace_glBindTexture) glad_glBindTexture = glad_trace_next_glBindTexture;
+	if (glad_glDeleteTextures == glad_trace_glDeleteTextures) glad_glDeleteTextures = glad_trace_next_glDeleteTextures;
+	if (glad_glGenTextures == glad_trace_glGenTextures) glad_glGenTextures = glad_trace_next_glGenTextures;
+	if (glad_glDrawRangeElements == glad_trace_glDrawRangeElements) glad_glDrawRangeElements = glad_trace_next_glDrawRangeElements;
+	if (glad_glTexImage3D == glad_trace_glTexImage3D) glad_glTexImage3D = glad_trace_next_glTexImage3D;
+	if (glad_glTexSubImage3D == glad_trace_glTexSubImage3D) glad_glTexSubImage3D = glad_trace_next_glTexSubImage3D;
+	if (glad_glCopyTexSubImage3D == glad_trace_glCopyTexSubImage3D) glad_glCopyTexSubImage3D = glad_trace_next_glCopyTexSubImage3D;
+	if (glad_glActiveTexture == glad_trace_glActiveTexture) glad_glActiveTexture = glad_trace_next_glActiveTexture;
+	if (glad_glSampleCoverage == glad_trace_glSampleCoverage) glad_glSampleCoverage = glad_trace_next_glSampleCoverage;
+	if (glad_glCompressedTexImage3D == glad_trace_glCompressedTexImage3D) glad_glCompressedTexImage3D = glad_trace_next_glCompressedTexImage3D;
+	if (glad_glCompressedTexImage2D == glad_trace_glCompressedTexImage2D) glad_glCompressedTexImage2D = glad_trace_next_glCompressedTexImage2D;
+	if (glad_glCompressedTexImage1D == glad_trace_glCompressedTexImage1D) glad_glCompressedTexImage1D = glad_trace_next_glCompressedTexImage1D;
+	if (glad_glCompressedTexSubImage3D == glad_trace_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D = glad_trace_next_glCompressedTexSubImage3D;
+	if (glad_glCompressedTexSubImage2D == glad_trace_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D = glad_trace_next_glCompressedTexSubImage2D;
+	if (glad_glCompressedTexSubImage1D == glad_trace_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D = glad_trace_next_glCompressedTexSubImage1D;
+	if (glad_glBlendFuncSeparate == glad_trace_glBlendFuncSeparate) glad_glBlendFuncSeparate = glad_trace_next_glBlendFuncSeparate;
+	if (glad_glMultiDrawArrays == glad_trace_glMultiDrawArrays) glad_glMultiDrawArrays = glad_trace_next_glMultiDrawArrays;
+	if (glad_glMultiDrawElements == glad_trace_glMultiDrawElements) glad_glMultiDrawElements = glad_trace_next_glMultiDrawElements;
+	if (glad_glPointParameterf == glad_trace_glPointParameterf) glad_glPointParameterf = glad_trace_next_glPointParameterf;
+	if (glad_glPointParameterfv == glad_trace_glPointParameterfv) glad_glPointParameterfv = glad_trace_next_glPointParameterfv;
+	if (glad_glPointParameteri == glad_trace_glPointParameteri) glad_glPointParameteri = glad_trace_next_glPointParameteri;
+	if (glad_glPointParameteriv == glad_trace_glPointParameteriv) glad_glPointParameteriv = glad_trace_next_glPointParameteriv;
+	if (glad_glBlendColor == glad_trace_glBlendColor) glad_glBlendColor = glad_trace_next_glBlendColor;
+	if (glad_glBlendEquation == glad_trace_glBlendEquation) glad_glBlendEquation = glad_trace_next_glBlendEquation;
+	if (glad_glGenQueries == glad_trace_glGenQueries) glad_glGenQueries = glad_trace_next_glGenQueries;
+	if (glad_glDeleteQueries == glad_trace_glDeleteQueries) glad_glDeleteQueries = glad_trace_next_glDeleteQueries;
+	if (glad_glBeginQuery == glad_trace_glBeginQuery) glad_glBeginQuery = glad_trace_next_glBeginQuery;
+	if (glad_glEndQuery == glad_trace_glEndQuery) glad_glEndQuery = glad_trace_next_glEndQuery;
+	if (glad_glBindBuffer == glad_trace_glBindBuffer) glad_glBindBuffer = glad_trace_next_glBindBuffer;
+	if (glad_glDeleteBuffers == glad_trace_glDeleteBuffers) glad_glDeleteBuffers = glad_trace_next_glDeleteBuffers;
+	if (glad_glGenBuffers == glad_trace_glGenBuffers) glad_glGenBuffers = glad_trace_next_glGenBuffers;
+	if (glad_glBufferData == glad_trace_glBufferData) glad_glBufferData = glad_trace_next_glBufferData;
+	if (glad_glBufferSubData == glad_trace_glBufferSubData) glad_glBufferSubData = glad_trace_next_glBufferSubData;
+	if (glad_glMapBuffer == glad_trace_glMapBuffer) glad_glMapBuffer = glad_trace_next_glMapBuffer;
+	if (glad_glUnmapBuffer == glad_trace_glUnmapBuffer) glad_glUnmapBuffer = glad_trace_next_glUnmapBuffer;
+	if (glad_glBlendEquationSeparate == glad_trace_glBlendEquationSeparate) glad_glBlendEquationSeparate = glad_trace_next_glBlendEquationSeparate;
+	if (glad_glDrawBuffers == glad_trace_glDrawBuffers) glad_glDrawBuffers = glad_trace_next_glDrawBuffers;
+	if (glad_glStencilOpSeparate == glad_trace_glStencilOpSeparate) glad_glStencilOpSeparate = glad_trace_next_glStencilOpSeparate;
+	if (glad_glStencilFuncSeparate == glad_trace_glStencilFuncSeparate) glad_glStencilFuncSeparate = glad_trace_next_glStencilFuncSeparate;
+	if (glad_glStencilMaskSeparate == glad_trace_glStencilMaskSeparate) glad_glStencilMaskSeparate = glad_trace_next_glStencilMaskSeparate;
+	if (glad_glAttachShader == glad_trace_glAttachShader) glad_glAttachShader = glad_trace_next_glAttachShader;
+	if (glad_glBindAttribLocation == glad_trace_glBindAttribLocation) glad_glBindAttribLocation = glad_trace_next_glBindAttribLocation;
+	if (glad_glCompileShader == glad_trace_glCompileShader) glad_glCompileShader = glad_trace_next_glCompileShader;
+	if (glad_glCreateProgram == glad_trace_glCreateProgram) glad_glCreateProgram = glad_trace_next_glCreateProgram;
+	if (glad_glCreateShader == glad_trace_glCreateShader) glad_glCreateShader = glad_trace_next_glCreateShader;
+	if (glad_glDeleteProgram == glad_trace_glDeleteProgram) glad_glDeleteProgram = glad_trace_next_glDeleteProgram;
+	if (glad_glDeleteShader == glad_trace_glDeleteShader) glad_glDeleteShader = glad_trace_next_glDeleteShader;
+	if (glad_glDetachShader == glad_trace_glDetachShader) glad_glDetachShader = glad_trace_next_glDetachShader;
+	if (glad_glDisableVertexAttribArray == glad_trace_glDisableVertexAttribArray) glad_glDisableVertexAttribArray = glad_trace_next_glDisableVertexAttribArray;
+	if (glad_glEnableVertexAttribArray == glad_trace_glEnableVertexAttribArray) glad_glEnableVertexAttribArray = glad_trace_next_glEnableVertexAttribArray;
+	if (glad_glLinkProgram == glad_trace_glLinkProgram) glad_glLinkProgram = glad_trace_next_glLinkProgram;
+	if (glad_glShaderSource == glad_trace_glShaderSource) glad_glShaderSource = glad_trace_next_glShaderSource;
+	if (glad_glUseProgram == glad_trace_glUseProgram) glad_glUseProgram = glad_trace_next_glUseProgram;
+	if (glad_glUniform1f == glad_trace_glUniform1f) glad_glUniform1f = glad_trace_next_glUniform1f;
+	if (glad_glUniform2f == glad_trace_glUniform2f) glad_glUniform2f = glad_trace_next_glUniform2f;
+	if (glad_glUniform3f == glad_trace_glUniform3f) glad_glUniform3f = glad_trace_next_glUniform3f;
+	if (glad_glUniform4f == glad_trace_glUniform4f) glad_glUniform4f = glad_trace_next_glUniform4f;
+	if (glad_glUniform1i == glad_trace_glUniform1i) glad_glUniform1i = glad_trace_next_glUniform1i;
+	if (glad_glUniform2i == glad_trace_glUniform2i) glad_glUniform2i = glad_trace_next_glUniform2i;
+	if (glad_glUniform3i == glad_trace_glUniform3i) glad_glUniform3i = glad_trace_next_glUniform3i;
+	if (glad_glUniform4i == glad_trace_glUniform4i) glad_glUniform4i = glad_trace_next_glUniform4i;
+	if (glad_glUniform1fv == glad_trace_glUniform1fv) glad_glUniform1fv = glad_trace_next_glUniform1fv;
+	if (glad_glUniform2fv == glad_trace_glUniform2fv) glad_glUniform2fv = glad_trace_next_glUniform2fv;
+	if (glad_glUniform3fv == glad_trace_glUniform3fv) glad_glUniform3fv = glad_trace_next_glUniform3fv;
+	if (glad_glUniform4fv == glad_trace_glUniform4fv) glad_glUniform4fv = glad_trace_next_glUniform4fv;
+	if (glad_glUniform1iv == glad_trace_glUniform1iv) glad_glUniform1iv = glad_trace_next_glUniform1iv;
+	if (glad_glUniform2iv == glad_trace_glUniform2iv) glad_glUniform2iv = glad_trace_next_glUniform2iv;
+	if (glad_glUniform3iv == glad_trace_glUniform3iv) glad_glUniform3iv = glad_trace_next_glUniform3iv;
+	if (glad_glUniform4iv == glad_trace_glUniform4iv) glad_glUniform4iv = glad_trace_next_glUniform4iv;
+	if (glad_glUniformMatrix2fv == glad_trace_glUniformMatrix2fv) glad_glUniformMatrix2fv = glad_trace_next_glUniformMatrix2fv;
+	if (glad_glUniformMatrix3fv == glad_trace_glUniformMatrix3fv) glad_glUniformMatrix3fv = glad_trace_next_glUniformMatrix3fv;
+	if (glad_glUniformMatrix4fv == glad_trace_glUniformMatrix4fv) glad_glUniformMatrix4fv = glad_trace_next_glUniformMatrix4fv;
+	if (glad_glValidateProgram == glad_trace_glValidateProgram) glad_glValidateProgram = glad_trace_next_glValidateProgram;
+	if (glad_glVertexAttrib1d == glad_trace_glVertexAttrib1d) glad_glVertexAttrib1d = glad_trace_next_glVertexAttrib1d;
+	if (glad_glVertexAttrib1dv == glad_trace_glVertexAttrib1dv) glad_glVertexAttrib1dv = glad_trace_next_glVertexAttrib1dv;
+	if (glad_glVertexAttrib1f == glad_trace_glVertexAttrib1f) glad_glVertexAttrib1f = glad_trace_next_glVertexAttrib1f;
+	if (glad_glVertexAttrib1fv == glad_trace_glVertexAttrib1fv) glad_glVertexAttrib1fv = glad_trace_next_glVertexAttrib1fv;
+	if (glad_glVertexAttrib1s == glad_trace_glVertexAttrib1s) glad_glVertexAttrib1s = glad_trace_next_glVertexAttrib1s;
+	if (glad_glVertexAttrib1sv == glad_trace_glVertexAttrib1sv) glad_glVertexAttrib1sv = glad_trace_next_glVertexAttrib1sv;
+	if (glad_glVertexAttrib2d == glad_trace_glVertexAttrib2d) glad_glVertexAttrib2d = glad_trace_next_glVertexAttrib2d;
+	if (glad_glVertexAttrib2dv == glad_trace_glVertexAttrib2dv) glad_glVertexAttrib2dv = glad_trace_next_glVertexAttrib2dv;
+	if (glad_glVertexAttrib2f == glad_trace_glVertexAttrib2f) glad_glVertexAttrib2f = glad_trace_next_glVertexAttrib2f;
+	if (glad_glVertexAttrib2fv == glad_trace_glVertexAttrib2fv) glad_glVertexAttrib2fv = glad_trace_next_glVertexAttrib2fv;
+	if (glad_glVertexAttrib2s == glad_trace_glVertexAttrib2s) glad_glVertexAttrib2s = glad_trace_next_glVertexAttrib2s;
+	if (glad_glVertexAttrib2sv == glad_trace_glVertexAttrib2sv) glad_glVertexAttrib2sv = glad_trace_next_glVertexAttrib2sv;
+	if (glad_glVertexAttrib3d == glad_trace_glVertexAttrib3d) glad_glVertexAttrib3d = glad_trace_next_glVertexAttrib3d;
+	if (glad_glVertexAttrib3dv == glad_trace_glVertexAttrib3dv) glad_glVertexAttrib3dv = glad_trace_next_glVertexAttrib3dv;
+	if (glad_glVertexAttrib3f == glad_trace_glVertexAttrib3f) glad_glVertexAttrib3f = glad_trace_next_glVertexAttrib3f;
+	if (glad_glVertexAttrib3fv == glad_trace_glVertexAttrib3fv) glad_glVertexAttrib3fv = glad_trace_next_glVertexAttrib3fv;
+	if (glad_glVertexAttrib3s == glad_trace_glVertexAttrib3s) glad_glVertexAttrib3s = glad_trace_next_glVertexAttrib3s;
+	if (glad_glVertexAttrib3sv == glad_trace_glVertexAttrib3sv) glad_glVertexAttrib3sv = glad_trace_next_glVertexAttrib3sv;
+	if (glad_glVertexAttrib4Nbv == glad_trace_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv = glad_trace_next_glVertexAttrib4Nbv;
+	if (glad_glVertexAttrib4Niv == glad_trace_glVertexAttrib4Niv) glad_glVertexAttrib4Niv = glad_trace_next_glVertexAttrib4Niv;
+	if (glad_glVertexAttrib4Nsv == glad_trace_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv = glad_trace_next_glVertexAttrib4Nsv;
+	if (glad_glVertexAttrib4Nub == glad_trace_glVertexAttrib4Nub) glad_glVertexAttrib4Nub = glad_trace_next_glVertexAttrib4Nub;
+	if (glad_glVertexAttrib4Nubv == glad_trace_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv = glad_trace_next_glVertexAttrib4Nubv;
+	if (glad_glVertexAttrib4Nuiv == glad_trace_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv = glad_trace_next_glVertexAttrib4Nuiv;
+	if (glad_glVertexAttrib4Nusv == glad_trace_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv = glad_trace_next_glVertexAttrib4Nusv;
+	if (glad_glVertexAttrib4bv == glad_trace_glVertexAttrib4bv) glad_glVertexAttrib4bv = glad_trace_next_glVertexAttrib4bv;
+	if (glad_glVertexAttrib4d == glad_trace_glVertexAttrib4d) glad_glVertexAttrib4d = glad_trace_next_glVertexAttrib4d;
+	if (glad_glVertexAttrib4dv == glad_trace_glVertexAttrib4dv) glad_glVertexAttrib4dv = glad_trace_next_glVertexAttrib4dv;
+	if (glad_glVertexAttrib4f == glad_trace_glVertexAttrib4f) glad_glVertexAttrib4f = glad_trace_next_glVertexAttrib4f;
+	if (glad_glVertexAttrib4fv == glad_trace_glVertexAttrib4fv) glad_glVertexAttrib4fv = glad_trace_next_glVertexAttrib4fv;
+	if (glad_glVertexAttrib4iv == glad_trace_glVertexAttrib4iv) glad_glVertexAttrib4iv = glad_trace_next_glVertexAttrib4iv;
+	if (glad_glVertexAttrib4s == glad_trace_glVertexAttrib4s) glad_glVertexAttrib4s = glad_trace_next_glVertexAttrib4s;
+	if (glad_glVertexAttrib4sv == glad_trace_glVertexAttrib4sv) glad_glVertexAttrib4sv = glad_trace_next_glVertexAttrib4sv;
+	if (glad_glVertexAttrib4ubv == glad_trace_glVertexAttrib4ubv) glad_glVertexAttrib4ubv = glad_trace_next_glVertexAttrib4ubv;
+	if (glad_glVertexAttrib4uiv == glad_trace_glVertexAttrib4uiv) glad_glVertexAttrib4uiv = glad_trace_next_glVertexAttrib4uiv;
+	if (glad_glVertexAttrib4usv == glad_trace_glVertexAttrib4usv) glad_glVertexAttrib4usv = glad_trace_next_glVertexAttrib4usv;
+	if (glad_glVertexAttribPointer == glad_trace_glVertexAttribPointer) glad_glVertexAttribPointer = glad_trace_next_glVertexAttribPointer;
+	if (glad_glUniformMatrix2x3fv == glad_trace_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv = glad_trace_next_glUniformMatrix2x3fv;
+	if (glad_glUniformMatrix3x2fv == glad_trace_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv = glad_trace_next_glUniformMatrix3x2fv;
+	if (glad_glUniformMatrix2x4fv == glad_trace_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv = glad_trace_next_glUniformMatrix2x4fv;
+	if (glad_glUniformMatrix4x2fv == glad_trace_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv = glad_trace_next_glUniformMatrix4x2fv;
+	if (glad_glUniformMatrix3x4fv == glad_trace_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv = glad_trace_next_glUniformMatrix3x4fv;
+	if (glad_glUniformMatrix4x3fv == glad_trace_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv = glad_trace_next_glUniformMatrix4x3fv;
+	if (glad_glColorMaski == glad_trace_glColorMaski) glad_glColorMaski = glad_trace_next_glColorMaski;
+	if (glad_glEnablei == glad_trace_glEnablei) glad_glEnablei = glad_trace_next_glEnablei;
+	if (glad_glDisablei == glad_trace_glDisablei) glad_glDisablei = glad_trace_next_glDisablei;
+	if (glad_glBeginTransformFeedback == glad_trace_glBeginTransformFeedback) glad_glBeginTransformFeedback = glad_trace_next_glBeginTransformFeedback;
+	if (glad_glEndTransformFeedback == glad_trace_glEndTransformFeedback) glad_glEndTransformFeedback = glad_trace_next_glEndTransformFeedback;
+	if (glad_glBindBufferRange == glad_trace_glBindBufferRange) glad_glBindBufferRange = glad_trace_next_glBindBufferRange;
+	if (glad_glBindBufferBase == glad_trace_glBindBufferBase) glad_glBindBufferBase = glad_trace_next_glBindBufferBase;
+	if (glad_glTransformFeedbackVaryings == glad_trace_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings = glad_trace_next_glTransformFeedbackVaryings;
+	if (glad_glClampColor == glad_trace_glClampColor) glad_glClampColor = glad_trace_next_glClampColor;
+	if (glad_glBeginConditionalRender == glad_trace_glBeginConditionalRender) glad_glBeginConditionalRender = glad_trace_next_glBeginConditionalRender;
+	if (glad_glEndConditionalRender == glad_trace_glEndConditionalRender) glad_glEndConditionalRender = glad_trace_next_glEndConditionalRender;
+	if (glad_glVertexAttribIPointer == glad_trace_glVertexAttribIPointer) glad_glVertexAttribIPointer = glad_trace_next_glVertexAttribIPointer;
+	if (glad_glVertexAttribI1i == glad_trace_glVertexAttribI1i) glad_glVertexAttribI1i = glad_trace_next_glVertexAttribI1i;
+	if (glad_glVertexAttribI2i == glad_trace_glVertexAttribI2i) glad_glVertexAttribI2i = glad_trace_next_glVertexAttribI2i;
+	if (glad_glVertexAttribI3i == glad_trace_glVertexAttribI3i) glad_glVertexAttribI3i = glad_trace_next_glVertexAttribI3i;
+	if (glad_glVertexAttribI4i == glad_trace_glVertexAttribI4i) glad_glVertexAttribI4i = glad_trace_next_glVertexAttribI4i;
+	if (glad_glVertexAttribI1ui == glad_trace_glVertexAttribI1ui) glad_glVertexAttribI1ui = glad_trace_next_glVertexAttribI1ui;
+	if (glad_glVertexAttribI2ui == glad_trace_glVertexAttribI2ui) glad_glVertexAttribI2ui = glad_trace_next_glVertexAttribI2ui;
+	if (glad_glVertexAttribI3ui == glad_trace_glVertexAttribI3ui) glad_glVertexAttribI3ui = glad_trace_next_glVertexAttribI3ui;
+	if (glad_glVertexAttribI4ui == glad_trace_glVertexAttribI4ui) glad_glVertexAttribI4ui = glad_trace_next_glVertexAttribI4ui;
+	if (glad_glVertexAttribI1iv == glad_trace_glVertexAttribI1iv) glad_glVertexAttribI1iv = glad_trace_next_glVertexAttribI1iv;
+	if (glad_glVertexAttribI2iv == glad_trace_glVertexAttribI2iv) glad_glVertexAttribI2iv = glad_trace_next_glVertexAttribI2iv;
+	if (glad_glVertexAttribI3iv == glad_trace_glVertexAttribI3iv) glad_glVertexAttribI3iv = glad_trace_next_glVertexAttribI3iv;
+	if (glad_glVertexAttribI4iv == glad_trace_glVertexAttribI4iv) glad_glVertexAttribI4iv = glad_trace_next_glVertexAttribI4iv;
+	if (glad_glVertexAttribI1uiv == glad_trace_glVertexAttribI1uiv) glad_glVertexAttribI1uiv = glad_trace_next_glVertexAttribI1uiv;
+	if (glad_glVertexAttribI2uiv == glad_trace_glVertexAttribI2uiv) glad_glVertexAttribI2uiv = glad_trace_next_glVertexAttribI2uiv;
+	if (glad_glVertexAttribI3uiv == glad_trace_glVertexAttribI3uiv) glad_glVertexAttribI3uiv = glad_trace_next_glVertexAttribI3uiv;
+	if (glad_glVertexAttribI4uiv == glad_trace_glVertexAttribI4uiv) glad_glVertexAttribI4uiv = glad_trace_next_glVertexAttribI4uiv;
+	if (glad_glVertexAttribI4bv == glad_trace_glVertexAttribI4bv) glad_glVertexAttribI4bv = glad_trace_next_glVertexAttribI4bv;
+	if (glad_glVertexAttribI4sv == glad_trace_glVertexAttribI4sv) glad_glVertexAttribI4sv = glad_trace_next_glVertexAttribI4sv;
+	if (glad_glVertexAttribI4ubv == glad_trace_glVertexAttribI4ubv) glad_glVertexAttribI4ubv = glad_trace_next_glVertexAttribI4ubv;
+	if (glad_glVertexAttribI4usv == glad_trace_glVertexAttribI4usv) glad_glVertexAttribI4usv = glad_trace_next_glVertexAttribI4usv;
+	if (glad_glBindFragDataLocation == glad_trace_glBindFragDataLocation) glad_glBindFragDataLocation = glad_trace_next_glBindFragDataLocation;
+	if (glad_glUniform1ui == glad_trace_glUniform1ui) glad_glUniform1ui = glad_trace_next_glUniform1ui;
+	if (glad_glUniform2ui == glad_trace_glUniform2ui) glad_glUniform2ui = glad_trace_next_glUniform2ui;
+	if (glad_glUniform3ui == glad_trace_glUniform3ui) glad_glUniform3ui = glad_trace_next_glUniform3ui;
+	if (glad_glUniform4ui == glad_trace_glUniform4ui) glad_glUniform4ui = glad_trace_next_glUniform4ui;
+	if (glad_glUniform1uiv == glad_trace_glUniform1uiv) glad_glUniform1uiv = glad_trace_next_glUniform1uiv;
+	if (glad_glUniform2uiv == glad_trace_glUniform2uiv) glad_glUniform2uiv = glad_trace_next_glUniform2uiv;
+	if (glad_glUniform3uiv == glad_trace_glUniform3uiv) glad_glUniform3uiv = glad_trace_next_glUniform3uiv;
+	if (glad_glUniform4uiv == glad_trace_glUniform4uiv) glad_glUniform4uiv = glad_trace_next_glUniform4uiv;
+	if (glad_glTexParameterIiv == glad_trace_glTexParameterIiv) glad_glTexParameterIiv = glad_trace_next_glTexParameterIiv;
+	if (glad_glTexParameterIuiv == glad_trace_glTexParameterIuiv) glad_glTexParameterIuiv = glad_trace_next_glTexParameterIuiv;
+	if (glad_glClearBufferiv == glad_trace_glClearBufferiv) glad_glClearBufferiv = glad_trace_next_glClearBufferiv;
+	if (glad_glClearBufferuiv == glad_trace_glClearBufferuiv) glad_glClearBufferuiv = glad_trace_next_glClearBufferuiv;
+	if (glad_glClearBufferfv == glad_trace_glClearBufferfv) glad_glClearBufferfv = glad_trace_next_glClearBufferfv;
+	if (glad_glClearBufferfi == glad_trace_glClearBufferfi) glad_glClearBufferfi = glad_trace_next_glClearBufferfi;
+	if (glad_glBindRenderbuffer == glad_trace_glBindRenderbuffer) glad_glBindRenderbuffer = glad_trace_next_glBindRenderbuffer;
+	if (glad_glDeleteRenderbuffers == glad_trace_glDeleteRenderbuffers) glad_glDeleteRenderbuffers = glad_trace_next_glDeleteRenderbuffers;
+	if (glad_glGenRenderbuffers == glad_trace_glGenRenderbuffers) glad_glGenRenderbuffers = glad_trace_next_glGenRenderbuffers;
+	if (glad_glRenderbufferStorage == glad_trace_glRenderbufferStorage) glad_glRenderbufferStorage = glad_trace_next_glRenderbufferStorage;
+	if (glad_glBindFramebuffer == glad_trace_glBindFramebuffer) glad_glBindFramebuffer = glad_trace_next_glBindFramebuffer;
+	if (glad_glDeleteFramebuffers == glad_trace_glDeleteFramebuffers) glad_glDeleteFramebuffers = glad_trace_next_glDeleteFramebuffers;
+	if (glad_glGenFramebuffers == glad_trace_glGenFramebuffers) glad_glGenFramebuffers = glad_trace_next_glGenFramebuffers;
+	if (glad_glFramebufferTexture1D == glad_trace_glFramebufferTexture1D) glad_glFramebufferTexture1D = glad_trace_next_glFramebufferTexture1D;
+	if (glad_glFramebufferTexture2D == glad_trace_glFramebufferTexture2D) glad_glFramebufferTexture2D = glad_trace_next_glFramebufferTexture2D;
+	if (glad_glFramebufferTexture3D == glad_trace_glFramebufferTexture3D) glad_glFramebufferTexture3D = glad_trace_next_glFramebufferTexture3D;
+	if (glad_glFramebufferRenderbuffer == glad_trace_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer = glad_trace_next_glFramebufferRenderbuffer;
+	if (glad_glGenerateMipmap == glad_trace_glGenerateMipmap) glad_glGenerateMipmap = glad_trace_next_glGenerateMipmap;
+	if (glad_glBlitFramebuffer == glad_trace_glBlitFramebuffer) glad_glBlitFramebuffer = glad_trace_next_glBlitFramebuffer;
+	if (glad_glRenderbufferStorageMultisample == glad_trace_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample = glad_trace_next_glRenderbufferStorageMultisample;
+	if (glad_glFramebufferTextureLayer == glad_trace_glFramebufferTextureLayer) glad_glFramebufferTextureLayer = glad_trace_next_glFramebufferTextureLayer;
+	if (glad_glMapBufferRange == glad_trace_glMapBufferRange) glad_glMapBufferRange = glad_trace_next_glMapBufferRange;
+	if (glad_glFlushMappedBufferRange == glad_trace_glFlushMappedBufferRange) glad_glFlushMappedBufferRange = glad_trace_next_glFlushMappedBufferRange;
+	if (glad_glBindVertexArray == glad_trace_glBindVertexArray) glad_glBindVertexArray = glad_trace_next_glBindVertexArray;
+	if (glad_glDeleteVertexArrays == glad_trace_glDeleteVertexArrays) glad_glDeleteVertexArrays = glad_trace_next_glDeleteVertexArrays;
+	if (glad_glGenVertexArrays == glad_trace_glGenVertexArrays) glad_glGenVertexArrays = glad_trace_next_glGenVertexArrays;
+	if (glad_glDrawArraysInstanced == glad_trace_glDrawArraysInstanced) glad_glDrawArraysInstanced = glad_trace_next_glDrawArraysInstanced;
+	if (glad_glDrawElementsInstanced == glad_trace_glDrawElementsInstanced) glad_glDrawElementsInstanced = glad_trace_next_glDrawElementsInstanced;
+	if (glad_glTexBuffer == glad_trace_glTexBuffer) glad_glTexBuffer = glad_trace_next_glTexBuffer;
+	if (glad_glPrimitiveRestartIndex == glad_trace_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex = glad_trace_next_glPrimitiveRestartIndex;
+	if (glad_glCopyBufferSubData == glad_trace_glCopyBufferSubData) glad_glCopyBufferSubData = glad_trace_next_glCopyBufferSubData;
+	if (glad_glUniformBlockBinding == glad_trace_glUniformBlockBinding) glad_glUniformBlockBinding = glad_trace_next_glUniformBlockBinding;
+	if (glad_glDrawElementsBaseVertex == glad_trace_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex = glad_trace_next_glDrawElementsBaseVertex;
+	if (glad_glDrawRangeElementsBaseVertex == glad_trace_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex = glad_trace_next_glDrawRangeElementsBaseVertex;
+	if (glad_glDrawElementsInstancedBaseVertex == glad_trace_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex = glad_trace_next_glDrawElementsInstancedBaseVertex;
+	if (glad_glMultiDrawElementsBaseVertex == glad_trace_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex = glad_trace_next_glMultiDrawElementsBaseVertex;
+	if (glad_glProvokingVertex == glad_trace_glProvokingVertex) glad_glProvokingVertex = glad_trace_next_glProvokingVertex;
+	if (glad_glFenceSync == glad_trace_glFenceSync) glad_glFenceSync = glad_trace_next_glFenceSync;
+	if (glad_glDeleteSync == glad_trace_glDeleteSync) glad_glDeleteSync = glad_trace_next_glDeleteSync;
+	if (glad_glClientWaitSync == glad_trace_glClientWaitSync) glad_glClientWaitSync = glad_trace_next_glClientWaitSync;
+	if (glad_glWaitSync == glad_trace_glWaitSync) glad_glWaitSync = glad_trace_next_glWaitSync;
+	if (glad_glFramebufferTexture == glad_trace_glFramebufferTexture) glad_glFramebufferTexture = glad_trace_next_glFramebufferTexture;
+	if (glad_glTexImage2DMultisample == glad_trace_glTexImage2DMultisample) glad_glTexImage2DMultisample = glad_trace_next_glTexImage2DMultisample;
+	if (glad_glTexImage3DMultisample == glad_trace_glTexImage3DMultisample) glad_glTexImage3DMultisample = glad_trace_next_glTexImage3DMultisample;
+	if (glad_glSampleMaski == glad_trace_glSampleMaski) glad_glSampleMaski = glad_trace_next_glSampleMaski;
+	if (glad_glBindFragDataLocationIndexed == glad_trace_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed = glad_trace_next_glBindFragDataLocationIndexed;
+	if (glad_glGenSamplers == glad_trace_glGenSamplers) glad_glGenSamplers = glad_trace_next_glGenSamplers;
+	if (glad_glDeleteSamplers == glad_trace_glDeleteSamplers) glad_glDeleteSamplers = glad_trace_next_glDeleteSamplers;
+	if (glad_glBindSampler == glad_trace_glBindSampler) glad_glBindSampler = glad_trace_next_glBindSampler;
+	if (glad_glSamplerParameteri == glad_trace_glSamplerParameteri) glad_glSamplerParameteri = glad_trace_next_glSamplerParameteri;
+	if (glad_glSamplerParameteriv == glad_trace_glSamplerParameteriv) glad_glSamplerParameteriv = glad_trace_next_glSamplerParameteriv;
+	if (glad_glSamplerParameterf == glad_trace_glSamplerParameterf) glad_glSamplerParameterf = glad_trace_next_glSamplerParameterf;
+	if (glad_glSamplerParameterfv == glad_trace_glSamplerParameterfv) glad_glSamplerParameterfv = glad_trace_next_glSamplerParameterfv;
+	if (glad_glSamplerParameterIiv == glad_trace_glSamplerParameterIiv) glad_glSamplerParameterIiv = glad_trace_next_glSamplerParameterIiv;
+	if (glad_glSamplerParameterIuiv == glad_trace_glSamplerParameterIuiv) glad_glSamplerParameterIuiv = glad_trace_next_glSamplerParameterIuiv;
+	if (glad_glQueryCounter == glad_trace_glQueryCounter) glad_glQueryCounter = glad_trace_next_glQueryCounter;
+	if (glad_glVertexAttribDivisor == glad_trace_glVertexAttribDivisor) glad_glVertexAttribDivisor = glad_trace_next_glVertexAttribDivisor;
+	if (glad_glVertexAttribP1ui == glad_trace_glVertexAttribP1ui) glad_glVertexAttribP1ui = glad_trace_next_glVertexAttribP1ui;
+	if (glad_glVertexAttribP1uiv == glad_trace_glVertexAttribP1uiv) glad_glVertexAttribP1uiv = glad_trace_next_glVertexAttribP1uiv;
+	if (glad_glVertexAttribP2ui == glad_trace_glVertexAttribP2ui) glad_glVertexAttribP2ui = glad_trace_next_glVertexAttribP2ui;
+	if (glad_glVertexAttribP2uiv == glad_trace_glVertexAttribP2uiv) glad_glVertexAttribP2uiv = glad_trace_next_glVertexAttribP2uiv;
+	if (glad_glVertexAttribP3ui == glad_trace_glVertexAttribP3ui) glad_glVertexAttribP3ui = glad_trace_next_glVertexAttribP3ui;
+	if (glad_glVertexAttribP3uiv == glad_trace_glVertexAttribP3uiv) glad_glVertexAttribP3uiv = glad_trace_next_glVertexAttribP3uiv;
+	if (glad_glVertexAttribP4ui == glad_trace_glVertexAttribP4ui) glad_glVertexAttribP4ui = glad_trace_next_glVertexAttribP4ui;
+	if (glad_glVertexAttribP4uiv == glad_trace_glVertexAttribP4uiv) glad_glVertexAttribP4uiv = glad_trace_next_glVertexAttribP4uiv;
+	if (glad_glVertexP2ui == glad_trace_glVertexP2ui) glad_glVertexP2ui = glad_trace_next_glVertexP2ui;
+	if (glad_glVertexP2uiv == glad_trace_glVertexP2uiv) glad_glVertexP2uiv = glad_trace_next_glVertexP2uiv;
+	if (glad_glVertexP3ui == glad_trace_glVertexP3ui) glad_glVertexP3ui = glad_trace_next_glVertexP3ui;
+	if (glad_glVertexP3uiv == glad_trace_glVertexP3uiv) glad_glVertexP3uiv = glad_trace_next_glVertexP3uiv;
+	if (glad_glVertexP4ui == glad_trace_glVertexP4ui) glad_glVertexP4ui = glad_trace_next_glVertexP4ui;
+	if (glad_glVertexP4uiv == glad_trace_glVertexP4uiv) glad_glVertexP4uiv = glad_trace_next_glVertexP4uiv;
+	if (glad_glTexCoordP1ui == glad_trace_glTexCoordP1ui) glad_glTexCoordP1ui = glad_trace_next_glTexCoordP1ui;
+	if (glad_glTexCoordP1uiv == glad_trace_glTexCoordP1uiv) glad_glTexCoordP1uiv = glad_trace_next_glTexCoordP1uiv;
+	if (glad_glTexCoordP2ui == glad_trace_glTexCoordP2ui) glad_glTexCoordP2ui = glad_trace_next_glTexCoordP2ui;
+	if (glad_glTexCoordP2uiv == glad_trace_glTexCoordP2uiv) glad_glTexCoordP2uiv = glad_trace_next_glTexCoordP2uiv;
+	if (glad_glTexCoordP3ui == glad_trace_glTexCoordP3ui) glad_glTexCoordP3ui = glad_trace_next_glTexCoordP3ui;
+	if (glad_glTexCoordP3uiv == glad_trace_glTexCoordP3uiv) glad_glTexCoordP3uiv = glad_trace_next_glTexCoordP3uiv;
+	if (glad_glTexCoordP4ui == glad_trace_glTexCoordP4ui) glad_glTexCoordP4ui = glad_trace_next_glTexCoordP4ui;
+	if (glad_glTexCoordP4uiv == glad_trace_glTexCoordP4uiv) glad_glTexCoordP4uiv = glad_trace_next_glTexCoordP4uiv;
+	if (glad_glMultiTexCoordP1ui == glad_trace_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui = glad_trace_next_glMultiTexCoordP1ui;
+	if (glad_glMultiTexCoordP1uiv == glad_trace_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv = glad_trace_next_glMultiTexCoordP1uiv;
+	if (glad_glMultiTexCoordP2ui == glad_trace_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui = glad_trace_next_glMultiTexCoordP2ui;
+	if (glad_glMultiTexCoordP2uiv == glad_trace_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv = glad_trace_next_glMultiTexCoordP2uiv;
+	if (glad_glMultiTexCoordP3ui == glad_trace_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui = glad_trace_next_glMultiTexCoordP3ui;
+	if (glad_glMultiTexCoordP3uiv == glad_trace_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv = glad_trace_next_glMultiTexCoordP3uiv;
+	if (glad_glMultiTexCoordP4ui == glad_trace_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui = glad_trace_next_glMultiTexCoordP4ui;
+	if (glad_glMultiTexCoordP4uiv == glad_trace_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv = glad_trace_next_glMultiTexCoordP4uiv;
+	if (glad_glNormalP3ui == glad_trace_glNormalP3ui) glad_glNormalP3ui = glad_trace_next_glNormalP3ui;
+	if (glad_glNormalP3uiv == glad_trace_glNormalP3uiv) glad_glNormalP3uiv = glad_trace_next_glNormalP3uiv;
+	if (glad_glColorP3ui == glad_trace_glColorP3ui) glad_glColorP3ui = glad_trace_next_glColorP3ui;
+	if (glad_glColorP3uiv == glad_trace_glColorP3uiv) glad_glColorP3uiv = glad_trace_next_glColorP3uiv;
+	if (glad_glColorP4ui == glad_trace_glColorP4ui) glad_glColorP4ui = glad_trace_next_glColorP4ui;
+	if (glad_glColorP4uiv == glad_trace_glColorP4uiv) glad_glColorP4uiv = glad_trace_next_glColorP4uiv;
+	if (glad_glSecondaryColorP3ui == glad_trace_glSecondaryColorP3ui) glad_glSecondaryColorP3ui = glad_trace_next_glSecondaryColorP3ui;
+	if (glad_glSecondaryColorP3uiv == glad_trace_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv = glad_trace_next_glSecondaryColorP3uiv;
+	if (glad_glMinSampleShading == glad_trace_glMinSampleShading) glad_glMinSampleShading = glad_trace_next_glMinSampleShading;
+	if (glad_glBlendEquationi == glad_trace_glBlendEquationi) glad_glBlendEquationi = glad_trace_next_glBlendEquationi;
+	if (glad_glBlendEquationSeparatei == glad_trace_glBlendEquationSeparatei) glad_glBlendEquationSeparatei = glad_trace_next_glBlendEquationSeparatei;
+	if (glad_glBlendFunci == glad_trace_glBlendFunci) glad_glBlendFunci = glad_trace_next_glBlendFunci;
+	if (glad_glBlendFuncSeparatei == glad_trace_glBlendFuncSeparatei) glad_glBlendFuncSeparatei = glad_trace_next_glBlendFuncSeparatei;
+	if (glad_glDrawArraysIndirect == glad_trace_glDrawArraysIndirect) glad_glDrawArraysIndirect = glad_trace_next_glDrawArraysIndirect;
+	if (glad_glDrawElementsIndirect == glad_trace_glDrawElementsIndirect) glad_glDrawElementsIndirect = glad_trace_next_glDrawElementsIndirect;
+	if (glad_glUniform1d == glad_trace_glUniform1d) glad_glUniform1d = glad_trace_next_glUniform1d;
+	if (glad_glUniform2d == glad_trace_glUniform2d) glad_glUniform2d = glad_trace_next_glUniform2d;
+	if (glad_glUniform3d == glad_trace_glUniform3d) glad_glUniform3d = glad_trace_next_glUniform3d;
+	if (glad_glUniform4d == glad_trace_glUniform4d) glad_glUniform4d = glad_trace_next_glUniform4d;
+	if (glad_glUniform1dv == glad_trace_glUniform1dv) glad_glUniform1dv = glad_trace_next_glUniform1dv;
+	if (glad_glUniform2dv == glad_trace_glUniform2dv) glad_glUniform2dv = glad_trace_next_glUniform2dv;
+	if (glad_glUniform3dv == glad_trace_glUniform3dv) glad_glUniform3dv = glad_trace_next_glUniform3dv;
+	if (glad_glUniform4dv == glad_trace_glUniform4dv) glad_glUniform4dv = glad_trace_next_glUniform4dv;
+	if (glad_glUniformMatrix2dv == glad_trace_glUniformMatrix2dv) glad_glUniformMatrix2dv = glad_trace_next_glUniformMatrix2dv;
+	if (glad_glUniformMatrix3dv == glad_trace_glUniformMatrix3dv) glad_glUniformMatrix3dv = glad_trace_next_glUniformMatrix3dv;
+	if (glad_glUniformMatrix4dv == glad_trace_glUniformMatrix4dv) glad_glUniformMatrix4dv = glad_trace_next_glUniformMatrix4dv;
+	if (glad_glUniformMatrix2x3dv == glad_trace_glUniformMatrix2x3dv) glad_glUniformMatrix2x3dv = glad_trace_next_glUniformMatrix2x3dv;
+	if (glad_glUniformMatrix2x4dv == glad_trace_glUniformMatrix2x4dv) glad_glUniformMatrix2x4dv = glad_trace_next_glUniformMatrix2x4dv;
+	if (glad_glUniformMatrix3x2dv == glad_trace_glUniformMatrix3x2dv) glad_glUniformMatrix3x2dv = glad_trace_next_glUniformMatrix3x2dv;
+	if (glad_glUniformMatrix3x4dv == glad_trace_glUniformMatrix3x4dv) glad_glUniformMatrix3x4dv = glad_trace_next_glUniformMatrix3x4dv;
+	if (glad_glUniformMatrix4x2dv == glad_trace_glUniformMatrix4x2dv) glad_glUniformMatrix4x2dv = glad_trace_next_glUniformMatrix4x2dv;
+	if (glad_glUniformMatrix4x3dv == glad_trace_glUniformMatrix4x3dv) glad_glUniformMatrix4x3dv = glad_trace_next_glUniformMatrix4x3dv;
+	if (glad_glUniformSubroutinesuiv == glad_trace_glUniformSubroutinesuiv) glad_glUniformSubroutinesuiv = glad_trace_next_glUniformSubroutinesuiv;
+	if (glad_glPatchParameteri == glad_trace_glPatchParameteri) glad_glPatchParameteri = glad_trace_next_glPatchParameteri;
+	if (glad_glPatchParameterfv == glad_trace_glPatchParameterfv) glad_glPatchParameterfv = glad_trace_next_glPatchParameterfv;
+	if (glad_glBindTransformFeedback == glad_trace_glBindTransformFeedback) glad_glBindTransformFeedback = glad_trace_next_glBindTransformFeedback;
+	if (glad_glDeleteTransformFeedbacks == glad_trace_glDeleteTransformFeedbacks) glad_glDeleteTransformFeedbacks = glad_trace_next_glDeleteTransformFeedbacks;
+	if (glad_glGenTransformFeedbacks == glad_trace_glGenTransformFeedbacks) glad_glGenTransformFeedbacks = glad_trace_next_glGenTransformFeedbacks;
+	if (glad_glPauseTransformFeedback == glad_trace_glPauseTransformFeedback) glad_glPauseTransformFeedback = glad_trace_next_glPauseTransformFeedback;
+	if (glad_glResumeTransformFeedback == glad_trace_glResumeTransformFeedback) glad_glResumeTransformFeedback = glad_trace_next_glResumeTransformFeedback;
+	if (glad_glDrawTransformFeedback == glad_trace_glDrawTransformFeedback) glad_glDrawTransformFeedback = glad_trace_next_glDrawTransformFeedback;
+	if (glad_glDrawTransformFeedbackStream == glad_trace_glDrawTransformFeedbackStream) glad_glDrawTransformFeedbackStream = glad_trace_next_glDrawTransformFeedbackStream;
+	if (glad_glBeginQueryIndexed == glad_trace_glBeginQueryIndexed) glad_glBeginQueryIndexed = glad_trace_next_glBeginQueryIndexed;
+	if (glad_glEndQueryIndexed == glad_trace_glEndQueryIndexed) glad_glEndQueryIndexed = glad_trace_next_glEndQueryIndexed;
+	if (glad_glReleaseShaderCompiler == glad_trace_glReleaseShaderCompiler) glad_glReleaseShaderCompiler = glad_trace_next_glReleaseShaderCompiler;
+	if (glad_glShaderBinary == glad_trace_glShaderBinary) glad_glShaderBinary = glad_trace_next_glShaderBinary;
+	if (glad_glDepthRangef == glad_trace_glDepthRangef) glad_glDepthRangef = glad_trace_next_glDepthRangef;
+	if (glad_glClearDepthf == glad_trace_glClearDepthf) glad_glClearDepthf = glad_trace_next_glClearDepthf;
+	if (glad_glProgramBinary == glad_trace_glProgramBinary) glad_glProgramBinary = glad_trace_next_glProgramBinary;
+	if (glad_glProgramParameteri == glad_trace_glProgramParameteri) glad_glProgramParameteri = glad_trace_next_glProgramParameteri;
+	if (glad_glUseProgramStages == glad_trace_glUseProgramStages) glad_glUseProgramStages = glad_trace_next_glUseProgramStages;
+	if (glad_glActiveShaderProgram == glad_trace_glActiveShaderProgram) glad_glActiveShaderProgram = glad_trace_next_glActiveShaderProgram;
+	if (glad_glCreateShaderProgramv == glad_trace_glCreateShaderProgramv) glad_glCreateShaderProgramv = glad_trace_next_glCreateShaderProgramv;
+	if (glad_glBindProgramPipeline == glad_trace_glBindProgramPipeline) glad_glBindProgramPipeline = glad_trace_next_glBindProgramPipeline;
+	if (glad_glDeleteProgramPipelines == glad_trace_glDeleteProgramPipelines) glad_glDeleteProgramPipelines = glad_trace_next_glDeleteProgramPipelines;
+	if (glad_glGenProgramPipelines == glad_trace_glGenProgramPipelines) glad_glGenProgramPipelines = glad_trace_next_glGenProgramPipelines;
+	if (glad_glProgramUniform1i == glad_trace_glProgramUniform1i) glad_glProgramUniform1i = glad_trace_next_glProgramUniform1i;
+	if (glad_glProgramUniform1iv == glad_trace_glProgramUniform1iv) glad_glProgramUniform1iv = glad_trace_next_glProgramUniform1iv;
+	if (glad_glProgramUniform1f == glad_trace_glProgramUniform1f) glad_glProgramUniform1f = glad_trace_next_glProgramUniform1f;
+	if (glad_glProgramUniform1fv == glad_trace_glProgramUniform1fv) glad_glProgramUniform1fv = glad_trace_next_glProgramUniform1fv;
+	if (glad_glProgramUniform1d == glad_trace_glProgramUniform1d) glad_glProgramUniform1d = glad_trace_next_glProgramUniform1d;
+	if (glad_glProgramUniform1dv == glad_trace_glProgramUniform1dv) glad_glProgramUniform1dv = glad_trace_next_glProgramUniform1dv;
+	if (glad_glProgramUniform1ui == glad_trace_glProgramUniform1ui) glad_glProgramUniform1ui = glad_trace_next_glProgramUniform1ui;
+	if (glad_glProgramUniform1uiv == glad_trace_glProgramUniform1uiv) glad_glProgramUniform1uiv = glad_trace_next_glProgramUniform1uiv;
+	if (glad_glProgramUniform2i == glad_trace_glProgramUniform2i) glad_glProgramUniform2i = glad_trace_next_glProgramUniform2i;
+	if (glad_glProgramUniform2iv == glad_trace_glProgramUniform2iv) glad_glProgramUniform2iv = glad_trace_next_glProgramUniform2iv;
+	if (glad_glProgramUniform2f == glad_trace_glProgramUniform2f) glad_glProgramUniform2f = glad_trace_next_glProgramUniform2f;
+	if (glad_glProgramUniform2fv == glad_trace_glProgramUniform2fv) glad_glProgramUniform2fv = glad_trace_next_glProgramUniform2fv;
+	if (glad_glProgramUniform2d == glad_trace_glProgramUniform2d) glad_glProgramUniform2d = glad_trace_next_glProgramUniform2d;
+	if (glad_glProgramUniform2dv == glad_trace_glProgramUniform2dv) glad_glProgramUniform2dv = glad_trace_next_glProgramUniform2dv;
+	if (glad_glProgramUniform2ui == glad_trace_glProgramUniform2ui) glad_glProgramUniform2ui = glad_trace_next_glProgramUniform2ui;
+	if (glad_glProgramUniform2uiv == glad_trace_glProgramUniform2uiv) glad_glProgramUniform2uiv = glad_trace_next_glProgramUniform2uiv;
+	if (glad_glProgramUniform3i == glad_trace_glProgramUniform3i) glad_glProgramUniform3i = glad_trace_next_glProgramUniform3i;
+	if (glad_glProgramUniform3iv == glad_trace_glProgramUniform3iv) glad_glProgramUniform3iv = glad_trace_next_glProgramUniform3iv;
+	if (glad_glProgramUniform3f == glad_trace_glProgramUniform3f) glad_glProgramUniform3f = glad_trace_next_glProgramUniform3f;
+	if (glad_glProgramUniform3fv == glad_trace_glProgramUniform3fv) glad_glProgramUniform3fv = glad_trace_next_glProgramUniform3fv;
+	if (glad_glProgramUniform3d == glad_trace_glProgramUniform3d) glad_glProgramUniform3d = glad_trace_next_glProgramUniform3d;
+	if (glad_glProgramUniform3dv == glad_trace_glProgramUniform3dv) glad_glProgramUniform3dv = glad_trace_next_glProgramUniform3dv;
+	if (glad_glProgramUniform3ui == glad_trace_glProgramUniform3ui) glad_glProgramUniform3ui = glad_trace_next_glProgramUniform3ui;
+	if (glad_glProgramUniform3uiv == glad_trace_glProgramUniform3uiv) glad_glProgramUniform3uiv = glad_trace_next_glProgramUniform3uiv;
+	if (glad_glProgramUniform4i == glad_trace_glProgramUniform4i) glad_glProgramUniform4i = glad_trace_next_glProgramUniform4i;
+	if (glad_glProgramUniform4iv == glad_trace_glProgramUniform4iv) glad_glProgramUniform4iv = glad_trace_next_glProgramUniform4iv;
+	if (glad_glProgramUniform4f == glad_trace_glProgramUniform4f) glad_glProgramUniform4f = glad_trace_next_glProgramUniform4f;
+	if (glad_glProgramUniform4fv == glad_trace_glProgramUniform4fv) glad_glProgramUniform4fv = glad_trace_next_glProgramUniform4fv;
+	if (glad_glProgramUniform4d == glad_trace_glProgramUniform4d) glad_glProgramUniform4d = glad_trace_next_glProgramUniform4d;
+	if (glad_glProgramUniform4dv == glad_trace_glProgramUniform4dv) glad_glProgramUniform4dv = glad_trace_next_glProgramUniform4dv;
+	if (glad_glProgramUniform4ui == glad_trace_glProgramUniform4ui) glad_glProgramUniform4ui = glad_trace_next_glProgramUniform4ui;
+	if (glad_glProgramUniform4uiv == glad_trace_glProgramUniform4uiv) glad_glProgramUniform4uiv = glad_trace_next_glProgramUniform4uiv;
+	if (glad_glProgramUniformMatrix2fv == glad_trace_glProgramUniformMatrix2fv) glad_glProgramUniformMatrix2fv = glad_trace_next_glProgramUniformMatrix2fv;
+	if (glad_glProgramUniformMatrix3fv == glad_trace_glProgramUniformMatrix3fv) glad_glProgramUniformMatrix3fv = glad_trace_next_glProgramUniformMatrix3fv;
+	if (glad_glProgramUniformMatrix4fv == glad_trace_glProgramUniformMatrix4fv) glad_glProgramUniformMatrix4fv = glad_trace_next_glProgramUniformMatrix4fv;
+	if (glad_glProgramUniformMatrix2dv == glad_trace_glProgramUniformMatrix2dv) glad_glProgramUniformMatrix2dv = glad_trace_next_glProgramUniformMatrix2dv;
+	if (glad_glProgramUniformMatrix3dv == glad_trace_glProgramUniformMatrix3dv) glad_glProgramUniformMatrix3dv = glad_trace_next_glProgramUniformMatrix3dv;
+	if (glad_glProgramUniformMatrix4dv == glad_trace_glProgramUniformMatrix4dv) glad_glProgramUniformMatrix4dv = glad_trace_next_glProgramUniformMatrix4dv;
+	if (glad_glProgramUniformMatrix2x3fv == glad_trace_glProgramUniformMatrix2x3fv) glad_glProgramUniformMatrix2x3fv = glad_trace_next_glProgramUniformMatrix2x3fv;
+	if (glad_glProgramUniformMatrix3x2fv == glad_trace_glProgramUniformMatrix3x2fv) glad_glProgramUniformMatrix3x2fv = glad_trace_next_glProgramUniformMatrix3x2fv;
+	if (glad_glProgramUniformMatrix2x4fv == glad_trace_glProgramUniformMatrix2x4fv) glad_glProgramUniformMatrix2x4fv = glad_trace_next_glProgramUniformMatrix2x4fv;
+	if (glad_glProgramUniformMatrix4x2fv == glad_trace_glProgramUniformMatrix4x2fv) glad_glProgramUniformMatrix4x2fv = glad_trace_next_glProgramUniformMatrix4x2fv;
+	if (glad_glProgramUniformMatrix3x4fv == glad_trace_glProgramUniformMatrix3x4fv) glad_glProgramUniformMatrix3x4fv = glad_trace_next_glProgramUniformMatrix3x4fv;
+	if (glad_glProgramUniformMatrix4x3fv == glad_trace_glProgramUniformMatrix4x3fv) glad_glProgramUniformMatrix4x3fv = glad_trace_next_glProgramUniformMatrix4x3fv;
+	if (glad_glProgramUniformMatrix2x3dv == glad_trace_glProgramUniformMatrix2x3dv) glad_glProgramUniformMatrix2x3dv = glad_trace_next_glProgramUniformMatrix2x3dv;
+	if (glad_glProgramUniformMatrix3x2dv == glad_trace_glProgramUniformMatrix3x2dv) glad_glProgramUniformMatrix3x2dv = glad_trace_next_glProgramUniformMatrix3x2dv;
+	if (glad_glProgramUniformMatrix2x4dv == glad_trace_glProgramUniformMatrix2x4dv) glad_glProgramUniformMatrix2x4dv = glad_trace_next_glProgramUniformMatrix2x4dv;
+	if (glad_glProgramUniformMatrix4x2dv == glad_trace_glProgramUniformMatrix4x2dv) glad_glProgramUniformMatrix4x2dv = glad_trace_next_glProgramUniformMatrix4x2dv;
+	if (glad_glProgramUniformMatrix3x4dv == glad_trace_glProgramUniformMatrix3x4dv) glad_glProgramUniformMatrix3x4dv = glad_trace_next_glProgramUniformMatrix3x4dv;
+	if (glad_glProgramUniformMatrix4x3dv == glad_trace_glProgramUniformMatrix4x3dv) glad_glProgramUniformMatrix4x3dv = glad_trace_next_glProgramUniformMatrix4x3dv;
+	if (glad_glValidateProgramPipeline == glad_trace_glValidateProgramPipeline) glad_glValidateProgramPipeline = glad_trace_next_glValidateProgramPipeline;
+	if (glad_glVertexAttribL1d == glad_trace_glVertexAttribL1d) glad_glVertexAttribL1d = glad_trace_next_glVertexAttribL1d;
+	if (glad_glVertexAttribL2d == glad_trace_glVertexAttribL2d) glad_glVertexAttribL2d = glad_trace_next_glVertexAttribL2d;
+	if (glad_glVertexAttribL3d == glad_trace_glVertexAttribL3d) glad_glVertexAttribL3d = glad_trace_next_glVertexAttribL3d;
+	if (glad_glVertexAttribL4d == glad_trace_glVertexAttribL4d) glad_glVertexAttribL4d = glad_trace_next_glVertexAttribL4d;
+	if (glad_glVertexAttribL1dv == glad_trace_glVertexAttribL1dv) glad_glVertexAttribL1dv = glad_trace_next_glVertexAttribL1dv;
+	if (glad_glVertexAttribL2dv == glad_trace_glVertexAttribL2dv) glad_glVertexAttribL2dv = glad_trace_next_glVertexAttribL2dv;
+	if (glad_glVertexAttribL3dv == glad_trace_glVertexAttribL3dv) glad_glVertexAttribL3dv = glad_trace_next_glVertexAttribL3dv;
+	if (glad_glVertexAttribL4dv == glad_trace_glVertexAttribL4dv) glad_glVertexAttribL4dv = glad_trace_next_glVertexAttribL4dv;
+	if (glad_glVertexAttribLPointer == glad_trace_glVertexAttribLPointer) glad_glVertexAttribLPointer = glad_trace_next_glVertexAttribLPointer;
+	if (glad_glViewportArrayv == glad_trace_glViewportArrayv) glad_glViewportArrayv = glad_trace_next_glViewportArrayv;
+	if (glad_glViewportIndexedf == glad_trace_glViewportIndexedf) glad_glViewportIndexedf = glad_trace_next_glViewportIndexedf;
+	if (glad_glViewportIndexedfv == glad_trace_glViewportIndexedfv) glad_glViewportIndexedfv = glad_trace_next_glViewportIndexedfv;
+	if (glad_glScissorArrayv == glad_trace_glScissorArrayv) glad_glScissorArrayv = glad_trace_next_glScissorArrayv;
+	if (glad_glScissorIndexed == glad_trace_glScissorIndexed) glad_glScissorIndexed = glad_trace_next_glScissorIndexed;
+	if (glad_glScissorIndexedv == glad_trace_glScissorIndexedv) glad_glScissorIndexedv = glad_trace_next_glScissorIndexedv;
+	if (glad_glDepthRangeArrayv == glad_trace_glDepthRangeArrayv) glad_glDepthRangeArrayv = glad_trace_next_glDepthRangeArrayv;
+	if (glad_glDepthRangeIndexed == glad_trace_glDepthRangeIndexed) glad_glDepthRangeIndexed = glad_trace_next_glDepthRangeIndexed;
+	if (glad_glDrawArraysInstancedBaseInstance == glad_trace_glDrawArraysInstancedBaseInstance) glad_glDrawArraysInstancedBaseInstance = glad_trace_next_glDrawArraysInstancedBaseInstance;
+	if (glad_glDrawElementsInstancedBaseInstance == glad_trace_glDrawElementsInstancedBaseInstance) glad_glDrawElementsInstancedBaseInstance = glad_trace_next_glDrawElementsInstancedBaseInstance;
+	if (glad_glDrawElementsInstancedBaseVertexBaseInstance == glad_trace_glDrawElementsInstancedBaseVertexBaseInstance) glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_trace_next_glDrawElementsInstancedBaseVertexBaseInstance;
+	if (glad_glBindImageTexture == glad_trace_glBindImageTexture) glad_glBindImageTexture = glad_trace_next_glBindImageTexture;
+	if (glad_glMemoryBarrier == glad_trace_glMemoryBarrier) glad_glMemoryBarrier = glad_trace_next_glMemoryBarrier;
+	if (glad_glTexStorage1D == glad_trace_glTexStorage1D) glad_glTexStorage1D = glad_trace_next_glTexStorage1D;
+	if (glad_glTexStorage2D == glad_trace_glTexStorage2D) glad_glTexStorage2D = glad_trace_next_glTexStorage2D;
+	if (glad_glTexStorage3D == glad_trace_glTexStorage3D) glad_glTexStorage3D = glad_trace_next_glTexStorage3D;
+	if (glad_glDrawTransformFeedbackInstanced == glad_trace_glDrawTransformFeedbackInstanced) glad_glDrawTransformFeedbackInstanced = glad_trace_next_glDrawTransformFeedbackInstanced;
+	if (glad_glDrawTransformFeedbackStreamInstanced == glad_trace_glDrawTransformFeedbackStreamInstanced) glad_glDrawTransformFeedbackStreamInstanced = glad_trace_next_glDrawTransformFeedbackStreamInstanced;
+	if (glad_glClearBufferData == glad_trace_glClearBufferData) glad_glClearBufferData = glad_trace_next_glClearBufferData;
+	if (glad_glClearBufferSubData == glad_trace_glClearBufferSubData) glad_glClearBufferSubData = glad_trace_next_glClearBufferSubData;
+	if (glad_glDispatchCompute == glad_trace_glDispatchCompute) glad_glDispatchCompute = glad_trace_next_glDispatchCompute;
+	if (glad_glDispatchComputeIndirect == glad_trace_glDispatchComputeIndirect) glad_glDispatchComputeIndirect = glad_trace_next_glDispatchComputeIndirect;
+	if (glad_glCopyImageSubData == glad_trace_glCopyImageSubData) glad_glCopyImageSubData = glad_trace_next_glCopyImageSubData;
+	if (glad_glFramebufferParameteri == glad_trace_glFramebufferParameteri) glad_glFramebufferParameteri = glad_trace_next_glFramebufferParameteri;
+	if (glad_glInvalidateTexSubImage == glad_trace_glInvalidateTexSubImage) glad_glInvalidateTexSubImage = glad_trace_next_glInvalidateTexSubImage;
+	if (glad_glInvalidateTexImage == glad_trace_glInvalidateTexImage) glad_glInvalidateTexImage = glad_trace_next_glInvalidateTexImage;
+	if (glad_glInvalidateBufferSubData == glad_trace_glInvalidateBufferSubData) glad_glInvalidateBufferSubData = glad_trace_next_glInvalidateBufferSubData;
+	if (glad_glInvalidateBufferData == glad_trace_glInvalidateBufferData) glad_glInvalidateBufferData = glad_trace_next_glInvalidateBufferData;
+	if (glad_glInvalidateFramebuffer == glad_trace_glInvalidateFramebuffer) glad_glInvalidateFramebuffer = glad_trace_next_glInvalidateFramebuffer;
+	if (glad_glInvalidateSubFramebuffer == glad_trace_glInvalidateSubFramebuffer) glad_glInvalidateSubFramebuffer = glad_trace_next_glInvalidateSubFramebuffer;
+	if (glad_glMultiDrawArraysIndirect == glad_trace_glMultiDrawArraysIndirect) glad_glMultiDrawArraysIndirect = glad_trace_next_glMultiDrawArraysIndirect;
+	if (glad_glMultiDrawElementsIndirect == glad_trace_glMultiDrawElementsIndirect) glad_glMultiDrawElementsIndirect = glad_trace_next_glMultiDrawElementsIndirect;
+	if (glad_glShaderStorageBlockBinding == glad_trace_glShaderStorageBlockBinding) glad_glShaderStorageBlockBinding = glad_trace_next_glShaderStorageBlockBinding;
+	if (glad_glTexBufferRange == glad_trace_glTexBufferRange) glad_glTexBufferRange = glad_trace_next_glTexBufferRange;
+	if (glad_glTexStorage2DMultisample == glad_trace_glTexStorage2DMultisample) glad_glTexStorage2DMultisample = glad_trace_next_glTexStorage2DMultisample;
+	if (glad_glTexStorage3DMultisample == glad_trace_glTexStorage3DMultisample) glad_glTexStorage3DMultisample = glad_trace_next_glTexStorage3DMultisample;
+	if (glad_glTextureView == glad_trace_glTextureView) glad_glTextureView = glad_trace_next_glTextureView;
+	if (glad_glBindVertexBuffer == glad_trace_glBindVertexBuffer) glad_glBindVertexBuffer = glad_trace_next_glBindVertexBuffer;
+	if (glad_glVertexAttribFormat == glad_trace_glVertexAttribFormat) glad_glVertexAttribFormat = glad_trace_next_glVertexAttribFormat;
+	if (glad_glVertexAttribIFormat == glad_trace_glVertexAttribIFormat) glad_glVertexAttribIFormat = glad_trace_next_glVertexAttribIFormat;
+	if (glad_glVertexAttribLFormat == glad_trace_glVertexAttribLFormat) glad_glVertexAttribLFormat = glad_trace_next_glVertexAttribLFormat;
+	if (glad_glVertexAttribBinding == glad_trace_glVertexAttribBinding) glad_glVertexAttribBinding = glad_trace_next_glVertexAttribBinding;
+	if (glad_glVertexBindingDivisor == glad_trace_glVertexBindingDivisor) glad_glVertexBindingDivisor = glad_trace_next_glVertexBindingDivisor;
+	if (glad_glDebugMessageControl == glad_trace_glDebugMessageControl) glad_glDebugMessageControl = glad_trace_next_glDebugMessageControl;
+	if (glad_glDebugMessageInsert == glad_trace_glDebugMessageInsert) glad_glDebugMessageInsert = glad_trace_next_glDebugMessageInsert;
+	if (glad_glDebugMessageCallback == glad_trace_glDebugMessageCallback) glad_glDebugMessageCallback = glad_trace_next_glDebugMessageCallback;
+	if (glad_glPushDebugGroup == glad_trace_glPushDebugGroup) glad_glPushDebugGroup = glad_trace_next_glPushDebugGroup;
+	if (glad_glPopDebugGroup == glad_trace_glPopDebugGroup) glad_glPopDebugGroup = glad_trace_next_glPopDebugGroup;
+	if (glad_glObjectLabel == glad_trace_glObjectLabel) glad_glObjectLabel = glad_trace_next_glObjectLabel;
+	if (glad_glObjectPtrLabel == glad_trace_glObjectPtrLabel) glad_glObjectPtrLabel = glad_trace_next_glObjectPtrLabel;
+	if (glad_glBufferStorage == glad_trace_glBufferStorage) glad_glBufferStorage = glad_trace_next_glBufferStorage;
+	if (glad_glClearTexImage == glad_trace_glClearTexImage) glad_glClearTexImage = glad_trace_next_glClearTexImage;
+	if (glad_glClearTexSubImage == glad_trace_glClearTexSubImage) glad_glClearTexSubImage = glad_trace_next_glClearTexSubImage;
+	if (glad_glBindBuffersBase == glad_trace_glBindBuffersBase) glad_glBindBuffersBase = glad_trace_next_glBindBuffersBase;
+	if (glad_glBindBuffersRange == glad_trace_glBindBuffersRange) glad_glBindBuffersRange = glad_trace_next_glBindBuffersRange;
+	if (glad_glBindTextures == glad_trace_glBindTextures) glad_glBindTextures = glad_trace_next_glBindTextures;
+	if (glad_glBindSamplers == glad_trace_glBindSamplers) glad_glBindSamplers = glad_trace_next_glBindSamplers;
+	if (glad_glBindImageTextures == glad_trace_glBindImageTextures) glad_glBindImageTextures = glad_trace_next_glBindImageTextures;
+	if (glad_glBindVertexBuffers == glad_trace_glBindVertexBuffers) glad_glBindVertexBuffers = glad_trace_next_glBindVertexBuffers;
+	if (glad_glClipControl == glad_trace_glClipControl) glad_glClipControl = glad_trace_next_glClipControl;
+	if (glad_glCreateTransformFeedbacks == glad_trace_glCreateTransformFeedbacks) glad_glCreateTransformFeedbacks = glad_trace_next_glCreateTransformFeedbacks;
+	if (glad_glTransformFeedbackBufferBase == glad_trace_glTransformFeedbackBufferBase) glad_glTransformFeedbackBufferBase = glad_trace_next_glTransformFeedbackBufferBase;
+	if (glad_glTransformFeedbackBufferRange == glad_trace_glTransformFeedbackBufferRange) glad_glTransformFeedbackBufferRange = glad_trace_next_glTransformFeedbackBufferRange;
+	if (glad_glCreateBuffers == glad_trace_glCreateBuffers) glad_glCreateBuffers = glad_trace_next_glCreateBuffers;
+	if (glad_glNamedBufferStorage == glad_trace_glNamedBufferStorage) glad_glNamedBufferStorage = glad_trace_next_glNamedBufferStorage;
+	if (glad_glNamedBufferData == glad_trace_glNamedBufferData) glad_glNamedBufferData = glad_trace_next_glNamedBufferData;
+	if (glad_glNamedBufferSubData == glad_trace_glNamedBufferSubData) glad_glNamedBufferSubData = glad_trace_next_glNamedBufferSubData;
+	if (glad_glCopyNamedBufferSubData == glad_trace_glCopyNamedBufferSubData) glad_glCopyNamedBufferSubData = glad_trace_next_glCopyNamedBufferSubData;
+	if (glad_glClearNamedBufferData == glad_trace_glClearNamedBufferData) glad_glClearNamedBufferData = glad_trace_next_glClearNamedBufferData;
+	if (glad_glClearNamedBufferSubData == glad_trace_glClearNamedBufferSubData) glad_glClearNamedBufferSubData = glad_trace_next_glClearNamedBufferSubData;
+	if (glad_glMapNamedBuffer == glad_trace_glMapNamedBuffer) glad_glMapNamedBuffer = glad_trace_next_glMapNamedBuffer;
+	if (glad_glMapNamedBufferRange == glad_trace_glMapNamedBufferRange) glad_glMapNamedBufferRange = glad_trace_next_glMapNamedBufferRange;
+	if (glad_glUnmapNamedBuffer == glad_trace_glUnmapNamedBuffer) glad_glUnmapNamedBuffer = glad_trace_next_glUnmapNamedBuffer;
+	if (glad_glFlushMappedNamedBufferRange == glad_trace_glFlushMappedNamedBufferRange) glad_glFlushMappedNamedBufferRange = glad_trace_next_glFlushMappedNamedBufferRange;
+	if (glad_glCreateFramebuffers == glad_trace_glCreateFramebuffers) glad_glCreateFramebuffers = glad_trace_next_glCreateFramebuffers;
+	if (glad_glNamedFramebufferRenderbuffer == glad_trace_glNamedFramebufferRenderbuffer) glad_glNamedFramebufferRenderbuffer = glad_trace_next_glNamedFramebufferRenderbuffer;
+	if (glad_glNamedFramebufferParameteri == glad_trace_glNamedFramebufferParameteri) glad_glNamedFramebufferParameteri = glad_trace_next_glNamedFramebufferParameteri;
+	if (glad_glNamedFramebufferTexture == glad_trace_glNamedFramebufferTexture) glad_glNamedFramebufferTexture = glad_trace_next_glNamedFramebufferTexture;
+	if (glad_glNamedFramebufferTextureLayer == glad_trace_glNamedFramebufferTextureLayer) glad_glNamedFramebufferTextureLayer = glad_trace_next_glNamedFramebufferTextureLayer;
+	if (glad_glNamedFramebufferDrawBuffer == glad_trace_glNamedFramebufferDrawBuffer) glad_glNamedFramebufferDrawBuffer = glad_trace_next_glNamedFramebufferDrawBuffer;
+	if (glad_glNamedFramebufferDrawBuffers == glad_trace_glNamedFramebufferDrawBuffers) glad_glNamedFramebufferDrawBuffers = glad_trace_next_glNamedFramebufferDrawBuffers;
+	if (glad_glNamedFramebufferReadBuffer == glad_trace_glNamedFramebufferReadBuffer) glad_glNamedFramebufferReadBuffer = glad_trace_next_glNamedFramebufferReadBuffer;
+	if (glad_glInvalidateNamedFramebufferData == glad_trace_glInvalidateNamedFramebufferData) glad_glInvalidateNamedFramebufferData = glad_trace_next_glInvalidateNamedFramebufferData;
+	if (glad_glInvalidateNamedFramebufferSubData == glad_trace_glInvalidateNamedFramebufferSubData) glad_glInvalidateNamedFramebufferSubData = glad_trace_next_glInvalidateNamedFramebufferSubData;
+	if (glad_glClearNamedFramebufferiv == glad_trace_glClearNamedFramebufferiv) glad_glClearNamedFramebufferiv = glad_trace_next_glClearNamedFramebufferiv;
+	if (glad_glClearNamedFramebufferuiv == glad_trace_glClearNamedFramebufferuiv) glad_glClearNamedFramebufferuiv = glad_trace_next_glClearNamedFramebufferuiv;
+	if (glad_glClearNamedFramebufferfv == glad_trace_glClearNamedFramebufferfv) glad_glClearNamedFramebufferfv = glad_trace_next_glClearNamedFramebufferfv;
+	if (glad_glClearNamedFramebufferfi == glad_trace_glClearNamedFramebufferfi) glad_glClearNamedFramebufferfi = glad_trace_next_glClearNamedFramebufferfi;
+	if (glad_glBlitNamedFramebuffer == glad_trace_glBlitNamedFramebuffer) glad_glBlitNamedFramebuffer = glad_trace_next_glBlitNamedFramebuffer;
+	if (glad_glCreateRenderbuffers == glad_trace_glCreateRenderbuffers) glad_glCreateRenderbuffers = glad_trace_next_glCreateRenderbuffers;
+	if (glad_glNamedRenderbufferStorage == glad_trace_glNamedRenderbufferStorage) glad_glNamedRenderbufferStorage = glad_trace_next_glNamedRenderbufferStorage;
+	if (glad_glNamedRenderbufferStorageMultisample == glad_trace_glNamedRenderbufferStorageMultisample) glad_glNamedRenderbufferStorageMultisample = glad_trace_next_glNamedRenderbufferStorageMultisample;
+	if (glad_glCreateTextures == glad_trace_glCreateTextures) glad_glCreateTextures = glad_trace_next_glCreateTextures;
+	if (glad_glTextureBuffer == glad_trace_glTextureBuffer) glad_glTextureBuffer = glad_trace_next_glTextureBuffer;
+	if (glad_glTextureBufferRange == glad_trace_glTextureBufferRange) glad_glTextureBufferRange = glad_trace_next_glTextureBufferRange;
+	if (glad_glTextureStorage1D == glad_trace_glTextureStorage1D) glad_glTextureStorage1D = glad_trace_next_glTextureStorage1D;
+	if (glad_glTextureStorage2D == glad_trace_glTextureStorage2D) glad_glTextureStorage2D = glad_trace_next_glTextureStorage2D;
+	if (glad_glTextureStorage3D == glad_trace_glTextureStorage3D) glad_glTextureStorage3D = glad_trace_next_glTextureStorage3D;
+	if (glad_glTextureStorage2DMultisample == glad_trace_glTextureStorage2DMultisample) glad_glTextureStorage2DMultisample = glad_trace_next_glTextureStorage2DMultisample;
+	if (glad_glTextureStorage3DMultisample == glad_trace_glTextureStorage3DMultisample) glad_glTextureStorage3DMultisample = glad_trace_next_glTextureStorage3DMultisample;
+	if (glad_glTextureSubImage1D == glad_trace_glTextureSubImage1D) glad_glTextureSubImage1D = glad_trace_next_glTextureSubImage1D;
+	if (glad_glTextureSubImage2D == glad_trace_glTextureSubImage2D) glad_glTextureSubImage2D = glad_trace_next_glTextureSubImage2D;
+	if (glad_glTextureSubImage3D == glad_trace_glTextureSubImage3D) glad_glTextureSubImage3D = glad_trace_next_glTextureSubImage3D;
+	if (glad_glCompressedTextureSubImage1D == glad_trace_glCompressedTextureSubImage1D) glad_glCompressedTextureSubImage1D = glad_trace_next_glCompressedTextureSubImage1D;
+	if (glad_glCompressedTextureSubImage2D == glad_trace_glCompressedTextureSubImage2D) glad_glCompressedTextureSubImage2D = glad_trace_next_glCompressedTextureSubImage2D;
+	if (glad_glCompressedTextureSubImage3D == glad_trace_glCompressedTextureSubImage3D) glad_glCompressedTextureSubImage3D = glad_trace_next_glCompressedTextureSubImage3D;
+	if (glad_glCopyTextureSubImage1D == glad_trace_glCopyTextureSubImage1D) glad_glCopyTextureSubImage1D = glad_trace_next_glCopyTextureSubImage1D;
+	if (glad_glCopyTextureSubImage2D == glad_trace_glCopyTextureSubImage2D) glad_glCopyTextureSubImage2D = glad_trace_next_glCopyTextureSubImage2D;
+	if (glad_glCopyTextureSubImage3D == glad_trace_glCopyTextureSubImage3D) glad_glCopyTextureSubImage3D = glad_trace_next_glCopyTextureSubImage3D;
+	if (glad_glTextureParameterf == glad_trace_glTextureParameterf) glad_glTextureParameterf = glad_trace_next_glTextureParameterf;
+	if (glad_glTextureParameterfv == glad_trace_glTextureParameterfv) glad_glTextureParameterfv = glad_trace_next_glTextureParameterfv;
+	if (glad_glTextureParameteri == glad_trace_glTextureParameteri) glad_glTextureParameteri = glad_trace_next_glTextureParameteri;
+	if (glad_glTextureParameterIiv == glad_trace_glTextureParameterIiv) glad_glTextureParameterIiv = glad_trace_next_glTextureParameterIiv;
+	if (glad_glTextureParameterIuiv == glad_trace_glTextureParameterIuiv) glad_glTextureParameterIuiv = glad_trace_next_glTextureParameterIuiv;
+	if (glad_glTextureParameteriv == glad_trace_glTextureParameteriv) glad_glTextureParameteriv = glad_trace_next_glTextureParameteriv;
+	if (glad_glGenerateTextureMipmap == glad_trace_glGenerateTextureMipmap) glad_glGenerateTextureMipmap = glad_trace_next_glGenerateTextureMipmap;
+	if (glad_glBindTextureUnit == glad_trace_glBindTextureUnit) glad_glBindTextureUnit = glad_trace_next_glBindTextureUnit;
+	if (glad_glCreateVertexArrays == glad_trace_glCreateVertexArrays) glad_glCreateVertexArrays = glad_trace_next_glCreateVertexArrays;
+	if (glad_glDisableVertexArrayAttrib == glad_trace_glDisableVertexArrayAttrib) glad_glDisableVertexArrayAttrib = glad_trace_next_glDisableVertexArrayAttrib;
+	if (glad_glEnableVertexArrayAttrib == glad_trace_glEnableVertexArrayAttrib) glad_glEnableVertexArrayAttrib = glad_trace_next_glEnableVertexArrayAttrib;
+	if (glad_glVertexArrayElementBuffer == glad_trace_glVertexArrayElementBuffer) glad_glVertexArrayElementBuffer = glad_trace_next_glVertexArrayElementBuffer;
+	if (glad_glVertexArrayVertexBuffer == glad_trace_glVertexArrayVertexBuffer) glad_glVertexArrayVertexBuffer = glad_trace_next_glVertexArrayVertexBuffer;
+	if (glad_glVertexArrayVertexBuffers == glad_trace_glVertexArrayVertexBuffers) glad_glVertexArrayVertexBuffers = glad_trace_next_glVertexArrayVertexBuffers;
+	if (glad_glVertexArrayAttribBinding == glad_trace_glVertexArrayAttribBinding) glad_glVertexArrayAttribBinding = glad_trace_next_glVertexArrayAttribBinding;
+	if (glad_glVertexArrayAttribFormat == glad_trace_glVertexArrayAttribFormat) glad_glVertexArrayAttribFormat = glad_trace_next_glVertexArrayAttribFormat;
+	if (glad_glVertexArrayAttribIFormat == glad_trace_glVertexArrayAttribIFormat) glad_glVertexArrayAttribIFormat = glad_trace_next_glVertexArrayAttribIFormat;
+	if (glad_glVertexArrayAttribLFormat == glad_trace_glVertexArrayAttribLFormat) glad_glVertexArrayAttribLFormat = glad_trace_next_glVertexArrayAttribLFormat;
+	if (glad_glVertexArrayBindingDivisor == glad_trace_glVertexArrayBindingDivisor) glad_glVertexArrayBindingDivisor = glad_trace_next_glVertexArrayBindingDivisor;
+	if (glad_glCreateSamplers == glad_trace_glCreateSamplers) glad_glCreateSamplers = glad_trace_next_glCreateSamplers;
+	if (glad_glCreateProgramPipelines == glad_trace_glCreateProgramPipelines) glad_glCreateProgramPipelines = glad_trace_next_glCreateProgramPipelines;
+	if (glad_glCreateQueries == glad_trace_glCreateQueries) glad_glCreateQueries = glad_trace_next_glCreateQueries;
+	if (glad_glMemoryBarrierByRegion == glad_trace_glMemoryBarrierByRegion) glad_glMemoryBarrierByRegion = glad_trace_next_glMemoryBarrierByRegion;
+	if (glad_glReadnPixels == glad_trace_glReadnPixels) glad_glReadnPixels = glad_trace_next_glReadnPixels;
+	if (glad_glTextureBarrier == glad_trace_glTextureBarrier) glad_glTextureBarrier = glad_trace_next_glTextureBarrier;
+}
+
+bool gladTraceReplayCall(GLTraceReader *glad_reader, unsigned proc) {
+	switch (proc) {
+	case 0: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		glad_glCullFace(mode);
+		return true;
+	}
+	case 1: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		glad_glFrontFace(mode);
+		return true;
+	}
+	case 2: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		glad_glHint(target, mode);
+		return true;
+	}
+	case 3: {
+		GLfloat width; GLTraceRead(glad_reader, &width, sizeof(width));
+		glad_glLineWidth(width);
+		return true;
+	}
+	case 4: {
+		GLfloat size; GLTraceRead(glad_reader, &size, sizeof(size));
+		glad_glPointSize(size);
+		return true;
+	}
+	case 5: {
+		GLenum face; GLTraceRead(glad_reader, &face, sizeof(face));
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		glad_glPolygonMode(face, mode);
+		return true;
+	}
+	case 6: {
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glScissor(x, y, width, height);
+		return true;
+	}
+	case 7: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLfloat param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glTexParameterf(target, pname, param);
+		return true;
+	}
+	case 8: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLfloat *params = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glTexParameterfv(target, pname, params);
+		return true;
+	}
+	case 9: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLint param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glTexParameteri(target, pname, param);
+		return true;
+	}
+	case 10: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLint *params = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glTexParameteriv(target, pname, params);
+		return true;
+	}
+	case 11: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLint border; GLTraceRead(glad_reader, &border, sizeof(border));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *pixels = GLTraceReadPixels(glad_reader);
+		glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+		return true;
+	}
+	case 12: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLint border; GLTraceRead(glad_reader, &border, sizeof(border));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *pixels = GLTraceReadPixels(glad_reader);
+		glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+		return true;
+	}
+	case 13: {
+		GLenum buf; GLTraceRead(glad_reader, &buf, sizeof(buf));
+		glad_glDrawBuffer(buf);
+		return true;
+	}
+	case 14: {
+		GLbitfield mask; GLTraceRead(glad_reader, &mask, sizeof(mask));
+		glad_glClear(mask);
+		return true;
+	}
+	case 15: {
+		GLfloat red; GLTraceRead(glad_reader, &red, sizeof(red));
+		GLfloat green; GLTraceRead(glad_reader, &green, sizeof(green));
+		GLfloat blue; GLTraceRead(glad_reader, &blue, sizeof(blue));
+		GLfloat alpha; GLTraceRead(glad_reader, &alpha, sizeof(alpha));
+		glad_glClearColor(red, green, blue, alpha);
+		return true;
+	}
+	case 16: {
+		GLint s; GLTraceRead(glad_reader, &s, sizeof(s));
+		glad_glClearStencil(s);
+		return true;
+	}
+	case 17: {
+		GLdouble depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		glad_glClearDepth(depth);
+		return true;
+	}
+	case 18: {
+		GLuint mask; GLTraceRead(glad_reader, &mask, sizeof(mask));
+		glad_glStencilMask(mask);
+		return true;
+	}
+	case 19: {
+		GLboolean red; GLTraceRead(glad_reader, &red, sizeof(red));
+		GLboolean green; GLTraceRead(glad_reader, &green, sizeof(green));
+		GLboolean blue; GLTraceRead(glad_reader, &blue, sizeof(blue));
+		GLboolean alpha; GLTraceRead(glad_reader, &alpha, sizeof(alpha));
+		glad_glColorMask(red, green, blue, alpha);
+		return true;
+	}
+	case 20: {
+		GLboolean flag; GLTraceRead(glad_reader, &flag, sizeof(flag));
+		glad_glDepthMask(flag);
+		return true;
+	}
+	case 21: {
+		GLenum cap; GLTraceRead(glad_reader, &cap, sizeof(cap));
+		glad_glDisable(cap);
+		return true;
+	}
+	case 22: {
+		GLenum cap; GLTraceRead(glad_reader, &cap, sizeof(cap));
+		glad_glEnable(cap);
+		return true;
+	}
+	case 23: {
+		glad_glFinish();
+		return true;
+	}
+	case 24: {
+		glad_glFlush();
+		return true;
+	}
+	case 25: {
+		GLenum sfactor; GLTraceRead(glad_reader, &sfactor, sizeof(sfactor));
+		GLenum dfactor; GLTraceRead(glad_reader, &dfactor, sizeof(dfactor));
+		glad_glBlendFunc(sfactor, dfactor);
+		return true;
+	}
+	case 26: {
+		GLenum opcode; GLTraceRead(glad_reader, &opcode, sizeof(opcode));
+		glad_glLogicOp(opcode);
+		return true;
+	}
+	case 27: {
+		GLenum func; GLTraceRead(glad_reader, &func, sizeof(func));
+		GLint ref; GLTraceRead(glad_reader, &ref, sizeof(ref));
+		GLuint mask; GLTraceRead(glad_reader, &mask, sizeof(mask));
+		glad_glStencilFunc(func, ref, mask);
+		return true;
+	}
+	case 28: {
+		GLenum fail; GLTraceRead(glad_reader, &fail, sizeof(fail));
+		GLenum zfail; GLTraceRead(glad_reader, &zfail, sizeof(zfail));
+		GLenum zpass; GLTraceRead(glad_reader, &zpass, sizeof(zpass));
+		glad_glStencilOp(fail, zfail, zpass);
+		return true;
+	}
+	case 29: {
+		GLenum func; GLTraceRead(glad_reader, &func, sizeof(func));
+		glad_glDepthFunc(func);
+		return true;
+	}
+	case 30: {
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLfloat param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glPixelStoref(pname, param);
+		return true;
+	}
+	case 31: {
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLint param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glPixelStorei(pname, param);
+		return true;
+	}
+	case 32: {
+		GLenum src; GLTraceRead(glad_reader, &src, sizeof(src));
+		glad_glReadBuffer(src);
+		return true;
+	}
+	case 33: {
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		void *pixels = GLTraceReadPixelsOut(glad_reader);
+		glad_glReadPixels(x, y, width, height, format, type, pixels);
+		return true;
+	}
+	case 46: {
+		GLdouble n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLdouble f; GLTraceRead(glad_reader, &f, sizeof(f));
+		glad_glDepthRange(n, f);
+		return true;
+	}
+	case 47: {
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glViewport(x, y, width, height);
+		return true;
+	}
+	case 48: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		glad_glDrawArrays(mode, first, count);
+		return true;
+	}
+	case 49: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indices = (const void *)GLTraceReadOffset(glad_reader);
+		glad_glDrawElements(mode, count, type, indices);
+		return true;
+	}
+	case 50: {
+		GLfloat factor; GLTraceRead(glad_reader, &factor, sizeof(factor));
+		GLfloat units; GLTraceRead(glad_reader, &units, sizeof(units));
+		glad_glPolygonOffset(factor, units);
+		return true;
+	}
+	case 51: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLint border; GLTraceRead(glad_reader, &border, sizeof(border));
+		glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+		return true;
+	}
+	case 52: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLint border; GLTraceRead(glad_reader, &border, sizeof(border));
+		glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+		return true;
+	}
+	case 53: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+		return true;
+	}
+	case 54: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+		return true;
+	}
+	case 55: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *pixels = GLTraceReadPixels(glad_reader);
+		glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+		return true;
+	}
+	case 56: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *pixels = GLTraceReadPixels(glad_reader);
+		glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+		return true;
+	}
+	case 57: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		glad_glBindTexture(target, texture);
+		return true;
+	}
+	case 58: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLuint *textures = GLTraceReadNames(glad_reader, GL_TRACE_TEXTURE);
+		glad_glDeleteTextures(n, textures);
+		return true;
+	}
+	case 59: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *textures = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glGenTextures(n, textures);
+		GLTraceMapNames(glad_reader, GL_TRACE_TEXTURE, textures);
+		return true;
+	}
+	case 61: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLuint start; GLTraceRead(glad_reader, &start, sizeof(start));
+		GLuint end; GLTraceRead(glad_reader, &end, sizeof(end));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indices = (const void *)GLTraceReadOffset(glad_reader);
+		glad_glDrawRangeElements(mode, start, end, count, type, indices);
+		return true;
+	}
+	case 62: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLint border; GLTraceRead(glad_reader, &border, sizeof(border));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *pixels = GLTraceReadPixels(glad_reader);
+		glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+		return true;
+	}
+	case 63: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint zoffset; GLTraceRead(glad_reader, &zoffset, sizeof(zoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *pixels = GLTraceReadPixels(glad_reader);
+		glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+		return true;
+	}
+	case 64: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint zoffset; GLTraceRead(glad_reader, &zoffset, sizeof(zoffset));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+		return true;
+	}
+	case 65: {
+		GLenum texture; GLTraceRead(glad_reader, &texture, sizeof(texture));
+		glad_glActiveTexture(texture);
+		return true;
+	}
+	case 66: {
+		GLfloat value; GLTraceRead(glad_reader, &value, sizeof(value));
+		GLboolean invert; GLTraceRead(glad_reader, &invert, sizeof(invert));
+		glad_glSampleCoverage(value, invert);
+		return true;
+	}
+	case 67: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLint border; GLTraceRead(glad_reader, &border, sizeof(border));
+		GLsizei imageSize; GLTraceRead(glad_reader, &imageSize, sizeof(imageSize));
+		const void *data = GLTraceReadPixels(glad_reader);
+		glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+		return true;
+	}
+	case 68: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLint border; GLTraceRead(glad_reader, &border, sizeof(border));
+		GLsizei imageSize; GLTraceRead(glad_reader, &imageSize, sizeof(imageSize));
+		const void *data = GLTraceReadPixels(glad_reader);
+		glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+		return true;
+	}
+	case 69: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLint border; GLTraceRead(glad_reader, &border, sizeof(border));
+		GLsizei imageSize; GLTraceRead(glad_reader, &imageSize, sizeof(imageSize));
+		const void *data = GLTraceReadPixels(glad_reader);
+		glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+		return true;
+	}
+	case 70: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint zoffset; GLTraceRead(glad_reader, &zoffset, sizeof(zoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLsizei imageSize; GLTraceRead(glad_reader, &imageSize, sizeof(imageSize));
+		const void *data = GLTraceReadPixels(glad_reader);
+		glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+		return true;
+	}
+	case 71: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLsizei imageSize; GLTraceRead(glad_reader, &imageSize, sizeof(imageSize));
+		const void *data = GLTraceReadPixels(glad_reader);
+		glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+		return true;
+	}
+	case 72: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLsizei imageSize; GLTraceRead(glad_reader, &imageSize, sizeof(imageSize));
+		const void *data = GLTraceReadPixels(glad_reader);
+		glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+		return true;
+	}
+	case 74: {
+		GLenum sfactorRGB; GLTraceRead(glad_reader, &sfactorRGB, sizeof(sfactorRGB));
+		GLenum dfactorRGB; GLTraceRead(glad_reader, &dfactorRGB, sizeof(dfactorRGB));
+		GLenum sfactorAlpha; GLTraceRead(glad_reader, &sfactorAlpha, sizeof(sfactorAlpha));
+		GLenum dfactorAlpha; GLTraceRead(glad_reader, &dfactorAlpha, sizeof(dfactorAlpha));
+		glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+		return true;
+	}
+	case 75: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		const GLint *first = (const GLint *)GLTraceReadBlob(glad_reader);
+		const GLsizei *count = (const GLsizei *)GLTraceReadBlob(glad_reader);
+		GLsizei drawcount; GLTraceRead(glad_reader, &drawcount, sizeof(drawcount));
+		glad_glMultiDrawArrays(mode, first, count, drawcount);
+		return true;
+	}
+	case 76: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		const GLsizei *count = (const GLsizei *)GLTraceReadBlob(glad_reader);
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *const*indices = (const void *const*)GLTraceReadBlob(glad_reader);
+		GLsizei drawcount; GLTraceRead(glad_reader, &drawcount, sizeof(drawcount));
+		glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+		return true;
+	}
+	case 77: {
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLfloat param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glPointParameterf(pname, param);
+		return true;
+	}
+	case 78: {
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLfloat *params = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glPointParameterfv(pname, params);
+		return true;
+	}
+	case 79: {
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLint param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glPointParameteri(pname, param);
+		return true;
+	}
+	case 80: {
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLint *params = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glPointParameteriv(pname, params);
+		return true;
+	}
+	case 81: {
+		GLfloat red; GLTraceRead(glad_reader, &red, sizeof(red));
+		GLfloat green; GLTraceRead(glad_reader, &green, sizeof(green));
+		GLfloat blue; GLTraceRead(glad_reader, &blue, sizeof(blue));
+		GLfloat alpha; GLTraceRead(glad_reader, &alpha, sizeof(alpha));
+		glad_glBlendColor(red, green, blue, alpha);
+		return true;
+	}
+	case 82: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		glad_glBlendEquation(mode);
+		return true;
+	}
+	case 83: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *ids = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glGenQueries(n, ids);
+		GLTraceMapNames(glad_reader, GL_TRACE_QUERY, ids);
+		return true;
+	}
+	case 84: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLuint *ids = GLTraceReadNames(glad_reader, GL_TRACE_QUERY);
+		glad_glDeleteQueries(n, ids);
+		return true;
+	}
+	case 86: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id)); id = (GLuint)GLTraceRemap(GL_TRACE_QUERY, id);
+		glad_glBeginQuery(target, id);
+		return true;
+	}
+	case 87: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		glad_glEndQuery(target);
+		return true;
+	}
+	case 91: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		glad_glBindBuffer(target, buffer);
+		return true;
+	}
+	case 92: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLuint *buffers = GLTraceReadNames(glad_reader, GL_TRACE_BUFFER);
+		glad_glDeleteBuffers(n, buffers);
+		return true;
+	}
+	case 93: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *buffers = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glGenBuffers(n, buffers);
+		GLTraceMapNames(glad_reader, GL_TRACE_BUFFER, buffers);
+		return true;
+	}
+	case 95: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		GLenum usage; GLTraceRead(glad_reader, &usage, sizeof(usage));
+		glad_glBufferData(target, size, data, usage);
+		return true;
+	}
+	case 96: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		glad_glBufferSubData(target, offset, size, data);
+		return true;
+	}
+	case 102: {
+		GLenum modeRGB; GLTraceRead(glad_reader, &modeRGB, sizeof(modeRGB));
+		GLenum modeAlpha; GLTraceRead(glad_reader, &modeAlpha, sizeof(modeAlpha));
+		glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+		return true;
+	}
+	case 103: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLenum *bufs = (const GLenum *)GLTraceReadBlob(glad_reader);
+		glad_glDrawBuffers(n, bufs);
+		return true;
+	}
+	case 104: {
+		GLenum face; GLTraceRead(glad_reader, &face, sizeof(face));
+		GLenum sfail; GLTraceRead(glad_reader, &sfail, sizeof(sfail));
+		GLenum dpfail; GLTraceRead(glad_reader, &dpfail, sizeof(dpfail));
+		GLenum dppass; GLTraceRead(glad_reader, &dppass, sizeof(dppass));
+		glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+		return true;
+	}
+	case 105: {
+		GLenum face; GLTraceRead(glad_reader, &face, sizeof(face));
+		GLenum func; GLTraceRead(glad_reader, &func, sizeof(func));
+		GLint ref; GLTraceRead(glad_reader, &ref, sizeof(ref));
+		GLuint mask; GLTraceRead(glad_reader, &mask, sizeof(mask));
+		glad_glStencilFuncSeparate(face, func, ref, mask);
+		return true;
+	}
+	case 106: {
+		GLenum face; GLTraceRead(glad_reader, &face, sizeof(face));
+		GLuint mask; GLTraceRead(glad_reader, &mask, sizeof(mask));
+		glad_glStencilMaskSeparate(face, mask);
+		return true;
+	}
+	case 107: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLuint shader; GLTraceRead(glad_reader, &shader, sizeof(shader)); shader = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, shader);
+		glad_glAttachShader(program, shader);
+		return true;
+	}
+	case 108: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLchar *name = (const GLchar *)GLTraceReadBlob(glad_reader);
+		glad_glBindAttribLocation(program, index, name);
+		return true;
+	}
+	case 109: {
+		GLuint shader; GLTraceRead(glad_reader, &shader, sizeof(shader)); shader = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, shader);
+		glad_glCompileShader(shader);
+		return true;
+	}
+	case 110: {
+		GLuint glad_result = glad_glCreateProgram();
+		u64 glad_recorded; GLTraceRead(glad_reader, &glad_recorded, sizeof(glad_recorded));
+		GLTraceAddMapping(GL_TRACE_PROGRAM, glad_recorded, (u64)(uintptr_t)glad_result);
+		return true;
+	}
+	case 111: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint glad_result = glad_glCreateShader(type);
+		u64 glad_recorded; GLTraceRead(glad_reader, &glad_recorded, sizeof(glad_recorded));
+		GLTraceAddMapping(GL_TRACE_PROGRAM, glad_recorded, (u64)(uintptr_t)glad_result);
+		return true;
+	}
+	case 112: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		glad_glDeleteProgram(program);
+		return true;
+	}
+	case 113: {
+		GLuint shader; GLTraceRead(glad_reader, &shader, sizeof(shader)); shader = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, shader);
+		glad_glDeleteShader(shader);
+		return true;
+	}
+	case 114: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLuint shader; GLTraceRead(glad_reader, &shader, sizeof(shader)); shader = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, shader);
+		glad_glDetachShader(program, shader);
+		return true;
+	}
+	case 115: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		glad_glDisableVertexAttribArray(index);
+		return true;
+	}
+	case 116: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		glad_glEnableVertexAttribArray(index);
+		return true;
+	}
+	case 135: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		glad_glLinkProgram(program);
+		return true;
+	}
+	case 136: {
+		GLuint shader; GLTraceRead(glad_reader, &shader, sizeof(shader)); shader = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, shader);
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLchar *const*string = (const GLchar *const*)GLTraceReadStrings(glad_reader);
+		const GLint *length = NULL;
+		glad_glShaderSource(shader, count, string, length);
+		return true;
+	}
+	case 137: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		glad_glUseProgram(program);
+		return true;
+	}
+	case 138: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLfloat v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		glad_glUniform1f(location, v0);
+		return true;
+	}
+	case 139: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLfloat v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLfloat v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		glad_glUniform2f(location, v0, v1);
+		return true;
+	}
+	case 140: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLfloat v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLfloat v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLfloat v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		glad_glUniform3f(location, v0, v1, v2);
+		return true;
+	}
+	case 141: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLfloat v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLfloat v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLfloat v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		GLfloat v3; GLTraceRead(glad_reader, &v3, sizeof(v3));
+		glad_glUniform4f(location, v0, v1, v2, v3);
+		return true;
+	}
+	case 142: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		glad_glUniform1i(location, v0);
+		return true;
+	}
+	case 143: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		glad_glUniform2i(location, v0, v1);
+		return true;
+	}
+	case 144: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLint v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		glad_glUniform3i(location, v0, v1, v2);
+		return true;
+	}
+	case 145: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLint v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		GLint v3; GLTraceRead(glad_reader, &v3, sizeof(v3));
+		glad_glUniform4i(location, v0, v1, v2, v3);
+		return true;
+	}
+	case 146: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniform1fv(location, count, value);
+		return true;
+	}
+	case 147: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniform2fv(location, count, value);
+		return true;
+	}
+	case 148: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniform3fv(location, count, value);
+		return true;
+	}
+	case 149: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniform4fv(location, count, value);
+		return true;
+	}
+	case 150: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glUniform1iv(location, count, value);
+		return true;
+	}
+	case 151: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glUniform2iv(location, count, value);
+		return true;
+	}
+	case 152: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glUniform3iv(location, count, value);
+		return true;
+	}
+	case 153: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glUniform4iv(location, count, value);
+		return true;
+	}
+	case 154: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix2fv(location, count, transpose, value);
+		return true;
+	}
+	case 155: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix3fv(location, count, transpose, value);
+		return true;
+	}
+	case 156: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix4fv(location, count, transpose, value);
+		return true;
+	}
+	case 157: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		glad_glValidateProgram(program);
+		return true;
+	}
+	case 158: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		glad_glVertexAttrib1d(index, x);
+		return true;
+	}
+	case 159: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib1dv(index, v);
+		return true;
+	}
+	case 160: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLfloat x; GLTraceRead(glad_reader, &x, sizeof(x));
+		glad_glVertexAttrib1f(index, x);
+		return true;
+	}
+	case 161: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib1fv(index, v);
+		return true;
+	}
+	case 162: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLshort x; GLTraceRead(glad_reader, &x, sizeof(x));
+		glad_glVertexAttrib1s(index, x);
+		return true;
+	}
+	case 163: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib1sv(index, v);
+		return true;
+	}
+	case 164: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLdouble y; GLTraceRead(glad_reader, &y, sizeof(y));
+		glad_glVertexAttrib2d(index, x, y);
+		return true;
+	}
+	case 165: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib2dv(index, v);
+		return true;
+	}
+	case 166: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLfloat x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLfloat y; GLTraceRead(glad_reader, &y, sizeof(y));
+		glad_glVertexAttrib2f(index, x, y);
+		return true;
+	}
+	case 167: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib2fv(index, v);
+		return true;
+	}
+	case 168: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLshort x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLshort y; GLTraceRead(glad_reader, &y, sizeof(y));
+		glad_glVertexAttrib2s(index, x, y);
+		return true;
+	}
+	case 169: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib2sv(index, v);
+		return true;
+	}
+	case 170: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLdouble y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLdouble z; GLTraceRead(glad_reader, &z, sizeof(z));
+		glad_glVertexAttrib3d(index, x, y, z);
+		return true;
+	}
+	case 171: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib3dv(index, v);
+		return true;
+	}
+	case 172: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLfloat x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLfloat y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLfloat z; GLTraceRead(glad_reader, &z, sizeof(z));
+		glad_glVertexAttrib3f(index, x, y, z);
+		return true;
+	}
+	case 173: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib3fv(index, v);
+		return true;
+	}
+	case 174: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLshort x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLshort y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLshort z; GLTraceRead(glad_reader, &z, sizeof(z));
+		glad_glVertexAttrib3s(index, x, y, z);
+		return true;
+	}
+	case 175: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib3sv(index, v);
+		return true;
+	}
+	case 176: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLbyte *v = (const GLbyte *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4Nbv(index, v);
+		return true;
+	}
+	case 177: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLint *v = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4Niv(index, v);
+		return true;
+	}
+	case 178: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4Nsv(index, v);
+		return true;
+	}
+	case 179: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLubyte x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLubyte y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLubyte z; GLTraceRead(glad_reader, &z, sizeof(z));
+		GLubyte w; GLTraceRead(glad_reader, &w, sizeof(w));
+		glad_glVertexAttrib4Nub(index, x, y, z, w);
+		return true;
+	}
+	case 180: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLubyte *v = (const GLubyte *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4Nubv(index, v);
+		return true;
+	}
+	case 181: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4Nuiv(index, v);
+		return true;
+	}
+	case 182: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLushort *v = (const GLushort *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4Nusv(index, v);
+		return true;
+	}
+	case 183: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLbyte *v = (const GLbyte *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4bv(index, v);
+		return true;
+	}
+	case 184: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLdouble y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLdouble z; GLTraceRead(glad_reader, &z, sizeof(z));
+		GLdouble w; GLTraceRead(glad_reader, &w, sizeof(w));
+		glad_glVertexAttrib4d(index, x, y, z, w);
+		return true;
+	}
+	case 185: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4dv(index, v);
+		return true;
+	}
+	case 186: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLfloat x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLfloat y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLfloat z; GLTraceRead(glad_reader, &z, sizeof(z));
+		GLfloat w; GLTraceRead(glad_reader, &w, sizeof(w));
+		glad_glVertexAttrib4f(index, x, y, z, w);
+		return true;
+	}
+	case 187: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4fv(index, v);
+		return true;
+	}
+	case 188: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLint *v = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4iv(index, v);
+		return true;
+	}
+	case 189: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLshort x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLshort y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLshort z; GLTraceRead(glad_reader, &z, sizeof(z));
+		GLshort w; GLTraceRead(glad_reader, &w, sizeof(w));
+		glad_glVertexAttrib4s(index, x, y, z, w);
+		return true;
+	}
+	case 190: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4sv(index, v);
+		return true;
+	}
+	case 191: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLubyte *v = (const GLubyte *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4ubv(index, v);
+		return true;
+	}
+	case 192: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4uiv(index, v);
+		return true;
+	}
+	case 193: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLushort *v = (const GLushort *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttrib4usv(index, v);
+		return true;
+	}
+	case 194: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLint size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		GLsizei stride; GLTraceRead(glad_reader, &stride, sizeof(stride));
+		const void *pointer = (const void *)GLTraceReadOffset(glad_reader);
+		glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+		return true;
+	}
+	case 195: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix2x3fv(location, count, transpose, value);
+		return true;
+	}
+	case 196: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix3x2fv(location, count, transpose, value);
+		return true;
+	}
+	case 197: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix2x4fv(location, count, transpose, value);
+		return true;
+	}
+	case 198: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix4x2fv(location, count, transpose, value);
+		return true;
+	}
+	case 199: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix3x4fv(location, count, transpose, value);
+		return true;
+	}
+	case 200: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix4x3fv(location, count, transpose, value);
+		return true;
+	}
+	case 201: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLboolean r; GLTraceRead(glad_reader, &r, sizeof(r));
+		GLboolean g; GLTraceRead(glad_reader, &g, sizeof(g));
+		GLboolean b; GLTraceRead(glad_reader, &b, sizeof(b));
+		GLboolean a; GLTraceRead(glad_reader, &a, sizeof(a));
+		glad_glColorMaski(index, r, g, b, a);
+		return true;
+	}
+	case 204: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		glad_glEnablei(target, index);
+		return true;
+	}
+	case 205: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		glad_glDisablei(target, index);
+		return true;
+	}
+	case 207: {
+		GLenum primitiveMode; GLTraceRead(glad_reader, &primitiveMode, sizeof(primitiveMode));
+		glad_glBeginTransformFeedback(primitiveMode);
+		return true;
+	}
+	case 208: {
+		glad_glEndTransformFeedback();
+		return true;
+	}
+	case 209: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		glad_glBindBufferRange(target, index, buffer, offset, size);
+		return true;
+	}
+	case 210: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		glad_glBindBufferBase(target, index, buffer);
+		return true;
+	}
+	case 211: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLchar *const*varyings = (const GLchar *const*)GLTraceReadStrings(glad_reader);
+		GLenum bufferMode; GLTraceRead(glad_reader, &bufferMode, sizeof(bufferMode));
+		glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+		return true;
+	}
+	case 213: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum clamp; GLTraceRead(glad_reader, &clamp, sizeof(clamp));
+		glad_glClampColor(target, clamp);
+		return true;
+	}
+	case 214: {
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id)); id = (GLuint)GLTraceRemap(GL_TRACE_QUERY, id);
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		glad_glBeginConditionalRender(id, mode);
+		return true;
+	}
+	case 215: {
+		glad_glEndConditionalRender();
+		return true;
+	}
+	case 216: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLint size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLsizei stride; GLTraceRead(glad_reader, &stride, sizeof(stride));
+		const void *pointer = (const void *)GLTraceReadOffset(glad_reader);
+		glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+		return true;
+	}
+	case 219: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		glad_glVertexAttribI1i(index, x);
+		return true;
+	}
+	case 220: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		glad_glVertexAttribI2i(index, x, y);
+		return true;
+	}
+	case 221: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLint z; GLTraceRead(glad_reader, &z, sizeof(z));
+		glad_glVertexAttribI3i(index, x, y, z);
+		return true;
+	}
+	case 222: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLint z; GLTraceRead(glad_reader, &z, sizeof(z));
+		GLint w; GLTraceRead(glad_reader, &w, sizeof(w));
+		glad_glVertexAttribI4i(index, x, y, z, w);
+		return true;
+	}
+	case 223: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		glad_glVertexAttribI1ui(index, x);
+		return true;
+	}
+	case 224: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLuint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		glad_glVertexAttribI2ui(index, x, y);
+		return true;
+	}
+	case 225: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLuint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLuint z; GLTraceRead(glad_reader, &z, sizeof(z));
+		glad_glVertexAttribI3ui(index, x, y, z);
+		return true;
+	}
+	case 226: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLuint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLuint z; GLTraceRead(glad_reader, &z, sizeof(z));
+		GLuint w; GLTraceRead(glad_reader, &w, sizeof(w));
+		glad_glVertexAttribI4ui(index, x, y, z, w);
+		return true;
+	}
+	case 227: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLint *v = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI1iv(index, v);
+		return true;
+	}
+	case 228: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLint *v = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI2iv(index, v);
+		return true;
+	}
+	case 229: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLint *v = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI3iv(index, v);
+		return true;
+	}
+	case 230: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLint *v = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI4iv(index, v);
+		return true;
+	}
+	case 231: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI1uiv(index, v);
+		return true;
+	}
+	case 232: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI2uiv(index, v);
+		return true;
+	}
+	case 233: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI3uiv(index, v);
+		return true;
+	}
+	case 234: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLuint *v = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI4uiv(index, v);
+		return true;
+	}
+	case 235: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLbyte *v = (const GLbyte *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI4bv(index, v);
+		return true;
+	}
+	case 236: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLshort *v = (const GLshort *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI4sv(index, v);
+		return true;
+	}
+	case 237: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLubyte *v = (const GLubyte *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI4ubv(index, v);
+		return true;
+	}
+	case 238: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLushort *v = (const GLushort *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribI4usv(index, v);
+		return true;
+	}
+	case 240: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLuint color; GLTraceRead(glad_reader, &color, sizeof(color));
+		const GLchar *name = (const GLchar *)GLTraceReadBlob(glad_reader);
+		glad_glBindFragDataLocation(program, color, name);
+		return true;
+	}
+	case 242: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLuint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		glad_glUniform1ui(location, v0);
+		return true;
+	}
+	case 243: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLuint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLuint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		glad_glUniform2ui(location, v0, v1);
+		return true;
+	}
+	case 244: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLuint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLuint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLuint v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		glad_glUniform3ui(location, v0, v1, v2);
+		return true;
+	}
+	case 245: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLuint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLuint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLuint v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		GLuint v3; GLTraceRead(glad_reader, &v3, sizeof(v3));
+		glad_glUniform4ui(location, v0, v1, v2, v3);
+		return true;
+	}
+	case 246: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glUniform1uiv(location, count, value);
+		return true;
+	}
+	case 247: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glUniform2uiv(location, count, value);
+		return true;
+	}
+	case 248: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glUniform3uiv(location, count, value);
+		return true;
+	}
+	case 249: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glUniform4uiv(location, count, value);
+		return true;
+	}
+	case 250: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLint *params = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glTexParameterIiv(target, pname, params);
+		return true;
+	}
+	case 251: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLuint *params = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glTexParameterIuiv(target, pname, params);
+		return true;
+	}
+	case 254: {
+		GLenum buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer));
+		GLint drawbuffer; GLTraceRead(glad_reader, &drawbuffer, sizeof(drawbuffer));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glClearBufferiv(buffer, drawbuffer, value);
+		return true;
+	}
+	case 255: {
+		GLenum buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer));
+		GLint drawbuffer; GLTraceRead(glad_reader, &drawbuffer, sizeof(drawbuffer));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glClearBufferuiv(buffer, drawbuffer, value);
+		return true;
+	}
+	case 256: {
+		GLenum buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer));
+		GLint drawbuffer; GLTraceRead(glad_reader, &drawbuffer, sizeof(drawbuffer));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glClearBufferfv(buffer, drawbuffer, value);
+		return true;
+	}
+	case 257: {
+		GLenum buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer));
+		GLint drawbuffer; GLTraceRead(glad_reader, &drawbuffer, sizeof(drawbuffer));
+		GLfloat depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLint stencil; GLTraceRead(glad_reader, &stencil, sizeof(stencil));
+		glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+		return true;
+	}
+	case 260: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint renderbuffer; GLTraceRead(glad_reader, &renderbuffer, sizeof(renderbuffer)); renderbuffer = (GLuint)GLTraceRemap(GL_TRACE_RENDERBUFFER, renderbuffer);
+		glad_glBindRenderbuffer(target, renderbuffer);
+		return true;
+	}
+	case 261: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLuint *renderbuffers = GLTraceReadNames(glad_reader, GL_TRACE_RENDERBUFFER);
+		glad_glDeleteRenderbuffers(n, renderbuffers);
+		return true;
+	}
+	case 262: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *renderbuffers = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glGenRenderbuffers(n, renderbuffers);
+		GLTraceMapNames(glad_reader, GL_TRACE_RENDERBUFFER, renderbuffers);
+		return true;
+	}
+	case 263: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glRenderbufferStorage(target, internalformat, width, height);
+		return true;
+	}
+	case 266: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		glad_glBindFramebuffer(target, framebuffer);
+		return true;
+	}
+	case 267: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLuint *framebuffers = GLTraceReadNames(glad_reader, GL_TRACE_FRAMEBUFFER);
+		glad_glDeleteFramebuffers(n, framebuffers);
+		return true;
+	}
+	case 268: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *framebuffers = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glGenFramebuffers(n, framebuffers);
+		GLTraceMapNames(glad_reader, GL_TRACE_FRAMEBUFFER, framebuffers);
+		return true;
+	}
+	case 270: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum attachment; GLTraceRead(glad_reader, &attachment, sizeof(attachment));
+		GLenum textarget; GLTraceRead(glad_reader, &textarget, sizeof(textarget));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+		return true;
+	}
+	case 271: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum attachment; GLTraceRead(glad_reader, &attachment, sizeof(attachment));
+		GLenum textarget; GLTraceRead(glad_reader, &textarget, sizeof(textarget));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+		return true;
+	}
+	case 272: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum attachment; GLTraceRead(glad_reader, &attachment, sizeof(attachment));
+		GLenum textarget; GLTraceRead(glad_reader, &textarget, sizeof(textarget));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint zoffset; GLTraceRead(glad_reader, &zoffset, sizeof(zoffset));
+		glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+		return true;
+	}
+	case 273: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum attachment; GLTraceRead(glad_reader, &attachment, sizeof(attachment));
+		GLenum renderbuffertarget; GLTraceRead(glad_reader, &renderbuffertarget, sizeof(renderbuffertarget));
+		GLuint renderbuffer; GLTraceRead(glad_reader, &renderbuffer, sizeof(renderbuffer)); renderbuffer = (GLuint)GLTraceRemap(GL_TRACE_RENDERBUFFER, renderbuffer);
+		glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+		return true;
+	}
+	case 275: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		glad_glGenerateMipmap(target);
+		return true;
+	}
+	case 276: {
+		GLint srcX0; GLTraceRead(glad_reader, &srcX0, sizeof(srcX0));
+		GLint srcY0; GLTraceRead(glad_reader, &srcY0, sizeof(srcY0));
+		GLint srcX1; GLTraceRead(glad_reader, &srcX1, sizeof(srcX1));
+		GLint srcY1; GLTraceRead(glad_reader, &srcY1, sizeof(srcY1));
+		GLint dstX0; GLTraceRead(glad_reader, &dstX0, sizeof(dstX0));
+		GLint dstY0; GLTraceRead(glad_reader, &dstY0, sizeof(dstY0));
+		GLint dstX1; GLTraceRead(glad_reader, &dstX1, sizeof(dstX1));
+		GLint dstY1; GLTraceRead(glad_reader, &dstY1, sizeof(dstY1));
+		GLbitfield mask; GLTraceRead(glad_reader, &mask, sizeof(mask));
+		GLenum filter; GLTraceRead(glad_reader, &filter, sizeof(filter));
+		glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+		return true;
+	}
+	case 277: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei samples; GLTraceRead(glad_reader, &samples, sizeof(samples));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+		return true;
+	}
+	case 278: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum attachment; GLTraceRead(glad_reader, &attachment, sizeof(attachment));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint layer; GLTraceRead(glad_reader, &layer, sizeof(layer));
+		glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+		return true;
+	}
+	case 281: {
+		GLuint array; GLTraceRead(glad_reader, &array, sizeof(array)); array = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, array);
+		glad_glBindVertexArray(array);
+		return true;
+	}
+	case 282: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLuint *arrays = GLTraceReadNames(glad_reader, GL_TRACE_VERTEX_ARRAY);
+		glad_glDeleteVertexArrays(n, arrays);
+		return true;
+	}
+	case 283: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *arrays = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glGenVertexArrays(n, arrays);
+		GLTraceMapNames(glad_reader, GL_TRACE_VERTEX_ARRAY, arrays);
+		return true;
+	}
+	case 285: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLsizei instancecount; GLTraceRead(glad_reader, &instancecount, sizeof(instancecount));
+		glad_glDrawArraysInstanced(mode, first, count, instancecount);
+		return true;
+	}
+	case 286: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indices = (const void *)GLTraceReadOffset(glad_reader);
+		GLsizei instancecount; GLTraceRead(glad_reader, &instancecount, sizeof(instancecount));
+		glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+		return true;
+	}
+	case 287: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		glad_glTexBuffer(target, internalformat, buffer);
+		return true;
+	}
+	case 288: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		glad_glPrimitiveRestartIndex(index);
+		return true;
+	}
+	case 289: {
+		GLenum readTarget; GLTraceRead(glad_reader, &readTarget, sizeof(readTarget));
+		GLenum writeTarget; GLTraceRead(glad_reader, &writeTarget, sizeof(writeTarget));
+		GLintptr readOffset; GLTraceRead(glad_reader, &readOffset, sizeof(readOffset));
+		GLintptr writeOffset; GLTraceRead(glad_reader, &writeOffset, sizeof(writeOffset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+		return true;
+	}
+	case 296: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLuint uniformBlockIndex; GLTraceRead(glad_reader, &uniformBlockIndex, sizeof(uniformBlockIndex));
+		GLuint uniformBlockBinding; GLTraceRead(glad_reader, &uniformBlockBinding, sizeof(uniformBlockBinding));
+		glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+		return true;
+	}
+	case 297: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indices = (const void *)GLTraceReadOffset(glad_reader);
+		GLint basevertex; GLTraceRead(glad_reader, &basevertex, sizeof(basevertex));
+		glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+		return true;
+	}
+	case 298: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLuint start; GLTraceRead(glad_reader, &start, sizeof(start));
+		GLuint end; GLTraceRead(glad_reader, &end, sizeof(end));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indices = (const void *)GLTraceReadOffset(glad_reader);
+		GLint basevertex; GLTraceRead(glad_reader, &basevertex, sizeof(basevertex));
+		glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+		return true;
+	}
+	case 299: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indices = (const void *)GLTraceReadOffset(glad_reader);
+		GLsizei instancecount; GLTraceRead(glad_reader, &instancecount, sizeof(instancecount));
+		GLint basevertex; GLTraceRead(glad_reader, &basevertex, sizeof(basevertex));
+		glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+		return true;
+	}
+	case 300: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		const GLsizei *count = (const GLsizei *)GLTraceReadBlob(glad_reader);
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *const*indices = (const void *const*)GLTraceReadBlob(glad_reader);
+		GLsizei drawcount; GLTraceRead(glad_reader, &drawcount, sizeof(drawcount));
+		const GLint *basevertex = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+		return true;
+	}
+	case 301: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		glad_glProvokingVertex(mode);
+		return true;
+	}
+	case 302: {
+		GLenum condition; GLTraceRead(glad_reader, &condition, sizeof(condition));
+		GLbitfield flags; GLTraceRead(glad_reader, &flags, sizeof(flags));
+		GLsync glad_result = glad_glFenceSync(condition, flags);
+		u64 glad_recorded; GLTraceRead(glad_reader, &glad_recorded, sizeof(glad_recorded));
+		GLTraceAddMapping(GL_TRACE_SYNC, glad_recorded, (u64)(uintptr_t)glad_result);
+		return true;
+	}
+	case 304: {
+		u64 glad_sync; GLTraceRead(glad_reader, &glad_sync, sizeof(glad_sync)); GLsync sync = (GLsync)(uintptr_t)GLTraceRemap(GL_TRACE_SYNC, glad_sync);
+		glad_glDeleteSync(sync);
+		return true;
+	}
+	case 305: {
+		u64 glad_sync; GLTraceRead(glad_reader, &glad_sync, sizeof(glad_sync)); GLsync sync = (GLsync)(uintptr_t)GLTraceRemap(GL_TRACE_SYNC, glad_sync);
+		GLbitfield flags; GLTraceRead(glad_reader, &flags, sizeof(flags));
+		GLuint64 timeout; GLTraceRead(glad_reader, &timeout, sizeof(timeout));
+		glad_glClientWaitSync(sync, flags, timeout);
+		return true;
+	}
+	case 306: {
+		u64 glad_sync; GLTraceRead(glad_reader, &glad_sync, sizeof(glad_sync)); GLsync sync = (GLsync)(uintptr_t)GLTraceRemap(GL_TRACE_SYNC, glad_sync);
+		GLbitfield flags; GLTraceRead(glad_reader, &flags, sizeof(flags));
+		GLuint64 timeout; GLTraceRead(glad_reader, &timeout, sizeof(timeout));
+		glad_glWaitSync(sync, flags, timeout);
+		return true;
+	}
+	case 311: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum attachment; GLTraceRead(glad_reader, &attachment, sizeof(attachment));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		glad_glFramebufferTexture(target, attachment, texture, level);
+		return true;
+	}
+	case 312: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei samples; GLTraceRead(glad_reader, &samples, sizeof(samples));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLboolean fixedsamplelocations; GLTraceRead(glad_reader, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+		return true;
+	}
+	case 313: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei samples; GLTraceRead(glad_reader, &samples, sizeof(samples));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLboolean fixedsamplelocations; GLTraceRead(glad_reader, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+		return true;
+	}
+	case 315: {
+		GLuint maskNumber; GLTraceRead(glad_reader, &maskNumber, sizeof(maskNumber));
+		GLbitfield mask; GLTraceRead(glad_reader, &mask, sizeof(mask));
+		glad_glSampleMaski(maskNumber, mask);
+		return true;
+	}
+	case 316: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLuint colorNumber; GLTraceRead(glad_reader, &colorNumber, sizeof(colorNumber));
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLchar *name = (const GLchar *)GLTraceReadBlob(glad_reader);
+		glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+		return true;
+	}
+	case 318: {
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLuint *samplers = GLTraceScratch((u64)(count) * sizeof(GLuint));
+		glad_glGenSamplers(count, samplers);
+		GLTraceMapNames(glad_reader, GL_TRACE_SAMPLER, samplers);
+		return true;
+	}
+	case 319: {
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *samplers = GLTraceReadNames(glad_reader, GL_TRACE_SAMPLER);
+		glad_glDeleteSamplers(count, samplers);
+		return true;
+	}
+	case 321: {
+		GLuint unit; GLTraceRead(glad_reader, &unit, sizeof(unit));
+		GLuint sampler; GLTraceRead(glad_reader, &sampler, sizeof(sampler)); sampler = (GLuint)GLTraceRemap(GL_TRACE_SAMPLER, sampler);
+		glad_glBindSampler(unit, sampler);
+		return true;
+	}
+	case 322: {
+		GLuint sampler; GLTraceRead(glad_reader, &sampler, sizeof(sampler)); sampler = (GLuint)GLTraceRemap(GL_TRACE_SAMPLER, sampler);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLint param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glSamplerParameteri(sampler, pname, param);
+		return true;
+	}
+	case 323: {
+		GLuint sampler; GLTraceRead(glad_reader, &sampler, sizeof(sampler)); sampler = (GLuint)GLTraceRemap(GL_TRACE_SAMPLER, sampler);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLint *param = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glSamplerParameteriv(sampler, pname, param);
+		return true;
+	}
+	case 324: {
+		GLuint sampler; GLTraceRead(glad_reader, &sampler, sizeof(sampler)); sampler = (GLuint)GLTraceRemap(GL_TRACE_SAMPLER, sampler);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLfloat param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glSamplerParameterf(sampler, pname, param);
+		return true;
+	}
+	case 325: {
+		GLuint sampler; GLTraceRead(glad_reader, &sampler, sizeof(sampler)); sampler = (GLuint)GLTraceRemap(GL_TRACE_SAMPLER, sampler);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLfloat *param = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glSamplerParameterfv(sampler, pname, param);
+		return true;
+	}
+	case 326: {
+		GLuint sampler; GLTraceRead(glad_reader, &sampler, sizeof(sampler)); sampler = (GLuint)GLTraceRemap(GL_TRACE_SAMPLER, sampler);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLint *param = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glSamplerParameterIiv(sampler, pname, param);
+		return true;
+	}
+	case 327: {
+		GLuint sampler; GLTraceRead(glad_reader, &sampler, sizeof(sampler)); sampler = (GLuint)GLTraceRemap(GL_TRACE_SAMPLER, sampler);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLuint *param = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glSamplerParameterIuiv(sampler, pname, param);
+		return true;
+	}
+	case 332: {
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id)); id = (GLuint)GLTraceRemap(GL_TRACE_QUERY, id);
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		glad_glQueryCounter(id, target);
+		return true;
+	}
+	case 335: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint divisor; GLTraceRead(glad_reader, &divisor, sizeof(divisor));
+		glad_glVertexAttribDivisor(index, divisor);
+		return true;
+	}
+	case 336: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		GLuint value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glVertexAttribP1ui(index, type, normalized, value);
+		return true;
+	}
+	case 337: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribP1uiv(index, type, normalized, value);
+		return true;
+	}
+	case 338: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		GLuint value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glVertexAttribP2ui(index, type, normalized, value);
+		return true;
+	}
+	case 339: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribP2uiv(index, type, normalized, value);
+		return true;
+	}
+	case 340: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		GLuint value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glVertexAttribP3ui(index, type, normalized, value);
+		return true;
+	}
+	case 341: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribP3uiv(index, type, normalized, value);
+		return true;
+	}
+	case 342: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		GLuint value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glVertexAttribP4ui(index, type, normalized, value);
+		return true;
+	}
+	case 343: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribP4uiv(index, type, normalized, value);
+		return true;
+	}
+	case 344: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glVertexP2ui(type, value);
+		return true;
+	}
+	case 345: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexP2uiv(type, value);
+		return true;
+	}
+	case 346: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glVertexP3ui(type, value);
+		return true;
+	}
+	case 347: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexP3uiv(type, value);
+		return true;
+	}
+	case 348: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glVertexP4ui(type, value);
+		return true;
+	}
+	case 349: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glVertexP4uiv(type, value);
+		return true;
+	}
+	case 350: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint coords; GLTraceRead(glad_reader, &coords, sizeof(coords));
+		glad_glTexCoordP1ui(type, coords);
+		return true;
+	}
+	case 351: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glTexCoordP1uiv(type, coords);
+		return true;
+	}
+	case 352: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint coords; GLTraceRead(glad_reader, &coords, sizeof(coords));
+		glad_glTexCoordP2ui(type, coords);
+		return true;
+	}
+	case 353: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glTexCoordP2uiv(type, coords);
+		return true;
+	}
+	case 354: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint coords; GLTraceRead(glad_reader, &coords, sizeof(coords));
+		glad_glTexCoordP3ui(type, coords);
+		return true;
+	}
+	case 355: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glTexCoordP3uiv(type, coords);
+		return true;
+	}
+	case 356: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint coords; GLTraceRead(glad_reader, &coords, sizeof(coords));
+		glad_glTexCoordP4ui(type, coords);
+		return true;
+	}
+	case 357: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glTexCoordP4uiv(type, coords);
+		return true;
+	}
+	case 358: {
+		GLenum texture; GLTraceRead(glad_reader, &texture, sizeof(texture));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint coords; GLTraceRead(glad_reader, &coords, sizeof(coords));
+		glad_glMultiTexCoordP1ui(texture, type, coords);
+		return true;
+	}
+	case 359: {
+		GLenum texture; GLTraceRead(glad_reader, &texture, sizeof(texture));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glMultiTexCoordP1uiv(texture, type, coords);
+		return true;
+	}
+	case 360: {
+		GLenum texture; GLTraceRead(glad_reader, &texture, sizeof(texture));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint coords; GLTraceRead(glad_reader, &coords, sizeof(coords));
+		glad_glMultiTexCoordP2ui(texture, type, coords);
+		return true;
+	}
+	case 361: {
+		GLenum texture; GLTraceRead(glad_reader, &texture, sizeof(texture));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glMultiTexCoordP2uiv(texture, type, coords);
+		return true;
+	}
+	case 362: {
+		GLenum texture; GLTraceRead(glad_reader, &texture, sizeof(texture));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint coords; GLTraceRead(glad_reader, &coords, sizeof(coords));
+		glad_glMultiTexCoordP3ui(texture, type, coords);
+		return true;
+	}
+	case 363: {
+		GLenum texture; GLTraceRead(glad_reader, &texture, sizeof(texture));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glMultiTexCoordP3uiv(texture, type, coords);
+		return true;
+	}
+	case 364: {
+		GLenum texture; GLTraceRead(glad_reader, &texture, sizeof(texture));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint coords; GLTraceRead(glad_reader, &coords, sizeof(coords));
+		glad_glMultiTexCoordP4ui(texture, type, coords);
+		return true;
+	}
+	case 365: {
+		GLenum texture; GLTraceRead(glad_reader, &texture, sizeof(texture));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glMultiTexCoordP4uiv(texture, type, coords);
+		return true;
+	}
+	case 366: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint coords; GLTraceRead(glad_reader, &coords, sizeof(coords));
+		glad_glNormalP3ui(type, coords);
+		return true;
+	}
+	case 367: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *coords = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glNormalP3uiv(type, coords);
+		return true;
+	}
+	case 368: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint color; GLTraceRead(glad_reader, &color, sizeof(color));
+		glad_glColorP3ui(type, color);
+		return true;
+	}
+	case 369: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *color = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glColorP3uiv(type, color);
+		return true;
+	}
+	case 370: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint color; GLTraceRead(glad_reader, &color, sizeof(color));
+		glad_glColorP4ui(type, color);
+		return true;
+	}
+	case 371: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *color = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glColorP4uiv(type, color);
+		return true;
+	}
+	case 372: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint color; GLTraceRead(glad_reader, &color, sizeof(color));
+		glad_glSecondaryColorP3ui(type, color);
+		return true;
+	}
+	case 373: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const GLuint *color = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glSecondaryColorP3uiv(type, color);
+		return true;
+	}
+	case 374: {
+		GLfloat value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glMinSampleShading(value);
+		return true;
+	}
+	case 375: {
+		GLuint buf; GLTraceRead(glad_reader, &buf, sizeof(buf));
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		glad_glBlendEquationi(buf, mode);
+		return true;
+	}
+	case 376: {
+		GLuint buf; GLTraceRead(glad_reader, &buf, sizeof(buf));
+		GLenum modeRGB; GLTraceRead(glad_reader, &modeRGB, sizeof(modeRGB));
+		GLenum modeAlpha; GLTraceRead(glad_reader, &modeAlpha, sizeof(modeAlpha));
+		glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+		return true;
+	}
+	case 377: {
+		GLuint buf; GLTraceRead(glad_reader, &buf, sizeof(buf));
+		GLenum src; GLTraceRead(glad_reader, &src, sizeof(src));
+		GLenum dst; GLTraceRead(glad_reader, &dst, sizeof(dst));
+		glad_glBlendFunci(buf, src, dst);
+		return true;
+	}
+	case 378: {
+		GLuint buf; GLTraceRead(glad_reader, &buf, sizeof(buf));
+		GLenum srcRGB; GLTraceRead(glad_reader, &srcRGB, sizeof(srcRGB));
+		GLenum dstRGB; GLTraceRead(glad_reader, &dstRGB, sizeof(dstRGB));
+		GLenum srcAlpha; GLTraceRead(glad_reader, &srcAlpha, sizeof(srcAlpha));
+		GLenum dstAlpha; GLTraceRead(glad_reader, &dstAlpha, sizeof(dstAlpha));
+		glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+		return true;
+	}
+	case 379: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		const void *indirect = (const void *)GLTraceReadOffset(glad_reader);
+		glad_glDrawArraysIndirect(mode, indirect);
+		return true;
+	}
+	case 380: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indirect = (const void *)GLTraceReadOffset(glad_reader);
+		glad_glDrawElementsIndirect(mode, type, indirect);
+		return true;
+	}
+	case 381: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		glad_glUniform1d(location, x);
+		return true;
+	}
+	case 382: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLdouble y; GLTraceRead(glad_reader, &y, sizeof(y));
+		glad_glUniform2d(location, x, y);
+		return true;
+	}
+	case 383: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLdouble y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLdouble z; GLTraceRead(glad_reader, &z, sizeof(z));
+		glad_glUniform3d(location, x, y, z);
+		return true;
+	}
+	case 384: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLdouble y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLdouble z; GLTraceRead(glad_reader, &z, sizeof(z));
+		GLdouble w; GLTraceRead(glad_reader, &w, sizeof(w));
+		glad_glUniform4d(location, x, y, z, w);
+		return true;
+	}
+	case 385: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniform1dv(location, count, value);
+		return true;
+	}
+	case 386: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniform2dv(location, count, value);
+		return true;
+	}
+	case 387: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniform3dv(location, count, value);
+		return true;
+	}
+	case 388: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniform4dv(location, count, value);
+		return true;
+	}
+	case 389: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix2dv(location, count, transpose, value);
+		return true;
+	}
+	case 390: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix3dv(location, count, transpose, value);
+		return true;
+	}
+	case 391: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix4dv(location, count, transpose, value);
+		return true;
+	}
+	case 392: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix2x3dv(location, count, transpose, value);
+		return true;
+	}
+	case 393: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix2x4dv(location, count, transpose, value);
+		return true;
+	}
+	case 394: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix3x2dv(location, count, transpose, value);
+		return true;
+	}
+	case 395: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix3x4dv(location, count, transpose, value);
+		return true;
+	}
+	case 396: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix4x2dv(location, count, transpose, value);
+		return true;
+	}
+	case 397: {
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glUniformMatrix4x3dv(location, count, transpose, value);
+		return true;
+	}
+	case 404: {
+		GLenum shadertype; GLTraceRead(glad_reader, &shadertype, sizeof(shadertype));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *indices = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glUniformSubroutinesuiv(shadertype, count, indices);
+		return true;
+	}
+	case 407: {
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLint value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glPatchParameteri(pname, value);
+		return true;
+	}
+	case 408: {
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLfloat *values = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glPatchParameterfv(pname, values);
+		return true;
+	}
+	case 409: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id)); id = (GLuint)GLTraceRemap(GL_TRACE_TRANSFORM_FEEDBACK, id);
+		glad_glBindTransformFeedback(target, id);
+		return true;
+	}
+	case 410: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLuint *ids = GLTraceReadNames(glad_reader, GL_TRACE_TRANSFORM_FEEDBACK);
+		glad_glDeleteTransformFeedbacks(n, ids);
+		return true;
+	}
+	case 411: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *ids = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glGenTransformFeedbacks(n, ids);
+		GLTraceMapNames(glad_reader, GL_TRACE_TRANSFORM_FEEDBACK, ids);
+		return true;
+	}
+	case 413: {
+		glad_glPauseTransformFeedback();
+		return true;
+	}
+	case 414: {
+		glad_glResumeTransformFeedback();
+		return true;
+	}
+	case 415: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id)); id = (GLuint)GLTraceRemap(GL_TRACE_TRANSFORM_FEEDBACK, id);
+		glad_glDrawTransformFeedback(mode, id);
+		return true;
+	}
+	case 416: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id)); id = (GLuint)GLTraceRemap(GL_TRACE_TRANSFORM_FEEDBACK, id);
+		GLuint stream; GLTraceRead(glad_reader, &stream, sizeof(stream));
+		glad_glDrawTransformFeedbackStream(mode, id, stream);
+		return true;
+	}
+	case 417: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id)); id = (GLuint)GLTraceRemap(GL_TRACE_QUERY, id);
+		glad_glBeginQueryIndexed(target, index, id);
+		return true;
+	}
+	case 418: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		glad_glEndQueryIndexed(target, index);
+		return true;
+	}
+	case 420: {
+		glad_glReleaseShaderCompiler();
+		return true;
+	}
+	case 421: {
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *shaders = GLTraceReadNames(glad_reader, GL_TRACE_PROGRAM);
+		GLenum binaryformat; GLTraceRead(glad_reader, &binaryformat, sizeof(binaryformat));
+		const void *binary = (const void *)GLTraceReadBlob(glad_reader);
+		GLsizei length; GLTraceRead(glad_reader, &length, sizeof(length));
+		glad_glShaderBinary(count, shaders, binaryformat, binary, length);
+		return true;
+	}
+	case 423: {
+		GLfloat n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLfloat f; GLTraceRead(glad_reader, &f, sizeof(f));
+		glad_glDepthRangef(n, f);
+		return true;
+	}
+	case 424: {
+		GLfloat d; GLTraceRead(glad_reader, &d, sizeof(d));
+		glad_glClearDepthf(d);
+		return true;
+	}
+	case 426: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLenum binaryFormat; GLTraceRead(glad_reader, &binaryFormat, sizeof(binaryFormat));
+		const void *binary = (const void *)GLTraceReadBlob(glad_reader);
+		GLsizei length; GLTraceRead(glad_reader, &length, sizeof(length));
+		glad_glProgramBinary(program, binaryFormat, binary, length);
+		return true;
+	}
+	case 427: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLint value; GLTraceRead(glad_reader, &value, sizeof(value));
+		glad_glProgramParameteri(program, pname, value);
+		return true;
+	}
+	case 428: {
+		GLuint pipeline; GLTraceRead(glad_reader, &pipeline, sizeof(pipeline)); pipeline = (GLuint)GLTraceRemap(GL_TRACE_PIPELINE, pipeline);
+		GLbitfield stages; GLTraceRead(glad_reader, &stages, sizeof(stages));
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		glad_glUseProgramStages(pipeline, stages, program);
+		return true;
+	}
+	case 429: {
+		GLuint pipeline; GLTraceRead(glad_reader, &pipeline, sizeof(pipeline)); pipeline = (GLuint)GLTraceRemap(GL_TRACE_PIPELINE, pipeline);
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		glad_glActiveShaderProgram(pipeline, program);
+		return true;
+	}
+	case 430: {
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLchar *const*strings = (const GLchar *const*)GLTraceReadStrings(glad_reader);
+		GLuint glad_result = glad_glCreateShaderProgramv(type, count, strings);
+		u64 glad_recorded; GLTraceRead(glad_reader, &glad_recorded, sizeof(glad_recorded));
+		GLTraceAddMapping(GL_TRACE_PROGRAM, glad_recorded, (u64)(uintptr_t)glad_result);
+		return true;
+	}
+	case 431: {
+		GLuint pipeline; GLTraceRead(glad_reader, &pipeline, sizeof(pipeline)); pipeline = (GLuint)GLTraceRemap(GL_TRACE_PIPELINE, pipeline);
+		glad_glBindProgramPipeline(pipeline);
+		return true;
+	}
+	case 432: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLuint *pipelines = GLTraceReadNames(glad_reader, GL_TRACE_PIPELINE);
+		glad_glDeleteProgramPipelines(n, pipelines);
+		return true;
+	}
+	case 433: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *pipelines = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glGenProgramPipelines(n, pipelines);
+		GLTraceMapNames(glad_reader, GL_TRACE_PIPELINE, pipelines);
+		return true;
+	}
+	case 436: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		glad_glProgramUniform1i(program, location, v0);
+		return true;
+	}
+	case 437: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform1iv(program, location, count, value);
+		return true;
+	}
+	case 438: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLfloat v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		glad_glProgramUniform1f(program, location, v0);
+		return true;
+	}
+	case 439: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform1fv(program, location, count, value);
+		return true;
+	}
+	case 440: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLdouble v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		glad_glProgramUniform1d(program, location, v0);
+		return true;
+	}
+	case 441: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform1dv(program, location, count, value);
+		return true;
+	}
+	case 442: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLuint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		glad_glProgramUniform1ui(program, location, v0);
+		return true;
+	}
+	case 443: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform1uiv(program, location, count, value);
+		return true;
+	}
+	case 444: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		glad_glProgramUniform2i(program, location, v0, v1);
+		return true;
+	}
+	case 445: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform2iv(program, location, count, value);
+		return true;
+	}
+	case 446: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLfloat v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLfloat v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		glad_glProgramUniform2f(program, location, v0, v1);
+		return true;
+	}
+	case 447: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform2fv(program, location, count, value);
+		return true;
+	}
+	case 448: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLdouble v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLdouble v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		glad_glProgramUniform2d(program, location, v0, v1);
+		return true;
+	}
+	case 449: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform2dv(program, location, count, value);
+		return true;
+	}
+	case 450: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLuint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLuint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		glad_glProgramUniform2ui(program, location, v0, v1);
+		return true;
+	}
+	case 451: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform2uiv(program, location, count, value);
+		return true;
+	}
+	case 452: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLint v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		glad_glProgramUniform3i(program, location, v0, v1, v2);
+		return true;
+	}
+	case 453: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform3iv(program, location, count, value);
+		return true;
+	}
+	case 454: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLfloat v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLfloat v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLfloat v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		glad_glProgramUniform3f(program, location, v0, v1, v2);
+		return true;
+	}
+	case 455: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform3fv(program, location, count, value);
+		return true;
+	}
+	case 456: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLdouble v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLdouble v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLdouble v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		glad_glProgramUniform3d(program, location, v0, v1, v2);
+		return true;
+	}
+	case 457: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform3dv(program, location, count, value);
+		return true;
+	}
+	case 458: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLuint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLuint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLuint v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		glad_glProgramUniform3ui(program, location, v0, v1, v2);
+		return true;
+	}
+	case 459: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform3uiv(program, location, count, value);
+		return true;
+	}
+	case 460: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLint v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		GLint v3; GLTraceRead(glad_reader, &v3, sizeof(v3));
+		glad_glProgramUniform4i(program, location, v0, v1, v2, v3);
+		return true;
+	}
+	case 461: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform4iv(program, location, count, value);
+		return true;
+	}
+	case 462: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLfloat v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLfloat v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLfloat v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		GLfloat v3; GLTraceRead(glad_reader, &v3, sizeof(v3));
+		glad_glProgramUniform4f(program, location, v0, v1, v2, v3);
+		return true;
+	}
+	case 463: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform4fv(program, location, count, value);
+		return true;
+	}
+	case 464: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLdouble v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLdouble v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLdouble v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		GLdouble v3; GLTraceRead(glad_reader, &v3, sizeof(v3));
+		glad_glProgramUniform4d(program, location, v0, v1, v2, v3);
+		return true;
+	}
+	case 465: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform4dv(program, location, count, value);
+		return true;
+	}
+	case 466: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLuint v0; GLTraceRead(glad_reader, &v0, sizeof(v0));
+		GLuint v1; GLTraceRead(glad_reader, &v1, sizeof(v1));
+		GLuint v2; GLTraceRead(glad_reader, &v2, sizeof(v2));
+		GLuint v3; GLTraceRead(glad_reader, &v3, sizeof(v3));
+		glad_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+		return true;
+	}
+	case 467: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniform4uiv(program, location, count, value);
+		return true;
+	}
+	case 468: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+		return true;
+	}
+	case 469: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+		return true;
+	}
+	case 470: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+		return true;
+	}
+	case 471: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+		return true;
+	}
+	case 472: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+		return true;
+	}
+	case 473: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+		return true;
+	}
+	case 474: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+		return true;
+	}
+	case 475: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+		return true;
+	}
+	case 476: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+		return true;
+	}
+	case 477: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+		return true;
+	}
+	case 478: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+		return true;
+	}
+	case 479: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+		return true;
+	}
+	case 480: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+		return true;
+	}
+	case 481: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+		return true;
+	}
+	case 482: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+		return true;
+	}
+	case 483: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+		return true;
+	}
+	case 484: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+		return true;
+	}
+	case 485: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLint location; GLTraceRead(glad_reader, &location, sizeof(location));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLboolean transpose; GLTraceRead(glad_reader, &transpose, sizeof(transpose));
+		const GLdouble *value = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+		return true;
+	}
+	case 486: {
+		GLuint pipeline; GLTraceRead(glad_reader, &pipeline, sizeof(pipeline)); pipeline = (GLuint)GLTraceRemap(GL_TRACE_PIPELINE, pipeline);
+		glad_glValidateProgramPipeline(pipeline);
+		return true;
+	}
+	case 488: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		glad_glVertexAttribL1d(index, x);
+		return true;
+	}
+	case 489: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLdouble y; GLTraceRead(glad_reader, &y, sizeof(y));
+		glad_glVertexAttribL2d(index, x, y);
+		return true;
+	}
+	case 490: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLdouble y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLdouble z; GLTraceRead(glad_reader, &z, sizeof(z));
+		glad_glVertexAttribL3d(index, x, y, z);
+		return true;
+	}
+	case 491: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLdouble x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLdouble y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLdouble z; GLTraceRead(glad_reader, &z, sizeof(z));
+		GLdouble w; GLTraceRead(glad_reader, &w, sizeof(w));
+		glad_glVertexAttribL4d(index, x, y, z, w);
+		return true;
+	}
+	case 492: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribL1dv(index, v);
+		return true;
+	}
+	case 493: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribL2dv(index, v);
+		return true;
+	}
+	case 494: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribL3dv(index, v);
+		return true;
+	}
+	case 495: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLdouble *v = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glVertexAttribL4dv(index, v);
+		return true;
+	}
+	case 496: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLint size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLsizei stride; GLTraceRead(glad_reader, &stride, sizeof(stride));
+		const void *pointer = (const void *)GLTraceReadOffset(glad_reader);
+		glad_glVertexAttribLPointer(index, size, type, stride, pointer);
+		return true;
+	}
+	case 498: {
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLfloat *v = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glViewportArrayv(first, count, v);
+		return true;
+	}
+	case 499: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLfloat x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLfloat y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLfloat w; GLTraceRead(glad_reader, &w, sizeof(w));
+		GLfloat h; GLTraceRead(glad_reader, &h, sizeof(h));
+		glad_glViewportIndexedf(index, x, y, w, h);
+		return true;
+	}
+	case 500: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLfloat *v = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glViewportIndexedfv(index, v);
+		return true;
+	}
+	case 501: {
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLint *v = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glScissorArrayv(first, count, v);
+		return true;
+	}
+	case 502: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLint left; GLTraceRead(glad_reader, &left, sizeof(left));
+		GLint bottom; GLTraceRead(glad_reader, &bottom, sizeof(bottom));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glScissorIndexed(index, left, bottom, width, height);
+		return true;
+	}
+	case 503: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		const GLint *v = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glScissorIndexedv(index, v);
+		return true;
+	}
+	case 504: {
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLdouble *v = (const GLdouble *)GLTraceReadBlob(glad_reader);
+		glad_glDepthRangeArrayv(first, count, v);
+		return true;
+	}
+	case 505: {
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLdouble n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLdouble f; GLTraceRead(glad_reader, &f, sizeof(f));
+		glad_glDepthRangeIndexed(index, n, f);
+		return true;
+	}
+	case 508: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLsizei instancecount; GLTraceRead(glad_reader, &instancecount, sizeof(instancecount));
+		GLuint baseinstance; GLTraceRead(glad_reader, &baseinstance, sizeof(baseinstance));
+		glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+		return true;
+	}
+	case 509: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indices = (const void *)GLTraceReadOffset(glad_reader);
+		GLsizei instancecount; GLTraceRead(glad_reader, &instancecount, sizeof(instancecount));
+		GLuint baseinstance; GLTraceRead(glad_reader, &baseinstance, sizeof(baseinstance));
+		glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+		return true;
+	}
+	case 510: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indices = (const void *)GLTraceReadOffset(glad_reader);
+		GLsizei instancecount; GLTraceRead(glad_reader, &instancecount, sizeof(instancecount));
+		GLint basevertex; GLTraceRead(glad_reader, &basevertex, sizeof(basevertex));
+		GLuint baseinstance; GLTraceRead(glad_reader, &baseinstance, sizeof(baseinstance));
+		glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+		return true;
+	}
+	case 513: {
+		GLuint unit; GLTraceRead(glad_reader, &unit, sizeof(unit));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLboolean layered; GLTraceRead(glad_reader, &layered, sizeof(layered));
+		GLint layer; GLTraceRead(glad_reader, &layer, sizeof(layer));
+		GLenum access; GLTraceRead(glad_reader, &access, sizeof(access));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		glad_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+		return true;
+	}
+	case 514: {
+		GLbitfield barriers; GLTraceRead(glad_reader, &barriers, sizeof(barriers));
+		glad_glMemoryBarrier(barriers);
+		return true;
+	}
+	case 515: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei levels; GLTraceRead(glad_reader, &levels, sizeof(levels));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		glad_glTexStorage1D(target, levels, internalformat, width);
+		return true;
+	}
+	case 516: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei levels; GLTraceRead(glad_reader, &levels, sizeof(levels));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glTexStorage2D(target, levels, internalformat, width, height);
+		return true;
+	}
+	case 517: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei levels; GLTraceRead(glad_reader, &levels, sizeof(levels));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		glad_glTexStorage3D(target, levels, internalformat, width, height, depth);
+		return true;
+	}
+	case 518: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id)); id = (GLuint)GLTraceRemap(GL_TRACE_TRANSFORM_FEEDBACK, id);
+		GLsizei instancecount; GLTraceRead(glad_reader, &instancecount, sizeof(instancecount));
+		glad_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+		return true;
+	}
+	case 519: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id)); id = (GLuint)GLTraceRemap(GL_TRACE_TRANSFORM_FEEDBACK, id);
+		GLuint stream; GLTraceRead(glad_reader, &stream, sizeof(stream));
+		GLsizei instancecount; GLTraceRead(glad_reader, &instancecount, sizeof(instancecount));
+		glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+		return true;
+	}
+	case 520: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		glad_glClearBufferData(target, internalformat, format, type, data);
+		return true;
+	}
+	case 521: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+		return true;
+	}
+	case 522: {
+		GLuint num_groups_x; GLTraceRead(glad_reader, &num_groups_x, sizeof(num_groups_x));
+		GLuint num_groups_y; GLTraceRead(glad_reader, &num_groups_y, sizeof(num_groups_y));
+		GLuint num_groups_z; GLTraceRead(glad_reader, &num_groups_z, sizeof(num_groups_z));
+		glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+		return true;
+	}
+	case 523: {
+		GLintptr indirect; GLTraceRead(glad_reader, &indirect, sizeof(indirect));
+		glad_glDispatchComputeIndirect(indirect);
+		return true;
+	}
+	case 524: {
+		GLuint srcName; GLTraceRead(glad_reader, &srcName, sizeof(srcName)); srcName = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, srcName);
+		GLenum srcTarget; GLTraceRead(glad_reader, &srcTarget, sizeof(srcTarget));
+		GLint srcLevel; GLTraceRead(glad_reader, &srcLevel, sizeof(srcLevel));
+		GLint srcX; GLTraceRead(glad_reader, &srcX, sizeof(srcX));
+		GLint srcY; GLTraceRead(glad_reader, &srcY, sizeof(srcY));
+		GLint srcZ; GLTraceRead(glad_reader, &srcZ, sizeof(srcZ));
+		GLuint dstName; GLTraceRead(glad_reader, &dstName, sizeof(dstName)); dstName = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, dstName);
+		GLenum dstTarget; GLTraceRead(glad_reader, &dstTarget, sizeof(dstTarget));
+		GLint dstLevel; GLTraceRead(glad_reader, &dstLevel, sizeof(dstLevel));
+		GLint dstX; GLTraceRead(glad_reader, &dstX, sizeof(dstX));
+		GLint dstY; GLTraceRead(glad_reader, &dstY, sizeof(dstY));
+		GLint dstZ; GLTraceRead(glad_reader, &dstZ, sizeof(dstZ));
+		GLsizei srcWidth; GLTraceRead(glad_reader, &srcWidth, sizeof(srcWidth));
+		GLsizei srcHeight; GLTraceRead(glad_reader, &srcHeight, sizeof(srcHeight));
+		GLsizei srcDepth; GLTraceRead(glad_reader, &srcDepth, sizeof(srcDepth));
+		glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+		return true;
+	}
+	case 525: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLint param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glFramebufferParameteri(target, pname, param);
+		return true;
+	}
+	case 528: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint zoffset; GLTraceRead(glad_reader, &zoffset, sizeof(zoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+		return true;
+	}
+	case 529: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		glad_glInvalidateTexImage(texture, level);
+		return true;
+	}
+	case 530: {
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizeiptr length; GLTraceRead(glad_reader, &length, sizeof(length));
+		glad_glInvalidateBufferSubData(buffer, offset, length);
+		return true;
+	}
+	case 531: {
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		glad_glInvalidateBufferData(buffer);
+		return true;
+	}
+	case 532: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei numAttachments; GLTraceRead(glad_reader, &numAttachments, sizeof(numAttachments));
+		const GLenum *attachments = (const GLenum *)GLTraceReadBlob(glad_reader);
+		glad_glInvalidateFramebuffer(target, numAttachments, attachments);
+		return true;
+	}
+	case 533: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei numAttachments; GLTraceRead(glad_reader, &numAttachments, sizeof(numAttachments));
+		const GLenum *attachments = (const GLenum *)GLTraceReadBlob(glad_reader);
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+		return true;
+	}
+	case 534: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		const void *indirect = (const void *)GLTraceReadOffset(glad_reader);
+		GLsizei drawcount; GLTraceRead(glad_reader, &drawcount, sizeof(drawcount));
+		GLsizei stride; GLTraceRead(glad_reader, &stride, sizeof(stride));
+		glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+		return true;
+	}
+	case 535: {
+		GLenum mode; GLTraceRead(glad_reader, &mode, sizeof(mode));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *indirect = (const void *)GLTraceReadOffset(glad_reader);
+		GLsizei drawcount; GLTraceRead(glad_reader, &drawcount, sizeof(drawcount));
+		GLsizei stride; GLTraceRead(glad_reader, &stride, sizeof(stride));
+		glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+		return true;
+	}
+	case 542: {
+		GLuint program; GLTraceRead(glad_reader, &program, sizeof(program)); program = (GLuint)GLTraceRemap(GL_TRACE_PROGRAM, program);
+		GLuint storageBlockIndex; GLTraceRead(glad_reader, &storageBlockIndex, sizeof(storageBlockIndex));
+		GLuint storageBlockBinding; GLTraceRead(glad_reader, &storageBlockBinding, sizeof(storageBlockBinding));
+		glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+		return true;
+	}
+	case 543: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		glad_glTexBufferRange(target, internalformat, buffer, offset, size);
+		return true;
+	}
+	case 544: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei samples; GLTraceRead(glad_reader, &samples, sizeof(samples));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLboolean fixedsamplelocations; GLTraceRead(glad_reader, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+		return true;
+	}
+	case 545: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei samples; GLTraceRead(glad_reader, &samples, sizeof(samples));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLboolean fixedsamplelocations; GLTraceRead(glad_reader, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+		return true;
+	}
+	case 546: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint origtexture; GLTraceRead(glad_reader, &origtexture, sizeof(origtexture)); origtexture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, origtexture);
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLuint minlevel; GLTraceRead(glad_reader, &minlevel, sizeof(minlevel));
+		GLuint numlevels; GLTraceRead(glad_reader, &numlevels, sizeof(numlevels));
+		GLuint minlayer; GLTraceRead(glad_reader, &minlayer, sizeof(minlayer));
+		GLuint numlayers; GLTraceRead(glad_reader, &numlayers, sizeof(numlayers));
+		glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+		return true;
+	}
+	case 547: {
+		GLuint bindingindex; GLTraceRead(glad_reader, &bindingindex, sizeof(bindingindex));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizei stride; GLTraceRead(glad_reader, &stride, sizeof(stride));
+		glad_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+		return true;
+	}
+	case 548: {
+		GLuint attribindex; GLTraceRead(glad_reader, &attribindex, sizeof(attribindex));
+		GLint size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		GLuint relativeoffset; GLTraceRead(glad_reader, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+		return true;
+	}
+	case 549: {
+		GLuint attribindex; GLTraceRead(glad_reader, &attribindex, sizeof(attribindex));
+		GLint size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint relativeoffset; GLTraceRead(glad_reader, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+		return true;
+	}
+	case 550: {
+		GLuint attribindex; GLTraceRead(glad_reader, &attribindex, sizeof(attribindex));
+		GLint size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint relativeoffset; GLTraceRead(glad_reader, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+		return true;
+	}
+	case 551: {
+		GLuint attribindex; GLTraceRead(glad_reader, &attribindex, sizeof(attribindex));
+		GLuint bindingindex; GLTraceRead(glad_reader, &bindingindex, sizeof(bindingindex));
+		glad_glVertexAttribBinding(attribindex, bindingindex);
+		return true;
+	}
+	case 552: {
+		GLuint bindingindex; GLTraceRead(glad_reader, &bindingindex, sizeof(bindingindex));
+		GLuint divisor; GLTraceRead(glad_reader, &divisor, sizeof(divisor));
+		glad_glVertexBindingDivisor(bindingindex, divisor);
+		return true;
+	}
+	case 553: {
+		GLenum source; GLTraceRead(glad_reader, &source, sizeof(source));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLenum severity; GLTraceRead(glad_reader, &severity, sizeof(severity));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *ids = (const GLuint *)GLTraceReadBlob(glad_reader);
+		GLboolean enabled; GLTraceRead(glad_reader, &enabled, sizeof(enabled));
+		glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+		return true;
+	}
+	case 554: {
+		GLenum source; GLTraceRead(glad_reader, &source, sizeof(source));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id));
+		GLenum severity; GLTraceRead(glad_reader, &severity, sizeof(severity));
+		GLsizei length; GLTraceRead(glad_reader, &length, sizeof(length));
+		const GLchar *buf = (const GLchar *)GLTraceReadBlob(glad_reader);
+		glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+		return true;
+	}
+	case 557: {
+		GLenum source; GLTraceRead(glad_reader, &source, sizeof(source));
+		GLuint id; GLTraceRead(glad_reader, &id, sizeof(id));
+		GLsizei length; GLTraceRead(glad_reader, &length, sizeof(length));
+		const GLchar *message = (const GLchar *)GLTraceReadBlob(glad_reader);
+		glad_glPushDebugGroup(source, id, length, message);
+		return true;
+	}
+	case 558: {
+		glad_glPopDebugGroup();
+		return true;
+	}
+	case 559: {
+		GLenum identifier; GLTraceRead(glad_reader, &identifier, sizeof(identifier));
+		GLuint name; GLTraceRead(glad_reader, &name, sizeof(name));
+		GLsizei length; GLTraceRead(glad_reader, &length, sizeof(length));
+		const GLchar *label = (const GLchar *)GLTraceReadBlob(glad_reader);
+		glad_glObjectLabel(identifier, name, length, label);
+		return true;
+	}
+	case 564: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		GLbitfield flags; GLTraceRead(glad_reader, &flags, sizeof(flags));
+		glad_glBufferStorage(target, size, data, flags);
+		return true;
+	}
+	case 565: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		glad_glClearTexImage(texture, level, format, type, data);
+		return true;
+	}
+	case 566: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint zoffset; GLTraceRead(glad_reader, &zoffset, sizeof(zoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+		return true;
+	}
+	case 567: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *buffers = GLTraceReadNames(glad_reader, GL_TRACE_BUFFER);
+		glad_glBindBuffersBase(target, first, count, buffers);
+		return true;
+	}
+	case 568: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *buffers = GLTraceReadNames(glad_reader, GL_TRACE_BUFFER);
+		const GLintptr *offsets = (const GLintptr *)GLTraceReadBlob(glad_reader);
+		const GLsizeiptr *sizes = (const GLsizeiptr *)GLTraceReadBlob(glad_reader);
+		glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+		return true;
+	}
+	case 569: {
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *textures = GLTraceReadNames(glad_reader, GL_TRACE_TEXTURE);
+		glad_glBindTextures(first, count, textures);
+		return true;
+	}
+	case 570: {
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *samplers = GLTraceReadNames(glad_reader, GL_TRACE_SAMPLER);
+		glad_glBindSamplers(first, count, samplers);
+		return true;
+	}
+	case 571: {
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *textures = GLTraceReadNames(glad_reader, GL_TRACE_TEXTURE);
+		glad_glBindImageTextures(first, count, textures);
+		return true;
+	}
+	case 572: {
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *buffers = GLTraceReadNames(glad_reader, GL_TRACE_BUFFER);
+		const GLintptr *offsets = (const GLintptr *)GLTraceReadBlob(glad_reader);
+		const GLsizei *strides = (const GLsizei *)GLTraceReadBlob(glad_reader);
+		glad_glBindVertexBuffers(first, count, buffers, offsets, strides);
+		return true;
+	}
+	case 573: {
+		GLenum origin; GLTraceRead(glad_reader, &origin, sizeof(origin));
+		GLenum depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		glad_glClipControl(origin, depth);
+		return true;
+	}
+	case 574: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *ids = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glCreateTransformFeedbacks(n, ids);
+		GLTraceMapNames(glad_reader, GL_TRACE_TRANSFORM_FEEDBACK, ids);
+		return true;
+	}
+	case 575: {
+		GLuint xfb; GLTraceRead(glad_reader, &xfb, sizeof(xfb)); xfb = (GLuint)GLTraceRemap(GL_TRACE_TRANSFORM_FEEDBACK, xfb);
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		glad_glTransformFeedbackBufferBase(xfb, index, buffer);
+		return true;
+	}
+	case 576: {
+		GLuint xfb; GLTraceRead(glad_reader, &xfb, sizeof(xfb)); xfb = (GLuint)GLTraceRemap(GL_TRACE_TRANSFORM_FEEDBACK, xfb);
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+		return true;
+	}
+	case 580: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *buffers = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glCreateBuffers(n, buffers);
+		GLTraceMapNames(glad_reader, GL_TRACE_BUFFER, buffers);
+		return true;
+	}
+	case 581: {
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		GLbitfield flags; GLTraceRead(glad_reader, &flags, sizeof(flags));
+		glad_glNamedBufferStorage(buffer, size, data, flags);
+		return true;
+	}
+	case 582: {
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		GLenum usage; GLTraceRead(glad_reader, &usage, sizeof(usage));
+		glad_glNamedBufferData(buffer, size, data, usage);
+		return true;
+	}
+	case 583: {
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		glad_glNamedBufferSubData(buffer, offset, size, data);
+		return true;
+	}
+	case 584: {
+		GLuint readBuffer; GLTraceRead(glad_reader, &readBuffer, sizeof(readBuffer)); readBuffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, readBuffer);
+		GLuint writeBuffer; GLTraceRead(glad_reader, &writeBuffer, sizeof(writeBuffer)); writeBuffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, writeBuffer);
+		GLintptr readOffset; GLTraceRead(glad_reader, &readOffset, sizeof(readOffset));
+		GLintptr writeOffset; GLTraceRead(glad_reader, &writeOffset, sizeof(writeOffset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+		return true;
+	}
+	case 585: {
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		glad_glClearNamedBufferData(buffer, internalformat, format, type, data);
+		return true;
+	}
+	case 586: {
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *data = (const void *)GLTraceReadBlob(glad_reader);
+		glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+		return true;
+	}
+	case 595: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *framebuffers = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glCreateFramebuffers(n, framebuffers);
+		GLTraceMapNames(glad_reader, GL_TRACE_FRAMEBUFFER, framebuffers);
+		return true;
+	}
+	case 596: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum attachment; GLTraceRead(glad_reader, &attachment, sizeof(attachment));
+		GLenum renderbuffertarget; GLTraceRead(glad_reader, &renderbuffertarget, sizeof(renderbuffertarget));
+		GLuint renderbuffer; GLTraceRead(glad_reader, &renderbuffer, sizeof(renderbuffer)); renderbuffer = (GLuint)GLTraceRemap(GL_TRACE_RENDERBUFFER, renderbuffer);
+		glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+		return true;
+	}
+	case 597: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLint param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glNamedFramebufferParameteri(framebuffer, pname, param);
+		return true;
+	}
+	case 598: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum attachment; GLTraceRead(glad_reader, &attachment, sizeof(attachment));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+		return true;
+	}
+	case 599: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum attachment; GLTraceRead(glad_reader, &attachment, sizeof(attachment));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint layer; GLTraceRead(glad_reader, &layer, sizeof(layer));
+		glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+		return true;
+	}
+	case 600: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum buf; GLTraceRead(glad_reader, &buf, sizeof(buf));
+		glad_glNamedFramebufferDrawBuffer(framebuffer, buf);
+		return true;
+	}
+	case 601: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		const GLenum *bufs = (const GLenum *)GLTraceReadBlob(glad_reader);
+		glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+		return true;
+	}
+	case 602: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum src; GLTraceRead(glad_reader, &src, sizeof(src));
+		glad_glNamedFramebufferReadBuffer(framebuffer, src);
+		return true;
+	}
+	case 603: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLsizei numAttachments; GLTraceRead(glad_reader, &numAttachments, sizeof(numAttachments));
+		const GLenum *attachments = (const GLenum *)GLTraceReadBlob(glad_reader);
+		glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+		return true;
+	}
+	case 604: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLsizei numAttachments; GLTraceRead(glad_reader, &numAttachments, sizeof(numAttachments));
+		const GLenum *attachments = (const GLenum *)GLTraceReadBlob(glad_reader);
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+		return true;
+	}
+	case 605: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer));
+		GLint drawbuffer; GLTraceRead(glad_reader, &drawbuffer, sizeof(drawbuffer));
+		const GLint *value = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+		return true;
+	}
+	case 606: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer));
+		GLint drawbuffer; GLTraceRead(glad_reader, &drawbuffer, sizeof(drawbuffer));
+		const GLuint *value = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+		return true;
+	}
+	case 607: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer));
+		GLint drawbuffer; GLTraceRead(glad_reader, &drawbuffer, sizeof(drawbuffer));
+		const GLfloat *value = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+		return true;
+	}
+	case 608: {
+		GLuint framebuffer; GLTraceRead(glad_reader, &framebuffer, sizeof(framebuffer)); framebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, framebuffer);
+		GLenum buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer));
+		GLint drawbuffer; GLTraceRead(glad_reader, &drawbuffer, sizeof(drawbuffer));
+		GLfloat depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLint stencil; GLTraceRead(glad_reader, &stencil, sizeof(stencil));
+		glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+		return true;
+	}
+	case 609: {
+		GLuint readFramebuffer; GLTraceRead(glad_reader, &readFramebuffer, sizeof(readFramebuffer)); readFramebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, readFramebuffer);
+		GLuint drawFramebuffer; GLTraceRead(glad_reader, &drawFramebuffer, sizeof(drawFramebuffer)); drawFramebuffer = (GLuint)GLTraceRemap(GL_TRACE_FRAMEBUFFER, drawFramebuffer);
+		GLint srcX0; GLTraceRead(glad_reader, &srcX0, sizeof(srcX0));
+		GLint srcY0; GLTraceRead(glad_reader, &srcY0, sizeof(srcY0));
+		GLint srcX1; GLTraceRead(glad_reader, &srcX1, sizeof(srcX1));
+		GLint srcY1; GLTraceRead(glad_reader, &srcY1, sizeof(srcY1));
+		GLint dstX0; GLTraceRead(glad_reader, &dstX0, sizeof(dstX0));
+		GLint dstY0; GLTraceRead(glad_reader, &dstY0, sizeof(dstY0));
+		GLint dstX1; GLTraceRead(glad_reader, &dstX1, sizeof(dstX1));
+		GLint dstY1; GLTraceRead(glad_reader, &dstY1, sizeof(dstY1));
+		GLbitfield mask; GLTraceRead(glad_reader, &mask, sizeof(mask));
+		GLenum filter; GLTraceRead(glad_reader, &filter, sizeof(filter));
+		glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+		return true;
+	}
+	case 613: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *renderbuffers = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glCreateRenderbuffers(n, renderbuffers);
+		GLTraceMapNames(glad_reader, GL_TRACE_RENDERBUFFER, renderbuffers);
+		return true;
+	}
+	case 614: {
+		GLuint renderbuffer; GLTraceRead(glad_reader, &renderbuffer, sizeof(renderbuffer)); renderbuffer = (GLuint)GLTraceRemap(GL_TRACE_RENDERBUFFER, renderbuffer);
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+		return true;
+	}
+	case 615: {
+		GLuint renderbuffer; GLTraceRead(glad_reader, &renderbuffer, sizeof(renderbuffer)); renderbuffer = (GLuint)GLTraceRemap(GL_TRACE_RENDERBUFFER, renderbuffer);
+		GLsizei samples; GLTraceRead(glad_reader, &samples, sizeof(samples));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+		return true;
+	}
+	case 617: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *textures = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glCreateTextures(target, n, textures);
+		GLTraceMapNames(glad_reader, GL_TRACE_TEXTURE, textures);
+		return true;
+	}
+	case 618: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		glad_glTextureBuffer(texture, internalformat, buffer);
+		return true;
+	}
+	case 619: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizeiptr size; GLTraceRead(glad_reader, &size, sizeof(size));
+		glad_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+		return true;
+	}
+	case 620: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLsizei levels; GLTraceRead(glad_reader, &levels, sizeof(levels));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		glad_glTextureStorage1D(texture, levels, internalformat, width);
+		return true;
+	}
+	case 621: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLsizei levels; GLTraceRead(glad_reader, &levels, sizeof(levels));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glTextureStorage2D(texture, levels, internalformat, width, height);
+		return true;
+	}
+	case 622: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLsizei levels; GLTraceRead(glad_reader, &levels, sizeof(levels));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+		return true;
+	}
+	case 623: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLsizei samples; GLTraceRead(glad_reader, &samples, sizeof(samples));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLboolean fixedsamplelocations; GLTraceRead(glad_reader, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+		return true;
+	}
+	case 624: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLsizei samples; GLTraceRead(glad_reader, &samples, sizeof(samples));
+		GLenum internalformat; GLTraceRead(glad_reader, &internalformat, sizeof(internalformat));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLboolean fixedsamplelocations; GLTraceRead(glad_reader, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+		return true;
+	}
+	case 625: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *pixels = GLTraceReadPixels(glad_reader);
+		glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+		return true;
+	}
+	case 626: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *pixels = GLTraceReadPixels(glad_reader);
+		glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+		return true;
+	}
+	case 627: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint zoffset; GLTraceRead(glad_reader, &zoffset, sizeof(zoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		const void *pixels = GLTraceReadPixels(glad_reader);
+		glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+		return true;
+	}
+	case 628: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLsizei imageSize; GLTraceRead(glad_reader, &imageSize, sizeof(imageSize));
+		const void *data = GLTraceReadPixels(glad_reader);
+		glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+		return true;
+	}
+	case 629: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLsizei imageSize; GLTraceRead(glad_reader, &imageSize, sizeof(imageSize));
+		const void *data = GLTraceReadPixels(glad_reader);
+		glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+		return true;
+	}
+	case 630: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint zoffset; GLTraceRead(glad_reader, &zoffset, sizeof(zoffset));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLsizei depth; GLTraceRead(glad_reader, &depth, sizeof(depth));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLsizei imageSize; GLTraceRead(glad_reader, &imageSize, sizeof(imageSize));
+		const void *data = GLTraceReadPixels(glad_reader);
+		glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+		return true;
+	}
+	case 631: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+		return true;
+	}
+	case 632: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+		return true;
+	}
+	case 633: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLint level; GLTraceRead(glad_reader, &level, sizeof(level));
+		GLint xoffset; GLTraceRead(glad_reader, &xoffset, sizeof(xoffset));
+		GLint yoffset; GLTraceRead(glad_reader, &yoffset, sizeof(yoffset));
+		GLint zoffset; GLTraceRead(glad_reader, &zoffset, sizeof(zoffset));
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+		return true;
+	}
+	case 634: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLfloat param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glTextureParameterf(texture, pname, param);
+		return true;
+	}
+	case 635: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLfloat *param = (const GLfloat *)GLTraceReadBlob(glad_reader);
+		glad_glTextureParameterfv(texture, pname, param);
+		return true;
+	}
+	case 636: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		GLint param; GLTraceRead(glad_reader, &param, sizeof(param));
+		glad_glTextureParameteri(texture, pname, param);
+		return true;
+	}
+	case 637: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLint *params = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glTextureParameterIiv(texture, pname, params);
+		return true;
+	}
+	case 638: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLuint *params = (const GLuint *)GLTraceReadBlob(glad_reader);
+		glad_glTextureParameterIuiv(texture, pname, params);
+		return true;
+	}
+	case 639: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		GLenum pname; GLTraceRead(glad_reader, &pname, sizeof(pname));
+		const GLint *param = (const GLint *)GLTraceReadBlob(glad_reader);
+		glad_glTextureParameteriv(texture, pname, param);
+		return true;
+	}
+	case 640: {
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		glad_glGenerateTextureMipmap(texture);
+		return true;
+	}
+	case 641: {
+		GLuint unit; GLTraceRead(glad_reader, &unit, sizeof(unit));
+		GLuint texture; GLTraceRead(glad_reader, &texture, sizeof(texture)); texture = (GLuint)GLTraceRemap(GL_TRACE_TEXTURE, texture);
+		glad_glBindTextureUnit(unit, texture);
+		return true;
+	}
+	case 650: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *arrays = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glCreateVertexArrays(n, arrays);
+		GLTraceMapNames(glad_reader, GL_TRACE_VERTEX_ARRAY, arrays);
+		return true;
+	}
+	case 651: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		glad_glDisableVertexArrayAttrib(vaobj, index);
+		return true;
+	}
+	case 652: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint index; GLTraceRead(glad_reader, &index, sizeof(index));
+		glad_glEnableVertexArrayAttrib(vaobj, index);
+		return true;
+	}
+	case 653: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		glad_glVertexArrayElementBuffer(vaobj, buffer);
+		return true;
+	}
+	case 654: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint bindingindex; GLTraceRead(glad_reader, &bindingindex, sizeof(bindingindex));
+		GLuint buffer; GLTraceRead(glad_reader, &buffer, sizeof(buffer)); buffer = (GLuint)GLTraceRemap(GL_TRACE_BUFFER, buffer);
+		GLintptr offset; GLTraceRead(glad_reader, &offset, sizeof(offset));
+		GLsizei stride; GLTraceRead(glad_reader, &stride, sizeof(stride));
+		glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+		return true;
+	}
+	case 655: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint first; GLTraceRead(glad_reader, &first, sizeof(first));
+		GLsizei count; GLTraceRead(glad_reader, &count, sizeof(count));
+		const GLuint *buffers = GLTraceReadNames(glad_reader, GL_TRACE_BUFFER);
+		const GLintptr *offsets = (const GLintptr *)GLTraceReadBlob(glad_reader);
+		const GLsizei *strides = (const GLsizei *)GLTraceReadBlob(glad_reader);
+		glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+		return true;
+	}
+	case 656: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint attribindex; GLTraceRead(glad_reader, &attribindex, sizeof(attribindex));
+		GLuint bindingindex; GLTraceRead(glad_reader, &bindingindex, sizeof(bindingindex));
+		glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+		return true;
+	}
+	case 657: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint attribindex; GLTraceRead(glad_reader, &attribindex, sizeof(attribindex));
+		GLint size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLboolean normalized; GLTraceRead(glad_reader, &normalized, sizeof(normalized));
+		GLuint relativeoffset; GLTraceRead(glad_reader, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+		return true;
+	}
+	case 658: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint attribindex; GLTraceRead(glad_reader, &attribindex, sizeof(attribindex));
+		GLint size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint relativeoffset; GLTraceRead(glad_reader, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+		return true;
+	}
+	case 659: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint attribindex; GLTraceRead(glad_reader, &attribindex, sizeof(attribindex));
+		GLint size; GLTraceRead(glad_reader, &size, sizeof(size));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLuint relativeoffset; GLTraceRead(glad_reader, &relativeoffset, sizeof(relativeoffset));
+		glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+		return true;
+	}
+	case 660: {
+		GLuint vaobj; GLTraceRead(glad_reader, &vaobj, sizeof(vaobj)); vaobj = (GLuint)GLTraceRemap(GL_TRACE_VERTEX_ARRAY, vaobj);
+		GLuint bindingindex; GLTraceRead(glad_reader, &bindingindex, sizeof(bindingindex));
+		GLuint divisor; GLTraceRead(glad_reader, &divisor, sizeof(divisor));
+		glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+		return true;
+	}
+	case 664: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *samplers = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glCreateSamplers(n, samplers);
+		GLTraceMapNames(glad_reader, GL_TRACE_SAMPLER, samplers);
+		return true;
+	}
+	case 665: {
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *pipelines = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glCreateProgramPipelines(n, pipelines);
+		GLTraceMapNames(glad_reader, GL_TRACE_PIPELINE, pipelines);
+		return true;
+	}
+	case 666: {
+		GLenum target; GLTraceRead(glad_reader, &target, sizeof(target));
+		GLsizei n; GLTraceRead(glad_reader, &n, sizeof(n));
+		GLuint *ids = GLTraceScratch((u64)(n) * sizeof(GLuint));
+		glad_glCreateQueries(target, n, ids);
+		GLTraceMapNames(glad_reader, GL_TRACE_QUERY, ids);
+		return true;
+	}
+	case 671: {
+		GLbitfield barriers; GLTraceRead(glad_reader, &barriers, sizeof(barriers));
+		glad_glMemoryBarrierByRegion(barriers);
+		return true;
+	}
+	case 681: {
+		GLint x; GLTraceRead(glad_reader, &x, sizeof(x));
+		GLint y; GLTraceRead(glad_reader, &y, sizeof(y));
+		GLsizei width; GLTraceRead(glad_reader, &width, sizeof(width));
+		GLsizei height; GLTraceRead(glad_reader, &height, sizeof(height));
+		GLenum format; GLTraceRead(glad_reader, &format, sizeof(format));
+		GLenum type; GLTraceRead(glad_reader, &type, sizeof(type));
+		GLsizei bufSize; GLTraceRead(glad_reader, &bufSize, sizeof(bufSize));
+		void *data = GLTraceReadPixelsOut(glad_reader);
+		glad_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+		return true;
+	}
+	case 694: {
+		glad_glTextureBarrier();
+		return true;
+	}
+	default:
+		return false;
+	}
+}
@@ -162,100 +162,156 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* Extensions are interned once into a single allocation: an open
+   addressing hash table followed by the names it points at. Lookups after
+   that are a hash and usually one strcmp, without touching the heap. */
+typedef struct {
+    unsigned int hash;
+    const char *name;
+} glad_ext_slot;
 
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index;
+static glad_ext_slot *ext_slots = NULL;
+static unsigned int ext_mask = 0;
 
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            char **tmp_exts_i = (char **)realloc((void *)exts_i, (size_t)num_exts_i * (sizeof *exts_i));
-            if (tmp_exts_i == NULL) {
-                return 0;
-            }
-            exts_i = tmp_exts_i;
-        }
+static unsigned int hash_ext(const char *ext, size_t len) {
+    unsigned int hash = 2166136261u;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        hash = (hash ^ (unsigned char)ext[i]) * 16777619u;
+    }
+    return hash;
+}
 
-        if (exts_i == NULL) {
-            return 0;
-        }
+static void free_exts(void) {
+    free((void *)ext_slots);
+    ext_slots = NULL;
+    ext_mask = 0;
+}
 
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+/* Copies ext into the string pool at *pool and adds it to the table */
+static void intern_ext(const char *ext, size_t len, char **pool) {
+    unsigned int hash = hash_ext(ext, len);
+    unsigned int index = hash & ext_mask;
+    char *name = *pool;
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
+    memcpy(name, ext, len);
+    name[len] = '\0';
+    *pool += len + 1;
+
+    while(ext_slots[index].name != NULL) {
+        if(ext_slots[index].hash == hash && strcmp(ext_slots[index].name, name) == 0) {
+            return;
         }
+        index = (index + 1) & ext_mask;
     }
-#endif
-    return 1;
+    ext_slots[index].hash = hash;
+    ext_slots[index].name = name;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+static int alloc_exts(size_t count, size_t chars) {
+    size_t capacity = 16;
+    /* At most half full so probe chains stay short */
+    while(capacity < count * 2) {
+        capacity *= 2;
     }
+    ext_slots = (glad_ext_slot *)calloc(1, capacity * sizeof(glad_ext_slot) + chars);
+    if(ext_slots == NULL) {
+        return 0;
+    }
+    ext_mask = (unsigned int)capacity - 1;
+    return 1;
 }
 
-static int has_ext(const char *ext) {
+static int get_exts(void) {
+    size_t count = 0;
+    size_t chars = 0;
+    char *pool;
+
+    free_exts();
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
+        const char *exts = (const char *)glGetString(GL_EXTENSIONS);
+        const char *at;
+        if(exts == NULL) {
             return 0;
         }
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
+        for(at = exts; *at != '\0'; at++) {
+            if(*at != ' ' && (at == exts || at[-1] == ' ')) {
+                count++;
             }
+        }
+        chars = (size_t)(at - exts) + count + 1;
+        if(!alloc_exts(count, chars)) {
+            return 0;
+        }
+        pool = (char *)(ext_slots + ext_mask + 1);
 
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
+        at = exts;
+        while(*at != '\0') {
+            size_t len = strcspn(at, " ");
+            if(len > 0) {
+                intern_ext(at, len, &pool);
             }
-            extensions = terminator;
+            at += len;
+            at += strspn(at, " ");
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+        int num_exts_i = 0;
+        unsigned int index;
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        if(num_exts_i <= 0) {
+            return 0;
+        }
+        count = (size_t)num_exts_i;
+
+        /* The strings stay valid for the life of the context, so size the
+           pool first instead of collecting copies */
+        for(index = 0; index < count; index++) {
+            const char *ext = (const char *)glGetStringi(GL_EXTENSIONS, index);
+            chars += ext != NULL ? strlen(ext) + 1 : 0;
+        }
+        if(!alloc_exts(count, chars)) {
+            return 0;
+        }
+        pool = (char *)(ext_slots + ext_mask + 1);
+
+        for(index = 0; index < count; index++) {
+            const char *ext = (const char *)glGetStringi(GL_EXTENSIONS, index);
+            if(ext != NULL) {
+                intern_ext(ext, strlen(ext), &pool);
             }
         }
     }
 #endif
+    return 1;
+}
+
+static int has_ext(const char *ext) {
+    size_t len;
+    unsigned int hash;
+    unsigned int index;
 
+    if(ext_slots == NULL || ext == NULL) {
+        return 0;
+    }
+
+    len = strlen(ext);
+    hash = hash_ext(ext, len);
+    for(index = hash & ext_mask; ext_slots[index].name != NULL; index = (index + 1) & ext_mask) {
+        if(ext_slots[index].hash == hash && strcmp(ext_slots[index].name, ext) == 0) {
+            return 1;
+        }
+    }
     return 0;
 }
+
+int gladHasExtension(const char *ext) {
+    return has_ext(ext);
+}
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -1725,7 +1781,7 @@ static void load_GL_VERSION_4_5(GLADloadproc load) {
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
 	(void)&has_ext;
-	free_exts();
+	/* Kept for gladHasExtension */
 	return 1;
 }
 
@@ -1818,3 +1874,17 @@ int gladLoadGLLoader(GLADloadproc load) {
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+#if defined(GLAD_LAZY)
+int gladLoadGLLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	gladLazyInstall(load);
+
+	if (!find_extensionsGL()) return 0;
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+#endif
+
@@ -92,6 +92,17 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* Whether the current context advertises the named extension. Valid after
+   a successful load, doesn't allocate. */
+GLAPI int gladHasExtension(const char *ext);
+
+#if defined(GLAD_LAZY)
+/* Same as gladLoadGLLoader, but every function starts out as a trampoline
+   that looks itself up on first call (see glad-lazy.c) */
+GLAPI int gladLoadGLLazy(GLADloadproc);
+GLAPI void gladLazyInstall(GLADloadproc);
+#endif
+
 #include "khrplatform.h"
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -0,0 +1,449 @@
+#define _DEFAULT_SOURCE //strdup
+#include "gpu-alloc.h"
+#include "glad.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Smallest range handed out, 2^GPU_MIN_SHIFT bytes */
+#define GPU_MIN_SHIFT 8
+#define GPU_NO_UNIT 0xffffffffu
+/* GL keeps at most one flag per error code, of which there are fewer than
+   this. Bounds reading them, a lost context can report errors forever. */
+#define GPU_MAX_GL_ERRORS 8
+
+/* One entry per minimum sized unit of a block. Only the first unit of a
+   free range is linked into a free list. */
+typedef struct BuddyNode
+{
+    u32 next;
+    u32 prev;
+    /* Order of the free range starting here, -1 if none does */
+    i8 freeOrder;
+} BuddyNode;
+
+typedef struct GpuBlock GpuBlock;
+
+struct GpuAllocation
+{
+    GpuBlock *block;
+    u32 unit;
+    i8 order;
+    isize size;
+    GpuAllocation *prev;
+    GpuAllocation *next;
+};
+
+struct GpuBlock
+{
+    GLuint buffer;
+    /* Orders run from 0 (one unit) to maxOrder (the whole block) */
+    ifast32 maxOrder;
+    u32 *freeHeads;
+    BuddyNode *nodes;
+    isize allocatedBytes;
+    GpuAllocation *allocations;
+    GpuBlock *next;
+};
+
+struct GpuHeap
+{
+    isize blockSize;
+    char *label;
+    GpuBlock *blocks;
+    u64 bytesMoved;
+    u64 version;
+};
+
+local isize OrderBytes(ifast32 order)
+{
+    return (isize)1 << (order + GPU_MIN_SHIFT);
+}
+
+local ifast32 OrderForSize(isize size)
+{
+    ifast32 order = 0;
+    while (OrderBytes(order) < size)
+    {
+        order++;
+    }
+    return order;
+}
+
+local void PushFree(GpuBlock *b, u32 unit, ifast32 order)
+{
+    BuddyNode *n = &b->nodes[unit];
+    n->freeOrder = (i8)order;
+    n->prev = GPU_NO_UNIT;
+    n->next = b->freeHeads[order];
+    if (n->next != GPU_NO_UNIT)
+    {
+        b->nodes[n->next].prev = unit;
+    }
+    b->freeHeads[order] = unit;
+}
+
+local void RemoveFree(GpuBlock *b, u32 unit)
+{
+    BuddyNode *n = &b->nodes[unit];
+    if (n->prev != GPU_NO_UNIT)
+    {
+        b->nodes[n->prev].next = n->next;
+    }
+    else
+    {
+        b->freeHeads[n->freeOrder] = n->next;
+    }
+    if (n->next != GPU_NO_UNIT)
+    {
+        b->nodes[n->next].prev = n->prev;
+    }
+    n->freeOrder = -1;
+}
+
+local GpuBlock *CreateGpuBlock(GpuHeap *heap, ifast32 maxOrder)
+{
+    GpuBlock *b = calloc(1, sizeof(*b));
+    if (!b)
+    {
+        return NULL;
+    }
+    u32 units = 1u << maxOrder;
+    b->maxOrder = maxOrder;
+    b->freeHeads = malloc((maxOrder + 1) * sizeof(*b->freeHeads));
+    b->nodes = malloc(units * sizeof(*b->nodes));
+    if (!b->freeHeads || !b->nodes)
+    {
+        free(b->freeHeads);
+        free(b->nodes);
+        free(b);
+        return NULL;
+    }
+    for (ifast32 i = 0; i <= maxOrder; i++)
+    {
+        b->freeHeads[i] = GPU_NO_UNIT;
+    }
+    for (u32 i = 0; i < units; i++)
+    {
+        b->nodes[i].freeOrder = -1;
+    }
+    PushFree(b, 0, maxOrder);
+
+    /* Running out of memory is only reported through glGetError. Errors
+       already pending are passed on rather than mistaken for the storage
+       call's. */
+    for (ifast32 i = 0; i < GPU_MAX_GL_ERRORS; i++)
+    {
+        GLenum error = glGetError();
+        if (error == GL_NO_ERROR)
+        {
+            break;
+        }
+        fprintf(stderr, "GPUALLOC: GL error 0x%x pending before creating a block\n", error);
+    }
+    glCreateBuffers(1, &b->buffer);
+    glNamedBufferStorage(b->buffer, OrderBytes(maxOrder), NULL, GL_DYNAMIC_STORAGE_BIT);
+    bool outOfMemory = false;
+    for (ifast32 i = 0; i < GPU_MAX_GL_ERRORS; i++)
+    {
+        GLenum error = glGetError();
+        if (error == GL_NO_ERROR)
+        {
+            break;
+        }
+        outOfMemory |= error == GL_OUT_OF_MEMORY;
+    }
+    if (outOfMemory)
+    {
+        glDeleteBuffers(1, &b->buffer);
+        free(b->freeHeads);
+        free(b->nodes);
+        free(b);
+        return NULL;
+    }
+    if (heap->label)
+    {
+        glObjectLabel(GL_BUFFER, b->buffer, -1, heap->label);
+    }
+
+    b->next = heap->blocks;
+    heap->blocks = b;
+    return b;
+}
+
+local void DestroyGpuBlock(GpuHeap *heap, GpuBlock *b)
+{
+    for (GpuBlock **link = &heap->blocks; *link; link = &(*link)->next)
+    {
+        if (*link == b)
+        {
+            *link = b->next;
+            break;
+        }
+    }
+    glDeleteBuffers(1, &b->buffer);
+    free(b->freeHeads);
+    free(b->nodes);
+    free(b);
+}
+
+/* Returns the first unit of a free range of the given order, split off a
+   bigger one if need be, or GPU_NO_UNIT */
+local u32 AllocBuddy(GpuBlock *b, ifast32 order)
+{
+    ifast32 from = order;
+    while (from <= b->maxOrder && b->freeHeads[from] == GPU_NO_UNIT)
+    {
+        from++;
+    }
+    if (from > b->maxOrder)
+    {
+        return GPU_NO_UNIT;
+    }
+    u32 unit = b->freeHeads[from];
+    RemoveFree(b, unit);
+    while (from > order)
+    {
+        from--;
+        PushFree(b, unit + (1u << from), from);
+    }
+    b->allocatedBytes += OrderBytes(order);
+    return unit;
+}
+
+local void FreeBuddy(GpuBlock *b, u32 unit, ifast32 order)
+{
+    b->allocatedBytes -= OrderBytes(order);
+    while (order < b->maxOrder)
+    {
+        u32 buddy = unit ^ (1u << order);
+        if (b->nodes[buddy].freeOrder != order)
+        {
+            break;
+        }
+        RemoveFree(b, buddy);
+        unit &= ~(1u << order);
+        order++;
+    }
+    PushFree(b, unit, order);
+}
+
+local void LinkAllocation(GpuBlock *b, GpuAllocation *a)
+{
+    a->block = b;
+    a->prev = NULL;
+    a->next = b->allocations;
+    if (a->next)
+    {
+        a->next->prev = a;
+    }
+    b->allocations = a;
+}
+
+local void UnlinkAllocation(GpuAllocation *a)
+{
+    if (a->prev)
+    {
+        a->prev->next = a->next;
+    }
+    else
+    {
+        a->block->allocations = a->next;
+    }
+    if (a->next)
+    {
+        a->next->prev = a->prev;
+    }
+}
+
+GpuHeap *CreateGpuHeap(isize blockSize, const char *label)
+{
+    GpuHeap *heap = calloc(1, sizeof(*heap));
+    if (!heap)
+    {
+        return NULL;
+    }
+    heap->blockSize = OrderBytes(OrderForSize(blockSize));
+    heap->label = label ? strdup(label) : NULL;
+    return heap;
+}
+
+GpuAllocation *AllocGpuMemory(GpuHeap *heap, isize size, isize alignment)
+{
+    /* Buddy ranges are aligned to their own size */
+    ifast32 order = OrderForSize(size > alignment ? size : alignment);
+    GpuAllocation *a = calloc(1, sizeof(*a));
+    if (!a)
+    {
+        return NULL;
+    }
+    a->size = size;
+    a->order = (i8)order;
+
+    for (GpuBlock *b = heap->blocks; b; b = b->next)
+    {
+        if (order <= b->maxOrder && (a->unit = AllocBuddy(b, order)) != GPU_NO_UNIT)
+        {
+            LinkAllocation(b, a);
+            return a;
+        }
+    }
+
+    ifast32 blockOrder = OrderForSize(heap->blockSize);
+    GpuBlock *b = CreateGpuBlock(heap, order > blockOrder ? order : blockOrder);
+    if (!b)
+    {
+        fprintf(stderr, "GPUALLOC: could not reserve a block for %lld bytes\n", (long long)size);
+        free(a);
+        return NULL;
+    }
+    a->unit = AllocBuddy(b, order);
+    LinkAllocation(b, a);
+    return a;
+}
+
+void FreeGpuMemory(GpuHeap *heap, GpuAllocation *a)
+{
+    if (!a)
+    {
+        return;
+    }
+    GpuBlock *b = a->block;
+    UnlinkAllocation(a);
+    FreeBuddy(b, a->unit, a->order);
+    free(a);
+    /* Keep the last block around so a heap going empty and full again
+       doesn't churn buffer objects */
+    if (!b->allocations && !(heap->blocks == b && !b->next))
+    {
+        DestroyGpuBlock(heap, b);
+    }
+}
+
+GpuRange GetGpuRange(const GpuAllocation *a)
+{
+    return (GpuRange){a->block->buffer, (isize)a->unit << GPU_MIN_SHIFT, a->size};
+}
+
+void UploadGpuMemory(const GpuAllocation *a, isize offset, const void *data, isize size)
+{
+    glNamedBufferSubData(a->block->buffer, ((isize)a->unit << GPU_MIN_SHIFT) + offset, size,
+                         data);
+}
+
+isize CompactGpuHeap(GpuHeap *heap, isize maxBytes)
+{
+    if (!heap->blocks || !heap->blocks->next)
+    {
+        return 0;
+    }
+    GpuBlock *source = NULL;
+    f32 lowest = 2;
+    for (GpuBlock *b = heap->blocks; b; b = b->next)
+    {
+        f32 used = (f32)b->allocatedBytes / (f32)OrderBytes(b->maxOrder);
+        if (b->allocations && used < lowest)
+        {
+            lowest = used;
+            source = b;
+        }
+    }
+    if (!source)
+    {
+        return 0;
+    }
+
+    isize moved = 0;
+    while (source->allocations && moved < maxBytes)
+    {
+        GpuAllocation *a = source->allocations;
+        GpuBlock *target = NULL;
+        u32 unit = GPU_NO_UNIT;
+        for (GpuBlock *b = heap->blocks; b && unit == GPU_NO_UNIT; b = b->next)
+        {
+            if (b != source && a->order <= b->maxOrder)
+            {
+                target = b;
+                unit = AllocBuddy(b, a->order);
+            }
+        }
+        if (unit == GPU_NO_UNIT)
+        {
+            break;
+        }
+
+        /* Ordered after every draw already issued from the old range, so
+           nothing on the GPU sees it half moved */
+        glCopyNamedBufferSubData(source->buffer, target->buffer, (isize)a->unit << GPU_MIN_SHIFT,
+                                 (isize)unit << GPU_MIN_SHIFT, a->size);
+        UnlinkAllocation(a);
+        FreeBuddy(source, a->unit, a->order);
+        a->unit = unit;
+        LinkAllocation(target, a);
+        moved += a->size;
+    }
+    heap->bytesMoved += moved;
+    if (moved)
+    {
+        heap->version++;
+    }
+
+    if (!source->allocations)
+    {
+        DestroyGpuBlock(heap, source);
+    }
+    return moved;
+}
+
+u64 GetGpuHeapVersion(const GpuHeap *heap)
+{
+    return heap->version;
+}
+
+GpuHeapStats GetGpuHeapStats(const GpuHeap *heap)
+{
+    GpuHeapStats stats = {0};
+    isize freeBytes = 0;
+    for (const GpuBlock *b = heap->blocks; b; b = b->next)
+    {
+        stats.blockCount++;
+        stats.bytesReserved += OrderBytes(b->maxOrder);
+        stats.bytesAllocated += b->allocatedBytes;
+        freeBytes += OrderBytes(b->maxOrder) - b->allocatedBytes;
+        for (const GpuAllocation *a = b->allocations; a; a = a->next)
+        {
+            stats.allocationCount++;
+        }
+        for (ifast32 order = b->maxOrder; order >= 0; order--)
+        {
+            if (b->freeHeads[order] != GPU_NO_UNIT)
+            {
+                if (OrderBytes(order) > stats.largestFreeRange)
+                {
+                    stats.largestFreeRange = OrderBytes(order);
+                }
+                break;
+            }
+        }
+    }
+    stats.fragmentation = freeBytes ? 1 - (f32)stats.largestFreeRange / (f32)freeBytes : 0;
+    stats.bytesMoved = heap->bytesMoved;
+    return stats;
+}
+
+void DestroyGpuHeap(GpuHeap *heap)
+{
+    while (heap->blocks)
+    {
+        GpuBlock *b = heap->blocks;
+        while (b->allocations)
+        {
+            GpuAllocation *a = b->allocations;
+            b->allocations = a->next;
+            free(a);
+        }
+        DestroyGpuBlock(heap, b);
+    }
+    free(heap->label);
+    free(heap);
+}
@@ -0,0 +1,73 @@
+#ifndef GPU_ALLOC_H
+#define GPU_ALLOC_H
+#include "glad.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Suballocates ranges of a few large immutable buffers with a buddy
+       allocator, so meshes share buffer objects instead of getting one
+       each. Blocks are created as needed and released once empty. */
+
+    typedef struct GpuHeap GpuHeap;
+
+    /* Stable handle. The range it refers to can move when the heap is
+       compacted; read it again with GetGpuRange afterwards. */
+    typedef struct GpuAllocation GpuAllocation;
+
+    typedef struct GpuRange
+    {
+        GLuint buffer;
+        isize offset;
+        isize size;
+    } GpuRange;
+
+    typedef struct GpuHeapStats
+    {
+        ifast32 blockCount;
+        ifast32 allocationCount;
+        isize bytesReserved;
+        /* Including what allocations lose to rounding up to a power of two */
+        isize bytesAllocated;
+        isize largestFreeRange;
+        /* 0 when all free space is one range, towards 1 as it splinters */
+        f32 fragmentation;
+        u64 bytesMoved;
+    } GpuHeapStats;
+
+    /* blockSize is rounded up to a power of two; allocations bigger than
+       that get a block of their own */
+    GpuHeap *CreateGpuHeap(isize blockSize, const char *label);
+
+    /* alignment must be a power of two. Returns NULL if GL couldn't
+       provide a new block. */
+    GpuAllocation *AllocGpuMemory(GpuHeap *heap, isize size, isize alignment);
+
+    void FreeGpuMemory(GpuHeap *heap, GpuAllocation *a);
+
+    GpuRange GetGpuRange(const GpuAllocation *a);
+
+    /* Writes size bytes at offset into the allocation */
+    void UploadGpuMemory(const GpuAllocation *a, isize offset, const void *data, isize size);
+
+    /* Moves at most maxBytes worth of allocations out of the emptiest
+       block into the others with glCopyNamedBufferSubData, so it can be
+       released. Meant to be called a bit every frame. Returns the bytes
+       moved; anything bound from a moved range has to be rebound. */
+    isize CompactGpuHeap(GpuHeap *heap, isize maxBytes);
+
+    /* Changes whenever compaction moves something. Keep it along with any
+       range or binding taken from the heap, and take them again once it
+       no longer matches. */
+    u64 GetGpuHeapVersion(const GpuHeap *heap);
+
+    GpuHeapStats GetGpuHeapStats(const GpuHeap *heap);
+
+    /* Frees every block. Outstanding allocations become invalid. */
+    void DestroyGpuHeap(GpuHeap *heap);
+#ifdef __cplusplus
+}
+#endif
+#endif
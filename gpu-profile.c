@@ -0,0 +1,253 @@
+#include "gpu-profile.h"
+#include "glad.h"
+#include "profile.h"
+
+/* How many frames of queries are in flight. Results are read this many
+   frames after they are issued, by which point the GPU is almost always
+   done with them. */
+#define GPU_PROFILE_LATENCY 4
+#define GPU_PROFILE_MAX_PASSES 32
+#define GPU_PROFILE_MAX_DEPTH 8
+/* How often the GPU clock is resampled to correct drift against the CPU */
+#define GPU_PROFILE_CALIBRATION_INTERVAL 64
+
+typedef struct GpuFrameQueries
+{
+    GLuint begin[GPU_PROFILE_MAX_PASSES];
+    GLuint end[GPU_PROFILE_MAX_PASSES];
+    const char *names[GPU_PROFILE_MAX_PASSES];
+    ifast32 depths[GPU_PROFILE_MAX_PASSES];
+    /* Passes left open at the end of the frame never get an end query */
+    bool ended[GPU_PROFILE_MAX_PASSES];
+    ifast32 passCount;
+    /* The end query issued last, 0 if none was. Nested passes end before
+       the ones around them, so it isn't end[passCount - 1]. */
+    GLuint lastEnd;
+
+    ifast32 stack[GPU_PROFILE_MAX_DEPTH];
+    ifast32 depth;
+
+    /* CPU ticks and GPU nanoseconds sampled at the same moment, used to put
+       the GPU passes on the CPU timeline */
+    u64 calibrationTicks;
+    i64 calibrationNs;
+
+    bool pending;
+} GpuFrameQueries;
+
+local GpuFrameQueries frames[GPU_PROFILE_LATENCY];
+local GpuFrameQueries *currentFrame;
+local u64 frameCounter;
+
+local u64 calibrationTicks;
+local i64 calibrationNs;
+local f64 ticksPerNs;
+
+local GpuPassTiming timings[GPU_PROFILE_MAX_PASSES];
+local ifast32 timingCount;
+local f32 frameMs;
+local GpuProfileStats stats;
+
+local void CalibrateGpuClock(void)
+{
+    GLint64 gpuNs;
+    glGetInteger64v(GL_TIMESTAMP, &gpuNs);
+    calibrationTicks = ReadProfileTicks();
+    calibrationNs = gpuNs;
+}
+
+local f32 FindAverageMs(const char *name, f32 ms)
+{
+    for (ifast32 i = 0; i < timingCount; i++)
+    {
+        if (timings[i].name == name)
+        {
+            return timings[i].avgMs * 0.9f + ms * 0.1f;
+        }
+    }
+    return ms;
+}
+
+/* Returns false without touching anything if the GPU isn't done yet */
+local bool ResolveGpuFrame(GpuFrameQueries *f)
+{
+    if (f->lastEnd == 0)
+    {
+        f->pending = false;
+        return true;
+    }
+
+    /* Timestamps complete in order, so the last one being ready means they
+       all are */
+    GLint available = 0;
+    glGetQueryObjectiv(f->lastEnd, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+    {
+        return false;
+    }
+
+    GpuPassTiming resolved[GPU_PROFILE_MAX_PASSES];
+    ifast32 resolvedCount = 0;
+    f32 total = 0;
+    for (ifast32 i = 0; i < f->passCount; i++)
+    {
+        if (!f->ended[i])
+        {
+            continue;
+        }
+        GLuint64 begin, end;
+        glGetQueryObjectui64v(f->begin[i], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(f->end[i], GL_QUERY_RESULT, &end);
+
+        f32 ms = (f32)(end - begin) / 1e6f;
+        GpuPassTiming *r = &resolved[resolvedCount++];
+        r->name = f->names[i];
+        r->depth = f->depths[i];
+        r->ms = ms;
+        r->avgMs = FindAverageMs(f->names[i], ms);
+        if (f->depths[i] == 0)
+        {
+            total += ms;
+        }
+
+        PROFILE_EMIT_ZONE(
+            "GPU", f->names[i],
+            f->calibrationTicks + (u64)((f64)((i64)begin - f->calibrationNs) * ticksPerNs),
+            f->calibrationTicks + (u64)((f64)((i64)end - f->calibrationNs) * ticksPerNs));
+    }
+
+    for (ifast32 i = 0; i < resolvedCount; i++)
+    {
+        timings[i] = resolved[i];
+    }
+    timingCount = resolvedCount;
+    frameMs = total;
+    stats.framesResolved++;
+    f->pending = false;
+    return true;
+}
+
+void InitGpuProfiler(void)
+{
+    for (ifast32 i = 0; i < GPU_PROFILE_LATENCY; i++)
+    {
+        glCreateQueries(GL_TIMESTAMP, GPU_PROFILE_MAX_PASSES, frames[i].begin);
+        glCreateQueries(GL_TIMESTAMP, GPU_PROFILE_MAX_PASSES, frames[i].end);
+    }
+
+#if defined(PROFILE)
+    ticksPerNs = ProfileTicksPerMicrosecond() / 1000.0;
+#else
+    ticksPerNs = 0;
+#endif
+    CalibrateGpuClock();
+}
+
+void BeginGpuFrame(void)
+{
+    GpuFrameQueries *f = &frames[frameCounter % GPU_PROFILE_LATENCY];
+    if (f->pending && !ResolveGpuFrame(f))
+    {
+        /* Reusing the queries anyway rather than waiting on them */
+        stats.framesDropped++;
+    }
+
+#if defined(PROFILE)
+    if (frameCounter % GPU_PROFILE_CALIBRATION_INTERVAL == 0)
+    {
+        CalibrateGpuClock();
+    }
+#endif
+
+    f->passCount = 0;
+    f->lastEnd = 0;
+    f->depth = 0;
+    f->calibrationTicks = calibrationTicks;
+    f->calibrationNs = calibrationNs;
+    f->pending = true;
+    currentFrame = f;
+}
+
+void BeginGpuPass(const char *name)
+{
+    GpuFrameQueries *f = currentFrame;
+    if (!f)
+    {
+        return;
+    }
+    if (f->passCount < GPU_PROFILE_MAX_PASSES && f->depth < GPU_PROFILE_MAX_DEPTH)
+    {
+        ifast32 pass = f->passCount++;
+        f->names[pass] = name;
+        f->depths[pass] = f->depth;
+        f->ended[pass] = false;
+        f->stack[f->depth] = pass;
+        glQueryCounter(f->begin[pass], GL_TIMESTAMP);
+    }
+    else if (f->depth < GPU_PROFILE_MAX_DEPTH)
+    {
+        f->stack[f->depth] = -1;
+    }
+    f->depth++;
+}
+
+void EndGpuPass(void)
+{
+    GpuFrameQueries *f = currentFrame;
+    if (!f || f->depth == 0)
+    {
+        return;
+    }
+    f->depth--;
+    if (f->depth < GPU_PROFILE_MAX_DEPTH && f->stack[f->depth] >= 0)
+    {
+        ifast32 pass = f->stack[f->depth];
+        glQueryCounter(f->end[pass], GL_TIMESTAMP);
+        f->ended[pass] = true;
+        f->lastEnd = f->end[pass];
+    }
+}
+
+void EndGpuFrame(void)
+{
+    currentFrame = NULL;
+    frameCounter++;
+
+    /* Oldest first, stop at the first one that isn't ready so results never
+       go backwards in time */
+    for (u64 i = 0; i < GPU_PROFILE_LATENCY; i++)
+    {
+        GpuFrameQueries *f = &frames[(frameCounter + i) % GPU_PROFILE_LATENCY];
+        if (f->pending && !ResolveGpuFrame(f))
+        {
+            break;
+        }
+    }
+}
+
+const GpuPassTiming *GetGpuPassTimings(ifast32 *count)
+{
+    *count = timingCount;
+    return timings;
+}
+
+f32 GetGpuFrameMs(void)
+{
+    return frameMs;
+}
+
+GpuProfileStats GetGpuProfileStats(void)
+{
+    return stats;
+}
+
+void DestroyGpuProfiler(void)
+{
+    for (ifast32 i = 0; i < GPU_PROFILE_LATENCY; i++)
+    {
+        glDeleteQueries(GPU_PROFILE_MAX_PASSES, frames[i].begin);
+        glDeleteQueries(GPU_PROFILE_MAX_PASSES, frames[i].end);
+        frames[i].pending = false;
+    }
+    currentFrame = NULL;
+}
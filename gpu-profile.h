@@ -0,0 +1,54 @@
+#ifndef GPU_PROFILE_H
+#define GPU_PROFILE_H
+#include "glad.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef struct GpuPassTiming
+    {
+        const char *name;
+        ifast32 depth;
+        f32 ms;
+        /* Exponential moving average, smooths out frame to frame noise */
+        f32 avgMs;
+    } GpuPassTiming;
+
+    typedef struct GpuProfileStats
+    {
+        u64 framesResolved;
+        /* Frames whose queries still weren't available by the time their
+           slot in the ring came round again */
+        u64 framesDropped;
+    } GpuProfileStats;
+
+    /* Needs a current GL context. Pass names must outlive the profiler
+       (string literals) since only the pointer is kept. */
+    void InitGpuProfiler(void);
+
+    void BeginGpuFrame(void);
+
+    void BeginGpuPass(const char *name);
+
+    void EndGpuPass(void);
+
+    /* Collects whatever earlier frames the GPU has finished with. Never
+       blocks: results arrive a few frames late. */
+    void EndGpuFrame(void);
+
+    /* Timings of the most recently resolved frame, in the order the passes
+       began */
+    const GpuPassTiming *GetGpuPassTimings(ifast32 *count);
+
+    /* Sum of the top level passes of the most recently resolved frame */
+    f32 GetGpuFrameMs(void);
+
+    GpuProfileStats GetGpuProfileStats(void);
+
+    void DestroyGpuProfiler(void);
+#ifdef __cplusplus
+}
+#endif
+#endif
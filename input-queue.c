@@ -0,0 +1,61 @@
+#include "input-queue.h"
+#include <stdlib.h>
+
+/* head is written by the producer only and tail by the consumer only, on
+   lines of their own so neither side's writes evict the other's */
+struct InputQueue
+{
+    u64 head;
+    u64 dropped;
+    u8 producerPad[64 - 2 * sizeof(u64)];
+    u64 tail;
+    u8 consumerPad[64 - sizeof(u64)];
+    InputEvent events[INPUT_QUEUE_SIZE];
+};
+
+InputQueue *CreateInputQueue(void)
+{
+    return calloc(1, sizeof(InputQueue));
+}
+
+bool PushInputEvent(InputQueue *q, const InputEvent *e)
+{
+    u64 head = q->head;
+    u64 tail = __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= INPUT_QUEUE_SIZE)
+    {
+        __atomic_store_n(&q->dropped, q->dropped + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+    q->events[head & (INPUT_QUEUE_SIZE - 1)] = *e;
+    __atomic_store_n(&q->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool PopInputEvent(InputQueue *q, u64 time, InputEvent *e)
+{
+    u64 tail = q->tail;
+    u64 head = __atomic_load_n(&q->head, __ATOMIC_ACQUIRE);
+    if (tail == head)
+    {
+        return false;
+    }
+    const InputEvent *next = &q->events[tail & (INPUT_QUEUE_SIZE - 1)];
+    if (next->time > time)
+    {
+        return false;
+    }
+    *e = *next;
+    __atomic_store_n(&q->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+u64 GetDroppedInputEvents(const InputQueue *q)
+{
+    return __atomic_load_n(&q->dropped, __ATOMIC_RELAXED);
+}
+
+void DestroyInputQueue(InputQueue *q)
+{
+    free(q);
+}
@@ -0,0 +1,57 @@
+#ifndef INPUT_QUEUE_H
+#define INPUT_QUEUE_H
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Timestamped input events passed from the thread that pumps the
+       window system to the one running frames. Single producer, single
+       consumer, never blocks either side: a full queue drops the event
+       and counts it. Anything that mustn't be lost, like the window
+       closing, goes some other way. */
+
+    typedef enum InputEventType
+    {
+        /* a, b: the window's new drawable size */
+        INPUT_EVENT_RESIZE,
+        /* a, b: position relative to the window */
+        INPUT_EVENT_MOUSE_MOVE,
+        /* a: 1 left, 2 middle, 3 right, b: 1 pressed, 0 released */
+        INPUT_EVENT_MOUSE_BUTTON,
+        /* a: scancode, for the keys the pumping thread doesn't act on itself */
+        INPUT_EVENT_KEY_DOWN
+    } InputEventType;
+
+    typedef struct InputEvent
+    {
+        /* Whatever clock the producer uses, frames take the events
+           stamped before they started */
+        u64 time;
+        u32 type;
+        i32 a;
+        i32 b;
+    } InputEvent;
+
+    /* Events in flight, a power of two */
+#define INPUT_QUEUE_SIZE 1024
+
+    typedef struct InputQueue InputQueue;
+
+    InputQueue *CreateInputQueue(void);
+
+    /* Producer. false if the queue was full and e was dropped */
+    bool PushInputEvent(InputQueue *q, const InputEvent *e);
+
+    /* Consumer. Takes the oldest event stamped at or before time, false if
+       there's none */
+    bool PopInputEvent(InputQueue *q, u64 time, InputEvent *e);
+
+    u64 GetDroppedInputEvents(const InputQueue *q);
+
+    void DestroyInputQueue(InputQueue *q);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,161 @@
+#include "input-record.h"
+#include "rutils/file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct InputRecording
+{
+    RecordedInput *frames;
+    ifast32 frameCount;
+    ifast32 frameCapacity;
+    /* The part of the game's memory in use when recording began */
+    void *snapshot;
+    isize snapshotSize;
+};
+
+InputRecording *CreateInputRecording(void)
+{
+    return calloc(1, sizeof(InputRecording));
+}
+
+void BeginInputRecording(InputRecording *r, const GameMemory *memory)
+{
+    r->frameCount = 0;
+    r->snapshotSize = memory ? memory->used : 0;
+    free(r->snapshot);
+    r->snapshot = r->snapshotSize ? malloc(r->snapshotSize) : NULL;
+    if (r->snapshot)
+    {
+        memcpy(r->snapshot, memory->base, r->snapshotSize);
+    }
+    else
+    {
+        r->snapshotSize = 0;
+    }
+}
+
+void RecordInput(InputRecording *r, const GameInput *input)
+{
+    if (r->frameCount == r->frameCapacity)
+    {
+        ifast32 capacity = r->frameCapacity ? r->frameCapacity * 2 : 1024;
+        RecordedInput *frames = realloc(r->frames, capacity * sizeof(*frames));
+        if (!frames)
+        {
+            return;
+        }
+        r->frames = frames;
+        r->frameCapacity = capacity;
+    }
+    RecordedInput *f = &r->frames[r->frameCount++];
+    *f = (RecordedInput){input->dt, input->time, (i32)input->mouseX, (i32)input->mouseY,
+                         (u16)input->viewportWidth, (u16)input->viewportHeight, 0};
+    f->buttons = (input->mouseLeft ? INPUT_MOUSE_LEFT : 0) |
+                 (input->mouseRight ? INPUT_MOUSE_RIGHT : 0) |
+                 (input->mouseMiddle ? INPUT_MOUSE_MIDDLE : 0);
+}
+
+ifast32 GetInputFrameCount(const InputRecording *r)
+{
+    return r->frameCount;
+}
+
+void GetRecordedInput(const InputRecording *r, ifast32 frame, GameInput *input)
+{
+    const RecordedInput *f = &r->frames[frame];
+    *input = (GameInput){f->dt,
+                         f->time,
+                         f->viewportWidth,
+                         f->viewportHeight,
+                         f->mouseX,
+                         f->mouseY,
+                         (f->buttons & INPUT_MOUSE_LEFT) != 0,
+                         (f->buttons & INPUT_MOUSE_RIGHT) != 0,
+                         (f->buttons & INPUT_MOUSE_MIDDLE) != 0};
+}
+
+void RestoreInputSnapshot(const InputRecording *r, GameMemory *memory)
+{
+    if (r->snapshotSize > memory->size)
+    {
+        return;
+    }
+    /* Whatever the game grew into since goes too, as if it never had */
+    if (memory->used > r->snapshotSize)
+    {
+        memset((u8 *)memory->base + r->snapshotSize, 0, memory->used - r->snapshotSize);
+    }
+    if (r->snapshotSize)
+    {
+        memcpy(memory->base, r->snapshot, r->snapshotSize);
+    }
+    memory->used = r->snapshotSize;
+}
+
+bool SaveInputRecording(const InputRecording *r, const char *path)
+{
+    FILE *out = fopen(path, "wb");
+    if (!out)
+    {
+        fprintf(stderr, "INPUT: could not create %s\n", path);
+        return false;
+    }
+    InputRecordHeader header = {INPUT_RECORD_MAGIC, INPUT_RECORD_VERSION, r->frameCount, 0};
+    bool ok = fwrite(&header, sizeof(header), 1, out) == 1 &&
+              fwrite(r->frames, sizeof(*r->frames), r->frameCount, out) == (size_t)r->frameCount;
+    ok = fclose(out) == 0 && ok;
+    if (!ok)
+    {
+        fprintf(stderr, "INPUT: could not write %s\n", path);
+    }
+    return ok;
+}
+
+InputRecording *LoadInputRecording(const char *path)
+{
+    isize size;
+    const u8 *data = MapFileToROBuffer(path, NULL, &size);
+    if (!data)
+    {
+        fprintf(stderr, "INPUT: could not open %s\n", path);
+        return NULL;
+    }
+    InputRecordHeader header;
+    if (size < (isize)sizeof(header))
+    {
+        fprintf(stderr, "INPUT: %s is not an input recording\n", path);
+        UnmapMappedBuffer((void *)data, size);
+        return NULL;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != INPUT_RECORD_MAGIC || header.version != INPUT_RECORD_VERSION ||
+        (isize)(sizeof(header) + (u64)header.frameCount * sizeof(RecordedInput)) > size)
+    {
+        fprintf(stderr, "INPUT: %s is not an input recording\n", path);
+        UnmapMappedBuffer((void *)data, size);
+        return NULL;
+    }
+
+    InputRecording *r = CreateInputRecording();
+    r->frames = malloc((header.frameCount ? header.frameCount : 1) * sizeof(*r->frames));
+    if (r->frames)
+    {
+        memcpy(r->frames, data + sizeof(header), header.frameCount * sizeof(*r->frames));
+        r->frameCount = header.frameCount;
+        r->frameCapacity = header.frameCount ? header.frameCount : 1;
+    }
+    UnmapMappedBuffer((void *)data, size);
+    return r;
+}
+
+void DestroyInputRecording(InputRecording *r)
+{
+    if (!r)
+    {
+        return;
+    }
+    free(r->frames);
+    free(r->snapshot);
+    free(r);
+}
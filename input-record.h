@@ -0,0 +1,80 @@
+#ifndef INPUT_RECORD_H
+#define INPUT_RECORD_H
+#include "game.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Per frame GameInput, recorded so the game can be run through the
+       exact same frames again. The game only sees the world through
+       GameInput and GameMemory, so replaying the inputs from a copy of the
+       memory it started from repeats the run, up to whatever the streamer
+       happens to have finished loading by each frame.
+
+       Recordings live in memory and can be saved to a file. A file doesn't
+       carry the memory snapshot, the GL objects it would refer to are gone
+       by the time it's loaded again, so saved recordings are made from the
+       first frame on, before the game has any state. */
+
+    typedef struct InputRecordHeader
+    {
+        u32 magic;
+        u32 version;
+        u32 frameCount;
+        u32 reserved;
+    } InputRecordHeader;
+
+#define INPUT_RECORD_MAGIC 0x504e4952 /* "RINP" */
+#define INPUT_RECORD_VERSION 1
+
+    /* GameInput as it's stored, 24 bytes a frame whatever GameInput looks
+       like */
+    typedef struct RecordedInput
+    {
+        f32 dt;
+        f32 time;
+        i32 mouseX;
+        i32 mouseY;
+        u16 viewportWidth;
+        u16 viewportHeight;
+        /* INPUT_MOUSE_* */
+        u8 buttons;
+        u8 reserved[3];
+    } RecordedInput;
+
+#define INPUT_MOUSE_LEFT 0x1
+#define INPUT_MOUSE_RIGHT 0x2
+#define INPUT_MOUSE_MIDDLE 0x4
+
+    typedef struct InputRecording InputRecording;
+
+    InputRecording *CreateInputRecording(void);
+
+    /* Starts over, keeping a copy of the memory the game uses right now
+       to go back to. memory may be NULL for a recording that starts from
+       nothing. */
+    void BeginInputRecording(InputRecording *r, const GameMemory *memory);
+
+    void RecordInput(InputRecording *r, const GameInput *input);
+
+    ifast32 GetInputFrameCount(const InputRecording *r);
+
+    /* input gets the frame'th recorded frame */
+    void GetRecordedInput(const InputRecording *r, ifast32 frame, GameInput *input);
+
+    /* Puts the memory back the way it was when recording began. The game
+       has to have been using the same memory since, GL objects and all. */
+    void RestoreInputSnapshot(const InputRecording *r, GameMemory *memory);
+
+    bool SaveInputRecording(const InputRecording *r, const char *path);
+
+    /* NULL if path isn't a recording */
+    InputRecording *LoadInputRecording(const char *path);
+
+    void DestroyInputRecording(InputRecording *r);
+#ifdef __cplusplus
+}
+#endif
+#endif
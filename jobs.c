@@ -0,0 +1,175 @@
+#define _DEFAULT_SOURCE //sysconf
+#include "jobs.h"
+#include "profile.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct Job
+{
+    JobFunction function;
+    void *data;
+    JobCounter *counter;
+} Job;
+
+struct JobSystem
+{
+    pthread_mutex_t lock;
+    pthread_cond_t queued;
+    /* Broadcast whenever a counter drops to zero */
+    pthread_cond_t finished;
+    /* Ring of queued jobs, grows when full */
+    Job *jobs;
+    u32 jobCap;
+    u32 head;
+    u32 count;
+    bool quitting;
+    pthread_t *threads;
+    ifast32 threadCount;
+};
+
+/* Called with the lock held, which it drops while the job runs */
+local void RunQueuedJob(JobSystem *js)
+{
+    Job job = js->jobs[js->head];
+    js->head = (js->head + 1) % js->jobCap;
+    js->count--;
+    pthread_mutex_unlock(&js->lock);
+
+    job.function(job.data);
+
+    pthread_mutex_lock(&js->lock);
+    if (--job.counter->pending == 0)
+    {
+        pthread_cond_broadcast(&js->finished);
+    }
+}
+
+local void *JobThread(void *param)
+{
+    JobSystem *js = param;
+    PROFILE_THREAD_NAME("Jobs");
+    pthread_mutex_lock(&js->lock);
+    for (;;)
+    {
+        while (!js->quitting && !js->count)
+        {
+            pthread_cond_wait(&js->queued, &js->lock);
+        }
+        if (!js->count)
+        {
+            break;
+        }
+        RunQueuedJob(js);
+    }
+    pthread_mutex_unlock(&js->lock);
+    return NULL;
+}
+
+JobSystem *CreateJobSystem(ifast32 threads)
+{
+    if (threads <= 0)
+    {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cores > 1 ? cores - 1 : 1;
+    }
+    JobSystem *js = calloc(1, sizeof(*js));
+    if (!js)
+    {
+        return NULL;
+    }
+    pthread_mutex_init(&js->lock, NULL);
+    pthread_cond_init(&js->queued, NULL);
+    pthread_cond_init(&js->finished, NULL);
+    js->jobCap = 64;
+    js->jobs = malloc(js->jobCap * sizeof(*js->jobs));
+    js->threads = calloc(threads, sizeof(*js->threads));
+    for (; js->threadCount < threads; js->threadCount++)
+    {
+        if (pthread_create(&js->threads[js->threadCount], NULL, JobThread, js) != 0)
+        {
+            fprintf(stderr, "JOBS: could only start %ld of %ld threads\n",
+                    (long)js->threadCount, (long)threads);
+            break;
+        }
+    }
+    return js;
+}
+
+ifast32 GetJobThreadCount(const JobSystem *js)
+{
+    return js ? js->threadCount : 0;
+}
+
+void RunJob(JobSystem *js, JobCounter *counter, JobFunction function, void *data)
+{
+    if (!js || !js->threadCount)
+    {
+        function(data);
+        return;
+    }
+    pthread_mutex_lock(&js->lock);
+    if (js->count == js->jobCap)
+    {
+        /* Unwrap the ring into the front of the bigger array */
+        Job *jobs = malloc(js->jobCap * 2 * sizeof(*jobs));
+        for (u32 i = 0; i < js->count; i++)
+        {
+            jobs[i] = js->jobs[(js->head + i) % js->jobCap];
+        }
+        free(js->jobs);
+        js->jobs = jobs;
+        js->jobCap *= 2;
+        js->head = 0;
+    }
+    js->jobs[(js->head + js->count) % js->jobCap] = (Job){function, data, counter};
+    js->count++;
+    counter->pending++;
+    pthread_cond_signal(&js->queued);
+    pthread_mutex_unlock(&js->lock);
+}
+
+void WaitJobs(JobSystem *js, JobCounter *counter)
+{
+    if (!js || !js->threadCount)
+    {
+        return;
+    }
+    pthread_mutex_lock(&js->lock);
+    while (counter->pending)
+    {
+        if (js->count)
+        {
+            /* Ours or not, helping beats sleeping */
+            RunQueuedJob(js);
+        }
+        else
+        {
+            pthread_cond_wait(&js->finished, &js->lock);
+        }
+    }
+    pthread_mutex_unlock(&js->lock);
+}
+
+void DestroyJobSystem(JobSystem *js)
+{
+    if (!js)
+    {
+        return;
+    }
+    pthread_mutex_lock(&js->lock);
+    js->quitting = true;
+    pthread_cond_broadcast(&js->queued);
+    pthread_mutex_unlock(&js->lock);
+    for (ifast32 i = 0; i < js->threadCount; i++)
+    {
+        pthread_join(js->threads[i], NULL);
+    }
+    pthread_cond_destroy(&js->finished);
+    pthread_cond_destroy(&js->queued);
+    pthread_mutex_destroy(&js->lock);
+    free(js->threads);
+    free(js->jobs);
+    free(js);
+}
@@ -0,0 +1,42 @@
+#ifndef JOBS_H
+#define JOBS_H
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* A pool of worker threads for short CPU bound jobs (decompression,
+       decoding, anything split into independent pieces). Jobs are grouped
+       under a counter the submitter waits on; waiting runs queued jobs
+       instead of sleeping, so jobs can be waited on from any thread,
+       including from inside other jobs. */
+
+    typedef struct JobSystem JobSystem;
+
+    typedef void (*JobFunction)(void *data);
+
+    /* Jobs in flight under it, zero it before the first RunJob */
+    typedef struct JobCounter
+    {
+        u32 pending;
+    } JobCounter;
+
+    /* threads <= 0 picks one per core, less the calling thread */
+    JobSystem *CreateJobSystem(ifast32 threads);
+
+    ifast32 GetJobThreadCount(const JobSystem *js);
+
+    /* Queues function(data) under counter. With no job system it just
+       runs here. */
+    void RunJob(JobSystem *js, JobCounter *counter, JobFunction function, void *data);
+
+    /* Returns once every job under counter has finished */
+    void WaitJobs(JobSystem *js, JobCounter *counter);
+
+    /* Finishes the queued jobs, then stops the threads */
+    void DestroyJobSystem(JobSystem *js);
+#ifdef __cplusplus
+}
+#endif
+#endif
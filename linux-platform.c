@@ -1,10 +1,36 @@
-#define _DEFAULT_SOURCE //MAP_ANONYMOUS
+#define _DEFAULT_SOURCE //MAP_ANONYMOUS, st_mtim
+#include "asset-stream.h"
+#include "capture.h"
+#include "dynamic-res.h"
+#include "game.h"
+#include "gl-stats.h"
+#include "gl-trace.h"
 #include "glad.h"
+#include "gpu-alloc.h"
+#include "gpu-profile.h"
+#include "input-queue.h"
+#include "input-record.h"
+#include "jobs.h"
+#include "pack.h"
+#include "profile.h"
 #include "rgl.h"
 #include "rutils/debug.h"
 #include "rutils/def.h"
+#include "rutils/math.h"
+#include "scene-target.h"
+#include "stream-buffer.h"
+#include "texture.h"
+#include "vfs.h"
 #include <SDL.h>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #define WIDTH 1280
 #define HEIGHT 720
@@ -14,14 +40,39 @@
 
 #define MEMSIZE (512 * MEGABYTE)
 
-#define VERT_SHADER_PATH "shaders/basic-render.vert"
-#define FRAG_SHADER_PATH "shaders/basic-render.frag"
+/* Mounted in the vfs, plus whatever --mount lays on top */
+#define SHADER_DIR "shaders"
+#define ASSET_PACK_PATH "assets.pack"
+#define GAME_LIBRARY_PATH "./game.so"
+#define FXAA_VERT_SHADER_PATH "shaders/fxaa.vert"
+#define FXAA_FRAG_SHADER_PATH "shaders/fxaa.frag"
 
-typedef struct Vertex
-{
-    Vec3f pos;
-    Vec3f c;
-} Vertex;
+/* Overridden with --aa, cycled through with F5 */
+#define DEFAULT_ANTI_ALIAS "msaa4"
+
+/* The scene's resolution drops as far as this to hold --target-fps, 0 for
+   always full resolution */
+#define DEFAULT_TARGET_FPS 60
+#define DYNAMIC_RES_MIN_SCALE .5f
+
+#define CAPTURE_RING_SIZE 3
+#define CAPTURE_FPS 60
+
+/* Scene geometry is suballocated from buffers of this size */
+#define SCENE_HEAP_BLOCK_SIZE (64 * MEGABYTE)
+/* Scene geometry moved per frame to empty out and release blocks */
+#define SCENE_HEAP_COMPACT_BYTES (1 * MEGABYTE)
+
+/* Per frame budget for texture uploads */
+#define TEXTURE_STAGING_SIZE (8 * MEGABYTE)
+
+#define ASSET_IO_THREADS 2
+#define ASSET_GPU_BUDGET (256 * MEGABYTE)
+/* Buffer data streamed in per frame */
+#define ASSET_UPLOAD_BUDGET (4 * MEGABYTE)
+
+/* Per frame budget for streamed geometry */
+#define DYNAMIC_GEOMETRY_SIZE (256 * KILOBYTE)
 
 local void DebugCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
                          GLsizei len, const GLchar *message, void *userParam)
@@ -132,6 +183,22 @@ local void DebugCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
             srcStr, typeStr, severityStr, id, message);
 }
 
+typedef struct Viewport
+{
+    ifast32 x;
+    ifast32 y;
+    ifast32 w;
+    ifast32 h;
+} Viewport;
+
+local Viewport viewport;
+
+local void SetGLViewport(ifast32 x, ifast32 y, ifast32 w, ifast32 h)
+{
+    viewport = (Viewport){x, y, w, h};
+    glViewport(x, y, w, h);
+}
+
 local void SetProperViewport(ifast32 w, ifast32 h)
 {
 
@@ -140,7 +207,7 @@ local void SetProperViewport(ifast32 w, ifast32 h)
 
     if (F32Eq(aspectRatio, gameAspectRatio, FLT_EPSILON))
     {
-        glViewport(0, 0, w, h);
+        SetGLViewport(0, 0, w, h);
     }
     else
     {
@@ -161,34 +228,368 @@ local void SetProperViewport(ifast32 w, ifast32 h)
             properHeight = rintf((f32)w / gameAspectRatio);
             properY = (h - properHeight) / 2;
         }
-        glViewport(properX, properY, properWidth, properHeight);
+        SetGLViewport(properX, properY, properWidth, properHeight);
     }
 }
 
-local void SDLResizeWindow(SDL_Window *win, ileast32 w, ileast32 h)
+/* How long the main thread sleeps in SDL waiting for an event before it
+   checks whether the frame thread wants anything */
+#define INPUT_WAIT_MS 1
+
+/* SDL wants the window made and its events pumped on the main thread, so
+   those stay there and the frames run on a thread of their own with the GL
+   context. The main thread pumps events into queue as they arrive, so
+   input is picked up at the same rate whatever the frame time. Window size
+   and fullscreen changes are made by the main thread too, the frame loop
+   only hears about the resulting size. */
+typedef struct FrameThread
+{
+    pthread_t thread;
+    InputQueue *queue;
+    SDL_Window *window;
+    SDL_GLContext context;
+    /* Drawable size when the window was created */
+    int width;
+    int height;
+    int argc;
+    char **argv;
+    /* Set by the main thread when the window is closed. A flag rather
+       than an event, which a full queue could drop. */
+    bool quit;
+    /* Requests from the frame thread */
+    bool show;
+    /* Set by the frame thread when it's done with the window and the
+       context, along with what main returns */
+    bool done;
+    int result;
+} FrameThread;
+
+local void PushInput(FrameThread *ft, InputEventType type, i32 a, i32 b)
 {
-    SDL_SetWindowSize(win, w, h);
-    SetProperViewport(w, h);
+    InputEvent e = {SDL_GetPerformanceCounter(), type, a, b};
+    PushInputEvent(ft->queue, &e);
 }
 
-local Vertex vertices[] = {
-    {{.5, .5, .5}, {1, 0, 0}},
-    {{-.5, .5, .5}, {0, 1, 0}},
-    {{.5, -.5, .5}, {0, 0, 1}},
-    {{.5, -.5, .5}, {0, 0, 1}},
-    {{-.5, .5, .5}, {0, 1, 0}},
-    {{-.5, -.5, .5}, {1, 1, 1}},
-    {{.5, .5, 0}, {1, 0, 0}},
-    {{-.5, .5, 0}, {0, 1, 0}},
-    {{.5, -.5, 0}, {0, 0, 1}},
-    {{.5, -.5, 0}, {0, 0, 1}},
-    {{-.5, .5, 0}, {0, 1, 0}},
-    {{-.5, -.5, 0}, {1, 1, 1}}};
+local void SDLResizeWindow(FrameThread *ft, ileast32 w, ileast32 h)
+{
+    SDL_SetWindowSize(ft->window, w, h);
+    PushInput(ft, INPUT_EVENT_RESIZE, w, h);
+}
 
-int main(int argc, char **argv)
+local void SDLSetFullscreen(FrameThread *ft, u32 flags)
+{
+    SDL_SetWindowFullscreen(ft->window, flags);
+    int w, h;
+    SDL_GetWindowSize(ft->window, &w, &h);
+    PushInput(ft, INPUT_EVENT_RESIZE, w, h);
+}
+
+local void HandleSDLEvent(FrameThread *ft, const SDL_Event *e)
+{
+    switch (e->type)
+    {
+    case SDL_QUIT:
+    {
+        __atomic_store_n(&ft->quit, true, __ATOMIC_RELEASE);
+        break;
+    }
+    case SDL_WINDOWEVENT:
+    {
+        SDL_WindowEvent we = e->window;
+        if (we.event == SDL_WINDOWEVENT_RESIZED)
+        {
+            PushInput(ft, INPUT_EVENT_RESIZE, we.data1, we.data2);
+        }
+        break;
+    }
+    case SDL_MOUSEMOTION:
+    {
+        PushInput(ft, INPUT_EVENT_MOUSE_MOVE, e->motion.x, e->motion.y);
+        break;
+    }
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEBUTTONUP:
+    {
+        PushInput(ft, INPUT_EVENT_MOUSE_BUTTON, e->button.button,
+                  e->button.state == SDL_PRESSED);
+        break;
+    }
+    case SDL_KEYDOWN:
+    {
+        SDL_KeyboardEvent k = e->key;
+        if (k.repeat)
+        {
+            break;
+        }
+        if (k.keysym.scancode == SDL_SCANCODE_F1)
+        {
+            SDLResizeWindow(ft, 1136, 630);
+            puts("F1");
+        }
+        else if (k.keysym.scancode == SDL_SCANCODE_F2)
+        {
+            SDLResizeWindow(ft, 1280, 720);
+        }
+        else if (k.keysym.scancode == SDL_SCANCODE_F)
+        {
+            SDLSetFullscreen(ft, SDL_WINDOW_FULLSCREEN_DESKTOP);
+        }
+        else if (k.keysym.scancode == SDL_SCANCODE_D)
+        {
+            SDLSetFullscreen(ft, 0);
+        }
+        else
+        {
+            PushInput(ft, INPUT_EVENT_KEY_DOWN, k.keysym.scancode, 0);
+        }
+        break;
+    }
+    case SDL_KEYUP:
+    {
+        if (e->key.keysym.scancode == SDL_SCANCODE_F1)
+        {
+            puts("F1 release");
+        }
+        break;
+    }
+    default:
+    {
+        break;
+    }
+    }
+}
+
+/* The main thread shows it, the window is created hidden */
+local void ShowFrameThreadWindow(FrameThread *ft)
+{
+    __atomic_store_n(&ft->show, true, __ATOMIC_RELEASE);
+}
+
+typedef struct GameCode
+{
+    void *library;
+    /* The copy it was loaded from, see LoadGameCode */
+    char loadedPath[256];
+    /* Which build of the library that was, to notice the next one */
+    ino_t inode;
+    struct timespec modified;
+    GameUpdateFn *update;
+    GameRenderFn *render;
+    GameShutdownFn *shutdown;
+    u64 stateLayout;
+} GameCode;
+
+local bool CopyFile(const char *from, const char *to)
 {
-    ignore argc;
-    ignore argv;
+    int in = open(from, O_RDONLY | O_CLOEXEC);
+    int out = open(to, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0700);
+    bool ok = in >= 0 && out >= 0;
+    char buffer[64 * KILOBYTE];
+    for (ssize_t n; ok && (n = read(in, buffer, sizeof(buffer))) != 0;)
+    {
+        ok = n > 0 && write(out, buffer, n) == n;
+    }
+    if (in >= 0)
+    {
+        close(in);
+    }
+    if (out >= 0)
+    {
+        ok = close(out) == 0 && ok;
+    }
+    return ok;
+}
+
+/* dlopen hands back the library it already has open for a path, so each
+   build is loaded from a copy of its own. The build renames a finished
+   library into place, so whatever is at path is always complete. Keeps
+   the code already loaded if the new build can't be. A build with a
+   different GameStateLayout starts over on zeroed memory, after the old
+   build has freed what its state held. */
+local bool LoadGameCode(GameCode *code, const char *path, GameMemory *memory,
+                        const GamePlatform *platform)
+{
+    local u32 loadCount;
+    struct stat st;
+    if (stat(path, &st) != 0)
+    {
+        fprintf(stderr, "GAME: could not find %s\n", path);
+        return false;
+    }
+    GameCode loaded = {0};
+    loaded.inode = st.st_ino;
+    loaded.modified = st.st_mtim;
+    snprintf(loaded.loadedPath, sizeof(loaded.loadedPath), "/tmp/game-%d-%u.so", (int)getpid(),
+             (unsigned)loadCount++);
+    if (!CopyFile(path, loaded.loadedPath))
+    {
+        fprintf(stderr, "GAME: could not copy %s to %s\n", path, loaded.loadedPath);
+        unlink(loaded.loadedPath);
+        return false;
+    }
+    loaded.library = dlopen(loaded.loadedPath, RTLD_NOW | RTLD_LOCAL);
+    if (loaded.library)
+    {
+        loaded.update = (GameUpdateFn *)dlsym(loaded.library, GAME_UPDATE_SYMBOL);
+        loaded.render = (GameRenderFn *)dlsym(loaded.library, GAME_RENDER_SYMBOL);
+        loaded.shutdown = (GameShutdownFn *)dlsym(loaded.library, GAME_SHUTDOWN_SYMBOL);
+        const u64 *layout = dlsym(loaded.library, GAME_STATE_LAYOUT_SYMBOL);
+        loaded.stateLayout = layout ? *layout : 0;
+    }
+    if (!loaded.update || !loaded.render || !loaded.shutdown || !loaded.stateLayout)
+    {
+        fprintf(stderr, "GAME: could not load %s: %s\n", path, dlerror());
+        if (loaded.library)
+        {
+            dlclose(loaded.library);
+        }
+        unlink(loaded.loadedPath);
+        /* Not worth retrying until there's another build */
+        code->inode = loaded.inode;
+        code->modified = loaded.modified;
+        return false;
+    }
+
+    if (code->library)
+    {
+        if (loaded.stateLayout != code->stateLayout && memory->used)
+        {
+            fputs("GAME: the state layout changed, starting over\n", stderr);
+            isize used = memory->used;
+            code->shutdown(memory, platform);
+            memset(memory->base, 0, used);
+            memory->used = 0;
+        }
+        dlclose(code->library);
+        unlink(code->loadedPath);
+    }
+    *code = loaded;
+    return true;
+}
+
+/* L starts recording, L again plays what was recorded over and over from
+   where it started, L once more goes back to live input */
+typedef enum LiveLoopState
+{
+    LIVE_LOOP_OFF,
+    LIVE_LOOP_RECORDING,
+    LIVE_LOOP_PLAYING
+} LiveLoopState;
+
+local bool GameCodeChanged(const GameCode *code, const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 &&
+           (st.st_ino != code->inode || st.st_mtim.tv_sec != code->modified.tv_sec ||
+            st.st_mtim.tv_nsec != code->modified.tv_nsec);
+}
+
+local void UnloadGameCode(GameCode *code)
+{
+    if (code->library)
+    {
+        dlclose(code->library);
+        unlink(code->loadedPath);
+    }
+    *code = (GameCode){0};
+}
+
+/* Everything from setup to teardown of a run, on the frame thread with
+   the context current */
+/* Of the last frame the GPU profiler resolved, 0 if it had no such pass */
+local f32 GetGpuPassMs(const char *name)
+{
+    ifast32 passCount;
+    const GpuPassTiming *passes = GetGpuPassTimings(&passCount);
+    for (ifast32 i = 0; i < passCount; i++)
+    {
+        if (strcmp(passes[i].name, name) == 0)
+        {
+            return passes[i].ms;
+        }
+    }
+    return 0;
+}
+
+local int RunFrames(FrameThread *ft, int argc, char **argv)
+{
+    const char *capturePath = NULL;
+    const char *tracePath = "trace.json";
+    bool glStats = false;
+    const char *glRecordPath = NULL;
+    ifast32 glRecordFrames = 0;
+    const char *packPath = ASSET_PACK_PATH;
+    const char *gamePath = GAME_LIBRARY_PATH;
+    const char *manifestPath = NULL;
+    const char *inputRecordPath = NULL;
+    const char *inputReplayPath = NULL;
+    bool benchmark = false;
+    ifast32 targetFps = DEFAULT_TARGET_FPS;
+    const char *antiAliasName = DEFAULT_ANTI_ALIAS;
+    const char *mountDirs[16];
+    ifast32 mountDirCount = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc)
+        {
+            capturePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            tracePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--gl-stats") == 0)
+        {
+            glStats = true;
+        }
+        else if (strcmp(argv[i], "--pack") == 0 && i + 1 < argc)
+        {
+            packPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--game") == 0 && i + 1 < argc)
+        {
+            gamePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--manifest") == 0 && i + 1 < argc)
+        {
+            manifestPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--mount") == 0 && i + 1 < argc &&
+                 mountDirCount < (ifast32)countof(mountDirs))
+        {
+            mountDirs[mountDirCount++] = argv[++i];
+        }
+        else if (strcmp(argv[i], "--aa") == 0 && i + 1 < argc)
+        {
+            antiAliasName = argv[++i];
+        }
+        else if (strcmp(argv[i], "--target-fps") == 0 && i + 1 < argc)
+        {
+            targetFps = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+        {
+            inputRecordPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+        {
+            inputReplayPath = argv[++i];
+        }
+        /* Replays once as fast as it'll go with the window hidden, then
+           quits with the frame times */
+        else if (strcmp(argv[i], "--benchmark") == 0 && i + 1 < argc)
+        {
+            inputReplayPath = argv[++i];
+            benchmark = true;
+        }
+        else if (strcmp(argv[i], "--record-gl") == 0 && i + 2 < argc)
+        {
+            glRecordPath = argv[++i];
+            glRecordFrames = atoi(argv[++i]);
+        }
+    }
+
+    ignore tracePath;
 
 #if defined(DEBUG) && !defined(NO_FIXED_MEM_LOCATION)
     void *memloc = (void *)0x400000;
@@ -204,74 +605,103 @@ int main(int argc, char **argv)
         return 1;
     }
 
-    SDL_Init(SDL_INIT_VIDEO);
-
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK,
-                        SDL_GL_CONTEXT_PROFILE_CORE);
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
-    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 5);
-    SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
-
-    /* TODO: properly get multisample values */
-    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS, 1);
-    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES, 16);
-
-    u32 flags = SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN;
-#if defined(RESIZABLE_WINDOW)
-    flags |= SDL_WINDOW_RESIZABLE;
-#endif
-
-    SDL_Window *win = SDL_CreateWindow("Title", 0, 0, WIDTH, HEIGHT, flags);
-
-    SDL_GLContext *c = SDL_GL_CreateContext(win);
+    SDL_Window *win = ft->window;
+    SDL_GL_MakeCurrent(win, ft->context);
 
-    SDL_GL_MakeCurrent(win, c);
-
-    if (SDL_GL_SetSwapInterval(-1) == -1)
+    if (benchmark)
+    {
+        SDL_GL_SetSwapInterval(0);
+    }
+    else if (SDL_GL_SetSwapInterval(-1) == -1)
     {
         SDL_GL_SetSwapInterval(1);
     }
 
+#if defined(GLAD_LAZY)
+    INVARIANT(gladLoadGLLazy((GLADloadproc)SDL_GL_GetProcAddress), "Could not load GL");
+#else
     INVARIANT(gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress), "Could not load GL");
+#endif
 
-    u32 vertexBuffer;
-
-    glCreateBuffers(1, &vertexBuffer);
-
-    glNamedBufferData(vertexBuffer, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    GLuint vertexArrayObject;
-    glGenVertexArrays(1, &vertexArrayObject);
+    if (glStats && !InstallGLStats())
+    {
+        fputs("--gl-stats needs a build with instrument=on\n", stderr);
+        glStats = false;
+    }
 
-    glBindVertexArray(vertexArrayObject);
-    glBindVertexBuffer(0, vertexBuffer, 0, sizeof(Vertex));
-    /* Vertex position in worldspace */
-    glVertexAttribFormat(0, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, pos));
-    glEnableVertexAttribArray(0);
+    /* Everything from here on goes into the trace's setup section */
+    if (glRecordPath)
+    {
+        BeginGLTraceRecording(glRecordPath, glRecordFrames, WIDTH, HEIGHT);
+    }
 
-    /* Vertex color */
-    glVertexAttribFormat(1, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, c));
-    glEnableVertexAttribArray(1);
+    GpuHeap *sceneHeap = CreateGpuHeap(SCENE_HEAP_BLOCK_SIZE, "scene geometry");
 
-    glVertexAttribBinding(0, 0);
-    glVertexAttribBinding(1, 0);
+    /* Decompresses pack entries */
+    JobSystem *jobs = CreateJobSystem(0);
+    TextureUploader *textureUploader = CreateTextureUploader(TEXTURE_STAGING_SIZE, jobs);
+    Vfs *vfs = CreateVfs(jobs);
+    MountVfsDirectory(vfs, SHADER_DIR, SHADER_DIR);
 
-    Mat4f proj = CreatePerspectiveMat4f(DegToRad(45), 16.0 / 9.0, .1, 10);
-    Mat4f view = CalcLookAtMat4f(vec3f(2, 2, 2), vec3f(0, 0, 0), vec3f(0, 0, 1));
+    /* Stays open for as long as anything streams out of it */
+    AssetPack *pack = OpenAssetPack(packPath);
+    AssetStreamer *streamer = NULL;
+    if (pack)
+    {
+        /* Entries are read whole, by the streamer through its own
+           descriptor and out of the mapping by the rest, so readahead
+           around one would only pull in its neighbours */
+        AdviseAssetPack(pack, PACK_ACCESS_RANDOM);
+        if (manifestPath)
+        {
+            PrefetchPackManifest(pack, manifestPath);
+        }
+        MountVfsPack(vfs, pack, NULL);
+    }
+    /* Laid over everything above, a later --mount over earlier ones */
+    for (ifast32 i = 0; i < mountDirCount; i++)
+    {
+        MountVfsDirectory(vfs, mountDirs[i], NULL);
+    }
+    if (pack && textureUploader)
+    {
+        AssetStreamerConfig config = {ASSET_IO_THREADS, ASSET_GPU_BUDGET, ASSET_UPLOAD_BUDGET,
+                                      jobs};
+        streamer = CreateAssetStreamer(pack, textureUploader, sceneHeap, &config);
+    }
 
-    ShaderProg s = CreateShaderProg(VERT_SHADER_PATH, FRAG_SHADER_PATH);
+    /* Per frame geometry */
+    StreamBuffer *dynamicGeometry = CreateStreamBuffer(DYNAMIC_GEOMETRY_SIZE, 3, "dynamic geometry");
 
-    UseShaderProg(s);
-    SetUniformMat4fShaderProg(s, "proj", &proj);
-    SetUniformMat4fShaderProg(s, "view", &view);
+    GamePlatform platform = {vfs, pack, streamer, sceneHeap, dynamicGeometry};
+    GameMemory memory = {gameMem, MEMSIZE};
+    GameCode game = {0};
+    if (!LoadGameCode(&game, gamePath, &memory, NULL))
     {
-        int w, h;
-        SDL_GetWindowSize(win, &w, &h);
+        return 1;
+    }
 
-        SetProperViewport(w, h);
+    /* Saved recordings start before the game has any state, so replaying
+       one from the first frame repeats the run it was made from */
+    InputRecording *inputRecord = NULL;
+    if (inputRecordPath)
+    {
+        inputRecord = CreateInputRecording();
+        BeginInputRecording(inputRecord, NULL);
+    }
+    InputRecording *inputReplay = inputReplayPath ? LoadInputRecording(inputReplayPath) : NULL;
+    ifast32 replayFrame = 0;
+    if (benchmark && !inputReplay)
+    {
+        return 1;
     }
 
-    glEnable(GL_MULTISAMPLE);
+    InputRecording *liveLoop = CreateInputRecording();
+    LiveLoopState liveLoopState = LIVE_LOOP_OFF;
+    ifast32 liveLoopFrame = 0;
+
+    SetProperViewport(ft->width, ft->height);
+
     glEnable(GL_DEPTH_TEST);
 
 #if defined(DEBUG) && !defined(NO_DEBUG_OUTPUT)
@@ -281,80 +711,195 @@ int main(int argc, char **argv)
 
     glClearColor(.1, .1, .1, 1);
 
+    SceneAntiAlias antiAlias;
+    ifast32 samples;
+    if (!ParseSceneAntiAlias(antiAliasName, &antiAlias, &samples))
+    {
+        fprintf(stderr, "Unknown --aa %s, want off, fxaa or msaa<samples>\n", antiAliasName);
+        ParseSceneAntiAlias(DEFAULT_ANTI_ALIAS, &antiAlias, &samples);
+    }
+    ShaderProg fxaa;
+    {
+        char *vertSource = LoadVfsPath(vfs, MakeVfsPath(FXAA_VERT_SHADER_PATH), NULL);
+        char *fragSource = LoadVfsPath(vfs, MakeVfsPath(FXAA_FRAG_SHADER_PATH), NULL);
+        fxaa = CreateShaderProgFromSource(vertSource ? vertSource : "", fragSource ? fragSource : "");
+        free(vertSource);
+        free(fragSource);
+    }
+    SceneTarget *sceneTarget = CreateSceneTarget(viewport.w, viewport.h, antiAlias, samples,
+                                                 fxaa._id);
+    /* Benchmarks compare like with like, always at full resolution */
+    DynamicRes *dynamicRes = targetFps > 0 && !benchmark
+                                 ? CreateDynamicRes(1000.f / targetFps, DYNAMIC_RES_MIN_SCALE)
+                                 : NULL;
+    u64 gpuFramesResolved = 0;
+
+    InitGpuProfiler();
+
     bool running = true;
 
     f32 totalTime = 0;
     ufast32 lastTime = SDL_GetTicks();
 
-    SDL_ShowWindow(win);
+    if (!benchmark)
+    {
+        ShowFrameThreadWindow(ft);
+    }
+
+    /* Follows the letterboxed viewport as the window is resized */
+    FrameCapture *capture = NULL;
+    if (capturePath)
+    {
+        capture = CreateFrameCapture(capturePath, CaptureFormatFromPath(capturePath),
+                                     viewport.w, viewport.h,
+                                     CAPTURE_RING_SIZE, CAPTURE_FPS);
+        if (!capture)
+        {
+            fprintf(stderr, "CAPTURE: could not start capturing to %s\n", capturePath);
+        }
+    }
+
+    /* Kept up to date by the input thread's events */
+    ifast32 mouseX = 0;
+    ifast32 mouseY = 0;
+    bool mouseLeft = false;
+    bool mouseRight = false;
+    bool mouseMiddle = false;
 
+    u64 benchmarkStart = SDL_GetPerformanceCounter();
+    f64 benchmarkWorstMs = 0;
     while (running)
     {
+        PROFILE_SCOPE("Frame");
+
         /* Input and housekeeping */
+        PROFILE_BEGIN("Input");
         ufast32 startTime = SDL_GetTicks();
+        u64 startCounter = SDL_GetPerformanceCounter();
         f32 dt = (f32)(startTime - lastTime);
         totalTime += (f32)dt / 1000;
-        SDL_Event e;
-        while (SDL_PollEvent(&e))
+        if (__atomic_load_n(&ft->quit, __ATOMIC_ACQUIRE))
+        {
+            running = false;
+        }
+        /* Everything that happened before the frame started, anything
+           later waits for the next one */
+        InputEvent e;
+        while (PopInputEvent(ft->queue, startCounter, &e))
         {
             switch (e.type)
             {
-            case SDL_QUIT:
+            case INPUT_EVENT_RESIZE:
             {
-                running = false;
+                SetProperViewport(e.a, e.b);
+                ResizeSceneTarget(sceneTarget, viewport.w, viewport.h);
+                if (capture)
+                {
+                    ResizeFrameCapture(capture, viewport.w, viewport.h);
+                }
+                break;
+            }
+            case INPUT_EVENT_MOUSE_MOVE:
+            {
+                mouseX = e.a;
+                mouseY = e.b;
                 break;
             }
-            case SDL_WINDOWEVENT:
+            case INPUT_EVENT_MOUSE_BUTTON:
             {
-                SDL_WindowEvent we = e.window;
-                if (we.event == SDL_WINDOWEVENT_RESIZED)
+                if (e.a == SDL_BUTTON_LEFT)
+                {
+                    mouseLeft = e.b;
+                }
+                else if (e.a == SDL_BUTTON_RIGHT)
+                {
+                    mouseRight = e.b;
+                }
+                else if (e.a == SDL_BUTTON_MIDDLE)
                 {
-                    SetProperViewport(we.data1, we.data2);
+                    mouseMiddle = e.b;
                 }
                 break;
             }
-            case SDL_KEYDOWN:
+            case INPUT_EVENT_KEY_DOWN:
             {
-                SDL_KeyboardEvent k = e.key;
-                if (!k.repeat)
+                if (e.a == SDL_SCANCODE_F3)
                 {
-                    if (k.keysym.scancode == SDL_SCANCODE_F1)
+                    ifast32 passCount;
+                    const GpuPassTiming *passes = GetGpuPassTimings(&passCount);
+                    printf("GPU %.3fms, scene at %d%% resolution\n", GetGpuFrameMs(),
+                           (int)rintf(GetSceneRenderScale(sceneTarget) * 100));
+                    if (streamer)
                     {
-                        SDLResizeWindow(win, 1136, 630);
-                        puts("F1");
+                        AssetStreamStats stats = GetAssetStreamStats(streamer);
+                        printf("Streaming: %.1f%% hits, %.2fMB/s, %.2fMB resident, %d queued\n",
+                               stats.hitRate * 100, stats.bandwidth / MEGABYTE,
+                               (f64)stats.residentBytes / MEGABYTE, (int)stats.queued);
                     }
-                    else if (k.keysym.scancode == SDL_SCANCODE_F2)
+                    for (ifast32 i = 0; i < passCount; i++)
                     {
-                        SDLResizeWindow(win, 1280, 720);
+                        printf("%*s%s: %.3fms (avg %.3fms)\n", (int)(passes[i].depth + 1) * 2, "",
+                               passes[i].name, passes[i].ms, passes[i].avgMs);
                     }
-                    else if (k.keysym.scancode == SDL_SCANCODE_ESCAPE)
+                }
+                else if (e.a == SDL_SCANCODE_F5)
+                {
+                    /* off, FXAA, then MSAA 2x up to 8x */
+                    SceneAntiAlias current = GetSceneAntiAlias(sceneTarget, &samples);
+                    ifast32 previous = current == SCENE_AA_MSAA ? samples : 1;
+                    if (current == SCENE_AA_NONE)
                     {
-                        running = false;
+                        SetSceneAntiAlias(sceneTarget, SCENE_AA_FXAA, 1);
+                        puts("AA: FXAA");
                     }
-                    else if (k.keysym.scancode == SDL_SCANCODE_F)
+                    else if (previous < 8)
                     {
-                        SDL_SetWindowFullscreen(win, SDL_WINDOW_FULLSCREEN_DESKTOP);
-                        int w, h;
-                        SDL_GetWindowSize(win, &w, &h);
-                        SetProperViewport(w, h);
+                        SetSceneAntiAlias(sceneTarget, SCENE_AA_MSAA, previous * 2);
+                        GetSceneAntiAlias(sceneTarget, &samples);
                     }
-                    else if (k.keysym.scancode == SDL_SCANCODE_D)
+                    if (current != SCENE_AA_NONE)
                     {
-                        SDL_SetWindowFullscreen(win, 0);
-                        int w, h;
-                        SDL_GetWindowSize(win, &w, &h);
-                        SetProperViewport(w, h);
+                        /* Past 8x, or past what GL supports */
+                        if (previous < 8 && samples > previous)
+                        {
+                            printf("AA: MSAA %dx\n", (int)samples);
+                        }
+                        else
+                        {
+                            SetSceneAntiAlias(sceneTarget, SCENE_AA_NONE, 1);
+                            puts("AA: off");
+                        }
                     }
                 }
-                break;
-            }
-
-            case SDL_KEYUP:
-            {
-                if (e.key.keysym.scancode == SDL_SCANCODE_F1)
+                else if (e.a == SDL_SCANCODE_F4 && glStats)
+                {
+                    PrintGLFrameStats(stdout, 10);
+                }
+                else if (e.a == SDL_SCANCODE_L)
+                {
+                    if (liveLoopState == LIVE_LOOP_OFF)
+                    {
+                        BeginInputRecording(liveLoop, &memory);
+                        liveLoopState = LIVE_LOOP_RECORDING;
+                        puts("Recording input");
+                    }
+                    else if (liveLoopState == LIVE_LOOP_RECORDING && GetInputFrameCount(liveLoop))
+                    {
+                        liveLoopState = LIVE_LOOP_PLAYING;
+                        liveLoopFrame = GetInputFrameCount(liveLoop);
+                        puts("Looping input");
+                    }
+                    else
+                    {
+                        liveLoopState = LIVE_LOOP_OFF;
+                        puts("Live input");
+                    }
+                }
+                else if (e.a == SDL_SCANCODE_ESCAPE)
                 {
-                    puts("F1 release");
+                    running = false;
                 }
+                break;
             }
             default:
             {
@@ -362,71 +907,271 @@ int main(int argc, char **argv)
             }
             }
         }
-        int windowWidth, windowHeight;
-        SDL_GetWindowSize(win, &windowWidth, &windowHeight);
-
-        /* Mouse calculations */
-        int windowX, windowY;
-        SDL_GetWindowPosition(win, &windowX, &windowY);
-
-        int absoluteMouseX, absoluteMouseY;
-        ufast32 mouseState = SDL_GetGlobalMouseState(&absoluteMouseX, &absoluteMouseY);
-        ufast32 mouseLeft = SDL_BUTTON(1) & mouseState;
-        ufast32 mouseRight = SDL_BUTTON(3) & mouseState;
-        ufast32 mouseMid = SDL_BUTTON(2) & mouseState;
-
-        ifast32 relativeMouseX = absoluteMouseX - windowX;
-        ifast32 relativeMouseY = absoluteMouseY - windowY;
 
-        ignore relativeMouseX;
-        ignore relativeMouseY;
-        /* update */
-        Mat4f model = RotateMat4f(&IdMat4f, totalTime * DegToRad(90), vec3f(0, 0, 1));
-
-        if (mouseLeft)
+        GameInput input = {dt / 1000, totalTime, viewport.w, viewport.h, mouseX, mouseY,
+                           mouseLeft, mouseRight, mouseMiddle};
+        if (inputReplay && replayFrame < GetInputFrameCount(inputReplay))
         {
-            glClearColor(1, 0, 0, 1);
+            GetRecordedInput(inputReplay, replayFrame++, &input);
         }
-        else if (mouseRight)
+        else if (liveLoopState == LIVE_LOOP_PLAYING)
         {
-            glClearColor(0, 1, 0, 1);
+            if (liveLoopFrame == GetInputFrameCount(liveLoop))
+            {
+                RestoreInputSnapshot(liveLoop, &memory);
+                liveLoopFrame = 0;
+            }
+            GetRecordedInput(liveLoop, liveLoopFrame++, &input);
         }
-        else if (mouseMid)
+        else if (liveLoopState == LIVE_LOOP_RECORDING)
         {
-            glClearColor(0, 0, 1, 1);
+            RecordInput(liveLoop, &input);
         }
-        else
+        if (inputRecord)
         {
-            glClearColor(.1, .1, .1, 1);
+            RecordInput(inputRecord, &input);
         }
 
-        /* Render */
+        /* A new build takes over from this frame on, with the same memory */
+        if (GameCodeChanged(&game, gamePath) &&
+            LoadGameCode(&game, gamePath, &memory, &platform))
         {
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            puts("Reloaded game code");
+            /* Started over, the loop's snapshot is of the old layout */
+            if (liveLoopState != LIVE_LOOP_OFF && !memory.used)
+            {
+                liveLoopState = LIVE_LOOP_OFF;
+                puts("Live input");
+            }
+        }
+        PROFILE_END();
 
-            /* Set relevant state */
-            SetUniformMat4fShaderProg(s, "model", &model);
+        /* update */
+        PROFILE_BEGIN("Update");
+        game.update(&memory, &platform, &input);
+        PROFILE_END();
 
-            glBindVertexArray(vertexArrayObject);
-            UseShaderProg(s);
-            glDrawArrays(GL_TRIANGLES, 0, countof(vertices));
+        /* Render */
+        BeginGpuFrame();
+        {
+            PROFILE_SCOPE("Render");
+            BeginGpuPass("Scene");
+            BeginSceneTarget(sceneTarget);
+            game.render(&memory, &platform);
+            EndGpuPass();
+            BeginGpuPass("Resolve");
+            PresentSceneTarget(sceneTarget, viewport.x, viewport.y, viewport.w, viewport.h);
+            EndGpuPass();
         }
 
         /* End of frame housekeeping */
+        if (capture)
+        {
+            PROFILE_SCOPE("Capture");
+            BeginGpuPass("Capture readback");
+            CaptureFrame(capture, viewport.x, viewport.y);
+            EndGpuPass();
+        }
+        EndGpuFrame();
+        if (dynamicRes)
+        {
+            /* Only once per frame whose timings came in, not per frame run.
+               Only the scene scales with the render scale, the resolve and
+               capture readback cost the same at any scale. */
+            u64 resolved = GetGpuProfileStats().framesResolved;
+            if (resolved != gpuFramesResolved)
+            {
+                gpuFramesResolved = resolved;
+                f32 sceneMs = GetGpuPassMs("Scene");
+                f32 fixedMs = GetGpuFrameMs() - sceneMs;
+                SetSceneRenderScale(sceneTarget, UpdateDynamicRes(dynamicRes, sceneMs,
+                                                                  fixedMs > 0 ? fixedMs : 0));
+            }
+        }
+        if (streamer)
+        {
+            UpdateAssetStreamer(streamer);
+        }
+        if (sceneHeap)
+        {
+            PROFILE_SCOPE("Heap compaction");
+            CompactGpuHeap(sceneHeap, SCENE_HEAP_COMPACT_BYTES);
+        }
+        if (textureUploader)
+        {
+            PROFILE_SCOPE("Texture uploads");
+            ProcessTextureUploads(textureUploader);
+        }
+        if (dynamicGeometry)
+        {
+            EndStreamBufferFrame(dynamicGeometry);
+        }
+        PROFILE_BEGIN("Swap");
         SDL_GL_SwapWindow(win);
+        PROFILE_END();
+        if (glStats)
+        {
+            EndGLStatsFrame();
+        }
+        EndGLTraceFrame();
+        PROFILE_COLLECT();
         lastTime = startTime;
+
+        if (benchmark)
+        {
+            f64 frameMs = (f64)(SDL_GetPerformanceCounter() - startCounter) * 1000 /
+                          SDL_GetPerformanceFrequency();
+            benchmarkWorstMs = frameMs > benchmarkWorstMs ? frameMs : benchmarkWorstMs;
+        }
+        if (inputReplay && replayFrame == GetInputFrameCount(inputReplay))
+        {
+            if (benchmark)
+            {
+                f64 totalMs = (f64)(SDL_GetPerformanceCounter() - benchmarkStart) * 1000 /
+                              SDL_GetPerformanceFrequency();
+                printf("Benchmark: %d frames in %.1fms, %.3fms average, %.3fms worst\n",
+                       (int)replayFrame, totalMs, totalMs / (replayFrame ? replayFrame : 1),
+                       benchmarkWorstMs);
+                running = false;
+            }
+            else
+            {
+                puts("Replay done, live input");
+            }
+            DestroyInputRecording(inputReplay);
+            inputReplay = NULL;
+        }
+    }
+
+    if (capture)
+    {
+        FrameCaptureStats stats = GetFrameCaptureStats(capture);
+        DestroyFrameCapture(capture);
+        printf("Captured %" PRIu64 " frames (%" PRIu64 " GPU stalls, %" PRIu64 " encoder stalls)\n",
+               stats.framesRequested, stats.gpuStalls, stats.encoderStalls);
     }
-    SDL_HideWindow(win);
 
-    glDeleteVertexArrays(1, &vertexArrayObject);
+    DestroyGpuProfiler();
+    DestroyDynamicRes(dynamicRes);
+    DestroySceneTarget(sceneTarget);
+    glDeleteProgram(fxaa._id);
 
-    glDeleteBuffers(1, &vertexBuffer);
+    if (inputRecord)
+    {
+        SaveInputRecording(inputRecord, inputRecordPath);
+        DestroyInputRecording(inputRecord);
+    }
+    DestroyInputRecording(inputReplay);
+    DestroyInputRecording(liveLoop);
+
+    game.shutdown(&memory, &platform);
+    UnloadGameCode(&game);
+    if (streamer)
+    {
+        DestroyAssetStreamer(streamer);
+    }
+    DestroyVfs(vfs);
+    CloseAssetPack(pack);
+    if (textureUploader)
+    {
+        DestroyTextureUploader(textureUploader);
+    }
+    DestroyJobSystem(jobs);
+    DestroySamplers();
+    if (dynamicGeometry)
+    {
+        DestroyStreamBuffer(dynamicGeometry);
+    }
 
-    SDL_GL_DeleteContext(c);
+    DestroyGpuHeap(sceneHeap);
 
-    SDL_DestroyWindow(win);
+    EndGLTraceRecording();
+
+    if (glStats)
+    {
+        UninstallGLStats();
+    }
 
     munmap(gameMem, MEMSIZE);
 
+    PROFILE_WRITE_TRACE(tracePath);
+    return 0;
+}
+
+local void *RunFrameThread(void *param)
+{
+    FrameThread *ft = param;
+    PROFILE_THREAD_NAME("Frames");
+    ft->result = RunFrames(ft, ft->argc, ft->argv);
+    /* The main thread deletes the context, it can't be current here then */
+    SDL_GL_MakeCurrent(ft->window, NULL);
+    __atomic_store_n(&ft->done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    PROFILE_INIT();
+
+    SDL_Init(SDL_INIT_VIDEO);
+
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK,
+                        SDL_GL_CONTEXT_PROFILE_CORE);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 5);
+    SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+    /* Only presented to, the scene target does the antialiasing */
+    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS, 0);
+    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES, 0);
+
+    u32 flags = SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN;
+#if defined(RESIZABLE_WINDOW)
+    flags |= SDL_WINDOW_RESIZABLE;
+#endif
+
+    FrameThread ft = {0};
+    ft.argc = argc;
+    ft.argv = argv;
+    ft.window = SDL_CreateWindow("Title", 0, 0, WIDTH, HEIGHT, flags);
+    /* Created here against the window, made current on the frame thread */
+    ft.context = ft.window ? SDL_GL_CreateContext(ft.window) : NULL;
+    ft.queue = CreateInputQueue();
+    if (!ft.window || !ft.context || !ft.queue)
+    {
+        puts("Could not create the window");
+        return 1;
+    }
+    SDL_GL_MakeCurrent(ft.window, NULL);
+    SDL_GetWindowSize(ft.window, &ft.width, &ft.height);
+
+    if (pthread_create(&ft.thread, NULL, RunFrameThread, &ft) != 0)
+    {
+        puts("Could not start the frame thread");
+        return 1;
+    }
+    while (!__atomic_load_n(&ft.done, __ATOMIC_ACQUIRE))
+    {
+        if (__atomic_exchange_n(&ft.show, false, __ATOMIC_ACQ_REL))
+        {
+            SDL_ShowWindow(ft.window);
+        }
+        SDL_Event e;
+        while (SDL_WaitEventTimeout(&e, INPUT_WAIT_MS))
+        {
+            HandleSDLEvent(&ft, &e);
+        }
+    }
+    pthread_join(ft.thread, NULL);
+
+    u64 dropped = GetDroppedInputEvents(ft.queue);
+    if (dropped)
+    {
+        fprintf(stderr, "INPUT: dropped %d events\n", (int)dropped);
+    }
+    DestroyInputQueue(ft.queue);
+    SDL_GL_DeleteContext(ft.context);
+    SDL_HideWindow(ft.window);
+    SDL_DestroyWindow(ft.window);
     SDL_Quit();
+    return ft.result;
 }
@@ -0,0 +1,197 @@
+#include "lz4.h"
+#include <string.h>
+
+#define LZ4_MIN_MATCH 4
+/* The format ends every block on at least this many literals... */
+#define LZ4_LAST_LITERALS 5
+/* ...and the last match starts at least this far from the end */
+#define LZ4_MATCH_LIMIT 12
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_BITS 12
+/* Positions since the last match after which the matcher starts skipping
+   ahead, so incompressible data goes through quickly */
+#define LZ4_SKIP_TRIGGER 6
+
+isize Lz4CompressBound(isize size)
+{
+    return size + size / 255 + 16;
+}
+
+local u32 Read32(const u8 *p)
+{
+    u32 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+local u32 HashSequence(u32 sequence)
+{
+    return (sequence * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+local u8 *WriteLength(u8 *out, isize length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        *out++ = 255;
+    }
+    *out++ = (u8)length;
+    return out;
+}
+
+/* A run of literals followed by a match, matchLength 0 for the final run */
+local u8 *WriteSequence(u8 *out, const u8 *end, const u8 *literals, isize literalCount,
+                        isize offset, isize matchLength)
+{
+    isize worst = 1 + literalCount / 255 + 1 + literalCount + 2 + matchLength / 255 + 1;
+    if (end - out < worst)
+    {
+        return NULL;
+    }
+    u8 *token = out++;
+    *token = (u8)((literalCount < 15 ? literalCount : 15) << 4);
+    if (literalCount >= 15)
+    {
+        out = WriteLength(out, literalCount - 15);
+    }
+    memcpy(out, literals, literalCount);
+    out += literalCount;
+    if (!matchLength)
+    {
+        return out;
+    }
+    *out++ = (u8)offset;
+    *out++ = (u8)(offset >> 8);
+    isize length = matchLength - LZ4_MIN_MATCH;
+    *token |= (u8)(length < 15 ? length : 15);
+    if (length >= 15)
+    {
+        out = WriteLength(out, length - 15);
+    }
+    return out;
+}
+
+isize CompressLz4Block(const void *src, isize size, void *dst, isize capacity)
+{
+    const u8 *in = src;
+    u8 *out = dst;
+    u8 *end = out + capacity;
+    /* Last position each hashed sequence was seen at */
+    u32 table[1 << LZ4_HASH_BITS];
+    memset(table, 0, sizeof(table));
+
+    isize anchor = 0;
+    isize i = 0;
+    while (i + LZ4_MATCH_LIMIT < size)
+    {
+        u32 sequence = Read32(in + i);
+        u32 hash = HashSequence(sequence);
+        isize candidate = table[hash];
+        table[hash] = (u32)i;
+        if (candidate >= i || i - candidate > LZ4_MAX_OFFSET || Read32(in + candidate) != sequence)
+        {
+            i += 1 + ((i - anchor) >> LZ4_SKIP_TRIGGER);
+            continue;
+        }
+
+        isize matchEnd = i + LZ4_MIN_MATCH;
+        while (matchEnd < size - LZ4_LAST_LITERALS && in[matchEnd] == in[candidate + matchEnd - i])
+        {
+            matchEnd++;
+        }
+        while (i > anchor && candidate > 0 && in[i - 1] == in[candidate - 1])
+        {
+            i--;
+            candidate--;
+        }
+        out = WriteSequence(out, end, in + anchor, i - anchor, i - candidate, matchEnd - i);
+        if (!out)
+        {
+            return 0;
+        }
+        i = matchEnd;
+        anchor = i;
+    }
+    out = WriteSequence(out, end, in + anchor, size - anchor, 0, 0);
+    return out ? out - (u8 *)dst : 0;
+}
+
+/* Adds up a length's 255 continuation bytes, -1 if they run off the end */
+local isize ReadLength(const u8 **in, const u8 *end, isize length)
+{
+    u8 b;
+    do
+    {
+        if (*in >= end)
+        {
+            return -1;
+        }
+        b = *(*in)++;
+        length += b;
+    } while (b == 255);
+    return length;
+}
+
+isize DecompressLz4Block(const void *src, isize srcSize, void *dst, isize dstSize)
+{
+    const u8 *in = src;
+    const u8 *inEnd = in + srcSize;
+    u8 *out = dst;
+    u8 *outEnd = out + dstSize;
+    while (in < inEnd)
+    {
+        u8 token = *in++;
+        isize literals = token >> 4;
+        if (literals == 15 && (literals = ReadLength(&in, inEnd, literals)) < 0)
+        {
+            return -1;
+        }
+        if (literals > inEnd - in || literals > outEnd - out)
+        {
+            return -1;
+        }
+        memcpy(out, in, literals);
+        out += literals;
+        in += literals;
+        if (in == inEnd)
+        {
+            break;
+        }
+
+        if (inEnd - in < 2)
+        {
+            return -1;
+        }
+        isize offset = in[0] | (in[1] << 8);
+        in += 2;
+        if (!offset || offset > out - (u8 *)dst)
+        {
+            return -1;
+        }
+        isize length = token & 15;
+        if (length == 15 && (length = ReadLength(&in, inEnd, length)) < 0)
+        {
+            return -1;
+        }
+        length += LZ4_MIN_MATCH;
+        if (length > outEnd - out)
+        {
+            return -1;
+        }
+        const u8 *match = out - offset;
+        if (offset >= length)
+        {
+            memcpy(out, match, length);
+        }
+        else
+        {
+            /* Overlapping, repeats the last offset bytes */
+            for (isize k = 0; k < length; k++)
+            {
+                out[k] = match[k];
+            }
+        }
+        out += length;
+    }
+    return out - (u8 *)dst;
+}
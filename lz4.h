@@ -0,0 +1,27 @@
+#ifndef LZ4_H
+#define LZ4_H
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* LZ4 block format, the raw sequences without LZ4's frame around
+       them. Compression is the single pass greedy matcher, which is what
+       you want for data that's cooked once and decoded at load time;
+       decoding runs at memory speed and checks every offset and length
+       against both buffers, so corrupt input can't write out of bounds. */
+
+    /* Worst case compressed size of size bytes */
+    isize Lz4CompressBound(isize size);
+
+    /* Returns the compressed size, 0 if it doesn't fit in capacity */
+    isize CompressLz4Block(const void *src, isize size, void *dst, isize capacity);
+
+    /* Returns the number of bytes written to dst, -1 if src is malformed
+       or decodes to more than dstSize */
+    isize DecompressLz4Block(const void *src, isize srcSize, void *dst, isize dstSize);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,910 @@
+#define _DEFAULT_SOURCE //strtok_r
+#include "mesh-import.h"
+#include "rutils/file.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct VertexList
+{
+    Vertex *data;
+    u32 count;
+    u32 cap;
+} VertexList;
+
+local void PushVertex(VertexList *l, Vertex v)
+{
+    if (l->count == l->cap)
+    {
+        l->cap = l->cap ? l->cap * 2 : 1024;
+        l->data = realloc(l->data, l->cap * sizeof(*l->data));
+    }
+    l->data[l->count++] = v;
+}
+
+local Vec3f ColorFromNormal(f32 x, f32 y, f32 z)
+{
+    f32 len = sqrtf(x * x + y * y + z * z);
+    if (len == 0)
+    {
+        return vec3f(1, 1, 1);
+    }
+    return vec3f(x / len * .5f + .5f, y / len * .5f + .5f, z / len * .5f + .5f);
+}
+
+/* OBJ ***********************************************************************/
+
+typedef struct ObjFloats
+{
+    f32 *data;
+    u32 count;
+    u32 cap;
+} ObjFloats;
+
+local void PushObjFloats(ObjFloats *l, const f32 *v, u32 n)
+{
+    while (l->count + n > l->cap)
+    {
+        l->cap = l->cap ? l->cap * 2 : 3072;
+        l->data = realloc(l->data, l->cap * sizeof(*l->data));
+    }
+    memcpy(l->data + l->count, v, n * sizeof(*v));
+    l->count += n;
+}
+
+/* Resolves a 1 based or negative OBJ index. Returns -1 if out of range */
+local i64 ObjIndex(long i, u32 count)
+{
+    i64 r = i > 0 ? i - 1 : (i64)count + i;
+    return r >= 0 && r < count ? r : -1;
+}
+
+local bool ParseObjCorner(const char *tok, ObjFloats *positions, ObjFloats *normals,
+                          bool hasColors, Vertex *out)
+{
+    char *end;
+    long vi = strtol(tok, &end, 10);
+    long ni = 0;
+    if (*end == '/')
+    {
+        /* Skip the texcoord */
+        strtol(end + 1, &end, 10);
+        if (*end == '/')
+        {
+            ni = strtol(end + 1, &end, 10);
+        }
+    }
+
+    u32 stride = hasColors ? 6 : 3;
+    i64 v = ObjIndex(vi, positions->count / stride);
+    if (v < 0)
+    {
+        return false;
+    }
+    const f32 *p = positions->data + v * stride;
+    out->pos = vec3f(p[0], p[1], p[2]);
+
+    i64 n = ni ? ObjIndex(ni, normals->count / 3) : -1;
+    if (hasColors)
+    {
+        out->c = vec3f(p[3], p[4], p[5]);
+    }
+    else if (n >= 0)
+    {
+        const f32 *nv = normals->data + n * 3;
+        out->c = ColorFromNormal(nv[0], nv[1], nv[2]);
+    }
+    else
+    {
+        out->c = vec3f(1, 1, 1);
+    }
+    return true;
+}
+
+bool ImportObjMesh(const char *path, const char *data, isize size, Mesh *m)
+{
+    ObjFloats positions = {0};
+    ObjFloats normals = {0};
+    VertexList corners = {0};
+    /* Decided by the first vertex, mixing the two isn't meaningful */
+    i32 hasColors = -1;
+    bool ok = true;
+    ifast32 lineNumber = 0;
+
+    const char *at = data;
+    const char *end = data + size;
+    while (at < end && ok)
+    {
+        const char *eol = memchr(at, '\n', end - at);
+        if (!eol)
+        {
+            eol = end;
+        }
+        char line[1024];
+        isize len = eol - at;
+        lineNumber++;
+        if (len >= (isize)sizeof(line))
+        {
+            fprintf(stderr, "%s:%d: line is longer than %d bytes\n", path, (int)lineNumber,
+                    (int)sizeof(line) - 1);
+            ok = false;
+            break;
+        }
+        memcpy(line, at, len);
+        line[len] = 0;
+        at = eol + 1;
+
+        char *save;
+        char *cmd = strtok_r(line, " \t\r", &save);
+        if (!cmd || cmd[0] == '#')
+        {
+            continue;
+        }
+        if (strcmp(cmd, "v") == 0)
+        {
+            f32 v[6];
+            ifast32 n = 0;
+            for (char *tok; n < 6 && (tok = strtok_r(NULL, " \t\r", &save)); n++)
+            {
+                v[n] = strtof(tok, NULL);
+            }
+            if (hasColors < 0)
+            {
+                hasColors = n >= 6;
+            }
+            if (n < (hasColors ? 6 : 3))
+            {
+                fprintf(stderr, "%s:%d: vertex has too few components\n", path, (int)lineNumber);
+                ok = false;
+                break;
+            }
+            PushObjFloats(&positions, v, hasColors ? 6 : 3);
+        }
+        else if (strcmp(cmd, "vn") == 0)
+        {
+            f32 v[3] = {0};
+            for (ifast32 n = 0; n < 3; n++)
+            {
+                char *tok = strtok_r(NULL, " \t\r", &save);
+                v[n] = tok ? strtof(tok, NULL) : 0;
+            }
+            PushObjFloats(&normals, v, 3);
+        }
+        else if (strcmp(cmd, "f") == 0)
+        {
+            Vertex first, prev, cur;
+            ifast32 n = 0;
+            for (char *tok; (tok = strtok_r(NULL, " \t\r", &save)); n++)
+            {
+                if (!ParseObjCorner(tok, &positions, &normals, hasColors > 0, &cur))
+                {
+                    fprintf(stderr, "%s:%d: bad face index %s\n", path, (int)lineNumber, tok);
+                    ok = false;
+                    break;
+                }
+                if (n == 0)
+                {
+                    first = cur;
+                }
+                else if (n >= 2)
+                {
+                    PushVertex(&corners, first);
+                    PushVertex(&corners, prev);
+                    PushVertex(&corners, cur);
+                }
+                prev = cur;
+            }
+        }
+        /* Everything else (texcoords, groups, materials) has no place in
+           the vertex format yet */
+    }
+
+    free(positions.data);
+    free(normals.data);
+    if (!ok)
+    {
+        free(corners.data);
+        return false;
+    }
+
+    *m = (Mesh){corners.data, corners.count, NULL, 0};
+    WeldMesh(m);
+    return true;
+}
+
+/* JSON **********************************************************************/
+
+/* Just enough of a JSON tokenizer for glTF, in the style of jsmn: a flat
+   array of tokens where containers know how many tokens they span */
+typedef enum JsonType
+{
+    JSON_OBJECT,
+    JSON_ARRAY,
+    JSON_STRING,
+    JSON_PRIMITIVE,
+} JsonType;
+
+typedef struct JsonToken
+{
+    JsonType type;
+    i32 start;
+    i32 end;
+    /* Direct children; key/value pairs count once for objects */
+    i32 children;
+    /* Tokens up to and including the last descendant */
+    i32 span;
+} JsonToken;
+
+typedef struct Json
+{
+    const char *text;
+    JsonToken *tokens;
+    i32 count;
+    i32 cap;
+} Json;
+
+local i32 PushJsonToken(Json *j, JsonType type, i32 start)
+{
+    if (j->count == j->cap)
+    {
+        j->cap = j->cap ? j->cap * 2 : 256;
+        j->tokens = realloc(j->tokens, j->cap * sizeof(*j->tokens));
+    }
+    j->tokens[j->count] = (JsonToken){type, start, start, 0, 1};
+    return j->count++;
+}
+
+local bool ParseJson(Json *j, const char *text, isize size)
+{
+    i32 stack[64];
+    i32 depth = 0;
+    j->text = text;
+    for (isize i = 0; i < size; i++)
+    {
+        char c = text[i];
+        /* Nothing but whitespace after the root value */
+        if (!depth && j->count && c != ' ' && c != '\t' && c != '\r' && c != '\n')
+        {
+            return false;
+        }
+        switch (c)
+        {
+        case '{':
+        case '[':
+        {
+            if (depth == (i32)countof(stack))
+            {
+                return false;
+            }
+            if (depth)
+            {
+                j->tokens[stack[depth - 1]].children++;
+            }
+            stack[depth++] = PushJsonToken(j, c == '{' ? JSON_OBJECT : JSON_ARRAY, i);
+            break;
+        }
+        case '}':
+        case ']':
+        {
+            if (!depth)
+            {
+                return false;
+            }
+            i32 t = stack[--depth];
+            j->tokens[t].end = i + 1;
+            j->tokens[t].span = j->count - t;
+            break;
+        }
+        case '"':
+        {
+            i32 t = PushJsonToken(j, JSON_STRING, i + 1);
+            for (i++; i < size && text[i] != '"'; i++)
+            {
+                if (text[i] == '\\')
+                {
+                    i++;
+                }
+            }
+            if (i >= size)
+            {
+                return false;
+            }
+            j->tokens[t].end = i;
+            /* Keys aren't children on their own */
+            if (depth)
+            {
+                JsonToken *parent = &j->tokens[stack[depth - 1]];
+                bool isKey = false;
+                for (isize k = i + 1; k < size; k++)
+                {
+                    if (text[k] != ' ' && text[k] != '\t' && text[k] != '\r' && text[k] != '\n')
+                    {
+                        isKey = text[k] == ':';
+                        break;
+                    }
+                }
+                if (!isKey || parent->type != JSON_OBJECT)
+                {
+                    parent->children++;
+                }
+            }
+            break;
+        }
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+        case ':':
+        case ',':
+        {
+            break;
+        }
+        default:
+        {
+            i32 t = PushJsonToken(j, JSON_PRIMITIVE, i);
+            while (i + 1 < size && !strchr(" \t\r\n,]}", text[i + 1]))
+            {
+                i++;
+            }
+            j->tokens[t].end = i + 1;
+            if (depth)
+            {
+                j->tokens[stack[depth - 1]].children++;
+            }
+            break;
+        }
+        }
+    }
+    return depth == 0 && j->count > 0;
+}
+
+local bool JsonEq(const Json *j, i32 t, const char *s)
+{
+    const JsonToken *tok = &j->tokens[t];
+    isize len = strlen(s);
+    return tok->type == JSON_STRING && tok->end - tok->start == len &&
+           memcmp(j->text + tok->start, s, len) == 0;
+}
+
+/* Value of key in object t, or -1 */
+local i32 JsonGet(const Json *j, i32 t, const char *key)
+{
+    if (t < 0 || j->tokens[t].type != JSON_OBJECT)
+    {
+        return -1;
+    }
+    i32 at = t + 1;
+    for (i32 n = 0; n < j->tokens[t].children; n++)
+    {
+        i32 value = at + 1;
+        if (JsonEq(j, at, key))
+        {
+            return value;
+        }
+        at = value + j->tokens[value].span;
+    }
+    return -1;
+}
+
+/* Element i of array t, or -1 */
+local i32 JsonAt(const Json *j, i32 t, i32 i)
+{
+    if (t < 0 || j->tokens[t].type != JSON_ARRAY || i < 0 || i >= j->tokens[t].children)
+    {
+        return -1;
+    }
+    i32 at = t + 1;
+    for (; i > 0; i--)
+    {
+        at += j->tokens[at].span;
+    }
+    return at;
+}
+
+local f64 JsonNumber(const Json *j, i32 t, f64 fallback)
+{
+    if (t < 0 || j->tokens[t].type != JSON_PRIMITIVE)
+    {
+        return fallback;
+    }
+    char buf[64];
+    isize len = j->tokens[t].end - j->tokens[t].start;
+    if (len >= (isize)sizeof(buf))
+    {
+        return fallback;
+    }
+    memcpy(buf, j->text + j->tokens[t].start, len);
+    buf[len] = 0;
+    return strtod(buf, NULL);
+}
+
+/* glTF **********************************************************************/
+
+#define GLTF_GLB_MAGIC 0x46546c67 /* "glTF" */
+#define GLTF_CHUNK_JSON 0x4e4f534a
+#define GLTF_CHUNK_BIN 0x004e4942
+
+typedef struct GltfBuffer
+{
+    const u8 *data;
+    u64 size;
+    /* How to release data */
+    void *mapped;
+    isize mappedSize;
+    u8 *owned;
+} GltfBuffer;
+
+typedef struct Gltf
+{
+    const char *path;
+    Json json;
+    GltfBuffer *buffers;
+    i32 bufferCount;
+} Gltf;
+
+local i32 Base64Value(char c)
+{
+    if (c >= 'A' && c <= 'Z')
+    {
+        return c - 'A';
+    }
+    if (c >= 'a' && c <= 'z')
+    {
+        return c - 'a' + 26;
+    }
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0' + 52;
+    }
+    if (c == '+' || c == '-')
+    {
+        return 62;
+    }
+    if (c == '/' || c == '_')
+    {
+        return 63;
+    }
+    return -1;
+}
+
+local u8 *DecodeBase64(const char *s, isize len, u64 *size)
+{
+    u8 *out = malloc(len / 4 * 3 + 3);
+    if (!out)
+    {
+        return NULL;
+    }
+    u64 n = 0;
+    u32 acc = 0;
+    i32 bits = 0;
+    for (isize i = 0; i < len; i++)
+    {
+        i32 v = Base64Value(s[i]);
+        if (v < 0)
+        {
+            continue;
+        }
+        acc = (acc << 6) | v;
+        bits += 6;
+        if (bits >= 8)
+        {
+            bits -= 8;
+            out[n++] = (u8)(acc >> bits);
+        }
+    }
+    *size = n;
+    return out;
+}
+
+local bool IsDataUri(const Json *j, i32 uri)
+{
+    isize len = j->tokens[uri].end - j->tokens[uri].start;
+    return len > 5 && memcmp(j->text + j->tokens[uri].start, "data:", 5) == 0;
+}
+
+/* The file a buffer's uri names, relative to the .gltf */
+local bool GetGltfUriPath(const Gltf *g, i32 uri, char *file, isize fileSize)
+{
+    const char *s = g->json.text + g->json.tokens[uri].start;
+    isize len = g->json.tokens[uri].end - g->json.tokens[uri].start;
+    const char *slash = strrchr(g->path, '/');
+    isize dirLen = slash ? slash - g->path + 1 : 0;
+    if (dirLen + len >= fileSize)
+    {
+        return false;
+    }
+    memcpy(file, g->path, dirLen);
+    memcpy(file + dirLen, s, len);
+    file[dirLen + len] = 0;
+    return true;
+}
+
+local bool LoadGltfBuffer(Gltf *g, i32 index, const u8 *glbBin, u64 glbBinSize)
+{
+    const Json *j = &g->json;
+    GltfBuffer *b = &g->buffers[index];
+    i32 buffer = JsonAt(j, JsonGet(j, 0, "buffers"), index);
+    i32 uri = JsonGet(j, buffer, "uri");
+    if (uri < 0)
+    {
+        /* The GLB's own binary chunk */
+        b->data = glbBin;
+        b->size = glbBinSize;
+        return glbBin != NULL;
+    }
+
+    if (IsDataUri(j, uri))
+    {
+        const char *s = j->text + j->tokens[uri].start;
+        isize len = j->tokens[uri].end - j->tokens[uri].start;
+        const char *comma = memchr(s, ',', len);
+        if (!comma)
+        {
+            return false;
+        }
+        b->owned = DecodeBase64(comma + 1, s + len - comma - 1, &b->size);
+        b->data = b->owned;
+        return b->owned != NULL;
+    }
+
+    char file[4096];
+    if (!GetGltfUriPath(g, uri, file, sizeof(file)))
+    {
+        return false;
+    }
+    b->mapped = MapFileToROBuffer(file, NULL, &b->mappedSize);
+    if (!b->mapped)
+    {
+        fprintf(stderr, "%s: could not open buffer %s\n", g->path, file);
+        return false;
+    }
+    b->data = b->mapped;
+    b->size = b->mappedSize;
+    return true;
+}
+
+local u32 GltfComponentCount(const Json *j, i32 type)
+{
+    local const struct
+    {
+        const char *name;
+        u32 count;
+    } types[] = {{"SCALAR", 1}, {"VEC2", 2}, {"VEC3", 3}, {"VEC4", 4}};
+    for (usize i = 0; i < countof(types); i++)
+    {
+        if (JsonEq(j, type, types[i].name))
+        {
+            return types[i].count;
+        }
+    }
+    return 0;
+}
+
+local u32 GltfComponentSize(u32 componentType)
+{
+    switch (componentType)
+    {
+    case 5120: /* BYTE */
+    case 5121: /* UNSIGNED_BYTE */
+    {
+        return 1;
+    }
+    case 5122: /* SHORT */
+    case 5123: /* UNSIGNED_SHORT */
+    {
+        return 2;
+    }
+    case 5125: /* UNSIGNED_INT */
+    case 5126: /* FLOAT */
+    {
+        return 4;
+    }
+    }
+    return 0;
+}
+
+typedef struct GltfAccessor
+{
+    const u8 *data;
+    u32 count;
+    u32 components;
+    u32 componentType;
+    u32 stride;
+    bool normalized;
+} GltfAccessor;
+
+local bool GetGltfAccessor(Gltf *g, i32 index, GltfAccessor *a)
+{
+    const Json *j = &g->json;
+    i32 accessor = JsonAt(j, JsonGet(j, 0, "accessors"), index);
+    i32 view = JsonAt(j, JsonGet(j, 0, "bufferViews"),
+                      (i32)JsonNumber(j, JsonGet(j, accessor, "bufferView"), -1));
+    if (accessor < 0 || view < 0)
+    {
+        /* Sparse and view-less accessors aren't worth supporting here */
+        return false;
+    }
+    i32 buffer = (i32)JsonNumber(j, JsonGet(j, view, "buffer"), -1);
+    if (buffer < 0 || buffer >= g->bufferCount || !g->buffers[buffer].data)
+    {
+        return false;
+    }
+
+    a->count = (u32)JsonNumber(j, JsonGet(j, accessor, "count"), 0);
+    a->components = GltfComponentCount(j, JsonGet(j, accessor, "type"));
+    a->componentType = (u32)JsonNumber(j, JsonGet(j, accessor, "componentType"), 0);
+    i32 normalized = JsonGet(j, accessor, "normalized");
+    a->normalized = normalized >= 0 && j->text[j->tokens[normalized].start] == 't';
+    u32 elementSize = a->components * GltfComponentSize(a->componentType);
+    a->stride = (u32)JsonNumber(j, JsonGet(j, view, "byteStride"), elementSize);
+
+    /* Each part against what's left of the buffer, so huge offsets can't
+       wrap around */
+    u64 size = g->buffers[buffer].size;
+    f64 viewOffset = JsonNumber(j, JsonGet(j, view, "byteOffset"), 0);
+    f64 accessorOffset = JsonNumber(j, JsonGet(j, accessor, "byteOffset"), 0);
+    bool inside = elementSize && viewOffset >= 0 && viewOffset <= (f64)size;
+    u64 offset = inside ? (u64)viewOffset : 0;
+    inside = inside && accessorOffset >= 0 && accessorOffset <= (f64)(size - offset);
+    offset += inside ? (u64)accessorOffset : 0;
+    u64 needed = a->count ? (u64)(a->count - 1) * a->stride + elementSize : 0;
+    if (!inside || needed > size - offset)
+    {
+        fprintf(stderr, "%s: accessor %d is out of bounds\n", g->path, (int)index);
+        return false;
+    }
+    a->data = g->buffers[buffer].data + offset;
+    return true;
+}
+
+local f32 ReadGltfComponent(const GltfAccessor *a, u32 i, u32 c)
+{
+    const u8 *p = a->data + (u64)i * a->stride + c * GltfComponentSize(a->componentType);
+    switch (a->componentType)
+    {
+    case 5120:
+    {
+        i8 v = *(const i8 *)p;
+        return a->normalized ? fmaxf(v / 127.0f, -1) : v;
+    }
+    case 5121:
+    {
+        return a->normalized ? *p / 255.0f : *p;
+    }
+    case 5122:
+    {
+        i16 v;
+        memcpy(&v, p, sizeof(v));
+        return a->normalized ? fmaxf(v / 32767.0f, -1) : v;
+    }
+    case 5123:
+    {
+        u16 v;
+        memcpy(&v, p, sizeof(v));
+        return a->normalized ? v / 65535.0f : v;
+    }
+    case 5125:
+    {
+        u32 v;
+        memcpy(&v, p, sizeof(v));
+        return (f32)v;
+    }
+    default:
+    {
+        f32 v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    }
+}
+
+local u32 ReadGltfIndex(const GltfAccessor *a, u32 i)
+{
+    const u8 *p = a->data + (u64)i * a->stride;
+    switch (a->componentType)
+    {
+    case 5121:
+    {
+        return *p;
+    }
+    case 5123:
+    {
+        u16 v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    default:
+    {
+        u32 v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    }
+}
+
+local bool ImportGltfPrimitive(Gltf *g, i32 primitive, VertexList *corners)
+{
+    const Json *j = &g->json;
+    i32 mode = (i32)JsonNumber(j, JsonGet(j, primitive, "mode"), 4);
+    if (mode != 4)
+    {
+        /* Only triangle lists */
+        return true;
+    }
+    i32 attributes = JsonGet(j, primitive, "attributes");
+    GltfAccessor pos, col, nrm, idx;
+    i32 posIndex = (i32)JsonNumber(j, JsonGet(j, attributes, "POSITION"), -1);
+    if (!GetGltfAccessor(g, posIndex, &pos) || pos.components != 3)
+    {
+        fprintf(stderr, "%s: primitive without usable positions\n", g->path);
+        return false;
+    }
+    i32 colIndex = (i32)JsonNumber(j, JsonGet(j, attributes, "COLOR_0"), -1);
+    bool hasColor = colIndex >= 0 && GetGltfAccessor(g, colIndex, &col) &&
+                    col.components >= 3 && col.count == pos.count;
+    i32 nrmIndex = (i32)JsonNumber(j, JsonGet(j, attributes, "NORMAL"), -1);
+    bool hasNormal = nrmIndex >= 0 && GetGltfAccessor(g, nrmIndex, &nrm) &&
+                     nrm.components == 3 && nrm.count == pos.count;
+    i32 idxIndex = (i32)JsonNumber(j, JsonGet(j, primitive, "indices"), -1);
+    bool indexed = idxIndex >= 0;
+    if (indexed && (!GetGltfAccessor(g, idxIndex, &idx) || idx.components != 1))
+    {
+        return false;
+    }
+
+    u32 count = indexed ? idx.count : pos.count;
+    for (u32 n = 0; n < count - count % 3; n++)
+    {
+        u32 i = indexed ? ReadGltfIndex(&idx, n) : n;
+        if (i >= pos.count)
+        {
+            fprintf(stderr, "%s: index %u out of range\n", g->path, i);
+            return false;
+        }
+        Vertex v;
+        v.pos = vec3f(ReadGltfComponent(&pos, i, 0), ReadGltfComponent(&pos, i, 1),
+                      ReadGltfComponent(&pos, i, 2));
+        if (hasColor)
+        {
+            v.c = vec3f(ReadGltfComponent(&col, i, 0), ReadGltfComponent(&col, i, 1),
+                        ReadGltfComponent(&col, i, 2));
+        }
+        else if (hasNormal)
+        {
+            v.c = ColorFromNormal(ReadGltfComponent(&nrm, i, 0), ReadGltfComponent(&nrm, i, 1),
+                                  ReadGltfComponent(&nrm, i, 2));
+        }
+        else
+        {
+            v.c = vec3f(1, 1, 1);
+        }
+        PushVertex(corners, v);
+    }
+    return true;
+}
+
+/* Parses a .gltf's JSON, or a .glb's JSON chunk and finds its binary
+   chunk */
+local bool ParseGltf(Gltf *g, const u8 *data, isize size, const u8 **bin, u64 *binSize)
+{
+    const char *text = (const char *)data;
+    isize textSize = size;
+    *bin = NULL;
+    *binSize = 0;
+
+    u32 magic = 0;
+    if (size >= 4)
+    {
+        memcpy(&magic, data, sizeof(magic));
+    }
+    if (magic == GLTF_GLB_MAGIC)
+    {
+        /* 12 byte header, then a JSON chunk and an optional BIN chunk */
+        u32 chunk[2] = {0};
+        if (size >= 20)
+        {
+            memcpy(chunk, data + 12, sizeof(chunk));
+        }
+        if (chunk[1] != GLTF_CHUNK_JSON || chunk[0] > (u64)size - 20)
+        {
+            fprintf(stderr, "%s: bad GLB header\n", g->path);
+            return false;
+        }
+        text = (const char *)data + 20;
+        textSize = chunk[0];
+        u64 binChunk = 20 + (u64)chunk[0];
+        if (binChunk + 8 <= (u64)size)
+        {
+            memcpy(chunk, data + binChunk, sizeof(chunk));
+            if (chunk[1] == GLTF_CHUNK_BIN && chunk[0] <= (u64)size - binChunk - 8)
+            {
+                *bin = data + binChunk + 8;
+                *binSize = chunk[0];
+            }
+        }
+    }
+
+    if (!ParseJson(&g->json, text, textSize))
+    {
+        fprintf(stderr, "%s: malformed JSON\n", g->path);
+        return false;
+    }
+    return true;
+}
+
+bool ImportGltfMesh(const char *path, const u8 *data, isize size, Mesh *m)
+{
+    Gltf g = {path};
+    const u8 *bin;
+    u64 binSize;
+    bool ok = ParseGltf(&g, data, size, &bin, &binSize);
+
+    VertexList corners = {0};
+    if (ok)
+    {
+        i32 buffers = JsonGet(&g.json, 0, "buffers");
+        g.bufferCount = buffers >= 0 ? g.json.tokens[buffers].children : 0;
+        g.buffers = calloc(g.bufferCount ? g.bufferCount : 1, sizeof(*g.buffers));
+        for (i32 i = 0; i < g.bufferCount; i++)
+        {
+            /* A buffer that fails to load only matters if something uses it */
+            LoadGltfBuffer(&g, i, bin, binSize);
+        }
+
+        i32 meshes = JsonGet(&g.json, 0, "meshes");
+        for (i32 mi = 0; ok && JsonAt(&g.json, meshes, mi) >= 0; mi++)
+        {
+            i32 primitives = JsonGet(&g.json, JsonAt(&g.json, meshes, mi), "primitives");
+            for (i32 pi = 0; ok && JsonAt(&g.json, primitives, pi) >= 0; pi++)
+            {
+                ok = ImportGltfPrimitive(&g, JsonAt(&g.json, primitives, pi), &corners);
+            }
+        }
+    }
+
+    for (i32 i = 0; i < g.bufferCount; i++)
+    {
+        if (g.buffers[i].mapped)
+        {
+            UnmapMappedBuffer(g.buffers[i].mapped, g.buffers[i].mappedSize);
+        }
+        free(g.buffers[i].owned);
+    }
+    free(g.buffers);
+    free(g.json.tokens);
+
+    if (!ok)
+    {
+        free(corners.data);
+        return false;
+    }
+    *m = (Mesh){corners.data, corners.count, NULL, 0};
+    WeldMesh(m);
+    return true;
+}
+
+bool ForEachGltfDependency(const char *path, const u8 *data, isize size, GltfDependencyFn *fn,
+                           void *user)
+{
+    Gltf g = {path};
+    const u8 *bin;
+    u64 binSize;
+    if (!ParseGltf(&g, data, size, &bin, &binSize))
+    {
+        free(g.json.tokens);
+        return false;
+    }
+    i32 buffers = JsonGet(&g.json, 0, "buffers");
+    for (i32 i = 0; JsonAt(&g.json, buffers, i) >= 0; i++)
+    {
+        i32 uri = JsonGet(&g.json, JsonAt(&g.json, buffers, i), "uri");
+        char file[4096];
+        if (uri >= 0 && !IsDataUri(&g.json, uri) && GetGltfUriPath(&g, uri, file, sizeof(file)))
+        {
+            fn(user, file);
+        }
+    }
+    free(g.json.tokens);
+    return true;
+}
@@ -0,0 +1,33 @@
+#ifndef MESH_IMPORT_H
+#define MESH_IMPORT_H
+#include "mesh.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Importers for the cooker. Both produce an indexed triangle list in
+       the runtime Vertex layout; colors come from vertex colors if the
+       file has them, otherwise from normals, otherwise white. */
+
+    /* Wavefront OBJ. Polygons are fan triangulated, "v x y z r g b" vertex
+       colors are understood. */
+    bool ImportObjMesh(const char *path, const char *data, isize size, Mesh *m);
+
+    /* glTF 2.0, .gltf with external or data: buffers and .glb. Triangle
+       primitives of every mesh are merged in their local space, the node
+       hierarchy is ignored. */
+    bool ImportGltfMesh(const char *path, const u8 *data, isize size, Mesh *m);
+
+    typedef void GltfDependencyFn(void *user, const char *file);
+
+    /* Calls fn with every file other than the .gltf itself that its
+       buffers are read from, so a change to one can be noticed. False if
+       the file doesn't parse. */
+    bool ForEachGltfDependency(const char *path, const u8 *data, isize size, GltfDependencyFn *fn,
+                               void *user);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,464 @@
+#include "mesh.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+void FreeMesh(Mesh *m)
+{
+    free(m->vertices);
+    free(m->indices);
+    *m = (Mesh){0};
+}
+
+local u64 HashVertex(const Vertex *v)
+{
+    const u8 *p = (const u8 *)v;
+    u64 h = 14695981039346656037ull;
+    for (usize i = 0; i < sizeof(*v); i++)
+    {
+        h = (h ^ p[i]) * 1099511628211ull;
+    }
+    return h;
+}
+
+void WeldMesh(Mesh *m)
+{
+    u32 indexCount = m->indices ? m->indexCount : m->vertexCount;
+    u32 cap = 16;
+    while (cap < indexCount * 2)
+    {
+        cap *= 2;
+    }
+    /* Slots hold an index into the welded vertices, or UINT32_MAX */
+    u32 *slots = malloc(cap * sizeof(*slots));
+    memset(slots, 0xff, cap * sizeof(*slots));
+
+    Vertex *welded = malloc((indexCount ? indexCount : 1) * sizeof(*welded));
+    u32 *indices = malloc((indexCount ? indexCount : 1) * sizeof(*indices));
+    u32 weldedCount = 0;
+    for (u32 i = 0; i < indexCount; i++)
+    {
+        const Vertex *v = &m->vertices[m->indices ? m->indices[i] : i];
+        u32 slot = (u32)HashVertex(v) & (cap - 1);
+        while (slots[slot] != UINT32_MAX && memcmp(&welded[slots[slot]], v, sizeof(*v)) != 0)
+        {
+            slot = (slot + 1) & (cap - 1);
+        }
+        if (slots[slot] == UINT32_MAX)
+        {
+            welded[weldedCount] = *v;
+            slots[slot] = weldedCount++;
+        }
+        indices[i] = slots[slot];
+    }
+    free(slots);
+
+    free(m->vertices);
+    free(m->indices);
+    m->vertices = realloc(welded, (weldedCount ? weldedCount : 1) * sizeof(*welded));
+    m->vertexCount = weldedCount;
+    m->indices = indices;
+    m->indexCount = indexCount;
+}
+
+/* Forsyth's tuning constants, see "Linear-Speed Vertex Cache Optimisation" */
+#define VCACHE_SIZE 32
+#define VCACHE_MAX_VALENCE 64
+#define VCACHE_DECAY_POWER 1.5f
+#define VCACHE_LAST_TRI_SCORE 0.75f
+#define VCACHE_VALENCE_SCALE 2.0f
+#define VCACHE_VALENCE_POWER 0.5f
+
+typedef struct VCacheVertex
+{
+    i32 cachePos;
+    u32 activeTris;
+    u32 firstTri;
+    f32 score;
+} VCacheVertex;
+
+local f32 vcacheScores[VCACHE_SIZE];
+local f32 valenceScores[VCACHE_MAX_VALENCE];
+
+local void InitVCacheScores(void)
+{
+    for (i32 i = 0; i < VCACHE_SIZE; i++)
+    {
+        if (i < 3)
+        {
+            vcacheScores[i] = VCACHE_LAST_TRI_SCORE;
+        }
+        else
+        {
+            f32 scaler = 1.0f / (VCACHE_SIZE - 3);
+            vcacheScores[i] = powf(1.0f - (f32)(i - 3) * scaler, VCACHE_DECAY_POWER);
+        }
+    }
+    for (i32 i = 1; i < VCACHE_MAX_VALENCE; i++)
+    {
+        valenceScores[i] = VCACHE_VALENCE_SCALE * powf((f32)i, -VCACHE_VALENCE_POWER);
+    }
+}
+
+local f32 VCacheScore(const VCacheVertex *v)
+{
+    if (v->activeTris == 0)
+    {
+        return -1.0f;
+    }
+    f32 score = v->cachePos >= 0 ? vcacheScores[v->cachePos] : 0;
+    u32 valence = v->activeTris < VCACHE_MAX_VALENCE ? v->activeTris : VCACHE_MAX_VALENCE - 1;
+    return score + valenceScores[valence];
+}
+
+void OptimizeVertexCache(u32 *indices, u32 indexCount, u32 vertexCount)
+{
+    u32 triCount = indexCount / 3;
+    if (triCount < 2)
+    {
+        return;
+    }
+    if (vcacheScores[0] == 0)
+    {
+        InitVCacheScores();
+    }
+
+    VCacheVertex *verts = calloc(vertexCount, sizeof(*verts));
+    u32 *adjacency = malloc(indexCount * sizeof(*adjacency));
+    f32 *triScores = malloc(triCount * sizeof(*triScores));
+    bool *emitted = calloc(triCount, sizeof(*emitted));
+    u32 *out = malloc(indexCount * sizeof(*out));
+
+    /* Triangles using each vertex, packed into one array. activeTris
+       shrinks as they're emitted, keeping the live ones at the front. */
+    for (u32 i = 0; i < indexCount; i++)
+    {
+        verts[indices[i]].activeTris++;
+    }
+    u32 offset = 0;
+    for (u32 v = 0; v < vertexCount; v++)
+    {
+        verts[v].firstTri = offset;
+        offset += verts[v].activeTris;
+        verts[v].activeTris = 0;
+        verts[v].cachePos = -1;
+    }
+    for (u32 t = 0; t < triCount; t++)
+    {
+        for (u32 k = 0; k < 3; k++)
+        {
+            VCacheVertex *v = &verts[indices[t * 3 + k]];
+            adjacency[v->firstTri + v->activeTris++] = t;
+        }
+    }
+    for (u32 v = 0; v < vertexCount; v++)
+    {
+        verts[v].score = VCacheScore(&verts[v]);
+    }
+
+    i64 best = -1;
+    f32 bestScore = -1;
+    for (u32 t = 0; t < triCount; t++)
+    {
+        const u32 *tri = &indices[t * 3];
+        triScores[t] = verts[tri[0]].score + verts[tri[1]].score + verts[tri[2]].score;
+        if (triScores[t] > bestScore)
+        {
+            bestScore = triScores[t];
+            best = t;
+        }
+    }
+
+    u32 cache[VCACHE_SIZE + 3];
+    u32 cacheCount = 0;
+    u32 nextUnemitted = 0;
+    for (u32 n = 0; n < triCount; n++)
+    {
+        if (best < 0)
+        {
+            /* Nothing in the cache is connected to anything left, take the
+               next triangle in input order */
+            while (emitted[nextUnemitted])
+            {
+                nextUnemitted++;
+            }
+            best = nextUnemitted;
+        }
+
+        const u32 *tri = &indices[best * 3];
+        memcpy(&out[n * 3], tri, 3 * sizeof(*tri));
+        emitted[best] = true;
+
+        u32 newCache[VCACHE_SIZE + 3];
+        u32 newCount = 0;
+        for (u32 k = 0; k < 3; k++)
+        {
+            VCacheVertex *v = &verts[tri[k]];
+            for (u32 a = 0; a < v->activeTris; a++)
+            {
+                if (adjacency[v->firstTri + a] == best)
+                {
+                    adjacency[v->firstTri + a] = adjacency[v->firstTri + v->activeTris - 1];
+                    v->activeTris--;
+                    break;
+                }
+            }
+            if (k == 0 || (tri[k] != tri[0] && (k == 1 || tri[k] != tri[1])))
+            {
+                newCache[newCount++] = tri[k];
+            }
+        }
+        for (u32 i = 0; i < cacheCount; i++)
+        {
+            u32 c = cache[i];
+            if (c != tri[0] && c != tri[1] && c != tri[2])
+            {
+                newCache[newCount++] = c;
+            }
+        }
+
+        /* Everything that moved in or out of the cache changes score, and
+           so do the triangles using it */
+        for (u32 i = 0; i < newCount; i++)
+        {
+            VCacheVertex *v = &verts[newCache[i]];
+            v->cachePos = i < VCACHE_SIZE ? (i32)i : -1;
+            f32 score = VCacheScore(v);
+            f32 delta = score - v->score;
+            v->score = score;
+            for (u32 a = 0; a < v->activeTris; a++)
+            {
+                triScores[adjacency[v->firstTri + a]] += delta;
+            }
+        }
+        best = -1;
+        bestScore = -1;
+        for (u32 i = 0; i < newCount && i < VCACHE_SIZE; i++)
+        {
+            const VCacheVertex *v = &verts[newCache[i]];
+            for (u32 a = 0; a < v->activeTris; a++)
+            {
+                u32 t = adjacency[v->firstTri + a];
+                if (triScores[t] > bestScore)
+                {
+                    bestScore = triScores[t];
+                    best = t;
+                }
+            }
+        }
+        cacheCount = newCount < VCACHE_SIZE ? newCount : VCACHE_SIZE;
+        memcpy(cache, newCache, cacheCount * sizeof(*cache));
+    }
+
+    memcpy(indices, out, indexCount * sizeof(*indices));
+    free(verts);
+    free(adjacency);
+    free(triScores);
+    free(emitted);
+    free(out);
+}
+
+/* FIFO cache simulation shared by the stats and the overdraw clustering.
+   stamps[v] holds the miss counter value when v entered the cache. */
+typedef struct FifoCache
+{
+    u32 *stamps;
+    u32 misses;
+    u32 size;
+} FifoCache;
+
+local bool FifoCacheTouch(FifoCache *c, u32 v)
+{
+    if (c->stamps[v] && c->misses - c->stamps[v] < c->size)
+    {
+        return true;
+    }
+    c->stamps[v] = ++c->misses;
+    return false;
+}
+
+VertexCacheStats AnalyzeVertexCache(const u32 *indices, u32 indexCount, u32 vertexCount,
+                                    u32 cacheSize)
+{
+    FifoCache cache = {calloc(vertexCount ? vertexCount : 1, sizeof(u32)), 0, cacheSize};
+    for (u32 i = 0; i < indexCount; i++)
+    {
+        FifoCacheTouch(&cache, indices[i]);
+    }
+    free(cache.stamps);
+
+    VertexCacheStats stats = {0};
+    if (indexCount >= 3)
+    {
+        stats.acmr = (f32)cache.misses / (f32)(indexCount / 3);
+    }
+    if (vertexCount)
+    {
+        stats.atvr = (f32)cache.misses / (f32)vertexCount;
+    }
+    return stats;
+}
+
+#define OVERDRAW_CACHE_SIZE 16
+
+typedef struct OverdrawCluster
+{
+    u32 start;
+    u32 count;
+    f32 sortKey;
+} OverdrawCluster;
+
+local int CompareOverdrawClusters(const void *a, const void *b)
+{
+    const OverdrawCluster *ca = a;
+    const OverdrawCluster *cb = b;
+    if (ca->sortKey != cb->sortKey)
+    {
+        return ca->sortKey > cb->sortKey ? -1 : 1;
+    }
+    /* Keep input order for ties so the result is deterministic */
+    return ca->start < cb->start ? -1 : 1;
+}
+
+local const f32 *VertexPos(const Vertex *vertices, u32 i)
+{
+    return (const f32 *)&vertices[i].pos;
+}
+
+void OptimizeOverdraw(u32 *indices, u32 indexCount, const Vertex *vertices,
+                      u32 vertexCount, f32 threshold)
+{
+    u32 triCount = indexCount / 3;
+    if (triCount < 2)
+    {
+        return;
+    }
+    f32 meshAcmr = AnalyzeVertexCache(indices, indexCount, vertexCount, OVERDRAW_CACHE_SIZE).acmr;
+
+    /* Clusters start wherever the cache was cold anyway (all three
+       vertices missed), or where cutting costs less than threshold
+       allows. Each cluster is simulated from an empty cache since the
+       sort will put it after something unrelated. */
+    OverdrawCluster *clusters = malloc(triCount * sizeof(*clusters));
+    u32 clusterCount = 0;
+    FifoCache cache = {calloc(vertexCount, sizeof(u32)), 0, OVERDRAW_CACHE_SIZE};
+    u32 clusterMisses = 0;
+    for (u32 t = 0; t < triCount; t++)
+    {
+        u32 before = cache.misses;
+        for (u32 k = 0; k < 3; k++)
+        {
+            FifoCacheTouch(&cache, indices[t * 3 + k]);
+        }
+        u32 misses = cache.misses - before;
+
+        bool hardBoundary = misses == 3;
+        bool softBoundary = clusterCount &&
+                            (f32)clusterMisses / (f32)clusters[clusterCount - 1].count <=
+                                meshAcmr * threshold;
+        if (t == 0 || hardBoundary || softBoundary)
+        {
+            clusters[clusterCount++] = (OverdrawCluster){t, 0, 0};
+            clusterMisses = 0;
+            if (!hardBoundary)
+            {
+                /* Recount as if the cluster started cold. Moving the
+                   counter a whole cache ahead ages everything out. */
+                cache.misses += OVERDRAW_CACHE_SIZE;
+                before = cache.misses;
+                for (u32 k = 0; k < 3; k++)
+                {
+                    FifoCacheTouch(&cache, indices[t * 3 + k]);
+                }
+                misses = cache.misses - before;
+            }
+        }
+        clusters[clusterCount - 1].count++;
+        clusterMisses += misses;
+    }
+    free(cache.stamps);
+
+    f32 meshCentroid[3] = {0};
+    for (u32 v = 0; v < vertexCount; v++)
+    {
+        const f32 *p = VertexPos(vertices, v);
+        for (u32 k = 0; k < 3; k++)
+        {
+            meshCentroid[k] += p[k] / (f32)vertexCount;
+        }
+    }
+
+    /* Key is how much the cluster faces away from the middle of the mesh.
+       Clusters on the outside are drawn first and occlude the rest. */
+    for (u32 c = 0; c < clusterCount; c++)
+    {
+        f32 centroid[3] = {0};
+        f32 normal[3] = {0};
+        f32 area = 0;
+        for (u32 t = clusters[c].start; t < clusters[c].start + clusters[c].count; t++)
+        {
+            const f32 *a = VertexPos(vertices, indices[t * 3 + 0]);
+            const f32 *b = VertexPos(vertices, indices[t * 3 + 1]);
+            const f32 *d = VertexPos(vertices, indices[t * 3 + 2]);
+            f32 e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+            f32 e2[3] = {d[0] - a[0], d[1] - a[1], d[2] - a[2]};
+            f32 n[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2],
+                        e1[0] * e2[1] - e1[1] * e2[0]};
+            f32 triArea = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (u32 k = 0; k < 3; k++)
+            {
+                centroid[k] += (a[k] + b[k] + d[k]) / 3 * triArea;
+                normal[k] += n[k];
+            }
+            area += triArea;
+        }
+        f32 normalLen = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        if (area == 0 || normalLen == 0)
+        {
+            clusters[c].sortKey = 0;
+            continue;
+        }
+        f32 key = 0;
+        for (u32 k = 0; k < 3; k++)
+        {
+            key += (centroid[k] / area - meshCentroid[k]) * normal[k] / normalLen;
+        }
+        clusters[c].sortKey = key;
+    }
+
+    qsort(clusters, clusterCount, sizeof(*clusters), CompareOverdrawClusters);
+
+    u32 *out = malloc(indexCount * sizeof(*out));
+    u32 at = 0;
+    for (u32 c = 0; c < clusterCount; c++)
+    {
+        memcpy(&out[at], &indices[clusters[c].start * 3], clusters[c].count * 3 * sizeof(*out));
+        at += clusters[c].count * 3;
+    }
+    memcpy(indices, out, at * sizeof(*out));
+    free(out);
+    free(clusters);
+}
+
+void OptimizeVertexFetch(Mesh *m)
+{
+    u32 *remap = malloc((m->vertexCount ? m->vertexCount : 1) * sizeof(*remap));
+    memset(remap, 0xff, m->vertexCount * sizeof(*remap));
+    Vertex *vertices = malloc((m->vertexCount ? m->vertexCount : 1) * sizeof(*vertices));
+    u32 next = 0;
+    for (u32 i = 0; i < m->indexCount; i++)
+    {
+        u32 v = m->indices[i];
+        if (remap[v] == UINT32_MAX)
+        {
+            remap[v] = next;
+            vertices[next++] = m->vertices[v];
+        }
+        m->indices[i] = remap[v];
+    }
+    /* Vertices no triangle uses are dropped */
+    free(m->vertices);
+    free(remap);
+    m->vertices = vertices;
+    m->vertexCount = next;
+}
@@ -0,0 +1,64 @@
+#ifndef MESH_H
+#define MESH_H
+#include "rutils/def.h"
+#include "rutils/math.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Full precision vertex the importers produce and the optimizers work
+       on. The cooker packs it with a VertexFormat before writing it out. */
+    typedef struct Vertex
+    {
+        Vec3f pos;
+        Vec3f c;
+    } Vertex;
+
+    /* Indexed triangle list */
+    typedef struct Mesh
+    {
+        Vertex *vertices;
+        u32 vertexCount;
+        u32 *indices;
+        u32 indexCount;
+    } Mesh;
+
+    void FreeMesh(Mesh *m);
+
+    /* Merges bitwise identical vertices and rewrites the indices to match.
+       Works on unindexed meshes too (indices NULL), which get an index
+       buffer. Vertices end up in order of first use. */
+    void WeldMesh(Mesh *m);
+
+    /* Reorders triangles for the post transform cache using Tom Forsyth's
+       linear speed algorithm */
+    void OptimizeVertexCache(u32 *indices, u32 indexCount, u32 vertexCount);
+
+    /* Reorders clusters of triangles so the ones facing away from the
+       middle of the mesh come first, which cuts overdraw from most view
+       directions. Run after OptimizeVertexCache; threshold is how much
+       worse than the input's ACMR (1.05 = 5%) the result may get. */
+    void OptimizeOverdraw(u32 *indices, u32 indexCount, const Vertex *vertices,
+                          u32 vertexCount, f32 threshold);
+
+    /* Renumbers vertices in the order the indices first reach them, so
+       vertex fetch walks memory linearly. Run last. */
+    void OptimizeVertexFetch(Mesh *m);
+
+    typedef struct VertexCacheStats
+    {
+        /* Average cache misses per triangle, 0.5 is about ideal for a
+           regular grid, 3 is no reuse at all */
+        f32 acmr;
+        /* Misses per unique vertex, 1 is ideal */
+        f32 atvr;
+    } VertexCacheStats;
+
+    /* Simulates a FIFO post transform cache of cacheSize entries */
+    VertexCacheStats AnalyzeVertexCache(const u32 *indices, u32 indexCount, u32 vertexCount,
+                                        u32 cacheSize);
+#ifdef __cplusplus
+}
+#endif
+#endif
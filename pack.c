@@ -0,0 +1,671 @@
+#define _DEFAULT_SOURCE //madvise
+#include "pack.h"
+#include "glad.h"
+#include "lz4.h"
+#include "rutils/file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+struct AssetPack
+{
+    const u8 *base;
+    isize size;
+    const PackHeader *header;
+    const PackEntry *entries;
+    /* Stored after the struct */
+    const char *path;
+};
+
+struct PackWriter
+{
+    FILE *out;
+    u64 offset;
+    PackCompression compression;
+    PackEntry *entries;
+    ifast32 entryCount;
+    ifast32 entryCap;
+};
+
+#define HASH_P1 0x9e3779b185ebca87ull
+#define HASH_P2 0xc2b2ae3d27d4eb4full
+#define HASH_P3 0x165667b19e3779f9ull
+#define HASH_P4 0x85ebca77c2b2ae63ull
+
+local u64 RotateLeft64(u64 v, int s)
+{
+    return (v << s) | (v >> (64 - s));
+}
+
+/* Single lane of xxhash64, good enough to catch stale or corrupt blobs */
+u64 HashPackBytes(const void *data, u64 size)
+{
+    const u8 *p = data;
+    u64 h = HASH_P3 ^ (size * HASH_P1);
+    u64 i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        u64 k;
+        memcpy(&k, p + i, sizeof(k));
+        k = RotateLeft64(k * HASH_P2, 31) * HASH_P1;
+        h = RotateLeft64(h ^ k, 27) * HASH_P1 + HASH_P4;
+    }
+    for (; i < size; i++)
+    {
+        h = RotateLeft64(h ^ (p[i] * HASH_P3), 11) * HASH_P1;
+    }
+    h ^= h >> 33;
+    h *= HASH_P2;
+    h ^= h >> 29;
+    h *= HASH_P3;
+    h ^= h >> 32;
+    return h;
+}
+
+u64 HashPackName(const char *name)
+{
+    u64 h = 14695981039346656037ull;
+    for (; *name; name++)
+    {
+        h = (h ^ (u8)*name) * 1099511628211ull;
+    }
+    return h;
+}
+
+AssetPack *OpenAssetPack(const char *path)
+{
+    isize size;
+    const u8 *base = MapFileToROBuffer(path, NULL, &size);
+    if (!base)
+    {
+        return NULL;
+    }
+
+    const PackHeader *header = (const PackHeader *)base;
+    if (size < (isize)sizeof(*header) || header->magic != PACK_MAGIC ||
+        header->version != PACK_VERSION || header->size != (u64)size ||
+        header->tocOffset > (u64)size ||
+        (u64)size - header->tocOffset < (u64)header->entryCount * sizeof(PackEntry))
+    {
+        fprintf(stderr, "PACK: %s is not a valid asset pack\n", path);
+        UnmapMappedBuffer((void *)base, size);
+        return NULL;
+    }
+
+    const PackEntry *entries = (const PackEntry *)(base + header->tocOffset);
+    for (u32 i = 0; i < header->entryCount; i++)
+    {
+        const PackEntry *e = &entries[i];
+        u64 blockCount = (e->size + PACK_BLOCK_SIZE - 1) / PACK_BLOCK_SIZE;
+        bool stored = e->compression == PACK_COMPRESSION_NONE
+                          ? e->storedSize == e->size
+                          : e->compression == PACK_COMPRESSION_LZ4 &&
+                                e->storedSize >= blockCount * sizeof(PackBlock);
+        if (!stored || e->offset > (u64)size || (u64)size - e->offset < e->storedSize)
+        {
+            fprintf(stderr, "PACK: %s: entry %s is out of bounds\n", path, e->name);
+            UnmapMappedBuffer((void *)base, size);
+            return NULL;
+        }
+    }
+
+    usize pathSize = strlen(path) + 1;
+    AssetPack *pack = malloc(sizeof(*pack) + pathSize);
+    if (!pack)
+    {
+        UnmapMappedBuffer((void *)base, size);
+        return NULL;
+    }
+    *pack = (AssetPack){base, size, header, entries, memcpy(pack + 1, path, pathSize)};
+    return pack;
+}
+
+void CloseAssetPack(AssetPack *pack)
+{
+    if (pack)
+    {
+        UnmapMappedBuffer((void *)pack->base, pack->size);
+        free(pack);
+    }
+}
+
+const char *GetAssetPackPath(const AssetPack *pack)
+{
+    return pack->path;
+}
+
+const PackEntry *FindPackEntry(const AssetPack *pack, const char *name)
+{
+    u64 hash = HashPackName(name);
+    ifast32 lo = 0;
+    ifast32 hi = pack->header->entryCount;
+    while (lo < hi)
+    {
+        ifast32 mid = lo + (hi - lo) / 2;
+        if (pack->entries[mid].nameHash < hash)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    for (; lo < (ifast32)pack->header->entryCount && pack->entries[lo].nameHash == hash; lo++)
+    {
+        if (strncmp(pack->entries[lo].name, name, PACK_NAME_SIZE) == 0)
+        {
+            return &pack->entries[lo];
+        }
+    }
+    return NULL;
+}
+
+const PackEntry *GetPackEntries(const AssetPack *pack, ifast32 *count)
+{
+    *count = pack->header->entryCount;
+    return pack->entries;
+}
+
+const void *GetPackEntryData(const AssetPack *pack, const PackEntry *entry)
+{
+    return entry->compression == PACK_COMPRESSION_NONE ? pack->base + entry->offset : NULL;
+}
+
+const void *GetPackEntryStoredData(const AssetPack *pack, const PackEntry *entry)
+{
+    return pack->base + entry->offset;
+}
+
+/* The part of one compressed block a ReadPackEntry wants */
+typedef struct BlockRead
+{
+    const u8 *stored;
+    u64 storedSize;
+    const PackBlock *block;
+    u32 blockSize;
+    u32 from;
+    u32 to;
+    u8 *dst;
+    bool ok;
+} BlockRead;
+
+local void DecodeBlock(void *param)
+{
+    BlockRead *r = param;
+    const PackBlock *block = r->block;
+    r->ok = false;
+    if (block->offset > r->storedSize || r->storedSize - block->offset < block->storedSize ||
+        block->storedSize > r->blockSize)
+    {
+        return;
+    }
+    const u8 *src = r->stored + block->offset;
+    if ((u32)HashPackBytes(src, block->storedSize) != block->checksum)
+    {
+        return;
+    }
+    if (block->storedSize == r->blockSize)
+    {
+        memcpy(r->dst, src + r->from, r->to - r->from);
+        r->ok = true;
+    }
+    else if (r->from == 0 && r->to == r->blockSize)
+    {
+        r->ok = DecompressLz4Block(src, block->storedSize, r->dst, r->blockSize) == r->blockSize;
+    }
+    else
+    {
+        /* Only part of it is wanted, so it can't be decoded in place */
+        u8 *scratch = malloc(r->blockSize);
+        if (!scratch)
+        {
+            fprintf(stderr, "PACK: out of memory decoding a block\n");
+            return;
+        }
+        r->ok = DecompressLz4Block(src, block->storedSize, scratch, r->blockSize) == r->blockSize;
+        if (r->ok)
+        {
+            memcpy(r->dst, scratch + r->from, r->to - r->from);
+        }
+        free(scratch);
+    }
+}
+
+bool ReadPackEntry(const AssetPack *pack, const PackEntry *entry, u64 offset, u64 size,
+                   void *dst, JobSystem *jobs)
+{
+    return DecodePackEntry(entry, pack->base + entry->offset, offset, size, dst, jobs);
+}
+
+bool DecodePackEntry(const PackEntry *entry, const void *storedData, u64 offset, u64 size,
+                     void *dst, JobSystem *jobs)
+{
+    if (offset > entry->size || entry->size - offset < size)
+    {
+        fprintf(stderr, "PACK: read past the end of %s\n", entry->name);
+        return false;
+    }
+    const u8 *stored = storedData;
+    if (entry->compression == PACK_COMPRESSION_NONE)
+    {
+        memcpy(dst, stored + offset, size);
+        return true;
+    }
+    if (!size)
+    {
+        return true;
+    }
+
+    const PackBlock *blocks = (const PackBlock *)stored;
+    u64 first = offset / PACK_BLOCK_SIZE;
+    u64 last = (offset + size - 1) / PACK_BLOCK_SIZE;
+    ifast32 count = (ifast32)(last - first + 1);
+    BlockRead *reads = malloc(count * sizeof(*reads));
+    if (!reads)
+    {
+        fprintf(stderr, "PACK: out of memory reading %s\n", entry->name);
+        return false;
+    }
+    JobCounter counter = {0};
+    for (ifast32 i = 0; i < count; i++)
+    {
+        u64 start = (first + i) * PACK_BLOCK_SIZE;
+        u64 end = entry->size - start < PACK_BLOCK_SIZE ? entry->size : start + PACK_BLOCK_SIZE;
+        u64 from = offset > start ? offset : start;
+        u64 to = offset + size < end ? offset + size : end;
+        reads[i] = (BlockRead){stored,
+                               entry->storedSize,
+                               &blocks[first + i],
+                               (u32)(end - start),
+                               (u32)(from - start),
+                               (u32)(to - start),
+                               (u8 *)dst + (from - offset),
+                               false};
+        if (count == 1)
+        {
+            DecodeBlock(&reads[i]);
+        }
+        else
+        {
+            RunJob(jobs, &counter, DecodeBlock, &reads[i]);
+        }
+    }
+    WaitJobs(jobs, &counter);
+
+    bool ok = true;
+    for (ifast32 i = 0; i < count && ok; i++)
+    {
+        if (!reads[i].ok)
+        {
+            fprintf(stderr, "PACK: block %ld of %s is corrupt\n", (long)(first + i), entry->name);
+            ok = false;
+        }
+    }
+    free(reads);
+    return ok;
+}
+
+bool VerifyPackEntry(const AssetPack *pack, const PackEntry *entry)
+{
+    const void *data = GetPackEntryData(pack, entry);
+    if (data)
+    {
+        return HashPackBytes(data, entry->size) == entry->contentHash;
+    }
+    u8 *decoded = malloc(entry->size);
+    bool ok = decoded && ReadPackEntry(pack, entry, 0, entry->size, decoded, NULL) &&
+              HashPackBytes(decoded, entry->size) == entry->contentHash;
+    free(decoded);
+    return ok;
+}
+
+void AdviseAssetPack(const AssetPack *pack, PackAccess access)
+{
+    local const int advice[] = {
+        [PACK_ACCESS_NORMAL] = MADV_NORMAL,
+        [PACK_ACCESS_SEQUENTIAL] = MADV_SEQUENTIAL,
+        [PACK_ACCESS_RANDOM] = MADV_RANDOM,
+    };
+    madvise((void *)pack->base, pack->size, advice[access]);
+}
+
+/* Pages covering the entry; with inner set only those entirely inside it,
+   so neighbouring entries keep theirs */
+local bool EntryPages(const AssetPack *pack, const PackEntry *entry, bool inner, u8 **start,
+                      usize *length)
+{
+    uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t begin = (uintptr_t)(pack->base + entry->offset);
+    uintptr_t end = begin + entry->storedSize;
+    if (inner)
+    {
+        begin = (begin + page - 1) & ~(page - 1);
+        end &= ~(page - 1);
+    }
+    else
+    {
+        begin &= ~(page - 1);
+        end = (end + page - 1) & ~(page - 1);
+    }
+    *start = (u8 *)begin;
+    *length = end > begin ? end - begin : 0;
+    return *length != 0;
+}
+
+void PrefetchPackEntry(const AssetPack *pack, const PackEntry *entry)
+{
+    u8 *start;
+    usize length;
+    if (EntryPages(pack, entry, false, &start, &length))
+    {
+        madvise(start, length, MADV_WILLNEED);
+    }
+}
+
+void ReleasePackEntry(const AssetPack *pack, const PackEntry *entry)
+{
+    /* The mapping is read only and file backed, so dropped pages just get
+       read back in */
+    u8 *start;
+    usize length;
+    if (EntryPages(pack, entry, true, &start, &length))
+    {
+        madvise(start, length, MADV_DONTNEED);
+    }
+}
+
+ifast32 PrefetchPackManifest(const AssetPack *pack, const char *manifestPath)
+{
+    isize size;
+    const char *manifest = MapFileToROBuffer(manifestPath, NULL, &size);
+    if (!manifest)
+    {
+        fprintf(stderr, "PACK: could not read manifest %s\n", manifestPath);
+        return -1;
+    }
+    ifast32 found = 0;
+    const char *end = manifest + size;
+    for (const char *line = manifest; line < end;)
+    {
+        const char *next = memchr(line, '\n', end - line);
+        next = next ? next : end;
+        isize len = next - line;
+        if (len && line[len - 1] == '\r')
+        {
+            len--;
+        }
+        if (len && line[0] != '#')
+        {
+            char name[PACK_NAME_SIZE];
+            const PackEntry *entry = NULL;
+            if (len < PACK_NAME_SIZE)
+            {
+                memcpy(name, line, len);
+                name[len] = 0;
+                entry = FindPackEntry(pack, name);
+            }
+            if (entry)
+            {
+                PrefetchPackEntry(pack, entry);
+                found++;
+            }
+            else
+            {
+                fprintf(stderr, "PACK: %s names %.*s, which isn't in the pack\n", manifestPath,
+                        (int)len, line);
+            }
+        }
+        line = next + 1;
+    }
+    UnmapMappedBuffer((void *)manifest, size);
+    return found;
+}
+
+GLuint CreateBufferFromPackEntry(const AssetPack *pack, const PackEntry *entry,
+                                 GLbitfield storageFlags)
+{
+    const void *data = GetPackEntryData(pack, entry);
+    void *decoded = NULL;
+    if (!data)
+    {
+        data = decoded = malloc(entry->size);
+        if (!decoded || !ReadPackEntry(pack, entry, 0, entry->size, decoded, NULL))
+        {
+            free(decoded);
+            return 0;
+        }
+    }
+    GLuint buffer;
+    glCreateBuffers(1, &buffer);
+    glNamedBufferStorage(buffer, entry->size, data, storageFlags);
+    glObjectLabel(GL_BUFFER, buffer, -1, entry->name);
+    free(decoded);
+    return buffer;
+}
+
+GLuint CreateTextureFromPackEntry(const AssetPack *pack, const PackEntry *entry)
+{
+    u32 width = entry->info[0];
+    u32 height = entry->info[1];
+    u32 levels = entry->info[2];
+    u32 bytesPerPixel = entry->info[6];
+
+    const u8 *pixels = GetPackEntryData(pack, entry);
+    u8 *decoded = NULL;
+    if (!pixels)
+    {
+        pixels = decoded = malloc(entry->size);
+        if (!decoded || !ReadPackEntry(pack, entry, 0, entry->size, decoded, NULL))
+        {
+            free(decoded);
+            return 0;
+        }
+    }
+
+    GLuint texture;
+    glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+    glTextureStorage2D(texture, levels, entry->info[3], width, height);
+    glObjectLabel(GL_TEXTURE, texture, -1, entry->name);
+
+    const u8 *end = pixels + entry->size;
+    for (u32 level = 0; level < levels; level++)
+    {
+        u32 w = width > 1 ? width : 1;
+        u32 h = height > 1 ? height : 1;
+        u64 levelSize = (((u64)w * bytesPerPixel + 3) & ~(u64)3) * h;
+        if ((u64)(end - pixels) < levelSize)
+        {
+            fprintf(stderr, "PACK: %s is missing mip levels\n", entry->name);
+            break;
+        }
+        glTextureSubImage2D(texture, level, 0, 0, w, h, entry->info[4], entry->info[5], pixels);
+        pixels += levelSize;
+        width >>= 1;
+        height >>= 1;
+    }
+    free(decoded);
+    return texture;
+}
+
+PackWriter *CreatePackWriter(const char *path)
+{
+    FILE *out = fopen(path, "wb");
+    if (!out)
+    {
+        fprintf(stderr, "PACK: could not open %s\n", path);
+        return NULL;
+    }
+    /* Header is filled in by FinishPackWriter */
+    PackHeader header = {0};
+    fwrite(&header, sizeof(header), 1, out);
+
+    PackWriter *w = calloc(1, sizeof(*w));
+    if (!w)
+    {
+        fclose(out);
+        return NULL;
+    }
+    w->out = out;
+    w->offset = sizeof(header);
+    return w;
+}
+
+void SetPackCompression(PackWriter *w, PackCompression compression)
+{
+    w->compression = compression;
+}
+
+local void PadPackWriter(PackWriter *w)
+{
+    local const u8 zeroes[PACK_ALIGNMENT];
+    u64 padding = (PACK_ALIGNMENT - w->offset % PACK_ALIGNMENT) % PACK_ALIGNMENT;
+    fwrite(zeroes, 1, padding, w->out);
+    w->offset += padding;
+}
+
+local PackEntry *NewPackEntry(PackWriter *w)
+{
+    if (w->entryCount == w->entryCap)
+    {
+        ifast32 cap = w->entryCap ? w->entryCap * 2 : 64;
+        PackEntry *entries = realloc(w->entries, cap * sizeof(*entries));
+        if (!entries)
+        {
+            fprintf(stderr, "PACK: out of memory for entries\n");
+            return NULL;
+        }
+        w->entries = entries;
+        w->entryCap = cap;
+    }
+    PadPackWriter(w);
+    PackEntry *e = &w->entries[w->entryCount++];
+    memset(e, 0, sizeof(*e));
+    e->offset = w->offset;
+    return e;
+}
+
+/* Block index followed by the blocks, NULL if it came out no smaller */
+local u8 *CompressPackEntry(const u8 *data, u64 size, u64 *storedSize)
+{
+    u64 blockCount = (size + PACK_BLOCK_SIZE - 1) / PACK_BLOCK_SIZE;
+    u64 at = blockCount * sizeof(PackBlock);
+    u8 *stored = malloc(at + blockCount * Lz4CompressBound(PACK_BLOCK_SIZE));
+    if (!stored)
+    {
+        return NULL;
+    }
+    PackBlock *blocks = (PackBlock *)stored;
+    for (u64 i = 0; i < blockCount; i++)
+    {
+        const u8 *src = data + i * PACK_BLOCK_SIZE;
+        u64 remaining = size - i * PACK_BLOCK_SIZE;
+        isize blockSize = remaining < PACK_BLOCK_SIZE ? (isize)remaining : PACK_BLOCK_SIZE;
+        isize n = CompressLz4Block(src, blockSize, stored + at, Lz4CompressBound(blockSize));
+        if (!n || n >= blockSize)
+        {
+            memcpy(stored + at, src, blockSize);
+            n = blockSize;
+        }
+        blocks[i] = (PackBlock){at, (u32)n, (u32)HashPackBytes(stored + at, n)};
+        at += n;
+    }
+    if (at >= size)
+    {
+        free(stored);
+        return NULL;
+    }
+    *storedSize = at;
+    return stored;
+}
+
+bool AddPackEntry(PackWriter *w, const char *name, PackEntryType type,
+                  const u32 info[PACK_INFO_COUNT], const void *data, u64 size)
+{
+    if (strlen(name) >= PACK_NAME_SIZE)
+    {
+        fprintf(stderr, "PACK: name %s is too long\n", name);
+        return false;
+    }
+
+    PackEntry *e = NewPackEntry(w);
+    if (!e)
+    {
+        return false;
+    }
+    strcpy(e->name, name);
+    e->nameHash = HashPackName(name);
+    e->contentHash = HashPackBytes(data, size);
+    e->size = size;
+    e->storedSize = size;
+    e->type = type;
+    if (info)
+    {
+        memcpy(e->info, info, sizeof(e->info));
+    }
+
+    u8 *compressed = NULL;
+    if (w->compression == PACK_COMPRESSION_LZ4 && size)
+    {
+        compressed = CompressPackEntry(data, size, &e->storedSize);
+    }
+    if (compressed)
+    {
+        e->compression = PACK_COMPRESSION_LZ4;
+        data = compressed;
+    }
+    bool ok = !e->storedSize || fwrite(data, e->storedSize, 1, w->out) == 1;
+    w->offset += e->storedSize;
+    free(compressed);
+    return ok;
+}
+
+bool CopyPackEntry(PackWriter *w, const AssetPack *pack, const PackEntry *entry)
+{
+    PackEntry *e = NewPackEntry(w);
+    if (!e)
+    {
+        return false;
+    }
+    u64 offset = e->offset;
+    *e = *entry;
+    e->offset = offset;
+    if (e->storedSize &&
+        fwrite(GetPackEntryStoredData(pack, entry), e->storedSize, 1, w->out) != 1)
+    {
+        return false;
+    }
+    w->offset += e->storedSize;
+    return true;
+}
+
+local int ComparePackEntries(const void *a, const void *b)
+{
+    const PackEntry *ea = a;
+    const PackEntry *eb = b;
+    if (ea->nameHash != eb->nameHash)
+    {
+        return ea->nameHash < eb->nameHash ? -1 : 1;
+    }
+    return strcmp(ea->name, eb->name);
+}
+
+bool FinishPackWriter(PackWriter *w)
+{
+    qsort(w->entries, w->entryCount, sizeof(*w->entries), ComparePackEntries);
+
+    PadPackWriter(w);
+    PackHeader header = {PACK_MAGIC, PACK_VERSION, w->entryCount, PACK_ALIGNMENT, w->offset, 0};
+    bool ok = fwrite(w->entries, sizeof(*w->entries), w->entryCount, w->out) == (size_t)w->entryCount;
+    header.size = w->offset + w->entryCount * sizeof(*w->entries);
+
+    fseek(w->out, 0, SEEK_SET);
+    ok = ok && fwrite(&header, sizeof(header), 1, w->out) == 1;
+    ok = fclose(w->out) == 0 && ok;
+
+    free(w->entries);
+    free(w);
+    return ok;
+}
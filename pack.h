@@ -0,0 +1,181 @@
+#ifndef PACK_H
+#define PACK_H
+#include "glad.h"
+#include "jobs.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Asset packs are a header, a run of blobs aligned to PACK_ALIGNMENT
+       and a table of contents sorted by name hash. A pack is mapped once
+       and entries are handed to GL straight from the mapped pages, nothing
+       is parsed or copied at load time.
+
+       Blob layout per type:
+           PACK_ENTRY_VERTICES  info[0] stride, info[1] vertex count
+           PACK_ENTRY_INDICES   info[0] GL index type, info[1] index count
+           PACK_ENTRY_TEXTURE   info[0] width, info[1] height, info[2] mip
+                                levels, info[3] internal format, info[4]
+                                format, info[5] type, info[6] bytes per
+                                pixel. Levels are stored largest first,
+                                rows padded to 4 bytes (GL's default
+                                unpack alignment)
+
+       An entry can also be stored compressed, in independent blocks of
+       PACK_BLOCK_SIZE bytes (the last one shorter). Its stored data starts
+       with a PackBlock per block, so any range can be read by decoding
+       just the blocks it touches, and those blocks can be decoded in
+       parallel. Blocks that didn't shrink are stored as is, and entries
+       that didn't shrink aren't compressed at all. */
+
+#define PACK_MAGIC 0x4b415052 /* "RPAK" */
+#define PACK_VERSION 2
+#define PACK_ALIGNMENT 64
+#define PACK_NAME_SIZE 48
+#define PACK_INFO_COUNT 8
+#define PACK_BLOCK_SIZE (64 * 1024)
+
+    typedef enum PackEntryType
+    {
+        PACK_ENTRY_BLOB,
+        PACK_ENTRY_VERTICES,
+        PACK_ENTRY_INDICES,
+        PACK_ENTRY_TEXTURE,
+    } PackEntryType;
+
+    typedef enum PackCompression
+    {
+        PACK_COMPRESSION_NONE,
+        PACK_COMPRESSION_LZ4,
+    } PackCompression;
+
+    typedef struct PackBlock
+    {
+        /* From the start of the entry's stored data */
+        u64 offset;
+        /* Equal to the block's size when it's stored uncompressed */
+        u32 storedSize;
+        /* Low half of HashPackBytes of the stored bytes */
+        u32 checksum;
+    } PackBlock;
+
+    typedef struct PackHeader
+    {
+        u32 magic;
+        u32 version;
+        u32 entryCount;
+        u32 alignment;
+        u64 tocOffset;
+        u64 size;
+    } PackHeader;
+
+    typedef struct PackEntry
+    {
+        char name[PACK_NAME_SIZE];
+        u64 nameHash;
+        u64 contentHash;
+        u64 offset;
+        /* Uncompressed, contentHash covers these bytes */
+        u64 size;
+        /* Bytes in the file at offset */
+        u64 storedSize;
+        u32 type;
+        u32 compression;
+        u32 info[PACK_INFO_COUNT];
+    } PackEntry;
+
+    typedef struct AssetPack AssetPack;
+
+    /* Returns NULL if the file is missing or isn't a valid pack */
+    AssetPack *OpenAssetPack(const char *path);
+
+    void CloseAssetPack(AssetPack *pack);
+
+    /* As it was opened, for reading the file some other way than the
+       mapping */
+    const char *GetAssetPackPath(const AssetPack *pack);
+
+    const PackEntry *FindPackEntry(const AssetPack *pack, const char *name);
+
+    const PackEntry *GetPackEntries(const AssetPack *pack, ifast32 *count);
+
+    /* Points into the mapping, valid until the pack is closed. NULL for
+       compressed entries, which have to go through ReadPackEntry. */
+    const void *GetPackEntryData(const AssetPack *pack, const PackEntry *entry);
+
+    /* The entry's bytes as they're stored in the file, storedSize of them */
+    const void *GetPackEntryStoredData(const AssetPack *pack, const PackEntry *entry);
+
+    /* Copies size bytes of the entry starting at offset into dst,
+       decompressing on the job threads (or here with no job system) and
+       checking each block it decodes. Returns false if the range is out of
+       bounds or a block is corrupt. */
+    bool ReadPackEntry(const AssetPack *pack, const PackEntry *entry, u64 offset, u64 size,
+                       void *dst, JobSystem *jobs);
+
+    /* ReadPackEntry from a copy of the entry's stored bytes read some other
+       way, storedSize of them */
+    bool DecodePackEntry(const PackEntry *entry, const void *stored, u64 offset, u64 size,
+                         void *dst, JobSystem *jobs);
+
+    /* Rehashes the blob. Slow, meant for tools and debug builds */
+    bool VerifyPackEntry(const AssetPack *pack, const PackEntry *entry);
+
+    typedef enum PackAccess
+    {
+        PACK_ACCESS_NORMAL,     /* Default kernel readahead */
+        PACK_ACCESS_SEQUENTIAL, /* Read front to back, read far ahead */
+        PACK_ACCESS_RANDOM,     /* No readahead, entries are prefetched explicitly */
+    } PackAccess;
+
+    /* Readahead hint for the whole mapping */
+    void AdviseAssetPack(const AssetPack *pack, PackAccess access);
+
+    /* Starts reading the entry's pages in the background */
+    void PrefetchPackEntry(const AssetPack *pack, const PackEntry *entry);
+
+    /* Unmaps the entry's pages from this process once its data lives
+       somewhere else, like on the GPU. Only the resident set shrinks, the
+       page cache is left alone; touching the entry again maps them back,
+       from the file if they've been evicted since. */
+    void ReleasePackEntry(const AssetPack *pack, const PackEntry *entry);
+
+    /* Prefetches every entry a level load manifest names, one per line;
+       blank lines and lines starting with # are skipped. Returns how many
+       were found, -1 if the manifest can't be read. */
+    ifast32 PrefetchPackManifest(const AssetPack *pack, const char *manifestPath);
+
+    /* Immutable buffer filled directly from the mapped blob */
+    GLuint CreateBufferFromPackEntry(const AssetPack *pack, const PackEntry *entry,
+                                     GLbitfield storageFlags);
+
+    /* GL_TEXTURE_2D with every stored mip level */
+    GLuint CreateTextureFromPackEntry(const AssetPack *pack, const PackEntry *entry);
+
+    u64 HashPackName(const char *name);
+
+    u64 HashPackBytes(const void *data, u64 size);
+
+    /* Writing, for tools */
+    typedef struct PackWriter PackWriter;
+
+    PackWriter *CreatePackWriter(const char *path);
+
+    /* For the entries added after it, none to begin with */
+    void SetPackCompression(PackWriter *w, PackCompression compression);
+
+    bool AddPackEntry(PackWriter *w, const char *name, PackEntryType type,
+                      const u32 info[PACK_INFO_COUNT], const void *data, u64 size);
+
+    /* Adds an entry from another pack as it's stored there, without
+       decompressing or recompressing it */
+    bool CopyPackEntry(PackWriter *w, const AssetPack *pack, const PackEntry *entry);
+
+    /* Writes the table of contents and closes the file */
+    bool FinishPackWriter(PackWriter *w);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,277 @@
+#define _DEFAULT_SOURCE //clock_gettime
+#include "profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Must be a power of two */
+#define PROFILE_RING_SIZE (1 << 16)
+#define PROFILE_MAX_DEPTH 64
+#define PROFILE_MAX_TRACKS 8
+
+typedef struct ProfileEvent
+{
+    const char *name;
+    u64 start;
+    u64 end;
+} ProfileEvent;
+
+/* One per thread. Single producer (the owning thread) and single consumer
+   (whoever collects and writes the trace), so head and tail are the only
+   shared state. */
+typedef struct ProfileBuffer
+{
+    struct ProfileBuffer *next;
+    const char *name;
+    u32 tid;
+
+    u64 head;
+    u64 tail;
+    u64 dropped;
+
+    /* Consumer only. Zones collected out of the ring, waiting for the
+       trace to be written. */
+    ProfileEvent *collected;
+    u64 collectedCount;
+    u64 collectedCapacity;
+
+    /* Owning thread only */
+    u32 depth;
+    u64 stackStart[PROFILE_MAX_DEPTH];
+    const char *stackName[PROFILE_MAX_DEPTH];
+
+    ProfileEvent events[PROFILE_RING_SIZE];
+} ProfileBuffer;
+
+local ProfileBuffer *buffers;
+local u32 nextTid = 1;
+local __thread ProfileBuffer *threadBuffer;
+local ProfileBuffer *tracks[PROFILE_MAX_TRACKS];
+
+local u64 initTicks;
+local u64 initNanoseconds;
+
+local u64 ReadNanoseconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+local ProfileBuffer *CreateProfileBuffer(const char *name)
+{
+    ProfileBuffer *b = calloc(1, sizeof(*b));
+    if (!b)
+    {
+        return NULL;
+    }
+    b->name = name;
+    b->tid = __atomic_fetch_add(&nextTid, 1, __ATOMIC_RELAXED);
+    b->next = __atomic_load_n(&buffers, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&buffers, &b->next, b, true,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    {
+    }
+    return b;
+}
+
+local ProfileBuffer *GetThreadBuffer(void)
+{
+    if (!threadBuffer)
+    {
+        threadBuffer = CreateProfileBuffer(NULL);
+    }
+    return threadBuffer;
+}
+
+local void PushProfileEvent(ProfileBuffer *b, const char *name, u64 start, u64 end)
+{
+    u64 head = b->head;
+    u64 tail = __atomic_load_n(&b->tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= PROFILE_RING_SIZE)
+    {
+        b->dropped++;
+        return;
+    }
+    ProfileEvent *e = &b->events[head & (PROFILE_RING_SIZE - 1)];
+    e->name = name;
+    e->start = start;
+    e->end = end;
+    __atomic_store_n(&b->head, head + 1, __ATOMIC_RELEASE);
+}
+
+/* Moves what the producer has finished into collected. Leaves the ring
+   alone if there's no memory for it, the zones are still in the trace
+   unless the ring fills up before the next try. */
+local void CollectProfileBuffer(ProfileBuffer *b)
+{
+    u64 head = __atomic_load_n(&b->head, __ATOMIC_ACQUIRE);
+    u64 count = head - b->tail;
+    if (!count)
+    {
+        return;
+    }
+    if (b->collectedCount + count > b->collectedCapacity)
+    {
+        u64 capacity = b->collectedCapacity ? b->collectedCapacity : PROFILE_RING_SIZE;
+        while (capacity < b->collectedCount + count)
+        {
+            capacity *= 2;
+        }
+        ProfileEvent *collected = realloc(b->collected, capacity * sizeof(*collected));
+        if (!collected)
+        {
+            return;
+        }
+        b->collected = collected;
+        b->collectedCapacity = capacity;
+    }
+    for (u64 i = b->tail; i < head; i++)
+    {
+        b->collected[b->collectedCount++] = b->events[i & (PROFILE_RING_SIZE - 1)];
+    }
+    __atomic_store_n(&b->tail, head, __ATOMIC_RELEASE);
+}
+
+void ProfileInit(void)
+{
+    initTicks = ReadProfileTicks();
+    initNanoseconds = ReadNanoseconds();
+    ProfileSetThreadName("Main");
+}
+
+void ProfileSetThreadName(const char *name)
+{
+    ProfileBuffer *b = GetThreadBuffer();
+    if (b)
+    {
+        b->name = name;
+    }
+}
+
+void ProfileBeginZone(const char *name)
+{
+    ProfileBuffer *b = GetThreadBuffer();
+    if (!b)
+    {
+        return;
+    }
+    if (b->depth < PROFILE_MAX_DEPTH)
+    {
+        b->stackName[b->depth] = name;
+        b->stackStart[b->depth] = ReadProfileTicks();
+    }
+    b->depth++;
+}
+
+void ProfileEndZone(void)
+{
+    u64 end = ReadProfileTicks();
+    ProfileBuffer *b = threadBuffer;
+    if (!b || b->depth == 0)
+    {
+        return;
+    }
+    b->depth--;
+    if (b->depth < PROFILE_MAX_DEPTH)
+    {
+        PushProfileEvent(b, b->stackName[b->depth], b->stackStart[b->depth], end);
+    }
+}
+
+void ProfileEndScope(int *unused)
+{
+    ignore unused;
+    ProfileEndZone();
+}
+
+void ProfileEmitZone(const char *track, const char *name, u64 startTicks, u64 endTicks)
+{
+    ProfileBuffer *b = NULL;
+    for (ifast32 i = 0; i < PROFILE_MAX_TRACKS; i++)
+    {
+        if (!tracks[i])
+        {
+            b = tracks[i] = CreateProfileBuffer(track);
+            break;
+        }
+        if (strcmp(tracks[i]->name, track) == 0)
+        {
+            b = tracks[i];
+            break;
+        }
+    }
+    if (b)
+    {
+        PushProfileEvent(b, name, startTicks, endTicks);
+    }
+}
+
+f64 ProfileTicksPerMicrosecond(void)
+{
+    /* Need a few milliseconds between samples for the ratio to settle */
+    u64 ns;
+    while ((ns = ReadNanoseconds()) - initNanoseconds < 10 * 1000 * 1000)
+    {
+    }
+    u64 ticks = ReadProfileTicks();
+    return (f64)(ticks - initTicks) * 1000.0 / (f64)(ns - initNanoseconds);
+}
+
+void ProfileCollect(void)
+{
+    for (ProfileBuffer *b = __atomic_load_n(&buffers, __ATOMIC_ACQUIRE); b; b = b->next)
+    {
+        CollectProfileBuffer(b);
+    }
+}
+
+bool ProfileWriteChromeTrace(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f)
+    {
+        fprintf(stderr, "PROFILE: could not open %s\n", path);
+        return false;
+    }
+
+    f64 ticksPerUs = ProfileTicksPerMicrosecond();
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", f);
+    bool first = true;
+    for (ProfileBuffer *b = __atomic_load_n(&buffers, __ATOMIC_ACQUIRE); b; b = b->next)
+    {
+        fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%" PRIu32 ",\"args\":{\"name\":\"%s\"}}",
+                first ? "" : ",\n", b->tid, b->name ? b->name : "Thread");
+        first = false;
+
+        /* What couldn't be collected for lack of memory goes straight from
+           the ring */
+        CollectProfileBuffer(b);
+        u64 head = __atomic_load_n(&b->head, __ATOMIC_ACQUIRE);
+        u64 ringCount = head - b->tail;
+        for (u64 i = 0; i < b->collectedCount + ringCount; i++)
+        {
+            ProfileEvent *e = i < b->collectedCount
+                                  ? &b->collected[i]
+                                  : &b->events[(b->tail + i - b->collectedCount) &
+                                               (PROFILE_RING_SIZE - 1)];
+            f64 ts = (f64)(e->start - initTicks) / ticksPerUs;
+            f64 dur = (f64)(e->end - e->start) / ticksPerUs;
+            fprintf(f, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%" PRIu32 ",\"ts\":%.3f,\"dur\":%.3f}",
+                    e->name, b->tid, ts, dur);
+        }
+        b->collectedCount = 0;
+        __atomic_store_n(&b->tail, head, __ATOMIC_RELEASE);
+
+        if (b->dropped)
+        {
+            fprintf(stderr, "PROFILE: %s dropped %" PRIu64 " zones, ring buffer full\n",
+                    b->name ? b->name : "Thread", b->dropped);
+        }
+    }
+    fputs("\n]}\n", f);
+    fclose(f);
+    return true;
+}
@@ -0,0 +1,89 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+#include "rutils/def.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Zones are only recorded when built with -DPROFILE. Otherwise every macro
+   below expands to nothing, so they can be left in hot code.
+
+   Zone names must outlive the profiler (string literals), only the pointer
+   is recorded. */
+#if defined(PROFILE)
+#define PROFILE_INIT() ProfileInit()
+#define PROFILE_THREAD_NAME(name) ProfileSetThreadName(name)
+#define PROFILE_BEGIN(name) ProfileBeginZone(name)
+#define PROFILE_END() ProfileEndZone()
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+/* Ends the zone when the enclosing block is left */
+#define PROFILE_SCOPE(name)                          \
+    int PROFILE_CONCAT(profileScope, __LINE__)       \
+        __attribute__((cleanup(ProfileEndScope))) = \
+            (ProfileBeginZone(name), 0)
+#define PROFILE_WRITE_TRACE(path) ProfileWriteChromeTrace(path)
+#define PROFILE_COLLECT() ProfileCollect()
+#define PROFILE_EMIT_ZONE(track, name, start, end) ProfileEmitZone(track, name, start, end)
+#else
+#define PROFILE_INIT()
+#define PROFILE_THREAD_NAME(name)
+#define PROFILE_BEGIN(name)
+#define PROFILE_END()
+#define PROFILE_SCOPE(name)
+#define PROFILE_WRITE_TRACE(path)
+#define PROFILE_COLLECT()
+#define PROFILE_EMIT_ZONE(track, name, start, end)
+#endif
+
+    static inline u64 ReadProfileTicks(void)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+    }
+
+    /* Calibrates ticks against the wall clock. Call once on the main thread
+       before any zones are recorded */
+    void ProfileInit(void);
+
+    void ProfileSetThreadName(const char *name);
+
+    void ProfileBeginZone(const char *name);
+
+    void ProfileEndZone(void);
+
+    void ProfileEndScope(int *unused);
+
+    /* Records a zone whose times were measured elsewhere, on a named track
+       that isn't a real thread (e.g. the GPU). The track is created on first
+       use. Every zone on a given track must come from the same thread. */
+    void ProfileEmitZone(const char *track, const char *name, u64 startTicks, u64 endTicks);
+
+    f64 ProfileTicksPerMicrosecond(void);
+
+    /* Moves every thread's finished zones out of its ring buffer, which
+       drops zones once it's full, into memory that grows with them. Call
+       it about once a frame so long sessions keep all their zones, from
+       the thread that writes the trace. */
+    void ProfileCollect(void);
+
+    /* Writes every zone collected so far and whatever is still in the ring
+       buffers into a Chrome trace-event JSON file that chrome://tracing and
+       Perfetto can open. Zones recorded after
+       this call go into the next trace. */
+    bool ProfileWriteChromeTrace(const char *path);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,134 @@
+#include "gl-trace.h"
+#include "glad.h"
+#include "rutils/debug.h"
+#include "rutils/def.h"
+#include "rutils/file.h"
+#include <SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Replays a trace written with --record-gl, so driver cost can be measured
+   without the engine's own CPU work in the way:
+
+       replay <trace> [--loops N] [--visible]
+
+   The setup section runs once, then the recorded frames are looped. Every
+   loop ends with glFinish so the timing covers the GPU work as well. */
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    ifast32 loops = 10;
+    bool visible = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--loops") == 0 && i + 1 < argc)
+        {
+            loops = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--visible") == 0)
+        {
+            visible = true;
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+    if (!path)
+    {
+        fputs("usage: replay <trace> [--loops N] [--visible]\n", stderr);
+        return 1;
+    }
+
+    isize size;
+    void *data = MapFileToROBuffer(path, NULL, &size);
+    if (!data)
+    {
+        fprintf(stderr, "Could not open %s\n", path);
+        return 1;
+    }
+
+    GLTraceReader reader;
+    GLTraceHeader header;
+    if (!OpenGLTrace(&reader, data, size, &header))
+    {
+        UnmapMappedBuffer(data, size);
+        return 1;
+    }
+
+    SDL_Init(SDL_INIT_VIDEO);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK,
+                        SDL_GL_CONTEXT_PROFILE_CORE);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 5);
+    SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+    /* The same default framebuffer the engine records with */
+    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS, 0);
+    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES, 0);
+
+    u32 flags = SDL_WINDOW_OPENGL | (visible ? SDL_WINDOW_SHOWN : SDL_WINDOW_HIDDEN);
+    SDL_Window *win = SDL_CreateWindow("Replay", 0, 0, header.width, header.height, flags);
+    SDL_GLContext *c = SDL_GL_CreateContext(win);
+    SDL_GL_MakeCurrent(win, c);
+    /* Measuring, not presenting */
+    SDL_GL_SetSwapInterval(0);
+
+    INVARIANT(gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress), "Could not load GL");
+
+    u64 setupCalls = 0;
+    if (!ReplayGLTraceFrame(&reader, &setupCalls))
+    {
+        fputs("Trace has no setup section\n", stderr);
+        return 1;
+    }
+    glFinish();
+    const u8 *firstFrame = reader.at;
+
+    u64 frequency = SDL_GetPerformanceFrequency();
+    f64 bestMs = 0;
+    f64 totalMs = 0;
+    u64 frameCalls = 0;
+    for (ifast32 loop = 0; loop < loops; loop++)
+    {
+        reader.at = firstFrame;
+        u64 calls = 0;
+        u64 start = SDL_GetPerformanceCounter();
+        for (u32 frame = 0; frame < header.frameCount; frame++)
+        {
+            if (!ReplayGLTraceFrame(&reader, &calls))
+            {
+                break;
+            }
+            if (visible)
+            {
+                SDL_GL_SwapWindow(win);
+            }
+        }
+        glFinish();
+        f64 ms = (f64)(SDL_GetPerformanceCounter() - start) * 1000.0 / (f64)frequency;
+
+        totalMs += ms;
+        if (loop == 0 || ms < bestMs)
+        {
+            bestMs = ms;
+        }
+        frameCalls = calls;
+    }
+
+    u32 frames = header.frameCount ? header.frameCount : 1;
+    printf("%s: %" PRIu64 " setup calls, %u frames, %" PRIu64 " calls/frame\n",
+           path, setupCalls, header.frameCount, frameCalls / frames);
+    if (loops > 0)
+    {
+        printf("%.3fms/frame average, %.3fms/frame best over %d loops\n",
+               totalMs / loops / frames, bestMs / frames, (int)loops);
+    }
+
+    SDL_GL_DeleteContext(c);
+    SDL_DestroyWindow(win);
+    SDL_Quit();
+    UnmapMappedBuffer(data, size);
+    return 0;
+}
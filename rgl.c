@@ -27,15 +27,11 @@ void SetUniformIntShaderProg(ShaderProg s, char *uniformName, int i)
     glUniform1i(glGetUniformLocation(s._id, uniformName), i);
 }
 
-ShaderProg CreateShaderProg(char *vertShaderPath, char *fragShaderPath)
+ShaderProg CreateShaderProgFromSource(const char *vertShaderSource, const char *fragShaderSource)
 {
     GLuint vertShader = glCreateShader(GL_VERTEX_SHADER);
     {
-
-        isize vertShaderSourceSize;
-        char *vertShaderSource = MapFileToROBuffer(vertShaderPath, NULL, &vertShaderSourceSize);
-
-        glShaderSource(vertShader, 1, (const char **)&vertShaderSource, NULL);
+        glShaderSource(vertShader, 1, &vertShaderSource, NULL);
         glCompileShader(vertShader);
 
         int success;
@@ -46,14 +42,10 @@ ShaderProg CreateShaderProg(char *vertShaderPath, char *fragShaderPath)
             glGetShaderInfoLog(vertShader, 512, NULL, infoLog);
             fprintf(stderr, "COMPILE ERROR IN VERT SHADER %s\n", infoLog);
         }
-        UnmapMappedBuffer(vertShaderSource, vertShaderSourceSize);
     }
     GLuint fragShader = glCreateShader(GL_FRAGMENT_SHADER);
     {
-        isize fragShaderSourceSize;
-        char *fragShaderSource = MapFileToROBuffer(fragShaderPath, NULL, &fragShaderSourceSize);
-
-        glShaderSource(fragShader, 1, (const char **)&fragShaderSource, NULL);
+        glShaderSource(fragShader, 1, &fragShaderSource, NULL);
         glCompileShader(fragShader);
 
         int success;
@@ -62,9 +54,8 @@ ShaderProg CreateShaderProg(char *vertShaderPath, char *fragShaderPath)
         {
             char infoLog[512];
             glGetShaderInfoLog(fragShader, 512, NULL, infoLog);
-            fprintf(stderr, "COMPILE ERROR IN VERT SHADER %s\n", infoLog);
+            fprintf(stderr, "COMPILE ERROR IN FRAG SHADER %s\n", infoLog);
         }
-        UnmapMappedBuffer(fragShaderSource, fragShaderSourceSize);
     }
 
     ShaderProg shaderProg = {glCreateProgram()};
@@ -83,3 +74,17 @@ ShaderProg CreateShaderProg(char *vertShaderPath, char *fragShaderPath)
     }
     return shaderProg;
 }
+
+ShaderProg CreateShaderProg(char *vertShaderPath, char *fragShaderPath)
+{
+    isize vertShaderSourceSize;
+    char *vertShaderSource = MapFileToROBuffer(vertShaderPath, NULL, &vertShaderSourceSize);
+    isize fragShaderSourceSize;
+    char *fragShaderSource = MapFileToROBuffer(fragShaderPath, NULL, &fragShaderSourceSize);
+
+    ShaderProg shaderProg = CreateShaderProgFromSource(vertShaderSource, fragShaderSource);
+
+    UnmapMappedBuffer(vertShaderSource, vertShaderSourceSize);
+    UnmapMappedBuffer(fragShaderSource, fragShaderSourceSize);
+    return shaderProg;
+}
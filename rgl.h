@@ -31,6 +31,9 @@ extern "C"
     void SetUniformIntShaderProg(ShaderProg s, char *uniformName, int i);
 
     ShaderProg CreateShaderProg(char *vertShaderPath, char *fragShaderPath);
+
+    /* Sources are 0 terminated */
+    ShaderProg CreateShaderProgFromSource(const char *vertShaderSource, const char *fragShaderSource);
 #ifdef __cplusplus
 }
 #endif
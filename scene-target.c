@@ -0,0 +1,268 @@
+#include "scene-target.h"
+#include "texture.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct SceneTarget
+{
+    ifast32 width;
+    ifast32 height;
+    SceneAntiAlias antiAlias;
+    ifast32 samples;
+    /* The corner of the attachments actually drawn into, width and height
+       scaled down. The attachments stay full size so a new scale costs
+       nothing. */
+    f32 renderScale;
+    ifast32 renderWidth;
+    ifast32 renderHeight;
+
+    /* What's drawn into with MSAA, resolved into framebuffer */
+    GLuint msFramebuffer;
+    GLuint msColor;
+    GLuint msDepth;
+
+    /* Single sampled. Drawn into directly without MSAA, and where FXAA
+       reads from. */
+    GLuint framebuffer;
+    GLuint color;
+    GLuint depth;
+
+    GLuint fxaaProgram;
+    GLint fxaaUVScale;
+    /* Core profile won't draw without one bound, even with no attributes */
+    GLuint emptyVertexArray;
+};
+
+local void DeleteAttachments(SceneTarget *st)
+{
+    glDeleteFramebuffers(1, &st->msFramebuffer);
+    glDeleteRenderbuffers(1, &st->msColor);
+    glDeleteRenderbuffers(1, &st->msDepth);
+    glDeleteFramebuffers(1, &st->framebuffer);
+    glDeleteTextures(1, &st->color);
+    glDeleteRenderbuffers(1, &st->depth);
+    st->msFramebuffer = st->msColor = st->msDepth = 0;
+    st->framebuffer = st->color = st->depth = 0;
+}
+
+local void CreateAttachments(SceneTarget *st)
+{
+    glCreateTextures(GL_TEXTURE_2D, 1, &st->color);
+    glTextureStorage2D(st->color, 1, GL_RGBA8, st->width, st->height);
+    glObjectLabel(GL_TEXTURE, st->color, -1, "scene colour");
+    glCreateFramebuffers(1, &st->framebuffer);
+    glNamedFramebufferTexture(st->framebuffer, GL_COLOR_ATTACHMENT0, st->color, 0);
+
+    if (st->antiAlias == SCENE_AA_MSAA)
+    {
+        glCreateRenderbuffers(1, &st->msColor);
+        glNamedRenderbufferStorageMultisample(st->msColor, st->samples, GL_RGBA8, st->width,
+                                              st->height);
+        glCreateRenderbuffers(1, &st->msDepth);
+        glNamedRenderbufferStorageMultisample(st->msDepth, st->samples, GL_DEPTH_COMPONENT24,
+                                              st->width, st->height);
+        glCreateFramebuffers(1, &st->msFramebuffer);
+        glNamedFramebufferRenderbuffer(st->msFramebuffer, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                                       st->msColor);
+        glNamedFramebufferRenderbuffer(st->msFramebuffer, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER,
+                                       st->msDepth);
+    }
+    else
+    {
+        /* The resolve target needs no depth, only what's drawn into does */
+        glCreateRenderbuffers(1, &st->depth);
+        glNamedRenderbufferStorage(st->depth, GL_DEPTH_COMPONENT24, st->width, st->height);
+        glNamedFramebufferRenderbuffer(st->framebuffer, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER,
+                                       st->depth);
+    }
+
+    GLuint drawn = st->msFramebuffer ? st->msFramebuffer : st->framebuffer;
+    if (glCheckNamedFramebufferStatus(drawn, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE ||
+        glCheckNamedFramebufferStatus(st->framebuffer, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        fprintf(stderr, "SCENE: %dx%d target with %d samples is incomplete\n", (int)st->width,
+                (int)st->height, (int)st->samples);
+    }
+}
+
+local void UpdateRenderSize(SceneTarget *st)
+{
+    st->renderWidth = rintf(st->width * st->renderScale);
+    st->renderHeight = rintf(st->height * st->renderScale);
+    st->renderWidth = st->renderWidth > 0 ? st->renderWidth : 1;
+    st->renderHeight = st->renderHeight > 0 ? st->renderHeight : 1;
+}
+
+local ifast32 ClampSamples(SceneAntiAlias antiAlias, ifast32 samples)
+{
+    if (antiAlias != SCENE_AA_MSAA)
+    {
+        return 1;
+    }
+    GLint maxSamples = 1;
+    glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+    if (samples > maxSamples)
+    {
+        samples = maxSamples;
+    }
+    return samples < 2 ? 2 : samples;
+}
+
+SceneTarget *CreateSceneTarget(ifast32 width, ifast32 height, SceneAntiAlias antiAlias,
+                               ifast32 samples, GLuint fxaaProgram)
+{
+    SceneTarget *st = calloc(1, sizeof(*st));
+    if (!st)
+    {
+        return NULL;
+    }
+    st->width = width > 0 ? width : 1;
+    st->height = height > 0 ? height : 1;
+    st->antiAlias = antiAlias;
+    st->samples = ClampSamples(antiAlias, samples);
+    st->renderScale = 1;
+    UpdateRenderSize(st);
+    st->fxaaProgram = fxaaProgram;
+    st->fxaaUVScale = fxaaProgram ? glGetUniformLocation(fxaaProgram, "uvScale") : -1;
+    glCreateVertexArrays(1, &st->emptyVertexArray);
+    CreateAttachments(st);
+    return st;
+}
+
+void ResizeSceneTarget(SceneTarget *st, ifast32 width, ifast32 height)
+{
+    width = width > 0 ? width : 1;
+    height = height > 0 ? height : 1;
+    if (width == st->width && height == st->height)
+    {
+        return;
+    }
+    st->width = width;
+    st->height = height;
+    UpdateRenderSize(st);
+    DeleteAttachments(st);
+    CreateAttachments(st);
+}
+
+void SetSceneAntiAlias(SceneTarget *st, SceneAntiAlias antiAlias, ifast32 samples)
+{
+    samples = ClampSamples(antiAlias, samples);
+    if (antiAlias == st->antiAlias && samples == st->samples)
+    {
+        return;
+    }
+    st->antiAlias = antiAlias;
+    st->samples = samples;
+    DeleteAttachments(st);
+    CreateAttachments(st);
+}
+
+SceneAntiAlias GetSceneAntiAlias(const SceneTarget *st, ifast32 *samples)
+{
+    if (samples)
+    {
+        *samples = st->samples;
+    }
+    return st->antiAlias;
+}
+
+void SetSceneRenderScale(SceneTarget *st, f32 scale)
+{
+    st->renderScale = scale > 0 && scale < 1 ? scale : 1;
+    UpdateRenderSize(st);
+}
+
+f32 GetSceneRenderScale(const SceneTarget *st)
+{
+    return st->renderScale;
+}
+
+bool ParseSceneAntiAlias(const char *name, SceneAntiAlias *antiAlias, ifast32 *samples)
+{
+    if (strcmp(name, "off") == 0)
+    {
+        *antiAlias = SCENE_AA_NONE;
+        *samples = 1;
+    }
+    else if (strcmp(name, "fxaa") == 0)
+    {
+        *antiAlias = SCENE_AA_FXAA;
+        *samples = 1;
+    }
+    else if (strncmp(name, "msaa", 4) == 0 && atoi(name + 4) > 1)
+    {
+        *antiAlias = SCENE_AA_MSAA;
+        *samples = atoi(name + 4);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+void BeginSceneTarget(SceneTarget *st)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, st->msFramebuffer ? st->msFramebuffer : st->framebuffer);
+    glViewport(0, 0, st->renderWidth, st->renderHeight);
+    /* Keeps clears to the scaled down corner too */
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, st->renderWidth, st->renderHeight);
+}
+
+void PresentSceneTarget(SceneTarget *st, ifast32 x, ifast32 y, ifast32 w, ifast32 h)
+{
+    ifast32 rw = st->renderWidth;
+    ifast32 rh = st->renderHeight;
+    if (st->msFramebuffer)
+    {
+        /* Multisampled blits can't scale, so this one only resolves */
+        glBlitNamedFramebuffer(st->msFramebuffer, st->framebuffer, 0, 0, rw, rh, 0, 0, rw, rh,
+                               GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    /* Letterbox bars, nothing else draws there */
+    if (x > 0 || y > 0)
+    {
+        local const f32 black[4] = {0, 0, 0, 1};
+        glClearNamedFramebufferfv(0, GL_COLOR, 0, black);
+    }
+    glViewport(x, y, w, h);
+
+    if (st->antiAlias == SCENE_AA_FXAA && st->fxaaProgram)
+    {
+        local const SamplerDesc linear = {GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE,
+                                          GL_CLAMP_TO_EDGE, 1};
+        glUseProgram(st->fxaaProgram);
+        glUniform2f(st->fxaaUVScale, (f32)rw / st->width, (f32)rh / st->height);
+        glBindTextureUnit(0, st->color);
+        glBindSampler(0, GetSampler(&linear));
+        glBindVertexArray(st->emptyVertexArray);
+        /* Everything else draws depth tested */
+        glDisable(GL_DEPTH_TEST);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glEnable(GL_DEPTH_TEST);
+        glBindSampler(0, 0);
+    }
+    else
+    {
+        GLenum filter = w == rw && h == rh ? GL_NEAREST : GL_LINEAR;
+        glBlitNamedFramebuffer(st->framebuffer, 0, 0, 0, rw, rh, x, y, x + w, y + h,
+                               GL_COLOR_BUFFER_BIT, filter);
+    }
+}
+
+void DestroySceneTarget(SceneTarget *st)
+{
+    if (!st)
+    {
+        return;
+    }
+    DeleteAttachments(st);
+    glDeleteVertexArrays(1, &st->emptyVertexArray);
+    free(st);
+}
@@ -0,0 +1,67 @@
+#ifndef SCENE_TARGET_H
+#define SCENE_TARGET_H
+#include "glad.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Offscreen framebuffer the scene is drawn into, then resolved and
+       antialiased into the window's. The window's own framebuffer is
+       single sampled and only ever presented to, so the sample count is
+       a runtime choice instead of a property of the GL context:
+
+       - SCENE_AA_NONE draws into a plain colour texture.
+       - SCENE_AA_MSAA draws into multisampled renderbuffers and resolves
+         them with a framebuffer blit.
+       - SCENE_AA_FXAA draws like NONE and runs FXAA on the way out, for a
+         fixed per pixel cost instead of MSAA's per sample bandwidth.
+
+       The scene can also be drawn at a fraction of the target's size and
+       scaled up on the way out, see SetSceneRenderScale. */
+
+    typedef enum SceneAntiAlias
+    {
+        SCENE_AA_NONE,
+        SCENE_AA_MSAA,
+        SCENE_AA_FXAA
+    } SceneAntiAlias;
+
+    typedef struct SceneTarget SceneTarget;
+
+    /* samples only matters for MSAA and is clamped to GL_MAX_SAMPLES.
+       fxaaProgram draws a full screen triangle from gl_VertexID sampling
+       unit 0, see shaders/fxaa.*; it stays the caller's. */
+    SceneTarget *CreateSceneTarget(ifast32 width, ifast32 height, SceneAntiAlias antiAlias,
+                                   ifast32 samples, GLuint fxaaProgram);
+
+    /* Recreates the attachments if anything changed */
+    void ResizeSceneTarget(SceneTarget *st, ifast32 width, ifast32 height);
+    void SetSceneAntiAlias(SceneTarget *st, SceneAntiAlias antiAlias, ifast32 samples);
+
+    SceneAntiAlias GetSceneAntiAlias(const SceneTarget *st, ifast32 *samples);
+
+    /* Draws into scale * the size from now on, in (0, 1]. Cheap enough to
+       change every frame, nothing is reallocated. */
+    void SetSceneRenderScale(SceneTarget *st, f32 scale);
+    f32 GetSceneRenderScale(const SceneTarget *st);
+
+    /* "off", "fxaa" or "msaa<samples>" */
+    bool ParseSceneAntiAlias(const char *name, SceneAntiAlias *antiAlias, ifast32 *samples);
+
+    /* Binds the target for drawing with the viewport and scissor covering
+       the part drawn at the current scale */
+    void BeginSceneTarget(SceneTarget *st);
+
+    /* Resolves what was drawn into the window's framebuffer at x, y, w, h,
+       scaling it up if need be, and leaves that framebuffer bound with the
+       viewport on that rectangle and the scissor test off. The rest of the
+       window is cleared to black. */
+    void PresentSceneTarget(SceneTarget *st, ifast32 x, ifast32 y, ifast32 w, ifast32 h);
+
+    void DestroySceneTarget(SceneTarget *st);
+#ifdef __cplusplus
+}
+#endif
+#endif
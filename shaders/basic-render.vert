@@ -5,13 +5,17 @@ layout(location = 1) in vec3 aCol;
 uniform mat4 proj;
 uniform mat4 view;
 uniform mat4 model;
+/* Undoes the position quantization of packed vertex formats */
+uniform vec3 posScale;
+uniform vec3 posOffset;
 
 out vec3 FragPos;
 out vec3 FragCol;
 
 void main()
 {
-    gl_Position = proj * view * model * vec4(aPos, 1.0);
-    FragPos = aPos;
+    vec3 pos = aPos * posScale + posOffset;
+    gl_Position = proj * view * model * vec4(pos, 1.0);
+    FragPos = pos;
     FragCol = aCol;
 }
@@ -0,0 +1,52 @@
+#version 330 core
+
+in vec2 uv;
+
+uniform sampler2D scene;
+/* How much of scene was drawn into, from the bottom left */
+uniform vec2 uvScale;
+
+out vec4 FragColor;
+
+/* The console variant of FXAA: blurs along the edge direction found from
+   the four diagonal neighbours, and falls back to a shorter blur when the
+   longer one picks up something outside the local luma range */
+#define FXAA_REDUCE_MIN (1.0 / 128.0)
+#define FXAA_REDUCE_MUL (1.0 / 8.0)
+#define FXAA_SPAN_MAX 8.0
+
+float Luma(vec3 c)
+{
+    return dot(c, vec3(0.299, 0.587, 0.114));
+}
+
+vec3 Sample(vec2 at)
+{
+    /* Past the drawn corner is whatever a frame at a bigger scale left */
+    vec2 halfTexel = 0.5 / vec2(textureSize(scene, 0));
+    return texture(scene, min(at, uvScale - halfTexel)).rgb;
+}
+
+void main()
+{
+    vec2 texel = 1.0 / vec2(textureSize(scene, 0));
+    float lumaNW = Luma(Sample(uv + vec2(-1.0, -1.0) * texel));
+    float lumaNE = Luma(Sample(uv + vec2(1.0, -1.0) * texel));
+    float lumaSW = Luma(Sample(uv + vec2(-1.0, 1.0) * texel));
+    float lumaSE = Luma(Sample(uv + vec2(1.0, 1.0) * texel));
+    float lumaM = Luma(Sample(uv));
+    float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+    float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+
+    vec2 dir = vec2(-((lumaNW + lumaNE) - (lumaSW + lumaSE)), (lumaNW + lumaSW) - (lumaNE + lumaSE));
+    float dirReduce = max((lumaNW + lumaNE + lumaSW + lumaSE) * (0.25 * FXAA_REDUCE_MUL), FXAA_REDUCE_MIN);
+    float rcpDirMin = 1.0 / (min(abs(dir.x), abs(dir.y)) + dirReduce);
+    dir = clamp(dir * rcpDirMin, vec2(-FXAA_SPAN_MAX), vec2(FXAA_SPAN_MAX)) * texel;
+
+    vec3 a = 0.5 * (Sample(uv + dir * (1.0 / 3.0 - 0.5)) +
+                    Sample(uv + dir * (2.0 / 3.0 - 0.5)));
+    vec3 b = a * 0.5 + 0.25 * (Sample(uv - dir * 0.5) +
+                               Sample(uv + dir * 0.5));
+    float lumaB = Luma(b);
+    FragColor = vec4(lumaB < lumaMin || lumaB > lumaMax ? a : b, 1.0);
+}
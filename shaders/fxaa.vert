@@ -0,0 +1,14 @@
+#version 330 core
+
+uniform vec2 uvScale;
+
+out vec2 uv;
+
+void main()
+{
+    /* One triangle over the whole viewport, no vertex buffer needed */
+    vec2 pos = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    /* Only the corner the scene was drawn into at its render scale */
+    uv = pos * uvScale;
+    gl_Position = vec4(pos * 2.0 - 1.0, 0.0, 1.0);
+}
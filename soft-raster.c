@@ -0,0 +1,570 @@
+#include "soft-raster.h"
+#include "profile.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Vertices shaded per job */
+#define VERTEX_BATCH 1024
+
+/* E = A * x + B * y + C for each edge, positive on the inside. Edge i is
+   the one opposite vertex i, so E_i / area is vertex i's barycentric. */
+typedef struct SoftTriangle
+{
+    f32 edgeA[3];
+    f32 edgeB[3];
+    f32 edgeC[3];
+    /* Whether pixel centres exactly on the edge are this triangle's. Of
+       two triangles sharing an edge exactly one owns it, so shared edges
+       are neither drawn twice nor left out. */
+    bool ownsEdge[3];
+    f32 invArea;
+    f32 z[3];
+    f32 invW[3];
+    /* Divided by w, for perspective correct interpolation */
+    f32 varyings[3][SOFT_MAX_VARYINGS];
+    /* Inclusive pixel bounds, inside the framebuffer */
+    i32 minX;
+    i32 minY;
+    i32 maxX;
+    i32 maxY;
+} SoftTriangle;
+
+typedef struct SoftTile
+{
+    SoftRaster *raster;
+    i32 x;
+    i32 y;
+    /* Into the raster's triangles, in submission order */
+    u32 *triangles;
+    u32 count;
+    u32 capacity;
+} SoftTile;
+
+typedef struct SoftVertexJob
+{
+    const SoftDraw *draw;
+    SoftVertexOut *out;
+    u32 first;
+    u32 count;
+} SoftVertexJob;
+
+struct SoftRaster
+{
+    JobSystem *jobs;
+    ifast32 width;
+    ifast32 height;
+    ifast32 tilesX;
+    ifast32 tilesY;
+    /* Pixels from one row to the next, the width rounded up to whole
+       tiles so every row of a tile is there to write */
+    ifast32 stride;
+    u32 *color;
+    f32 *depth;
+    SoftTile *tiles;
+    SoftTriangle *triangles;
+    u32 triangleCount;
+    u32 triangleCapacity;
+    /* Triangles or tile bins the current draw couldn't grow room for */
+    u32 dropped;
+    /* The draw the tile jobs are rasterizing */
+    const SoftDraw *draw;
+};
+
+SoftBuffer *CreateSoftBuffer(const void *data, isize size)
+{
+    SoftBuffer *b = malloc(sizeof(*b));
+    if (!b)
+    {
+        return NULL;
+    }
+    b->size = size;
+    b->data = calloc(1, size ? size : 1);
+    if (!b->data)
+    {
+        free(b);
+        return NULL;
+    }
+    if (data)
+    {
+        memcpy(b->data, data, size);
+    }
+    return b;
+}
+
+void DestroySoftBuffer(SoftBuffer *b)
+{
+    if (!b)
+    {
+        return;
+    }
+    free(b->data);
+    free(b);
+}
+
+SoftRaster *CreateSoftRaster(ifast32 width, ifast32 height, JobSystem *jobs)
+{
+    if (width <= 0 || height <= 0)
+    {
+        return NULL;
+    }
+    SoftRaster *r = calloc(1, sizeof(*r));
+    if (!r)
+    {
+        return NULL;
+    }
+    r->jobs = jobs;
+    r->width = width;
+    r->height = height;
+    r->tilesX = (width + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE;
+    r->tilesY = (height + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE;
+    r->stride = r->tilesX * SOFT_TILE_SIZE;
+    isize pixels = (isize)r->stride * r->tilesY * SOFT_TILE_SIZE;
+    r->color = calloc(pixels, sizeof(*r->color));
+    r->depth = calloc(pixels, sizeof(*r->depth));
+    r->tiles = calloc(r->tilesX * r->tilesY, sizeof(*r->tiles));
+    if (!r->color || !r->depth || !r->tiles)
+    {
+        DestroySoftRaster(r);
+        return NULL;
+    }
+    for (ifast32 y = 0; y < r->tilesY; y++)
+    {
+        for (ifast32 x = 0; x < r->tilesX; x++)
+        {
+            SoftTile *t = &r->tiles[y * r->tilesX + x];
+            t->raster = r;
+            t->x = x * SOFT_TILE_SIZE;
+            t->y = y * SOFT_TILE_SIZE;
+        }
+    }
+    return r;
+}
+
+local u32 PackColor(f32 r, f32 g, f32 b, f32 a)
+{
+    f32 c[4] = {r, g, b, a};
+    u32 packed = 0;
+    for (ifast32 i = 0; i < 4; i++)
+    {
+        f32 v = c[i] < 0 ? 0 : c[i] > 1 ? 1 : c[i];
+        packed |= (u32)(v * 255 + .5f) << (i * 8);
+    }
+    return packed;
+}
+
+void ClearSoftRaster(SoftRaster *r, const f32 color[4], f32 depth)
+{
+    u32 packed = PackColor(color[0], color[1], color[2], color[3]);
+    isize pixels = (isize)r->stride * r->tilesY * SOFT_TILE_SIZE;
+    for (isize i = 0; i < pixels; i++)
+    {
+        r->color[i] = packed;
+        r->depth[i] = depth;
+    }
+}
+
+local void ShadeVertices(void *param)
+{
+    SoftVertexJob *job = param;
+    const SoftDraw *d = job->draw;
+    const u8 *vertices = (const u8 *)d->vertices->data + d->vertexOffset;
+    for (u32 i = 0; i < job->count; i++)
+    {
+        u32 v = job->first + i;
+        d->program->vertex(d->uniforms, vertices + (isize)v * d->stride, &job->out[v]);
+    }
+}
+
+local SoftVertexOut LerpVertex(const SoftVertexOut *a, const SoftVertexOut *b, f32 t,
+                               ifast32 varyingCount)
+{
+    SoftVertexOut v;
+    for (ifast32 i = 0; i < 4; i++)
+    {
+        v.position[i] = a->position[i] + (b->position[i] - a->position[i]) * t;
+    }
+    for (ifast32 i = 0; i < varyingCount; i++)
+    {
+        v.varyings[i] = a->varyings[i] + (b->varyings[i] - a->varyings[i]) * t;
+    }
+    return v;
+}
+
+local void BinTriangle(SoftRaster *r, const SoftVertexOut *v0, const SoftVertexOut *v1,
+                       const SoftVertexOut *v2, ifast32 varyingCount)
+{
+    const SoftVertexOut *v[3] = {v0, v1, v2};
+    f32 x[3], y[3];
+    SoftTriangle t;
+    for (ifast32 i = 0; i < 3; i++)
+    {
+        f32 invW = 1 / v[i]->position[3];
+        x[i] = (v[i]->position[0] * invW * .5f + .5f) * r->width;
+        /* Top row first */
+        y[i] = (.5f - v[i]->position[1] * invW * .5f) * r->height;
+        t.z[i] = v[i]->position[2] * invW * .5f + .5f;
+        t.invW[i] = invW;
+        for (ifast32 j = 0; j < varyingCount; j++)
+        {
+            t.varyings[i][j] = v[i]->varyings[j] * invW;
+        }
+    }
+
+    for (ifast32 i = 0; i < 3; i++)
+    {
+        ifast32 a = (i + 1) % 3;
+        ifast32 b = (i + 2) % 3;
+        t.edgeA[i] = y[a] - y[b];
+        t.edgeB[i] = x[b] - x[a];
+        t.edgeC[i] = x[a] * y[b] - x[b] * y[a];
+    }
+    f32 area = t.edgeA[0] * x[0] + t.edgeB[0] * y[0] + t.edgeC[0];
+    if (!(fabsf(area) > 0))
+    {
+        return;
+    }
+    /* Either winding is drawn, no culling */
+    if (area < 0)
+    {
+        area = -area;
+        for (ifast32 i = 0; i < 3; i++)
+        {
+            t.edgeA[i] = -t.edgeA[i];
+            t.edgeB[i] = -t.edgeB[i];
+            t.edgeC[i] = -t.edgeC[i];
+        }
+    }
+    for (ifast32 i = 0; i < 3; i++)
+    {
+        t.ownsEdge[i] = t.edgeA[i] > 0 || (t.edgeA[i] == 0 && t.edgeB[i] > 0);
+    }
+    t.invArea = 1 / area;
+
+    /* Pixels whose centres can be inside */
+    f32 minX = fminf(x[0], fminf(x[1], x[2]));
+    f32 maxX = fmaxf(x[0], fmaxf(x[1], x[2]));
+    f32 minY = fminf(y[0], fminf(y[1], y[2]));
+    f32 maxY = fmaxf(y[0], fmaxf(y[1], y[2]));
+    /* Clamped before converting, a vertex just past the near plane can
+       land further out than an i32 reaches */
+    f32 width = (f32)r->width;
+    f32 height = (f32)r->height;
+    t.minX = (i32)ceilf(fminf(fmaxf(minX, 0), width) - .5f);
+    t.minY = (i32)ceilf(fminf(fmaxf(minY, 0), height) - .5f);
+    t.maxX = (i32)floorf(fminf(fmaxf(maxX, 0), width) - .5f);
+    t.maxY = (i32)floorf(fminf(fmaxf(maxY, 0), height) - .5f);
+    if (t.minX > t.maxX || t.minY > t.maxY)
+    {
+        return;
+    }
+
+    if (r->triangleCount == r->triangleCapacity)
+    {
+        u32 capacity = r->triangleCapacity ? r->triangleCapacity * 2 : 1024;
+        SoftTriangle *triangles = realloc(r->triangles, (isize)capacity * sizeof(*triangles));
+        if (!triangles)
+        {
+            r->dropped++;
+            return;
+        }
+        r->triangles = triangles;
+        r->triangleCapacity = capacity;
+    }
+    u32 index = r->triangleCount++;
+    r->triangles[index] = t;
+
+    for (i32 ty = t.minY / SOFT_TILE_SIZE; ty <= t.maxY / SOFT_TILE_SIZE; ty++)
+    {
+        for (i32 tx = t.minX / SOFT_TILE_SIZE; tx <= t.maxX / SOFT_TILE_SIZE; tx++)
+        {
+            SoftTile *tile = &r->tiles[ty * r->tilesX + tx];
+            if (tile->count == tile->capacity)
+            {
+                u32 capacity = tile->capacity ? tile->capacity * 2 : 64;
+                u32 *triangles = realloc(tile->triangles, (isize)capacity * sizeof(*triangles));
+                if (!triangles)
+                {
+                    r->dropped++;
+                    continue;
+                }
+                tile->triangles = triangles;
+                tile->capacity = capacity;
+            }
+            tile->triangles[tile->count++] = index;
+        }
+    }
+}
+
+/* Clips against the near plane, the only one that has to be: everything
+   else just lands outside the pixel bounds. */
+local void ClipTriangle(SoftRaster *r, const SoftVertexOut *v0, const SoftVertexOut *v1,
+                        const SoftVertexOut *v2, ifast32 varyingCount)
+{
+    const SoftVertexOut *in[3] = {v0, v1, v2};
+    u32 outside[6] = {0};
+    for (ifast32 i = 0; i < 3; i++)
+    {
+        const f32 *p = in[i]->position;
+        outside[0] += p[0] > p[3];
+        outside[1] += p[0] < -p[3];
+        outside[2] += p[1] > p[3];
+        outside[3] += p[1] < -p[3];
+        outside[4] += p[2] > p[3];
+        outside[5] += p[2] < -p[3];
+    }
+    for (ifast32 i = 0; i < 6; i++)
+    {
+        if (outside[i] == 3)
+        {
+            return;
+        }
+    }
+    if (!outside[5])
+    {
+        BinTriangle(r, v0, v1, v2, varyingCount);
+        return;
+    }
+
+    SoftVertexOut clipped[4];
+    ifast32 count = 0;
+    for (ifast32 i = 0; i < 3; i++)
+    {
+        const SoftVertexOut *a = in[i];
+        const SoftVertexOut *b = in[(i + 1) % 3];
+        f32 da = a->position[2] + a->position[3];
+        f32 db = b->position[2] + b->position[3];
+        if (da >= 0)
+        {
+            clipped[count++] = *a;
+        }
+        if ((da >= 0) != (db >= 0))
+        {
+            clipped[count++] = LerpVertex(a, b, da / (da - db), varyingCount);
+        }
+    }
+    for (ifast32 i = 2; i < count; i++)
+    {
+        BinTriangle(r, &clipped[0], &clipped[i - 1], &clipped[i], varyingCount);
+    }
+}
+
+local bool AnyLane(SoftI32x4 m)
+{
+    return (m[0] | m[1] | m[2] | m[3]) != 0;
+}
+
+local void RasterTriangleInTile(SoftRaster *r, const SoftTile *tile, const SoftTriangle *t)
+{
+    const SoftProgram *program = r->draw->program;
+    const void *uniforms = r->draw->uniforms;
+    ifast32 varyingCount = program->varyingCount;
+
+    /* Groups of four start on multiples of four, tiles are too */
+    i32 x0 = (t->minX > tile->x ? t->minX : tile->x) & ~3;
+    i32 x1 = t->maxX < tile->x + SOFT_TILE_SIZE - 1 ? t->maxX : tile->x + SOFT_TILE_SIZE - 1;
+    i32 y0 = t->minY > tile->y ? t->minY : tile->y;
+    i32 y1 = t->maxY < tile->y + SOFT_TILE_SIZE - 1 ? t->maxY : tile->y + SOFT_TILE_SIZE - 1;
+
+    SoftI32x4 owns[3];
+    SoftF32x4 step[3];
+    for (ifast32 i = 0; i < 3; i++)
+    {
+        owns[i] = (SoftI32x4){0, 0, 0, 0} - (t->ownsEdge[i] ? 1 : 0);
+        step[i] = (SoftF32x4){4, 4, 4, 4} * t->edgeA[i];
+    }
+    SoftF32x4 startX = (SoftF32x4){.5f, 1.5f, 2.5f, 3.5f} + (f32)x0;
+
+    for (i32 y = y0; y <= y1; y++)
+    {
+        f32 py = y + .5f;
+        SoftF32x4 e[3];
+        for (ifast32 i = 0; i < 3; i++)
+        {
+            e[i] = startX * t->edgeA[i] + (t->edgeB[i] * py + t->edgeC[i]);
+        }
+        u32 *colorRow = r->color + (isize)y * r->stride;
+        f32 *depthRow = r->depth + (isize)y * r->stride;
+        for (i32 x = x0; x <= x1; x += 4)
+        {
+            SoftI32x4 inside = ((e[0] > 0) | ((e[0] == 0) & owns[0])) &
+                               ((e[1] > 0) | ((e[1] == 0) & owns[1])) &
+                               ((e[2] > 0) | ((e[2] == 0) & owns[2]));
+            if (AnyLane(inside))
+            {
+                SoftF32x4 l0 = e[0] * t->invArea;
+                SoftF32x4 l1 = e[1] * t->invArea;
+                SoftF32x4 l2 = e[2] * t->invArea;
+                SoftF32x4 z = l0 * t->z[0] + l1 * t->z[1] + l2 * t->z[2];
+                SoftF32x4 depth;
+                memcpy(&depth, depthRow + x, sizeof(depth));
+                inside &= z < depth;
+                if (AnyLane(inside))
+                {
+                    SoftF32x4 w = 1 / (l0 * t->invW[0] + l1 * t->invW[1] + l2 * t->invW[2]);
+                    SoftF32x4 varyings[SOFT_MAX_VARYINGS];
+                    for (ifast32 i = 0; i < varyingCount; i++)
+                    {
+                        varyings[i] = (l0 * t->varyings[0][i] + l1 * t->varyings[1][i] +
+                                       l2 * t->varyings[2][i]) *
+                                      w;
+                    }
+                    SoftF32x4 color[4];
+                    program->fragment(uniforms, varyings, color);
+                    for (ifast32 lane = 0; lane < 4; lane++)
+                    {
+                        if (inside[lane])
+                        {
+                            colorRow[x + lane] = PackColor(color[0][lane], color[1][lane],
+                                                           color[2][lane], color[3][lane]);
+                            depthRow[x + lane] = z[lane];
+                        }
+                    }
+                }
+            }
+            for (ifast32 i = 0; i < 3; i++)
+            {
+                e[i] += step[i];
+            }
+        }
+    }
+}
+
+local void RasterTile(void *param)
+{
+    SoftTile *tile = param;
+    PROFILE_SCOPE("Raster tile");
+    for (u32 i = 0; i < tile->count; i++)
+    {
+        RasterTriangleInTile(tile->raster, tile, &tile->raster->triangles[tile->triangles[i]]);
+    }
+    tile->count = 0;
+}
+
+void DrawSoftTriangles(SoftRaster *r, const SoftDraw *d)
+{
+    PROFILE_SCOPE("DrawSoftTriangles");
+    if (d->stride == 0 || d->vertices->size <= d->vertexOffset ||
+        d->program->varyingCount > SOFT_MAX_VARYINGS)
+    {
+        return;
+    }
+    /* Indices can't reach past the first 2^32 anyway */
+    isize available = (d->vertices->size - d->vertexOffset) / d->stride;
+    u32 vertexCount = available > 0xffffffff ? 0xffffffff : (u32)available;
+    u32 indexCount = d->indexCount;
+    if (d->indexOffset + (isize)indexCount * d->indexSize > d->indices->size)
+    {
+        indexCount = d->indices->size > d->indexOffset
+                         ? (d->indices->size - d->indexOffset) / d->indexSize
+                         : 0;
+    }
+    if (!vertexCount || indexCount < 3)
+    {
+        return;
+    }
+
+    SoftVertexOut *shaded = malloc((isize)vertexCount * sizeof(*shaded));
+    u32 jobCount = (vertexCount + VERTEX_BATCH - 1) / VERTEX_BATCH;
+    SoftVertexJob *vertexJobs = malloc((isize)jobCount * sizeof(*vertexJobs));
+    if (!shaded || !vertexJobs)
+    {
+        free(shaded);
+        free(vertexJobs);
+        return;
+    }
+    {
+        PROFILE_SCOPE("Shade vertices");
+        JobCounter counter = {0};
+        for (u32 i = 0; i < jobCount; i++)
+        {
+            u32 first = i * VERTEX_BATCH;
+            u32 count = vertexCount - first < VERTEX_BATCH ? vertexCount - first : VERTEX_BATCH;
+            vertexJobs[i] = (SoftVertexJob){d, shaded, first, count};
+            RunJob(r->jobs, &counter, ShadeVertices, &vertexJobs[i]);
+        }
+        WaitJobs(r->jobs, &counter);
+    }
+
+    {
+        PROFILE_SCOPE("Bin triangles");
+        const u8 *indices = (const u8 *)d->indices->data + d->indexOffset;
+        r->triangleCount = 0;
+        r->dropped = 0;
+        for (u32 i = 0; i + 2 < indexCount; i += 3)
+        {
+            u32 v[3];
+            for (ifast32 j = 0; j < 3; j++)
+            {
+                if (d->indexSize == 2)
+                {
+                    u16 index;
+                    memcpy(&index, indices + (isize)(i + j) * 2, 2);
+                    v[j] = index;
+                }
+                else
+                {
+                    memcpy(&v[j], indices + (isize)(i + j) * 4, 4);
+                }
+            }
+            if (v[0] < vertexCount && v[1] < vertexCount && v[2] < vertexCount)
+            {
+                ClipTriangle(r, &shaded[v[0]], &shaded[v[1]], &shaded[v[2]],
+                             d->program->varyingCount);
+            }
+        }
+        if (r->dropped)
+        {
+            fprintf(stderr, "SOFT: out of memory, left %u triangles or parts of them out\n",
+                    (unsigned)r->dropped);
+        }
+    }
+
+    {
+        PROFILE_SCOPE("Rasterize");
+        r->draw = d;
+        JobCounter counter = {0};
+        for (ifast32 i = 0; i < r->tilesX * r->tilesY; i++)
+        {
+            if (r->tiles[i].count)
+            {
+                RunJob(r->jobs, &counter, RasterTile, &r->tiles[i]);
+            }
+        }
+        WaitJobs(r->jobs, &counter);
+        r->draw = NULL;
+    }
+    free(vertexJobs);
+    free(shaded);
+}
+
+const u32 *GetSoftRasterPixels(const SoftRaster *r)
+{
+    return r->color;
+}
+
+isize GetSoftRasterPitch(const SoftRaster *r)
+{
+    return r->stride * sizeof(*r->color);
+}
+
+void DestroySoftRaster(SoftRaster *r)
+{
+    if (!r)
+    {
+        return;
+    }
+    if (r->tiles)
+    {
+        for (ifast32 i = 0; i < r->tilesX * r->tilesY; i++)
+        {
+            free(r->tiles[i].triangles);
+        }
+    }
+    free(r->tiles);
+    free(r->triangles);
+    free(r->color);
+    free(r->depth);
+    free(r);
+}
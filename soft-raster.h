@@ -0,0 +1,99 @@
+#ifndef SOFT_RASTER_H
+#define SOFT_RASTER_H
+#include "jobs.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Triangle rasterizer on the CPU, for machines without a GPU or a GL
+       driver worth loading. Same shape as the GL path: buffers of
+       vertices and indices, a program of a vertex and a fragment shader
+       (C functions here), uniforms, and indexed draws into a colour and a
+       depth buffer with GL's conventions (clip space in, depth test LESS,
+       no culling).
+
+       The framebuffer is split into SOFT_TILE_SIZE square tiles. A draw
+       shades its vertices in parallel, bins the triangles into the tiles
+       they touch and then rasterizes every tile as its own job, so no two
+       threads ever write the same pixel. Pixels are shaded four at a time
+       in a row.
+
+       It's an API of its own, not a backend behind rgl: the engine and
+       the game library only draw through GL, and softrender is the one
+       program that uses it. */
+
+    typedef f32 SoftF32x4 __attribute__((vector_size(16)));
+    typedef i32 SoftI32x4 __attribute__((vector_size(16)));
+
+#define SOFT_TILE_SIZE 64
+#define SOFT_MAX_VARYINGS 8
+
+    typedef struct SoftVertexOut
+    {
+        /* Clip space, gl_Position */
+        f32 position[4];
+        f32 varyings[SOFT_MAX_VARYINGS];
+    } SoftVertexOut;
+
+    /* vertex points at the vertex in the vertex buffer */
+    typedef void SoftVertexShader(const void *uniforms, const void *vertex, SoftVertexOut *out);
+
+    /* Shades four pixels side by side, varyings[i] is the i'th varying of
+       each. color gets r, g, b, a in [0, 1]. */
+    typedef void SoftFragmentShader(const void *uniforms, const SoftF32x4 *varyings,
+                                    SoftF32x4 color[4]);
+
+    typedef struct SoftProgram
+    {
+        SoftVertexShader *vertex;
+        SoftFragmentShader *fragment;
+        /* How many of SoftVertexOut's varyings are interpolated */
+        ifast32 varyingCount;
+    } SoftProgram;
+
+    typedef struct SoftBuffer
+    {
+        void *data;
+        isize size;
+    } SoftBuffer;
+
+    /* Copies size bytes of data, which may be NULL to leave them zeroed */
+    SoftBuffer *CreateSoftBuffer(const void *data, isize size);
+    void DestroySoftBuffer(SoftBuffer *b);
+
+    typedef struct SoftDraw
+    {
+        const SoftProgram *program;
+        const void *uniforms;
+        const SoftBuffer *vertices;
+        isize vertexOffset;
+        u32 stride;
+        const SoftBuffer *indices;
+        isize indexOffset;
+        /* 2 or 4 bytes */
+        u32 indexSize;
+        u32 indexCount;
+    } SoftDraw;
+
+    typedef struct SoftRaster SoftRaster;
+
+    /* jobs may be NULL to do everything on the calling thread */
+    SoftRaster *CreateSoftRaster(ifast32 width, ifast32 height, JobSystem *jobs);
+
+    void ClearSoftRaster(SoftRaster *r, const f32 color[4], f32 depth);
+
+    /* Returns once the draw is in the colour and depth buffers */
+    void DrawSoftTriangles(SoftRaster *r, const SoftDraw *draw);
+
+    /* RGBA8, top row first, GetSoftRasterPitch bytes from one row to the
+       next */
+    const u32 *GetSoftRasterPixels(const SoftRaster *r);
+    isize GetSoftRasterPitch(const SoftRaster *r);
+
+    void DestroySoftRaster(SoftRaster *r);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,232 @@
+#include "jobs.h"
+#include "mesh.h"
+#include "profile.h"
+#include "rutils/def.h"
+#include "rutils/math.h"
+#include "soft-raster.h"
+#include <SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The spinning quads on the software rasterizer, no GL anywhere:
+
+       softrender [--size WxH] [--frames N] [--out image.ppm]
+
+   Shows them in a window through SDL's software renderer, or with
+   --frames renders that many frames of the animation without a window as
+   fast as it can and reports the time each took. --out writes the last
+   frame out. */
+
+#define WIDTH 1280
+#define HEIGHT 720
+
+local const Vertex vertices[] = {
+    {{.5, .5, .5}, {1, 0, 0}},
+    {{-.5, .5, .5}, {0, 1, 0}},
+    {{.5, -.5, .5}, {0, 0, 1}},
+    {{-.5, -.5, .5}, {1, 1, 1}},
+    {{.5, .5, 0}, {1, 0, 0}},
+    {{-.5, .5, 0}, {0, 1, 0}},
+    {{.5, -.5, 0}, {0, 0, 1}},
+    {{-.5, -.5, 0}, {1, 1, 1}}};
+
+local const u16 indices[] = {
+    0, 1, 2, 2, 1, 3,
+    4, 5, 6, 6, 5, 7};
+
+/* shaders/basic-render.vert and .frag's uniforms */
+typedef struct BasicRenderUniforms
+{
+    Mat4f proj;
+    Mat4f view;
+    Mat4f model;
+    f32 posScale[3];
+    f32 posOffset[3];
+} BasicRenderUniforms;
+
+/* Column major, as glUniformMatrix4fv gets it */
+local void TransformPoint(const Mat4f *m, const f32 in[4], f32 out[4])
+{
+    const f32 *e = (const f32 *)m;
+    for (ifast32 row = 0; row < 4; row++)
+    {
+        out[row] = e[row] * in[0] + e[4 + row] * in[1] + e[8 + row] * in[2] + e[12 + row] * in[3];
+    }
+}
+
+/* shaders/basic-render.vert */
+local void BasicRenderVertex(const void *uniforms, const void *vertex, SoftVertexOut *out)
+{
+    const BasicRenderUniforms *u = uniforms;
+    /* aPos and aCol, three floats each as the GL path binds Vertex */
+    const f32 *in = vertex;
+    f32 pos[4] = {in[0] * u->posScale[0] + u->posOffset[0], in[1] * u->posScale[1] + u->posOffset[1],
+                  in[2] * u->posScale[2] + u->posOffset[2], 1};
+    f32 world[4], eye[4];
+    TransformPoint(&u->model, pos, world);
+    TransformPoint(&u->view, world, eye);
+    TransformPoint(&u->proj, eye, out->position);
+    /* FragPos, FragCol */
+    memcpy(&out->varyings[0], pos, 3 * sizeof(f32));
+    memcpy(&out->varyings[3], in + 3, 3 * sizeof(f32));
+}
+
+/* shaders/basic-render.frag */
+local void BasicRenderFragment(const void *uniforms, const SoftF32x4 *varyings, SoftF32x4 color[4])
+{
+    ignore uniforms;
+    color[0] = varyings[3];
+    color[1] = varyings[4];
+    color[2] = varyings[5];
+    color[3] = (SoftF32x4){1, 1, 1, 1};
+}
+
+local const SoftProgram basicRender = {BasicRenderVertex, BasicRenderFragment, 6};
+
+local bool WritePPM(const char *path, const SoftRaster *r, ifast32 width, ifast32 height)
+{
+    FILE *out = fopen(path, "wb");
+    if (!out)
+    {
+        return false;
+    }
+    fprintf(out, "P6\n%d %d\n255\n", (int)width, (int)height);
+    const u8 *pixels = (const u8 *)GetSoftRasterPixels(r);
+    isize pitch = GetSoftRasterPitch(r);
+    for (ifast32 y = 0; y < height; y++)
+    {
+        for (ifast32 x = 0; x < width; x++)
+        {
+            fwrite(pixels + y * pitch + x * 4, 3, 1, out);
+        }
+    }
+    return fclose(out) == 0;
+}
+
+local void RenderFrame(SoftRaster *r, BasicRenderUniforms *u, const SoftDraw *draw, f32 time)
+{
+    PROFILE_SCOPE("Frame");
+    u->model = RotateMat4f(&IdMat4f, time * DegToRad(90), vec3f(0, 0, 1));
+    local const f32 clearColor[4] = {.1, .1, .1, 1};
+    ClearSoftRaster(r, clearColor, 1);
+    DrawSoftTriangles(r, draw);
+}
+
+int main(int argc, char **argv)
+{
+    ifast32 width = WIDTH;
+    ifast32 height = HEIGHT;
+    ifast32 frames = 0;
+    const char *outPath = NULL;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+        {
+            int w, h;
+            if (sscanf(argv[++i], "%dx%d", &w, &h) == 2 && w > 0 && h > 0)
+            {
+                width = w;
+                height = h;
+            }
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            frames = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+        {
+            outPath = argv[++i];
+        }
+    }
+
+    PROFILE_INIT();
+    JobSystem *jobs = CreateJobSystem(0);
+    SoftRaster *r = CreateSoftRaster(width, height, jobs);
+    SoftBuffer *vertexBuffer = CreateSoftBuffer(vertices, sizeof(vertices));
+    SoftBuffer *indexBuffer = CreateSoftBuffer(indices, sizeof(indices));
+    if (!r || !vertexBuffer || !indexBuffer)
+    {
+        fputs("Could not create the framebuffer\n", stderr);
+        return 1;
+    }
+
+    BasicRenderUniforms uniforms = {0};
+    uniforms.proj = CreatePerspectiveMat4f(DegToRad(45), (f32)width / height, .1, 10);
+    uniforms.view = CalcLookAtMat4f(vec3f(2, 2, 2), vec3f(0, 0, 0), vec3f(0, 0, 1));
+    memcpy(uniforms.posScale, (f32[3]){1, 1, 1}, sizeof(uniforms.posScale));
+    SoftDraw draw = {&basicRender, &uniforms, vertexBuffer, 0, sizeof(Vertex),
+                     indexBuffer, 0, sizeof(*indices), countof(indices)};
+
+    u64 frequency = SDL_GetPerformanceFrequency();
+    f64 totalMs = 0;
+    f64 worstMs = 0;
+    ifast32 rendered = 0;
+    if (frames > 0)
+    {
+        for (; rendered < frames; rendered++)
+        {
+            u64 start = SDL_GetPerformanceCounter();
+            RenderFrame(r, &uniforms, &draw, rendered / 60.f);
+            f64 ms = (f64)(SDL_GetPerformanceCounter() - start) * 1000 / frequency;
+            totalMs += ms;
+            worstMs = ms > worstMs ? ms : worstMs;
+            PROFILE_COLLECT();
+        }
+    }
+    else
+    {
+        SDL_Init(SDL_INIT_VIDEO);
+        SDL_Window *win = SDL_CreateWindow("Software", 0, 0, width, height, SDL_WINDOW_SHOWN);
+        SDL_Renderer *renderer = SDL_CreateRenderer(win, -1, SDL_RENDERER_SOFTWARE);
+        SDL_Texture *texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
+                                                 SDL_TEXTUREACCESS_STREAMING, width, height);
+        if (!texture)
+        {
+            fprintf(stderr, "Could not create a window: %s\n", SDL_GetError());
+            return 1;
+        }
+        u64 begin = SDL_GetPerformanceCounter();
+        for (bool running = true; running; rendered++)
+        {
+            SDL_Event e;
+            while (SDL_PollEvent(&e))
+            {
+                if (e.type == SDL_QUIT ||
+                    (e.type == SDL_KEYDOWN && e.key.keysym.scancode == SDL_SCANCODE_ESCAPE))
+                {
+                    running = false;
+                }
+            }
+            u64 start = SDL_GetPerformanceCounter();
+            RenderFrame(r, &uniforms, &draw, (f32)(start - begin) / frequency);
+            f64 ms = (f64)(SDL_GetPerformanceCounter() - start) * 1000 / frequency;
+            totalMs += ms;
+            worstMs = ms > worstMs ? ms : worstMs;
+            PROFILE_COLLECT();
+
+            SDL_UpdateTexture(texture, NULL, GetSoftRasterPixels(r), GetSoftRasterPitch(r));
+            SDL_RenderCopy(renderer, texture, NULL, NULL);
+            SDL_RenderPresent(renderer);
+        }
+        SDL_DestroyTexture(texture);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(win);
+        SDL_Quit();
+    }
+
+    printf("%dx%d on %d threads: %d frames, %.3fms average, %.3fms worst\n", (int)width,
+           (int)height, (int)GetJobThreadCount(jobs) + 1, (int)rendered,
+           totalMs / (rendered ? rendered : 1), worstMs);
+    if (outPath && !WritePPM(outPath, r, width, height))
+    {
+        fprintf(stderr, "Could not write %s\n", outPath);
+    }
+
+    DestroySoftBuffer(vertexBuffer);
+    DestroySoftBuffer(indexBuffer);
+    DestroySoftRaster(r);
+    DestroyJobSystem(jobs);
+    PROFILE_WRITE_TRACE("soft-trace.json");
+    return 0;
+}
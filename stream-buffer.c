@@ -0,0 +1,131 @@
+#include "stream-buffer.h"
+#include "glad.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Regions start on this boundary so any allocation can be bound as a
+   uniform or shader storage range */
+#define STREAM_REGION_ALIGNMENT 256
+
+struct StreamBuffer
+{
+    GLuint buffer;
+    u8 *mapped;
+    isize regionSize;
+    ifast32 regionCount;
+    ifast32 region;
+    /* Next free byte in the current region */
+    isize head;
+    /* One per region, signaled once the GPU is done with it */
+    GLsync *fences;
+    StreamBufferStats stats;
+    /* The thread that created it, the only one allowed to move head */
+    pthread_t owner;
+};
+
+StreamBuffer *CreateStreamBuffer(isize frameSize, ifast32 frameCount, const char *label)
+{
+    StreamBuffer *sb = calloc(1, sizeof(*sb));
+    if (!sb)
+    {
+        return NULL;
+    }
+    sb->owner = pthread_self();
+    sb->regionCount = frameCount > 0 ? frameCount : 3;
+    sb->regionSize = (frameSize + STREAM_REGION_ALIGNMENT - 1) & ~(isize)(STREAM_REGION_ALIGNMENT - 1);
+    sb->fences = calloc(sb->regionCount, sizeof(*sb->fences));
+
+    isize size = sb->regionSize * sb->regionCount;
+    GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &sb->buffer);
+    glNamedBufferStorage(sb->buffer, size, NULL, access);
+    sb->mapped = glMapNamedBufferRange(sb->buffer, 0, size, access);
+    if (label)
+    {
+        glObjectLabel(GL_BUFFER, sb->buffer, -1, label);
+    }
+    if (!sb->mapped || !sb->fences)
+    {
+        fprintf(stderr, "STREAM: could not map %lld bytes\n", (long long)size);
+        DestroyStreamBuffer(sb);
+        return NULL;
+    }
+    return sb;
+}
+
+GLuint GetStreamBufferObject(const StreamBuffer *sb)
+{
+    return sb->buffer;
+}
+
+void *AllocStreamBuffer(StreamBuffer *sb, isize size, isize alignment, isize *offset)
+{
+    assert(pthread_equal(sb->owner, pthread_self()));
+    isize start = (sb->head + alignment - 1) & ~(alignment - 1);
+    if (start + size > sb->regionSize)
+    {
+        sb->stats.overflows++;
+        return NULL;
+    }
+    sb->head = start + size;
+    sb->stats.bytesAllocated += size;
+
+    isize at = sb->region * sb->regionSize + start;
+    if (offset)
+    {
+        *offset = at;
+    }
+    return sb->mapped + at;
+}
+
+void EndStreamBufferFrame(StreamBuffer *sb)
+{
+    assert(pthread_equal(sb->owner, pthread_self()));
+    sb->fences[sb->region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    sb->region = (sb->region + 1) % sb->regionCount;
+
+    GLsync fence = sb->fences[sb->region];
+    if (fence)
+    {
+        if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+        {
+            sb->stats.fenceWaits++;
+            while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000 * 1000 * 1000) ==
+                   GL_TIMEOUT_EXPIRED)
+            {
+            }
+        }
+        glDeleteSync(fence);
+        sb->fences[sb->region] = NULL;
+    }
+    sb->head = 0;
+}
+
+StreamBufferStats GetStreamBufferStats(const StreamBuffer *sb)
+{
+    return sb->stats;
+}
+
+void DestroyStreamBuffer(StreamBuffer *sb)
+{
+    for (ifast32 i = 0; sb->fences && i < sb->regionCount; i++)
+    {
+        if (sb->fences[i])
+        {
+            while (glClientWaitSync(sb->fences[i], GL_SYNC_FLUSH_COMMANDS_BIT,
+                                    1000 * 1000 * 1000) == GL_TIMEOUT_EXPIRED)
+            {
+            }
+            glDeleteSync(sb->fences[i]);
+        }
+    }
+    if (sb->mapped)
+    {
+        glUnmapNamedBuffer(sb->buffer);
+    }
+    glDeleteBuffers(1, &sb->buffer);
+    free(sb->fences);
+    free(sb);
+}
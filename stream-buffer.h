@@ -0,0 +1,58 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+#include "glad.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* A persistently mapped buffer split into one region per frame in
+       flight, for geometry rebuilt every frame (debug lines, particles,
+       UI). Writers append into the current frame's region; a fence per
+       region keeps the CPU from overwriting data the GPU hasn't read yet,
+       so there's never any orphaning or implicit sync in the driver.
+
+       Single writer: allocating and ending frames is done by the thread
+       that created the buffer, the GL thread, and asserted in debug
+       builds. head isn't atomic, two threads allocating at once would be
+       handed the same bytes. */
+
+    typedef struct StreamBufferStats
+    {
+        u64 bytesAllocated;
+        /* Allocations that didn't fit in what was left of the region */
+        u64 overflows;
+        /* Times EndStreamBufferFrame had to wait for the GPU to finish with
+           the region it was about to reuse */
+        u64 fenceWaits;
+    } StreamBufferStats;
+
+    typedef struct StreamBuffer StreamBuffer;
+
+    /* frameSize bytes per region, frameCount regions (3 if <= 0) */
+    StreamBuffer *CreateStreamBuffer(isize frameSize, ifast32 frameCount, const char *label);
+
+    GLuint GetStreamBufferObject(const StreamBuffer *sb);
+
+    /* Reserves size bytes aligned to alignment (a power of two) in the
+       current region. Returns where to write, and through offset where
+       that is in the buffer object, or NULL if the region is full. Creating
+       thread only, like EndStreamBufferFrame which moves the region
+       underneath it. Other threads can fill what it returns before the
+       frame ends. */
+    void *AllocStreamBuffer(StreamBuffer *sb, isize size, isize alignment, isize *offset);
+
+    /* Call once a frame after the last draw reading this frame's region
+       and after every writer is done with it */
+    void EndStreamBufferFrame(StreamBuffer *sb);
+
+    StreamBufferStats GetStreamBufferStats(const StreamBuffer *sb);
+
+    /* Waits for the GPU to be done with every region, then frees
+       everything */
+    void DestroyStreamBuffer(StreamBuffer *sb);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,696 @@
+#include "texture.h"
+#include "glad.h"
+#include "stream-buffer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* S3TC never made it into core, so glad doesn't know these */
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+#ifndef GL_TEXTURE_MAX_ANISOTROPY
+#define GL_TEXTURE_MAX_ANISOTROPY 0x84FE
+#define GL_MAX_TEXTURE_MAX_ANISOTROPY 0x84FF
+#endif
+
+#define STAGING_ALIGNMENT 16
+#define SAMPLER_CACHE_SIZE 64
+/* Past what any GL allows, and small enough that sizes can't overflow */
+#define TEXTURE_MAX_SIZE (1u << 16)
+
+typedef enum TextureRequirement
+{
+    REQUIRE_NOTHING,
+    REQUIRE_S3TC,
+    REQUIRE_RGTC,
+    REQUIRE_BPTC,
+} TextureRequirement;
+
+typedef struct TextureFormatInfo
+{
+    GLenum internalFormat;
+    /* Uncompressed only */
+    GLenum format;
+    GLenum type;
+    /* Bytes per pixel, or per 4x4 block when compressed */
+    u32 bytes;
+    bool compressed;
+    TextureRequirement requirement;
+    /* What the CPU decoder produces, itself if there's no decoder */
+    TextureFormat fallback;
+} TextureFormatInfo;
+
+local const TextureFormatInfo formats[TEXTURE_FORMAT_COUNT] = {
+    [TEXTURE_FORMAT_RGBA8] = {GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4, false, REQUIRE_NOTHING,
+                              TEXTURE_FORMAT_RGBA8},
+    [TEXTURE_FORMAT_SRGB8_ALPHA8] = {GL_SRGB8_ALPHA8, GL_RGBA, GL_UNSIGNED_BYTE, 4, false,
+                                     REQUIRE_NOTHING, TEXTURE_FORMAT_SRGB8_ALPHA8},
+    [TEXTURE_FORMAT_R8] = {GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1, false, REQUIRE_NOTHING,
+                           TEXTURE_FORMAT_R8},
+    [TEXTURE_FORMAT_RG8] = {GL_RG8, GL_RG, GL_UNSIGNED_BYTE, 2, false, REQUIRE_NOTHING,
+                            TEXTURE_FORMAT_RG8},
+    [TEXTURE_FORMAT_BC1] = {GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 0, 0, 8, true, REQUIRE_S3TC,
+                            TEXTURE_FORMAT_RGBA8},
+    [TEXTURE_FORMAT_BC1_SRGB] = {GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 0, 0, 8, true,
+                                 REQUIRE_S3TC, TEXTURE_FORMAT_SRGB8_ALPHA8},
+    [TEXTURE_FORMAT_BC3] = {GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 0, 0, 16, true, REQUIRE_S3TC,
+                            TEXTURE_FORMAT_RGBA8},
+    [TEXTURE_FORMAT_BC3_SRGB] = {GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 0, 0, 16, true,
+                                 REQUIRE_S3TC, TEXTURE_FORMAT_SRGB8_ALPHA8},
+    [TEXTURE_FORMAT_BC4] = {GL_COMPRESSED_RED_RGTC1, 0, 0, 8, true, REQUIRE_RGTC,
+                            TEXTURE_FORMAT_R8},
+    [TEXTURE_FORMAT_BC5] = {GL_COMPRESSED_RG_RGTC2, 0, 0, 16, true, REQUIRE_RGTC,
+                            TEXTURE_FORMAT_RG8},
+    [TEXTURE_FORMAT_BC7] = {GL_COMPRESSED_RGBA_BPTC_UNORM, 0, 0, 16, true, REQUIRE_BPTC,
+                            TEXTURE_FORMAT_BC7},
+    [TEXTURE_FORMAT_BC7_SRGB] = {GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 0, 0, 16, true,
+                                 REQUIRE_BPTC, TEXTURE_FORMAT_BC7_SRGB},
+};
+
+typedef struct TextureUpload
+{
+    GLuint texture;
+    TextureFormat format;
+    u32 width;
+    u32 height;
+    u32 levels;
+    bool generateMips;
+    /* Where the next upload picks up: a level and a row (a row of blocks
+       when compressed) within it */
+    u32 level;
+    u32 row;
+    u64 levelOffset;
+    /* Either the data, or a compressed pack entry's stored bytes decoded
+       straight into staging a piece at a time */
+    const u8 *data;
+    const u8 *stored;
+    const PackEntry *entry;
+    /* Set when the data was decoded on the CPU, owned by the upload */
+    u8 *decoded;
+    struct TextureUpload *next;
+} TextureUpload;
+
+struct TextureUploader
+{
+    StreamBuffer *staging;
+    /* Per frame, a row has to fit in it */
+    isize stagingSize;
+    JobSystem *jobs;
+    TextureUpload *head;
+    TextureUpload *tail;
+    TextureUploadStats stats;
+};
+
+typedef struct SamplerCacheEntry
+{
+    SamplerDesc desc;
+    GLuint sampler;
+} SamplerCacheEntry;
+
+local SamplerCacheEntry samplers[SAMPLER_CACHE_SIZE];
+local ifast32 samplerCount;
+
+bool IsTextureFormatSupported(TextureFormat format)
+{
+    switch (formats[format].requirement)
+    {
+    case REQUIRE_NOTHING:
+    {
+        return true;
+    }
+    case REQUIRE_S3TC:
+    {
+        return gladHasExtension("GL_EXT_texture_compression_s3tc");
+    }
+    case REQUIRE_RGTC:
+    {
+        return GLAD_GL_VERSION_3_0 || gladHasExtension("GL_ARB_texture_compression_rgtc");
+    }
+    case REQUIRE_BPTC:
+    {
+        return GLAD_GL_VERSION_4_2 || gladHasExtension("GL_ARB_texture_compression_bptc");
+    }
+    }
+    return false;
+}
+
+/* Bytes in one row of pixels, or one row of blocks */
+local isize RowBytes(TextureFormat format, u32 width)
+{
+    const TextureFormatInfo *info = &formats[format];
+    if (info->compressed)
+    {
+        return (isize)((width + 3) / 4) * info->bytes;
+    }
+    return ((isize)width * info->bytes + 3) & ~(isize)3;
+}
+
+local u32 RowCount(TextureFormat format, u32 height)
+{
+    return formats[format].compressed ? (height + 3) / 4 : height;
+}
+
+local u32 LevelSize(u32 size, u32 level)
+{
+    size >>= level;
+    return size ? size : 1;
+}
+
+local isize TextureDataSize(TextureFormat format, u32 width, u32 height, u32 levels)
+{
+    isize size = 0;
+    for (u32 level = 0; level < levels; level++)
+    {
+        size += RowBytes(format, LevelSize(width, level)) *
+                RowCount(format, LevelSize(height, level));
+    }
+    return size;
+}
+
+/* BC decoding for GL without S3TC or RGTC. Every block is decoded into a
+   4x4 texel tile and clipped against the level's edges. */
+
+local void DecodeBC4Block(const u8 *block, u8 out[16])
+{
+    u8 values[8] = {block[0], block[1]};
+    if (values[0] > values[1])
+    {
+        for (ifast32 i = 1; i < 7; i++)
+        {
+            values[i + 1] = (u8)(((7 - i) * values[0] + i * values[1]) / 7);
+        }
+    }
+    else
+    {
+        for (ifast32 i = 1; i < 5; i++)
+        {
+            values[i + 1] = (u8)(((5 - i) * values[0] + i * values[1]) / 5);
+        }
+        values[6] = 0;
+        values[7] = 255;
+    }
+    u64 bits = 0;
+    for (ifast32 i = 0; i < 6; i++)
+    {
+        bits |= (u64)block[2 + i] << (i * 8);
+    }
+    for (ifast32 i = 0; i < 16; i++)
+    {
+        out[i] = values[(bits >> (i * 3)) & 7];
+    }
+}
+
+local void Expand565(u16 c, u8 rgb[3])
+{
+    u32 r = (c >> 11) & 31;
+    u32 g = (c >> 5) & 63;
+    u32 b = c & 31;
+    rgb[0] = (u8)((r << 3) | (r >> 2));
+    rgb[1] = (u8)((g << 2) | (g >> 4));
+    rgb[2] = (u8)((b << 3) | (b >> 2));
+}
+
+/* RGBA out. The color half of a BC3 block always uses four colors. */
+local void DecodeBC1Block(const u8 *block, u8 out[16][4], bool alwaysFourColors)
+{
+    u16 c0 = (u16)(block[0] | block[1] << 8);
+    u16 c1 = (u16)(block[2] | block[3] << 8);
+    u8 palette[4][4];
+    Expand565(c0, palette[0]);
+    Expand565(c1, palette[1]);
+    for (ifast32 k = 0; k < 4; k++)
+    {
+        palette[k][3] = 255;
+    }
+    for (ifast32 k = 0; k < 3; k++)
+    {
+        if (c0 > c1 || alwaysFourColors)
+        {
+            palette[2][k] = (u8)((2 * palette[0][k] + palette[1][k]) / 3);
+            palette[3][k] = (u8)((palette[0][k] + 2 * palette[1][k]) / 3);
+        }
+        else
+        {
+            palette[2][k] = (u8)((palette[0][k] + palette[1][k]) / 2);
+            palette[3][k] = 0;
+        }
+    }
+    if (!(c0 > c1 || alwaysFourColors))
+    {
+        palette[3][3] = 0;
+    }
+    u32 bits = (u32)block[4] | (u32)block[5] << 8 | (u32)block[6] << 16 | (u32)block[7] << 24;
+    for (ifast32 i = 0; i < 16; i++)
+    {
+        memcpy(out[i], palette[(bits >> (i * 2)) & 3], 4);
+    }
+}
+
+/* Decodes one level into the fallback format's layout */
+local void DecodeLevel(TextureFormat format, const u8 *src, u32 width, u32 height, u8 *dst)
+{
+    TextureFormat fallback = formats[format].fallback;
+    u32 channels = formats[fallback].bytes;
+    isize pitch = RowBytes(fallback, width);
+    u32 blocksWide = (width + 3) / 4;
+    u32 blocksHigh = (height + 3) / 4;
+    for (u32 by = 0; by < blocksHigh; by++)
+    {
+        for (u32 bx = 0; bx < blocksWide; bx++, src += formats[format].bytes)
+        {
+            u8 texels[16][4] = {{0}};
+            switch (format)
+            {
+            case TEXTURE_FORMAT_BC1:
+            case TEXTURE_FORMAT_BC1_SRGB:
+            {
+                DecodeBC1Block(src, texels, false);
+                break;
+            }
+            case TEXTURE_FORMAT_BC3:
+            case TEXTURE_FORMAT_BC3_SRGB:
+            {
+                u8 alpha[16];
+                DecodeBC4Block(src, alpha);
+                DecodeBC1Block(src + 8, texels, true);
+                for (ifast32 i = 0; i < 16; i++)
+                {
+                    texels[i][3] = alpha[i];
+                }
+                break;
+            }
+            case TEXTURE_FORMAT_BC4:
+            case TEXTURE_FORMAT_BC5:
+            {
+                u8 channel[16];
+                for (u32 c = 0; c < channels; c++)
+                {
+                    DecodeBC4Block(src + c * 8, channel);
+                    for (ifast32 i = 0; i < 16; i++)
+                    {
+                        texels[i][c] = channel[i];
+                    }
+                }
+                break;
+            }
+            default:
+            {
+                break;
+            }
+            }
+
+            for (u32 y = 0; y < 4 && by * 4 + y < height; y++)
+            {
+                for (u32 x = 0; x < 4 && bx * 4 + x < width; x++)
+                {
+                    memcpy(dst + (by * 4 + y) * pitch + (bx * 4 + x) * channels,
+                           texels[y * 4 + x], channels);
+                }
+            }
+        }
+    }
+}
+
+local u8 *DecodeTexture(TextureFormat format, const u8 *src, u32 width, u32 height, u32 levels)
+{
+    TextureFormat fallback = formats[format].fallback;
+    u8 *decoded = malloc(TextureDataSize(fallback, width, height, levels));
+    if (!decoded)
+    {
+        return NULL;
+    }
+    u8 *dst = decoded;
+    for (u32 level = 0; level < levels; level++)
+    {
+        u32 w = LevelSize(width, level);
+        u32 h = LevelSize(height, level);
+        DecodeLevel(format, src, w, h, dst);
+        src += RowBytes(format, w) * RowCount(format, h);
+        dst += RowBytes(fallback, w) * RowCount(fallback, h);
+    }
+    return decoded;
+}
+
+TextureUploader *CreateTextureUploader(isize stagingSize, JobSystem *jobs)
+{
+    TextureUploader *up = calloc(1, sizeof(*up));
+    if (!up)
+    {
+        return NULL;
+    }
+    up->staging = CreateStreamBuffer(stagingSize, 3, "texture staging");
+    if (!up->staging)
+    {
+        free(up);
+        return NULL;
+    }
+    up->stagingSize = stagingSize;
+    up->jobs = jobs;
+    return up;
+}
+
+/* data NULL means the data comes out of a compressed pack entry */
+local GLuint QueueUpload(TextureUploader *up, const TextureDesc *desc, const void *data,
+                         isize size, const void *stored, const PackEntry *entry)
+{
+    TextureFormat format = desc->format;
+    const char *label = desc->label ? desc->label : "texture";
+    /* Pack entries bring these straight from the file */
+    u32 longest = desc->width > desc->height ? desc->width : desc->height;
+    u32 maxLevels = 0;
+    while (longest >> maxLevels)
+    {
+        maxLevels++;
+    }
+    if (!desc->width || !desc->height || longest > TEXTURE_MAX_SIZE || !desc->levels ||
+        desc->levels > maxLevels)
+    {
+        fprintf(stderr, "TEXTURE: %s is %ux%u with %u levels\n", label, (unsigned)desc->width,
+                (unsigned)desc->height, (unsigned)desc->levels);
+        return 0;
+    }
+    if (size < TextureDataSize(format, desc->width, desc->height, desc->levels))
+    {
+        fprintf(stderr, "TEXTURE: %s is missing data\n", label);
+        return 0;
+    }
+
+    u8 *decoded = NULL;
+    if (!IsTextureFormatSupported(format))
+    {
+        if (formats[format].fallback == format)
+        {
+            fprintf(stderr, "TEXTURE: %s needs a format GL doesn't support\n", label);
+            return 0;
+        }
+        u8 *unpacked = NULL;
+        if (!data)
+        {
+            data = unpacked = malloc(size);
+            if (!unpacked || !DecodePackEntry(entry, stored, 0, size, unpacked, up->jobs))
+            {
+                free(unpacked);
+                return 0;
+            }
+        }
+        decoded = DecodeTexture(format, data, desc->width, desc->height, desc->levels);
+        free(unpacked);
+        if (!decoded)
+        {
+            return 0;
+        }
+        format = formats[format].fallback;
+        data = decoded;
+        up->stats.texturesDecoded++;
+    }
+
+    /* StepUpload goes at least a row at a time, one that never fits would
+       hold up every upload queued behind it */
+    if (RowBytes(format, desc->width) > up->stagingSize)
+    {
+        fprintf(stderr, "TEXTURE: a row of %s doesn't fit in staging\n", label);
+        free(decoded);
+        return 0;
+    }
+    TextureUpload *u = calloc(1, sizeof(*u));
+    if (!u)
+    {
+        free(decoded);
+        return 0;
+    }
+
+    bool generateMips = desc->generateMips && !formats[format].compressed;
+    u32 storageLevels = generateMips ? maxLevels : desc->levels;
+
+    GLuint texture;
+    glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+    glTextureStorage2D(texture, storageLevels, formats[format].internalFormat, desc->width,
+                       desc->height);
+    if (desc->label)
+    {
+        glObjectLabel(GL_TEXTURE, texture, -1, desc->label);
+    }
+
+    u->texture = texture;
+    u->format = format;
+    u->width = desc->width;
+    u->height = desc->height;
+    u->levels = desc->levels;
+    u->generateMips = generateMips;
+    u->data = data;
+    if (!data)
+    {
+        u->stored = stored;
+        u->entry = entry;
+    }
+    u->decoded = decoded;
+    if (up->tail)
+    {
+        up->tail->next = u;
+    }
+    else
+    {
+        up->head = u;
+    }
+    up->tail = u;
+    up->stats.texturesQueued++;
+    return texture;
+}
+
+GLuint QueueTexture2D(TextureUploader *up, const TextureDesc *desc, const void *data, isize size)
+{
+    return QueueUpload(up, desc, data, size, NULL, NULL);
+}
+
+GLuint QueuePackTexture(TextureUploader *up, const AssetPack *pack, const PackEntry *entry)
+{
+    return QueueStoredPackTexture(up, entry, GetPackEntryStoredData(pack, entry));
+}
+
+GLuint QueueStoredPackTexture(TextureUploader *up, const PackEntry *entry, const void *stored)
+{
+    TextureDesc desc = {0};
+    desc.format = TEXTURE_FORMAT_COUNT;
+    for (ifast32 i = 0; i < TEXTURE_FORMAT_COUNT; i++)
+    {
+        if (formats[i].internalFormat == entry->info[3])
+        {
+            desc.format = i;
+            break;
+        }
+    }
+    if (entry->type != PACK_ENTRY_TEXTURE || desc.format == TEXTURE_FORMAT_COUNT)
+    {
+        fprintf(stderr, "TEXTURE: %s isn't a texture we can load\n", entry->name);
+        return 0;
+    }
+    desc.width = entry->info[0];
+    desc.height = entry->info[1];
+    desc.levels = entry->info[2];
+    desc.label = entry->name;
+    const void *data = entry->compression == PACK_COMPRESSION_NONE ? stored : NULL;
+    return QueueUpload(up, &desc, data, entry->size, stored, entry);
+}
+
+bool IsTextureUploadPending(const TextureUploader *up, GLuint texture)
+{
+    for (const TextureUpload *u = up->head; u; u = u->next)
+    {
+        if (u->texture == texture)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CancelTextureUpload(TextureUploader *up, GLuint texture)
+{
+    TextureUpload *prev = NULL;
+    for (TextureUpload *u = up->head; u; prev = u, u = u->next)
+    {
+        if (u->texture != texture)
+        {
+            continue;
+        }
+        if (prev)
+        {
+            prev->next = u->next;
+        }
+        else
+        {
+            up->head = u->next;
+        }
+        if (up->tail == u)
+        {
+            up->tail = prev;
+        }
+        free(u->decoded);
+        free(u);
+        return;
+    }
+}
+
+/* Uploads as many rows of the current level as fit in staging. Returns
+   false once staging is full. */
+local bool StepUpload(TextureUploader *up, TextureUpload *u)
+{
+    const TextureFormatInfo *info = &formats[u->format];
+    u32 w = LevelSize(u->width, u->level);
+    u32 h = LevelSize(u->height, u->level);
+    isize rowBytes = RowBytes(u->format, w);
+    u32 rows = RowCount(u->format, h) - u->row;
+
+    isize offset;
+    u8 *dst;
+    while (!(dst = AllocStreamBuffer(up->staging, rows * rowBytes, STAGING_ALIGNMENT, &offset)))
+    {
+        if (rows == 1)
+        {
+            return false;
+        }
+        rows = (rows + 1) / 2;
+    }
+    isize size = rows * rowBytes;
+    u64 from = u->levelOffset + u->row * rowBytes;
+    if (u->data)
+    {
+        memcpy(dst, u->data + from, size);
+    }
+    else if (!DecodePackEntry(u->entry, u->stored, from, size, dst, up->jobs))
+    {
+        /* Already reported, upload something defined instead */
+        memset(dst, 0, size);
+    }
+    up->stats.bytesUploaded += size;
+
+    /* Pixel unpack buffer is bound, so the pointer is an offset into it */
+    if (info->compressed)
+    {
+        u32 y = u->row * 4;
+        u32 height = rows * 4 < h - y ? rows * 4 : h - y;
+        glCompressedTextureSubImage2D(u->texture, u->level, 0, y, w, height,
+                                      info->internalFormat, size, (const void *)offset);
+    }
+    else
+    {
+        glTextureSubImage2D(u->texture, u->level, 0, u->row, w, rows, info->format, info->type,
+                            (const void *)offset);
+    }
+
+    u->row += rows;
+    if (u->row == RowCount(u->format, h))
+    {
+        u->levelOffset += RowCount(u->format, h) * rowBytes;
+        u->level++;
+        u->row = 0;
+    }
+    return true;
+}
+
+void ProcessTextureUploads(TextureUploader *up)
+{
+    if (!up->head)
+    {
+        return;
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, GetStreamBufferObject(up->staging));
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    while (up->head)
+    {
+        TextureUpload *u = up->head;
+        if (!StepUpload(up, u))
+        {
+            up->stats.framesDeferred++;
+            break;
+        }
+        if (u->level == u->levels)
+        {
+            if (u->generateMips)
+            {
+                glGenerateTextureMipmap(u->texture);
+            }
+            up->head = u->next;
+            if (!up->head)
+            {
+                up->tail = NULL;
+            }
+            free(u->decoded);
+            free(u);
+            up->stats.texturesCompleted++;
+        }
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    EndStreamBufferFrame(up->staging);
+}
+
+TextureUploadStats GetTextureUploadStats(const TextureUploader *up)
+{
+    return up->stats;
+}
+
+void DestroyTextureUploader(TextureUploader *up)
+{
+    while (up->head)
+    {
+        TextureUpload *u = up->head;
+        up->head = u->next;
+        free(u->decoded);
+        free(u);
+    }
+    DestroyStreamBuffer(up->staging);
+    free(up);
+}
+
+GLuint GetSampler(const SamplerDesc *desc)
+{
+    for (ifast32 i = 0; i < samplerCount; i++)
+    {
+        if (memcmp(&samplers[i].desc, desc, sizeof(*desc)) == 0)
+        {
+            return samplers[i].sampler;
+        }
+    }
+
+    GLuint sampler;
+    glCreateSamplers(1, &sampler);
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, desc->minFilter);
+    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, desc->magFilter);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, desc->wrapS);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, desc->wrapT);
+    if (desc->maxAnisotropy > 1 && (gladHasExtension("GL_ARB_texture_filter_anisotropic") ||
+                                    gladHasExtension("GL_EXT_texture_filter_anisotropic")))
+    {
+        GLfloat limit = 1;
+        glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &limit);
+        glSamplerParameterf(sampler, GL_TEXTURE_MAX_ANISOTROPY,
+                            desc->maxAnisotropy < limit ? desc->maxAnisotropy : limit);
+    }
+
+    if (samplerCount < SAMPLER_CACHE_SIZE)
+    {
+        samplers[samplerCount++] = (SamplerCacheEntry){*desc, sampler};
+    }
+    else
+    {
+        /* Shouldn't happen with a sane set of states; leak rather than
+           hand out a sampler that might get deleted under someone */
+        fputs("TEXTURE: sampler cache is full\n", stderr);
+    }
+    return sampler;
+}
+
+void DestroySamplers(void)
+{
+    for (ifast32 i = 0; i < samplerCount; i++)
+    {
+        glDeleteSamplers(1, &samplers[i].sampler);
+    }
+    samplerCount = 0;
+}
@@ -0,0 +1,118 @@
+#ifndef TEXTURE_H
+#define TEXTURE_H
+#include "glad.h"
+#include "jobs.h"
+#include "pack.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    typedef enum TextureFormat
+    {
+        TEXTURE_FORMAT_RGBA8,
+        TEXTURE_FORMAT_SRGB8_ALPHA8,
+        TEXTURE_FORMAT_R8,
+        TEXTURE_FORMAT_RG8,
+        TEXTURE_FORMAT_BC1, /* S3TC DXT1 with 1 bit alpha */
+        TEXTURE_FORMAT_BC1_SRGB,
+        TEXTURE_FORMAT_BC3, /* S3TC DXT5 */
+        TEXTURE_FORMAT_BC3_SRGB,
+        TEXTURE_FORMAT_BC4, /* RGTC1, one channel */
+        TEXTURE_FORMAT_BC5, /* RGTC2, two channels */
+        TEXTURE_FORMAT_BC7, /* BPTC */
+        TEXTURE_FORMAT_BC7_SRGB,
+        TEXTURE_FORMAT_COUNT
+    } TextureFormat;
+
+    typedef struct TextureDesc
+    {
+        TextureFormat format;
+        u32 width;
+        u32 height;
+        /* Levels present in the data, largest first. Uncompressed levels
+           have rows padded to 4 bytes, compressed ones are whole 4x4
+           blocks. */
+        u32 levels;
+        /* Build the rest of the chain on the GPU once the given levels are
+           in. Ignored for block compressed formats. */
+        bool generateMips;
+        const char *label;
+    } TextureDesc;
+
+    typedef struct TextureUploadStats
+    {
+        u64 texturesQueued;
+        u64 texturesCompleted;
+        u64 bytesUploaded;
+        /* Frames that ran out of staging space with uploads still queued */
+        u64 framesDeferred;
+        /* Textures decoded on the CPU because GL can't sample the format */
+        u64 texturesDecoded;
+    } TextureUploadStats;
+
+    /* Streams texture data to the GPU through a ring of persistently
+       mapped pixel unpack buffers, a bounded amount per frame, so a
+       big upload never blocks the frame it was queued in */
+    typedef struct TextureUploader TextureUploader;
+
+    /* stagingSize is the upload budget per frame. Compressed pack entries
+       are decompressed on jobs' threads, or here without them. */
+    TextureUploader *CreateTextureUploader(isize stagingSize, JobSystem *jobs);
+
+    /* Whether GL can sample format directly. BC1 to BC5 are decoded on the
+       CPU when it can't; BC7 has no fallback, ship an uncompressed
+       variant for GL without BPTC. */
+    bool IsTextureFormatSupported(TextureFormat format);
+
+    /* Creates immutable storage for the texture right away and queues the
+       upload. data has to stay valid while IsTextureUploadPending is true.
+       Returns 0 if the format can't be used at all. */
+    GLuint QueueTexture2D(TextureUploader *up, const TextureDesc *desc, const void *data,
+                          isize size);
+
+    /* PACK_ENTRY_TEXTURE entries, the pack has to stay open until the
+       upload is done. Compressed entries are decompressed a piece at a
+       time straight into staging. */
+    GLuint QueuePackTexture(TextureUploader *up, const AssetPack *pack, const PackEntry *entry);
+
+    /* Same from a copy of the entry's stored bytes, which has to stay
+       valid until the upload is done */
+    GLuint QueueStoredPackTexture(TextureUploader *up, const PackEntry *entry, const void *stored);
+
+    bool IsTextureUploadPending(const TextureUploader *up, GLuint texture);
+
+    /* Drops the texture's upload if it's still queued, so it can be
+       deleted and its data freed. Does nothing otherwise. */
+    void CancelTextureUpload(TextureUploader *up, GLuint texture);
+
+    /* Copies as much queued data as fits in this frame's staging region
+       and issues the uploads. Call once a frame. */
+    void ProcessTextureUploads(TextureUploader *up);
+
+    TextureUploadStats GetTextureUploadStats(const TextureUploader *up);
+
+    /* Drops whatever is still queued. The textures stay valid but may be
+       incomplete. */
+    void DestroyTextureUploader(TextureUploader *up);
+
+    typedef struct SamplerDesc
+    {
+        GLenum minFilter;
+        GLenum magFilter;
+        GLenum wrapS;
+        GLenum wrapT;
+        /* 1 or less for none, clamped to what GL supports */
+        f32 maxAnisotropy;
+    } SamplerDesc;
+
+    /* Sampler objects are shared between every texture that asks for the
+       same state, made the first time it's asked for */
+    GLuint GetSampler(const SamplerDesc *desc);
+
+    void DestroySamplers(void);
+#ifdef __cplusplus
+}
+#endif
+#endif
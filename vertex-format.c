@@ -0,0 +1,267 @@
+#include "vertex-format.h"
+#include "glad.h"
+#include <math.h>
+#include <string.h>
+
+typedef struct EncodingInfo
+{
+    u32 size;
+    GLint components;
+    GLenum type;
+    GLboolean normalized;
+    /* Semantics the encoding makes sense for */
+    u32 semantics;
+} EncodingInfo;
+
+#define SEMANTIC_BIT(s) (1u << (s))
+
+local const EncodingInfo encodings[VERTEX_ENCODING_COUNT] = {
+    [VERTEX_FLOAT3] = {12, 3, GL_FLOAT, GL_FALSE,
+                       SEMANTIC_BIT(VERTEX_POSITION) | SEMANTIC_BIT(VERTEX_COLOR) |
+                           SEMANTIC_BIT(VERTEX_NORMAL)},
+    [VERTEX_HALF4] = {8, 3, GL_HALF_FLOAT, GL_FALSE,
+                      SEMANTIC_BIT(VERTEX_POSITION) | SEMANTIC_BIT(VERTEX_COLOR)},
+    [VERTEX_UNORM16X4] = {8, 3, GL_UNSIGNED_SHORT, GL_TRUE, SEMANTIC_BIT(VERTEX_POSITION)},
+    [VERTEX_UNORM8X4] = {4, 3, GL_UNSIGNED_BYTE, GL_TRUE, SEMANTIC_BIT(VERTEX_COLOR)},
+    [VERTEX_OCT_SNORM16X2] = {4, 2, GL_SHORT, GL_TRUE, SEMANTIC_BIT(VERTEX_NORMAL)},
+};
+
+bool BuildVertexFormat(VertexFormat *fmt, const VertexAttrib *attribs, ifast32 count)
+{
+    memset(fmt, 0, sizeof(*fmt));
+    for (ifast32 i = 0; i < count; i++)
+    {
+        VertexSemantic s = attribs[i].semantic;
+        VertexEncoding e = attribs[i].encoding;
+        if (s >= VERTEX_SEMANTIC_COUNT || e == VERTEX_ENCODING_NONE || e >= VERTEX_ENCODING_COUNT ||
+            !(encodings[e].semantics & SEMANTIC_BIT(s)) || fmt->encoding[s] != VERTEX_ENCODING_NONE)
+        {
+            return false;
+        }
+        /* Every encoding is a multiple of 4 bytes, so attributes stay
+           aligned without padding */
+        fmt->encoding[s] = e;
+        fmt->offset[s] = fmt->stride;
+        fmt->stride += encodings[e].size;
+    }
+    return fmt->stride != 0;
+}
+
+u32 GetVertexFormatCode(const VertexFormat *fmt)
+{
+    /* Semantics are laid out in order of their offsets, so the encodings
+       alone describe the format */
+    u32 code = 0;
+    VertexAttrib order[VERTEX_SEMANTIC_COUNT];
+    ifast32 count = 0;
+    for (ifast32 s = 0; s < VERTEX_SEMANTIC_COUNT; s++)
+    {
+        if (fmt->encoding[s] != VERTEX_ENCODING_NONE)
+        {
+            order[count++] = (VertexAttrib){s, fmt->encoding[s]};
+        }
+    }
+    for (ifast32 i = 1; i < count; i++)
+    {
+        for (ifast32 j = i; j > 0 && fmt->offset[order[j].semantic] < fmt->offset[order[j - 1].semantic]; j--)
+        {
+            VertexAttrib tmp = order[j];
+            order[j] = order[j - 1];
+            order[j - 1] = tmp;
+        }
+    }
+    for (ifast32 i = 0; i < count; i++)
+    {
+        code |= (u32)(order[i].semantic + 1) << (i * 8);
+        code |= (u32)order[i].encoding << (i * 8 + 4);
+    }
+    return code;
+}
+
+bool VertexFormatFromCode(VertexFormat *fmt, u32 code)
+{
+    VertexAttrib attribs[VERTEX_SEMANTIC_COUNT];
+    ifast32 count = 0;
+    for (; count < VERTEX_SEMANTIC_COUNT && (code & 0xf); count++, code >>= 8)
+    {
+        attribs[count] = (VertexAttrib){(code & 0xf) - 1, (code >> 4) & 0xf};
+    }
+    return code == 0 && BuildVertexFormat(fmt, attribs, count);
+}
+
+/* Round to nearest even, flushes denormals, clamps to the largest half */
+local u16 FloatToHalf(f32 f)
+{
+    u32 bits;
+    memcpy(&bits, &f, sizeof(bits));
+    u32 sign = (bits >> 16) & 0x8000;
+    i32 exponent = (i32)((bits >> 23) & 0xff) - 127 + 15;
+    u32 mantissa = bits & 0x7fffff;
+
+    if (((bits >> 23) & 0xff) == 0xff)
+    {
+        return sign | 0x7c00 | (mantissa ? 0x200 : 0);
+    }
+    if (exponent <= 0)
+    {
+        return sign;
+    }
+    u32 half = ((u32)exponent << 10) | (mantissa >> 13);
+    u32 rest = mantissa & 0x1fff;
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+    {
+        half++;
+    }
+    return half >= 0x7c00 ? sign | 0x7bff : sign | half;
+}
+
+local f32 Clamp(f32 v, f32 lo, f32 hi)
+{
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+/* Octahedral mapping of a unit vector onto [-1, 1]^2 */
+local void EncodeOctahedral(const f32 n[3], f32 out[2])
+{
+    f32 l1 = fabsf(n[0]) + fabsf(n[1]) + fabsf(n[2]);
+    if (l1 == 0)
+    {
+        out[0] = 0;
+        out[1] = 0;
+        return;
+    }
+    f32 x = n[0] / l1;
+    f32 y = n[1] / l1;
+    if (n[2] < 0)
+    {
+        f32 ox = (1 - fabsf(y)) * (x >= 0 ? 1 : -1);
+        f32 oy = (1 - fabsf(x)) * (y >= 0 ? 1 : -1);
+        x = ox;
+        y = oy;
+    }
+    out[0] = x;
+    out[1] = y;
+}
+
+local const f32 *SourceAt(const void *base, u32 stride, u32 i)
+{
+    return (const f32 *)((const u8 *)base + (u64)i * stride);
+}
+
+VertexDequant IdentityVertexDequant(void)
+{
+    return (VertexDequant){{1, 1, 1}, {0, 0, 0}};
+}
+
+local void EncodeAttrib(VertexEncoding e, const f32 v[3], const VertexDequant *dq, u8 *dst)
+{
+    switch (e)
+    {
+    case VERTEX_FLOAT3:
+    {
+        memcpy(dst, v, 12);
+        break;
+    }
+    case VERTEX_HALF4:
+    {
+        u16 h[4] = {FloatToHalf(v[0]), FloatToHalf(v[1]), FloatToHalf(v[2]), FloatToHalf(1)};
+        memcpy(dst, h, sizeof(h));
+        break;
+    }
+    case VERTEX_UNORM16X4:
+    {
+        u16 q[4] = {0};
+        for (ifast32 k = 0; k < 3; k++)
+        {
+            f32 t = dq->scale[k] != 0 ? (v[k] - dq->offset[k]) / dq->scale[k] : 0;
+            q[k] = (u16)lrintf(Clamp(t, 0, 1) * 65535.0f);
+        }
+        memcpy(dst, q, sizeof(q));
+        break;
+    }
+    case VERTEX_UNORM8X4:
+    {
+        for (ifast32 k = 0; k < 3; k++)
+        {
+            dst[k] = (u8)lrintf(Clamp(v[k], 0, 1) * 255.0f);
+        }
+        dst[3] = 255;
+        break;
+    }
+    case VERTEX_OCT_SNORM16X2:
+    {
+        f32 oct[2];
+        EncodeOctahedral(v, oct);
+        i16 q[2] = {(i16)lrintf(Clamp(oct[0], -1, 1) * 32767.0f),
+                    (i16)lrintf(Clamp(oct[1], -1, 1) * 32767.0f)};
+        memcpy(dst, q, sizeof(q));
+        break;
+    }
+    default:
+    {
+        break;
+    }
+    }
+}
+
+VertexDequant PackVertices(const VertexFormat *fmt, const VertexSource *src, u32 count,
+                           void *out)
+{
+    VertexDequant dq = IdentityVertexDequant();
+    if (fmt->encoding[VERTEX_POSITION] == VERTEX_UNORM16X4 && count)
+    {
+        f32 lo[3], hi[3];
+        memcpy(lo, SourceAt(src->position, src->stride, 0), sizeof(lo));
+        memcpy(hi, lo, sizeof(hi));
+        for (u32 i = 1; i < count; i++)
+        {
+            const f32 *p = SourceAt(src->position, src->stride, i);
+            for (ifast32 k = 0; k < 3; k++)
+            {
+                lo[k] = fminf(lo[k], p[k]);
+                hi[k] = fmaxf(hi[k], p[k]);
+            }
+        }
+        for (ifast32 k = 0; k < 3; k++)
+        {
+            dq.scale[k] = hi[k] - lo[k];
+            dq.offset[k] = lo[k];
+        }
+    }
+
+    local const f32 up[3] = {0, 0, 1};
+    const void *sources[VERTEX_SEMANTIC_COUNT] = {src->position, src->color, src->normal};
+    u8 *dst = out;
+    for (u32 i = 0; i < count; i++, dst += fmt->stride)
+    {
+        for (ifast32 s = 0; s < VERTEX_SEMANTIC_COUNT; s++)
+        {
+            VertexEncoding e = fmt->encoding[s];
+            if (e == VERTEX_ENCODING_NONE)
+            {
+                continue;
+            }
+            const f32 *v = sources[s] ? SourceAt(sources[s], src->stride, i) : up;
+            EncodeAttrib(e, v, &dq, dst + fmt->offset[s]);
+        }
+    }
+    return dq;
+}
+
+void SetupVertexFormat(GLuint vao, const VertexFormat *fmt, GLuint binding)
+{
+    for (GLuint s = 0; s < VERTEX_SEMANTIC_COUNT; s++)
+    {
+        VertexEncoding e = fmt->encoding[s];
+        if (e == VERTEX_ENCODING_NONE)
+        {
+            glDisableVertexArrayAttrib(vao, s);
+            continue;
+        }
+        const EncodingInfo *info = &encodings[e];
+        glVertexArrayAttribFormat(vao, s, info->components, info->type, info->normalized,
+                                  fmt->offset[s]);
+        glVertexArrayAttribBinding(vao, s, binding);
+        glEnableVertexArrayAttrib(vao, s);
+    }
+}
@@ -0,0 +1,87 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+#include "glad.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Declarative vertex layouts. A format is a list of (semantic,
+       encoding) pairs; offsets, stride and the matching GL attribute setup
+       are derived from it. Each semantic has a fixed attribute location
+       so shaders don't care which encoding a mesh uses. */
+
+    typedef enum VertexSemantic
+    {
+        VERTEX_POSITION, /* location 0, vec3 */
+        VERTEX_COLOR,    /* location 1, vec3 */
+        VERTEX_NORMAL,   /* location 2, vec2 octahedral or vec3 */
+        VERTEX_SEMANTIC_COUNT
+    } VertexSemantic;
+
+    typedef enum VertexEncoding
+    {
+        VERTEX_ENCODING_NONE,
+        VERTEX_FLOAT3,     /* 12 bytes */
+        VERTEX_HALF4,      /* 8 bytes, w unused */
+        VERTEX_UNORM16X4,  /* 8 bytes, positions quantized to the mesh bounds */
+        VERTEX_UNORM8X4,   /* 4 bytes, colors */
+        VERTEX_OCT_SNORM16X2, /* 4 bytes, octahedral unit vectors */
+        VERTEX_ENCODING_COUNT
+    } VertexEncoding;
+
+    typedef struct VertexAttrib
+    {
+        VertexSemantic semantic;
+        VertexEncoding encoding;
+    } VertexAttrib;
+
+    typedef struct VertexFormat
+    {
+        VertexEncoding encoding[VERTEX_SEMANTIC_COUNT];
+        u32 offset[VERTEX_SEMANTIC_COUNT];
+        u32 stride;
+    } VertexFormat;
+
+    /* pos = decoded * scale + offset, for encodings that can't hold the
+       mesh's coordinates directly */
+    typedef struct VertexDequant
+    {
+        f32 scale[3];
+        f32 offset[3];
+    } VertexDequant;
+
+    /* Where PackVertices reads from. Each pointer is the first vertex's
+       f32[3] in an array of stride bytes, normal may be NULL. */
+    typedef struct VertexSource
+    {
+        const void *position;
+        const void *color;
+        const void *normal;
+        u32 stride;
+    } VertexSource;
+
+    /* Returns false for an attribute with an encoding that doesn't fit its
+       semantic or for a semantic listed twice */
+    bool BuildVertexFormat(VertexFormat *fmt, const VertexAttrib *attribs, ifast32 count);
+
+    /* One byte per attribute in layout order, as stored in asset packs */
+    u32 GetVertexFormatCode(const VertexFormat *fmt);
+    bool VertexFormatFromCode(VertexFormat *fmt, u32 code);
+
+    /* Encodes count vertices into out, which holds count * fmt->stride
+       bytes, and returns the transform that undoes the position
+       quantization */
+    VertexDequant PackVertices(const VertexFormat *fmt, const VertexSource *src, u32 count,
+                               void *out);
+
+    VertexDequant IdentityVertexDequant(void);
+
+    /* Enables and describes every attribute of fmt on vao, sourced from
+       vertex buffer binding point binding */
+    void SetupVertexFormat(GLuint vao, const VertexFormat *fmt, GLuint binding);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,351 @@
+#define _DEFAULT_SOURCE //openat, fdopendir, fstatat
+#include "vfs.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define VFS_PATH_SIZE 4096
+
+struct VfsFile
+{
+    u64 hash;
+    u64 size;
+    const struct VfsMount *mount;
+    char *path;
+    /* Path within the mounted directory, points into path */
+    const char *relative;
+    /* Set for files from a pack */
+    const PackEntry *entry;
+};
+
+typedef struct VfsMount
+{
+    /* Kept open so loads resolve relative to it, -1 for packs */
+    int dirFd;
+    const AssetPack *pack;
+    VfsFile *files;
+    ifast32 fileCount;
+    ifast32 fileCap;
+} VfsMount;
+
+struct Vfs
+{
+    JobSystem *jobs;
+    /* Lowest priority first */
+    VfsMount **mounts;
+    ifast32 mountCount;
+    /* Open addressing on the path hash, NULL where empty */
+    const VfsFile **table;
+    u64 tableMask;
+};
+
+Vfs *CreateVfs(JobSystem *jobs)
+{
+    Vfs *vfs = calloc(1, sizeof(*vfs));
+    if (vfs)
+    {
+        vfs->jobs = jobs;
+    }
+    return vfs;
+}
+
+u64 HashVfsPath(const char *path)
+{
+    /* Same as pack names, so a pack mounted at the root hashes the same
+       either way */
+    return HashPackName(path);
+}
+
+VfsPath MakeVfsPath(const char *path)
+{
+    return (VfsPath){path, HashVfsPath(path)};
+}
+
+local void AddFile(VfsMount *m, const char *path, isize relative, u64 size, const PackEntry *entry)
+{
+    if (m->fileCount == m->fileCap)
+    {
+        m->fileCap = m->fileCap ? m->fileCap * 2 : 64;
+        m->files = realloc(m->files, m->fileCap * sizeof(*m->files));
+    }
+    VfsFile *f = &m->files[m->fileCount++];
+    f->hash = HashVfsPath(path);
+    f->size = size;
+    f->mount = m;
+    f->path = strdup(path);
+    f->relative = f->path + relative;
+    f->entry = entry;
+}
+
+/* Takes ownership of fd. path holds the directory's vfs path, length
+   long; relative is where the part inside the mounted directory starts. */
+local void ScanDirectory(VfsMount *m, int fd, char *path, isize length, isize relative)
+{
+    DIR *dir = fdopendir(fd);
+    if (!dir)
+    {
+        close(fd);
+        return;
+    }
+    for (struct dirent *d; (d = readdir(dir));)
+    {
+        /* Skips ".", ".." and hidden files along with them */
+        if (d->d_name[0] == '.')
+        {
+            continue;
+        }
+        isize nameLength = strlen(d->d_name);
+        isize at = length ? length + 1 : 0;
+        if (at + nameLength >= VFS_PATH_SIZE)
+        {
+            fprintf(stderr, "VFS: skipping %.*s/%s, the path is too long\n", (int)length, path,
+                    d->d_name);
+            continue;
+        }
+        if (length)
+        {
+            path[length] = '/';
+        }
+        memcpy(path + at, d->d_name, nameLength + 1);
+
+        /* Symlinks only to files, a directory one could lead back up and
+           never end */
+        struct stat st;
+        if (fstatat(dirfd(dir), d->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0 ||
+            (S_ISLNK(st.st_mode) && (fstatat(dirfd(dir), d->d_name, &st, 0) != 0 ||
+                                     !S_ISREG(st.st_mode))))
+        {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode))
+        {
+            int sub = openat(dirfd(dir), d->d_name,
+                             O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+            if (sub >= 0)
+            {
+                ScanDirectory(m, sub, path, at + nameLength, relative);
+            }
+        }
+        else if (S_ISREG(st.st_mode))
+        {
+            AddFile(m, path, relative, st.st_size, NULL);
+        }
+    }
+    closedir(dir);
+}
+
+/* Rebuilt from scratch on every mount, which is rare, in mount order so
+   later mounts replace what they hide */
+local void RebuildTable(Vfs *vfs)
+{
+    ifast32 total = 0;
+    for (ifast32 i = 0; i < vfs->mountCount; i++)
+    {
+        total += vfs->mounts[i]->fileCount;
+    }
+    u64 capacity = 16;
+    while (capacity < (u64)total * 2)
+    {
+        capacity *= 2;
+    }
+    free(vfs->table);
+    vfs->table = calloc(capacity, sizeof(*vfs->table));
+    vfs->tableMask = capacity - 1;
+    for (ifast32 i = 0; i < vfs->mountCount; i++)
+    {
+        const VfsMount *m = vfs->mounts[i];
+        for (ifast32 j = 0; j < m->fileCount; j++)
+        {
+            const VfsFile *f = &m->files[j];
+            u64 slot = f->hash & vfs->tableMask;
+            while (vfs->table[slot] && vfs->table[slot]->hash != f->hash)
+            {
+                slot = (slot + 1) & vfs->tableMask;
+            }
+            vfs->table[slot] = f;
+        }
+    }
+}
+
+local VfsMount *AddMount(Vfs *vfs)
+{
+    vfs->mounts = realloc(vfs->mounts, (vfs->mountCount + 1) * sizeof(*vfs->mounts));
+    VfsMount *m = calloc(1, sizeof(*m));
+    m->dirFd = -1;
+    vfs->mounts[vfs->mountCount++] = m;
+    return m;
+}
+
+/* Copies mountPoint into path, returns its length */
+local isize StartPath(char *path, const char *mountPoint)
+{
+    isize length = mountPoint ? strlen(mountPoint) : 0;
+    if (length >= VFS_PATH_SIZE - 1)
+    {
+        return -1;
+    }
+    memcpy(path, mountPoint ? mountPoint : "", length + 1);
+    return length;
+}
+
+bool MountVfsDirectory(Vfs *vfs, const char *dir, const char *mountPoint)
+{
+    char path[VFS_PATH_SIZE];
+    isize length = StartPath(path, mountPoint);
+    int fd = open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0 || length < 0)
+    {
+        fprintf(stderr, "VFS: could not mount %s\n", dir);
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return false;
+    }
+    VfsMount *m = AddMount(vfs);
+    m->dirFd = fd;
+    int scan = dup(fd);
+    if (scan >= 0)
+    {
+        ScanDirectory(m, scan, path, length, length ? length + 1 : 0);
+    }
+    RebuildTable(vfs);
+    return true;
+}
+
+bool MountVfsPack(Vfs *vfs, const AssetPack *pack, const char *mountPoint)
+{
+    char path[VFS_PATH_SIZE];
+    isize length = StartPath(path, mountPoint);
+    if (length < 0)
+    {
+        fprintf(stderr, "VFS: mount point %s is too long\n", mountPoint);
+        return false;
+    }
+    VfsMount *m = AddMount(vfs);
+    m->pack = pack;
+    ifast32 entryCount;
+    const PackEntry *entries = GetPackEntries(pack, &entryCount);
+    for (ifast32 i = 0; i < entryCount; i++)
+    {
+        snprintf(path + length, VFS_PATH_SIZE - length, "%s%s", length ? "/" : "",
+                 entries[i].name);
+        AddFile(m, path, 0, entries[i].size, &entries[i]);
+    }
+    RebuildTable(vfs);
+    return true;
+}
+
+const VfsFile *FindVfsFile(const Vfs *vfs, u64 pathHash)
+{
+    if (!vfs->table)
+    {
+        return NULL;
+    }
+    for (u64 slot = pathHash & vfs->tableMask; vfs->table[slot];
+         slot = (slot + 1) & vfs->tableMask)
+    {
+        if (vfs->table[slot]->hash == pathHash)
+        {
+            return vfs->table[slot];
+        }
+    }
+    return NULL;
+}
+
+const char *GetVfsFilePath(const VfsFile *f)
+{
+    return f->path;
+}
+
+isize GetVfsFileSize(const VfsFile *f)
+{
+    return f->size;
+}
+
+void *LoadVfsFile(const Vfs *vfs, const VfsFile *f, isize *size)
+{
+    u8 *data = malloc(f->size + 1);
+    if (!data)
+    {
+        return NULL;
+    }
+    isize read = 0;
+    if (f->entry)
+    {
+        bool ok = ReadPackEntry(f->mount->pack, f->entry, 0, f->size, data, vfs->jobs);
+        read = ok ? (isize)f->size : -1;
+    }
+    else
+    {
+        int fd = openat(f->mount->dirFd, f->relative, O_RDONLY | O_CLOEXEC);
+        read = fd < 0 ? -1 : 0;
+        /* Stops short if the file shrank since it was mounted */
+        while (fd >= 0 && read < (isize)f->size)
+        {
+            ssize_t n = pread(fd, data + read, f->size - read, read);
+            if (n <= 0)
+            {
+                read = n < 0 ? -1 : read;
+                break;
+            }
+            read += n;
+        }
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+    if (read < 0)
+    {
+        fprintf(stderr, "VFS: could not read %s\n", f->path);
+        free(data);
+        return NULL;
+    }
+    data[read] = 0;
+    if (size)
+    {
+        *size = read;
+    }
+    return data;
+}
+
+void *LoadVfsPath(const Vfs *vfs, VfsPath path, isize *size)
+{
+    const VfsFile *f = FindVfsFile(vfs, path.hash);
+    if (!f || strcmp(f->path, path.path) != 0)
+    {
+        fprintf(stderr, "VFS: %s isn't in any mount\n", path.path);
+        return NULL;
+    }
+    return LoadVfsFile(vfs, f, size);
+}
+
+void DestroyVfs(Vfs *vfs)
+{
+    if (!vfs)
+    {
+        return;
+    }
+    for (ifast32 i = 0; i < vfs->mountCount; i++)
+    {
+        VfsMount *m = vfs->mounts[i];
+        for (ifast32 j = 0; j < m->fileCount; j++)
+        {
+            free(m->files[j].path);
+        }
+        if (m->dirFd >= 0)
+        {
+            close(m->dirFd);
+        }
+        free(m->files);
+        free(m);
+    }
+    free(vfs->mounts);
+    free(vfs->table);
+    free(vfs);
+}
@@ -0,0 +1,68 @@
+#ifndef VFS_H
+#define VFS_H
+#include "jobs.h"
+#include "pack.h"
+#include "rutils/def.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Read only files from directories and asset packs mounted on top of
+       each other, a file in a later mount hiding the same path in earlier
+       ones. Every mount is scanned once, when it's mounted, into a single
+       in-memory table keyed by path hash, so finding a file never touches
+       the filesystem and loading one is an open and a read.
+
+       Paths are '/' separated with no "." or ".." parts and no leading or
+       doubled slashes. Look them up by HashVfsPath, or through a VfsPath,
+       computed once up front for paths the code knows about. Directory
+       symlinks aren't followed; file symlinks are. */
+
+    typedef struct Vfs Vfs;
+    typedef struct VfsFile VfsFile;
+
+    /* A path along with its hash */
+    typedef struct VfsPath
+    {
+        const char *path;
+        u64 hash;
+    } VfsPath;
+
+    /* jobs decompresses compressed pack entries, may be NULL */
+    Vfs *CreateVfs(JobSystem *jobs);
+
+    /* Everything under dir, recursively, shows up under mountPoint (the
+       root if NULL), leaving out hidden files and directories. Returns
+       false if dir can't be read. */
+    bool MountVfsDirectory(Vfs *vfs, const char *dir, const char *mountPoint);
+
+    /* Every entry shows up as a file named after it under mountPoint. The
+       pack has to outlive the vfs. */
+    bool MountVfsPack(Vfs *vfs, const AssetPack *pack, const char *mountPoint);
+
+    u64 HashVfsPath(const char *path);
+
+    /* path has to outlive the VfsPath */
+    VfsPath MakeVfsPath(const char *path);
+
+    /* NULL if nothing mounted has the file */
+    const VfsFile *FindVfsFile(const Vfs *vfs, u64 pathHash);
+
+    const char *GetVfsFilePath(const VfsFile *f);
+
+    /* Size as of when it was mounted */
+    isize GetVfsFileSize(const VfsFile *f);
+
+    /* The whole file with a 0 after it, so text can be used as a string.
+       Free it with free(). NULL if it can't be read. */
+    void *LoadVfsFile(const Vfs *vfs, const VfsFile *f, isize *size);
+
+    /* Looks path up and loads it, reporting files that aren't there */
+    void *LoadVfsPath(const Vfs *vfs, VfsPath path, isize *size);
+
+    void DestroyVfs(Vfs *vfs);
+#ifdef __cplusplus
+}
+#endif
+#endif